@@ -0,0 +1,371 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2025-2026, Lawrence Livermore National Security,
+ * University of Maryland Baltimore County, and the SUNDIALS contributors.
+ * Copyright (c) 2013-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * Copyright (c) 2002-2013, Lawrence Livermore National Security.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * This benchmark times the LU factorization (setup) and solve of a
+ * random N by N system with SUNLinSol_Dense, with a copy of the
+ * unblocked right-looking LU factorization previously used by
+ * SUNDlsMat_denseGETRF, and, if SUNDIALS was built with LAPACK, with
+ * SUNLinSol_LapackDense.
+ *
+ * Usage: dense_lu_benchmark <N> [<number of repetitions>]
+ * -----------------------------------------------------------------*/
+
+#include <sundials/sundials_config.h>
+
+/* POSIX timers */
+#if defined(SUNDIALS_HAVE_POSIX_TIMERS)
+#include <stddef.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <nvector/nvector_serial.h>
+#include <sundials/sundials_core.h>
+#include <sundials/sundials_dense.h>
+#include <sunlinsol/sunlinsol_dense.h>
+#include <sunmatrix/sunmatrix_dense.h>
+
+#if defined(SUNDIALS_BLAS_LAPACK_ENABLED)
+#include <sunlinsol/sunlinsol_lapackdense.h>
+#endif
+
+#define ZERO SUN_RCONST(0.0)
+#define ONE  SUN_RCONST(1.0)
+
+/* Timing and helper functions */
+static double get_time(void);
+static void fill_matrix(SUNMatrix A);
+static sunrealtype max_residual(SUNMatrix A, N_Vector x, N_Vector b);
+static void print_stats(const char* name, double* setup_times,
+                        double* solve_times, int nreps, sunindextype N,
+                        sunrealtype residual);
+
+/* Reference unblocked factorization */
+static sunindextype reference_getrf(sunrealtype** a, sunindextype m,
+                                    sunindextype n, sunindextype* p);
+static int run_reference(SUNMatrix A, N_Vector x, N_Vector b, int nreps);
+
+static int run_linsol(const char* name, SUNLinearSolver LS, SUNMatrix A,
+                      N_Vector x, N_Vector b, int nreps);
+
+#if defined(SUNDIALS_HAVE_POSIX_TIMERS)
+static time_t base_time_tv_sec = 0;
+#endif
+
+int main(int argc, char* argv[])
+{
+  SUNContext sunctx = NULL;
+  SUNMatrix A       = NULL;
+  N_Vector x        = NULL;
+  N_Vector b        = NULL;
+  SUNLinearSolver LS;
+  sunindextype N;
+  int nreps    = 5;
+  int nthreads = 1;
+  int fails    = 0;
+
+  if (argc < 2)
+  {
+    printf("ERROR: ONE (1) input required\n");
+    printf("Usage: %s <N> [<number of repetitions>] [<number of threads>]\n",
+           argv[0]);
+    return -1;
+  }
+
+  N = (sunindextype)atol(argv[1]);
+  if (N <= 0)
+  {
+    printf("ERROR: matrix size must be a positive integer\n");
+    return -1;
+  }
+  if (argc > 2) { nreps = atoi(argv[2]); }
+  if (nreps <= 0)
+  {
+    printf("ERROR: number of repetitions must be a positive integer\n");
+    return -1;
+  }
+  if (argc > 3) { nthreads = atoi(argv[3]); }
+  if (nthreads <= 0)
+  {
+    printf("ERROR: number of threads must be a positive integer\n");
+    return -1;
+  }
+
+#if defined(SUNDIALS_HAVE_POSIX_TIMERS)
+  {
+    struct timespec spec;
+    clock_gettime(CLOCK_MONOTONIC, &spec);
+    base_time_tv_sec = spec.tv_sec;
+  }
+#endif
+
+  if (SUNContext_Create(SUN_COMM_NULL, &sunctx)) { return -1; }
+
+  A = SUNDenseMatrix(N, N, sunctx);
+  x = N_VNew_Serial(N, sunctx);
+  b = N_VNew_Serial(N, sunctx);
+  if (!A || !x || !b) { return -1; }
+
+  srand(42);
+  fill_matrix(A);
+  N_VConst(ONE, b);
+
+  printf("Dense LU benchmark: N = %ld, repetitions = %d, threads = %d\n",
+         (long int)N, nreps, nthreads);
+  printf("%-22s %14s %14s %14s %14s %12s\n", "solver", "setup avg (s)",
+         "setup min (s)", "solve avg (s)", "GFLOP/s", "residual");
+
+  fails += run_reference(A, x, b, nreps);
+
+  LS = SUNLinSol_Dense(x, A, sunctx);
+  if (SUNLinSol_DenseSetNumThreads(LS, nthreads)) { return -1; }
+  fails += run_linsol("SUNLinSol_Dense", LS, A, x, b, nreps);
+  SUNLinSolFree(LS);
+
+#if defined(SUNDIALS_BLAS_LAPACK_ENABLED)
+  LS = SUNLinSol_LapackDense(x, A, sunctx);
+  fails += run_linsol("SUNLinSol_LapackDense", LS, A, x, b, nreps);
+  SUNLinSolFree(LS);
+#endif
+
+  SUNMatDestroy(A);
+  N_VDestroy(x);
+  N_VDestroy(b);
+  SUNContext_Free(&sunctx);
+
+  return fails;
+}
+
+/* ----------------------------------------------------------------------
+ * Time the reference factorization and solve
+ * --------------------------------------------------------------------*/
+static int run_reference(SUNMatrix A, N_Vector x, N_Vector b, int nreps)
+{
+  const sunindextype N = SUNDenseMatrix_Columns(A);
+  SUNMatrix LU;
+  sunindextype* pivots;
+  double *setup_times, *solve_times, start;
+  int i;
+
+  LU          = SUNMatClone(A);
+  pivots      = (sunindextype*)malloc(N * sizeof(sunindextype));
+  setup_times = (double*)malloc(nreps * sizeof(double));
+  solve_times = (double*)malloc(nreps * sizeof(double));
+
+  for (i = 0; i < nreps; i++)
+  {
+    SUNMatCopy(A, LU);
+    start = get_time();
+    if (reference_getrf(SUNDenseMatrix_Cols(LU), N, N, pivots))
+    {
+      printf("ERROR: reference factorization failed\n");
+      return 1;
+    }
+    setup_times[i] = get_time() - start;
+
+    N_VScale(ONE, b, x);
+    start = get_time();
+    SUNDlsMat_denseGETRS(SUNDenseMatrix_Cols(LU), N, pivots,
+                         N_VGetArrayPointer(x));
+    solve_times[i] = get_time() - start;
+  }
+
+  print_stats("reference (unblocked)", setup_times, solve_times, nreps, N,
+              max_residual(A, x, b));
+
+  SUNMatDestroy(LU);
+  free(pivots);
+  free(setup_times);
+  free(solve_times);
+
+  return 0;
+}
+
+/* ----------------------------------------------------------------------
+ * Time the setup and solve of a dense linear solver
+ * --------------------------------------------------------------------*/
+static int run_linsol(const char* name, SUNLinearSolver LS, SUNMatrix A,
+                      N_Vector x, N_Vector b, int nreps)
+{
+  const sunindextype N = SUNDenseMatrix_Columns(A);
+  SUNMatrix LU;
+  double *setup_times, *solve_times, start;
+  int i;
+
+  if (!LS || SUNLinSolInitialize(LS)) { return 1; }
+
+  LU          = SUNMatClone(A);
+  setup_times = (double*)malloc(nreps * sizeof(double));
+  solve_times = (double*)malloc(nreps * sizeof(double));
+
+  for (i = 0; i < nreps; i++)
+  {
+    SUNMatCopy(A, LU);
+    start = get_time();
+    if (SUNLinSolSetup(LS, LU))
+    {
+      printf("ERROR: %s setup failed\n", name);
+      return 1;
+    }
+    setup_times[i] = get_time() - start;
+
+    start = get_time();
+    if (SUNLinSolSolve(LS, LU, x, b, ZERO))
+    {
+      printf("ERROR: %s solve failed\n", name);
+      return 1;
+    }
+    solve_times[i] = get_time() - start;
+  }
+
+  print_stats(name, setup_times, solve_times, nreps, N, max_residual(A, x, b));
+
+  SUNMatDestroy(LU);
+  free(setup_times);
+  free(solve_times);
+
+  return 0;
+}
+
+/* ----------------------------------------------------------------------
+ * Fill the matrix with uniform random values in [-1, 1]
+ * --------------------------------------------------------------------*/
+static void fill_matrix(SUNMatrix A)
+{
+  const sunindextype M = SUNDenseMatrix_Rows(A);
+  const sunindextype N = SUNDenseMatrix_Columns(A);
+  sunindextype i, j;
+
+  for (j = 0; j < N; j++)
+  {
+    sunrealtype* col_j = SUNDenseMatrix_Column(A, j);
+    for (i = 0; i < M; i++)
+    {
+      col_j[i] = 2 * ((sunrealtype)rand() / (sunrealtype)RAND_MAX) - ONE;
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+ * Compute the max norm of the residual b - A x
+ * --------------------------------------------------------------------*/
+static sunrealtype max_residual(SUNMatrix A, N_Vector x, N_Vector b)
+{
+  N_Vector r = N_VClone(b);
+  sunrealtype res;
+
+  SUNMatMatvec(A, x, r);
+  N_VLinearSum(ONE, b, -ONE, r, r);
+  res = N_VMaxNorm(r);
+  N_VDestroy(r);
+
+  return res;
+}
+
+/* ----------------------------------------------------------------------
+ * Print the average and minimum times and the factorization rate
+ * --------------------------------------------------------------------*/
+static void print_stats(const char* name, double* setup_times,
+                        double* solve_times, int nreps, sunindextype N,
+                        sunrealtype residual)
+{
+  double setup_avg = 0.0, setup_min = setup_times[0], solve_avg = 0.0;
+  const double flops = 2.0 / 3.0 * (double)N * (double)N * (double)N;
+  int i;
+
+  for (i = 0; i < nreps; i++)
+  {
+    setup_avg += setup_times[i];
+    solve_avg += solve_times[i];
+    if (setup_times[i] < setup_min) { setup_min = setup_times[i]; }
+  }
+  setup_avg /= nreps;
+  solve_avg /= nreps;
+
+  printf("%-22s %14.6e %14.6e %14.6e %14.4f %12.4e\n", name, setup_avg,
+         setup_min, solve_avg,
+         (setup_min > 0.0) ? flops / setup_min * 1.0e-9 : 0.0,
+         (double)residual);
+}
+
+/* ----------------------------------------------------------------------
+ * Unblocked right-looking LU factorization with partial pivoting
+ * --------------------------------------------------------------------*/
+static sunindextype reference_getrf(sunrealtype** a, sunindextype m,
+                                    sunindextype n, sunindextype* p)
+{
+  sunindextype i, j, k, l;
+  sunrealtype *col_j, *col_k;
+  sunrealtype temp, mult, a_kj;
+
+  for (k = 0; k < n; k++)
+  {
+    col_k = a[k];
+
+    l = k;
+    for (i = k + 1; i < m; i++)
+    {
+      if (SUNRabs(col_k[i]) > SUNRabs(col_k[l])) { l = i; }
+    }
+    p[k] = l;
+
+    if (col_k[l] == ZERO) { return (k + 1); }
+
+    if (l != k)
+    {
+      for (i = 0; i < n; i++)
+      {
+        temp    = a[i][l];
+        a[i][l] = a[i][k];
+        a[i][k] = temp;
+      }
+    }
+
+    mult = ONE / col_k[k];
+    for (i = k + 1; i < m; i++) { col_k[i] *= mult; }
+
+    for (j = k + 1; j < n; j++)
+    {
+      col_j = a[j];
+      a_kj  = col_j[k];
+      if (a_kj != ZERO)
+      {
+        for (i = k + 1; i < m; i++) { col_j[i] -= a_kj * col_k[i]; }
+      }
+    }
+  }
+
+  return (0);
+}
+
+/* ----------------------------------------------------------------------
+ * Get the current time in seconds
+ * --------------------------------------------------------------------*/
+static double get_time(void)
+{
+  double time;
+#if defined(SUNDIALS_HAVE_POSIX_TIMERS)
+  struct timespec spec;
+  clock_gettime(CLOCK_MONOTONIC, &spec);
+  time = (double)(spec.tv_sec - base_time_tv_sec) +
+         ((double)(spec.tv_nsec) / 1E9);
+#else
+  time = 0;
+#endif
+  return time;
+}
@@ -59,6 +59,25 @@ int diffusion_jac(sunrealtype t, N_Vector u, N_Vector f, SUNMatrix Jac,
   return 0;
 }
 
+int diffusion_dirderiv(sunrealtype t, N_Vector u, N_Vector v, N_Vector Jv,
+                       void* user_data)
+{
+  // Access problem data
+  UserData* udata = (UserData*)user_data;
+
+  SUNDIALS_CXX_MARK_FUNCTION(udata->prof);
+
+  // The RHS is linear in u, the directional derivative is the Laplacian of v
+  // without the forcing term
+  bool forcing   = udata->forcing;
+  udata->forcing = false;
+  int flag       = laplacian(t, v, Jv, udata);
+  udata->forcing = forcing;
+  if (check_flag(&flag, "laplacian", 1)) return -1;
+
+  return 0;
+}
+
 #elif defined(BENCHMARK_DAE)
 
 int diffusion(sunrealtype t, N_Vector u, N_Vector up, N_Vector res,
@@ -100,6 +119,27 @@ int diffusion_jac(sunrealtype t, sunrealtype cj, N_Vector u, N_Vector up,
   return 0;
 }
 
+int diffusion_dirderiv(sunrealtype t, N_Vector u, N_Vector up, N_Vector vu,
+                       N_Vector vup, N_Vector Jv, void* user_data)
+{
+  // Access problem data
+  UserData* udata = (UserData*)user_data;
+
+  SUNDIALS_CXX_MARK_FUNCTION(udata->prof);
+
+  // The residual is linear in u and up, the directional derivative is
+  // vup - Laplacian(vu) without the forcing term
+  bool forcing   = udata->forcing;
+  udata->forcing = false;
+  int flag       = laplacian(t, vu, Jv, udata);
+  udata->forcing = forcing;
+  if (check_flag(&flag, "laplacian", 1)) return -1;
+
+  N_VLinearSum(ONE, vup, -ONE, Jv, Jv);
+
+  return 0;
+}
+
 #else
 #error "Missing ODE/DAE preprocessor directive"
 #endif
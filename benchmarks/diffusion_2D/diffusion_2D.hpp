@@ -231,6 +231,10 @@ int diffusion(sunrealtype t, N_Vector u, N_Vector f, void* user_data);
 int diffusion_jac(sunrealtype t, N_Vector u, N_Vector f, SUNMatrix Jac,
                   void* user_data, N_Vector tmp1, N_Vector tmp2, N_Vector tmp3);
 
+// Exact Jacobian-vector product (directional derivative of the RHS)
+int diffusion_dirderiv(sunrealtype t, N_Vector u, N_Vector v, N_Vector Jv,
+                       void* user_data);
+
 // Preconditioner setup and solve functions
 int PSetup(sunrealtype t, N_Vector u, N_Vector f, sunbooleantype jok,
            sunbooleantype* jcurPtr, sunrealtype gamma, void* user_data);
@@ -253,6 +257,10 @@ int diffusion_jac(sunrealtype t, sunrealtype cj, N_Vector u, N_Vector up,
                   N_Vector res, SUNMatrix Jac, void* user_data, N_Vector tmp1,
                   N_Vector tmp2, N_Vector tmp3);
 
+// Exact Jacobian-vector product (directional derivative of the residual)
+int diffusion_dirderiv(sunrealtype t, N_Vector u, N_Vector up, N_Vector vu,
+                       N_Vector vup, N_Vector Jv, void* user_data);
+
 // Preconditioner setup and solve functions
 int PSetup(sunrealtype t, N_Vector u, N_Vector up, N_Vector res, sunrealtype cj,
            void* user_data);
@@ -39,6 +39,7 @@ struct UserOptions
 
   // Linear solver and preconditioner settings
   std::string ls       = "cg";  // linear solver to use
+  std::string jtimes   = "dq";  // Jacobian-vector product
   bool preconditioning = true;  // preconditioner on/off
   bool lsinfo          = false; // output residual history
   int liniters         = 20;    // number of linear iterations
@@ -309,6 +310,19 @@ int main(int argc, char* argv[])
       }
 #endif
 
+      if (uopts.jtimes != "dq" && uopts.jtimes != "dirderiv")
+      {
+        std::cerr << "ERROR: Invalid Jacobian-vector product option\n";
+        return 1;
+      }
+
+      if (uopts.jtimes == "dirderiv" && uopts.ls != "sludist")
+      {
+        // Use the exact directional derivative instead of difference quotients
+        flag = ARKodeSetJacTimesDirDeriv(arkode_mem, diffusion_dirderiv);
+        if (check_flag(&flag, "ARKodeSetJacTimesDirDeriv", 1)) { return 1; }
+      }
+
       if (uopts.preconditioning)
       {
         // Attach preconditioner
@@ -586,6 +600,13 @@ int UserOptions::parse_args(vector<string>& args, bool outproc)
     args.erase(it);
   }
 
+  it = find(args.begin(), args.end(), "--jtimes");
+  if (it != args.end())
+  {
+    jtimes = *(it + 1);
+    args.erase(it, it + 2);
+  }
+
   it = find(args.begin(), args.end(), "--liniters");
   if (it != args.end())
   {
@@ -625,6 +646,7 @@ void UserOptions::help()
   cout << "  --nonlinear             : disable linearly implicit flag" << endl;
   cout << "  --order <ord>           : method order" << endl;
   cout << "  --ls <cg|gmres|sludist> : linear solver" << endl;
+  cout << "  --jtimes <dq|dirderiv>  : Jacobian-vector product" << endl;
   cout << "  --lsinfo                : output residual history" << endl;
   cout << "  --liniters <iters>      : max number of iterations" << endl;
   cout << "  --epslin <factor>       : linear tolerance factor" << endl;
@@ -676,6 +698,7 @@ void UserOptions::print()
       cout << " Linear solver options:" << endl;
       cout << " --------------------------------- " << endl;
       cout << " LS       = " << ls << endl;
+      cout << " jtimes   = " << jtimes << endl;
       cout << " precond  = " << preconditioning << endl;
       cout << " LS info  = " << lsinfo << endl;
       cout << " LS iters = " << liniters << endl;
@@ -30,6 +30,7 @@ struct UserOptions
 
   // Linear solver and preconditioner settings
   std::string ls       = "cg"; // linear solver to use
+  std::string jtimes   = "dq"; // Jacobian-vector product
   bool preconditioning = true; // preconditioner on/off
   int liniters         = 20;   // number of linear iterations
   sunrealtype epslin   = ZERO; // linear solver tolerance factor
@@ -271,6 +272,19 @@ int main(int argc, char* argv[])
     }
 #endif
 
+    if (uopts.jtimes != "dq" && uopts.jtimes != "dirderiv")
+    {
+      std::cerr << "ERROR: Invalid Jacobian-vector product option\n";
+      return 1;
+    }
+
+    if (uopts.jtimes == "dirderiv" && uopts.ls != "sludist")
+    {
+      // Use the exact directional derivative instead of difference quotients
+      flag = IDASetJacTimesDirDeriv(ida_mem, diffusion_dirderiv);
+      if (check_flag(&flag, "IDASetJacTimesDirDeriv", 1)) { return 1; }
+    }
+
     if (uopts.preconditioning)
     {
       // Attach preconditioner
@@ -440,6 +454,13 @@ int UserOptions::parse_args(vector<string>& args, bool outproc)
     args.erase(it, it + 2);
   }
 
+  it = find(args.begin(), args.end(), "--jtimes");
+  if (it != args.end())
+  {
+    jtimes = *(it + 1);
+    args.erase(it, it + 2);
+  }
+
   it = find(args.begin(), args.end(), "--liniters");
   if (it != args.end())
   {
@@ -465,6 +486,7 @@ void UserOptions::help()
   cout << "  --rtol <rtol>           : relative tolerance" << endl;
   cout << "  --atol <atol>           : absolute tolerance" << endl;
   cout << "  --ls <cg|gmres|sludist> : linear solver" << endl;
+  cout << "  --jtimes <dq|dirderiv>  : Jacobian-vector product" << endl;
   cout << "  --liniters <iters>      : max number of iterations" << endl;
   cout << "  --epslin <factor>       : linear tolerance factor" << endl;
   cout << "  --noprec                : disable preconditioner" << endl;
@@ -500,6 +522,7 @@ void UserOptions::print()
     cout << " Linear solver options:" << endl;
     cout << " --------------------------------- " << endl;
     cout << " LS       = " << ls << endl;
+    cout << " jtimes   = " << jtimes << endl;
     cout << " precond  = " << preconditioning << endl;
     cout << " LS iters = " << liniters << endl;
     cout << " epslin   = " << epslin << endl;
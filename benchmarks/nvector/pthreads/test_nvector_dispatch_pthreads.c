@@ -0,0 +1,219 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2025-2026, Lawrence Livermore National Security,
+ * University of Maryland Baltimore County, and the SUNDIALS contributors.
+ * Copyright (c) 2013-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * Copyright (c) 2002-2013, Lawrence Livermore National Security.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * This benchmark compares the cost of dispatching work to threads
+ * in the POSIX threads NVECTOR module, which uses a persistent
+ * thread pool, against creating and joining a set of threads for
+ * every vector operation. The linear sum z = a*x + b*y is timed for
+ * both approaches and the average time per operation is reported.
+ * -----------------------------------------------------------------*/
+
+#include <nvector/nvector_pthreads.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sundials/sundials_config.h>
+#include <sundials/sundials_types.h>
+
+#if defined(SUNDIALS_HAVE_POSIX_TIMERS)
+#include <time.h>
+#endif
+
+/* data for the create/join reference implementation */
+typedef struct
+{
+  sunindextype start, end;
+  sunrealtype a, b;
+  sunrealtype *x, *y, *z;
+} LinearSumData;
+
+static void* LinearSumKernel(void* arg);
+static void LinearSumCreateJoin(int nthreads, sunindextype N, sunrealtype a,
+                                sunrealtype* x, sunrealtype b, sunrealtype* y,
+                                sunrealtype* z);
+static double get_time(void);
+
+/* ----------------------------------------------------------------------
+ * Main dispatch benchmark
+ * --------------------------------------------------------------------*/
+int main(int argc, char* argv[])
+{
+  SUNContext ctx = NULL; /* SUNDIALS context */
+  N_Vector X, Y, Z;      /* test vectors     */
+  sunindextype veclen;   /* vector length    */
+  int ntests;            /* number of tests  */
+  int nthreads;          /* number of threads */
+  int i, flag;
+  double start, pool_time, create_time;
+
+  /* check input */
+  if (argc < 4)
+  {
+    printf("ERROR: THREE (3) arguments required: ");
+    printf("<vector length> <number of tests> <number of threads>\n");
+    return (-1);
+  }
+
+  veclen = (sunindextype)atol(argv[1]);
+  if (veclen <= 0)
+  {
+    printf("ERROR: length of vector must be a positive integer \n");
+    return (-1);
+  }
+
+  ntests = (int)atol(argv[2]);
+  if (ntests <= 0)
+  {
+    printf("ERROR: number of tests must be a positive integer \n");
+    return (-1);
+  }
+
+  nthreads = (int)atol(argv[3]);
+  if (nthreads <= 0)
+  {
+    printf("ERROR: number of threads must be a positive integer \n");
+    return (-1);
+  }
+
+  printf("\nRunning with: \n");
+  printf("  vector length         %ld \n", (long int)veclen);
+  printf("  number of tests       %d  \n", ntests);
+  printf("  number of threads     %d  \n", nthreads);
+
+  flag = SUNContext_Create(SUN_COMM_NULL, &ctx);
+  if (flag) { return flag; }
+
+  X = N_VNew_Pthreads(veclen, nthreads, ctx);
+  Y = N_VClone(X);
+  Z = N_VClone(X);
+
+  N_VConst(SUN_RCONST(1.0), X);
+  N_VConst(SUN_RCONST(2.0), Y);
+
+  /* warm up both approaches */
+  N_VLinearSum(SUN_RCONST(2.0), X, SUN_RCONST(3.0), Y, Z);
+  LinearSumCreateJoin(nthreads, veclen, SUN_RCONST(2.0), N_VGetArrayPointer(X),
+                      SUN_RCONST(3.0), N_VGetArrayPointer(Y),
+                      N_VGetArrayPointer(Z));
+
+  /* persistent thread pool */
+  start = get_time();
+  for (i = 0; i < ntests; i++)
+  {
+    N_VLinearSum(SUN_RCONST(2.0), X, SUN_RCONST(3.0), Y, Z);
+  }
+  pool_time = (get_time() - start) / ntests;
+
+  /* create and join threads for every operation */
+  start = get_time();
+  for (i = 0; i < ntests; i++)
+  {
+    LinearSumCreateJoin(nthreads, veclen, SUN_RCONST(2.0),
+                        N_VGetArrayPointer(X), SUN_RCONST(3.0),
+                        N_VGetArrayPointer(Y), N_VGetArrayPointer(Z));
+  }
+  create_time = (get_time() - start) / ntests;
+
+  printf("\n  %-20s %14s\n", "dispatch", "avg time (s)");
+  printf("  %-20s %14.6e\n", "thread pool", pool_time);
+  printf("  %-20s %14.6e\n", "create/join", create_time);
+  if (pool_time > 0.0)
+  {
+    printf("  %-20s %14.2f\n", "speedup", create_time / pool_time);
+  }
+
+  N_VDestroy(Z);
+  N_VDestroy(Y);
+  N_VDestroy(X);
+
+  flag = SUNContext_Free(&ctx);
+  if (flag) { return flag; }
+
+  printf("\nFinished Tests\n");
+
+  return (flag);
+}
+
+/* ----------------------------------------------------------------------
+ * Reference implementation creating and joining threads for every call
+ * --------------------------------------------------------------------*/
+
+static void* LinearSumKernel(void* arg)
+{
+  LinearSumData* data = (LinearSumData*)arg;
+  sunindextype i;
+
+  for (i = data->start; i < data->end; i++)
+  {
+    data->z[i] = data->a * data->x[i] + data->b * data->y[i];
+  }
+
+  pthread_exit(NULL);
+}
+
+static void LinearSumCreateJoin(int nthreads, sunindextype N, sunrealtype a,
+                                sunrealtype* x, sunrealtype b, sunrealtype* y,
+                                sunrealtype* z)
+{
+  int i;
+  sunindextype q, r;
+  pthread_t* threads;
+  LinearSumData* thread_data;
+  pthread_attr_t attr;
+
+  threads     = (pthread_t*)malloc(nthreads * sizeof(pthread_t));
+  thread_data = (LinearSumData*)malloc(nthreads * sizeof(LinearSumData));
+
+  pthread_attr_init(&attr);
+  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+
+  q = N / nthreads;
+  r = N % nthreads;
+
+  for (i = 0; i < nthreads; i++)
+  {
+    thread_data[i].start = i * q + ((i < r) ? i : r);
+    thread_data[i].end   = thread_data[i].start + q + ((i < r) ? 1 : 0);
+    thread_data[i].a     = a;
+    thread_data[i].b     = b;
+    thread_data[i].x     = x;
+    thread_data[i].y     = y;
+    thread_data[i].z     = z;
+
+    pthread_create(&threads[i], &attr, LinearSumKernel, (void*)&thread_data[i]);
+  }
+
+  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+
+  pthread_attr_destroy(&attr);
+  free(threads);
+  free(thread_data);
+}
+
+/* ----------------------------------------------------------------------
+ * Timer
+ * --------------------------------------------------------------------*/
+
+static double get_time(void)
+{
+  double time;
+#if defined(SUNDIALS_HAVE_POSIX_TIMERS)
+  struct timespec spec;
+  clock_gettime(CLOCK_MONOTONIC, &spec);
+  time = (double)(spec.tv_sec) + ((double)(spec.tv_nsec) / 1E9);
+#else
+  time = 0;
+#endif
+  return time;
+}
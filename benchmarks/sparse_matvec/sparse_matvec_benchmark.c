@@ -0,0 +1,324 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2025-2026, Lawrence Livermore National Security,
+ * University of Maryland Baltimore County, and the SUNDIALS contributors.
+ * Copyright (c) 2013-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * Copyright (c) 2002-2013, Lawrence Livermore National Security.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * This benchmark times SUNMatMatvec with SUNMATRIX_SPARSE matrices
+ * with sparsity patterns representative of Jacobians of PDE and
+ * reaction networks:
+ *
+ *   laplace2d -- 5-point stencil on a 2D grid
+ *   laplace3d -- 7-point stencil on a 3D grid
+ *   reaction  -- dense 16 x 16 blocks coupled by a 1D 3-point stencil
+ *   irregular -- random pattern with row lengths between 1 and 40
+ *
+ * Each pattern is timed in CSR and CSC format, with an unlocked
+ * pattern and with a locked pattern using the default storage and
+ * the SELL-C-sigma slices.
+ *
+ * Usage: sparse_matvec_benchmark <N> [<number of repetitions>]
+ * -----------------------------------------------------------------*/
+
+#include <sundials/sundials_config.h>
+
+/* POSIX timers */
+#if defined(SUNDIALS_HAVE_POSIX_TIMERS)
+#include <stddef.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <nvector/nvector_serial.h>
+#include <sundials/sundials_core.h>
+#include <sunmatrix/sunmatrix_sparse.h>
+
+#define ONE SUN_RCONST(1.0)
+
+#define BLOCK_SIZE   16 /* block size of the reaction pattern         */
+#define MAX_ROW_NNZ  40 /* maximum row length of the irregular pattern */
+#define NUM_PATTERNS 4
+
+static const char* pattern_names[NUM_PATTERNS] = {"laplace2d", "laplace3d",
+                                                  "reaction", "irregular"};
+
+/* Timing and helper functions */
+static double get_time(void);
+static SUNMatrix create_pattern(int pattern, sunindextype N, SUNContext sunctx);
+static int run_matvec(const char* name, SUNMatrix A, sunbooleantype lock,
+                      int format, N_Vector x, N_Vector y, N_Vector yref,
+                      int nreps);
+
+#if defined(SUNDIALS_HAVE_POSIX_TIMERS)
+static time_t base_time_tv_sec = 0;
+#endif
+
+int main(int argc, char* argv[])
+{
+  SUNContext sunctx = NULL;
+  SUNMatrix A, Acsc;
+  N_Vector x, y, yref;
+  sunindextype N, i;
+  int nreps = 20;
+  int fails = 0;
+  int pattern;
+
+  if (argc < 2)
+  {
+    printf("ERROR: ONE (1) input required\n");
+    printf("Usage: %s <N> [<number of repetitions>]\n", argv[0]);
+    return -1;
+  }
+
+  N = (sunindextype)atol(argv[1]);
+  if (N <= 0)
+  {
+    printf("ERROR: matrix size must be a positive integer\n");
+    return -1;
+  }
+  if (argc > 2) { nreps = atoi(argv[2]); }
+  if (nreps <= 0)
+  {
+    printf("ERROR: number of repetitions must be a positive integer\n");
+    return -1;
+  }
+
+#if defined(SUNDIALS_HAVE_POSIX_TIMERS)
+  {
+    struct timespec spec;
+    clock_gettime(CLOCK_MONOTONIC, &spec);
+    base_time_tv_sec = spec.tv_sec;
+  }
+#endif
+
+  if (SUNContext_Create(SUN_COMM_NULL, &sunctx)) { return -1; }
+
+  srand(42);
+
+  printf("Sparse matrix-vector product benchmark: N ~ %ld, repetitions = %d\n",
+         (long int)N, nreps);
+
+  for (pattern = 0; pattern < NUM_PATTERNS; pattern++)
+  {
+    A = create_pattern(pattern, N, sunctx);
+    if (!A || SUNSparseMatrix_ToCSC(A, &Acsc)) { return -1; }
+
+    x    = N_VNew_Serial(SUNSparseMatrix_Rows(A), sunctx);
+    y    = N_VClone(x);
+    yref = N_VClone(x);
+    if (!x || !y || !yref) { return -1; }
+
+    for (i = 0; i < SUNSparseMatrix_Rows(A); i++)
+    {
+      N_VGetArrayPointer(x)[i] = (sunrealtype)rand() / (sunrealtype)RAND_MAX;
+    }
+    SUNMatMatvec(A, x, yref);
+
+    printf("\n%s: N = %ld, nnz = %ld\n", pattern_names[pattern],
+           (long int)SUNSparseMatrix_Rows(A),
+           (long int)SUNSparseMatrix_IndexPointers(A)[SUNSparseMatrix_NP(A)]);
+    printf("%-22s %14s %14s %10s %12s\n", "format", "avg (s)", "min (s)",
+           "GFLOP/s", "difference");
+
+    fails += run_matvec("CSR", A, SUNFALSE, SUN_SPARSE_MATVEC_DEFAULT, x, y,
+                        yref, nreps);
+    fails += run_matvec("CSR SELL-C-sigma", A, SUNTRUE, SUN_SPARSE_MATVEC_SELL,
+                        x, y, yref, nreps);
+    fails += run_matvec("CSC", Acsc, SUNFALSE, SUN_SPARSE_MATVEC_DEFAULT, x, y,
+                        yref, nreps);
+    fails += run_matvec("CSC locked (shadow)", Acsc, SUNTRUE,
+                        SUN_SPARSE_MATVEC_DEFAULT, x, y, yref, nreps);
+    fails += run_matvec("CSC SELL-C-sigma", Acsc, SUNTRUE,
+                        SUN_SPARSE_MATVEC_SELL, x, y, yref, nreps);
+
+    SUNMatDestroy(A);
+    SUNMatDestroy(Acsc);
+    N_VDestroy(x);
+    N_VDestroy(y);
+    N_VDestroy(yref);
+  }
+
+  SUNContext_Free(&sunctx);
+
+  return fails;
+}
+
+/* ----------------------------------------------------------------------
+ * Time the matrix-vector product with the given storage
+ * --------------------------------------------------------------------*/
+static int run_matvec(const char* name, SUNMatrix A, sunbooleantype lock,
+                      int format, N_Vector x, N_Vector y, N_Vector yref,
+                      int nreps)
+{
+  const sunindextype* Ap = SUNSparseMatrix_IndexPointers(A);
+  const sunindextype nnz = Ap[SUNSparseMatrix_NP(A)];
+  double avg = 0.0, min = 0.0, start, elapsed;
+  sunrealtype diff;
+  int i;
+
+  if (SUNSparseMatrix_LockPattern(A, lock) ||
+      SUNSparseMatrix_SetMatvecFormat(A, format))
+  {
+    printf("ERROR: %s setup failed\n", name);
+    return 1;
+  }
+
+  /* the first product builds the storage for a locked pattern */
+  if (SUNMatMatvec(A, x, y))
+  {
+    printf("ERROR: %s product failed\n", name);
+    return 1;
+  }
+
+  for (i = 0; i < nreps; i++)
+  {
+    start = get_time();
+    SUNMatMatvec(A, x, y);
+    elapsed = get_time() - start;
+    avg += elapsed;
+    if (i == 0 || elapsed < min) { min = elapsed; }
+  }
+  avg /= nreps;
+
+  N_VLinearSum(ONE, y, -ONE, yref, y);
+  diff = N_VMaxNorm(y);
+
+  printf("%-22s %14.6e %14.6e %10.4f %12.4e\n", name, avg, min,
+         (min > 0.0) ? 2.0 * (double)nnz / min * 1.0e-9 : 0.0, (double)diff);
+
+  SUNSparseMatrix_LockPattern(A, SUNFALSE);
+
+  return 0;
+}
+
+/* ----------------------------------------------------------------------
+ * Create a CSR matrix with about N rows and the given pattern. The values
+ * are uniform random numbers in [0, 1].
+ * --------------------------------------------------------------------*/
+static SUNMatrix create_pattern(int pattern, sunindextype N, SUNContext sunctx)
+{
+  SUNMatrix A;
+  sunindextype n, nb, i, j, k, b, r, c, nnz, maxnnz, len;
+  sunindextype cols[MAX_ROW_NNZ];
+  sunindextype *Ap, *Aj;
+  sunrealtype* Ax;
+
+  /* grid size (only used by the Laplacian patterns) and number of rows */
+  n = 0;
+  switch (pattern)
+  {
+  case 0:
+    for (n = 1; (n + 1) * (n + 1) <= N; n++) {}
+    N      = n * n;
+    maxnnz = 5 * N;
+    break;
+  case 1:
+    for (n = 1; (n + 1) * (n + 1) * (n + 1) <= N; n++) {}
+    N      = n * n * n;
+    maxnnz = 7 * N;
+    break;
+  case 2:
+    nb     = SUNMAX(N / BLOCK_SIZE, 1);
+    N      = nb * BLOCK_SIZE;
+    maxnnz = (BLOCK_SIZE + 2) * N;
+    break;
+  case 3: maxnnz = MAX_ROW_NNZ * N; break;
+  default: fprintf(stderr, "ERROR: unknown pattern %d\n", pattern); return NULL;
+  }
+
+  A = SUNSparseMatrix(N, N, maxnnz, SUN_CSR_MAT, sunctx);
+  if (!A) { return NULL; }
+  Ap = SUNSparseMatrix_IndexPointers(A);
+  Aj = SUNSparseMatrix_IndexValues(A);
+  Ax = SUNSparseMatrix_Data(A);
+
+  nnz = 0;
+  for (r = 0; r < N; r++)
+  {
+    Ap[r] = nnz;
+    len   = 0;
+    switch (pattern)
+    {
+    case 0:
+      i = r % n;
+      j = r / n;
+      if (j > 0) { cols[len++] = r - n; }
+      if (i > 0) { cols[len++] = r - 1; }
+      cols[len++] = r;
+      if (i < n - 1) { cols[len++] = r + 1; }
+      if (j < n - 1) { cols[len++] = r + n; }
+      break;
+    case 1:
+      i = r % n;
+      j = (r / n) % n;
+      k = r / (n * n);
+      if (k > 0) { cols[len++] = r - n * n; }
+      if (j > 0) { cols[len++] = r - n; }
+      if (i > 0) { cols[len++] = r - 1; }
+      cols[len++] = r;
+      if (i < n - 1) { cols[len++] = r + 1; }
+      if (j < n - 1) { cols[len++] = r + n; }
+      if (k < n - 1) { cols[len++] = r + n * n; }
+      break;
+    case 2:
+      b = r / BLOCK_SIZE;
+      if (b > 0) { cols[len++] = r - BLOCK_SIZE; }
+      for (c = b * BLOCK_SIZE; c < (b + 1) * BLOCK_SIZE; c++)
+      {
+        cols[len++] = c;
+      }
+      if (r + BLOCK_SIZE < N) { cols[len++] = r + BLOCK_SIZE; }
+      break;
+    default:
+      /* distinct random columns kept sorted by insertion */
+      len = SUNMIN(1 + rand() % MAX_ROW_NNZ, N);
+      for (k = 0; k < len;)
+      {
+        c = (sunindextype)(((double)rand() / ((double)RAND_MAX + 1.0)) * N);
+        for (i = k; i > 0 && cols[i - 1] > c; i--) {}
+        if (i > 0 && cols[i - 1] == c) { continue; }
+        for (j = k; j > i; j--) { cols[j] = cols[j - 1]; }
+        cols[i] = c;
+        k++;
+      }
+      break;
+    }
+    for (c = 0; c < len; c++)
+    {
+      Aj[nnz]   = cols[c];
+      Ax[nnz++] = (sunrealtype)rand() / (sunrealtype)RAND_MAX;
+    }
+  }
+  Ap[N] = nnz;
+
+  return A;
+}
+
+/* ----------------------------------------------------------------------
+ * Get the current time in seconds
+ * --------------------------------------------------------------------*/
+static double get_time(void)
+{
+  double time;
+#if defined(SUNDIALS_HAVE_POSIX_TIMERS)
+  struct timespec spec;
+  clock_gettime(CLOCK_MONOTONIC, &spec);
+  time = (double)(spec.tv_sec - base_time_tv_sec) +
+         ((double)(spec.tv_nsec) / 1E9);
+#else
+  time = 0;
+#endif
+  return time;
+}
@@ -1418,6 +1418,9 @@ m.def(
 m.def("ARKodeSetJacEvalFrequency", ARKodeSetJacEvalFrequency,
       nb::arg("arkode_mem"), nb::arg("msbj"));
 
+m.def("ARKodeSetJacReuseOnReset", ARKodeSetJacReuseOnReset,
+      nb::arg("arkode_mem"), nb::arg("dtmax"), nb::arg("dgmax"));
+
 m.def("ARKodeSetLinearSolutionScaling", ARKodeSetLinearSolutionScaling,
       nb::arg("arkode_mem"), nb::arg("onoff"));
 
@@ -57,6 +57,18 @@ void bind_arkode_splittingstep(nb::module_& m)
     },
     nb::arg("arkode_mem"), nb::arg("steppers"), nb::arg("partitions"),
     nb::arg("t0"), nb::arg("y0"));
+
+  m.def(
+    "SplittingStepSetSequentialSteppers",
+    [](void* arkode_mem, int sequential_method,
+       std::vector<SUNStepper> steppers) -> int
+    {
+      return SplittingStepSetSequentialSteppers(arkode_mem, sequential_method,
+                                                steppers.empty()
+                                                  ? nullptr
+                                                  : steppers.data());
+    },
+    nb::arg("arkode_mem"), nb::arg("sequential_method"), nb::arg("steppers"));
 }
 
 } // namespace sundials4py
@@ -909,6 +909,9 @@ m.def(
   },
   nb::arg("cvode_mem"), nb::arg("p_1d"), nb::arg("pbar_1d"), nb::arg("plist_1d"));
 
+m.def("CVodeSetSensNumThreads", CVodeSetSensNumThreads, nb::arg("cvode_mem"),
+      nb::arg("nthreads"));
+
 m.def("CVodeSetNonlinearSolverSensSim", CVodeSetNonlinearSolverSensSim,
       nb::arg("cvode_mem"), nb::arg("NLS"));
 
@@ -1554,6 +1557,9 @@ m.def("CVodeB", CVodeB, nb::arg("cvode_mem"), nb::arg("tBout"),
 
 m.def("CVodeSetAdjNoSensi", CVodeSetAdjNoSensi, nb::arg("cvode_mem"));
 
+m.def("CVodeSetAdjCompression", CVodeSetAdjCompression, nb::arg("cvode_mem"),
+      nb::arg("ctype"), nb::arg("tol"));
+
 m.def("CVodeSetMaxOrdB", CVodeSetMaxOrdB, nb::arg("cvode_mem"),
       nb::arg("which"), nb::arg("maxordB"));
 
@@ -1622,6 +1628,26 @@ m.def("CVodeGetAdjCVodeBmem", CVodeGetAdjCVodeBmem, nb::arg("cvode_mem"),
 m.def("CVodeGetAdjY", CVodeGetAdjY, nb::arg("cvode_mem"), nb::arg("t"),
       nb::arg("y"));
 
+m.def(
+  "CVodeGetAdjCompressionStats",
+  [](void* cvode_mem) -> std::tuple<int, sunrealtype, sunrealtype>
+  {
+    auto CVodeGetAdjCompressionStats_adapt_modifiable_immutable_to_return =
+      [](void* cvode_mem) -> std::tuple<int, sunrealtype, sunrealtype>
+    {
+      sunrealtype ratio_adapt_modifiable;
+      sunrealtype decode_time_adapt_modifiable;
+
+      int r = CVodeGetAdjCompressionStats(cvode_mem, &ratio_adapt_modifiable,
+                                          &decode_time_adapt_modifiable);
+      return std::make_tuple(r, ratio_adapt_modifiable,
+                             decode_time_adapt_modifiable);
+    };
+
+    return CVodeGetAdjCompressionStats_adapt_modifiable_immutable_to_return(cvode_mem);
+  },
+  nb::arg("cvode_mem"));
+
 m.def(
   "CVodeGetAdjDataPointHermite",
   [](void* cvode_mem, int which, std::optional<N_Vector> y = std::nullopt,
@@ -1764,6 +1790,9 @@ m.def("CVodeSetLinearSolutionScaling", CVodeSetLinearSolutionScaling,
 m.def("CVodeSetDeltaGammaMaxBadJac", CVodeSetDeltaGammaMaxBadJac,
       nb::arg("cvode_mem"), nb::arg("dgmax_jbad"));
 
+m.def("CVodeSetJacReuseOnReInit", CVodeSetJacReuseOnReInit,
+      nb::arg("cvode_mem"), nb::arg("dtmax"), nb::arg("dgmax"));
+
 m.def("CVodeSetEpsLin", CVodeSetEpsLin, nb::arg("cvode_mem"), nb::arg("eplifac"));
 
 m.def("CVodeSetLSNormFactor", CVodeSetLSNormFactor, nb::arg("arkode_mem"),
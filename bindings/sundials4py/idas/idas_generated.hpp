@@ -904,6 +904,9 @@ m.def(
   },
   nb::arg("ida_mem"), nb::arg("p_1d"), nb::arg("pbar_1d"), nb::arg("plist_1d"));
 
+m.def("IDASetSensNumThreads", IDASetSensNumThreads, nb::arg("ida_mem"),
+      nb::arg("nthreads"));
+
 m.def("IDASetNonlinearSolverSensSim", IDASetNonlinearSolverSensSim,
       nb::arg("ida_mem"), nb::arg("NLS"));
 
@@ -1469,6 +1472,9 @@ m.def("IDASolveB", IDASolveB, nb::arg("ida_mem"), nb::arg("tBout"),
 
 m.def("IDAAdjSetNoSensi", IDAAdjSetNoSensi, nb::arg("ida_mem"));
 
+m.def("IDAAdjSetCompression", IDAAdjSetCompression, nb::arg("ida_mem"),
+      nb::arg("ctype"), nb::arg("tol"));
+
 m.def("IDASetMaxOrdB", IDASetMaxOrdB, nb::arg("ida_mem"), nb::arg("which"),
       nb::arg("maxordB"));
 
@@ -1540,6 +1546,26 @@ m.def("IDAGetConsistentICB", IDAGetConsistentICB, nb::arg("ida_mem"),
 m.def("IDAGetAdjY", IDAGetAdjY, nb::arg("ida_mem"), nb::arg("t"), nb::arg("yy"),
       nb::arg("yp"));
 
+m.def(
+  "IDAGetAdjCompressionStats",
+  [](void* ida_mem) -> std::tuple<int, sunrealtype, sunrealtype>
+  {
+    auto IDAGetAdjCompressionStats_adapt_modifiable_immutable_to_return =
+      [](void* ida_mem) -> std::tuple<int, sunrealtype, sunrealtype>
+    {
+      sunrealtype ratio_adapt_modifiable;
+      sunrealtype decode_time_adapt_modifiable;
+
+      int r = IDAGetAdjCompressionStats(ida_mem, &ratio_adapt_modifiable,
+                                        &decode_time_adapt_modifiable);
+      return std::make_tuple(r, ratio_adapt_modifiable,
+                             decode_time_adapt_modifiable);
+    };
+
+    return IDAGetAdjCompressionStats_adapt_modifiable_immutable_to_return(ida_mem);
+  },
+  nb::arg("ida_mem"));
+
 m.def(
   "IDAGetAdjDataPointHermite",
   [](void* ida_mem, int which, std::optional<N_Vector> yy = std::nullopt,
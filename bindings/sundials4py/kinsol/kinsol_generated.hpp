@@ -53,6 +53,9 @@ m.def("KINSetDelayAA", KINSetDelayAA, nb::arg("kinmem"), nb::arg("delay"));
 
 m.def("KINSetDampingAA", KINSetDampingAA, nb::arg("kinmem"), nb::arg("beta"));
 
+m.def("KINSetAdaptiveDepthAA", KINSetAdaptiveDepthAA, nb::arg("kinmem"),
+      nb::arg("onoff"), nb::arg("shrink_ratio"), nb::arg("grow_ratio"));
+
 m.def("KINSetReturnNewest", KINSetReturnNewest, nb::arg("kinmem"),
       nb::arg("ret_newest"));
 
@@ -173,6 +176,57 @@ m.def(
   },
   nb::arg("kinmem"));
 
+m.def(
+  "KINGetNumReductionsAA",
+  [](void* kinmem) -> std::tuple<int, long>
+  {
+    auto KINGetNumReductionsAA_adapt_modifiable_immutable_to_return =
+      [](void* kinmem) -> std::tuple<int, long>
+    {
+      long nred_adapt_modifiable;
+
+      int r = KINGetNumReductionsAA(kinmem, &nred_adapt_modifiable);
+      return std::make_tuple(r, nred_adapt_modifiable);
+    };
+
+    return KINGetNumReductionsAA_adapt_modifiable_immutable_to_return(kinmem);
+  },
+  nb::arg("kinmem"));
+
+m.def(
+  "KINGetNumFlopsAA",
+  [](void* kinmem) -> std::tuple<int, long>
+  {
+    auto KINGetNumFlopsAA_adapt_modifiable_immutable_to_return =
+      [](void* kinmem) -> std::tuple<int, long>
+    {
+      long nflops_adapt_modifiable;
+
+      int r = KINGetNumFlopsAA(kinmem, &nflops_adapt_modifiable);
+      return std::make_tuple(r, nflops_adapt_modifiable);
+    };
+
+    return KINGetNumFlopsAA_adapt_modifiable_immutable_to_return(kinmem);
+  },
+  nb::arg("kinmem"));
+
+m.def(
+  "KINGetCurrentDepthAA",
+  [](void* kinmem) -> std::tuple<int, long>
+  {
+    auto KINGetCurrentDepthAA_adapt_modifiable_immutable_to_return =
+      [](void* kinmem) -> std::tuple<int, long>
+    {
+      long depth_adapt_modifiable;
+
+      int r = KINGetCurrentDepthAA(kinmem, &depth_adapt_modifiable);
+      return std::make_tuple(r, depth_adapt_modifiable);
+    };
+
+    return KINGetCurrentDepthAA_adapt_modifiable_immutable_to_return(kinmem);
+  },
+  nb::arg("kinmem"));
+
 m.def(
   "KINGetFuncNorm",
   [](void* kinmem) -> std::tuple<int, sunrealtype>
@@ -3,6 +3,14 @@
 // #ifdef __cplusplus
 // #endif
 //
+
+m.def("SUNAdjointCheckpointScheme_SetMmapOptions_Fixed",
+      SUNAdjointCheckpointScheme_SetMmapOptions_Fixed, nb::arg("check_scheme"),
+      nb::arg("directory"), nb::arg("memory_budget"));
+
+m.def("SUNAdjointCheckpointScheme_SetCompression_Fixed",
+      SUNAdjointCheckpointScheme_SetCompression_Fixed, nb::arg("check_scheme"),
+      nb::arg("ctype"), nb::arg("errbound"));
 // #ifdef __cplusplus
 //
 // #endif
@@ -20,6 +20,7 @@ auto pyEnumSUNGramSchmidtType =
   nb::enum_<SUNGramSchmidtType>(m, "SUNGramSchmidtType", nb::is_arithmetic(), "")
     .value("SUN_MODIFIED_GS", SUN_MODIFIED_GS, "")
     .value("SUN_CLASSICAL_GS", SUN_CLASSICAL_GS, "")
+    .value("SUN_PIPELINED_GS", SUN_PIPELINED_GS, "")
     .export_values();
 // #ifndef SWIG
 //
@@ -329,6 +330,7 @@ auto pyEnumSUNLinearSolver_ID =
     .value("SUNLINEARSOLVER_GINKGO", SUNLINEARSOLVER_GINKGO, "")
     .value("SUNLINEARSOLVER_GINKGOBATCH", SUNLINEARSOLVER_GINKGOBATCH, "")
     .value("SUNLINEARSOLVER_KOKKOSDENSE", SUNLINEARSOLVER_KOKKOSDENSE, "")
+    .value("SUNLINEARSOLVER_BLOCKDENSE", SUNLINEARSOLVER_BLOCKDENSE, "")
     .value("SUNLINEARSOLVER_CUSTOM", SUNLINEARSOLVER_CUSTOM, "")
     .export_values();
 // #ifndef SWIG
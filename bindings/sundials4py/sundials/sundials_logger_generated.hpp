@@ -92,6 +92,9 @@ m.def("SUNLogger_SetDebugFilename", SUNLogger_SetDebugFilename,
 m.def("SUNLogger_SetInfoFilename", SUNLogger_SetInfoFilename, nb::arg("logger"),
       nb::arg("info_filename"));
 
+m.def("SUNLogger_SetBinaryFilename", SUNLogger_SetBinaryFilename,
+      nb::arg("logger"), nb::arg("binary_filename"));
+
 m.def(
   "SUNLogger_QueueMsg",
   [](SUNLogger logger, SUNLogLevel lvl, const char* scope, const char* label,
@@ -16,6 +16,7 @@ auto pyEnumSUNMatrix_ID =
     .value("SUNMATRIX_GINKGO", SUNMATRIX_GINKGO, "")
     .value("SUNMATRIX_GINKGOBATCH", SUNMATRIX_GINKGOBATCH, "")
     .value("SUNMATRIX_KOKKOSDENSE", SUNMATRIX_KOKKOSDENSE, "")
+    .value("SUNMATRIX_BLOCKDENSE", SUNMATRIX_BLOCKDENSE, "")
     .value("SUNMATRIX_CUSTOM", SUNMATRIX_CUSTOM, "")
     .export_values();
 // #ifndef SWIG
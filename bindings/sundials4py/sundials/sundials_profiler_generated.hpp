@@ -39,6 +39,32 @@ m.def("SUNProfiler_Begin", SUNProfiler_Begin, nb::arg("p"), nb::arg("name"));
 
 m.def("SUNProfiler_End", SUNProfiler_End, nb::arg("p"), nb::arg("name"));
 
+m.def(
+  "SUNProfiler_GetTimer",
+  [](SUNProfiler p, const char* name) -> std::tuple<SUNErrCode, int>
+  {
+    auto SUNProfiler_GetTimer_adapt_modifiable_immutable_to_return =
+      [](SUNProfiler p, const char* name) -> std::tuple<SUNErrCode, int>
+    {
+      int timer_adapt_modifiable;
+
+      SUNErrCode r = SUNProfiler_GetTimer(p, name, &timer_adapt_modifiable);
+      return std::make_tuple(r, timer_adapt_modifiable);
+    };
+
+    return SUNProfiler_GetTimer_adapt_modifiable_immutable_to_return(p, name);
+  },
+  nb::arg("p"), nb::arg("name"));
+
+m.def("SUNProfiler_BeginHandle", SUNProfiler_BeginHandle, nb::arg("p"),
+      nb::arg("timer"));
+
+m.def("SUNProfiler_EndHandle", SUNProfiler_EndHandle, nb::arg("p"),
+      nb::arg("timer"));
+
+m.def("SUNProfiler_SetHierarchical", SUNProfiler_SetHierarchical, nb::arg("p"),
+      nb::arg("onoff"));
+
 m.def(
   "SUNProfiler_GetTimerResolution",
   [](SUNProfiler p) -> std::tuple<SUNErrCode, double>
@@ -32,6 +32,20 @@ m.attr("SUN_COMM_NULL") = 0;
 auto pyEnumSUNDataIOMode =
   nb::enum_<SUNDataIOMode>(m, "SUNDataIOMode", nb::is_arithmetic(), "")
     .value("SUNDATAIOMODE_INMEM", SUNDATAIOMODE_INMEM, "")
+    .value("SUNDATAIOMODE_MMAP", SUNDATAIOMODE_MMAP, "")
+    .export_values();
+// #ifndef SWIG
+//
+// #endif
+//
+
+auto pyEnumSUNDataCompression =
+  nb::enum_<SUNDataCompression>(m, "SUNDataCompression", nb::is_arithmetic(),
+                                "")
+    .value("SUNDATACOMPRESSION_NONE", SUNDATACOMPRESSION_NONE, "")
+    .value("SUNDATACOMPRESSION_FLOAT", SUNDATACOMPRESSION_FLOAT, "")
+    .value("SUNDATACOMPRESSION_QUANTIZE", SUNDATACOMPRESSION_QUANTIZE, "")
+    .value("SUNDATACOMPRESSION_DELTA", SUNDATACOMPRESSION_DELTA, "")
     .export_values();
 // #ifndef SWIG
 //
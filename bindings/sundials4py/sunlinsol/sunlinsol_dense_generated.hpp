@@ -28,6 +28,37 @@ m.def(
   },
   nb::arg("y"), nb::arg("A"), nb::arg("sunctx"), "nb::keep_alive<0, 3>()",
   nb::keep_alive<0, 3>());
+
+m.def("SUNLinSol_DenseSetMixedPrecision", SUNLinSol_DenseSetMixedPrecision,
+      nb::arg("S"), nb::arg("onoff"), nb::arg("max_refine"),
+      nb::arg("refine_tol"));
+
+m.def("SUNLinSol_DenseSetNumThreads", SUNLinSol_DenseSetNumThreads,
+      nb::arg("S"), nb::arg("nthreads"));
+
+m.def(
+  "SUNLinSol_DenseGetRefinementStats",
+  [](SUNLinearSolver S) -> std::tuple<SUNErrCode, long, long, long>
+  {
+    auto SUNLinSol_DenseGetRefinementStats_adapt_modifiable_immutable_to_return =
+      [](SUNLinearSolver S) -> std::tuple<SUNErrCode, long, long, long>
+    {
+      long nsolves_adapt_modifiable;
+      long nrefine_adapt_modifiable;
+      long nfallbacks_adapt_modifiable;
+
+      SUNErrCode r =
+        SUNLinSol_DenseGetRefinementStats(S, &nsolves_adapt_modifiable,
+                                          &nrefine_adapt_modifiable,
+                                          &nfallbacks_adapt_modifiable);
+      return std::make_tuple(r, nsolves_adapt_modifiable,
+                             nrefine_adapt_modifiable,
+                             nfallbacks_adapt_modifiable);
+    };
+
+    return SUNLinSol_DenseGetRefinementStats_adapt_modifiable_immutable_to_return(S);
+  },
+  nb::arg("S"));
 // #ifdef __cplusplus
 //
 // #endif
@@ -20,6 +20,60 @@ m.def(
     return SUNMemoryHelper_Sys_adapt_return_type_to_shared_ptr(sunctx);
   },
   nb::arg("sunctx"), "nb::keep_alive<0, 1>()", nb::keep_alive<0, 1>());
+m.def(
+  "SUNMemoryHelper_SysPool",
+  [](SUNContext sunctx) -> std::shared_ptr<std::remove_pointer_t<SUNMemoryHelper>>
+  {
+    auto SUNMemoryHelper_SysPool_adapt_return_type_to_shared_ptr =
+      [](SUNContext sunctx)
+      -> std::shared_ptr<std::remove_pointer_t<SUNMemoryHelper>>
+    {
+      auto lambda_result = SUNMemoryHelper_SysPool(sunctx);
+
+      return our_make_shared<std::remove_pointer_t<SUNMemoryHelper>,
+                             SUNMemoryHelperDeleter>(lambda_result);
+    };
+
+    return SUNMemoryHelper_SysPool_adapt_return_type_to_shared_ptr(sunctx);
+  },
+  nb::arg("sunctx"), "nb::keep_alive<0, 1>()", nb::keep_alive<0, 1>());
+
+m.def("SUNMemoryHelper_SetMaxCachedBytes_SysPool",
+      SUNMemoryHelper_SetMaxCachedBytes_SysPool, nb::arg("helper"),
+      nb::arg("max_cached_bytes"));
+
+m.def("SUNMemoryHelper_Trim_SysPool", SUNMemoryHelper_Trim_SysPool,
+      nb::arg("helper"));
+
+m.def(
+  "SUNMemoryHelper_GetPoolStats_SysPool",
+  [](SUNMemoryHelper helper)
+    -> std::tuple<SUNErrCode, unsigned long, unsigned long, size_t, size_t>
+  {
+    auto SUNMemoryHelper_GetPoolStats_SysPool_adapt_modifiable_immutable_to_return =
+      [](SUNMemoryHelper helper)
+      -> std::tuple<SUNErrCode, unsigned long, unsigned long, size_t, size_t>
+    {
+      unsigned long num_hits_adapt_modifiable;
+      unsigned long num_misses_adapt_modifiable;
+      size_t bytes_reserved_adapt_modifiable;
+      size_t bytes_cached_adapt_modifiable;
+
+      SUNErrCode r = SUNMemoryHelper_GetPoolStats_SysPool(helper,
+                                                          &num_hits_adapt_modifiable,
+                                                          &num_misses_adapt_modifiable,
+                                                          &bytes_reserved_adapt_modifiable,
+                                                          &bytes_cached_adapt_modifiable);
+      return std::make_tuple(r, num_hits_adapt_modifiable,
+                             num_misses_adapt_modifiable,
+                             bytes_reserved_adapt_modifiable,
+                             bytes_cached_adapt_modifiable);
+    };
+
+    return SUNMemoryHelper_GetPoolStats_SysPool_adapt_modifiable_immutable_to_return(
+      helper);
+  },
+  nb::arg("helper"));
 // #ifdef __cplusplus
 //
 // #endif
@@ -73,6 +73,50 @@ def test_kinsol(sunctx):
     assert_allclose(u_data, u_expected_data, atol=10 * SUNREALTYPE_ATOL)
 
 
+def test_kinsol_adaptive_depth_aa(sunctx):
+    NEQ = 3
+    m_aa = 2
+    tol = SUNREALTYPE_ATOL
+    kin_view = KINCreate(sunctx)
+    problem = AnalyticNonlinearSys(None)
+    u = N_VNew_Serial(NEQ, sunctx)
+
+    kin_status = KINSetMAA(kin_view.get(), m_aa)
+    assert kin_status == KIN_SUCCESS
+    kin_status = KINInit(kin_view.get(), problem.fixed_point_fn, u)
+    assert kin_status == KIN_SUCCESS
+    kin_status = KINSetFuncNormTol(kin_view.get(), tol)
+    assert kin_status == KIN_SUCCESS
+    kin_status = KINSetAdaptiveDepthAA(kin_view.get(), 1, 0.0, 0.0)
+    assert kin_status == KIN_SUCCESS
+
+    # initial guess
+    u_data = N_VGetArrayPointer(u)
+    u_data[:] = [0.1, 0.1, -0.1]
+
+    # no scaling used
+    scale = N_VNew_Serial(NEQ, sunctx)
+    N_VConst(1.0, scale)
+
+    kin_status = KINSol(kin_view.get(), u, KIN_FP, scale, scale)
+    assert kin_status == KIN_SUCCESS
+
+    kin_status, depth = KINGetCurrentDepthAA(kin_view.get())
+    assert kin_status == KIN_SUCCESS
+    assert 0 <= depth <= m_aa
+    kin_status, nred = KINGetNumReductionsAA(kin_view.get())
+    assert kin_status == KIN_SUCCESS
+    assert nred > 0
+    kin_status, nflops = KINGetNumFlopsAA(kin_view.get())
+    assert kin_status == KIN_SUCCESS
+    assert nflops > 0
+
+    u_expected = N_VNew_Serial(NEQ, sunctx)
+    u_expected_data = N_VGetArrayPointer(u_expected)
+    problem.solution(u_expected)
+    assert_allclose(u_data, u_expected_data, atol=10 * SUNREALTYPE_ATOL)
+
+
 def test_kinsol_newton_dense(sunctx):
     NEQ = AnalyticNonlinearSys.NEQ
     tol = SUNREALTYPE_ATOL
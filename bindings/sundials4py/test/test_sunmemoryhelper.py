@@ -25,3 +25,15 @@ from sundials4py.core import *
 def test_create_memory_helper_sys(sunctx):
     mem_helper = SUNMemoryHelper_Sys(sunctx)  # noqa: F405
     assert mem_helper is not None
+
+
+def test_create_memory_helper_syspool(sunctx):
+    mem_helper = SUNMemoryHelper_SysPool(sunctx)  # noqa: F405
+    assert mem_helper is not None
+    status, num_hits, num_misses, bytes_reserved, bytes_cached = (
+        SUNMemoryHelper_GetPoolStats_SysPool(mem_helper)  # noqa: F405
+    )
+    assert status == 0
+    assert num_hits == 0 and num_misses == 0
+    assert SUNMemoryHelper_SetMaxCachedBytes_SysPool(mem_helper, 1024) == 0  # noqa: F405
+    assert SUNMemoryHelper_Trim_SysPool(mem_helper) == 0  # noqa: F405
@@ -144,6 +144,8 @@ list(APPEND SUNDIALS_BUILD_LIST "BUILD_NVECTOR_KOKKOS")
 # required modules are in the build list, but cannot be disabled
 set(BUILD_SUNMATRIX_BAND TRUE)
 list(APPEND SUNDIALS_BUILD_LIST "BUILD_SUNMATRIX_BAND")
+set(BUILD_SUNMATRIX_BLOCKDENSE TRUE)
+list(APPEND SUNDIALS_BUILD_LIST "BUILD_SUNMATRIX_BLOCKDENSE")
 set(BUILD_SUNMATRIX_DENSE TRUE)
 list(APPEND SUNDIALS_BUILD_LIST "BUILD_SUNMATRIX_DENSE")
 set(BUILD_SUNMATRIX_SPARSE TRUE)
@@ -203,6 +205,8 @@ list(APPEND SUNDIALS_BUILD_LIST "BUILD_SUNMATRIX_SLUNRLOC")
 # required modules are in the build list, but cannot be disabled
 set(BUILD_SUNLINSOL_BAND TRUE)
 list(APPEND SUNDIALS_BUILD_LIST "BUILD_SUNLINSOL_BAND")
+set(BUILD_SUNLINSOL_BLOCKDENSE TRUE)
+list(APPEND SUNDIALS_BUILD_LIST "BUILD_SUNLINSOL_BLOCKDENSE")
 set(BUILD_SUNLINSOL_DENSE TRUE)
 list(APPEND SUNDIALS_BUILD_LIST "BUILD_SUNLINSOL_DENSE")
 set(BUILD_SUNLINSOL_PCG TRUE)
@@ -296,6 +296,23 @@ if(SUNDIALS_POSIX_TIMERS AND POSIX_TIMERS_NEED_POSIX_C_SOURCE)
       "${CMAKE_C_FLAGS} -D_POSIX_C_SOURCE=${SUNDIALS_POSIX_C_SOURCE}")
 endif()
 
+# ---------------------------------------------------------------
+# Check for memory-mapped files (used for file-backed checkpoints)
+# ---------------------------------------------------------------
+check_c_source_compiles(
+  "
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <unistd.h>
+  int main(void) {
+    void* p = mmap(0, 4096, PROT_READ | PROT_WRITE, MAP_SHARED, -1, 0);
+    posix_madvise(p, 4096, POSIX_MADV_WILLNEED);
+    msync(p, 4096, MS_ASYNC);
+    munmap(p, 4096);
+    return ftruncate(-1, 0) + unlink(\"\");
+  }"
+  SUNDIALS_MMAP)
+
 # ---------------------------------------------------------------
 # Check for deprecated attribute with message
 # ---------------------------------------------------------------
@@ -92,6 +92,11 @@ if(SUNDIALS_POSIX_TIMERS) # set in SundialsPOSIXTimers.cmake
   set(SUNDIALS_HAVE_POSIX_TIMERS TRUE)
 endif()
 
+# prepare substitution variable SUNDIALS_HAVE_MMAP for sundials_config.h
+if(SUNDIALS_MMAP) # set in SundialsSetupCompilers.cmake
+  set(SUNDIALS_HAVE_MMAP TRUE)
+endif()
+
 # =============================================================================
 # All required substitution variables should be available at this point.
 # Generate the header file and place it in the binary dir.
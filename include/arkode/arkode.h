@@ -348,6 +348,10 @@ SUNDIALS_EXPORT int ARKodeEvolve(void* arkode_mem, sunrealtype tout,
 SUNDIALS_EXPORT int ARKodeGetDky(void* arkode_mem, sunrealtype t, int k,
                                  N_Vector dky);
 
+/* Computes the kth derivative of the y function at the times t[i] */
+SUNDIALS_EXPORT int ARKodeGetDkyBatch(void* arkode_mem, int nt, sunrealtype* t,
+                                      int k, N_Vector* dky);
+
 /* Utility function to update/compute y based on zcor */
 SUNDIALS_EXPORT int ARKodeComputeState(void* arkode_mem, N_Vector zcor,
                                        N_Vector z);
@@ -23,6 +23,7 @@
 #include <arkode/arkode.h>
 #include <arkode/arkode_butcher_erk.h>
 #include <arkode/arkode_erkstep_deprecated.h>
+#include <arkode/arkode_lowstorage.h>
 #include <sunadaptcontroller/sunadaptcontroller_imexgus.h>
 #include <sunadaptcontroller/sunadaptcontroller_soderlind.h>
 #include <sundials/sundials_adjointstepper.h>
@@ -63,6 +64,12 @@ SUNDIALS_EXPORT int ERKStepSetTable(void* arkode_mem, ARKodeButcherTable B);
 SUNDIALS_EXPORT int ERKStepSetTableNum(void* arkode_mem,
                                        ARKODE_ERKTableID etable);
 SUNDIALS_EXPORT int ERKStepSetTableName(void* arkode_mem, const char* etable);
+SUNDIALS_EXPORT int ERKStepSetLowStorageTable(void* arkode_mem,
+                                              ARKodeLowStorageTable L);
+SUNDIALS_EXPORT int ERKStepSetLowStorageTableNum(
+  void* arkode_mem, ARKODE_LowStorageTableID ltable);
+SUNDIALS_EXPORT int ERKStepSetLowStorageTableName(void* arkode_mem,
+                                                  const char* ltable);
 
 /* Optional output functions */
 SUNDIALS_EXPORT int ERKStepGetCurrentButcherTable(
@@ -0,0 +1,117 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2025-2026, Lawrence Livermore National Security,
+ * University of Maryland Baltimore County, and the SUNDIALS contributors.
+ * Copyright (c) 2013-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * Copyright (c) 2002-2013, Lawrence Livermore National Security.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * This header file defines the ARKodeLowStorageTable structure used
+ * by ERKStep to advance explicit Runge--Kutta methods in Williamson
+ * 2N or Ketcheson 3S* (and 2S*) low-storage form.
+ * -----------------------------------------------------------------*/
+
+#ifndef _ARKODE_LOWSTORAGE_H
+#define _ARKODE_LOWSTORAGE_H
+
+#include <arkode/arkode_butcher.h>
+#include <stdio.h>
+#include <sundials/sundials_types.h>
+
+#ifdef __cplusplus /* wrapper to enable C++ usage */
+extern "C" {
+#endif
+
+/* Low-storage formulations */
+enum ARKODE_LowStorageType
+{
+  ARKODE_LOWSTORAGE_2N     = 0,
+  ARKODE_LOWSTORAGE_3SSTAR = 1
+};
+
+enum ARKODE_LowStorageTableID
+{
+  ARKODE_LOWSTORAGE_NONE = -1, /* ensure enum is signed int */
+  /* WARNING:  ARKODE_MIN_LOWSTORAGE_NUM must come after the first entry,
+     ARKODE_LOWSTORAGE_WILLIAMSON_3_3, because Python enums will only expose
+     the member that is defined first. */
+  ARKODE_LOWSTORAGE_WILLIAMSON_3_3 = 0,
+  ARKODE_MIN_LOWSTORAGE_NUM        = 0,
+  ARKODE_LOWSTORAGE_CARPENTER_KENNEDY_5_3_4,
+  ARKODE_LOWSTORAGE_SSP_3_2_3,
+  ARKODE_LOWSTORAGE_RK4_4_4,
+  ARKODE_MAX_LOWSTORAGE_NUM = ARKODE_LOWSTORAGE_RK4_4_4
+};
+
+#ifndef SWIG
+typedef enum ARKODE_LowStorageType ARKODE_LowStorageType;
+typedef enum ARKODE_LowStorageTableID ARKODE_LowStorageTableID;
+#endif
+
+struct ARKodeLowStorageTableMem
+{
+  ARKODE_LowStorageType type; /* 2N or 3S* formulation             */
+  int q;                      /* method order of accuracy          */
+  int p;                      /* embedding order (0 if none)       */
+  int stages;                 /* number of stages                  */
+  sunrealtype* c;             /* stage times                       */
+
+  /* 2N coefficients: dQ = A_i dQ + h F_i, y = y + B_i dQ */
+  sunrealtype* A;
+  sunrealtype* B;
+  sunrealtype* b;    /* solution weights implied by A and B  */
+  sunrealtype* bhat; /* embedding weights (NULL if p == 0)   */
+
+  /* 3S* coefficients: S2 = S2 + delta_i S1,
+     S1 = gamma1_i S1 + gamma2_i S2 + gamma3_i S3 + beta_i h F_i */
+  sunrealtype* gamma1;
+  sunrealtype* gamma2;
+  sunrealtype* gamma3;
+  sunrealtype* beta;
+  sunrealtype* delta; /* length stages + 2 */
+};
+
+typedef _SUNDIALS_STRUCT_ ARKodeLowStorageTableMem* ARKodeLowStorageTable;
+
+/* Utility routines to allocate/free/output low-storage tables */
+SUNDIALS_EXPORT
+ARKodeLowStorageTable ARKodeLowStorageTable_Create2N(
+  int s, int q, int p, const sunrealtype* c, const sunrealtype* A,
+  const sunrealtype* B, const sunrealtype* bhat);
+
+SUNDIALS_EXPORT
+ARKodeLowStorageTable ARKodeLowStorageTable_Create3Sstar(
+  int s, int q, int p, const sunrealtype* c, const sunrealtype* gamma1,
+  const sunrealtype* gamma2, const sunrealtype* gamma3,
+  const sunrealtype* beta, const sunrealtype* delta);
+
+SUNDIALS_EXPORT
+ARKodeLowStorageTable ARKodeLowStorageTable_Load(ARKODE_LowStorageTableID id);
+
+SUNDIALS_EXPORT
+ARKodeLowStorageTable ARKodeLowStorageTable_LoadByName(const char* method);
+
+SUNDIALS_EXPORT
+ARKodeLowStorageTable ARKodeLowStorageTable_Copy(ARKodeLowStorageTable L);
+
+SUNDIALS_EXPORT
+void ARKodeLowStorageTable_Write(ARKodeLowStorageTable L, FILE* outfile);
+
+SUNDIALS_EXPORT
+void ARKodeLowStorageTable_Free(ARKodeLowStorageTable L);
+
+SUNDIALS_EXPORT
+int ARKodeLowStorageTable_ToButcher(ARKodeLowStorageTable L,
+                                    ARKodeButcherTable* B_ptr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -74,6 +74,9 @@ typedef int (*ARKLsJacTimesVecFn)(N_Vector v, N_Vector Jv, sunrealtype t,
                                   N_Vector y, N_Vector fy, void* user_data,
                                   N_Vector tmp);
 
+typedef int (*ARKLsJacTimesDirDerivFn)(sunrealtype t, N_Vector y, N_Vector v,
+                                       N_Vector Jv, void* user_data);
+
 typedef int (*ARKLsLinSysFn)(sunrealtype t, N_Vector y, N_Vector fy,
                              SUNMatrix A, SUNMatrix M, sunbooleantype jok,
                              sunbooleantype* jcur, sunrealtype gamma,
@@ -100,8 +103,11 @@ SUNDIALS_EXPORT int ARKodeSetMassLinearSolver(void* arkode_mem,
 /* Linear solver interface optional input functions -- must be called
    AFTER ARKodeSetLinearSolver and/or ARKodeSetMassLinearSolver */
 SUNDIALS_EXPORT int ARKodeSetJacFn(void* arkode_mem, ARKLsJacFn jac);
+SUNDIALS_EXPORT int ARKodeSetJacSparsityPattern(void* arkode_mem, SUNMatrix S);
 SUNDIALS_EXPORT int ARKodeSetMassFn(void* arkode_mem, ARKLsMassFn mass);
 SUNDIALS_EXPORT int ARKodeSetJacEvalFrequency(void* arkode_mem, long int msbj);
+SUNDIALS_EXPORT int ARKodeSetJacReuseOnReset(void* arkode_mem, sunrealtype dtmax,
+                                             sunrealtype dgmax);
 SUNDIALS_EXPORT int ARKodeSetLinearSolutionScaling(void* arkode_mem,
                                                    sunbooleantype onoff);
 SUNDIALS_EXPORT int ARKodeSetEpsLin(void* arkode_mem, sunrealtype eplifac);
@@ -120,6 +126,8 @@ SUNDIALS_EXPORT int ARKodeSetJacTimes(void* arkode_mem,
                                       ARKLsJacTimesVecFn jtimes);
 SUNDIALS_EXPORT int ARKodeSetJacTimesRhsFn(void* arkode_mem,
                                            ARKRhsFn jtimesRhsFn);
+SUNDIALS_EXPORT int ARKodeSetJacTimesDirDeriv(void* arkode_mem,
+                                              ARKLsJacTimesDirDerivFn jtdir);
 SUNDIALS_EXPORT int ARKodeSetMassTimes(void* arkode_mem,
                                        ARKLsMassTimesSetupFn msetup,
                                        ARKLsMassTimesVecFn mtimes,
@@ -199,6 +199,8 @@ SUNDIALS_EXPORT int CVodeComputeState(void* cvode_mem, N_Vector ycor, N_Vector y
 /* Dense output function */
 SUNDIALS_EXPORT int CVodeGetDky(void* cvode_mem, sunrealtype t, int k,
                                 N_Vector dky);
+SUNDIALS_EXPORT int CVodeGetDkyBatch(void* cvode_mem, int nt, sunrealtype* t,
+                                     int k, N_Vector* dky);
 
 /* Optional output functions */
 
@@ -0,0 +1,96 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2025-2026, Lawrence Livermore National Security,
+ * University of Maryland Baltimore County, and the SUNDIALS contributors.
+ * Copyright (c) 2013-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * Copyright (c) 2002-2013, Lawrence Livermore National Security.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * This is the header file for the CVODE ensemble interface, which
+ * advances a batch of independent, equally sized ODE systems, each
+ * with its own step size, order, and error control. The states of
+ * the systems are interleaved, i.e., component i of system s is
+ * entry i * nsys + s of an ensemble vector.
+ * -----------------------------------------------------------------*/
+
+#ifndef _CVODE_ENSEMBLE_H
+#define _CVODE_ENSEMBLE_H
+
+#include <cvode/cvode.h>
+#include <sundials/sundials_core.h>
+#include <sunmatrix/sunmatrix_blockdense.h>
+
+#ifdef __cplusplus /* wrapper to enable C++ usage */
+extern "C" {
+#endif
+
+/* ------------------------------
+ * User-Supplied Function Types
+ * ------------------------------ */
+
+typedef int (*CVEnsembleRhsFn)(const sunrealtype* t, N_Vector y,
+                               N_Vector ydot, void* user_data);
+
+typedef int (*CVEnsembleJacFn)(const sunrealtype* t, N_Vector y, N_Vector fy,
+                               SUNMatrix Jac, void* user_data, N_Vector tmp1,
+                               N_Vector tmp2, N_Vector tmp3);
+
+/* ---------------------------------------
+ * Exported Functions -- Ensemble Creation
+ * --------------------------------------- */
+
+SUNDIALS_EXPORT void* CVodeEnsembleCreate(int lmm, sunindextype nsys,
+                                          sunindextype N, SUNContext sunctx);
+
+SUNDIALS_EXPORT int CVodeEnsembleInit(void* ens_mem, CVEnsembleRhsFn f,
+                                      sunrealtype t0, N_Vector y0);
+SUNDIALS_EXPORT int CVodeEnsembleReInit(void* ens_mem, sunrealtype t0,
+                                        N_Vector y0);
+
+/* ------------------------------------
+ * Exported Functions -- Optional Inputs
+ * ------------------------------------ */
+
+SUNDIALS_EXPORT int CVodeEnsembleSStolerances(void* ens_mem,
+                                              sunrealtype reltol,
+                                              sunrealtype abstol);
+SUNDIALS_EXPORT int CVodeEnsembleSetJacFn(void* ens_mem, CVEnsembleJacFn jac);
+SUNDIALS_EXPORT int CVodeEnsembleSetUserData(void* ens_mem, void* user_data);
+SUNDIALS_EXPORT int CVodeEnsembleSetMaxNumSteps(void* ens_mem, long int mxsteps);
+SUNDIALS_EXPORT int CVodeEnsembleSetNumThreads(void* ens_mem, int nthreads);
+
+/* ----------------------------------
+ * Exported Functions -- Integration
+ * ---------------------------------- */
+
+SUNDIALS_EXPORT int CVodeEnsemble(void* ens_mem, sunrealtype tout,
+                                  N_Vector yout, int* flags);
+
+/* -------------------------------------
+ * Exported Functions -- Optional Outputs
+ * ------------------------------------- */
+
+SUNDIALS_EXPORT int CVodeEnsembleGetNumSteps(void* ens_mem, long int* nsteps);
+SUNDIALS_EXPORT int CVodeEnsembleGetNumRhsEvals(void* ens_mem,
+                                                long int* nfevals);
+SUNDIALS_EXPORT int CVodeEnsembleGetNumLinSolvSetups(void* ens_mem,
+                                                     long int* nlinsetups);
+SUNDIALS_EXPORT int CVodeEnsembleGetNumJacEvals(void* ens_mem, long int* njevals);
+
+/* ---------------------------------
+ * Exported Functions -- Deallocation
+ * --------------------------------- */
+
+SUNDIALS_EXPORT void CVodeEnsembleFree(void** ens_mem);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -70,6 +70,9 @@ typedef int (*CVLsJacTimesVecFn)(N_Vector v, N_Vector Jv, sunrealtype t,
                                  N_Vector y, N_Vector fy, void* user_data,
                                  N_Vector tmp);
 
+typedef int (*CVLsJacTimesDirDerivFn)(sunrealtype t, N_Vector y, N_Vector v,
+                                      N_Vector Jv, void* user_data);
+
 typedef int (*CVLsLinSysFn)(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix A,
                             sunbooleantype jok, sunbooleantype* jcur,
                             sunrealtype gamma, void* user_data, N_Vector tmp1,
@@ -87,17 +90,22 @@ SUNDIALS_EXPORT int CVodeSetLinearSolver(void* cvode_mem, SUNLinearSolver LS,
   -----------------------------------------------------------------*/
 
 SUNDIALS_EXPORT int CVodeSetJacFn(void* cvode_mem, CVLsJacFn jac);
+SUNDIALS_EXPORT int CVodeSetJacSparsityPattern(void* cvode_mem, SUNMatrix S);
 SUNDIALS_EXPORT int CVodeSetJacEvalFrequency(void* cvode_mem, long int msbj);
 SUNDIALS_EXPORT int CVodeSetLinearSolutionScaling(void* cvode_mem,
                                                   sunbooleantype onoff);
 SUNDIALS_EXPORT int CVodeSetDeltaGammaMaxBadJac(void* cvode_mem,
                                                 sunrealtype dgmax_jbad);
+SUNDIALS_EXPORT int CVodeSetJacReuseOnReInit(void* cvode_mem, sunrealtype dtmax,
+                                             sunrealtype dgmax);
 SUNDIALS_EXPORT int CVodeSetEpsLin(void* cvode_mem, sunrealtype eplifac);
 SUNDIALS_EXPORT int CVodeSetLSNormFactor(void* arkode_mem, sunrealtype nrmfac);
 SUNDIALS_EXPORT int CVodeSetPreconditioner(void* cvode_mem, CVLsPrecSetupFn pset,
                                            CVLsPrecSolveFn psolve);
 SUNDIALS_EXPORT int CVodeSetJacTimes(void* cvode_mem, CVLsJacTimesSetupFn jtsetup,
                                      CVLsJacTimesVecFn jtimes);
+SUNDIALS_EXPORT int CVodeSetJacTimesDirDeriv(void* cvode_mem,
+                                             CVLsJacTimesDirDerivFn jtdir);
 SUNDIALS_EXPORT int CVodeSetLinSysFn(void* cvode_mem, CVLsLinSysFn linsys);
 
 /*-----------------------------------------------------------------
@@ -267,6 +267,8 @@ SUNDIALS_EXPORT int CVodeComputeStateSens1(void* cvode_mem, int idx,
 /* Dense output function */
 SUNDIALS_EXPORT int CVodeGetDky(void* cvode_mem, sunrealtype t, int k,
                                 N_Vector dky);
+SUNDIALS_EXPORT int CVodeGetDkyBatch(void* cvode_mem, int nt, sunrealtype* t,
+                                     int k, N_Vector* dky);
 
 /* Optional output functions */
 SUNDIALS_DEPRECATED_EXPORT_MSG(
@@ -398,6 +400,9 @@ SUNDIALS_EXPORT int CVodeSetSensErrCon(void* cvode_mem, sunbooleantype errconS);
 SUNDIALS_EXPORT int CVodeSetSensMaxNonlinIters(void* cvode_mem, int maxcorS);
 SUNDIALS_EXPORT int CVodeSetSensParams(void* cvode_mem, sunrealtype* p_1d,
                                        sunrealtype* pbar_1d, int* plist_1d);
+SUNDIALS_EXPORT int CVodeSetSensNumThreads(void* cvode_mem, int nthreads);
+SUNDIALS_EXPORT int CVodeSetSensThreadData(void* cvode_mem, void** user_data,
+                                           sunrealtype** p);
 
 /* Integrator nonlinear solver specification functions */
 SUNDIALS_EXPORT int CVodeSetNonlinearSolverSensSim(void* cvode_mem,
@@ -563,6 +568,10 @@ SUNDIALS_EXPORT int CVodeB(void* cvode_mem, sunrealtype tBout, int itaskB);
 
 SUNDIALS_EXPORT int CVodeSetAdjNoSensi(void* cvode_mem);
 
+SUNDIALS_EXPORT int CVodeSetAdjCompression(void* cvode_mem,
+                                           SUNDataCompression ctype,
+                                           sunrealtype tol);
+
 SUNDIALS_EXPORT int CVodeSetUserDataB(void* cvode_mem, int which,
                                       void* user_dataB);
 SUNDIALS_EXPORT int CVodeSetMaxOrdB(void* cvode_mem, int which, int maxordB);
@@ -614,6 +623,10 @@ typedef struct
 SUNDIALS_EXPORT int CVodeGetAdjCheckPointsInfo(void* cvode_mem,
                                                CVadjCheckPointRec* ckpnt);
 
+SUNDIALS_EXPORT int CVodeGetAdjCompressionStats(void* cvode_mem,
+                                                sunrealtype* ratio,
+                                                sunrealtype* decode_time);
+
 /* CVLS interface function that depends on CVRhsFn */
 SUNDIALS_EXPORT int CVodeSetJacTimesRhsFnB(void* cvode_mem, int which,
                                            CVRhsFn jtimesRhsFn);
@@ -72,6 +72,10 @@ typedef int (*IDALsJacTimesVecFn)(sunrealtype tt, N_Vector yy, N_Vector yp,
                                   sunrealtype c_j, void* user_data,
                                   N_Vector tmp1, N_Vector tmp2);
 
+typedef int (*IDALsJacTimesDirDerivFn)(sunrealtype tt, N_Vector yy, N_Vector yp,
+                                       N_Vector vy, N_Vector vyp, N_Vector Jv,
+                                       void* user_data);
+
 /*=================================================================
   IDALS Exported functions
   =================================================================*/
@@ -84,10 +88,13 @@ SUNDIALS_EXPORT int IDASetLinearSolver(void* ida_mem, SUNLinearSolver LS,
   -----------------------------------------------------------------*/
 
 SUNDIALS_EXPORT int IDASetJacFn(void* ida_mem, IDALsJacFn jac);
+SUNDIALS_EXPORT int IDASetJacSparsityPattern(void* ida_mem, SUNMatrix S);
 SUNDIALS_EXPORT int IDASetPreconditioner(void* ida_mem, IDALsPrecSetupFn pset,
                                          IDALsPrecSolveFn psolve);
 SUNDIALS_EXPORT int IDASetJacTimes(void* ida_mem, IDALsJacTimesSetupFn jtsetup,
                                    IDALsJacTimesVecFn jtimes);
+SUNDIALS_EXPORT int IDASetJacTimesDirDeriv(void* ida_mem,
+                                           IDALsJacTimesDirDerivFn jtdir);
 SUNDIALS_EXPORT int IDASetEpsLin(void* ida_mem, sunrealtype eplifac);
 SUNDIALS_EXPORT int IDASetLSNormFactor(void* ida_mem, sunrealtype nrmfac);
 SUNDIALS_EXPORT int IDASetLinearSolutionScaling(void* ida_mem,
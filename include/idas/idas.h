@@ -401,6 +401,9 @@ SUNDIALS_EXPORT int IDASetSensErrCon(void* ida_mem, sunbooleantype errconS);
 SUNDIALS_EXPORT int IDASetSensMaxNonlinIters(void* ida_mem, int maxcorS);
 SUNDIALS_EXPORT int IDASetSensParams(void* ida_mem, sunrealtype* p_1d,
                                      sunrealtype* pbar_1d, int* plist_1d);
+SUNDIALS_EXPORT int IDASetSensNumThreads(void* ida_mem, int nthreads);
+SUNDIALS_EXPORT int IDASetSensThreadData(void* ida_mem, void** user_data,
+                                         sunrealtype** p);
 
 /* Integrator nonlinear solver specification functions */
 
@@ -561,6 +564,10 @@ SUNDIALS_EXPORT int IDASolveB(void* ida_mem, sunrealtype tBout, int itaskB);
 
 SUNDIALS_EXPORT int IDAAdjSetNoSensi(void* ida_mem);
 
+SUNDIALS_EXPORT int IDAAdjSetCompression(void* ida_mem,
+                                         SUNDataCompression ctype,
+                                         sunrealtype tol);
+
 SUNDIALS_EXPORT int IDASetUserDataB(void* ida_mem, int which, void* user_dataB);
 SUNDIALS_EXPORT int IDASetMaxOrdB(void* ida_mem, int which, int maxordB);
 SUNDIALS_EXPORT int IDASetMaxNumStepsB(void* ida_mem, int which,
@@ -610,6 +617,9 @@ typedef struct
 SUNDIALS_EXPORT int IDAGetAdjCheckPointsInfo(void* ida_mem,
                                              IDAadjCheckPointRec* ckpnt);
 
+SUNDIALS_EXPORT int IDAGetAdjCompressionStats(void* ida_mem, sunrealtype* ratio,
+                                              sunrealtype* decode_time);
+
 /* IDALS interface function that depends on IDAResFn */
 SUNDIALS_EXPORT int IDASetJacTimesResFnB(void* ida_mem, int which,
                                          IDAResFn jtimesResFn);
@@ -62,10 +62,11 @@ extern "C" {
 #define KIN_DEPTH_FN_ERR        -19
 
 /* Anderson Acceleration Orthogonalization Choice */
-#define KIN_ORTH_MGS   0
-#define KIN_ORTH_ICWY  1
-#define KIN_ORTH_CGS2  2
-#define KIN_ORTH_DCGS2 3
+#define KIN_ORTH_MGS         0
+#define KIN_ORTH_ICWY        1
+#define KIN_ORTH_CGS2        2
+#define KIN_ORTH_DCGS2       3
+#define KIN_ORTH_DCGS2_FUSED 4
 
 /* Enumeration for eta choice */
 #define KIN_ETACHOICE1  1
@@ -119,6 +120,9 @@ SUNDIALS_EXPORT int KINSetDelayAA(void* kinmem, long int delay);
 SUNDIALS_EXPORT int KINSetDampingAA(void* kinmem, sunrealtype beta);
 SUNDIALS_EXPORT int KINSetDampingFn(void* kinmem, KINDampingFn damping_fn);
 SUNDIALS_EXPORT int KINSetDepthFn(void* kinmem, KINDepthFn depth_fn);
+SUNDIALS_EXPORT int KINSetAdaptiveDepthAA(void* kinmem, int onoff,
+                                          sunrealtype shrink_ratio,
+                                          sunrealtype grow_ratio);
 SUNDIALS_EXPORT int KINSetReturnNewest(void* kinmem, sunbooleantype ret_newest);
 SUNDIALS_EXPORT int KINSetNumMaxIters(void* kinmem, long int mxiter);
 SUNDIALS_EXPORT int KINSetNoInitSetup(void* kinmem, sunbooleantype noInitSetup);
@@ -149,6 +153,9 @@ SUNDIALS_EXPORT int KINGetNumNonlinSolvIters(void* kinmem, long int* nniters);
 SUNDIALS_EXPORT int KINGetNumFuncEvals(void* kinmem, long int* nfevals);
 SUNDIALS_EXPORT int KINGetNumBetaCondFails(void* kinmem, long int* nbcfails);
 SUNDIALS_EXPORT int KINGetNumBacktrackOps(void* kinmem, long int* nbacktr);
+SUNDIALS_EXPORT int KINGetNumReductionsAA(void* kinmem, long int* nred);
+SUNDIALS_EXPORT int KINGetNumFlopsAA(void* kinmem, long int* nflops);
+SUNDIALS_EXPORT int KINGetCurrentDepthAA(void* kinmem, long int* depth);
 SUNDIALS_EXPORT int KINGetFuncNorm(void* kinmem, sunrealtype* fnorm);
 SUNDIALS_EXPORT int KINGetStepLength(void* kinmem, sunrealtype* steplength);
 SUNDIALS_EXPORT int KINGetUserData(void* kinmem, void** user_data);
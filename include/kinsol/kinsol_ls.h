@@ -75,6 +75,7 @@ SUNDIALS_EXPORT int KINSetLinearSolver(void* kinmem, SUNLinearSolver LS,
   -----------------------------------------------------------------*/
 
 SUNDIALS_EXPORT int KINSetJacFn(void* kinmem, KINLsJacFn jac);
+SUNDIALS_EXPORT int KINSetJacSparsityPattern(void* kinmem, SUNMatrix S);
 SUNDIALS_EXPORT int KINSetPreconditioner(void* kinmem, KINLsPrecSetupFn psetup,
                                          KINLsPrecSolveFn psolve);
 SUNDIALS_EXPORT int KINSetJacTimesVecFn(void* kinmem, KINLsJacTimesVecFn jtv);
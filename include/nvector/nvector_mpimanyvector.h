@@ -60,6 +60,7 @@ struct _N_VectorContent_MPIManyVector
   sunindextype global_length;  /* overall global manyvector length */
   N_Vector* subvec_array;      /* pointer to N_Vector array        */
   sunbooleantype own_data;     /* flag indicating data ownership   */
+  MPI_Request reduce_request;  /* pending split-phase reduction    */
 };
 
 typedef struct _N_VectorContent_MPIManyVector* N_VectorContent_MPIManyVector;
@@ -201,6 +202,15 @@ SUNDIALS_EXPORT
 SUNErrCode N_VDotProdMultiAllReduce_MPIManyVector(int nvec_total, N_Vector x,
                                                   sunrealtype* sum);
 
+SUNDIALS_EXPORT
+SUNErrCode N_VDotProdMultiAllReduceBegin_MPIManyVector(int nvec_total,
+                                                       N_Vector x,
+                                                       sunrealtype* sum);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VDotProdMultiAllReduceEnd_MPIManyVector(int nvec_total, N_Vector x,
+                                                     sunrealtype* sum);
+
 /* vector array operations */
 SUNDIALS_EXPORT
 SUNErrCode N_VLinearSumVectorArray_MPIManyVector(int nvec, sunrealtype a,
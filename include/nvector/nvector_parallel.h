@@ -64,6 +64,7 @@ struct _N_VectorContent_Parallel
   sunbooleantype own_data;    /* ownership of data           */
   sunrealtype* data;          /* local data array            */
   MPI_Comm comm;              /* pointer to MPI communicator */
+  MPI_Request reduce_request; /* pending split-phase reduction */
 };
 
 typedef struct _N_VectorContent_Parallel* N_VectorContent_Parallel;
@@ -282,6 +283,14 @@ SUNDIALS_EXPORT
 SUNErrCode N_VDotProdMultiAllReduce_Parallel(int nvec_total, N_Vector x,
                                              sunrealtype* dotprods);
 
+SUNDIALS_EXPORT
+SUNErrCode N_VDotProdMultiAllReduceBegin_Parallel(int nvec_total, N_Vector x,
+                                                  sunrealtype* dotprods);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VDotProdMultiAllReduceEnd_Parallel(int nvec_total, N_Vector x,
+                                                sunrealtype* dotprods);
+
 /* OPTIONAL XBraid interface operations */
 
 SUNDIALS_EXPORT
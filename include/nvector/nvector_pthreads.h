@@ -60,12 +60,18 @@ extern "C" {
  * -----------------------------------------------------------------
  */
 
+/* Persistent pool of POSIX threads shared by a vector and its clones. The
+   definition is private to the implementation. */
+
+typedef struct _Pthreads_Pool Pthreads_Pool;
+
 struct _N_VectorContent_Pthreads
 {
   sunindextype length;     /* vector length           */
   sunbooleantype own_data; /* data ownership flag     */
   sunrealtype* data;       /* data array              */
   int num_threads;         /* number of POSIX threads */
+  Pthreads_Pool* pool;     /* persistent thread pool  */
 };
 
 typedef struct _N_VectorContent_Pthreads* N_VectorContent_Pthreads;
@@ -107,7 +113,7 @@ typedef struct _Pthreads_Data Pthreads_Data;
 /*
  * -----------------------------------------------------------------
  * Macros NV_CONTENT_PT, NV_DATA_PT, NV_OWN_DATA_PT,
- *        NV_LENGTH_PT, and NV_Ith_PT
+ *        NV_LENGTH_PT, NV_POOL_PT, and NV_Ith_PT
  * -----------------------------------------------------------------
  */
 
@@ -117,6 +123,8 @@ typedef struct _Pthreads_Data Pthreads_Data;
 
 #define NV_NUM_THREADS_PT(v) (NV_CONTENT_PT(v)->num_threads)
 
+#define NV_POOL_PT(v) (NV_CONTENT_PT(v)->pool)
+
 #define NV_OWN_DATA_PT(v) (NV_CONTENT_PT(v)->own_data)
 
 #define NV_DATA_PT(v) (NV_CONTENT_PT(v)->data)
@@ -56,6 +56,16 @@ SUNDIALS_EXPORT
 SUNErrCode SUNAdjointCheckpointScheme_EnableDense_Fixed(
   SUNAdjointCheckpointScheme check_scheme, sunbooleantype on_or_off);
 
+SUNDIALS_EXPORT
+SUNErrCode SUNAdjointCheckpointScheme_SetMmapOptions_Fixed(
+  SUNAdjointCheckpointScheme check_scheme, const char* directory,
+  size_t memory_budget);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNAdjointCheckpointScheme_SetCompression_Fixed(
+  SUNAdjointCheckpointScheme check_scheme, SUNDataCompression ctype,
+  sunrealtype errbound);
+
 #ifdef __cplusplus
 }
 #endif
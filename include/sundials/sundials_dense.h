@@ -54,6 +54,8 @@ extern "C" {
  *     trapezoidal part of A contains the multipliers, I-L.
  *
  * For square matrices (M = N), L is unit lower triangular.
+ * Matrices with 64 or more columns are factored with a blocked algorithm
+ * that updates the trailing submatrix with panels of 32 columns at once.
  *
  * SUNDlsMat_DenseGETRF returns 0 if successful. Otherwise it encountered a zero
  * diagonal element during the factorization. In this case it returns the column
@@ -69,6 +71,10 @@ extern "C" {
  * SUNDlsMat_DenseGETRF and SUNDlsMat_DenseGETRS are simply wrappers around
  * SUNDlsMat_denseGETRF and SUNDlsMat_denseGETRS, respectively, which perform all the
  * work by directly accessing the data in the SUNDlsMat A (i.e. in A->cols).
+ *
+ * SUNDlsMat_denseGETRF_Threaded computes the same factorization, threading the
+ * update of large trailing submatrices with up to nthreads OpenMP threads when
+ * SUNDIALS is built with OpenMP. SUNDlsMat_denseGETRF uses a single thread.
  * ----------------------------------------------------------------------------
  */
 
@@ -82,6 +88,11 @@ SUNDIALS_EXPORT
 sunindextype SUNDlsMat_denseGETRF(sunrealtype** a, sunindextype m,
                                   sunindextype n, sunindextype* p);
 
+SUNDIALS_EXPORT
+sunindextype SUNDlsMat_denseGETRF_Threaded(sunrealtype** a, sunindextype m,
+                                           sunindextype n, sunindextype* p,
+                                           int nthreads);
+
 SUNDIALS_EXPORT
 void SUNDlsMat_denseGETRS(sunrealtype** a, sunindextype n, sunindextype* p,
                           sunrealtype* b);
@@ -79,13 +79,21 @@ typedef enum SUNPrecType SUNPrecType;
  * SUN_CLASSICAL_GS : The iterative solver uses the classical
  *                    Gram-Schmidt routine SUNClassicalGS listed in
  *                    this file.
+ *
+ * SUN_PIPELINED_GS : The iterative solver uses a classical
+ *                    Gram-Schmidt process with delayed
+ *                    reorthogonalization that needs a single
+ *                    global reduction per iteration, which may be
+ *                    overlapped with the operator application.
+ *                    Currently only supported by SPGMR.
  * -----------------------------------------------------------------
  */
 
 enum SUNGramSchmidtType
 {
   SUN_MODIFIED_GS  = 1,
-  SUN_CLASSICAL_GS = 2
+  SUN_CLASSICAL_GS = 2,
+  SUN_PIPELINED_GS = 3
 };
 
 #ifndef SWIG
@@ -104,6 +104,7 @@ enum SUNLinearSolver_ID
   SUNLINEARSOLVER_GINKGO,
   SUNLINEARSOLVER_GINKGOBATCH,
   SUNLINEARSOLVER_KOKKOSDENSE,
+  SUNLINEARSOLVER_BLOCKDENSE,
   SUNLINEARSOLVER_CUSTOM
 };
 
@@ -72,6 +72,7 @@ enum SUNMatrix_ID
   SUNMATRIX_GINKGO,
   SUNMATRIX_GINKGOBATCH,
   SUNMATRIX_KOKKOSDENSE,
+  SUNMATRIX_BLOCKDENSE,
   SUNMATRIX_CUSTOM
 };
 
@@ -188,6 +188,8 @@ struct _generic_N_Vector_Ops
   /* Single buffer reduction operations */
   SUNErrCode (*nvdotprodmultilocal)(int, N_Vector, N_Vector*, sunrealtype*);
   SUNErrCode (*nvdotprodmultiallreduce)(int, N_Vector, sunrealtype*);
+  SUNErrCode (*nvdotprodmultiallreducebegin)(int, N_Vector, sunrealtype*);
+  SUNErrCode (*nvdotprodmultiallreduceend)(int, N_Vector, sunrealtype*);
 
   /* XBraid interface operations */
   SUNErrCode (*nvbufsize)(N_Vector, sunindextype*);
@@ -326,6 +328,12 @@ SUNDIALS_EXPORT SUNErrCode N_VDotProdMultiLocal(int nvec, N_Vector x,
                                                 sunrealtype* dotprods_1d);
 SUNDIALS_EXPORT SUNErrCode N_VDotProdMultiAllReduce(int nvec_total, N_Vector x,
                                                     sunrealtype* sum_1d);
+SUNDIALS_EXPORT SUNErrCode N_VDotProdMultiAllReduceBegin(int nvec_total,
+                                                         N_Vector x,
+                                                         sunrealtype* sum_1d);
+SUNDIALS_EXPORT SUNErrCode N_VDotProdMultiAllReduceEnd(int nvec_total,
+                                                       N_Vector x,
+                                                       sunrealtype* sum_1d);
 
 /* XBraid interface operations */
 SUNDIALS_EXPORT SUNErrCode N_VBufSize(N_Vector x, sunindextype* size);
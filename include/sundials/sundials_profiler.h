@@ -42,6 +42,18 @@ SUNErrCode SUNProfiler_Begin(SUNProfiler p, const char* name);
 SUNDIALS_EXPORT
 SUNErrCode SUNProfiler_End(SUNProfiler p, const char* name);
 
+SUNDIALS_EXPORT
+SUNErrCode SUNProfiler_GetTimer(SUNProfiler p, const char* name, int* timer);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNProfiler_BeginHandle(SUNProfiler p, int timer);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNProfiler_EndHandle(SUNProfiler p, int timer);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNProfiler_SetHierarchical(SUNProfiler p, sunbooleantype onoff);
+
 SUNDIALS_EXPORT
 SUNErrCode SUNProfiler_GetTimerResolution(SUNProfiler p, double* resolution);
 
@@ -70,19 +82,63 @@ SUNErrCode SUNProfiler_Reset(SUNProfiler p);
 
 #elif defined(SUNDIALS_BUILD_WITH_PROFILING)
 
+/* Each use of the macros caches the profiler, region name pointer, and timer
+   handle in static variables so that the region name is only looked up when
+   the profiler or name differs from the previous call at that site or the
+   profiler rejects the cached handle (e.g., a new profiler allocated at the
+   address of a freed one). */
+
+#define SUNDIALS_MARK_BEGIN(profobj, name)                                 \
+  do {                                                                     \
+    static SUNProfiler sun_site_prof_ = NULL;                              \
+    static const char* sun_site_name_ = NULL;                              \
+    static int sun_site_timer_        = 0;                                 \
+    SUNProfiler sun_prof_             = (profobj);                         \
+    const char* sun_name_             = (name);                            \
+    if (sun_prof_ != sun_site_prof_ || sun_name_ != sun_site_name_ ||      \
+        SUNProfiler_BeginHandle(sun_prof_, sun_site_timer_))               \
+    {                                                                      \
+      sun_site_prof_ = NULL;                                               \
+      if (!SUNProfiler_GetTimer(sun_prof_, sun_name_, &sun_site_timer_) && \
+          !SUNProfiler_BeginHandle(sun_prof_, sun_site_timer_))            \
+      {                                                                    \
+        sun_site_prof_ = sun_prof_;                                        \
+        sun_site_name_ = sun_name_;                                        \
+      }                                                                    \
+    }                                                                      \
+  }                                                                        \
+  while (0)
+
+#define SUNDIALS_MARK_END(profobj, name)                                   \
+  do {                                                                     \
+    static SUNProfiler sun_site_prof_ = NULL;                              \
+    static const char* sun_site_name_ = NULL;                              \
+    static int sun_site_timer_        = 0;                                 \
+    SUNProfiler sun_prof_             = (profobj);                         \
+    const char* sun_name_             = (name);                            \
+    if (sun_prof_ != sun_site_prof_ || sun_name_ != sun_site_name_ ||      \
+        SUNProfiler_EndHandle(sun_prof_, sun_site_timer_))                 \
+    {                                                                      \
+      sun_site_prof_ = NULL;                                               \
+      if (!SUNProfiler_End(sun_prof_, sun_name_) &&                        \
+          !SUNProfiler_GetTimer(sun_prof_, sun_name_, &sun_site_timer_))   \
+      {                                                                    \
+        sun_site_prof_ = sun_prof_;                                        \
+        sun_site_name_ = sun_name_;                                        \
+      }                                                                    \
+    }                                                                      \
+  }                                                                        \
+  while (0)
+
 #define SUNDIALS_MARK_FUNCTION_BEGIN(profobj) \
-  SUNProfiler_Begin(profobj, __func__)
+  SUNDIALS_MARK_BEGIN(profobj, __func__)
 
-#define SUNDIALS_MARK_FUNCTION_END(profobj) SUNProfiler_End(profobj, __func__)
+#define SUNDIALS_MARK_FUNCTION_END(profobj) SUNDIALS_MARK_END(profobj, __func__)
 
 #define SUNDIALS_WRAP_STATEMENT(profobj, name, stmt) \
-  SUNProfiler_Begin(profobj, (name));                \
+  SUNDIALS_MARK_BEGIN(profobj, name);                \
   stmt;                                              \
-  SUNProfiler_End(profobj, (name));
-
-#define SUNDIALS_MARK_BEGIN(profobj, name) SUNProfiler_Begin(profobj, (name))
-
-#define SUNDIALS_MARK_END(profobj, name) SUNProfiler_End(profobj, (name))
+  SUNDIALS_MARK_END(profobj, name);
 
 #else
 
@@ -47,11 +47,24 @@ public:
     SUNProfiler_Begin(prof_, name_);
   }
 
-  ~ProfilerMarkScope() { SUNProfiler_End(prof_, name_); }
+  ProfilerMarkScope(SUNProfiler prof, int timer)
+  {
+    prof_  = prof;
+    name_  = nullptr;
+    timer_ = timer;
+    SUNProfiler_BeginHandle(prof_, timer_);
+  }
+
+  ~ProfilerMarkScope()
+  {
+    if (name_) { SUNProfiler_End(prof_, name_); }
+    else { SUNProfiler_EndHandle(prof_, timer_); }
+  }
 
 private:
   SUNProfiler prof_;
   const char* name_;
+  int timer_{-1};
 };
 
 namespace experimental {
@@ -275,10 +275,33 @@ typedef int SUNComm;
 enum SUNDataIOMode
 {
   SUNDATAIOMODE_INMEM,
+  SUNDATAIOMODE_MMAP,
 };
 
 #ifndef SWIG
 typedef enum SUNDataIOMode SUNDataIOMode;
 #endif
 
+/*
+ *------------------------------------------------------------------
+ * Type : SUNDataCompression
+ *------------------------------------------------------------------
+ * Type that selects the (lossy) compression applied to stored
+ * vector data, notably checkpoints and interpolation data for
+ * adjoints.
+ *------------------------------------------------------------------
+ */
+
+enum SUNDataCompression
+{
+  SUNDATACOMPRESSION_NONE,
+  SUNDATACOMPRESSION_FLOAT,
+  SUNDATACOMPRESSION_QUANTIZE,
+  SUNDATACOMPRESSION_DELTA,
+};
+
+#ifndef SWIG
+typedef enum SUNDataCompression SUNDataCompression;
+#endif
+
 #endif /* _SUNDIALS_TYPES_H */
@@ -46,6 +46,19 @@ struct _SUNLinearSolverContent_Band
   sunindextype N;
   sunindextype* pivots;
   sunindextype last_flag;
+
+  /* mixed precision factorization with iterative refinement */
+  sunbooleantype mixed;    /* factor a float copy of the matrix    */
+  sunbooleantype fallback; /* A holds working precision factors    */
+  int max_refine;          /* maximum number of refinement steps   */
+  sunrealtype refine_tol;  /* relative tolerance on the correction */
+  float* Af;               /* float LU factors                     */
+  sunindextype ldim;       /* leading dimension of Af              */
+  float* bf;               /* float work vector                    */
+  N_Vector r;              /* residual vector                      */
+  long int nsolves;        /* number of mixed precision solves     */
+  long int nrefine;        /* number of refinement steps           */
+  long int nfallbacks;     /* number of working precision LUs      */
 };
 
 typedef struct _SUNLinearSolverContent_Band* SUNLinearSolverContent_Band;
@@ -84,6 +97,17 @@ SUNErrCode SUNLinSolSpace_Band(SUNLinearSolver S, long int* lenrwLS,
 SUNDIALS_EXPORT
 SUNErrCode SUNLinSolFree_Band(SUNLinearSolver S);
 
+SUNDIALS_EXPORT
+SUNErrCode SUNLinSol_BandSetMixedPrecision(SUNLinearSolver S,
+                                           sunbooleantype onoff, int max_refine,
+                                           sunrealtype refine_tol);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNLinSol_BandGetRefinementStats(SUNLinearSolver S,
+                                            long int* nsolves,
+                                            long int* nrefine,
+                                            long int* nfallbacks);
+
 #ifdef __cplusplus
 }
 #endif
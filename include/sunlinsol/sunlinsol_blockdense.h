@@ -0,0 +1,88 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2025-2026, Lawrence Livermore National Security,
+ * University of Maryland Baltimore County, and the SUNDIALS contributors.
+ * Copyright (c) 2013-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * Copyright (c) 2002-2013, Lawrence Livermore National Security.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * This is the header file for the block-diagonal dense implementation
+ * of the SUNLINSOL module, SUNLINSOL_BLOCKDENSE.
+ *
+ * Notes:
+ *   - The solver factors every block of a SUNMATRIX_BLOCKDENSE matrix
+ *     with an LU factorization with partial pivoting. The blocks of a
+ *     block group are factored together, one vector lane per block.
+ *   - The definition of the generic SUNLinearSolver structure can
+ *     be found in the header file sundials_linearsolver.h.
+ * -----------------------------------------------------------------
+ */
+
+#ifndef _SUNLINSOL_BLOCKDENSE_H
+#define _SUNLINSOL_BLOCKDENSE_H
+
+#include <sundials/sundials_linearsolver.h>
+#include <sundials/sundials_matrix.h>
+#include <sundials/sundials_nvector.h>
+#include <sunmatrix/sunmatrix_blockdense.h>
+
+#ifdef __cplusplus /* wrapper to enable C++ usage */
+extern "C" {
+#endif
+
+/* ----------------------------------------------------
+ * Block-diagonal dense implementation of SUNLinearSolver
+ * ---------------------------------------------------- */
+
+struct _SUNLinearSolverContent_BlockDense
+{
+  sunindextype N;         /* size of each block                    */
+  sunindextype nblocks;   /* number of blocks                      */
+  sunindextype ngroups;   /* number of block groups                */
+  sunindextype* pivots;   /* interleaved pivots for every block    */
+  sunrealtype* work;      /* interleaved right-hand side workspace */
+  sunindextype last_flag; /* last error flag                       */
+};
+
+typedef struct _SUNLinearSolverContent_BlockDense* SUNLinearSolverContent_BlockDense;
+
+/* ---------------------------------------------
+ * Exported Functions for SUNLINSOL_BLOCKDENSE
+ * --------------------------------------------- */
+
+SUNDIALS_EXPORT
+SUNLinearSolver SUNLinSol_BlockDense(N_Vector y, SUNMatrix A, SUNContext sunctx);
+
+SUNDIALS_EXPORT
+SUNLinearSolver_Type SUNLinSolGetType_BlockDense(SUNLinearSolver S);
+
+SUNDIALS_EXPORT
+SUNLinearSolver_ID SUNLinSolGetID_BlockDense(SUNLinearSolver S);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNLinSolInitialize_BlockDense(SUNLinearSolver S);
+
+SUNDIALS_EXPORT
+int SUNLinSolSetup_BlockDense(SUNLinearSolver S, SUNMatrix A);
+
+SUNDIALS_EXPORT
+int SUNLinSolSolve_BlockDense(SUNLinearSolver S, SUNMatrix A, N_Vector x,
+                              N_Vector b, sunrealtype tol);
+
+SUNDIALS_EXPORT
+sunindextype SUNLinSolLastFlag_BlockDense(SUNLinearSolver S);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNLinSolFree_BlockDense(SUNLinearSolver S);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -51,6 +51,19 @@ struct _SUNLinearSolverContent_Dense
   sunindextype N;
   sunindextype* pivots;
   sunindextype last_flag;
+  int nthreads; /* OpenMP threads used by the LU factorization */
+
+  /* mixed precision factorization with iterative refinement */
+  sunbooleantype mixed;    /* factor a float copy of the matrix    */
+  sunbooleantype fallback; /* A holds working precision factors    */
+  int max_refine;          /* maximum number of refinement steps   */
+  sunrealtype refine_tol;  /* relative tolerance on the correction */
+  float* Af;               /* float LU factors                     */
+  float* bf;               /* float work vector                    */
+  N_Vector r;              /* residual vector                      */
+  long int nsolves;        /* number of mixed precision solves     */
+  long int nrefine;        /* number of refinement steps           */
+  long int nfallbacks;     /* number of working precision LUs      */
 };
 
 typedef struct _SUNLinearSolverContent_Dense* SUNLinearSolverContent_Dense;
@@ -89,6 +102,19 @@ SUNErrCode SUNLinSolSpace_Dense(SUNLinearSolver S, long int* lenrwLS,
 SUNDIALS_EXPORT
 SUNErrCode SUNLinSolFree_Dense(SUNLinearSolver S);
 
+SUNDIALS_EXPORT
+SUNErrCode SUNLinSol_DenseSetMixedPrecision(SUNLinearSolver S,
+                                            sunbooleantype onoff, int max_refine,
+                                            sunrealtype refine_tol);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNLinSol_DenseSetNumThreads(SUNLinearSolver S, int nthreads);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNLinSol_DenseGetRefinementStats(SUNLinearSolver S,
+                                             long int* nsolves, long int* nrefine,
+                                             long int* nfallbacks);
+
 #ifdef __cplusplus
 }
 #endif
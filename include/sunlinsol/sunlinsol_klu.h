@@ -29,6 +29,7 @@
 #ifndef _SUNLINSOL_KLU_H
 #define _SUNLINSOL_KLU_H
 
+#include <stdint.h>
 #include <sundials/sundials_linearsolver.h>
 #include <sundials/sundials_matrix.h>
 #include <sundials/sundials_nvector.h>
@@ -42,9 +43,10 @@ extern "C" {
 #endif
 
 /* Default KLU solver parameters */
-#define SUNKLU_ORDERING_DEFAULT 1 /* COLAMD */
-#define SUNKLU_REINIT_FULL      1
-#define SUNKLU_REINIT_PARTIAL   2
+#define SUNKLU_ORDERING_DEFAULT     1 /* COLAMD */
+#define SUNKLU_REINIT_FULL          1
+#define SUNKLU_REINIT_PARTIAL       2
+#define SUNKLU_PIVOT_GROWTH_DEFAULT SUN_RCONST(1.0e-3)
 
 /* Interfaces to match 'sunindextype' with the correct KLU types/functions */
 #if defined(SUNDIALS_INT64_T)
@@ -104,6 +106,22 @@ struct _SUNLinearSolverContent_KLU
   sun_klu_numeric* numeric;
   sun_klu_common common;
   KLUSolveFn klu_solver;
+  uint64_t pattern_hash;        /* fingerprint of the analyzed pattern  */
+  sunindextype pattern_np;      /* number of columns (CSC) or rows (CSR)
+                                   of the analyzed pattern              */
+  sunindextype* pattern_ptrs;   /* copy of the analyzed index pointers  */
+  sunindextype* pattern_vals;   /* copy of the analyzed index values    */
+  int pattern_ordering;         /* ordering used in the analysis        */
+  sunrealtype pivot_growth_tol; /* refactor rcond tolerance             */
+  sunrealtype rcond_factor;     /* rcond after the last full factor     */
+  long int nanalyze;            /* number of symbolic analyses          */
+  long int nfactor;             /* number of full factorizations        */
+  long int nrefactor;           /* number of refactorizations           */
+  long int nsolve;              /* number of solves                     */
+  double t_analyze;             /* time spent in symbolic analyses      */
+  double t_factor;              /* time spent in full factorizations    */
+  double t_refactor;            /* time spent in refactorizations       */
+  double t_solve;               /* time spent in solves                 */
 };
 
 typedef struct _SUNLinearSolverContent_KLU* SUNLinearSolverContent_KLU;
@@ -118,6 +136,8 @@ SUNDIALS_EXPORT int SUNLinSol_KLUReInit(SUNLinearSolver S, SUNMatrix A,
                                         sunindextype nnz, int reinit_type);
 SUNDIALS_EXPORT int SUNLinSol_KLUSetOrdering(SUNLinearSolver S,
                                              int ordering_choice);
+SUNDIALS_EXPORT SUNErrCode SUNLinSol_KLUSetPivotGrowthTol(SUNLinearSolver S,
+                                                          sunrealtype tol);
 
 /* --------------------
  *  Accessor functions
@@ -126,6 +146,16 @@ SUNDIALS_EXPORT int SUNLinSol_KLUSetOrdering(SUNLinearSolver S,
 SUNDIALS_EXPORT sun_klu_symbolic* SUNLinSol_KLUGetSymbolic(SUNLinearSolver S);
 SUNDIALS_EXPORT sun_klu_numeric* SUNLinSol_KLUGetNumeric(SUNLinearSolver S);
 SUNDIALS_EXPORT sun_klu_common* SUNLinSol_KLUGetCommon(SUNLinearSolver S);
+SUNDIALS_EXPORT SUNErrCode SUNLinSol_KLUGetStats(SUNLinearSolver S,
+                                                 long int* nanalyze,
+                                                 long int* nfactor,
+                                                 long int* nrefactor,
+                                                 long int* nsolve);
+SUNDIALS_EXPORT SUNErrCode SUNLinSol_KLUGetTimes(SUNLinearSolver S,
+                                                 double* t_analyze,
+                                                 double* t_factor,
+                                                 double* t_refactor,
+                                                 double* t_solve);
 
 /* -----------------------------------------------
  *  Implementations of SUNLinearSolver operations
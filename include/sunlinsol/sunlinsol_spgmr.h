@@ -77,6 +77,9 @@ struct _SUNLinearSolverContent_SPGMR
 
   sunrealtype* cv;
   N_Vector* Xv;
+
+  sunrealtype** Hcopy;
+  sunrealtype* dv;
 };
 
 typedef struct _SUNLinearSolverContent_SPGMR* SUNLinearSolverContent_SPGMR;
@@ -0,0 +1,133 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2025-2026, Lawrence Livermore National Security,
+ * University of Maryland Baltimore County, and the SUNDIALS contributors.
+ * Copyright (c) 2013-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * Copyright (c) 2002-2013, Lawrence Livermore National Security.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * This is the header file for the block-diagonal dense implementation
+ * of the SUNMATRIX module, SUNMATRIX_BLOCKDENSE.
+ *
+ * Notes:
+ *   - The matrix consists of nblocks independent M by N dense blocks
+ *     on the diagonal. Block k maps entries k*N, ..., (k+1)*N - 1 of
+ *     a vector to entries k*M, ..., (k+1)*M - 1.
+ *   - The blocks are stored in groups of SUN_BLOCKDENSE_GROUP_SIZE
+ *     blocks. Within a group the blocks are interleaved, i.e., entry
+ *     (i,j) of every block in the group is stored contiguously, so
+ *     operations can be vectorized across the blocks of a group. The
+ *     last group is padded with unused blocks if necessary.
+ *   - The entries of the matrix should be accessed with the macro
+ *     SM_ELEMENT_BD(A, k, i, j) or SUNMatrix_BlockDense_Element.
+ * -----------------------------------------------------------------
+ */
+
+#ifndef _SUNMATRIX_BLOCKDENSE_H
+#define _SUNMATRIX_BLOCKDENSE_H
+
+#include <stdio.h>
+#include <sundials/sundials_matrix.h>
+
+#ifdef __cplusplus /* wrapper to enable C++ usage */
+extern "C" {
+#endif
+
+/* Number of interleaved blocks in a block group */
+#define SUN_BLOCKDENSE_GROUP_SIZE 8
+
+/* -------------------------------------------------
+ * Block-diagonal dense implementation of SUNMatrix
+ * ------------------------------------------------- */
+
+struct _SUNMatrixContent_BlockDense
+{
+  sunindextype M;       /* number of rows in a block               */
+  sunindextype N;       /* number of columns in a block            */
+  sunindextype nblocks; /* number of blocks in the matrix          */
+  sunindextype ngroups; /* number of block groups                  */
+  sunindextype ldata;   /* length of data array (including padding) */
+  sunrealtype* data;    /* interleaved block group data            */
+};
+
+typedef struct _SUNMatrixContent_BlockDense* SUNMatrixContent_BlockDense;
+
+/* -----------------------------------------
+ * Macros for access to SUNMATRIX_BLOCKDENSE
+ * ----------------------------------------- */
+
+#define SM_CONTENT_BD(A) ((SUNMatrixContent_BlockDense)(A->content))
+
+#define SM_BLOCKROWS_BD(A) (SM_CONTENT_BD(A)->M)
+
+#define SM_BLOCKCOLUMNS_BD(A) (SM_CONTENT_BD(A)->N)
+
+#define SM_NUMBLOCKS_BD(A) (SM_CONTENT_BD(A)->nblocks)
+
+#define SM_NUMGROUPS_BD(A) (SM_CONTENT_BD(A)->ngroups)
+
+#define SM_ROWS_BD(A) (SM_CONTENT_BD(A)->M * SM_CONTENT_BD(A)->nblocks)
+
+#define SM_COLUMNS_BD(A) (SM_CONTENT_BD(A)->N * SM_CONTENT_BD(A)->nblocks)
+
+#define SM_LDATA_BD(A) (SM_CONTENT_BD(A)->ldata)
+
+#define SM_DATA_BD(A) (SM_CONTENT_BD(A)->data)
+
+#define SM_GROUP_BD(A, g)                                                   \
+  (SM_CONTENT_BD(A)->data + (g) * SUN_BLOCKDENSE_GROUP_SIZE *               \
+                              SM_CONTENT_BD(A)->M * SM_CONTENT_BD(A)->N)
+
+#define SM_ELEMENT_BD(A, k, i, j)                                 \
+  (SM_GROUP_BD(A, (k) / SUN_BLOCKDENSE_GROUP_SIZE)                \
+     [((j) * SM_CONTENT_BD(A)->M + (i)) * SUN_BLOCKDENSE_GROUP_SIZE + \
+      (k) % SUN_BLOCKDENSE_GROUP_SIZE])
+
+/* --------------------------------------------
+ * Exported Functions for SUNMATRIX_BLOCKDENSE
+ * -------------------------------------------- */
+
+SUNDIALS_EXPORT SUNMatrix SUNMatrix_BlockDense(sunindextype nblocks,
+                                               sunindextype M, sunindextype N,
+                                               SUNContext sunctx);
+
+SUNDIALS_EXPORT void SUNMatrix_BlockDense_Print(SUNMatrix A, FILE* outfile);
+
+SUNDIALS_EXPORT sunindextype SUNMatrix_BlockDense_Rows(SUNMatrix A);
+SUNDIALS_EXPORT sunindextype SUNMatrix_BlockDense_Columns(SUNMatrix A);
+SUNDIALS_EXPORT sunindextype SUNMatrix_BlockDense_BlockRows(SUNMatrix A);
+SUNDIALS_EXPORT sunindextype SUNMatrix_BlockDense_BlockColumns(SUNMatrix A);
+SUNDIALS_EXPORT sunindextype SUNMatrix_BlockDense_NumBlocks(SUNMatrix A);
+SUNDIALS_EXPORT sunindextype SUNMatrix_BlockDense_LData(SUNMatrix A);
+SUNDIALS_EXPORT sunrealtype* SUNMatrix_BlockDense_Data(SUNMatrix A);
+SUNDIALS_EXPORT sunrealtype* SUNMatrix_BlockDense_Element(SUNMatrix A,
+                                                          sunindextype k,
+                                                          sunindextype i,
+                                                          sunindextype j);
+
+SUNDIALS_EXPORT SUNMatrix_ID SUNMatGetID_BlockDense(SUNMatrix A);
+SUNDIALS_EXPORT SUNMatrix SUNMatClone_BlockDense(SUNMatrix A);
+SUNDIALS_EXPORT void SUNMatDestroy_BlockDense(SUNMatrix A);
+SUNDIALS_EXPORT SUNErrCode SUNMatZero_BlockDense(SUNMatrix A);
+SUNDIALS_EXPORT SUNErrCode SUNMatCopy_BlockDense(SUNMatrix A, SUNMatrix B);
+SUNDIALS_EXPORT SUNErrCode SUNMatScaleAdd_BlockDense(sunrealtype c, SUNMatrix A,
+                                                     SUNMatrix B);
+SUNDIALS_EXPORT SUNErrCode SUNMatScaleAddI_BlockDense(sunrealtype c,
+                                                      SUNMatrix A);
+SUNDIALS_EXPORT SUNErrCode SUNMatMatvec_BlockDense(SUNMatrix A, N_Vector x,
+                                                   N_Vector y);
+SUNDIALS_EXPORT SUNErrCode SUNMatHermitianTransposeVec_BlockDense(SUNMatrix A,
+                                                                  N_Vector x,
+                                                                  N_Vector y);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
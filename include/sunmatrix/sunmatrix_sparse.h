@@ -58,6 +58,13 @@ extern "C" {
 #define CSC_MAT 0
 #define CSR_MAT 1
 
+/* Storage used by SUNMatMatvec for a matrix with a locked pattern */
+#define SUN_SPARSE_MATVEC_DEFAULT 0
+#define SUN_SPARSE_MATVEC_SELL    1
+
+/* Cached structures for SUNMatMatvec, defined in sunmatrix_sparse.c */
+struct _SUNSparseMatvecData;
+
 /* ------------------------------------------
  * Sparse Implementation of SUNMATRIX_SPARSE
  * ------------------------------------------ */
@@ -78,6 +85,16 @@ struct _SUNMatrixContent_Sparse
   /* CSR indices */
   sunindextype** colvals;
   sunindextype** rowptrs;
+  /* pattern-locked SUNMatScaleAddI and SUNMatScaleAdd */
+  sunbooleantype locked;
+  sunindextype* diagidx; /* position of the diagonal in each column (row) */
+  sunindextype diag_nnz; /* nonzeros in the matrix when diagidx was built  */
+  sunindextype* addidx;  /* position in the matrix of each nonzero of B    */
+  sunindextype add_nnz;  /* nonzeros in the matrix when addidx was built   */
+  sunindextype add_bnnz; /* nonzeros in B when addidx was built            */
+  /* SUNMatMatvec storage for a locked pattern */
+  int matvec_format;
+  struct _SUNSparseMatvecData* matvec_data;
 };
 
 typedef struct _SUNMatrixContent_Sparse* SUNMatrixContent_Sparse;
@@ -132,6 +149,12 @@ SUNErrCode SUNSparseMatrix_Realloc(SUNMatrix A);
 SUNDIALS_EXPORT
 SUNErrCode SUNSparseMatrix_Reallocate(SUNMatrix A, sunindextype NNZ);
 
+SUNDIALS_EXPORT
+SUNErrCode SUNSparseMatrix_LockPattern(SUNMatrix A, sunbooleantype lock);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNSparseMatrix_SetMatvecFormat(SUNMatrix A, int format);
+
 SUNDIALS_EXPORT
 void SUNSparseMatrix_Print(SUNMatrix A, FILE* outfile);
 
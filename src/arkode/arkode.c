@@ -1222,6 +1222,103 @@ int ARKodeGetDky(void* arkode_mem, sunrealtype t, int k, N_Vector dky)
   return (ARK_SUCCESS);
 }
 
+/*---------------------------------------------------------------
+  ARKodeGetDkyBatch:
+
+  This routine computes the k-th derivative of the interpolating
+  polynomial at the nt times t[i], storing the results in dky[i].
+  All of the times must satisfy the same conditions as for
+  ARKodeGetDky. The interpolation weights for all of the times are
+  computed at once, and any additional data needed by the
+  interpolation module (e.g., RHS evaluations for higher-order
+  Hermite interpolants) is computed only once for the batch.
+  ---------------------------------------------------------------*/
+int ARKodeGetDkyBatch(void* arkode_mem, int nt, sunrealtype* t, int k,
+                      N_Vector* dky)
+{
+  sunrealtype tfuzz, tp, tn1;
+  sunrealtype* s;
+  int i, retval;
+  ARKodeMem ark_mem;
+
+  /* Check if ark_mem exists */
+  if (arkode_mem == NULL)
+  {
+    arkProcessError(NULL, ARK_MEM_NULL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_NO_MEM);
+    return (ARK_MEM_NULL);
+  }
+  ark_mem = (ARKodeMem)arkode_mem;
+
+  /* Check all inputs for legality */
+  if (nt < 1 || t == NULL)
+  {
+    arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "nt must be positive and t must be non-NULL.");
+    return (ARK_ILL_INPUT);
+  }
+  if (dky == NULL)
+  {
+    arkProcessError(ark_mem, ARK_BAD_DKY, __LINE__, __func__, __FILE__,
+                    MSG_ARK_NULL_DKY);
+    return (ARK_BAD_DKY);
+  }
+  for (i = 0; i < nt; i++)
+  {
+    if (dky[i] == NULL)
+    {
+      arkProcessError(ark_mem, ARK_BAD_DKY, __LINE__, __func__, __FILE__,
+                      MSG_ARK_NULL_DKY);
+      return (ARK_BAD_DKY);
+    }
+  }
+  if (ark_mem->interp == NULL)
+  {
+    arkProcessError(ark_mem, ARK_MEM_NULL, __LINE__, __func__, __FILE__,
+                    "Missing interpolation structure");
+    return (ARK_MEM_NULL);
+  }
+
+  /* Allow for some slack */
+  tfuzz = FUZZ_FACTOR * ark_mem->uround *
+          (SUNRabs(ark_mem->tcur) + SUNRabs(ark_mem->hold));
+  if (ark_mem->hold < ZERO) { tfuzz = -tfuzz; }
+  tp  = ark_mem->tcur - ark_mem->hold - tfuzz;
+  tn1 = ark_mem->tcur + tfuzz;
+  for (i = 0; i < nt; i++)
+  {
+    if ((t[i] - tp) * (t[i] - tn1) > ZERO)
+    {
+      arkProcessError(ark_mem, ARK_BAD_T, __LINE__, __func__, __FILE__,
+                      MSG_ARK_BAD_T, t[i], ark_mem->tcur - ark_mem->hold,
+                      ark_mem->tcur);
+      return (ARK_BAD_T);
+    }
+  }
+
+  /* convert the output times to the normalized interpolation times */
+  s = (sunrealtype*)malloc((size_t)nt * sizeof(sunrealtype));
+  if (s == NULL)
+  {
+    arkProcessError(ark_mem, ARK_MEM_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_MEM_FAIL);
+    return (ARK_MEM_FAIL);
+  }
+  for (i = 0; i < nt; i++) { s[i] = (t[i] - ark_mem->tcur) / ark_mem->h; }
+
+  /* call arkInterpEvaluateBatch to evaluate result */
+  retval = arkInterpEvaluateBatch(ark_mem, ark_mem->interp, nt, s, k,
+                                  ARK_INTERP_MAX_DEGREE, dky);
+  free(s);
+  if (retval != ARK_SUCCESS)
+  {
+    arkProcessError(ark_mem, retval, __LINE__, __func__, __FILE__,
+                    "Error calling arkInterpEvaluateBatch");
+    return (retval);
+  }
+  return (ARK_SUCCESS);
+}
+
 /*---------------------------------------------------------------
   ARKodeFree:
 
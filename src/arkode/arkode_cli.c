@@ -126,7 +126,8 @@ static int arkSetFromCommandLine(void* arkode_mem, const char* arkid, int argc,
 
   static const struct sunKeyTwoRealPair tworeal_pairs[] =
     {{"scalar_tolerances", ARKodeSStolerances},
-     {"fixed_step_bounds", ARKodeSetFixedStepBounds}};
+     {"fixed_step_bounds", ARKodeSetFixedStepBounds},
+     {"jac_reuse_on_reset", ARKodeSetJacReuseOnReset}};
   static const int num_tworeal_keys = sizeof(tworeal_pairs) /
                                       sizeof(*tworeal_pairs);
 
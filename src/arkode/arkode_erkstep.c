@@ -253,7 +253,7 @@ int erkStep_Resize(ARKodeMem ark_mem, N_Vector y0,
   ark_mem->liw1 = liw1;
 
   /* Resize the RHS vectors */
-  for (i = 0; i < step_mem->stages; i++)
+  for (i = 0; step_mem->F != NULL && i < step_mem->stages; i++)
   {
     if (!arkResizeVec(ark_mem, resize, resize_data, lrw_diff, liw_diff, y0,
                       &step_mem->F[i]))
@@ -264,6 +264,18 @@ int erkStep_Resize(ARKodeMem ark_mem, N_Vector y0,
     }
   }
 
+  /* Resize the low-storage register */
+  if (step_mem->R != NULL)
+  {
+    if (!arkResizeVec(ark_mem, resize, resize_data, lrw_diff, liw_diff, y0,
+                      &step_mem->R))
+    {
+      arkProcessError(ark_mem, ARK_MEM_FAIL, __LINE__, __func__, __FILE__,
+                      "Unable to resize vector");
+      return (ARK_MEM_FAIL);
+    }
+  }
+
   return (ARK_SUCCESS);
 }
 
@@ -294,6 +306,9 @@ void erkStep_Free(ARKodeMem ark_mem)
       ark_mem->lrw -= Blrw;
     }
 
+    /* free the low-storage table and register */
+    erkStep_FreeLowStorageTable(ark_mem, step_mem);
+
     /* free the RHS vectors */
     if (step_mem->F != NULL)
     {
@@ -370,12 +385,20 @@ void erkStep_PrintMem(ARKodeMem ark_mem, FILE* outfile)
   fprintf(outfile, "ERKStep: nfe = %li\n", step_mem->nfe);
 
   /* output sunrealtype quantities */
-  fprintf(outfile, "ERKStep: Butcher table:\n");
-  ARKodeButcherTable_Write(step_mem->B, outfile);
+  if (step_mem->L != NULL)
+  {
+    fprintf(outfile, "ERKStep: low-storage table:\n");
+    ARKodeLowStorageTable_Write(step_mem->L, outfile);
+  }
+  else
+  {
+    fprintf(outfile, "ERKStep: Butcher table:\n");
+    ARKodeButcherTable_Write(step_mem->B, outfile);
+  }
 
 #ifdef SUNDIALS_DEBUG_PRINTVEC
   /* output vector quantities */
-  for (i = 0; i < step_mem->stages; i++)
+  for (i = 0; step_mem->F != NULL && i < step_mem->stages; i++)
   {
     fprintf(outfile, "ERKStep: F[%i]:\n", i);
     N_VPrintFile(step_mem->F[i], outfile);
@@ -429,27 +452,46 @@ int erkStep_Init(ARKodeMem ark_mem, SUNDIALS_MAYBE_UNUSED sunrealtype tout,
     ark_mem->e_data    = ark_mem;
   }
 
-  /* Create Butcher table (if not already set) */
-  retval = erkStep_SetButcherTable(ark_mem);
-  if (retval != ARK_SUCCESS)
+  if (step_mem->L != NULL)
   {
-    arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
-                    "Could not create Butcher table");
-    return (ARK_ILL_INPUT);
-  }
+    /* Low-storage methods only advance the solution and error registers */
+    if (ark_mem->relax_enabled || ark_mem->do_adjoint || step_mem->nforcing > 0)
+    {
+      arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                      "Low-storage tables are not compatible with relaxation, "
+                      "adjoint sensitivity analysis, or external forcing");
+      return (ARK_ILL_INPUT);
+    }
 
-  /* Check that Butcher table are OK */
-  retval = erkStep_CheckButcherTable(ark_mem);
-  if (retval != ARK_SUCCESS)
-  {
-    arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
-                    "Error in Butcher table");
-    return (ARK_ILL_INPUT);
+    /* Retrieve/store method and embedding orders */
+    step_mem->stages = step_mem->L->stages;
+    step_mem->q      = ark_mem->hadapt_mem->q = step_mem->L->q;
+    step_mem->p      = ark_mem->hadapt_mem->p = step_mem->L->p;
   }
+  else
+  {
+    /* Create Butcher table (if not already set) */
+    retval = erkStep_SetButcherTable(ark_mem);
+    if (retval != ARK_SUCCESS)
+    {
+      arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                      "Could not create Butcher table");
+      return (ARK_ILL_INPUT);
+    }
 
-  /* Retrieve/store method and embedding orders now that table is finalized */
-  step_mem->q = ark_mem->hadapt_mem->q = step_mem->B->q;
-  step_mem->p = ark_mem->hadapt_mem->p = step_mem->B->p;
+    /* Check that Butcher table are OK */
+    retval = erkStep_CheckButcherTable(ark_mem);
+    if (retval != ARK_SUCCESS)
+    {
+      arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                      "Error in Butcher table");
+      return (ARK_ILL_INPUT);
+    }
+
+    /* Retrieve/store method and embedding orders now that table is finalized */
+    step_mem->q = ark_mem->hadapt_mem->q = step_mem->B->q;
+    step_mem->p = ark_mem->hadapt_mem->p = step_mem->B->p;
+  }
 
   /* Ensure that if adaptivity or error accumulation is enabled, then
        method includes embedding coefficients */
@@ -461,55 +503,68 @@ int erkStep_Init(ARKodeMem ark_mem, SUNDIALS_MAYBE_UNUSED sunrealtype tout,
     return (ARK_ILL_INPUT);
   }
 
-  /* Allocate ARK RHS vector memory, update storage requirements */
-  /*   Allocate F[0] ... F[stages-1] if needed */
-  if (step_mem->F == NULL)
-  {
-    step_mem->F = (N_Vector*)calloc(step_mem->stages, sizeof(N_Vector));
-  }
-  for (j = 0; j < step_mem->stages; j++)
+  if (step_mem->L != NULL)
   {
-    if (!arkAllocVec(ark_mem, ark_mem->ewt, &(step_mem->F[j])))
+    /* Allocate the low-storage register; the stage RHS and the error
+       estimate reuse the ARKODE temporary vectors tempv2 and tempv1 */
+    if (!arkAllocVec(ark_mem, ark_mem->ewt, &(step_mem->R)))
     {
       return (ARK_MEM_FAIL);
     }
   }
-  ark_mem->liw += step_mem->stages; /* pointers */
-
-  /* Allocate reusable arrays for fused vector interface */
-  step_mem->nfusedopvecs = 2 * step_mem->stages + 2 + step_mem->nforcing;
-  if (step_mem->cvals == NULL)
-  {
-    step_mem->cvals = (sunrealtype*)calloc(step_mem->nfusedopvecs,
-                                           sizeof(sunrealtype));
-    if (step_mem->cvals == NULL) { return (ARK_MEM_FAIL); }
-    ark_mem->lrw += step_mem->nfusedopvecs;
-  }
-  if (step_mem->Xvecs == NULL)
+  else
   {
-    step_mem->Xvecs = (N_Vector*)calloc(step_mem->nfusedopvecs, sizeof(N_Vector));
-    if (step_mem->Xvecs == NULL) { return (ARK_MEM_FAIL); }
-    ark_mem->liw += step_mem->nfusedopvecs; /* pointers */
-  }
+    /* Allocate ARK RHS vector memory, update storage requirements */
+    /*   Allocate F[0] ... F[stages-1] if needed */
+    if (step_mem->F == NULL)
+    {
+      step_mem->F = (N_Vector*)calloc(step_mem->stages, sizeof(N_Vector));
+    }
+    for (j = 0; j < step_mem->stages; j++)
+    {
+      if (!arkAllocVec(ark_mem, ark_mem->ewt, &(step_mem->F[j])))
+      {
+        return (ARK_MEM_FAIL);
+      }
+    }
+    ark_mem->liw += step_mem->stages; /* pointers */
 
-  /* Allocate workspace for MRI forcing -- need to allocate here as the
-     number of stages may not bet set before this point and we assume
-     SetInnerForcing has been called before the first step i.e., methods
-     start with a fast integration */
-  if (step_mem->nforcing > 0)
-  {
-    if (!(step_mem->stage_times))
+    /* Allocate reusable arrays for fused vector interface */
+    step_mem->nfusedopvecs = 2 * step_mem->stages + 2 + step_mem->nforcing;
+    if (step_mem->cvals == NULL)
+    {
+      step_mem->cvals = (sunrealtype*)calloc(step_mem->nfusedopvecs,
+                                             sizeof(sunrealtype));
+      if (step_mem->cvals == NULL) { return (ARK_MEM_FAIL); }
+      ark_mem->lrw += step_mem->nfusedopvecs;
+    }
+    if (step_mem->Xvecs == NULL)
     {
-      step_mem->stage_times = (sunrealtype*)calloc(step_mem->stages,
-                                                   sizeof(sunrealtype));
-      ark_mem->lrw += step_mem->stages;
+      step_mem->Xvecs = (N_Vector*)calloc(step_mem->nfusedopvecs,
+                                          sizeof(N_Vector));
+      if (step_mem->Xvecs == NULL) { return (ARK_MEM_FAIL); }
+      ark_mem->liw += step_mem->nfusedopvecs; /* pointers */
     }
 
-    if (!(step_mem->stage_coefs))
+    /* Allocate workspace for MRI forcing -- need to allocate here as the
+       number of stages may not bet set before this point and we assume
+       SetInnerForcing has been called before the first step i.e., methods
+       start with a fast integration */
+    if (step_mem->nforcing > 0)
     {
-      step_mem->stage_coefs = (sunrealtype*)calloc(step_mem->stages,
-                                                   sizeof(sunrealtype));
-      ark_mem->lrw += step_mem->stages;
+      if (!(step_mem->stage_times))
+      {
+        step_mem->stage_times = (sunrealtype*)calloc(step_mem->stages,
+                                                     sizeof(sunrealtype));
+        ark_mem->lrw += step_mem->stages;
+      }
+
+      if (!(step_mem->stage_coefs))
+      {
+        step_mem->stage_coefs = (sunrealtype*)calloc(step_mem->stages,
+                                                     sizeof(sunrealtype));
+        ark_mem->lrw += step_mem->stages;
+      }
     }
   }
 
@@ -528,6 +583,10 @@ int erkStep_Init(ARKodeMem ark_mem, SUNDIALS_MAYBE_UNUSED sunrealtype tout,
 
   /* set appropriate TakeStep routine based on problem configuration */
   if (ark_mem->do_adjoint) { ark_mem->step = erkStep_TakeStep_Adjoint; }
+  else if (step_mem->L != NULL)
+  {
+    ark_mem->step = erkStep_TakeStep_LowStorage;
+  }
   else { ark_mem->step = erkStep_TakeStep; }
 
   /* Signal to shared arkode module that full RHS evaluations are required */
@@ -602,6 +661,25 @@ int erkStep_FullRHS(ARKodeMem ark_mem, sunrealtype t, N_Vector y, N_Vector f,
   retval = erkStep_AccessStepMem(ark_mem, __func__, &step_mem);
   if (retval != ARK_SUCCESS) { return (retval); }
 
+  /* low-storage methods do not store F[0], the RHS at the start of a step
+     is held in ark_mem->fn instead (these methods are never FSAL) */
+  if (step_mem->L != NULL && mode != ARK_FULLRHS_OTHER)
+  {
+    if (!(ark_mem->fn_is_current))
+    {
+      retval = step_mem->f(t, y, f, ark_mem->user_data);
+      step_mem->nfe++;
+      if (retval != 0)
+      {
+        arkProcessError(ark_mem, ARK_RHSFUNC_FAIL, __LINE__, __func__, __FILE__,
+                        MSG_ARK_RHSFUNC_FAILED, t);
+        return (ARK_RHSFUNC_FAIL);
+      }
+    }
+    else if (f != ark_mem->fn) { N_VScale(ONE, ark_mem->fn, f); }
+    return (ARK_SUCCESS);
+  }
+
   /* local shortcuts for use with fused vector operations */
   cvals = step_mem->cvals;
   Xvecs = step_mem->Xvecs;
@@ -976,6 +1054,203 @@ int erkStep_TakeStep(ARKodeMem ark_mem, sunrealtype* dsmPtr, int* nflagPtr)
   return (ARK_SUCCESS);
 }
 
+/*---------------------------------------------------------------
+  erkStep_TakeStep_LowStorage:
+
+  This routine performs a single ERK step (with embedding, if
+  possible) using a low-storage table.  Instead of storing the
+  RHS at every stage, the step only keeps the current stage in
+  ark_ycur, one register (step_mem->R), the stage RHS (in
+  ark_tempv2, or ark_fn for the first stage), and -- when
+  temporal error estimation is enabled -- the error estimate in
+  ark_tempv1.
+
+  For 2N tables the registers are updated as
+
+    dQ = A_i dQ + h F_i,  y = y + B_i dQ,  yerr += h (b_i - bhat_i) F_i
+
+  and for 3S* tables (with S1 = ark_ycur, S2 = R, S3 = y_n) as
+
+    S2 = S2 + delta_i S1,
+    S1 = gamma1_i S1 + gamma2_i S2 + gamma3_i S3 + beta_i h F_i
+
+  with the embedded solution (S2 + delta_s S1 + delta_{s+1} S3) /
+  sum(delta).
+
+  The output variable dsmPtr and nflagPtr and the return value
+  are as in erkStep_TakeStep.
+  ---------------------------------------------------------------*/
+int erkStep_TakeStep_LowStorage(ARKodeMem ark_mem, sunrealtype* dsmPtr,
+                                int* nflagPtr)
+{
+  int retval, is, mode;
+  sunbooleantype do_error;
+  sunrealtype h, dsum;
+  sunrealtype cvals[4];
+  N_Vector Xvecs[4];
+  N_Vector F, R, ycur, yerr;
+  ARKodeLowStorageTable L;
+  ARKodeERKStepMem step_mem;
+
+  /* initialize algebraic solver convergence flag to success */
+  *nflagPtr = ARK_SUCCESS;
+
+  /* initialize output */
+  *dsmPtr = ZERO;
+
+  /* access ARKodeERKStepMem structure */
+  retval = erkStep_AccessStepMem(ark_mem, __func__, &step_mem);
+  if (retval != ARK_SUCCESS) { return (retval); }
+
+  /* local shortcuts */
+  L    = step_mem->L;
+  R    = step_mem->R;
+  h    = ark_mem->h;
+  ycur = ark_mem->ycur;
+  yerr = ark_mem->tempv1;
+
+  /* only compute yerr if step adaptivity or error accumulation is enabled */
+  do_error = (L->p > 0) && (!ark_mem->fixedstep ||
+                            (ark_mem->AccumErrorType != ARK_ACCUMERROR_NONE));
+
+  SUNLogInfo(ARK_LOGGER, "begin-stages-list", "stage = 0, tcur = " SUN_FORMAT_G,
+             ark_mem->tcur);
+  SUNLogExtraDebugVec(ARK_LOGGER, "stage", ark_mem->yn, "z_0(:) =");
+
+  /* Call the full RHS if needed (see erkStep_TakeStep) */
+  if (!(ark_mem->fn_is_current))
+  {
+    mode   = (ark_mem->initsetup) ? ARK_FULLRHS_START : ARK_FULLRHS_END;
+    retval = ark_mem->step_fullrhs(ark_mem, ark_mem->tn, ark_mem->yn,
+                                   ark_mem->fn, mode);
+    if (retval)
+    {
+      SUNLogInfo(ARK_LOGGER, "end-stages-list",
+                 "status = failed rhs eval, retval = %i", retval);
+      return ARK_RHSFUNC_FAIL;
+    }
+    ark_mem->fn_is_current = SUNTRUE;
+  }
+
+  SUNLogExtraDebugVec(ARK_LOGGER, "stage RHS", ark_mem->fn, "F_0(:) =");
+
+  /* the first stage is y_n */
+  N_VScale(ONE, ark_mem->yn, ycur);
+
+  for (is = 0; is < L->stages; is++)
+  {
+    if (is == 0) { F = ark_mem->fn; }
+    else
+    {
+      /* Set current stage time */
+      ark_mem->tcur = ark_mem->tn + L->c[is] * h;
+
+      SUNLogInfo(ARK_LOGGER, "begin-stages-list",
+                 "stage = %i, tcur = " SUN_FORMAT_G, is, ark_mem->tcur);
+
+      /* apply user-supplied stage postprocessing function (if supplied) */
+      if (ark_mem->ProcessStage != NULL)
+      {
+        retval = ark_mem->ProcessStage(ark_mem->tcur, ycur, ark_mem->user_data);
+        if (retval != 0)
+        {
+          SUNLogInfo(ARK_LOGGER, "end-stages-list",
+                     "status = failed postprocess stage, retval = %i", retval);
+          return (ARK_POSTPROCESS_STAGE_FAIL);
+        }
+      }
+
+      /* compute stage RHS */
+      F      = ark_mem->tempv2;
+      retval = step_mem->f(ark_mem->tcur, ycur, F, ark_mem->user_data);
+      step_mem->nfe++;
+
+      SUNLogExtraDebugVec(ARK_LOGGER, "stage RHS", F, "F_%i(:) =", is);
+      SUNLogInfoIf(retval != 0, ARK_LOGGER, "end-stages-list",
+                   "status = failed rhs eval, retval = %i", retval);
+
+      if (retval < 0) { return (ARK_RHSFUNC_FAIL); }
+      if (retval > 0) { return (ARK_UNREC_RHSFUNC_ERR); }
+    }
+
+    if (L->type == ARKODE_LOWSTORAGE_2N)
+    {
+      /* accumulate the error estimate from the stage RHS */
+      if (do_error)
+      {
+        if (is == 0) { N_VScale(h * (L->b[is] - L->bhat[is]), F, yerr); }
+        else { N_VLinearSum(ONE, yerr, h * (L->b[is] - L->bhat[is]), F, yerr); }
+      }
+
+      /* update the registers */
+      if (is == 0) { N_VScale(h, F, R); }
+      else { N_VLinearSum(L->A[is], R, h, F, R); }
+      N_VLinearSum(ONE, ycur, L->B[is], R, ycur);
+    }
+    else
+    {
+      /* update the registers */
+      if (is == 0) { N_VScale(L->delta[is], ycur, R); }
+      else { N_VLinearSum(ONE, R, L->delta[is], ycur, R); }
+
+      cvals[0] = L->gamma1[is];
+      Xvecs[0] = ycur;
+      cvals[1] = L->gamma2[is];
+      Xvecs[1] = R;
+      cvals[2] = L->gamma3[is];
+      Xvecs[2] = ark_mem->yn;
+      cvals[3] = h * L->beta[is];
+      Xvecs[3] = F;
+
+      retval = N_VLinearCombination(4, cvals, Xvecs, ycur);
+      if (retval != 0)
+      {
+        SUNLogInfo(ARK_LOGGER, "end-stages-list",
+                   "status = failed vector op, retval = %i", retval);
+        return (ARK_VECTOROP_ERR);
+      }
+    }
+
+    SUNLogInfo(ARK_LOGGER, "end-stages-list", "status = success");
+
+  } /* loop over stages */
+
+  SUNLogInfo(ARK_LOGGER, "begin-compute-solution", "");
+
+  /* the time-evolved solution is already in ark_ycur; finish the error
+     estimate for 3S* tables and fill the error norm */
+  if (do_error)
+  {
+    if (L->type == ARKODE_LOWSTORAGE_3SSTAR)
+    {
+      dsum = ZERO;
+      for (is = 0; is < L->stages + 2; is++) { dsum += L->delta[is]; }
+
+      cvals[0] = (dsum - L->delta[L->stages]) / dsum;
+      Xvecs[0] = ycur;
+      cvals[1] = -ONE / dsum;
+      Xvecs[1] = R;
+      cvals[2] = -L->delta[L->stages + 1] / dsum;
+      Xvecs[2] = ark_mem->yn;
+
+      retval = N_VLinearCombination(3, cvals, Xvecs, yerr);
+      if (retval != 0)
+      {
+        SUNLogInfo(ARK_LOGGER, "end-compute-solution",
+                   "status = failed vector op, retval = %i", retval);
+        return (ARK_VECTOROP_ERR);
+      }
+    }
+
+    *dsmPtr = N_VWrmsNorm(yerr, ark_mem->ewt);
+  }
+
+  SUNLogExtraDebugVec(ARK_LOGGER, "updated solution", ycur, "ycur(:) =");
+  SUNLogInfo(ARK_LOGGER, "end-compute-solution", "status = success");
+
+  return (ARK_SUCCESS);
+}
+
 /*---------------------------------------------------------------
   erkStep_TakeStep_Adjoint:
 
@@ -1293,6 +1568,48 @@ int erkStep_SetButcherTable(ARKodeMem ark_mem)
   return (ARK_SUCCESS);
 }
 
+/*---------------------------------------------------------------
+  erkStep_LowStorageTableSpace
+
+  Returns the integer and real workspace of a low-storage table.
+  ---------------------------------------------------------------*/
+void erkStep_LowStorageTableSpace(ARKodeLowStorageTable L, sunindextype* liw,
+                                  sunindextype* lrw)
+{
+  *liw = 0;
+  *lrw = 0;
+  if (L == NULL) { return; }
+
+  *liw = 4;
+  if (L->type == ARKODE_LOWSTORAGE_2N)
+  {
+    *lrw = 4 * L->stages;
+    if (L->bhat) { *lrw += L->stages; }
+  }
+  else { *lrw = 6 * L->stages + 2; }
+}
+
+/*---------------------------------------------------------------
+  erkStep_FreeLowStorageTable
+
+  Frees the low-storage table and register (if any) and updates
+  the workspace counters.
+  ---------------------------------------------------------------*/
+void erkStep_FreeLowStorageTable(ARKodeMem ark_mem, ARKodeERKStepMem step_mem)
+{
+  sunindextype Lliw, Llrw;
+
+  if (step_mem->L != NULL)
+  {
+    erkStep_LowStorageTableSpace(step_mem->L, &Lliw, &Llrw);
+    ARKodeLowStorageTable_Free(step_mem->L);
+    step_mem->L = NULL;
+    ark_mem->liw -= Lliw;
+    ark_mem->lrw -= Llrw;
+  }
+  arkFreeVec(ark_mem, &step_mem->R);
+}
+
 /*---------------------------------------------------------------
   erkStep_CheckButcherTable
 
@@ -1645,10 +1962,18 @@ int erkStep_fe_Adj(sunrealtype t, N_Vector sens_partial_stage,
                          user_data);
 }
 
-int erkStepCompatibleWithAdjointSolver(
-  ARKodeMem ark_mem, SUNDIALS_MAYBE_UNUSED ARKodeERKStepMem step_mem,
-  int lineno, const char* fname, const char* filename)
+int erkStepCompatibleWithAdjointSolver(ARKodeMem ark_mem,
+                                       ARKodeERKStepMem step_mem, int lineno,
+                                       const char* fname, const char* filename)
 {
+  if (step_mem->L != NULL)
+  {
+    arkProcessError(ark_mem, ARK_ILL_INPUT, lineno, fname, filename,
+                    "SUNAdjointStepper is not compatible with low-storage "
+                    "tables");
+    return ARK_ILL_INPUT;
+  }
+
   if (!ark_mem->fixedstep)
   {
     arkProcessError(ark_mem, ARK_ILL_INPUT, lineno, fname,
@@ -1964,6 +2289,15 @@ int erkStep_SetInnerForcing(ARKodeMem ark_mem, sunrealtype tshift,
 
   if (nvecs > 0)
   {
+    /* low-storage tables do not keep the stage RHS needed for forcing */
+    if (step_mem->L != NULL)
+    {
+      arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                      "External forcing is not compatible with low-storage "
+                      "tables");
+      return (ARK_ILL_INPUT);
+    }
+
     /* store forcing inputs */
     step_mem->tshift   = tshift;
     step_mem->tscale   = tscale;
@@ -61,6 +61,10 @@ typedef struct ARKodeERKStepMemRec
   int stages;           /* number of stages           */
   ARKodeButcherTable B; /* ERK Butcher table          */
 
+  /* Low-storage method storage (B and F are unused when L is set) */
+  ARKodeLowStorageTable L; /* low-storage table           */
+  N_Vector R;              /* low-storage register        */
+
   /* Counters */
   long int nfe; /* num fe calls               */
 
@@ -90,6 +94,8 @@ int erkStep_FullRHS(ARKodeMem ark_mem, sunrealtype t, N_Vector y, N_Vector f,
 int erkStep_TakeStep(ARKodeMem ark_mem, sunrealtype* dsmPtr, int* nflagPtr);
 int erkStep_TakeStep_Adjoint(ARKodeMem ark_mem, sunrealtype* dsmPtr,
                              int* nflagPtr);
+int erkStep_TakeStep_LowStorage(ARKodeMem ark_mem, sunrealtype* dsmPtr,
+                                int* nflagPtr);
 int erkStep_SetOptions(ARKodeMem ark_mem, int* argidx, char* argv[],
                        size_t offset, sunbooleantype* arg_used);
 int erkStep_SetDefaults(ARKodeMem ark_mem);
@@ -115,6 +121,9 @@ int erkStep_AccessStepMem(ARKodeMem ark_mem, const char* fname,
 int erkStep_SetButcherTable(ARKodeMem ark_mem);
 int erkStep_CheckButcherTable(ARKodeMem ark_mem);
 int erkStep_ComputeSolutions(ARKodeMem ark_mem, sunrealtype* dsm);
+void erkStep_LowStorageTableSpace(ARKodeLowStorageTable L, sunindextype* liw,
+                                  sunindextype* lrw);
+void erkStep_FreeLowStorageTable(ARKodeMem ark_mem, ARKodeERKStepMem step_mem);
 void erkStep_ApplyForcing(ARKodeERKStepMem step_mem, sunrealtype* stage_times,
                           sunrealtype* stage_coefs, int jmax, int* nvec);
 
@@ -77,6 +77,7 @@ int ERKStepSetTable(void* arkode_mem, ARKodeButcherTable B)
   step_mem->B = NULL;
   ark_mem->liw -= Bliw;
   ark_mem->lrw -= Blrw;
+  erkStep_FreeLowStorageTable(ark_mem, step_mem);
 
   /* set the relevant parameters */
   step_mem->stages = B->stages;
@@ -135,6 +136,7 @@ int ERKStepSetTableNum(void* arkode_mem, ARKODE_ERKTableID etable)
   step_mem->B = NULL;
   ark_mem->liw -= Bliw;
   ark_mem->lrw -= Blrw;
+  erkStep_FreeLowStorageTable(ark_mem, step_mem);
 
   /* fill in table based on argument */
   step_mem->B = ARKodeButcherTable_LoadERK(etable);
@@ -167,6 +169,140 @@ int ERKStepSetTableName(void* arkode_mem, const char* etable)
   return ERKStepSetTableNum(arkode_mem, arkButcherTableERKNameToID(etable));
 }
 
+/*---------------------------------------------------------------
+  ERKStepSetLowStorageTable:
+
+  Specifies to use a customized low-storage table.  The method
+  is advanced with a fixed number of registers instead of
+  storing the RHS at every stage; any Butcher table previously
+  set is removed.
+
+  If the table does not include an embedding (p == 0), then a
+  user MUST also call ARKodeSetFixedStep.
+  ---------------------------------------------------------------*/
+int ERKStepSetLowStorageTable(void* arkode_mem, ARKodeLowStorageTable L)
+{
+  ARKodeMem ark_mem;
+  ARKodeERKStepMem step_mem;
+  ARKodeLowStorageTable Lcopy;
+  sunindextype Blrw, Bliw, Llrw, Lliw;
+  int retval;
+
+  /* access ARKodeMem and ARKodeERKStepMem structures */
+  retval = erkStep_AccessARKODEStepMem(arkode_mem, __func__, &ark_mem, &step_mem);
+  if (retval != ARK_SUCCESS) { return (retval); }
+
+  /* check for legal inputs */
+  if (L == NULL)
+  {
+    arkProcessError(ark_mem, ARK_MEM_NULL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_NO_MEM);
+    return (ARK_MEM_NULL);
+  }
+
+  /* copy the table before releasing the current one (L may alias it) */
+  Lcopy = ARKodeLowStorageTable_Copy(L);
+  if (Lcopy == NULL)
+  {
+    arkProcessError(ark_mem, ARK_MEM_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_ARKMEM_FAIL);
+    return (ARK_MEM_FAIL);
+  }
+
+  /* clear any existing parameters and tables */
+  step_mem->stages = 0;
+  step_mem->q      = 0;
+  step_mem->p      = 0;
+
+  ARKodeButcherTable_Space(step_mem->B, &Bliw, &Blrw);
+  ARKodeButcherTable_Free(step_mem->B);
+  step_mem->B = NULL;
+  ark_mem->liw -= Bliw;
+  ark_mem->lrw -= Blrw;
+  erkStep_FreeLowStorageTable(ark_mem, step_mem);
+
+  /* set the relevant parameters */
+  step_mem->L      = Lcopy;
+  step_mem->stages = Lcopy->stages;
+  step_mem->q      = Lcopy->q;
+  step_mem->p      = Lcopy->p;
+
+  erkStep_LowStorageTableSpace(step_mem->L, &Lliw, &Llrw);
+  ark_mem->liw += Lliw;
+  ark_mem->lrw += Llrw;
+
+  return (ARK_SUCCESS);
+}
+
+/*---------------------------------------------------------------
+  ERKStepSetLowStorageTableNum:
+
+  Specifies to use a pre-existing low-storage table, based on the
+  integer flag passed to ARKodeLowStorageTable_Load().
+  ---------------------------------------------------------------*/
+int ERKStepSetLowStorageTableNum(void* arkode_mem,
+                                 ARKODE_LowStorageTableID ltable)
+{
+  ARKodeMem ark_mem;
+  ARKodeERKStepMem step_mem;
+  ARKodeLowStorageTable L;
+  int retval;
+
+  /* access ARKodeMem and ARKodeERKStepMem structures */
+  retval = erkStep_AccessARKODEStepMem(arkode_mem, __func__, &ark_mem, &step_mem);
+  if (retval != ARK_SUCCESS) { return (retval); }
+
+  /* check that argument specifies a low-storage table */
+  if (ltable < ARKODE_MIN_LOWSTORAGE_NUM || ltable > ARKODE_MAX_LOWSTORAGE_NUM)
+  {
+    arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "Illegal low-storage table number");
+    return (ARK_ILL_INPUT);
+  }
+
+  L = ARKodeLowStorageTable_Load(ltable);
+  if (L == NULL)
+  {
+    arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "Error setting table with that index");
+    return (ARK_ILL_INPUT);
+  }
+
+  retval = ERKStepSetLowStorageTable(arkode_mem, L);
+  ARKodeLowStorageTable_Free(L);
+  return (retval);
+}
+
+/*---------------------------------------------------------------
+  ERKStepSetLowStorageTableName:
+
+  Specifies to use a pre-existing low-storage table, based on the
+  string passed to ARKodeLowStorageTable_LoadByName().
+  ---------------------------------------------------------------*/
+int ERKStepSetLowStorageTableName(void* arkode_mem, const char* ltable)
+{
+  ARKodeMem ark_mem;
+  ARKodeERKStepMem step_mem;
+  ARKodeLowStorageTable L;
+  int retval;
+
+  /* access ARKodeMem and ARKodeERKStepMem structures */
+  retval = erkStep_AccessARKODEStepMem(arkode_mem, __func__, &ark_mem, &step_mem);
+  if (retval != ARK_SUCCESS) { return (retval); }
+
+  L = ARKodeLowStorageTable_LoadByName(ltable);
+  if (L == NULL)
+  {
+    arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "Illegal low-storage table name");
+    return (ARK_ILL_INPUT);
+  }
+
+  retval = ERKStepSetLowStorageTable(arkode_mem, L);
+  ARKodeLowStorageTable_Free(L);
+  return (retval);
+}
+
 /*===============================================================
   Exported optional output functions.
   ===============================================================*/
@@ -272,7 +408,8 @@ int erkStep_SetOptions(ARKodeMem ark_mem, int* argidx, char* argv[],
 {
   /* Set lists of keys, and the corresponding set routines */
   static const struct sunKeyCharPair char_pairs[] = {
-    {"table_name", ERKStepSetTableName}};
+    {"table_name", ERKStepSetTableName},
+    {"lowstorage_table_name", ERKStepSetLowStorageTableName}};
   static const int num_char_keys = sizeof(char_pairs) / sizeof(*char_pairs);
 
   /* check all "char" keys */
@@ -334,6 +471,7 @@ int erkStep_SetDefaults(ARKodeMem ark_mem)
     ARKodeButcherTable_Free(step_mem->B);
   }
   step_mem->B = NULL;
+  erkStep_FreeLowStorageTable(ark_mem, step_mem);
 
   /* Load the default SUNAdaptController */
   retval = arkReplaceAdaptController(ark_mem, NULL, SUNTRUE);
@@ -371,6 +509,7 @@ int erkStep_SetOrder(ARKodeMem ark_mem, int ord)
   step_mem->B = NULL;
   ark_mem->liw -= Bliw;
   ark_mem->lrw -= Blrw;
+  erkStep_FreeLowStorageTable(ark_mem, step_mem);
 
   return (ARK_SUCCESS);
 }
@@ -434,6 +573,11 @@ int erkStep_WriteParameters(ARKodeMem ark_mem, FILE* fp)
   /* print integrator parameters to file */
   fprintf(fp, "ERKStep time step module parameters:\n");
   fprintf(fp, "  Method order %i\n", step_mem->q);
+  if (step_mem->L != NULL)
+  {
+    fprintf(fp, "  Low-storage %s table\n",
+            (step_mem->L->type == ARKODE_LOWSTORAGE_2N) ? "2N" : "3S*");
+  }
   fprintf(fp, "\n");
 
   return (ARK_SUCCESS);
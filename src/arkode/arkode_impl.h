@@ -321,6 +321,8 @@ struct _generic_ARKInterpOps
   int (*update)(ARKodeMem ark_mem, ARKInterp interp, sunrealtype tnew);
   int (*evaluate)(ARKodeMem ark_mem, ARKInterp interp, sunrealtype tau, int d,
                   int order, N_Vector yout);
+  int (*evaluatebatch)(ARKodeMem ark_mem, ARKInterp interp, int nt,
+                       sunrealtype* tau, int d, int order, N_Vector* yout);
 };
 
 /* An interpolation module consists of an implementation-dependent 'content'
@@ -342,6 +344,10 @@ int arkInterpInit(ARKodeMem ark_mem, ARKInterp interp, sunrealtype tnew);
 int arkInterpUpdate(ARKodeMem ark_mem, ARKInterp interp, sunrealtype tnew);
 int arkInterpEvaluate(ARKodeMem ark_mem, ARKInterp interp, sunrealtype tau,
                       int d, int order, N_Vector yout);
+int arkInterpEvaluateBatch(ARKodeMem ark_mem, ARKInterp interp, int nt,
+                           sunrealtype* tau, int d, int order, N_Vector* yout);
+int arkInterpCombineBatch(int nt, int nvec, sunrealtype* c, N_Vector* X,
+                          N_Vector* yout);
 
 /*===============================================================
   ARKODE data structures
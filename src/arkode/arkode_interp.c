@@ -83,6 +83,49 @@ int arkInterpEvaluate(ARKodeMem ark_mem, ARKInterp interp, sunrealtype tau,
   return ((int)interp->ops->evaluate(ark_mem, interp, tau, d, order, yout));
 }
 
+int arkInterpEvaluateBatch(ARKodeMem ark_mem, ARKInterp interp, int nt,
+                           sunrealtype* tau, int d, int order, N_Vector* yout)
+{
+  if (interp == NULL) { return (ARK_SUCCESS); }
+  return ((int)interp->ops->evaluatebatch(ark_mem, interp, nt, tau, d, order,
+                                          yout));
+}
+
+/*---------------------------------------------------------------
+  arkInterpCombineBatch:
+
+  This routine computes the nt linear combinations
+
+     yout[i] = sum_{j=0}^{nvec-1} c[j*nt+i] * X[j],
+
+  for i = 0, ..., nt-1. Since each output uses its own
+  coefficients for the same vectors, the outputs are initialized
+  with N_VScaleVectorArray and then updated with one fused
+  N_VScaleAddMulti call per remaining vector in X.
+  ---------------------------------------------------------------*/
+int arkInterpCombineBatch(int nt, int nvec, sunrealtype* c, N_Vector* X,
+                          N_Vector* yout)
+{
+  int i, j, retval;
+  N_Vector* Xrep;
+
+  Xrep = (N_Vector*)malloc((size_t)nt * sizeof(N_Vector));
+  if (Xrep == NULL) { return (ARK_MEM_FAIL); }
+  for (i = 0; i < nt; i++) { Xrep[i] = X[0]; }
+
+  retval = N_VScaleVectorArray(nt, c, Xrep, yout);
+  free(Xrep);
+  if (retval != 0) { return (ARK_VECTOROP_ERR); }
+
+  for (j = 1; j < nvec; j++)
+  {
+    retval = N_VScaleAddMulti(nt, c + j * nt, X[j], yout, yout);
+    if (retval != 0) { return (ARK_VECTOROP_ERR); }
+  }
+
+  return (ARK_SUCCESS);
+}
+
 /*---------------------------------------------------------------
   Section II: Hermite interpolation module implementation
   ---------------------------------------------------------------*/
@@ -116,13 +159,14 @@ ARKInterp arkInterpCreate_Hermite(ARKodeMem ark_mem, int degree)
     free(interp);
     return (NULL);
   }
-  ops->resize    = arkInterpResize_Hermite;
-  ops->free      = arkInterpFree_Hermite;
-  ops->print     = arkInterpPrintMem_Hermite;
-  ops->setdegree = arkInterpSetDegree_Hermite;
-  ops->init      = arkInterpInit_Hermite;
-  ops->update    = arkInterpUpdate_Hermite;
-  ops->evaluate  = arkInterpEvaluate_Hermite;
+  ops->resize        = arkInterpResize_Hermite;
+  ops->free          = arkInterpFree_Hermite;
+  ops->print         = arkInterpPrintMem_Hermite;
+  ops->setdegree     = arkInterpSetDegree_Hermite;
+  ops->init          = arkInterpInit_Hermite;
+  ops->update        = arkInterpUpdate_Hermite;
+  ops->evaluate      = arkInterpEvaluate_Hermite;
+  ops->evaluatebatch = arkInterpEvaluateBatch_Hermite;
 
   /* create content, and initialize everything to zero/NULL */
   content = NULL;
@@ -442,24 +486,10 @@ int arkInterpEvaluate_Hermite(ARKodeMem ark_mem, ARKInterp interp,
                               sunrealtype tau, int d, int order, N_Vector yout)
 {
   /* local variables */
-  int q, retval;
-  sunrealtype tval, a0, a1, tau2, tau3, tau4, tau5;
-  sunrealtype h, h2, h3, h4, h5;
+  int q, nvec, retval;
   sunrealtype a[6];
   N_Vector X[6];
 
-  /* set constants */
-  tau2 = tau * tau;
-  tau3 = tau * tau2;
-  tau4 = tau * tau3;
-  tau5 = tau * tau4;
-
-  h  = HINT_H(interp);
-  h2 = h * h;
-  h3 = h * h2;
-  h4 = h * h3;
-  h5 = h * h4;
-
   /* determine polynomial order q */
   q = SUNMAX(order, 0);               /* respect lower bound  */
   q = SUNMIN(q, HINT_DEGREE(interp)); /* respect max possible */
@@ -492,25 +522,246 @@ int arkInterpEvaluate_Hermite(ARKodeMem ark_mem, ARKInterp interp,
     return (ARK_SUCCESS);
   }
 
+  /* compute the additional RHS values for higher-order interpolants */
+  retval = arkInterpPrepare_Hermite(ark_mem, interp, q, yout);
+  if (retval != ARK_SUCCESS) { return (retval); }
+
   /* build polynomial based on order */
+  nvec = arkInterpBasis_Hermite(ark_mem, interp, q, X);
+  if (nvec == 0)
+  {
+    arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "Illegal polynomial order");
+    return (ARK_ILL_INPUT);
+  }
+  arkInterpCoeffs_Hermite(tau, d, q, HINT_H(interp), a);
+
+  if (nvec == 2)
+  {
+    N_VLinearSum(a[0], X[0], a[1], X[1], yout);
+    return (ARK_SUCCESS);
+  }
+
+  retval = N_VLinearCombination(nvec, a, X, yout);
+  if (retval != 0) { return (ARK_VECTOROP_ERR); }
+
+  return (ARK_SUCCESS);
+}
+
+/*---------------------------------------------------------------
+  arkInterpEvaluateBatch_Hermite:
+
+  This routine evaluates the Hermite interpolating polynomial (or
+  its derivative) at the nt values tau[i], storing the results in
+  yout[i]. The additional RHS values needed by the quartic and
+  quintic interpolants are computed once for all of the outputs
+  and the outputs are formed with fused vector operations.
+  ---------------------------------------------------------------*/
+int arkInterpEvaluateBatch_Hermite(ARKodeMem ark_mem, ARKInterp interp, int nt,
+                                   sunrealtype* tau, int d, int order,
+                                   N_Vector* yout)
+{
+  /* local variables */
+  int q, nvec, i, j, retval;
+  sunrealtype a[6];
+  sunrealtype* c;
+  N_Vector X[6];
+
+  /* determine polynomial order q */
+  q = SUNMAX(order, 0);               /* respect lower bound  */
+  q = SUNMIN(q, HINT_DEGREE(interp)); /* respect max possible */
+
+  SUNLogDebug(ARK_LOGGER, "interp-eval-batch", "nt = %i, d = %i, q = %i", nt,
+              d, q);
+
+  /* call full RHS if needed */
+  if (!(ark_mem->fn_is_current))
+  {
+    retval = ark_mem->step_fullrhs(ark_mem, ark_mem->tn, ark_mem->yn,
+                                   ark_mem->fn, ARK_FULLRHS_END);
+    if (retval) { return ARK_RHSFUNC_FAIL; }
+    ark_mem->fn_is_current = SUNTRUE;
+  }
+
+  /* error on illegal d */
+  if (d < 0)
+  {
+    arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "Requested illegal derivative.");
+    return (ARK_ILL_INPUT);
+  }
+
+  /* if d is too high, just return zeros */
+  if (d > q)
+  {
+    retval = N_VConstVectorArray(nt, ZERO, yout);
+    if (retval != 0) { return (ARK_VECTOROP_ERR); }
+    return (ARK_SUCCESS);
+  }
+
+  /* compute the additional RHS values once, using yout[0] as a workspace */
+  retval = arkInterpPrepare_Hermite(ark_mem, interp, q, yout[0]);
+  if (retval != ARK_SUCCESS) { return (retval); }
+
+  nvec = arkInterpBasis_Hermite(ark_mem, interp, q, X);
+  if (nvec == 0)
+  {
+    arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "Illegal polynomial order");
+    return (ARK_ILL_INPUT);
+  }
+
+  /* compute the coefficients for all outputs, c[j*nt+i] multiplies X[j] in
+     yout[i] */
+  c = (sunrealtype*)malloc((size_t)nvec * (size_t)nt * sizeof(sunrealtype));
+  if (c == NULL)
+  {
+    arkProcessError(ark_mem, ARK_MEM_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_MEM_FAIL);
+    return (ARK_MEM_FAIL);
+  }
+  for (i = 0; i < nt; i++)
+  {
+    arkInterpCoeffs_Hermite(tau[i], d, q, HINT_H(interp), a);
+    for (j = 0; j < nvec; j++) { c[j * nt + i] = a[j]; }
+  }
+
+  retval = arkInterpCombineBatch(nt, nvec, c, X, yout);
+  free(c);
+
+  return (retval);
+}
+
+/*---------------------------------------------------------------
+  arkInterpPrepare_Hermite:
+
+  This routine computes the RHS values at the interior points
+  needed by the quartic and quintic Hermite interpolants, storing
+  them in fa (and fb). The vector ytmp is used as a workspace.
+  ---------------------------------------------------------------*/
+int arkInterpPrepare_Hermite(ARKodeMem ark_mem, ARKInterp interp, int q,
+                             N_Vector ytmp)
+{
+  int retval;
+  sunrealtype tval, h;
+
+  h = HINT_H(interp);
+
+  if (q == 4)
+  {
+    /* first, evaluate cubic interpolant at tau=-1/3 */
+    tval   = -ONE / THREE;
+    retval = arkInterpEvaluate(ark_mem, interp, tval, 0, 3, ytmp);
+    if (retval != 0) { return (ARK_RHSFUNC_FAIL); }
+
+    /* second, evaluate RHS at tau=-1/3, storing the result in fa */
+    tval   = HINT_TNEW(interp) - h / THREE;
+    retval = ark_mem->step_fullrhs(ark_mem, tval, ytmp, HINT_FA(interp),
+                                   ARK_FULLRHS_OTHER);
+    if (retval != 0) { return (ARK_RHSFUNC_FAIL); }
+  }
+  else if (q == 5)
+  {
+    /* first, evaluate quartic interpolant at tau=-1/3 */
+    tval   = -ONE / THREE;
+    retval = arkInterpEvaluate(ark_mem, interp, tval, 0, 4, ytmp);
+    if (retval != 0) { return (ARK_RHSFUNC_FAIL); }
+
+    /* second, evaluate RHS at tau=-1/3, storing the result in fa */
+    tval   = HINT_TNEW(interp) - h / THREE;
+    retval = ark_mem->step_fullrhs(ark_mem, tval, ytmp, HINT_FA(interp),
+                                   ARK_FULLRHS_OTHER);
+    if (retval != 0) { return (ARK_RHSFUNC_FAIL); }
+
+    /* third, evaluate quartic interpolant at tau=-2/3 */
+    tval   = -TWO / THREE;
+    retval = arkInterpEvaluate(ark_mem, interp, tval, 0, 4, ytmp);
+    if (retval != 0) { return (ARK_RHSFUNC_FAIL); }
+
+    /* fourth, evaluate RHS at tau=-2/3, storing the result in fb */
+    tval   = HINT_TNEW(interp) - h * TWO / THREE;
+    retval = ark_mem->step_fullrhs(ark_mem, tval, ytmp, HINT_FB(interp),
+                                   ARK_FULLRHS_OTHER);
+    if (retval != 0) { return (ARK_RHSFUNC_FAIL); }
+  }
+
+  return (ARK_SUCCESS);
+}
+
+/*---------------------------------------------------------------
+  arkInterpBasis_Hermite:
+
+  This routine fills X with the vectors used by the Hermite
+  interpolant of order q and returns their number (0 for an
+  illegal order).
+  ---------------------------------------------------------------*/
+int arkInterpBasis_Hermite(ARKodeMem ark_mem, ARKInterp interp, int q,
+                           N_Vector* X)
+{
+  X[0] = HINT_YOLD(interp);
+  X[1] = ark_mem->yn;
+
+  switch (q)
+  {
+  case (0):
+  case (1): return (2);
+  case (2):
+    X[2] = ark_mem->fn;
+    return (3);
+  case (3):
+  case (4):
+  case (5):
+    X[2] = HINT_FOLD(interp);
+    X[3] = ark_mem->fn;
+    X[4] = HINT_FA(interp);
+    X[5] = HINT_FB(interp);
+    return (q + 1);
+  default: return (0);
+  }
+}
+
+/*---------------------------------------------------------------
+  arkInterpCoeffs_Hermite:
+
+  This routine computes the coefficients of the basis vectors
+  from arkInterpBasis_Hermite for the d-th derivative of the
+  Hermite interpolant of order q at tau.
+  ---------------------------------------------------------------*/
+void arkInterpCoeffs_Hermite(sunrealtype tau, int d, int q, sunrealtype h,
+                             sunrealtype* a)
+{
+  sunrealtype tau2, tau3, tau4, tau5;
+  sunrealtype h2, h3, h4, h5;
+
+  /* set constants */
+  tau2 = tau * tau;
+  tau3 = tau * tau2;
+  tau4 = tau * tau3;
+  tau5 = tau * tau4;
+
+  h2 = h * h;
+  h3 = h * h2;
+  h4 = h * h3;
+  h5 = h * h4;
+
   switch (q)
   {
   case (0): /* constant interpolant, yout = 0.5*(yn+yp) */
-    N_VLinearSum(HALF, HINT_YOLD(interp), HALF, ark_mem->yn, yout);
+    a[0] = HALF;
+    a[1] = HALF;
     break;
 
   case (1): /* linear interpolant */
     if (d == 0)
     {
-      a0 = -tau;
-      a1 = ONE + tau;
+      a[0] = -tau;
+      a[1] = ONE + tau;
     }
     else
     { /* d=1 */
-      a0 = -ONE / h;
-      a1 = ONE / h;
+      a[0] = -ONE / h;
+      a[1] = ONE / h;
     }
-    N_VLinearSum(a0, HINT_YOLD(interp), a1, ark_mem->yn, yout);
     break;
 
   case (2): /* quadratic interpolant */
@@ -532,11 +783,6 @@ int arkInterpEvaluate_Hermite(ARKodeMem ark_mem, ARKInterp interp,
       a[1] = -TWO / h / h;
       a[2] = TWO / h;
     }
-    X[0]   = HINT_YOLD(interp);
-    X[1]   = ark_mem->yn;
-    X[2]   = ark_mem->fn;
-    retval = N_VLinearCombination(3, a, X, yout);
-    if (retval != 0) { return (ARK_VECTOROP_ERR); }
     break;
 
   case (3): /* cubic interpolant */
@@ -568,28 +814,9 @@ int arkInterpEvaluate_Hermite(ARKodeMem ark_mem, ARKInterp interp,
       a[2] = SIX / h2;
       a[3] = SIX / h2;
     }
-    X[0]   = HINT_YOLD(interp);
-    X[1]   = ark_mem->yn;
-    X[2]   = HINT_FOLD(interp);
-    X[3]   = ark_mem->fn;
-    retval = N_VLinearCombination(4, a, X, yout);
-    if (retval != 0) { return (ARK_VECTOROP_ERR); }
     break;
 
   case (4): /* quartic interpolant */
-
-    /* first, evaluate cubic interpolant at tau=-1/3 */
-    tval   = -ONE / THREE;
-    retval = arkInterpEvaluate(ark_mem, interp, tval, 0, 3, yout);
-    if (retval != 0) { return (ARK_RHSFUNC_FAIL); }
-
-    /* second, evaluate RHS at tau=-1/3, storing the result in fa */
-    tval   = HINT_TNEW(interp) - h / THREE;
-    retval = ark_mem->step_fullrhs(ark_mem, tval, yout, HINT_FA(interp),
-                                   ARK_FULLRHS_OTHER);
-    if (retval != 0) { return (ARK_RHSFUNC_FAIL); }
-
-    /* evaluate desired function */
     if (d == 0)
     {
       a[0] = -SIX * tau2 - SUN_RCONST(16.0) * tau3 - SUN_RCONST(9.0) * tau4;
@@ -637,40 +864,9 @@ int arkInterpEvaluate_Hermite(ARKodeMem ark_mem, ARKInterp interp,
       a[3] = ZERO;
       a[4] = -SUN_RCONST(162.0) / h3;
     }
-    X[0]   = HINT_YOLD(interp);
-    X[1]   = ark_mem->yn;
-    X[2]   = HINT_FOLD(interp);
-    X[3]   = ark_mem->fn;
-    X[4]   = HINT_FA(interp);
-    retval = N_VLinearCombination(5, a, X, yout);
-    if (retval != 0) { return (ARK_VECTOROP_ERR); }
     break;
 
   case (5): /* quintic interpolant */
-
-    /* first, evaluate quartic interpolant at tau=-1/3 */
-    tval   = -ONE / THREE;
-    retval = arkInterpEvaluate(ark_mem, interp, tval, 0, 4, yout);
-    if (retval != 0) { return (ARK_RHSFUNC_FAIL); }
-
-    /* second, evaluate RHS at tau=-1/3, storing the result in fa */
-    tval   = HINT_TNEW(interp) - h / THREE;
-    retval = ark_mem->step_fullrhs(ark_mem, tval, yout, HINT_FA(interp),
-                                   ARK_FULLRHS_OTHER);
-    if (retval != 0) { return (ARK_RHSFUNC_FAIL); }
-
-    /* third, evaluate quartic interpolant at tau=-2/3 */
-    tval   = -TWO / THREE;
-    retval = arkInterpEvaluate(ark_mem, interp, tval, 0, 4, yout);
-    if (retval != 0) { return (ARK_RHSFUNC_FAIL); }
-
-    /* fourth, evaluate RHS at tau=-2/3, storing the result in fb */
-    tval   = HINT_TNEW(interp) - h * TWO / THREE;
-    retval = ark_mem->step_fullrhs(ark_mem, tval, yout, HINT_FB(interp),
-                                   ARK_FULLRHS_OTHER);
-    if (retval != 0) { return (ARK_RHSFUNC_FAIL); }
-
-    /* evaluate desired function */
     if (d == 0)
     {
       a[0] = SUN_RCONST(54.0) * tau5 + SUN_RCONST(135.0) * tau4 +
@@ -764,23 +960,10 @@ int arkInterpEvaluate_Hermite(ARKodeMem ark_mem, ARKInterp interp,
       a[4] = SUN_RCONST(2430.0) / h4;
       a[5] = a[4];
     }
-    X[0]   = HINT_YOLD(interp);
-    X[1]   = ark_mem->yn;
-    X[2]   = HINT_FOLD(interp);
-    X[3]   = ark_mem->fn;
-    X[4]   = HINT_FA(interp);
-    X[5]   = HINT_FB(interp);
-    retval = N_VLinearCombination(6, a, X, yout);
-    if (retval != 0) { return (ARK_VECTOROP_ERR); }
     break;
 
-  default:
-    arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
-                    "Illegal polynomial order");
-    return (ARK_ILL_INPUT);
+  default: break;
   }
-
-  return (ARK_SUCCESS);
 }
 
 /*---------------------------------------------------------------
@@ -816,13 +999,14 @@ ARKInterp arkInterpCreate_Lagrange(ARKodeMem ark_mem, int degree)
     free(interp);
     return (NULL);
   }
-  ops->resize    = arkInterpResize_Lagrange;
-  ops->free      = arkInterpFree_Lagrange;
-  ops->print     = arkInterpPrintMem_Lagrange;
-  ops->setdegree = arkInterpSetDegree_Lagrange;
-  ops->init      = arkInterpInit_Lagrange;
-  ops->update    = arkInterpUpdate_Lagrange;
-  ops->evaluate  = arkInterpEvaluate_Lagrange;
+  ops->resize        = arkInterpResize_Lagrange;
+  ops->free          = arkInterpFree_Lagrange;
+  ops->print         = arkInterpPrintMem_Lagrange;
+  ops->setdegree     = arkInterpSetDegree_Lagrange;
+  ops->init          = arkInterpInit_Lagrange;
+  ops->update        = arkInterpUpdate_Lagrange;
+  ops->evaluate      = arkInterpEvaluate_Lagrange;
+  ops->evaluatebatch = arkInterpEvaluateBatch_Lagrange;
 
   /* create content, and initialize everything to zero/NULL */
   content = NULL;
@@ -1284,6 +1468,102 @@ int arkInterpEvaluate_Lagrange(ARKodeMem ark_mem, ARKInterp I, sunrealtype tau,
   return (ARK_SUCCESS);
 }
 
+/*---------------------------------------------------------------
+  arkInterpEvaluateBatch_Lagrange
+
+  This routine evaluates the Lagrange polynomial (or its
+  derivative) at the nt values tau[i], storing the results in
+  yout[i]. The input tau values are defined as in
+  arkInterpEvaluate_Lagrange.
+  ---------------------------------------------------------------*/
+int arkInterpEvaluateBatch_Lagrange(ARKodeMem ark_mem, ARKInterp I, int nt,
+                                    sunrealtype* tau, int deriv, int degree,
+                                    N_Vector* yout)
+{
+  /* local variables */
+  int q, retval, i, j;
+  sunrealtype tval;
+  sunrealtype* c;
+  int nhist;
+  sunrealtype* thist;
+  N_Vector* yhist;
+
+  /* set readability shortcuts */
+  nhist = LINT_NHIST(I);
+  thist = LINT_THIST(I);
+  yhist = LINT_YHIST(I);
+
+  /* determine polynomial degree q */
+  q = SUNMAX(degree, 0);    /* respect lower bound */
+  q = SUNMIN(q, nhist - 1); /* respect max possible */
+
+  SUNLogDebug(ARK_LOGGER, "interp-eval-batch", "nt = %i, d = %i, q = %i", nt,
+              deriv, q);
+
+  /* error on illegal deriv */
+  if ((deriv < 0) || (deriv > 3))
+  {
+    arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "Requested illegal derivative.");
+    return (ARK_ILL_INPUT);
+  }
+
+  /* if deriv is too high, just return zeros */
+  if (deriv > q)
+  {
+    retval = N_VConstVectorArray(nt, ZERO, yout);
+    if (retval != 0) { return (ARK_VECTOROP_ERR); }
+    return (ARK_SUCCESS);
+  }
+
+  /* compute the coefficients for all outputs, c[j*nt+i] multiplies yhist[j]
+     in yout[i] */
+  c = (sunrealtype*)malloc((size_t)(q + 1) * (size_t)nt * sizeof(sunrealtype));
+  if (c == NULL)
+  {
+    arkProcessError(ark_mem, ARK_MEM_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_MEM_FAIL);
+    return (ARK_MEM_FAIL);
+  }
+
+  for (i = 0; i < nt; i++)
+  {
+    /* constant interpolant, just return ynew */
+    if (q == 0)
+    {
+      c[i] = ONE;
+      continue;
+    }
+
+    /* convert from tau back to t */
+    tval = thist[0] + tau[i] * (thist[0] - thist[1]);
+
+    switch (deriv)
+    {
+    case (0): /* p(t) */
+      for (j = 0; j < q + 1; j++) { c[j * nt + i] = LBasis(I, j, tval); }
+      break;
+
+    case (1): /* p'(t) */
+      for (j = 0; j < q + 1; j++) { c[j * nt + i] = LBasisD(I, j, tval); }
+      break;
+
+    case (2): /* p''(t) */
+      for (j = 0; j < q + 1; j++) { c[j * nt + i] = LBasisD2(I, j, tval); }
+      break;
+
+    case (3): /* p'''(t) */
+      for (j = 0; j < q + 1; j++) { c[j * nt + i] = LBasisD3(I, j, tval); }
+      break;
+    }
+  }
+
+  retval = arkInterpCombineBatch(nt, q + 1, c, yhist, yout);
+  free(c);
+
+  return (retval);
+}
+
 /* Lagrange utility routines (basis functions and their derivatives) */
 sunrealtype LBasis(ARKInterp I, int j, sunrealtype t)
 {
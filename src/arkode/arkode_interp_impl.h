@@ -87,6 +87,17 @@ int arkInterpUpdate_Hermite(ARKodeMem ark_mem, ARKInterp interp,
                             sunrealtype tnew);
 int arkInterpEvaluate_Hermite(ARKodeMem ark_mem, ARKInterp interp,
                               sunrealtype tau, int d, int order, N_Vector yout);
+int arkInterpEvaluateBatch_Hermite(ARKodeMem ark_mem, ARKInterp interp, int nt,
+                                   sunrealtype* tau, int d, int order,
+                                   N_Vector* yout);
+
+/* Hermite structure utility routines */
+int arkInterpPrepare_Hermite(ARKodeMem ark_mem, ARKInterp interp, int q,
+                             N_Vector ytmp);
+int arkInterpBasis_Hermite(ARKodeMem ark_mem, ARKInterp interp, int q,
+                           N_Vector* X);
+void arkInterpCoeffs_Hermite(sunrealtype tau, int d, int q, sunrealtype h,
+                             sunrealtype* a);
 
 /*===============================================================
   ARKODE Lagrange Temporal Interpolation Data Structure
@@ -133,6 +144,9 @@ int arkInterpUpdate_Lagrange(ARKodeMem ark_mem, ARKInterp interp,
                              sunrealtype tnew);
 int arkInterpEvaluate_Lagrange(ARKodeMem ark_mem, ARKInterp interp,
                                sunrealtype tau, int d, int order, N_Vector yout);
+int arkInterpEvaluateBatch_Lagrange(ARKodeMem ark_mem, ARKInterp interp, int nt,
+                                    sunrealtype* tau, int d, int order,
+                                    N_Vector* yout);
 
 /* Lagrange structure utility routines */
 sunrealtype LBasis(ARKInterp interp, int idx, sunrealtype t);
@@ -0,0 +1,494 @@
+/*---------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2025-2026, Lawrence Livermore National Security,
+ * University of Maryland Baltimore County, and the SUNDIALS contributors.
+ * Copyright (c) 2013-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * Copyright (c) 2002-2013, Lawrence Livermore National Security.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ *---------------------------------------------------------------
+ * Implementation file for the low-storage explicit Runge--Kutta
+ * tables used by ERKStep.
+ *--------------------------------------------------------------*/
+
+#include <arkode/arkode.h>
+#include <arkode/arkode_lowstorage.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sundials/sundials_math.h>
+#include <sundials/sundials_types.h>
+
+#include "arkode_impl.h"
+
+/* Private utility routines */
+static ARKodeLowStorageTable arkLowStorageTable_Alloc(
+  int s, ARKODE_LowStorageType type, sunbooleantype embedded);
+static int arkLowStorageTable_ButcherForm(ARKodeLowStorageTable L,
+                                          sunrealtype* A, sunrealtype* b,
+                                          sunrealtype* bhat);
+static void arkLowStorageTable_WriteArray(FILE* outfile, const char* name,
+                                          const sunrealtype* v, int n);
+
+/*---------------------------------------------------------------
+  Williamson's three stage, third order 2N method:
+
+  J. H. Williamson, Low-storage Runge-Kutta schemes, Journal of
+  Computational Physics, 35 (1980), pp. 48-56.
+  ---------------------------------------------------------------*/
+static ARKodeLowStorageTable arkLowStorageWilliamson33(void)
+{
+  const sunrealtype c[] = {SUN_RCONST(0.0), SUN_RCONST(1.0) / SUN_RCONST(3.0),
+                           SUN_RCONST(3.0) / SUN_RCONST(4.0)};
+  const sunrealtype A[] = {SUN_RCONST(0.0), -SUN_RCONST(5.0) / SUN_RCONST(9.0),
+                           -SUN_RCONST(153.0) / SUN_RCONST(128.0)};
+  const sunrealtype B[] = {SUN_RCONST(1.0) / SUN_RCONST(3.0),
+                           SUN_RCONST(15.0) / SUN_RCONST(16.0),
+                           SUN_RCONST(8.0) / SUN_RCONST(15.0)};
+  return ARKodeLowStorageTable_Create2N(3, 3, 0, c, A, B, NULL);
+}
+
+/*---------------------------------------------------------------
+  Carpenter and Kennedy's five stage, fourth order 2N method:
+
+  M. H. Carpenter and C. A. Kennedy, Fourth-order 2N-storage
+  Runge-Kutta schemes, NASA TM-109112, 1994.
+
+  The third order embedding skips the second stage and was
+  derived from the Butcher form of the method.
+  ---------------------------------------------------------------*/
+static ARKodeLowStorageTable arkLowStorageCarpenterKennedy534(void)
+{
+  const sunrealtype c[] =
+    {SUN_RCONST(0.0),
+     SUN_RCONST(1432997174477.0) / SUN_RCONST(9575080441755.0),
+     SUN_RCONST(2526269341429.0) / SUN_RCONST(6820363962896.0),
+     SUN_RCONST(2006345519317.0) / SUN_RCONST(3224310063776.0),
+     SUN_RCONST(2802321613138.0) / SUN_RCONST(2924317926251.0)};
+  const sunrealtype A[] =
+    {SUN_RCONST(0.0),
+     -SUN_RCONST(567301805773.0) / SUN_RCONST(1357537059087.0),
+     -SUN_RCONST(2404267990393.0) / SUN_RCONST(2016746695238.0),
+     -SUN_RCONST(3550918686646.0) / SUN_RCONST(2091501179385.0),
+     -SUN_RCONST(1275806237668.0) / SUN_RCONST(842570457699.0)};
+  const sunrealtype B[] =
+    {SUN_RCONST(1432997174477.0) / SUN_RCONST(9575080441755.0),
+     SUN_RCONST(5161836677717.0) / SUN_RCONST(13612068292357.0),
+     SUN_RCONST(1720146321549.0) / SUN_RCONST(2090206949498.0),
+     SUN_RCONST(3134564353537.0) / SUN_RCONST(4481467310338.0),
+     SUN_RCONST(2277821191437.0) / SUN_RCONST(14882151754819.0)};
+  const sunrealtype bhat[] = {SUN_RCONST(0.165928544865089340945667156152),
+                              SUN_RCONST(0.0),
+                              SUN_RCONST(0.272984942778249321272952870856),
+                              SUN_RCONST(0.413042177972610468982042087121),
+                              SUN_RCONST(0.148044334384050868799337885871)};
+  return ARKodeLowStorageTable_Create2N(5, 4, 3, c, A, B, bhat);
+}
+
+/*---------------------------------------------------------------
+  The three stage, third order SSP method of Shu and Osher in
+  3S* form with the second order Heun embedding:
+
+  D. I. Ketcheson, Runge-Kutta methods with minimum storage
+  implementations, Journal of Computational Physics, 229 (2010),
+  pp. 1763-1773.
+  ---------------------------------------------------------------*/
+static ARKodeLowStorageTable arkLowStorageSSP323(void)
+{
+  const sunrealtype c[]      = {SUN_RCONST(0.0), SUN_RCONST(1.0),
+                                SUN_RCONST(0.5)};
+  const sunrealtype gamma1[] = {SUN_RCONST(1.0), SUN_RCONST(0.25),
+                                SUN_RCONST(2.0) / SUN_RCONST(3.0)};
+  const sunrealtype gamma2[] = {SUN_RCONST(0.0), SUN_RCONST(0.0),
+                                SUN_RCONST(0.0)};
+  const sunrealtype gamma3[] = {SUN_RCONST(0.0), SUN_RCONST(0.75),
+                                SUN_RCONST(1.0) / SUN_RCONST(3.0)};
+  const sunrealtype beta[]   = {SUN_RCONST(1.0), SUN_RCONST(0.25),
+                                SUN_RCONST(2.0) / SUN_RCONST(3.0)};
+  const sunrealtype delta[]  = {-SUN_RCONST(1.0), SUN_RCONST(0.0),
+                                SUN_RCONST(2.0), SUN_RCONST(0.0),
+                                SUN_RCONST(0.0)};
+  return ARKodeLowStorageTable_Create3Sstar(3, 3, 2, c, gamma1, gamma2, gamma3,
+                                            beta, delta);
+}
+
+/*---------------------------------------------------------------
+  The classical four stage, fourth order method in 2S* form (a
+  3S* method that only uses the third register to hold y_n).
+  ---------------------------------------------------------------*/
+static ARKodeLowStorageTable arkLowStorageRK444(void)
+{
+  const sunrealtype c[]      = {SUN_RCONST(0.0), SUN_RCONST(0.5),
+                                SUN_RCONST(0.5), SUN_RCONST(1.0)};
+  const sunrealtype gamma1[] = {SUN_RCONST(1.0), SUN_RCONST(0.0),
+                                SUN_RCONST(0.0),
+                                SUN_RCONST(1.0) / SUN_RCONST(3.0)};
+  const sunrealtype gamma2[] = {SUN_RCONST(0.0), SUN_RCONST(0.0),
+                                SUN_RCONST(0.0), SUN_RCONST(1.0)};
+  const sunrealtype gamma3[] = {SUN_RCONST(0.0), SUN_RCONST(1.0),
+                                SUN_RCONST(1.0),
+                                -SUN_RCONST(1.0) / SUN_RCONST(3.0)};
+  const sunrealtype beta[]   = {SUN_RCONST(0.5), SUN_RCONST(0.5),
+                                SUN_RCONST(1.0),
+                                SUN_RCONST(1.0) / SUN_RCONST(6.0)};
+  const sunrealtype delta[]  = {SUN_RCONST(0.0),
+                                SUN_RCONST(1.0) / SUN_RCONST(3.0),
+                                SUN_RCONST(2.0) / SUN_RCONST(3.0),
+                                SUN_RCONST(0.0),
+                                SUN_RCONST(0.0),
+                                SUN_RCONST(0.0)};
+  return ARKodeLowStorageTable_Create3Sstar(4, 4, 0, c, gamma1, gamma2, gamma3,
+                                            beta, delta);
+}
+
+/*===============================================================
+  Exported functions
+  ===============================================================*/
+
+ARKodeLowStorageTable ARKodeLowStorageTable_Create2N(
+  int s, int q, int p, const sunrealtype* c, const sunrealtype* A,
+  const sunrealtype* B, const sunrealtype* bhat)
+{
+  int i;
+  ARKodeLowStorageTable L;
+  sunrealtype* Abut;
+
+  if (s < 1 || !c || !A || !B) { return NULL; }
+  if (p > 0 && !bhat) { return NULL; }
+
+  L = arkLowStorageTable_Alloc(s, ARKODE_LOWSTORAGE_2N, (p > 0));
+  if (!L) { return NULL; }
+
+  L->q = q;
+  L->p = (p > 0) ? p : 0;
+
+  for (i = 0; i < s; i++)
+  {
+    L->c[i] = c[i];
+    L->A[i] = A[i];
+    L->B[i] = B[i];
+    if (L->bhat) { L->bhat[i] = bhat[i]; }
+  }
+
+  /* the solution weights are needed by the embedded error estimate */
+  Abut = (sunrealtype*)malloc(s * s * sizeof(sunrealtype));
+  if (!Abut)
+  {
+    ARKodeLowStorageTable_Free(L);
+    return NULL;
+  }
+  if (arkLowStorageTable_ButcherForm(L, Abut, L->b, NULL))
+  {
+    free(Abut);
+    ARKodeLowStorageTable_Free(L);
+    return NULL;
+  }
+  free(Abut);
+
+  return L;
+}
+
+ARKodeLowStorageTable ARKodeLowStorageTable_Create3Sstar(
+  int s, int q, int p, const sunrealtype* c, const sunrealtype* gamma1,
+  const sunrealtype* gamma2, const sunrealtype* gamma3,
+  const sunrealtype* beta, const sunrealtype* delta)
+{
+  int i;
+  ARKodeLowStorageTable L;
+
+  if (s < 1 || !c || !gamma1 || !gamma2 || !gamma3 || !beta || !delta)
+  {
+    return NULL;
+  }
+
+  L = arkLowStorageTable_Alloc(s, ARKODE_LOWSTORAGE_3SSTAR, SUNFALSE);
+  if (!L) { return NULL; }
+
+  L->q = q;
+  L->p = (p > 0) ? p : 0;
+
+  for (i = 0; i < s; i++)
+  {
+    L->c[i]      = c[i];
+    L->gamma1[i] = gamma1[i];
+    L->gamma2[i] = gamma2[i];
+    L->gamma3[i] = gamma3[i];
+    L->beta[i]   = beta[i];
+  }
+  for (i = 0; i < s + 2; i++) { L->delta[i] = delta[i]; }
+
+  return L;
+}
+
+ARKodeLowStorageTable ARKodeLowStorageTable_Load(ARKODE_LowStorageTableID id)
+{
+  switch (id)
+  {
+  case ARKODE_LOWSTORAGE_WILLIAMSON_3_3: return arkLowStorageWilliamson33();
+  case ARKODE_LOWSTORAGE_CARPENTER_KENNEDY_5_3_4:
+    return arkLowStorageCarpenterKennedy534();
+  case ARKODE_LOWSTORAGE_SSP_3_2_3: return arkLowStorageSSP323();
+  case ARKODE_LOWSTORAGE_RK4_4_4: return arkLowStorageRK444();
+  default: return NULL;
+  }
+}
+
+ARKodeLowStorageTable ARKodeLowStorageTable_LoadByName(const char* method)
+{
+  if (!method) { return NULL; }
+  if (!strcmp(method, "ARKODE_LOWSTORAGE_WILLIAMSON_3_3"))
+  {
+    return arkLowStorageWilliamson33();
+  }
+  if (!strcmp(method, "ARKODE_LOWSTORAGE_CARPENTER_KENNEDY_5_3_4"))
+  {
+    return arkLowStorageCarpenterKennedy534();
+  }
+  if (!strcmp(method, "ARKODE_LOWSTORAGE_SSP_3_2_3"))
+  {
+    return arkLowStorageSSP323();
+  }
+  if (!strcmp(method, "ARKODE_LOWSTORAGE_RK4_4_4"))
+  {
+    return arkLowStorageRK444();
+  }
+  return NULL;
+}
+
+ARKodeLowStorageTable ARKodeLowStorageTable_Copy(ARKodeLowStorageTable L)
+{
+  if (!L) { return NULL; }
+  if (L->type == ARKODE_LOWSTORAGE_2N)
+  {
+    return ARKodeLowStorageTable_Create2N(L->stages, L->q, L->p, L->c, L->A,
+                                          L->B, L->bhat);
+  }
+  return ARKodeLowStorageTable_Create3Sstar(L->stages, L->q, L->p, L->c,
+                                            L->gamma1, L->gamma2, L->gamma3,
+                                            L->beta, L->delta);
+}
+
+void ARKodeLowStorageTable_Free(ARKodeLowStorageTable L)
+{
+  if (L)
+  {
+    if (L->c) { free(L->c); }
+    if (L->A) { free(L->A); }
+    if (L->B) { free(L->B); }
+    if (L->b) { free(L->b); }
+    if (L->bhat) { free(L->bhat); }
+    if (L->gamma1) { free(L->gamma1); }
+    if (L->gamma2) { free(L->gamma2); }
+    if (L->gamma3) { free(L->gamma3); }
+    if (L->beta) { free(L->beta); }
+    if (L->delta) { free(L->delta); }
+    free(L);
+  }
+}
+
+void ARKodeLowStorageTable_Write(ARKodeLowStorageTable L, FILE* outfile)
+{
+  if (!L || !outfile) { return; }
+
+  fprintf(outfile, "  type = %s\n",
+          (L->type == ARKODE_LOWSTORAGE_2N) ? "2N" : "3S*");
+  fprintf(outfile, "  q = %i, p = %i, stages = %i\n", L->q, L->p, L->stages);
+  arkLowStorageTable_WriteArray(outfile, "c", L->c, L->stages);
+  if (L->type == ARKODE_LOWSTORAGE_2N)
+  {
+    arkLowStorageTable_WriteArray(outfile, "A", L->A, L->stages);
+    arkLowStorageTable_WriteArray(outfile, "B", L->B, L->stages);
+    if (L->bhat)
+    {
+      arkLowStorageTable_WriteArray(outfile, "bhat", L->bhat, L->stages);
+    }
+  }
+  else
+  {
+    arkLowStorageTable_WriteArray(outfile, "gamma1", L->gamma1, L->stages);
+    arkLowStorageTable_WriteArray(outfile, "gamma2", L->gamma2, L->stages);
+    arkLowStorageTable_WriteArray(outfile, "gamma3", L->gamma3, L->stages);
+    arkLowStorageTable_WriteArray(outfile, "beta", L->beta, L->stages);
+    arkLowStorageTable_WriteArray(outfile, "delta", L->delta, L->stages + 2);
+  }
+}
+
+/*---------------------------------------------------------------
+  ARKodeLowStorageTable_ToButcher:
+
+  Converts a low-storage table to the equivalent explicit Butcher
+  table (with embedding when p > 0).
+  ---------------------------------------------------------------*/
+int ARKodeLowStorageTable_ToButcher(ARKodeLowStorageTable L,
+                                    ARKodeButcherTable* B_ptr)
+{
+  int i, j, s;
+  sunrealtype* A;
+  ARKodeButcherTable B;
+
+  if (!L || !B_ptr) { return ARK_ILL_INPUT; }
+  s = L->stages;
+
+  B = ARKodeButcherTable_Alloc(s, (L->p > 0));
+  if (!B) { return ARK_MEM_FAIL; }
+
+  A = (sunrealtype*)malloc(s * s * sizeof(sunrealtype));
+  if (!A)
+  {
+    ARKodeButcherTable_Free(B);
+    return ARK_MEM_FAIL;
+  }
+
+  if (arkLowStorageTable_ButcherForm(L, A, B->b, B->d))
+  {
+    free(A);
+    ARKodeButcherTable_Free(B);
+    return ARK_MEM_FAIL;
+  }
+  for (i = 0; i < s; i++)
+  {
+    B->c[i] = L->c[i];
+    for (j = 0; j < s; j++) { B->A[i][j] = A[i * s + j]; }
+  }
+  B->q = L->q;
+  B->p = L->p;
+
+  free(A);
+
+  *B_ptr = B;
+  return ARK_SUCCESS;
+}
+
+/*===============================================================
+  Private utility routines
+  ===============================================================*/
+
+static ARKodeLowStorageTable arkLowStorageTable_Alloc(
+  int s, ARKODE_LowStorageType type, sunbooleantype embedded)
+{
+  ARKodeLowStorageTable L;
+  sunbooleantype ok;
+
+  L = (ARKodeLowStorageTable)malloc(sizeof(struct ARKodeLowStorageTableMem));
+  if (!L) { return NULL; }
+  memset(L, 0, sizeof(struct ARKodeLowStorageTableMem));
+
+  L->type   = type;
+  L->stages = s;
+
+  L->c = (sunrealtype*)calloc(s, sizeof(sunrealtype));
+  ok   = (L->c != NULL);
+  if (type == ARKODE_LOWSTORAGE_2N)
+  {
+    L->A = (sunrealtype*)calloc(s, sizeof(sunrealtype));
+    L->B = (sunrealtype*)calloc(s, sizeof(sunrealtype));
+    L->b = (sunrealtype*)calloc(s, sizeof(sunrealtype));
+    ok   = ok && L->A && L->B && L->b;
+    if (embedded)
+    {
+      L->bhat = (sunrealtype*)calloc(s, sizeof(sunrealtype));
+      ok      = ok && L->bhat;
+    }
+  }
+  else
+  {
+    L->gamma1 = (sunrealtype*)calloc(s, sizeof(sunrealtype));
+    L->gamma2 = (sunrealtype*)calloc(s, sizeof(sunrealtype));
+    L->gamma3 = (sunrealtype*)calloc(s, sizeof(sunrealtype));
+    L->beta   = (sunrealtype*)calloc(s, sizeof(sunrealtype));
+    L->delta  = (sunrealtype*)calloc(s + 2, sizeof(sunrealtype));
+    ok = ok && L->gamma1 && L->gamma2 && L->gamma3 && L->beta && L->delta;
+  }
+
+  if (!ok)
+  {
+    ARKodeLowStorageTable_Free(L);
+    return NULL;
+  }
+
+  return L;
+}
+
+/*---------------------------------------------------------------
+  arkLowStorageTable_ButcherForm:
+
+  Runs the low-storage recurrences symbolically, tracking each
+  register as a linear combination of y_n and h F_0, ..., h F_{s-1},
+  to recover the Butcher coefficients A (row-major, s x s), the
+  solution weights b, and (if requested and available) the
+  embedding weights bhat.
+  ---------------------------------------------------------------*/
+static int arkLowStorageTable_ButcherForm(ARKodeLowStorageTable L,
+                                          sunrealtype* A, sunrealtype* b,
+                                          sunrealtype* bhat)
+{
+  int i, k, s, n;
+  sunrealtype *S1, *S2, dsum;
+
+  s = L->stages;
+  n = s + 1; /* entry 0 is the y_n coefficient */
+
+  S1 = (sunrealtype*)calloc(2 * n, sizeof(sunrealtype));
+  if (!S1) { return ARK_MEM_FAIL; }
+  S2 = S1 + n;
+
+  /* S1 holds the stage value and S2 the second register (dQ for 2N) */
+  S1[0] = ONE;
+  for (i = 0; i < s; i++)
+  {
+    for (k = 0; k < s; k++) { A[i * s + k] = S1[k + 1]; }
+
+    if (L->type == ARKODE_LOWSTORAGE_2N)
+    {
+      for (k = 0; k < n; k++) { S2[k] *= L->A[i]; }
+      S2[i + 1] += ONE;
+      for (k = 0; k < n; k++) { S1[k] += L->B[i] * S2[k]; }
+    }
+    else
+    {
+      for (k = 0; k < n; k++) { S2[k] += L->delta[i] * S1[k]; }
+      for (k = 0; k < n; k++)
+      {
+        S1[k] = L->gamma1[i] * S1[k] + L->gamma2[i] * S2[k];
+      }
+      S1[0] += L->gamma3[i];
+      S1[i + 1] += L->beta[i];
+    }
+  }
+  for (k = 0; k < s; k++) { b[k] = S1[k + 1]; }
+
+  if (bhat && L->p > 0)
+  {
+    if (L->type == ARKODE_LOWSTORAGE_2N)
+    {
+      for (k = 0; k < s; k++) { bhat[k] = L->bhat[k]; }
+    }
+    else
+    {
+      /* yhat = (S2 + delta_s S1 + delta_{s+1} y_n) / sum(delta) */
+      dsum = ZERO;
+      for (k = 0; k < s + 2; k++) { dsum += L->delta[k]; }
+      for (k = 0; k < s; k++)
+      {
+        bhat[k] = (S2[k + 1] + L->delta[s] * S1[k + 1]) / dsum;
+      }
+    }
+  }
+
+  free(S1);
+  return ARK_SUCCESS;
+}
+
+static void arkLowStorageTable_WriteArray(FILE* outfile, const char* name,
+                                          const sunrealtype* v, int n)
+{
+  int i;
+  fprintf(outfile, "  %s = ", name);
+  for (i = 0; i < n; i++) { fprintf(outfile, SUN_FORMAT_E "  ", v[i]); }
+  fprintf(outfile, "\n");
+}
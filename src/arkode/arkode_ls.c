@@ -22,6 +22,7 @@
 #include <string.h>
 #include <sundials/sundials_math.h>
 #include <sunmatrix/sunmatrix_band.h>
+#include <sunmatrix/sunmatrix_blockdense.h>
 #include <sunmatrix/sunmatrix_dense.h>
 #include <sunmatrix/sunmatrix_sparse.h>
 
@@ -191,6 +192,7 @@ int ARKodeSetLinearSolver(void* arkode_mem, SUNLinearSolver LS, SUNMatrix A)
   arkls_mem->jtsetup  = NULL;
   arkls_mem->jtimes   = arkLsDQJtimes;
   arkls_mem->Jt_data  = ark_mem;
+  arkls_mem->Jt_dir   = NULL;
   arkls_mem->Jt_f     = ark_mem->step_getimplicitrhs(ark_mem);
 
   if (arkls_mem->Jt_f == NULL)
@@ -221,6 +223,13 @@ int ARKodeSetLinearSolver(void* arkode_mem, SUNLinearSolver LS, SUNMatrix A)
   arkls_mem->eplifac   = ARKLS_EPLIN;
   arkls_mem->last_flag = ARKLS_SUCCESS;
 
+  /* Disable reuse of J/P data after a reset */
+  arkls_mem->jcached     = SUNFALSE;
+  arkls_mem->dtmax_reuse = ZERO;
+  arkls_mem->dgmax_reuse = ZERO;
+  arkls_mem->tnlj        = ZERO;
+  arkls_mem->gamlj       = ZERO;
+
   /* If LS supports ATimes, attach ARKLs routine */
   if (LS->ops->setatimes)
   {
@@ -595,6 +604,85 @@ int ARKodeSetJacFn(void* arkode_mem, ARKLsJacFn jac)
   arkls_mem->linsys      = arkLsLinSys;
   arkls_mem->A_data      = ark_mem;
 
+  /* data from a previous Jacobian function can not be reused */
+  arkls_mem->jcached = SUNFALSE;
+
+  return (ARKLS_SUCCESS);
+}
+
+/*---------------------------------------------------------------
+  ARKodeSetJacSparsityPattern specifies the sparsity pattern of
+  the Jacobian for the sparse difference quotient approximation.
+  The column coloring is computed here and reused until a
+  different pattern is supplied. A NULL input removes any stored
+  pattern.
+  ---------------------------------------------------------------*/
+int ARKodeSetJacSparsityPattern(void* arkode_mem, SUNMatrix S)
+{
+  ARKodeMem ark_mem;
+  ARKLsMem arkls_mem;
+  SUNErrCode err;
+  int retval;
+
+  /* Return immediately if arkode_mem is NULL */
+  if (arkode_mem == NULL)
+  {
+    arkProcessError(NULL, ARK_MEM_NULL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_NO_MEM);
+    return (ARK_MEM_NULL);
+  }
+  ark_mem = (ARKodeMem)arkode_mem;
+
+  /* Guard against use for time steppers that do not need an algebraic solver */
+  if (!ark_mem->step_supports_implicit)
+  {
+    arkProcessError(ark_mem, ARK_STEPPER_UNSUPPORTED, __LINE__, __func__,
+                    __FILE__, "time-stepping module does not require an algebraic solver");
+    return (ARK_STEPPER_UNSUPPORTED);
+  }
+
+  /* access ARKLsMem structure */
+  retval = arkLs_AccessLMem(ark_mem, __func__, &arkls_mem);
+  if (retval != ARK_SUCCESS) { return (retval); }
+
+  /* remove the stored pattern */
+  if (S == NULL)
+  {
+    SUNSparseDQ_Destroy(&(arkls_mem->sdq));
+    return (ARKLS_SUCCESS);
+  }
+
+  /* the pattern is only used with a sparse system matrix */
+  if ((arkls_mem->A == NULL) ||
+      (SUNMatGetID(arkls_mem->A) != SUNMATRIX_SPARSE) ||
+      (SUNMatGetID(S) != SUNMATRIX_SPARSE))
+  {
+    arkProcessError(ark_mem, ARKLS_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "Sparsity pattern requires sparse SUNMatrix inputs");
+    return (ARKLS_ILL_INPUT);
+  }
+
+  /* keep the existing coloring if the pattern is unchanged */
+  if (SUNSparseDQ_SamePattern(arkls_mem->sdq, S)) { return (ARKLS_SUCCESS); }
+
+  SUNSparseDQ_Destroy(&(arkls_mem->sdq));
+
+  err = SUNSparseDQ_Create(S, &(arkls_mem->sdq));
+  if (err == SUN_ERR_MALLOC_FAIL)
+  {
+    arkProcessError(ark_mem, ARKLS_MEM_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_LS_MEM_FAIL);
+    return (ARKLS_MEM_FAIL);
+  }
+  if (!err) { err = SUNSparseDQ_CheckMatrix(arkls_mem->sdq, arkls_mem->A); }
+  if (err)
+  {
+    SUNSparseDQ_Destroy(&(arkls_mem->sdq));
+    arkProcessError(ark_mem, ARKLS_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "Sparsity pattern is incompatible with the system matrix");
+    return (ARKLS_ILL_INPUT);
+  }
+
   return (ARKLS_SUCCESS);
 }
 
@@ -784,6 +872,49 @@ int ARKodeSetJacEvalFrequency(void* arkode_mem, long int msbj)
   return (ARKLS_SUCCESS);
 }
 
+/*---------------------------------------------------------------
+  ARKodeSetJacReuseOnReset allows the Jacobian and/or
+  preconditioner data from before a call to ARKodeReset to be
+  reused in the first step after it. The data is reused if the
+  last update was at a time within dtmax of the reset time and,
+  if dgmax > 0, the gamma ratio satisfies |gamma/gamlj-1| <= dgmax.
+  A value dtmax <= 0 disables reuse (the default).
+  ---------------------------------------------------------------*/
+int ARKodeSetJacReuseOnReset(void* arkode_mem, sunrealtype dtmax,
+                             sunrealtype dgmax)
+{
+  ARKodeMem ark_mem;
+  ARKLsMem arkls_mem;
+  int retval;
+
+  /* Return immediately if arkode_mem is NULL */
+  if (arkode_mem == NULL)
+  {
+    arkProcessError(NULL, ARK_MEM_NULL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_NO_MEM);
+    return (ARK_MEM_NULL);
+  }
+  ark_mem = (ARKodeMem)arkode_mem;
+
+  /* Guard against use for time steppers that do not need an algebraic solver */
+  if (!ark_mem->step_supports_implicit)
+  {
+    arkProcessError(ark_mem, ARK_STEPPER_UNSUPPORTED, __LINE__, __func__,
+                    __FILE__, "time-stepping module does not require an algebraic solver");
+    return (ARK_STEPPER_UNSUPPORTED);
+  }
+
+  /* access ARKLsMem structure */
+  retval = arkLs_AccessLMem(ark_mem, __func__, &arkls_mem);
+  if (retval != ARK_SUCCESS) { return (retval); }
+
+  /* store inputs, non-positive values disable the corresponding test */
+  arkls_mem->dtmax_reuse = (dtmax <= ZERO) ? ZERO : dtmax;
+  arkls_mem->dgmax_reuse = (dgmax <= ZERO) ? ZERO : dgmax;
+
+  return (ARKLS_SUCCESS);
+}
+
 /*---------------------------------------------------------------
   ARKodeSetLinearSolutionScaling enables or disables scaling the
   linear solver solution to account for changes in gamma.
@@ -871,6 +1002,9 @@ int ARKodeSetPreconditioner(void* arkode_mem, ARKLsPrecSetupFn psetup,
   arkls_mem->pset   = psetup;
   arkls_mem->psolve = psolve;
 
+  /* data from a previous preconditioner can not be reused */
+  arkls_mem->jcached = SUNFALSE;
+
   /* notify linear solver to call ARKLs interface routines */
   arkls_psetup = (psetup == NULL) ? NULL : arkLsPSetup;
   arkls_psolve = (psolve == NULL) ? NULL : arkLsPSolve;
@@ -950,6 +1084,79 @@ int ARKodeSetJacTimes(void* arkode_mem, ARKLsJacTimesSetupFn jtsetup,
       return (ARKLS_ILL_INPUT);
     }
   }
+  arkls_mem->Jt_dir = NULL;
+
+  return (ARKLS_SUCCESS);
+}
+
+/*---------------------------------------------------------------
+  ARKodeSetJacTimesDirDeriv specifies a user-supplied function
+  computing the exact directional derivative of the implicit
+  ODE right-hand side, e.g., by forward mode automatic
+  differentiation or dual numbers, to use in place of the
+  internal finite difference Jacobian-vector product.
+  ---------------------------------------------------------------*/
+int ARKodeSetJacTimesDirDeriv(void* arkode_mem, ARKLsJacTimesDirDerivFn jtdir)
+{
+  ARKodeMem ark_mem;
+  ARKLsMem arkls_mem;
+  int retval;
+
+  /* Return immediately if arkode_mem is NULL */
+  if (arkode_mem == NULL)
+  {
+    arkProcessError(NULL, ARK_MEM_NULL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_NO_MEM);
+    return (ARK_MEM_NULL);
+  }
+  ark_mem = (ARKodeMem)arkode_mem;
+
+  /* Guard against use for time steppers that do not need an algebraic solver */
+  if (!ark_mem->step_supports_implicit)
+  {
+    arkProcessError(ark_mem, ARK_STEPPER_UNSUPPORTED, __LINE__, __func__,
+                    __FILE__, "time-stepping module does not require an algebraic solver");
+    return (ARK_STEPPER_UNSUPPORTED);
+  }
+
+  /* access ARKLsMem structure */
+  retval = arkLs_AccessLMem(ark_mem, __func__, &arkls_mem);
+  if (retval != ARK_SUCCESS) { return (retval); }
+
+  /* issue error if LS object does not allow user-supplied ATimes */
+  if (arkls_mem->LS->ops->setatimes == NULL)
+  {
+    arkProcessError(ark_mem, ARKLS_ILL_INPUT, __LINE__, __func__,
+                    __FILE__, "SUNLinearSolver object does not support user-supplied ATimes routine");
+    return (ARKLS_ILL_INPUT);
+  }
+
+  /* store the directional derivative function, called by the internal
+     jtimes routine (NULL jtdir implies use of DQ default) */
+  if (jtdir != NULL)
+  {
+    arkls_mem->jtimesDQ = SUNFALSE;
+    arkls_mem->jtsetup  = NULL;
+    arkls_mem->jtimes   = arkLsDirDerivJtimes;
+    arkls_mem->Jt_dir   = jtdir;
+    arkls_mem->Jt_data  = ark_mem;
+  }
+  else
+  {
+    arkls_mem->jtimesDQ = SUNTRUE;
+    arkls_mem->jtsetup  = NULL;
+    arkls_mem->jtimes   = arkLsDQJtimes;
+    arkls_mem->Jt_dir   = NULL;
+    arkls_mem->Jt_data  = ark_mem;
+    arkls_mem->Jt_f     = ark_mem->step_getimplicitrhs(ark_mem);
+
+    if (arkls_mem->Jt_f == NULL)
+    {
+      arkProcessError(ark_mem, ARKLS_ILL_INPUT, __LINE__, __func__, __FILE__,
+                      "Time step module is missing implicit RHS fcn");
+      return (ARKLS_ILL_INPUT);
+    }
+  }
 
   return (ARKLS_SUCCESS);
 }
@@ -1061,6 +1268,9 @@ int ARKodeSetLinSysFn(void* arkode_mem, ARKLsLinSysFn linsys)
     arkls_mem->A_data      = ark_mem;
   }
 
+  /* data from a previous linear system function can not be reused */
+  arkls_mem->jcached = SUNFALSE;
+
   return (ARKLS_SUCCESS);
 }
 
@@ -2273,7 +2483,10 @@ int arkLSSetUserData(ARKodeMem ark_mem, void* user_data)
   if (!arkls_mem->jacDQ) { arkls_mem->J_data = user_data; }
 
   /* Set data for Jtimes */
-  if (!arkls_mem->jtimesDQ) { arkls_mem->Jt_data = user_data; }
+  if (!arkls_mem->jtimesDQ && !arkls_mem->Jt_dir)
+  {
+    arkls_mem->Jt_data = user_data;
+  }
 
   /* Set data for LinSys */
   if (arkls_mem->user_linsys) { arkls_mem->A_data = user_data; }
@@ -2560,7 +2773,7 @@ int arkLsMPSolve(void* arkode_mem, N_Vector r, N_Vector z, sunrealtype tol, int
 /*---------------------------------------------------------------
   arkLsDQJac:
 
-  This routine is a wrapper for the Dense and Band
+  This routine is a wrapper for the Dense, Band, and Sparse
   implementations of the difference quotient Jacobian
   approximation routines.
   ---------------------------------------------------------------*/
@@ -2617,6 +2830,15 @@ int arkLsDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
   {
     retval = arkLsBandDQJac(t, y, fy, Jac, ark_mem, arkls_mem, fi, tmp1, tmp2);
   }
+  else if (SUNMatGetID(Jac) == SUNMATRIX_BLOCKDENSE)
+  {
+    retval = arkLsBlockDenseDQJac(t, y, fy, Jac, ark_mem, arkls_mem, fi, tmp1,
+                                  tmp2);
+  }
+  else if (SUNMatGetID(Jac) == SUNMATRIX_SPARSE)
+  {
+    retval = arkLsSparseDQJac(t, y, fy, Jac, ark_mem, arkls_mem, fi, tmp1, tmp2);
+  }
   else
   {
     arkProcessError(ark_mem, ARKLS_ILL_INPUT, __LINE__, __func__, __FILE__,
@@ -2831,6 +3053,263 @@ int arkLsBandDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
   return (retval);
 }
 
+/*---------------------------------------------------------------
+  arkLsBlockDenseDQJac:
+
+  This routine generates a block-diagonal dense difference quotient
+  approximation to the Jacobian of f(t,y). Since the blocks are
+  independent, column j of every block is perturbed at the same
+  time, so only one call to f is needed per block column. The
+  difference quotients are loaded with SM_ELEMENT_BD.
+  ---------------------------------------------------------------*/
+int arkLsBlockDenseDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
+                         ARKodeMem ark_mem, ARKLsMem arkls_mem, ARKRhsFn fi,
+                         N_Vector tmp1, N_Vector tmp2)
+{
+  N_Vector ftemp, ytemp;
+  sunrealtype fnorm, minInc, inc, inc_inv, srur, conj;
+  sunrealtype *ewt_data, *fy_data, *ftemp_data, *y_data, *ytemp_data;
+  sunrealtype* cns_data;
+  sunindextype i, j, k, jj, N, Nb, nblocks;
+  int retval = 0;
+
+  /* access matrix dimensions */
+  Nb      = SM_BLOCKCOLUMNS_BD(Jac);
+  nblocks = SM_NUMBLOCKS_BD(Jac);
+  N       = SM_COLUMNS_BD(Jac);
+
+  /* Rename work vectors for use as temporary values of y and f */
+  ftemp = tmp1;
+  ytemp = tmp2;
+
+  /* Obtain pointers to the data for ewt, fy, ftemp, y, ytemp */
+  ewt_data   = N_VGetArrayPointer(ark_mem->ewt);
+  fy_data    = N_VGetArrayPointer(fy);
+  ftemp_data = N_VGetArrayPointer(ftemp);
+  y_data     = N_VGetArrayPointer(y);
+  ytemp_data = N_VGetArrayPointer(ytemp);
+  cns_data   = (ark_mem->constraints) ? N_VGetArrayPointer(ark_mem->constraints)
+                                      : NULL;
+
+  /* Load ytemp with y = predicted y vector */
+  N_VScale(ONE, y, ytemp);
+
+  /* Set minimum increment based on uround and norm of f */
+  srur   = SUNRsqrt(ark_mem->uround);
+  fnorm  = N_VWrmsNorm(fy, ark_mem->rwt);
+  minInc = (fnorm != ZERO)
+             ? (MIN_INC_MULT * SUNRabs(ark_mem->h) * ark_mem->uround * N * fnorm)
+             : ONE;
+
+  /* Loop over block columns */
+  for (j = 0; j < Nb; j++)
+  {
+    /* Increment column j of every block */
+    for (k = 0; k < nblocks; k++)
+    {
+      jj  = k * Nb + j;
+      inc = SUNMAX(srur * SUNRabs(y_data[jj]), minInc / ewt_data[jj]);
+
+      /* Adjust sign(inc) if yj has an inequality constraint. */
+      if (ark_mem->constraints)
+      {
+        conj = cns_data[jj];
+        if (SUNRabs(conj) == ONE)
+        {
+          if ((ytemp_data[jj] + inc) * conj < ZERO) { inc = -inc; }
+        }
+        else if (SUNRabs(conj) == TWO)
+        {
+          if ((ytemp_data[jj] + inc) * conj <= ZERO) { inc = -inc; }
+        }
+      }
+
+      ytemp_data[jj] += inc;
+    }
+
+    /* Evaluate f with incremented y */
+    retval = fi(t, ytemp, ftemp, ark_mem->user_data);
+    arkls_mem->nfeDQ++;
+    if (retval != 0) { break; }
+
+    /* Restore ytemp, then form and load difference quotients */
+    for (k = 0; k < nblocks; k++)
+    {
+      jj             = k * Nb + j;
+      ytemp_data[jj] = y_data[jj];
+      inc = SUNMAX(srur * SUNRabs(y_data[jj]), minInc / ewt_data[jj]);
+
+      /* Adjust sign(inc) as before. */
+      if (ark_mem->constraints)
+      {
+        conj = cns_data[jj];
+        if (SUNRabs(conj) == ONE)
+        {
+          if ((ytemp_data[jj] + inc) * conj < ZERO) { inc = -inc; }
+        }
+        else if (SUNRabs(conj) == TWO)
+        {
+          if ((ytemp_data[jj] + inc) * conj <= ZERO) { inc = -inc; }
+        }
+      }
+
+      inc_inv = ONE / inc;
+      for (i = 0; i < Nb; i++)
+      {
+        SM_ELEMENT_BD(Jac, k, i, j) = inc_inv * (ftemp_data[k * Nb + i] -
+                                                 fy_data[k * Nb + i]);
+      }
+    }
+  }
+
+  return (retval);
+}
+
+/*---------------------------------------------------------------
+  arkLsSparseDQJac:
+
+  This routine generates a sparse difference quotient approximation
+  to the Jacobian of f(t,y) using the sparsity pattern and column
+  coloring supplied to ARKodeSetJacSparsityPattern. All columns of
+  one color are structurally orthogonal, so they are perturbed
+  together and need a single call to f. The stored pattern is
+  loaded into the CSC or CSR matrix Jac before the difference
+  quotients are scattered into it.
+  ---------------------------------------------------------------*/
+int arkLsSparseDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
+                     ARKodeMem ark_mem, ARKLsMem arkls_mem, ARKRhsFn fi,
+                     N_Vector tmp1, N_Vector tmp2)
+{
+  N_Vector ftemp, ytemp;
+  sunrealtype fnorm, minInc, inc, srur, conj;
+  sunrealtype *ewt_data, *fy_data, *ftemp_data, *y_data, *ytemp_data;
+  sunrealtype* cns_data;
+  sunindextype color, j, k, N;
+  SUNSparseDQ sdq;
+  int retval = 0;
+
+  sdq = arkls_mem->sdq;
+  if (sdq == NULL)
+  {
+    arkProcessError(ark_mem, ARKLS_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    MSG_LS_NO_PATTERN);
+    return (ARKLS_ILL_INPUT);
+  }
+
+  /* load the sparsity pattern into Jac, growing its storage if needed */
+  if (SUNSparseMatrix_NNZ(Jac) < sdq->NNZ)
+  {
+    if (SUNSparseMatrix_Reallocate(Jac, sdq->NNZ))
+    {
+      arkProcessError(ark_mem, ARKLS_SUNMAT_FAIL, __LINE__, __func__, __FILE__,
+                      MSG_LS_SUNMAT_FAILED);
+      return (ARKLS_SUNMAT_FAIL);
+    }
+  }
+  if (SUNSparseDQ_LoadPattern(sdq, Jac))
+  {
+    arkProcessError(ark_mem, ARKLS_SUNMAT_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_LS_SUNMAT_FAILED);
+    return (ARKLS_SUNMAT_FAIL);
+  }
+
+  /* access matrix dimension */
+  N = SUNSparseMatrix_Columns(Jac);
+
+  /* Rename work vectors for use as temporary values of y and f */
+  ftemp = tmp1;
+  ytemp = tmp2;
+
+  /* Obtain pointers to the data for ewt, fy, ftemp, y, ytemp */
+  ewt_data   = N_VGetArrayPointer(ark_mem->ewt);
+  fy_data    = N_VGetArrayPointer(fy);
+  ftemp_data = N_VGetArrayPointer(ftemp);
+  y_data     = N_VGetArrayPointer(y);
+  ytemp_data = N_VGetArrayPointer(ytemp);
+  cns_data   = (ark_mem->constraints) ? N_VGetArrayPointer(ark_mem->constraints)
+                                      : NULL;
+
+  /* Load ytemp with y = predicted y vector */
+  N_VScale(ONE, y, ytemp);
+
+  /* Set minimum increment based on uround and norm of f */
+  srur   = SUNRsqrt(ark_mem->uround);
+  fnorm  = N_VWrmsNorm(fy, ark_mem->rwt);
+  minInc = (fnorm != ZERO)
+             ? (MIN_INC_MULT * SUNRabs(ark_mem->h) * ark_mem->uround * N * fnorm)
+             : ONE;
+
+  /* Loop over column colors */
+  for (color = 0; color < sdq->ncolors; color++)
+  {
+    /* Increment all y_j with this color */
+    for (k = sdq->colorptrs[color]; k < sdq->colorptrs[color + 1]; k++)
+    {
+      j   = sdq->colorcols[k];
+      inc = SUNMAX(srur * SUNRabs(y_data[j]), minInc / ewt_data[j]);
+
+      /* Adjust sign(inc) if yj has an inequality constraint. */
+      if (ark_mem->constraints)
+      {
+        conj = cns_data[j];
+        if (SUNRabs(conj) == ONE)
+        {
+          if ((ytemp_data[j] + inc) * conj < ZERO) { inc = -inc; }
+        }
+        else if (SUNRabs(conj) == TWO)
+        {
+          if ((ytemp_data[j] + inc) * conj <= ZERO) { inc = -inc; }
+        }
+      }
+
+      ytemp_data[j] += inc;
+    }
+
+    /* Evaluate f with incremented y */
+    retval = fi(t, ytemp, ftemp, ark_mem->user_data);
+    arkls_mem->nfeDQ++;
+    if (retval != 0) { break; }
+
+    /* Restore ytemp, then form and load difference quotients */
+    for (k = sdq->colorptrs[color]; k < sdq->colorptrs[color + 1]; k++)
+    {
+      j             = sdq->colorcols[k];
+      inc           = ytemp_data[j] - y_data[j];
+      ytemp_data[j] = y_data[j];
+      SUNSparseDQ_ScatterColumn(sdq, Jac, j, ONE / inc, ftemp_data, fy_data);
+    }
+  }
+
+  return (retval);
+}
+
+/*---------------------------------------------------------------
+  arkLsDirDerivJtimes:
+
+  This routine computes the Jacobian-vector product fi_y(t,y) * v
+  exactly by calling the user-supplied directional derivative of
+  the implicit right-hand side function.
+  ---------------------------------------------------------------*/
+int arkLsDirDerivJtimes(N_Vector v, N_Vector Jv, sunrealtype t, N_Vector y,
+                        SUNDIALS_MAYBE_UNUSED N_Vector fy, void* arkode_mem,
+                        SUNDIALS_MAYBE_UNUSED N_Vector work)
+{
+  ARKodeMem ark_mem;
+  ARKLsMem arkls_mem;
+  int retval;
+
+  /* access ARKodeMem and ARKLsMem structures */
+  retval = arkLs_AccessARKODELMem(arkode_mem, __func__, &ark_mem, &arkls_mem);
+  if (retval != ARK_SUCCESS) { return (retval); }
+
+  /* Set Jv = fi_y(t,y) v */
+  retval = arkls_mem->Jt_dir(t, y, v, Jv, ark_mem->user_data);
+  if (retval < 0) { return (-1); }
+  if (retval > 0) { return (+1); }
+
+  return (0);
+}
+
 /*---------------------------------------------------------------
   arkLsDQJtimes:
 
@@ -3013,17 +3492,30 @@ int arkLsInitialize(ARKodeMem ark_mem)
       /* Check if an internal or user-supplied Jacobian function is used */
       if (arkls_mem->jacDQ)
       {
-        /* Internal difference quotient Jacobian. Check that A is dense or band,
-           otherwise return an error */
+        /* Internal difference quotient Jacobian. Check that A is dense, band,
+           or sparse with a sparsity pattern, otherwise return an error */
         retval = 0;
         if (arkls_mem->A->ops->getid)
         {
           if ((SUNMatGetID(arkls_mem->A) == SUNMATRIX_DENSE) ||
-              (SUNMatGetID(arkls_mem->A) == SUNMATRIX_BAND))
+              (SUNMatGetID(arkls_mem->A) == SUNMATRIX_BAND) ||
+              (SUNMatGetID(arkls_mem->A) == SUNMATRIX_BLOCKDENSE))
           {
             arkls_mem->jac    = arkLsDQJac;
             arkls_mem->J_data = ark_mem;
           }
+          else if (SUNMatGetID(arkls_mem->A) == SUNMATRIX_SPARSE)
+          {
+            if (arkls_mem->sdq == NULL)
+            {
+              arkProcessError(ark_mem, ARKLS_ILL_INPUT, __LINE__, __func__,
+                              __FILE__, MSG_LS_NO_PATTERN);
+              arkls_mem->last_flag = ARKLS_ILL_INPUT;
+              return (ARKLS_ILL_INPUT);
+            }
+            arkls_mem->jac    = arkLsDQJac;
+            arkls_mem->J_data = ark_mem;
+          }
           else { retval++; }
         }
         else { retval++; }
@@ -3129,6 +3621,12 @@ int arkLsInitialize(ARKodeMem ark_mem)
     arkls_mem->jtimes  = arkLsDQJtimes;
     arkls_mem->Jt_data = ark_mem;
   }
+  else if (arkls_mem->Jt_dir)
+  {
+    arkls_mem->jtsetup = NULL;
+    arkls_mem->jtimes  = arkLsDirDerivJtimes;
+    arkls_mem->Jt_data = ark_mem;
+  }
 
   /* If A is NULL and psetup is not present, then arkLsSetup does
      not need to be called, so set the lsetup function to NULL (if possible) */
@@ -3202,10 +3700,12 @@ int arkLsSetup(ARKodeMem ark_mem, int convfail, sunrealtype tpred,
   }
 
   /* Use initsetup, gamma/gammap, and convfail to set J/P eval. flag jok;
-     Note: the "ARK_FAIL_BAD_J" test is asking whether the nonlinear
+     in the first step J/P is only current if data from before a reset
+     can be reused. Note: the "ARK_FAIL_BAD_J" test is asking whether the nonlinear
      solver converged due to a bad system Jacobian AND our gamma was
      fine, indicating that the J and/or P were invalid */
-  arkls_mem->jbad = (ark_mem->initsetup) ||
+  arkls_mem->jbad = ((ark_mem->initsetup) &&
+                     !arkLsCanReuse(ark_mem, arkls_mem, tpred, gamma)) ||
                     (ark_mem->nst >= arkls_mem->nstlj + arkls_mem->msbj) ||
                     ((convfail == ARK_FAIL_BAD_J) && (!dgamma_fail)) ||
                     (convfail == ARK_FAIL_OTHER);
@@ -3243,8 +3743,10 @@ int arkLsSetup(ARKodeMem ark_mem, int convfail, sunrealtype tpred,
     if (*jcurPtr)
     {
       arkls_mem->nje++;
-      arkls_mem->nstlj = ark_mem->nst;
-      arkls_mem->tnlj  = tpred;
+      arkls_mem->nstlj   = ark_mem->nst;
+      arkls_mem->tnlj    = tpred;
+      arkls_mem->gamlj   = gamma;
+      arkls_mem->jcached = (retval == ARKLS_SUCCESS);
     }
 
     /* Check linsys() return value and return if necessary */
@@ -3285,8 +3787,10 @@ int arkLsSetup(ARKodeMem ark_mem, int convfail, sunrealtype tpred,
     if (*jcurPtr)
     {
       arkls_mem->npe++;
-      arkls_mem->nstlj = ark_mem->nst;
-      arkls_mem->tnlj  = tpred;
+      arkls_mem->nstlj   = ark_mem->nst;
+      arkls_mem->tnlj    = tpred;
+      arkls_mem->gamlj   = gamma;
+      arkls_mem->jcached = (arkls_mem->last_flag == SUN_SUCCESS);
     }
 
     /* Update jcurPtr flag if we suggested an update */
@@ -3296,6 +3800,34 @@ int arkLsSetup(ARKodeMem ark_mem, int convfail, sunrealtype tpred,
   return (arkls_mem->last_flag);
 }
 
+/*---------------------------------------------------------------
+  arkLsCanReuse determines if the Jacobian and/or preconditioner
+  data from before a reset can be used in the first step, based
+  on the time and gamma value at the last J/P update.
+  ---------------------------------------------------------------*/
+sunbooleantype arkLsCanReuse(ARKodeMem ark_mem, ARKLsMem arkls_mem,
+                             sunrealtype tpred, sunrealtype gamma)
+{
+  if ((ark_mem->init_type != RESET_INIT) || !(arkls_mem->jcached) ||
+      (arkls_mem->dtmax_reuse <= ZERO))
+  {
+    return SUNFALSE;
+  }
+
+  if (SUNRabs(tpred - arkls_mem->tnlj) > arkls_mem->dtmax_reuse)
+  {
+    return SUNFALSE;
+  }
+
+  if ((arkls_mem->dgmax_reuse > ZERO) &&
+      (SUNRabs((gamma / arkls_mem->gamlj) - ONE) > arkls_mem->dgmax_reuse))
+  {
+    return SUNFALSE;
+  }
+
+  return SUNTRUE;
+}
+
 /*---------------------------------------------------------------
   arkLsSolve: interfaces between ARKODE and the generic
   SUNLinearSolver object LS, by setting the appropriate tolerance
@@ -3310,7 +3842,9 @@ int arkLsSolve(ARKodeMem ark_mem, N_Vector b, sunrealtype tnow, N_Vector ynow,
 {
   sunrealtype bnorm;
   ARKLsMem arkls_mem;
-  sunrealtype gamma, gamrat, delta, deltar, rwt_mean;
+  sunrealtype gamma, gamrat, delta, deltar, nrm[2];
+  sunrealtype rwt_mean = ONE;
+  N_Vector X[2], W[2];
   sunbooleantype dgamma_fail, *jcur;
   int nli_inc, retval;
 
@@ -3334,7 +3868,25 @@ int arkLsSolve(ARKodeMem ark_mem, N_Vector b, sunrealtype tnow, N_Vector ynow,
   if (arkls_mem->iterative)
   {
     deltar = arkls_mem->eplifac * eRNrm;
-    bnorm  = N_VWrmsNorm(b, ark_mem->rwt);
+
+    /* If the solver does not support scaling vectors, the mean residual
+       weight is needed to adjust the tolerance below. Compute it together
+       with norm(b) so that both require a single global reduction. */
+    if (arkls_mem->LS->ops->setscalingvectors)
+    {
+      bnorm = N_VWrmsNorm(b, ark_mem->rwt);
+    }
+    else
+    {
+      N_VConst(ONE, arkls_mem->x);
+      X[0] = b;
+      W[0] = ark_mem->rwt;
+      X[1] = ark_mem->rwt;
+      W[1] = arkls_mem->x;
+      (void)N_VWrmsNormVectorArray(2, X, W, nrm);
+      bnorm    = nrm[0];
+      rwt_mean = nrm[1];
+    }
 
     SUNLogInfo(ARK_LOGGER, "begin-linear-solve",
                "iterative = 1, b-norm = " SUN_FORMAT_G ", b-tol = " SUN_FORMAT_G
@@ -3393,12 +3945,7 @@ int arkLsSolve(ARKodeMem ark_mem, N_Vector b, sunrealtype tnow, N_Vector ynow,
        <=> || b - A x ||_2 < tol / rwt_mean
      So we compute rwt_mean = ||rwt||_RMS and scale the desired tolerance accordingly. */
   }
-  else if (arkls_mem->iterative)
-  {
-    N_VConst(ONE, arkls_mem->x);
-    rwt_mean = N_VWrmsNorm(ark_mem->rwt, arkls_mem->x);
-    delta /= rwt_mean;
-  }
+  else if (arkls_mem->iterative) { delta /= rwt_mean; }
 
   /* Set initial guess x = 0 to LS */
   N_VConst(ZERO, arkls_mem->x);
@@ -3553,6 +4100,9 @@ int arkLsFree(ARKodeMem ark_mem)
     arkls_mem->savedJ = NULL;
   }
 
+  /* Free sparse DQ Jacobian coloring */
+  SUNSparseDQ_Destroy(&(arkls_mem->sdq));
+
   /* Nullify other N_Vector pointers */
   arkls_mem->ycur = NULL;
   arkls_mem->fcur = NULL;
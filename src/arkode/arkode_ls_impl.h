@@ -24,6 +24,7 @@
 #include <arkode/arkode_ls.h>
 
 #include "arkode_impl.h"
+#include "sundials_sparsedq_impl.h"
 
 #ifdef __cplusplus /* wrapper to enable C++ usage */
 extern "C" {
@@ -58,6 +59,14 @@ typedef struct ARKLsMemRec
   ARKLsJacFn jac;       /* Jacobian routine to be called                 */
   void* J_data;         /* user data is passed to jac                    */
   sunbooleantype jbad;  /* heuristic suggestion for pset                 */
+  SUNSparseDQ sdq;      /* sparsity pattern and column coloring for the  *
+                         * sparse DQ Jacobian approximation              */
+
+  /* Reuse of the Jacobian or preconditioner data after a reset */
+  sunbooleantype jcached;  /* SUNTRUE if J/P data from a successful update *
+                            * is available for reuse                       */
+  sunrealtype dtmax_reuse; /* max |tR - tnlj| for reuse (<= 0 disables)    */
+  sunrealtype dgmax_reuse; /* max |gamma/gamlj - 1| for reuse (<= 0 off)    */
 
   /* Matrix-based solver, scale solution to account for change in gamma */
   sunbooleantype scalesol;
@@ -89,6 +98,7 @@ typedef struct ARKLsMemRec
   long int njtsetup; /* njtsetup = total number of calls to jtsetup  */
   long int njtimes;  /* njtimes = total number of calls to jtimes    */
   sunrealtype tnlj;  /* tnlj = t_n at last jac/pset call             */
+  sunrealtype gamlj; /* gamlj = gamma at last jac/pset call           */
 
   /* Preconditioner computation
     (a) user-provided:
@@ -108,11 +118,16 @@ typedef struct ARKLsMemRec
         - jtimesDQ == SUNFALSE
     (b) internal jtimes
         - Jt_data == arkode_mem
-        - jtimesDQ == SUNTRUE   */
+        - jtimesDQ == SUNTRUE
+    (c) internal jtimes calling a user-provided directional derivative:
+        - Jt_data == arkode_mem
+        - jtimesDQ == SUNFALSE
+        - Jt_dir != NULL   */
   sunbooleantype jtimesDQ;
   ARKLsJacTimesSetupFn jtsetup;
   ARKLsJacTimesVecFn jtimes;
   ARKRhsFn Jt_f;
+  ARKLsJacTimesDirDerivFn Jt_dir;
   void* Jt_data;
 
   /* Linear system setup function
@@ -207,6 +222,8 @@ int arkLsMPSolve(void* arkode_mem, N_Vector r, N_Vector z, sunrealtype tol,
                  int lr);
 
 /* Difference quotient approximation for Jac times vector */
+int arkLsDirDerivJtimes(N_Vector v, N_Vector Jv, sunrealtype t, N_Vector y,
+                        N_Vector fy, void* arkode_mem, N_Vector work);
 int arkLsDQJtimes(N_Vector v, N_Vector Jv, sunrealtype t, N_Vector y,
                   N_Vector fy, void* data, N_Vector work);
 
@@ -219,6 +236,12 @@ int arkLsDenseDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
 int arkLsBandDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
                    ARKodeMem ark_mem, ARKLsMem arkls_mem, ARKRhsFn fi,
                    N_Vector tmp1, N_Vector tmp2);
+int arkLsBlockDenseDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
+                         ARKodeMem ark_mem, ARKLsMem arkls_mem, ARKRhsFn fi,
+                         N_Vector tmp1, N_Vector tmp2);
+int arkLsSparseDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
+                     ARKodeMem ark_mem, ARKLsMem arkls_mem, ARKRhsFn fi,
+                     N_Vector tmp1, N_Vector tmp2);
 
 /* Generic linit/lsetup/lsolve/lfree interface routines for ARKODE to call */
 int arkLsInitialize(ARKodeMem ark_mem);
@@ -239,6 +262,8 @@ int arkLsMassFree(ARKodeMem ark_mem);
 
 /* Auxiliary functions */
 int arkLsInitializeCounters(ARKLsMem arkls_mem);
+sunbooleantype arkLsCanReuse(ARKodeMem ark_mem, ARKLsMem arkls_mem,
+                             sunrealtype tpred, sunrealtype gamma);
 int arkLsInitializeMassCounters(ARKLsMassMem arkls_mem);
 int arkLs_AccessARKODELMem(void* arkode_mem, const char* fname,
                            ARKodeMem* ark_mem, ARKLsMem* arkls_mem);
@@ -267,6 +292,9 @@ int arkLSGetCurrentMassMatrix(ARKodeMem ark_mem, SUNMatrix* M);
 #define MSG_LS_MASSMEM_NULL "Mass matrix solver memory is NULL."
 #define MSG_LS_BAD_SIZES \
   "Illegal bandwidth parameter(s). Must have 0 <=  ml, mu <= N-1."
+#define MSG_LS_NO_PATTERN                                                \
+  "A sparsity pattern is required for the difference quotient Jacobian " \
+  "approximation with a sparse SUNMatrix."
 
 #define MSG_LS_PSET_FAILED \
   "The preconditioner setup routine failed in an unrecoverable manner."
@@ -110,6 +110,103 @@ static int splittingStep_SetCoefficients(ARKodeMem ark_mem,
   return ARK_SUCCESS;
 }
 
+/*------------------------------------------------------------------------------
+  This routine frees the steppers attached to the sequential methods
+  ----------------------------------------------------------------------------*/
+static void splittingStep_FreeSequentialSteppers(ARKodeSplittingStepMem step_mem)
+{
+  if (step_mem->seq_steppers == NULL) { return; }
+
+  for (int i = 0; i < step_mem->num_seq_steppers; i++)
+  {
+    if (step_mem->seq_steppers[i] != NULL) { free(step_mem->seq_steppers[i]); }
+  }
+  free(step_mem->seq_steppers);
+  step_mem->seq_steppers     = NULL;
+  step_mem->num_seq_steppers = 0;
+}
+
+/*------------------------------------------------------------------------------
+  This routine checks if every sequential method after the first has its own
+  steppers, in which case the sequential methods are evolved independently
+  ----------------------------------------------------------------------------*/
+static sunbooleantype splittingStep_HasSequentialSteppers(
+  ARKodeSplittingStepMem step_mem)
+{
+  int methods = step_mem->coefficients->sequential_methods;
+
+  if (methods < 2 || step_mem->num_seq_steppers < methods) { return SUNFALSE; }
+
+  for (int i = 1; i < methods; i++)
+  {
+    if (step_mem->seq_steppers[i] == NULL) { return SUNFALSE; }
+  }
+
+  return SUNTRUE;
+}
+
+/*------------------------------------------------------------------------------
+  This routine frees the workspace for evolving the sequential methods
+  independently
+  ----------------------------------------------------------------------------*/
+static void splittingStep_FreeSequentialMem(ARKodeMem ark_mem,
+                                            ARKodeSplittingStepMem step_mem)
+{
+  arkFreeVecArray(step_mem->num_seq_states, &step_mem->seq_states,
+                  ark_mem->lrw1, &ark_mem->lrw, ark_mem->liw1, &ark_mem->liw);
+  step_mem->num_seq_states = 0;
+
+  if (step_mem->seq_evolves != NULL)
+  {
+    free(step_mem->seq_evolves);
+    step_mem->seq_evolves = NULL;
+  }
+
+  if (step_mem->seq_retvals != NULL)
+  {
+    free(step_mem->seq_retvals);
+    step_mem->seq_retvals = NULL;
+  }
+}
+
+/*------------------------------------------------------------------------------
+  This routine allocates the workspace for evolving the sequential methods
+  independently: a state vector, evolve counters, and a return flag for each
+  sequential method
+  ----------------------------------------------------------------------------*/
+static int splittingStep_AllocSequentialMem(ARKodeMem ark_mem,
+                                            ARKodeSplittingStepMem step_mem,
+                                            int methods)
+{
+  if (step_mem->num_seq_states >= methods) { return ARK_SUCCESS; }
+
+  splittingStep_FreeSequentialMem(ark_mem, step_mem);
+
+  if (!arkAllocVecArray(methods, ark_mem->yn, &step_mem->seq_states,
+                        ark_mem->lrw1, &ark_mem->lrw, ark_mem->liw1,
+                        &ark_mem->liw))
+  {
+    arkProcessError(ark_mem, ARK_MEM_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_MEM_FAIL);
+    return ARK_MEM_FAIL;
+  }
+  step_mem->num_seq_states = methods;
+
+  step_mem->seq_evolves =
+    calloc((size_t)methods * step_mem->partitions,
+           sizeof(*step_mem->seq_evolves));
+  step_mem->seq_retvals = calloc(methods, sizeof(*step_mem->seq_retvals));
+  if (step_mem->seq_evolves == NULL || step_mem->seq_retvals == NULL)
+  {
+    splittingStep_FreeSequentialMem(ark_mem, step_mem);
+    arkProcessError(ark_mem, ARK_MEM_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_MEM_FAIL);
+    return ARK_MEM_FAIL;
+  }
+
+  return ARK_SUCCESS;
+}
+
 /*-----------------------------------------------------------------------------
   This routine is called just prior to performing internal time steps (after all
   user "set" routines have been called) from within arkInitialSetup.
@@ -141,6 +238,12 @@ static int splittingStep_Init(ARKodeMem ark_mem,
     }
   }
 
+  /* the sequential method states are reallocated at the next step */
+  if (init_type == RESIZE_INIT)
+  {
+    splittingStep_FreeSequentialMem(ark_mem, step_mem);
+  }
+
   /* immediately return if resize or reset */
   if (init_type == RESIZE_INIT || init_type == RESET_INIT)
   {
@@ -210,17 +313,20 @@ static int splittingStep_FullRHS(ARKodeMem ark_mem, sunrealtype t, N_Vector y,
 }
 
 /*------------------------------------------------------------------------------
-  This routine performs a sequential operator splitting method
+  This routine performs a sequential operator splitting method using the given
+  steppers and increments the evolve counters in n_evolves. Log messages are
+  written to logger, which may be NULL to disable logging.
   ----------------------------------------------------------------------------*/
-static int splittingStep_SequentialMethod(ARKodeMem ark_mem,
-                                          ARKodeSplittingStepMem step_mem,
-                                          int i, N_Vector y)
+static int splittingStep_SequentialMethod(
+  ARKodeMem ark_mem, ARKodeSplittingStepMem step_mem, int i,
+  SUNStepper* steppers, long int* n_evolves,
+  SUNDIALS_MAYBE_UNUSED SUNLogger logger, N_Vector y)
 {
   SplittingStepCoefficients coefficients = step_mem->coefficients;
 
   for (int j = 0; j < coefficients->stages; j++)
   {
-    SUNLogInfo(ARK_LOGGER, "begin-stages-list", "stage = %i", j);
+    SUNLogInfo(logger, "begin-stages-list", "stage = %i", j);
 
     for (int k = 0; k < coefficients->partitions; k++)
     {
@@ -232,12 +338,12 @@ static int splittingStep_SequentialMethod(ARKodeMem ark_mem,
       sunrealtype t_start = ark_mem->tn + beta_start * ark_mem->h;
       sunrealtype t_end   = ark_mem->tn + beta_end * ark_mem->h;
 
-      SUNLogInfo(ARK_LOGGER, "begin-partitions-list",
+      SUNLogInfo(logger, "begin-partitions-list",
                  "partition = %i, t_start = " SUN_FORMAT_G
                  ", t_end = " SUN_FORMAT_G,
                  k, t_start, t_end);
 
-      SUNStepper stepper = step_mem->steppers[k];
+      SUNStepper stepper = steppers[k];
       /* TODO(SBR): A potential future optimization is removing this reset and
        * a call to SUNStepper_SetStopTime later for methods that start a step
        * evolving the same partition the last step ended with (essentially a
@@ -246,9 +352,9 @@ static int splittingStep_SequentialMethod(ARKodeMem ark_mem,
       SUNErrCode err = SUNStepper_Reset(stepper, t_start, y);
       if (err != SUN_SUCCESS)
       {
-        SUNLogInfo(ARK_LOGGER, "end-partitions-list",
+        SUNLogInfo(logger, "end-partitions-list",
                    "status = failed stepper reset, err = %i", err);
-        SUNLogInfo(ARK_LOGGER, "end-stages-list",
+        SUNLogInfo(logger, "end-stages-list",
                    "status = failed partition, err = %i", err);
         return ARK_SUNSTEPPER_ERR;
       }
@@ -256,9 +362,9 @@ static int splittingStep_SequentialMethod(ARKodeMem ark_mem,
       err = SUNStepper_SetStepDirection(stepper, t_end - t_start);
       if (err != SUN_SUCCESS)
       {
-        SUNLogInfo(ARK_LOGGER, "end-partitions-list",
+        SUNLogInfo(logger, "end-partitions-list",
                    "status = failed set direction, err = %i", err);
-        SUNLogInfo(ARK_LOGGER, "end-stages-list",
+        SUNLogInfo(logger, "end-stages-list",
                    "status = failed partition, err = %i", err);
         return ARK_SUNSTEPPER_ERR;
       }
@@ -266,34 +372,109 @@ static int splittingStep_SequentialMethod(ARKodeMem ark_mem,
       err = SUNStepper_SetStopTime(stepper, t_end);
       if (err != SUN_SUCCESS)
       {
-        SUNLogInfo(ARK_LOGGER, "end-partitions-list",
+        SUNLogInfo(logger, "end-partitions-list",
                    "status = failed set stop time, err = %i", err);
-        SUNLogInfo(ARK_LOGGER, "end-stages-list",
+        SUNLogInfo(logger, "end-stages-list",
                    "status = failed partition, err = %i", err);
         return ARK_SUNSTEPPER_ERR;
       }
 
       sunrealtype tret = ZERO;
       err              = SUNStepper_Evolve(stepper, t_end, y, &tret);
-      SUNLogExtraDebugVec(ARK_LOGGER, "partition state", y, "y_par(:) =");
+      SUNLogExtraDebugVecIf(logger != NULL, logger, "partition state", y,
+                            "y_par(:) =");
       if (err != SUN_SUCCESS)
       {
-        SUNLogInfo(ARK_LOGGER, "end-partitions-list",
+        SUNLogInfo(logger, "end-partitions-list",
                    "status = failed evolve, err = %i", err);
-        SUNLogInfo(ARK_LOGGER, "end-stages-list",
+        SUNLogInfo(logger, "end-stages-list",
                    "status = failed partition, err = %i", err);
         return ARK_SUNSTEPPER_ERR;
       }
-      step_mem->n_stepper_evolves[k]++;
+      n_evolves[k]++;
 
-      SUNLogInfo(ARK_LOGGER, "end-partitions-list", "status = success");
+      SUNLogInfo(logger, "end-partitions-list", "status = success");
     }
-    SUNLogInfo(ARK_LOGGER, "end-stages-list", "status = success");
+    SUNLogInfo(logger, "end-stages-list", "status = success");
   }
 
   return ARK_SUCCESS;
 }
 
+/*------------------------------------------------------------------------------
+  This routine performs a single step of the splitting method when each
+  sequential method has its own steppers. The sequential methods only share the
+  initial state yn, so they are evolved independently (concurrently when OpenMP
+  is enabled) into separate state vectors, and the results are combined with a
+  single linear combination. Messages are not logged while the sequential
+  methods are evolved as the logger is not thread-safe.
+  ----------------------------------------------------------------------------*/
+static int splittingStep_TakeStepSequentialSteppers(
+  ARKodeMem ark_mem, ARKodeSplittingStepMem step_mem)
+{
+  SplittingStepCoefficients coefficients = step_mem->coefficients;
+  int methods                            = coefficients->sequential_methods;
+  int partitions                         = step_mem->partitions;
+
+  int retval = splittingStep_AllocSequentialMem(ark_mem, step_mem, methods);
+  if (retval != ARK_SUCCESS) { return retval; }
+
+  SUNLogInfo(ARK_LOGGER, "begin-sequential-methods-list",
+             "sequential methods = %i", methods);
+
+#if defined(SUNDIALS_OPENMP_ENABLED)
+#pragma omp parallel for schedule(static, 1)
+#endif
+  for (int i = 0; i < methods; i++)
+  {
+    SUNStepper* steppers = (i == 0) ? step_mem->steppers
+                                    : step_mem->seq_steppers[i];
+    N_VScale(ONE, ark_mem->yn, step_mem->seq_states[i]);
+    step_mem->seq_retvals[i] =
+      splittingStep_SequentialMethod(ark_mem, step_mem, i, steppers,
+                                     step_mem->seq_evolves + i * partitions,
+                                     NULL, step_mem->seq_states[i]);
+  }
+
+  for (int i = 0; i < methods; i++)
+  {
+    for (int k = 0; k < partitions; k++)
+    {
+      step_mem->n_stepper_evolves[k] +=
+        step_mem->seq_evolves[i * partitions + k];
+      step_mem->seq_evolves[i * partitions + k] = 0;
+    }
+  }
+
+  for (int i = 0; i < methods; i++)
+  {
+    if (step_mem->seq_retvals[i] != ARK_SUCCESS)
+    {
+      SUNLogInfo(ARK_LOGGER, "end-sequential-methods-list",
+                 "status = failed sequential method %i, retval = %i", i,
+                 step_mem->seq_retvals[i]);
+      return step_mem->seq_retvals[i];
+    }
+  }
+
+  SUNLogExtraDebugVecArray(ARK_LOGGER, "sequential state", methods,
+                           step_mem->seq_states, "y_seq_%d(:) =");
+
+  retval = N_VLinearCombination(methods, coefficients->alpha,
+                                step_mem->seq_states, ark_mem->ycur);
+  if (retval != 0)
+  {
+    SUNLogInfo(ARK_LOGGER, "end-sequential-methods-list",
+               "status = failed vector op, retval = %i", retval);
+    return ARK_VECTOROP_ERR;
+  }
+
+  SUNLogExtraDebugVec(ARK_LOGGER, "current state", ark_mem->ycur, "y_cur(:) =");
+  SUNLogInfo(ARK_LOGGER, "end-sequential-methods-list", "status = success");
+
+  return ARK_SUCCESS;
+}
+
 /*------------------------------------------------------------------------------
   This routine performs a single step of the splitting method.
   ----------------------------------------------------------------------------*/
@@ -309,11 +490,19 @@ static int splittingStep_TakeStep(ARKodeMem ark_mem, sunrealtype* dsmPtr,
 
   SplittingStepCoefficients coefficients = step_mem->coefficients;
 
+  if (splittingStep_HasSequentialSteppers(step_mem))
+  {
+    return splittingStep_TakeStepSequentialSteppers(ark_mem, step_mem);
+  }
+
   SUNLogInfo(ARK_LOGGER, "begin-sequential-methods-list",
              "sequential method = 0");
 
   N_VScale(ONE, ark_mem->yn, ark_mem->ycur);
-  retval = splittingStep_SequentialMethod(ark_mem, step_mem, 0, ark_mem->ycur);
+  retval = splittingStep_SequentialMethod(ark_mem, step_mem, 0,
+                                          step_mem->steppers,
+                                          step_mem->n_stepper_evolves,
+                                          ARK_LOGGER, ark_mem->ycur);
   SUNLogExtraDebugVec(ARK_LOGGER, "sequential state", ark_mem->ycur,
                       "y_seq(:) =");
   if (retval != ARK_SUCCESS)
@@ -337,7 +526,9 @@ static int splittingStep_TakeStep(ARKodeMem ark_mem, sunrealtype* dsmPtr,
 
     N_VScale(ONE, ark_mem->yn, ark_mem->tempv1);
     retval = splittingStep_SequentialMethod(ark_mem, step_mem, i,
-                                            ark_mem->tempv1);
+                                            step_mem->steppers,
+                                            step_mem->n_stepper_evolves,
+                                            ARK_LOGGER, ark_mem->tempv1);
     SUNLogExtraDebugVec(ARK_LOGGER, "sequential state", ark_mem->tempv1,
                         "y_seq(:) =");
     if (retval != ARK_SUCCESS)
@@ -407,6 +598,8 @@ static void splittingStep_Free(ARKodeMem ark_mem)
     {
       free(step_mem->n_stepper_evolves);
     }
+    splittingStep_FreeSequentialSteppers(step_mem);
+    splittingStep_FreeSequentialMem(ark_mem, step_mem);
     SplittingStepCoefficients_Destroy(&step_mem->coefficients);
     free(step_mem);
   }
@@ -598,6 +791,8 @@ static int splittingStep_InitStepMem(ARKodeMem ark_mem,
   if (step_mem->partitions != partitions)
   {
     SplittingStepCoefficients_Destroy(&step_mem->coefficients);
+    splittingStep_FreeSequentialSteppers(step_mem);
+    splittingStep_FreeSequentialMem(ark_mem, step_mem);
   }
   step_mem->partitions = partitions;
 
@@ -644,6 +839,12 @@ void* SplittingStepCreate(SUNStepper* steppers, int partitions, sunrealtype t0,
   step_mem->steppers          = NULL;
   step_mem->n_stepper_evolves = NULL;
   step_mem->coefficients      = NULL;
+  step_mem->seq_steppers      = NULL;
+  step_mem->num_seq_steppers  = 0;
+  step_mem->seq_states        = NULL;
+  step_mem->num_seq_states    = 0;
+  step_mem->seq_evolves       = NULL;
+  step_mem->seq_retvals       = NULL;
   retval = splittingStep_InitStepMem(ark_mem, step_mem, steppers, partitions);
   if (retval != ARK_SUCCESS)
   {
@@ -771,6 +972,91 @@ int SplittingStepSetCoefficients(void* arkode_mem,
   return ARK_SUCCESS;
 }
 
+/*------------------------------------------------------------------------------
+  Attaches the steppers used to evolve a sequential method other than the first.
+  When every sequential method has its own steppers, the sequential methods are
+  evolved independently.
+  ----------------------------------------------------------------------------*/
+int SplittingStepSetSequentialSteppers(void* arkode_mem, int sequential_method,
+                                       SUNStepper* steppers)
+{
+  ARKodeMem ark_mem               = NULL;
+  ARKodeSplittingStepMem step_mem = NULL;
+  int retval = splittingStep_AccessARKODEStepMem(arkode_mem, __func__, &ark_mem,
+                                                 &step_mem);
+  if (retval != ARK_SUCCESS) { return retval; }
+
+  if (sequential_method < 1)
+  {
+    arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "The sequential method index must be positive.");
+    return ARK_ILL_INPUT;
+  }
+
+  if (steppers != NULL)
+  {
+    for (int k = 0; k < step_mem->partitions; k++)
+    {
+      if (steppers[k] == NULL)
+      {
+        arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                        "steppers[%d] = NULL illegal.", k);
+        return ARK_ILL_INPUT;
+      }
+
+      if (!splittingStep_CheckSUNStepper(steppers[k]))
+      {
+        arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                        "stepper[%d] does not implement the required operations.",
+                        k);
+        return ARK_ILL_INPUT;
+      }
+    }
+  }
+
+  if (sequential_method >= step_mem->num_seq_steppers)
+  {
+    if (steppers == NULL) { return ARK_SUCCESS; }
+
+    SUNStepper** seq_steppers =
+      realloc(step_mem->seq_steppers,
+              (sequential_method + 1) * sizeof(*seq_steppers));
+    if (seq_steppers == NULL)
+    {
+      arkProcessError(ark_mem, ARK_MEM_FAIL, __LINE__, __func__, __FILE__,
+                      MSG_ARK_ARKMEM_FAIL);
+      return ARK_MEM_FAIL;
+    }
+    for (int i = step_mem->num_seq_steppers; i <= sequential_method; i++)
+    {
+      seq_steppers[i] = NULL;
+    }
+    step_mem->seq_steppers     = seq_steppers;
+    step_mem->num_seq_steppers = sequential_method + 1;
+  }
+
+  if (step_mem->seq_steppers[sequential_method] != NULL)
+  {
+    free(step_mem->seq_steppers[sequential_method]);
+    step_mem->seq_steppers[sequential_method] = NULL;
+  }
+
+  if (steppers == NULL) { return ARK_SUCCESS; }
+
+  step_mem->seq_steppers[sequential_method] =
+    malloc(step_mem->partitions * sizeof(*steppers));
+  if (step_mem->seq_steppers[sequential_method] == NULL)
+  {
+    arkProcessError(ark_mem, ARK_MEM_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_ARKMEM_FAIL);
+    return ARK_MEM_FAIL;
+  }
+  memcpy(step_mem->seq_steppers[sequential_method], steppers,
+         step_mem->partitions * sizeof(*steppers));
+
+  return ARK_SUCCESS;
+}
+
 /*------------------------------------------------------------------------------
   Accesses the number of times a given partition was evolved
   ----------------------------------------------------------------------------*/
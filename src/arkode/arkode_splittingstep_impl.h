@@ -30,6 +30,14 @@ typedef struct ARKodeSplittingStepMemRec
 
   int partitions;
   int order;
+
+  /* steppers for evolving the sequential methods independently */
+  SUNStepper** seq_steppers; /* seq_steppers[i] evolve sequential method i  */
+  int num_seq_steppers;      /* length of seq_steppers                      */
+  N_Vector* seq_states;      /* state of each sequential method             */
+  int num_seq_states;        /* number of vectors in seq_states             */
+  long int* seq_evolves;     /* evolves per sequential method and partition */
+  int* seq_retvals;          /* return flag of each sequential method       */
 }* ARKodeSplittingStepMem;
 
 #endif
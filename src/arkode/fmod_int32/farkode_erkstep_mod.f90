@@ -38,6 +38,27 @@ module farkode_erkstep_mod
  integer(C_INT), parameter, public :: ERKSTEP_DEFAULT_7 = ARKODE_VERNER_10_6_7
  integer(C_INT), parameter, public :: ERKSTEP_DEFAULT_8 = ARKODE_VERNER_13_7_8
  integer(C_INT), parameter, public :: ERKSTEP_DEFAULT_9 = ARKODE_VERNER_16_8_9
+ ! enum ARKODE_LowStorageType
+ enum, bind(c)
+  enumerator :: ARKODE_LOWSTORAGE_2N = 0
+  enumerator :: ARKODE_LOWSTORAGE_3SSTAR = 1
+ end enum
+ integer, parameter, public :: ARKODE_LowStorageType = kind(ARKODE_LOWSTORAGE_2N)
+ public :: ARKODE_LOWSTORAGE_2N, ARKODE_LOWSTORAGE_3SSTAR
+ ! enum ARKODE_LowStorageTableID
+ enum, bind(c)
+  enumerator :: ARKODE_LOWSTORAGE_NONE = -1
+  enumerator :: ARKODE_LOWSTORAGE_WILLIAMSON_3_3 = 0
+  enumerator :: ARKODE_MIN_LOWSTORAGE_NUM = 0
+  enumerator :: ARKODE_LOWSTORAGE_CARPENTER_KENNEDY_5_3_4
+  enumerator :: ARKODE_LOWSTORAGE_SSP_3_2_3
+  enumerator :: ARKODE_LOWSTORAGE_RK4_4_4
+  enumerator :: ARKODE_MAX_LOWSTORAGE_NUM = ARKODE_LOWSTORAGE_RK4_4_4
+ end enum
+ integer, parameter, public :: ARKODE_LowStorageTableID = kind(ARKODE_LOWSTORAGE_NONE)
+ public :: ARKODE_LOWSTORAGE_NONE, ARKODE_LOWSTORAGE_WILLIAMSON_3_3, ARKODE_MIN_LOWSTORAGE_NUM, &
+    ARKODE_LOWSTORAGE_CARPENTER_KENNEDY_5_3_4, ARKODE_LOWSTORAGE_SSP_3_2_3, ARKODE_LOWSTORAGE_RK4_4_4, &
+    ARKODE_MAX_LOWSTORAGE_NUM
  public :: FERKStepCreate
  public :: FERKStepReInit
  public :: FERKStepSetTable
@@ -47,6 +68,9 @@ module farkode_erkstep_mod
   integer(C_SIZE_T), public :: size = 0
  end type
  public :: FERKStepSetTableName
+ public :: FERKStepSetLowStorageTable
+ public :: FERKStepSetLowStorageTableNum
+ public :: FERKStepSetLowStorageTableName
  public :: FERKStepGetCurrentButcherTable
  public :: FERKStepGetTimestepperStats
  public :: FERKStepCreateAdjointStepper
@@ -187,6 +211,34 @@ type(SwigArrayWrapper) :: farg2
 integer(C_INT) :: fresult
 end function
 
+function swigc_FERKStepSetLowStorageTable(farg1, farg2) &
+bind(C, name="_wrap_FERKStepSetLowStorageTable") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+type(C_PTR), value :: farg2
+integer(C_INT) :: fresult
+end function
+
+function swigc_FERKStepSetLowStorageTableNum(farg1, farg2) &
+bind(C, name="_wrap_FERKStepSetLowStorageTableNum") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+integer(C_INT) :: fresult
+end function
+
+function swigc_FERKStepSetLowStorageTableName(farg1, farg2) &
+bind(C, name="_wrap_FERKStepSetLowStorageTableName") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+import :: swigarraywrapper
+type(C_PTR), value :: farg1
+type(SwigArrayWrapper) :: farg2
+integer(C_INT) :: fresult
+end function
+
 function swigc_FERKStepGetCurrentButcherTable(farg1, farg2) &
 bind(C, name="_wrap_FERKStepGetCurrentButcherTable") &
 result(fresult)
@@ -1118,6 +1170,55 @@ fresult = swigc_FERKStepSetTableName(farg1, farg2)
 swig_result = fresult
 end function
 
+function FERKStepSetLowStorageTable(arkode_mem, l) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: arkode_mem
+type(C_PTR) :: l
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+type(C_PTR) :: farg2 
+
+farg1 = arkode_mem
+farg2 = l
+fresult = swigc_FERKStepSetLowStorageTable(farg1, farg2)
+swig_result = fresult
+end function
+
+function FERKStepSetLowStorageTableNum(arkode_mem, ltable) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: arkode_mem
+integer(ARKODE_LowStorageTableID), intent(in) :: ltable
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+
+farg1 = arkode_mem
+farg2 = ltable
+fresult = swigc_FERKStepSetLowStorageTableNum(farg1, farg2)
+swig_result = fresult
+end function
+
+function FERKStepSetLowStorageTableName(arkode_mem, ltable) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: arkode_mem
+character(kind=C_CHAR, len=*), target :: ltable
+character(kind=C_CHAR), dimension(:), allocatable, target :: farg2_chars
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+type(SwigArrayWrapper) :: farg2 
+
+farg1 = arkode_mem
+call SWIG_string_to_chararray(ltable, farg2_chars, farg2)
+fresult = swigc_FERKStepSetLowStorageTableName(farg1, farg2)
+swig_result = fresult
+end function
+
 function FERKStepGetCurrentButcherTable(arkode_mem, b) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -194,6 +194,7 @@ module farkode_mod
  public :: FARKodeResetAccumulatedError
  public :: FARKodeEvolve
  public :: FARKodeGetDky
+ public :: FARKodeGetDkyBatch
  public :: FARKodeComputeState
  public :: FARKodeGetNumRhsEvals
  public :: FARKodeGetNumStepAttempts
@@ -477,8 +478,10 @@ module farkode_mod
  public :: FARKodeSetLinearSolver
  public :: FARKodeSetMassLinearSolver
  public :: FARKodeSetJacFn
+ public :: FARKodeSetJacSparsityPattern
  public :: FARKodeSetMassFn
  public :: FARKodeSetJacEvalFrequency
+ public :: FARKodeSetJacReuseOnReset
  public :: FARKodeSetLinearSolutionScaling
  public :: FARKodeSetEpsLin
  public :: FARKodeSetMassEpsLin
@@ -488,6 +491,7 @@ module farkode_mod
  public :: FARKodeSetMassPreconditioner
  public :: FARKodeSetJacTimes
  public :: FARKodeSetJacTimesRhsFn
+ public :: FARKodeSetJacTimesDirDeriv
  public :: FARKodeSetMassTimes
  public :: FARKodeSetLinSysFn
 
@@ -1116,6 +1120,18 @@ type(C_PTR), value :: farg4
 integer(C_INT) :: fresult
 end function
 
+function swigc_FARKodeGetDkyBatch(farg1, farg2, farg3, farg4, farg5) &
+bind(C, name="_wrap_FARKodeGetDkyBatch") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+type(C_PTR), value :: farg3
+integer(C_INT), intent(in) :: farg4
+type(C_PTR), value :: farg5
+integer(C_INT) :: fresult
+end function
+
 function swigc_FARKodeComputeState(farg1, farg2, farg3) &
 bind(C, name="_wrap_FARKodeComputeState") &
 result(fresult)
@@ -2386,6 +2402,15 @@ type(C_FUNPTR), value :: farg2
 integer(C_INT) :: fresult
 end function
 
+function swigc_FARKodeSetJacSparsityPattern(farg1, farg2) &
+bind(C, name="_wrap_FARKodeSetJacSparsityPattern") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+type(C_PTR), value :: farg2
+integer(C_INT) :: fresult
+end function
+
 function swigc_FARKodeSetMassFn(farg1, farg2) &
 bind(C, name="_wrap_FARKodeSetMassFn") &
 result(fresult)
@@ -2404,6 +2429,16 @@ integer(C_LONG), intent(in) :: farg2
 integer(C_INT) :: fresult
 end function
 
+function swigc_FARKodeSetJacReuseOnReset(farg1, farg2, farg3) &
+bind(C, name="_wrap_FARKodeSetJacReuseOnReset") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+real(C_DOUBLE), intent(in) :: farg2
+real(C_DOUBLE), intent(in) :: farg3
+integer(C_INT) :: fresult
+end function
+
 function swigc_FARKodeSetLinearSolutionScaling(farg1, farg2) &
 bind(C, name="_wrap_FARKodeSetLinearSolutionScaling") &
 result(fresult)
@@ -2488,6 +2523,15 @@ type(C_FUNPTR), value :: farg2
 integer(C_INT) :: fresult
 end function
 
+function swigc_FARKodeSetJacTimesDirDeriv(farg1, farg2) &
+bind(C, name="_wrap_FARKodeSetJacTimesDirDeriv") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+type(C_FUNPTR), value :: farg2
+integer(C_INT) :: fresult
+end function
+
 function swigc_FARKodeSetMassTimes(farg1, farg2, farg3, farg4) &
 bind(C, name="_wrap_FARKodeSetMassTimes") &
 result(fresult)
@@ -3650,6 +3694,31 @@ fresult = swigc_FARKodeGetDky(farg1, farg2, farg3, farg4)
 swig_result = fresult
 end function
 
+function FARKodeGetDkyBatch(arkode_mem, nt, t, k, dky) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: arkode_mem
+integer(C_INT), intent(in) :: nt
+real(C_DOUBLE), dimension(*), target, intent(inout) :: t
+integer(C_INT), intent(in) :: k
+type(C_PTR) :: dky
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+type(C_PTR) :: farg3 
+integer(C_INT) :: farg4 
+type(C_PTR) :: farg5 
+
+farg1 = arkode_mem
+farg2 = nt
+farg3 = c_loc(t(1))
+farg4 = k
+farg5 = dky
+fresult = swigc_FARKodeGetDkyBatch(farg1, farg2, farg3, farg4, farg5)
+swig_result = fresult
+end function
+
 function FARKodeComputeState(arkode_mem, zcor, z) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -5879,6 +5948,22 @@ fresult = swigc_FARKodeSetJacFn(farg1, farg2)
 swig_result = fresult
 end function
 
+function FARKodeSetJacSparsityPattern(arkode_mem, s) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: arkode_mem
+type(SUNMatrix), target, intent(inout) :: s
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+type(C_PTR) :: farg2 
+
+farg1 = arkode_mem
+farg2 = c_loc(s)
+fresult = swigc_FARKodeSetJacSparsityPattern(farg1, farg2)
+swig_result = fresult
+end function
+
 function FARKodeSetMassFn(arkode_mem, mass) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -5911,6 +5996,25 @@ fresult = swigc_FARKodeSetJacEvalFrequency(farg1, farg2)
 swig_result = fresult
 end function
 
+function FARKodeSetJacReuseOnReset(arkode_mem, dtmax, dgmax) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: arkode_mem
+real(C_DOUBLE), intent(in) :: dtmax
+real(C_DOUBLE), intent(in) :: dgmax
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+real(C_DOUBLE) :: farg2 
+real(C_DOUBLE) :: farg3 
+
+farg1 = arkode_mem
+farg2 = dtmax
+farg3 = dgmax
+fresult = swigc_FARKodeSetJacReuseOnReset(farg1, farg2, farg3)
+swig_result = fresult
+end function
+
 function FARKodeSetLinearSolutionScaling(arkode_mem, onoff) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -6064,6 +6168,22 @@ fresult = swigc_FARKodeSetJacTimesRhsFn(farg1, farg2)
 swig_result = fresult
 end function
 
+function FARKodeSetJacTimesDirDeriv(arkode_mem, jtdir) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: arkode_mem
+type(C_FUNPTR), intent(in), value :: jtdir
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+type(C_FUNPTR) :: farg2 
+
+farg1 = arkode_mem
+farg2 = jtdir
+fresult = swigc_FARKodeSetJacTimesDirDeriv(farg1, farg2)
+swig_result = fresult
+end function
+
 function FARKodeSetMassTimes(arkode_mem, msetup, mtimes, mtimes_data) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
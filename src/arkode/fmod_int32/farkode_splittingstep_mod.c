@@ -748,6 +748,22 @@ SWIGEXPORT int _wrap_FSplittingStepSetCoefficients(void *farg1, SwigClassWrapper
 }
 
 
+SWIGEXPORT int _wrap_FSplittingStepSetSequentialSteppers(void *farg1, int const *farg2, void *farg3) {
+  int fresult ;
+  void *arg1 = (void *) 0 ;
+  int arg2 ;
+  SUNStepper *arg3 = (SUNStepper *) 0 ;
+  int result;
+  
+  arg1 = (void *)(farg1);
+  arg2 = (int)(*farg2);
+  arg3 = (SUNStepper *)(farg3);
+  result = (int)SplittingStepSetSequentialSteppers(arg1,arg2,arg3);
+  fresult = (int)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FSplittingStepGetNumEvolves(void *farg1, int const *farg2, long *farg3) {
   int fresult ;
   void *arg1 = (void *) 0 ;
@@ -99,6 +99,7 @@ module farkode_splittingstep_mod
  public :: FSplittingStepCreate
  public :: FSplittingStepReInit
  public :: FSplittingStepSetCoefficients
+ public :: FSplittingStepSetSequentialSteppers
  public :: FSplittingStepGetNumEvolves
 
 ! WRAPPER DECLARATIONS
@@ -408,6 +409,16 @@ type(SwigClassWrapper) :: farg2
 integer(C_INT) :: fresult
 end function
 
+function swigc_FSplittingStepSetSequentialSteppers(farg1, farg2, farg3) &
+bind(C, name="_wrap_FSplittingStepSetSequentialSteppers") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+type(C_PTR), value :: farg3
+integer(C_INT) :: fresult
+end function
+
 function swigc_FSplittingStepGetNumEvolves(farg1, farg2, farg3) &
 bind(C, name="_wrap_FSplittingStepGetNumEvolves") &
 result(fresult)
@@ -927,6 +938,25 @@ fresult = swigc_FSplittingStepSetCoefficients(farg1, farg2)
 swig_result = fresult
 end function
 
+function FSplittingStepSetSequentialSteppers(arkode_mem, sequential_method, steppers) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: arkode_mem
+integer(C_INT), intent(in) :: sequential_method
+type(C_PTR), target, intent(inout) :: steppers
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+type(C_PTR) :: farg3 
+
+farg1 = arkode_mem
+farg2 = sequential_method
+farg3 = c_loc(steppers)
+fresult = swigc_FSplittingStepSetSequentialSteppers(farg1, farg2, farg3)
+swig_result = fresult
+end function
+
 function FSplittingStepGetNumEvolves(arkode_mem, partition, evolves) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -1290,6 +1290,26 @@ SWIGEXPORT int _wrap_FARKodeGetDky(void *farg1, double const *farg2, int const *
 }
 
 
+SWIGEXPORT int _wrap_FARKodeGetDkyBatch(void *farg1, int const *farg2, double *farg3, int const *farg4, void *farg5) {
+  int fresult ;
+  void *arg1 = (void *) 0 ;
+  int arg2 ;
+  sunrealtype *arg3 = (sunrealtype *) 0 ;
+  int arg4 ;
+  N_Vector *arg5 = (N_Vector *) 0 ;
+  int result;
+  
+  arg1 = (void *)(farg1);
+  arg2 = (int)(*farg2);
+  arg3 = (sunrealtype *)(farg3);
+  arg4 = (int)(*farg4);
+  arg5 = (N_Vector *)(farg5);
+  result = (int)ARKodeGetDkyBatch(arg1,arg2,arg3,arg4,arg5);
+  fresult = (int)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FARKodeComputeState(void *farg1, N_Vector farg2, N_Vector farg3) {
   int fresult ;
   void *arg1 = (void *) 0 ;
@@ -3222,6 +3242,20 @@ SWIGEXPORT int _wrap_FARKodeSetJacFn(void *farg1, ARKLsJacFn farg2) {
 }
 
 
+SWIGEXPORT int _wrap_FARKodeSetJacSparsityPattern(void *farg1, SUNMatrix farg2) {
+  int fresult ;
+  void *arg1 = (void *) 0 ;
+  SUNMatrix arg2 = (SUNMatrix) 0 ;
+  int result;
+  
+  arg1 = (void *)(farg1);
+  arg2 = (SUNMatrix)(farg2);
+  result = (int)ARKodeSetJacSparsityPattern(arg1,arg2);
+  fresult = (int)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FARKodeSetMassFn(void *farg1, ARKLsMassFn farg2) {
   int fresult ;
   void *arg1 = (void *) 0 ;
@@ -3250,6 +3284,22 @@ SWIGEXPORT int _wrap_FARKodeSetJacEvalFrequency(void *farg1, long const *farg2)
 }
 
 
+SWIGEXPORT int _wrap_FARKodeSetJacReuseOnReset(void *farg1, double const *farg2, double const *farg3) {
+  int fresult ;
+  void *arg1 = (void *) 0 ;
+  sunrealtype arg2 ;
+  sunrealtype arg3 ;
+  int result;
+  
+  arg1 = (void *)(farg1);
+  arg2 = (sunrealtype)(*farg2);
+  arg3 = (sunrealtype)(*farg3);
+  result = (int)ARKodeSetJacReuseOnReset(arg1,arg2,arg3);
+  fresult = (int)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FARKodeSetLinearSolutionScaling(void *farg1, int const *farg2) {
   int fresult ;
   void *arg1 = (void *) 0 ;
@@ -3382,6 +3432,20 @@ SWIGEXPORT int _wrap_FARKodeSetJacTimesRhsFn(void *farg1, ARKRhsFn farg2) {
 }
 
 
+SWIGEXPORT int _wrap_FARKodeSetJacTimesDirDeriv(void *farg1, ARKLsJacTimesDirDerivFn farg2) {
+  int fresult ;
+  void *arg1 = (void *) 0 ;
+  ARKLsJacTimesDirDerivFn arg2 = (ARKLsJacTimesDirDerivFn) 0 ;
+  int result;
+  
+  arg1 = (void *)(farg1);
+  arg2 = (ARKLsJacTimesDirDerivFn)(farg2);
+  result = (int)ARKodeSetJacTimesDirDeriv(arg1,arg2);
+  fresult = (int)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FARKodeSetMassTimes(void *farg1, ARKLsMassTimesSetupFn farg2, ARKLsMassTimesVecFn farg3, void *farg4) {
   int fresult ;
   void *arg1 = (void *) 0 ;
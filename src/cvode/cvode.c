@@ -104,28 +104,13 @@
  *
  *    FUZZ_FACTOR fuzz factor used to estimate infinitesimal time intervals
  *
- * cvHin
- *
- *    HLB_FACTOR  factor for upper bound on initial step size
- *    HUB_FACTOR  factor for lower bound on initial step size
- *    H_BIAS      bias factor in selection of initial step size
- *    MAX_ITERS   maximum attempts to compute the initial step size
- *
- * CVodeCreate
- *
- *   CORTES       constant in nonlinear iteration convergence test
+ * The constants of cvHin and CORTES (CVodeCreate) are shared with the
+ * ensemble integrator and defined in cvode_impl.h.
  *
  */
 
 #define FUZZ_FACTOR SUN_RCONST(100.0)
 
-#define HLB_FACTOR SUN_RCONST(100.0)
-#define HUB_FACTOR SUN_RCONST(0.1)
-#define H_BIAS     HALF
-#define MAX_ITERS  4
-
-#define CORTES SUN_RCONST(0.1)
-
 /*=================================================================*/
 /* Private Helper Functions Prototypes                             */
 /*=================================================================*/
@@ -165,14 +150,18 @@ static void cvDecreaseBDF(CVodeMem cv_mem);
 static void cvPredict(CVodeMem cv_mem);
 static void cvSet(CVodeMem cv_mem);
 static void cvSetAdams(CVodeMem cv_mem);
-static sunrealtype cvAdamsStart(CVodeMem cv_mem, sunrealtype m[]);
-static void cvAdamsFinish(CVodeMem cv_mem, sunrealtype m[], sunrealtype M[],
-                          sunrealtype hsum);
+static sunrealtype cvAdamsStart(int q, int qwait, sunrealtype h,
+                                const sunrealtype tau[], sunrealtype m[],
+                                sunrealtype tq[]);
+static void cvAdamsFinish(int q, int qwait, sunrealtype h, sunrealtype m[],
+                          sunrealtype M[], sunrealtype hsum, sunrealtype l[],
+                          sunrealtype tq[]);
 static sunrealtype cvAltSum(int iend, sunrealtype a[], int k);
 static void cvSetBDF(CVodeMem cv_mem);
-static void cvSetTqBDF(CVodeMem cv_mem, sunrealtype hsum, sunrealtype alpha0,
-                       sunrealtype alpha0_hat, sunrealtype xi_inv,
-                       sunrealtype xistar_inv);
+static void cvSetTqBDF(int q, int qwait, sunrealtype h, const sunrealtype tau[],
+                       const sunrealtype l[], sunrealtype tq[], sunrealtype hsum,
+                       sunrealtype alpha0, sunrealtype alpha0_hat,
+                       sunrealtype xi_inv, sunrealtype xistar_inv);
 
 /* Nonlinear solver functions */
 
@@ -194,8 +183,7 @@ static int cvDoErrorTest(CVodeMem cv_mem, int* nflagPtr, sunrealtype saved_t,
 static void cvCompleteStep(CVodeMem cv_mem);
 static void cvPrepareNextStep(CVodeMem cv_mem, sunrealtype dsm);
 static void cvSetEta(CVodeMem cv_mem);
-static sunrealtype cvComputeEtaqm1(CVodeMem cv_mem);
-static sunrealtype cvComputeEtaqp1(CVodeMem cv_mem);
+static void cvComputeEtaqm1qp1(CVodeMem cv_mem);
 static void cvChooseEta(CVodeMem cv_mem);
 
 /* Function to handle failures */
@@ -358,7 +346,8 @@ void* CVodeCreate(int lmm, SUNContext sunctx)
   cv_mem->ownNLS = SUNFALSE;
 
   /* Initialize fused operations variable */
-  cv_mem->cv_usefused = SUNFALSE;
+  cv_mem->cv_usefused    = SUNFALSE;
+  cv_mem->cv_usefusedcpu = SUNFALSE;
 
   /* Return pointer to CVODE memory block */
 
@@ -1755,6 +1744,138 @@ int CVodeGetDky(void* cvode_mem, sunrealtype t, int k, N_Vector dky)
   return (CV_SUCCESS);
 }
 
+/*
+ * CVodeGetDkyBatch
+ *
+ * This routine computes the k-th derivative of the interpolating
+ * polynomial at each of the nt times t[m] and stores the results in
+ * the vectors dky[m]. All of the times must satisfy the same
+ * conditions as for CVodeGetDky.
+ *
+ * The coefficients c(j,k) * ((t[m] - tn)/h)^(j-k) * h^(-k) are
+ * computed for all of the times at once and the outputs are formed
+ * with one fused vector operation per Nordsieck array column, rather
+ * than one linear combination of the columns per output time.
+ */
+
+int CVodeGetDkyBatch(void* cvode_mem, int nt, sunrealtype* t, int k,
+                     N_Vector* dky)
+{
+  sunrealtype s, r, cjk;
+  sunrealtype tfuzz, tp, tn1;
+  sunrealtype* c;
+  N_Vector* X;
+  int i, j, m, ncol, ier;
+  CVodeMem cv_mem;
+
+  /* Check all inputs for legality */
+
+  if (cvode_mem == NULL)
+  {
+    cvProcessError(NULL, CV_MEM_NULL, __LINE__, __func__, __FILE__, MSGCV_NO_MEM);
+    return (CV_MEM_NULL);
+  }
+  cv_mem = (CVodeMem)cvode_mem;
+
+  SUNDIALS_MARK_FUNCTION_BEGIN(CV_PROFILER);
+
+  if ((nt < 1) || (t == NULL))
+  {
+    cvProcessError(cv_mem, CV_ILL_INPUT, __LINE__, __func__, __FILE__,
+                   "nt must be positive and t must be non-NULL.");
+    SUNDIALS_MARK_FUNCTION_END(CV_PROFILER);
+    return (CV_ILL_INPUT);
+  }
+
+  if (dky == NULL)
+  {
+    cvProcessError(cv_mem, CV_BAD_DKY, __LINE__, __func__, __FILE__,
+                   MSGCV_NULL_DKY);
+    SUNDIALS_MARK_FUNCTION_END(CV_PROFILER);
+    return (CV_BAD_DKY);
+  }
+  for (m = 0; m < nt; m++)
+  {
+    if (dky[m] == NULL)
+    {
+      cvProcessError(cv_mem, CV_BAD_DKY, __LINE__, __func__, __FILE__,
+                     MSGCV_NULL_DKY);
+      SUNDIALS_MARK_FUNCTION_END(CV_PROFILER);
+      return (CV_BAD_DKY);
+    }
+  }
+
+  if ((k < 0) || (k > cv_mem->cv_q))
+  {
+    cvProcessError(cv_mem, CV_BAD_K, __LINE__, __func__, __FILE__, MSGCV_BAD_K);
+    SUNDIALS_MARK_FUNCTION_END(CV_PROFILER);
+    return (CV_BAD_K);
+  }
+
+  /* Allow for some slack */
+  tfuzz = FUZZ_FACTOR * cv_mem->cv_uround *
+          (SUNRabs(cv_mem->cv_tn) + SUNRabs(cv_mem->cv_hu));
+  if (cv_mem->cv_hu < ZERO) { tfuzz = -tfuzz; }
+  tp  = cv_mem->cv_tn - cv_mem->cv_hu - tfuzz;
+  tn1 = cv_mem->cv_tn + tfuzz;
+  for (m = 0; m < nt; m++)
+  {
+    if ((t[m] - tp) * (t[m] - tn1) > ZERO)
+    {
+      cvProcessError(cv_mem, CV_BAD_T, __LINE__, __func__, __FILE__,
+                     MSGCV_BAD_T, t[m], cv_mem->cv_tn - cv_mem->cv_hu,
+                     cv_mem->cv_tn);
+      SUNDIALS_MARK_FUNCTION_END(CV_PROFILER);
+      return (CV_BAD_T);
+    }
+  }
+
+  /* Allocate the coefficient table, c[(q-j)*nt+m] multiplies zn[j] in
+     dky[m], and an array repeating zn[q] for the first column */
+  ncol = cv_mem->cv_q - k + 1;
+  c    = (sunrealtype*)malloc((size_t)ncol * (size_t)nt * sizeof(sunrealtype));
+  X    = (N_Vector*)malloc((size_t)nt * sizeof(N_Vector));
+  if ((c == NULL) || (X == NULL))
+  {
+    free(c);
+    free(X);
+    cvProcessError(cv_mem, CV_MEM_FAIL, __LINE__, __func__, __FILE__,
+                   MSGCV_MEM_FAIL);
+    SUNDIALS_MARK_FUNCTION_END(CV_PROFILER);
+    return (CV_MEM_FAIL);
+  }
+
+  /* Compute the coefficients for all times, including the h^(-k) scaling */
+  r = (k == 0) ? ONE : SUNRpowerI(cv_mem->cv_h, -k);
+  for (m = 0; m < nt; m++)
+  {
+    s = (t[m] - cv_mem->cv_tn) / cv_mem->cv_h;
+    for (j = cv_mem->cv_q; j >= k; j--)
+    {
+      cjk = r;
+      for (i = j; i >= j - k + 1; i--) { cjk *= i; }
+      for (i = 0; i < j - k; i++) { cjk *= s; }
+      c[(cv_mem->cv_q - j) * nt + m] = cjk;
+    }
+    X[m] = cv_mem->cv_zn[cv_mem->cv_q];
+  }
+
+  /* Sum the differentiated interpolating polynomials */
+  ier = N_VScaleVectorArray(nt, c, X, dky);
+  for (j = cv_mem->cv_q - 1; (ier == 0) && (j >= k); j--)
+  {
+    ier = N_VScaleAddMulti(nt, c + (cv_mem->cv_q - j) * nt, cv_mem->cv_zn[j],
+                           dky, dky);
+  }
+
+  free(c);
+  free(X);
+
+  SUNDIALS_MARK_FUNCTION_END(CV_PROFILER);
+  if (ier != 0) { return (CV_VECTOROP_ERR); }
+  return (CV_SUCCESS);
+}
+
 /*
  * CVodeComputeState
  *
@@ -2579,8 +2700,7 @@ static void cvAdjustOrder(CVodeMem cv_mem, int deltaq)
 
 static void cvAdjustAdams(CVodeMem cv_mem, int deltaq)
 {
-  int i, j;
-  sunrealtype xi, hsum;
+  int j;
 
   /* On an order increase, set new column of zn to zero and return */
 
@@ -2599,23 +2719,8 @@ static void cvAdjustAdams(CVodeMem cv_mem, int deltaq)
    * where xi_j = [t_n - t_(n-j)]/h => xi_0 = 0
    */
 
-  for (i = 0; i <= cv_mem->cv_qmax; i++) { cv_mem->cv_l[i] = ZERO; }
-  cv_mem->cv_l[1] = ONE;
-  hsum            = ZERO;
-  for (j = 1; j <= cv_mem->cv_q - 2; j++)
-  {
-    hsum += cv_mem->cv_tau[j];
-    xi = hsum / cv_mem->cv_hscale;
-    for (i = j + 1; i >= 1; i--)
-    {
-      cv_mem->cv_l[i] = cv_mem->cv_l[i] * xi + cv_mem->cv_l[i - 1];
-    }
-  }
-
-  for (j = 1; j <= cv_mem->cv_q - 2; j++)
-  {
-    cv_mem->cv_l[j + 1] = cv_mem->cv_q * (cv_mem->cv_l[j] / (j + 1));
-  }
+  cvDecreaseAdamsCoeffs(cv_mem->cv_q, cv_mem->cv_qmax, cv_mem->cv_hscale,
+                        cv_mem->cv_tau, cv_mem->cv_l);
 
   for (j = 2; j < cv_mem->cv_q; j++)
   {
@@ -2630,6 +2735,34 @@ static void cvAdjustAdams(CVodeMem cv_mem, int deltaq)
   }
 }
 
+/*
+ * cvDecreaseAdamsCoeffs
+ *
+ * This routine computes in l[2], ..., l[q-1] the coefficients of the
+ * history array adjustment on an order decrease in the case that
+ * lmm == CV_ADAMS, from the order q, the step size hscale the history
+ * array is scaled to, and the step size history tau.
+ */
+
+void cvDecreaseAdamsCoeffs(int q, int qmax, sunrealtype hscale,
+                           const sunrealtype tau[], sunrealtype l[])
+{
+  int i, j;
+  sunrealtype xi, hsum;
+
+  for (i = 0; i <= qmax; i++) { l[i] = ZERO; }
+  l[1] = ONE;
+  hsum = ZERO;
+  for (j = 1; j <= q - 2; j++)
+  {
+    hsum += tau[j];
+    xi = hsum / hscale;
+    for (i = j + 1; i >= 1; i--) { l[i] = l[i] * xi + l[i - 1]; }
+  }
+
+  for (j = 1; j <= q - 2; j++) { l[j + 1] = q * (l[j] / (j + 1)); }
+}
+
 /*
  * cvAdjustBDF
  *
@@ -2662,30 +2795,10 @@ static void cvAdjustBDF(CVodeMem cv_mem, int deltaq)
 
 static void cvIncreaseBDF(CVodeMem cv_mem)
 {
-  sunrealtype alpha0, alpha1, prod, xi, xiold, hsum, A1;
-  int i, j;
+  sunrealtype A1;
 
-  for (i = 0; i <= cv_mem->cv_qmax; i++) { cv_mem->cv_l[i] = ZERO; }
-  cv_mem->cv_l[2] = alpha1 = prod = xiold = ONE;
-  alpha0                                  = -ONE;
-  hsum                                    = cv_mem->cv_hscale;
-  if (cv_mem->cv_q > 1)
-  {
-    for (j = 1; j < cv_mem->cv_q; j++)
-    {
-      hsum += cv_mem->cv_tau[j + 1];
-      xi = hsum / cv_mem->cv_hscale;
-      prod *= xi;
-      alpha0 -= ONE / (j + 1);
-      alpha1 += ONE / xi;
-      for (i = j + 2; i >= 2; i--)
-      {
-        cv_mem->cv_l[i] = cv_mem->cv_l[i] * xiold + cv_mem->cv_l[i - 1];
-      }
-      xiold = xi;
-    }
-  }
-  A1 = (-alpha0 - alpha1) / prod;
+  A1 = cvIncreaseBDFCoeffs(cv_mem->cv_q, cv_mem->cv_qmax, cv_mem->cv_hscale,
+                           cv_mem->cv_tau, cv_mem->cv_l);
   N_VScale(A1, cv_mem->cv_zn[cv_mem->cv_indx_acor], cv_mem->cv_zn[cv_mem->cv_L]);
 
   /* for (j=2; j <= cv_mem->cv_q; j++) */
@@ -2697,6 +2810,41 @@ static void cvIncreaseBDF(CVodeMem cv_mem)
   }
 }
 
+/*
+ * cvIncreaseBDFCoeffs
+ *
+ * This routine computes in l[2], ..., l[q] the coefficients of the
+ * history array adjustment on an order increase in the case that
+ * lmm == CV_BDF, and returns the multiple of the saved acor that
+ * forms the new column zn[q+1].
+ */
+
+sunrealtype cvIncreaseBDFCoeffs(int q, int qmax, sunrealtype hscale,
+                                const sunrealtype tau[], sunrealtype l[])
+{
+  sunrealtype alpha0, alpha1, prod, xi, xiold, hsum;
+  int i, j;
+
+  for (i = 0; i <= qmax; i++) { l[i] = ZERO; }
+  l[2] = alpha1 = prod = xiold = ONE;
+  alpha0                       = -ONE;
+  hsum                         = hscale;
+  if (q > 1)
+  {
+    for (j = 1; j < q; j++)
+    {
+      hsum += tau[j + 1];
+      xi = hsum / hscale;
+      prod *= xi;
+      alpha0 -= ONE / (j + 1);
+      alpha1 += ONE / xi;
+      for (i = j + 2; i >= 2; i--) { l[i] = l[i] * xiold + l[i - 1]; }
+      xiold = xi;
+    }
+  }
+  return ((-alpha0 - alpha1) / prod);
+}
+
 /*
  * cvDecreaseBDF
  *
@@ -2709,21 +2857,10 @@ static void cvIncreaseBDF(CVodeMem cv_mem)
 
 static void cvDecreaseBDF(CVodeMem cv_mem)
 {
-  sunrealtype hsum, xi;
-  int i, j;
+  int j;
 
-  for (i = 0; i <= cv_mem->cv_qmax; i++) { cv_mem->cv_l[i] = ZERO; }
-  cv_mem->cv_l[2] = ONE;
-  hsum            = ZERO;
-  for (j = 1; j <= cv_mem->cv_q - 2; j++)
-  {
-    hsum += cv_mem->cv_tau[j];
-    xi = hsum / cv_mem->cv_hscale;
-    for (i = j + 2; i >= 2; i--)
-    {
-      cv_mem->cv_l[i] = cv_mem->cv_l[i] * xi + cv_mem->cv_l[i - 1];
-    }
-  }
+  cvDecreaseBDFCoeffs(cv_mem->cv_q, cv_mem->cv_qmax, cv_mem->cv_hscale,
+                      cv_mem->cv_tau, cv_mem->cv_l);
 
   for (j = 2; j < cv_mem->cv_q; j++)
   {
@@ -2738,6 +2875,31 @@ static void cvDecreaseBDF(CVodeMem cv_mem)
   }
 }
 
+/*
+ * cvDecreaseBDFCoeffs
+ *
+ * This routine computes in l[2], ..., l[q-1] the coefficients of the
+ * history array adjustment on an order decrease in the case that
+ * lmm == CV_BDF.
+ */
+
+void cvDecreaseBDFCoeffs(int q, int qmax, sunrealtype hscale,
+                         const sunrealtype tau[], sunrealtype l[])
+{
+  sunrealtype hsum, xi;
+  int i, j;
+
+  for (i = 0; i <= qmax; i++) { l[i] = ZERO; }
+  l[2] = ONE;
+  hsum = ZERO;
+  for (j = 1; j <= q - 2; j++)
+  {
+    hsum += tau[j];
+    xi = hsum / hscale;
+    for (i = j + 2; i >= 2; i--) { l[i] = l[i] * xi + l[i - 1]; }
+  }
+}
+
 /*
  * cvRescale
  *
@@ -2853,24 +3015,40 @@ static void cvSet(CVodeMem cv_mem)
  */
 
 static void cvSetAdams(CVodeMem cv_mem)
+{
+  cvSetAdamsCoeffs(cv_mem->cv_q, cv_mem->cv_qwait, cv_mem->cv_h, cv_mem->cv_tau,
+                   cv_mem->cv_l, cv_mem->cv_tq);
+  cv_mem->cv_tq[4] = cv_mem->cv_nlscoef / cv_mem->cv_tq[2]; /* = 0.1 / tq[2] */
+}
+
+/*
+ * cvSetAdamsCoeffs
+ *
+ * This routine computes l[0], ..., l[q] and the test quantities
+ * tq[1], tq[2], tq[3], and tq[5] for the case lmm == CV_ADAMS from
+ * the order q, qwait, the step size h, and the step size history tau.
+ * The caller sets tq[4] from its nonlinear convergence coefficient.
+ */
+
+void cvSetAdamsCoeffs(int q, int qwait, sunrealtype h, const sunrealtype tau[],
+                      sunrealtype l[], sunrealtype tq[])
 {
   sunrealtype m[L_MAX], M[3], hsum;
 
-  if (cv_mem->cv_q == 1)
+  if (q == 1)
   {
-    cv_mem->cv_l[0] = cv_mem->cv_l[1] = cv_mem->cv_tq[1] = cv_mem->cv_tq[5] = ONE;
-    cv_mem->cv_tq[2] = HALF;
-    cv_mem->cv_tq[3] = ONE / TWELVE;
-    cv_mem->cv_tq[4] = cv_mem->cv_nlscoef / cv_mem->cv_tq[2]; /* = 0.1 / tq[2] */
+    l[0] = l[1] = tq[1] = tq[5] = ONE;
+    tq[2]                       = HALF;
+    tq[3]                       = ONE / TWELVE;
     return;
   }
 
-  hsum = cvAdamsStart(cv_mem, m);
+  hsum = cvAdamsStart(q, qwait, h, tau, m, tq);
 
-  M[0] = cvAltSum(cv_mem->cv_q - 1, m, 1);
-  M[1] = cvAltSum(cv_mem->cv_q - 1, m, 2);
+  M[0] = cvAltSum(q - 1, m, 1);
+  M[1] = cvAltSum(q - 1, m, 2);
 
-  cvAdamsFinish(cv_mem, m, M, hsum);
+  cvAdamsFinish(q, qwait, h, m, M, hsum, l, tq);
 }
 
 /*
@@ -2880,24 +3058,26 @@ static void cvSetAdams(CVodeMem cv_mem)
  * polynomial needed for the Adams l and tq coefficients for q > 1.
  */
 
-static sunrealtype cvAdamsStart(CVodeMem cv_mem, sunrealtype m[])
+static sunrealtype cvAdamsStart(int q, int qwait, sunrealtype h,
+                                const sunrealtype tau[], sunrealtype m[],
+                                sunrealtype tq[])
 {
   sunrealtype hsum, xi_inv, sum;
   int i, j;
 
-  hsum = cv_mem->cv_h;
+  hsum = h;
   m[0] = ONE;
-  for (i = 1; i <= cv_mem->cv_q; i++) { m[i] = ZERO; }
-  for (j = 1; j < cv_mem->cv_q; j++)
+  for (i = 1; i <= q; i++) { m[i] = ZERO; }
+  for (j = 1; j < q; j++)
   {
-    if ((j == cv_mem->cv_q - 1) && (cv_mem->cv_qwait == 1))
+    if ((j == q - 1) && (qwait == 1))
     {
-      sum              = cvAltSum(cv_mem->cv_q - 2, m, 2);
-      cv_mem->cv_tq[1] = cv_mem->cv_q * sum / m[cv_mem->cv_q - 2];
+      sum   = cvAltSum(q - 2, m, 2);
+      tq[1] = q * sum / m[q - 2];
     }
-    xi_inv = cv_mem->cv_h / hsum;
+    xi_inv = h / hsum;
     for (i = j; i >= 1; i--) { m[i] += m[i - 1] * xi_inv; }
-    hsum += cv_mem->cv_tau[j];
+    hsum += tau[j];
     /* The m[i] are coefficients of product(1 to j) (1 + x/xi_i) */
   }
   return (hsum);
@@ -2909,33 +3089,29 @@ static sunrealtype cvAdamsStart(CVodeMem cv_mem, sunrealtype m[])
  * This routine completes the calculation of the Adams l and tq.
  */
 
-static void cvAdamsFinish(CVodeMem cv_mem, sunrealtype m[], sunrealtype M[],
-                          sunrealtype hsum)
+static void cvAdamsFinish(int q, int qwait, sunrealtype h, sunrealtype m[],
+                          sunrealtype M[], sunrealtype hsum, sunrealtype l[],
+                          sunrealtype tq[])
 {
   int i;
   sunrealtype M0_inv, xi, xi_inv;
 
   M0_inv = ONE / M[0];
 
-  cv_mem->cv_l[0] = ONE;
-  for (i = 1; i <= cv_mem->cv_q; i++)
-  {
-    cv_mem->cv_l[i] = M0_inv * (m[i - 1] / i);
-  }
-  xi     = hsum / cv_mem->cv_h;
+  l[0] = ONE;
+  for (i = 1; i <= q; i++) { l[i] = M0_inv * (m[i - 1] / i); }
+  xi     = hsum / h;
   xi_inv = ONE / xi;
 
-  cv_mem->cv_tq[2] = M[1] * M0_inv / xi;
-  cv_mem->cv_tq[5] = xi / cv_mem->cv_l[cv_mem->cv_q];
+  tq[2] = M[1] * M0_inv / xi;
+  tq[5] = xi / l[q];
 
-  if (cv_mem->cv_qwait == 1)
+  if (qwait == 1)
   {
-    for (i = cv_mem->cv_q; i >= 1; i--) { m[i] += m[i - 1] * xi_inv; }
-    M[2]             = cvAltSum(cv_mem->cv_q, m, 2);
-    cv_mem->cv_tq[3] = M[2] * M0_inv / cv_mem->cv_L;
+    for (i = q; i >= 1; i--) { m[i] += m[i - 1] * xi_inv; }
+    M[2]  = cvAltSum(q, m, 2);
+    tq[3] = M[2] * M0_inv / (q + 1);
   }
-
-  cv_mem->cv_tq[4] = cv_mem->cv_nlscoef / cv_mem->cv_tq[2];
 }
 
 /*
@@ -2969,8 +3145,25 @@ static sunrealtype cvAltSum(int iend, sunrealtype a[], int k)
  * cvSetBDF
  *
  * This routine computes the coefficients l and tq in the case
- * lmm == CV_BDF.  cvSetBDF calls cvSetTqBDF to set the test
- * quantity array tq.
+ * lmm == CV_BDF, and the projection coefficients p if projection
+ * is enabled.
+ */
+
+static void cvSetBDF(CVodeMem cv_mem)
+{
+  cvSetBDFCoeffs(cv_mem->cv_q, cv_mem->cv_qwait, cv_mem->cv_h, cv_mem->cv_tau,
+                 cv_mem->cv_l, cv_mem->cv_tq,
+                 cv_mem->proj_enabled ? cv_mem->proj_p : NULL);
+  cv_mem->cv_tq[4] = cv_mem->cv_nlscoef / cv_mem->cv_tq[2];
+}
+
+/*
+ * cvSetBDFCoeffs
+ *
+ * This routine computes l[0], ..., l[q] and, if p is not NULL, the
+ * projection coefficients p[0], ..., p[q] in the case lmm == CV_BDF.
+ * cvSetBDFCoeffs calls cvSetTqBDF to set the test quantities tq[1],
+ * tq[2], tq[3], and tq[5]. The caller sets tq[4].
  *
  * The components of the array l are the coefficients of a
  * polynomial Lambda(x) = l_0 + l_1 x + ... + l_q x^q, given by
@@ -2991,57 +3184,50 @@ static sunrealtype cvAltSum(int iend, sunrealtype a[], int k)
  * test, the error test, and the selection of h at a new order.
  */
 
-static void cvSetBDF(CVodeMem cv_mem)
+void cvSetBDFCoeffs(int q, int qwait, sunrealtype h, const sunrealtype tau[],
+                    sunrealtype l[], sunrealtype tq[], sunrealtype p[])
 {
   sunrealtype alpha0, alpha0_hat, xi_inv, xistar_inv, hsum;
   int i, j;
 
-  cv_mem->cv_l[0] = cv_mem->cv_l[1] = xi_inv = xistar_inv = ONE;
-  for (i = 2; i <= cv_mem->cv_q; i++) { cv_mem->cv_l[i] = ZERO; }
+  l[0] = l[1] = xi_inv = xistar_inv = ONE;
+  for (i = 2; i <= q; i++) { l[i] = ZERO; }
   alpha0 = alpha0_hat = -ONE;
-  hsum                = cv_mem->cv_h;
+  hsum                = h;
 
-  if (cv_mem->proj_enabled)
+  if (p)
   {
-    for (i = 0; i <= cv_mem->cv_q; i++) { cv_mem->proj_p[i] = cv_mem->cv_l[i]; }
+    for (i = 0; i <= q; i++) { p[i] = l[i]; }
   }
 
-  if (cv_mem->cv_q > 1)
+  if (q > 1)
   {
-    for (j = 2; j < cv_mem->cv_q; j++)
+    for (j = 2; j < q; j++)
     {
-      hsum += cv_mem->cv_tau[j - 1];
-      xi_inv = cv_mem->cv_h / hsum;
+      hsum += tau[j - 1];
+      xi_inv = h / hsum;
       alpha0 -= ONE / j;
-      for (i = j; i >= 1; i--)
-      {
-        cv_mem->cv_l[i] += cv_mem->cv_l[i - 1] * xi_inv;
-      }
+      for (i = j; i >= 1; i--) { l[i] += l[i - 1] * xi_inv; }
       /* The l[i] are coefficients of product(1 to j) (1 + x/xi_i) */
     }
 
     /* j = q */
-    alpha0 -= ONE / cv_mem->cv_q;
-    xistar_inv = -cv_mem->cv_l[1] - alpha0;
-    hsum += cv_mem->cv_tau[cv_mem->cv_q - 1];
-    xi_inv     = cv_mem->cv_h / hsum;
-    alpha0_hat = -cv_mem->cv_l[1] - xi_inv;
+    alpha0 -= ONE / q;
+    xistar_inv = -l[1] - alpha0;
+    hsum += tau[q - 1];
+    xi_inv     = h / hsum;
+    alpha0_hat = -l[1] - xi_inv;
 
-    if (cv_mem->proj_enabled)
+    if (p)
     {
-      for (i = cv_mem->cv_q; i >= 1; i--)
-      {
-        cv_mem->proj_p[i] = cv_mem->cv_l[i] + cv_mem->proj_p[i - 1] * xi_inv;
-      }
+      for (i = q; i >= 1; i--) { p[i] = l[i] + p[i - 1] * xi_inv; }
     }
 
-    for (i = cv_mem->cv_q; i >= 1; i--)
-    {
-      cv_mem->cv_l[i] += cv_mem->cv_l[i - 1] * xistar_inv;
-    }
+    for (i = q; i >= 1; i--) { l[i] += l[i - 1] * xistar_inv; }
   }
 
-  cvSetTqBDF(cv_mem, hsum, alpha0, alpha0_hat, xi_inv, xistar_inv);
+  cvSetTqBDF(q, qwait, h, tau, l, tq, hsum, alpha0, alpha0_hat, xi_inv,
+             xistar_inv);
 }
 
 /*
@@ -3051,37 +3237,36 @@ static void cvSetBDF(CVodeMem cv_mem)
  * lmm == CV_BDF.
  */
 
-static void cvSetTqBDF(CVodeMem cv_mem, sunrealtype hsum, sunrealtype alpha0,
-                       sunrealtype alpha0_hat, sunrealtype xi_inv,
-                       sunrealtype xistar_inv)
+static void cvSetTqBDF(int q, int qwait, sunrealtype h, const sunrealtype tau[],
+                       const sunrealtype l[], sunrealtype tq[], sunrealtype hsum,
+                       sunrealtype alpha0, sunrealtype alpha0_hat,
+                       sunrealtype xi_inv, sunrealtype xistar_inv)
 {
   sunrealtype A1, A2, A3, A4, A5, A6;
   sunrealtype C, Cpinv, Cppinv;
 
-  A1               = ONE - alpha0_hat + alpha0;
-  A2               = ONE + cv_mem->cv_q * A1;
-  cv_mem->cv_tq[2] = SUNRabs(A1 / (alpha0 * A2));
-  cv_mem->cv_tq[5] =
-    SUNRabs(A2 * xistar_inv / (cv_mem->cv_l[cv_mem->cv_q] * xi_inv));
-  if (cv_mem->cv_qwait == 1)
+  A1    = ONE - alpha0_hat + alpha0;
+  A2    = ONE + q * A1;
+  tq[2] = SUNRabs(A1 / (alpha0 * A2));
+  tq[5] = SUNRabs(A2 * xistar_inv / (l[q] * xi_inv));
+  if (qwait == 1)
   {
-    if (cv_mem->cv_q > 1)
+    if (q > 1)
     {
-      C                = xistar_inv / cv_mem->cv_l[cv_mem->cv_q];
-      A3               = alpha0 + ONE / cv_mem->cv_q;
-      A4               = alpha0_hat + xi_inv;
-      Cpinv            = (ONE - A4 + A3) / A3;
-      cv_mem->cv_tq[1] = SUNRabs(C * Cpinv);
+      C     = xistar_inv / l[q];
+      A3    = alpha0 + ONE / q;
+      A4    = alpha0_hat + xi_inv;
+      Cpinv = (ONE - A4 + A3) / A3;
+      tq[1] = SUNRabs(C * Cpinv);
     }
-    else { cv_mem->cv_tq[1] = ONE; }
-    hsum += cv_mem->cv_tau[cv_mem->cv_q];
-    xi_inv           = cv_mem->cv_h / hsum;
-    A5               = alpha0 - (ONE / (cv_mem->cv_q + 1));
-    A6               = alpha0_hat - xi_inv;
-    Cppinv           = (ONE - A6 + A5) / A2;
-    cv_mem->cv_tq[3] = SUNRabs(Cppinv / (xi_inv * (cv_mem->cv_q + 2) * A5));
+    else { tq[1] = ONE; }
+    hsum += tau[q];
+    xi_inv = h / hsum;
+    A5     = alpha0 - (ONE / (q + 1));
+    A6     = alpha0_hat - xi_inv;
+    Cppinv = (ONE - A6 + A5) / A2;
+    tq[3]  = SUNRabs(Cppinv / (xi_inv * (q + 2) * A5));
   }
-  cv_mem->cv_tq[4] = cv_mem->cv_nlscoef / cv_mem->cv_tq[2];
 }
 
 /*
@@ -3159,17 +3344,25 @@ static int cvNls(CVodeMem cv_mem, int nflag)
 
   /* solve successful */
 
-  /* update the state based on the final correction from the nonlinear solver */
-  N_VLinearSum(ONE, cv_mem->cv_zn[0], ONE, cv_mem->cv_acor, cv_mem->cv_y);
-
-  SUNLogExtraDebugVec(CV_LOGGER, "corrector", cv_mem->cv_y, "y_corrected(:) =");
-
-  /* compute acnrm if is was not already done by the nonlinear solver */
-  if (!cv_mem->cv_acnrmcur)
+  /* update the state based on the final correction from the nonlinear solver
+     and compute acnrm if is was not already done by the nonlinear solver */
+  if (cv_mem->cv_usefusedcpu)
   {
-    cv_mem->cv_acnrm = N_VWrmsNorm(cv_mem->cv_acor, cv_mem->cv_ewt);
+    cvCorrectY_fusedCPU(cv_mem->cv_zn[0], cv_mem->cv_acor, cv_mem->cv_ewt,
+                        cv_mem->cv_y,
+                        cv_mem->cv_acnrmcur ? NULL : &(cv_mem->cv_acnrm));
+  }
+  else
+  {
+    N_VLinearSum(ONE, cv_mem->cv_zn[0], ONE, cv_mem->cv_acor, cv_mem->cv_y);
+    if (!cv_mem->cv_acnrmcur)
+    {
+      cv_mem->cv_acnrm = N_VWrmsNorm(cv_mem->cv_acor, cv_mem->cv_ewt);
+    }
   }
 
+  SUNLogExtraDebugVec(CV_LOGGER, "corrector", cv_mem->cv_y, "y_corrected(:) =");
+
   SUNLogInfo(CV_LOGGER, "end-nonlinear-solve", "status = success, iters = %li",
              nni_inc);
 
@@ -3232,24 +3425,33 @@ static int cvCheckConstraints(CVodeMem cv_mem, int* nflagPtr,
    *
    * 6. Zero out entries where the constraints passed, v = mask * v
    */
-#ifdef SUNDIALS_BUILD_PACKAGE_FUSED_KERNELS
-  if (cv_mem->cv_usefused)
+  sunrealtype vnorm;
+  if (cv_mem->cv_usefusedcpu)
   {
-    cvCheckConstraints_fused(cv_mem->cv_constraints, cv_mem->cv_ewt,
-                             cv_mem->cv_y, mm, tmp, cv_mem->cv_vtemp1);
+    cvCheckConstraints_fusedCPU(cv_mem->cv_constraints, cv_mem->cv_ewt,
+                                cv_mem->cv_y, mm, tmp, cv_mem->cv_vtemp1, &vnorm);
   }
   else
-#endif
   {
-    N_VCompare(ONEPT5, cv_mem->cv_constraints, tmp);
-    N_VProd(tmp, cv_mem->cv_constraints, tmp);
-    N_VDiv(tmp, cv_mem->cv_ewt, tmp);
-    N_VScale(-PT1, tmp, cv_mem->cv_vtemp1);
-    N_VLinearSum(ONE, cv_mem->cv_y, -PT1, tmp, tmp);
-    N_VProd(tmp, mm, tmp);
-  }
+#ifdef SUNDIALS_BUILD_PACKAGE_FUSED_KERNELS
+    if (cv_mem->cv_usefused)
+    {
+      cvCheckConstraints_fused(cv_mem->cv_constraints, cv_mem->cv_ewt,
+                               cv_mem->cv_y, mm, tmp, cv_mem->cv_vtemp1);
+    }
+    else
+#endif
+    {
+      N_VCompare(ONEPT5, cv_mem->cv_constraints, tmp);
+      N_VProd(tmp, cv_mem->cv_constraints, tmp);
+      N_VDiv(tmp, cv_mem->cv_ewt, tmp);
+      N_VScale(-PT1, tmp, cv_mem->cv_vtemp1);
+      N_VLinearSum(ONE, cv_mem->cv_y, -PT1, tmp, tmp);
+      N_VProd(tmp, mm, tmp);
+    }
 
-  sunrealtype vnorm = N_VWrmsNorm(tmp, cv_mem->cv_ewt); /* ||v|| */
+    vnorm = N_VWrmsNorm(tmp, cv_mem->cv_ewt); /* ||v|| */
+  }
 
   /* If constraint correction vector is small in norm (satisfies the nonlinear
      solver convergence condition with R = 1), correct and accept this step */
@@ -3644,9 +3846,8 @@ static void cvPrepareNextStep(CVodeMem cv_mem, sunrealtype dsm)
       /* If qwait = 0, consider an order change.   etaqm1 and etaqp1 are
         the ratios of new to old h at orders q-1 and q+1, respectively.
         cvChooseEta selects the largest; cvSetEta adjusts eta and acor */
-      cv_mem->cv_qwait  = 2;
-      cv_mem->cv_etaqm1 = cvComputeEtaqm1(cv_mem);
-      cv_mem->cv_etaqp1 = cvComputeEtaqp1(cv_mem);
+      cv_mem->cv_qwait = 2;
+      cvComputeEtaqm1qp1(cv_mem);
       cvChooseEta(cv_mem);
       cvSetEta(cv_mem);
     }
@@ -3677,20 +3878,10 @@ static void cvSetEta(CVodeMem cv_mem)
   }
   else
   {
-    if (cv_mem->cv_eta >= cv_mem->cv_eta_max_fx)
-    {
-      /* Increase the step size, limit eta by etamax and hmax */
-      cv_mem->cv_eta = SUNMIN(cv_mem->cv_eta, cv_mem->cv_etamax);
-      cv_mem->cv_eta /= SUNMAX(ONE, SUNRabs(cv_mem->cv_h) *
-                                      cv_mem->cv_hmax_inv * cv_mem->cv_eta);
-    }
-    else
-    {
-      /* Reduce the step size, limit eta by etamin and hmin */
-      cv_mem->cv_eta = SUNMAX(cv_mem->cv_eta, cv_mem->cv_eta_min);
-      cv_mem->cv_eta = SUNMAX(cv_mem->cv_eta,
-                              cv_mem->cv_hmin / SUNRabs(cv_mem->cv_h));
-    }
+    cv_mem->cv_eta = cvLimitEta(cv_mem->cv_eta, cv_mem->cv_etamax,
+                                cv_mem->cv_eta_max_fx, cv_mem->cv_eta_min,
+                                cv_mem->cv_h, cv_mem->cv_hmin,
+                                cv_mem->cv_hmax_inv);
     /* Set hprime */
     cv_mem->cv_hprime = cv_mem->cv_h * cv_mem->cv_eta;
     if (cv_mem->cv_qprime < cv_mem->cv_q) { cv_mem->cv_nscon = 0; }
@@ -3698,51 +3889,100 @@ static void cvSetEta(CVodeMem cv_mem)
 }
 
 /*
- * cvComputeEtaqm1
+ * cvLimitEta
  *
- * This routine computes and returns the value of etaqm1 for a
- * possible decrease in order by 1.
+ * This routine limits a step size ratio eta outside of the fixed step
+ * bounds. An increase (eta >= eta_max_fx) is limited by etamax and
+ * hmax, a decrease by eta_min and hmin.
  */
 
-static sunrealtype cvComputeEtaqm1(CVodeMem cv_mem)
+sunrealtype cvLimitEta(sunrealtype eta, sunrealtype etamax,
+                       sunrealtype eta_max_fx, sunrealtype eta_min,
+                       sunrealtype h, sunrealtype hmin, sunrealtype hmax_inv)
 {
-  sunrealtype ddn;
-
-  cv_mem->cv_etaqm1 = ZERO;
-  if (cv_mem->cv_q > 1)
+  if (eta >= eta_max_fx)
   {
-    ddn = N_VWrmsNorm(cv_mem->cv_zn[cv_mem->cv_q], cv_mem->cv_ewt) *
-          cv_mem->cv_tq[1];
-    cv_mem->cv_etaqm1 = ONE /
-                        (SUNRpowerR(BIAS1 * ddn, ONE / cv_mem->cv_q) + ADDON);
+    /* Increase the step size, limit eta by etamax and hmax */
+    eta = SUNMIN(eta, etamax);
+    eta /= SUNMAX(ONE, SUNRabs(h) * hmax_inv * eta);
   }
-  return (cv_mem->cv_etaqm1);
+  else
+  {
+    /* Reduce the step size, limit eta by etamin and hmin */
+    eta = SUNMAX(eta, eta_min);
+    eta = SUNMAX(eta, hmin / SUNRabs(h));
+  }
+  return (eta);
 }
 
 /*
- * cvComputeEtaqp1
+ * cvComputeEtaqm1qp1
  *
- * This routine computes and returns the value of etaqp1 for a
- * possible increase in order by 1.
+ * This routine computes the values of etaqm1 and etaqp1 for a
+ * possible decrease or increase in order by 1. The WRMS norms
+ * needed by both are computed together so that, with distributed
+ * vectors, they require a single global reduction.
  */
 
-static sunrealtype cvComputeEtaqp1(CVodeMem cv_mem)
+static void cvComputeEtaqm1qp1(CVodeMem cv_mem)
 {
-  sunrealtype dup, cquot;
+  N_Vector X[2], W[2];
+  sunrealtype nrm[2], cquot;
+  int nvec, iqm1, iqp1;
 
+  cv_mem->cv_etaqm1 = ZERO;
   cv_mem->cv_etaqp1 = ZERO;
-  if (cv_mem->cv_q != cv_mem->cv_qmax)
+
+  nvec = 0;
+  iqm1 = iqp1 = -1;
+
+  /* Norm of zn[q] for order q-1 */
+  if (cv_mem->cv_q > 1)
+  {
+    X[nvec] = cv_mem->cv_zn[cv_mem->cv_q];
+    W[nvec] = cv_mem->cv_ewt;
+    iqm1    = nvec++;
+  }
+
+  /* Norm of acor - cquot * zn[qmax] for order q+1 */
+  if ((cv_mem->cv_q != cv_mem->cv_qmax) && (cv_mem->cv_saved_tq5 != ZERO))
   {
-    if (cv_mem->cv_saved_tq5 == ZERO) { return (cv_mem->cv_etaqp1); }
     cquot = (cv_mem->cv_tq[5] / cv_mem->cv_saved_tq5) *
             SUNRpowerI(cv_mem->cv_h / cv_mem->cv_tau[2], cv_mem->cv_L);
-    N_VLinearSum(-cquot, cv_mem->cv_zn[cv_mem->cv_qmax], ONE, cv_mem->cv_acor,
-                 cv_mem->cv_tempv);
-    dup = N_VWrmsNorm(cv_mem->cv_tempv, cv_mem->cv_ewt) * cv_mem->cv_tq[3];
+    if (cv_mem->cv_usefusedcpu)
+    {
+      nrm[1] = cvWrmsNormLinearSum_fusedCPU(-cquot,
+                                            cv_mem->cv_zn[cv_mem->cv_qmax], ONE,
+                                            cv_mem->cv_acor, cv_mem->cv_ewt);
+      iqp1   = 1;
+    }
+    else
+    {
+      N_VLinearSum(-cquot, cv_mem->cv_zn[cv_mem->cv_qmax], ONE,
+                   cv_mem->cv_acor, cv_mem->cv_tempv);
+      X[nvec] = cv_mem->cv_tempv;
+      W[nvec] = cv_mem->cv_ewt;
+      iqp1    = nvec++;
+    }
+  }
+
+  if (nvec > 0) { (void)N_VWrmsNormVectorArray(nvec, X, W, nrm); }
+
+  if (iqm1 >= 0)
+  {
+    cv_mem->cv_etaqm1 =
+      ONE / (SUNRpowerR(BIAS1 * (nrm[iqm1] * cv_mem->cv_tq[1]),
+                        ONE / cv_mem->cv_q) +
+             ADDON);
+  }
+
+  if (iqp1 >= 0)
+  {
     cv_mem->cv_etaqp1 =
-      ONE / (SUNRpowerR(BIAS3 * dup, ONE / (cv_mem->cv_L + 1)) + ADDON);
+      ONE / (SUNRpowerR(BIAS3 * (nrm[iqp1] * cv_mem->cv_tq[3]),
+                        ONE / (cv_mem->cv_L + 1)) +
+             ADDON);
   }
-  return (cv_mem->cv_etaqp1);
 }
 
 /*
@@ -3758,46 +3998,64 @@ static sunrealtype cvComputeEtaqp1(CVodeMem cv_mem)
  */
 
 static void cvChooseEta(CVodeMem cv_mem)
+{
+  int deltaq;
+
+  deltaq = cvChooseOrder(cv_mem->cv_etaqm1, cv_mem->cv_etaq, cv_mem->cv_etaqp1,
+                         cv_mem->cv_eta_min_fx, cv_mem->cv_eta_max_fx,
+                         &(cv_mem->cv_eta));
+  cv_mem->cv_qprime = cv_mem->cv_q + deltaq;
+
+  if ((deltaq == 1) && (cv_mem->cv_lmm == CV_BDF))
+  {
+    /*
+     * Store Delta_n in zn[qmax] to be used in order increase
+     *
+     * This happens at the last step of order q before an increase
+     * to order q+1, so it represents Delta_n in the ELTE at q+1
+     */
+
+    N_VScale(ONE, cv_mem->cv_acor, cv_mem->cv_zn[cv_mem->cv_qmax]);
+  }
+}
+
+/*
+ * cvChooseOrder
+ *
+ * This routine returns the order change (-1, 0, or +1) with the
+ * largest of the step size ratios etaqm1, etaq, and etaqp1, and sets
+ * eta to that ratio (or to 1 if it is within the fixed step bounds),
+ * with the preference order of cvChooseEta.
+ */
+
+int cvChooseOrder(sunrealtype etaqm1, sunrealtype etaq, sunrealtype etaqp1,
+                  sunrealtype eta_min_fx, sunrealtype eta_max_fx,
+                  sunrealtype* eta)
 {
   sunrealtype etam;
 
-  etam = SUNMAX(cv_mem->cv_etaqm1, SUNMAX(cv_mem->cv_etaq, cv_mem->cv_etaqp1));
+  etam = SUNMAX(etaqm1, SUNMAX(etaq, etaqp1));
 
-  if ((etam > cv_mem->cv_eta_min_fx) && (etam < cv_mem->cv_eta_max_fx))
+  if ((etam > eta_min_fx) && (etam < eta_max_fx))
   {
-    cv_mem->cv_eta    = ONE;
-    cv_mem->cv_qprime = cv_mem->cv_q;
+    *eta = ONE;
+    return (0);
   }
-  else
+
+  if (etam == etaq)
   {
-    if (etam == cv_mem->cv_etaq)
-    {
-      cv_mem->cv_eta    = cv_mem->cv_etaq;
-      cv_mem->cv_qprime = cv_mem->cv_q;
-    }
-    else if (etam == cv_mem->cv_etaqm1)
-    {
-      cv_mem->cv_eta    = cv_mem->cv_etaqm1;
-      cv_mem->cv_qprime = cv_mem->cv_q - 1;
-    }
-    else
-    {
-      cv_mem->cv_eta    = cv_mem->cv_etaqp1;
-      cv_mem->cv_qprime = cv_mem->cv_q + 1;
+    *eta = etaq;
+    return (0);
+  }
 
-      if (cv_mem->cv_lmm == CV_BDF)
-      {
-        /*
-         * Store Delta_n in zn[qmax] to be used in order increase
-         *
-         * This happens at the last step of order q before an increase
-         * to order q+1, so it represents Delta_n in the ELTE at q+1
-         */
-
-        N_VScale(ONE, cv_mem->cv_acor, cv_mem->cv_zn[cv_mem->cv_qmax]);
-      }
-    }
+  if (etam == etaqm1)
+  {
+    *eta = etaqm1;
+    return (-1);
   }
+
+  *eta = etaqp1;
+  return (1);
 }
 
 /*
@@ -3923,7 +4181,8 @@ static int cvHandleFailure(CVodeMem cv_mem, int flag)
 static void cvBDFStab(CVodeMem cv_mem)
 {
   int i, k, ldflag, factorial;
-  sunrealtype sq, sqm1, sqm2;
+  sunrealtype sq, sqm1, sqm2, nrm[2];
+  N_Vector X[2], W[2];
 
   /* If order is 3 or greater, then save scaled derivative data,
      push old data down in i, then add current values to top.    */
@@ -3941,10 +4200,13 @@ static void cvBDFStab(CVodeMem cv_mem)
     for (i = 1; i <= cv_mem->cv_q - 1; i++) { factorial *= i; }
     sq = factorial * cv_mem->cv_q * (cv_mem->cv_q + 1) * cv_mem->cv_acnrm /
          SUNMAX(cv_mem->cv_tq[5], TINY);
-    sqm1 = factorial * cv_mem->cv_q *
-           N_VWrmsNorm(cv_mem->cv_zn[cv_mem->cv_q], cv_mem->cv_ewt);
-    sqm2 = factorial *
-           N_VWrmsNorm(cv_mem->cv_zn[cv_mem->cv_q - 1], cv_mem->cv_ewt);
+    /* Compute both norms with a single global reduction */
+    X[0] = cv_mem->cv_zn[cv_mem->cv_q];
+    X[1] = cv_mem->cv_zn[cv_mem->cv_q - 1];
+    W[0] = W[1] = cv_mem->cv_ewt;
+    (void)N_VWrmsNormVectorArray(2, X, W, nrm);
+    sqm1 = factorial * cv_mem->cv_q * nrm[0];
+    sqm2 = factorial * nrm[1];
     cv_mem->cv_ssdat[1][1] = sqm2 * sqm2;
     cv_mem->cv_ssdat[1][2] = sqm1 * sqm1;
     cv_mem->cv_ssdat[1][3] = sq * sq;
@@ -4880,6 +5142,12 @@ int cvEwtSet(N_Vector ycur, N_Vector weight, void* data)
 
 static int cvEwtSetSS(CVodeMem cv_mem, N_Vector ycur, N_Vector weight)
 {
+  if (cv_mem->cv_usefusedcpu)
+  {
+    return (cvEwtSetSS_fusedCPU(cv_mem->cv_atolmin0, cv_mem->cv_reltol,
+                                cv_mem->cv_Sabstol, ycur, weight));
+  }
+
 #ifdef SUNDIALS_BUILD_PACKAGE_FUSED_KERNELS
   if (cv_mem->cv_usefused)
   {
@@ -4920,6 +5188,12 @@ static int cvEwtSetSS(CVodeMem cv_mem, N_Vector ycur, N_Vector weight)
 
 static int cvEwtSetSV(CVodeMem cv_mem, N_Vector ycur, N_Vector weight)
 {
+  if (cv_mem->cv_usefusedcpu)
+  {
+    return (cvEwtSetSV_fusedCPU(cv_mem->cv_atolmin0, cv_mem->cv_reltol,
+                                cv_mem->cv_Vabstol, ycur, weight));
+  }
+
 #ifdef SUNDIALS_BUILD_PACKAGE_FUSED_KERNELS
   if (cv_mem->cv_usefused)
   {
@@ -121,7 +121,8 @@ static int cvSetFromCommandLine(void* cvode_mem, const char* cvid, int argc,
 
   static const struct sunKeyTwoRealPair tworeal_pairs[] =
     {{"eta_fixed_step_bounds", CVodeSetEtaFixedStepBounds},
-     {"scalar_tolerances", CVodeSStolerances}};
+     {"scalar_tolerances", CVodeSStolerances},
+     {"jac_reuse_on_reinit", CVodeSetJacReuseOnReInit}};
   static const int num_tworeal_keys = sizeof(tworeal_pairs) /
                                       sizeof(*tworeal_pairs);
 
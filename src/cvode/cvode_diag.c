@@ -316,13 +316,18 @@ static int CVDiagSetup(CVodeMem cv_mem, SUNDIALS_MAYBE_UNUSED int convfail,
 
   /* Form y with perturbation = FRACT*(func. iter. correction) */
   r = FRACT * cv_mem->cv_rl1;
+  if (cv_mem->cv_usefusedcpu)
+  {
+    cvDiagSetup_formY_fusedCPU(cv_mem->cv_h, r, fpred, cv_mem->cv_zn[1], ypred,
+                               ftemp, y);
+  }
 #ifdef SUNDIALS_BUILD_PACKAGE_FUSED_KERNELS
-  if (cv_mem->cv_usefused)
+  else if (cv_mem->cv_usefused)
   {
     cvDiagSetup_formY(cv_mem->cv_h, r, fpred, cv_mem->cv_zn[1], ypred, ftemp, y);
   }
-  else
 #endif
+  else
   {
     N_VLinearSum(cv_mem->cv_h, fpred, -ONE, cv_mem->cv_zn[1], ftemp);
     N_VLinearSum(r, ftemp, ONE, ypred, y);
@@ -345,33 +350,43 @@ static int CVDiagSetup(CVodeMem cv_mem, SUNDIALS_MAYBE_UNUSED int convfail,
   }
 
   /* Construct M = I - gamma*J with J = diag(deltaf_i/deltay_i) */
-#ifdef SUNDIALS_BUILD_PACKAGE_FUSED_KERNELS
-  if (cv_mem->cv_usefused)
+  if (cv_mem->cv_usefusedcpu)
   {
-    cvDiagSetup_buildM(FRACT, cv_mem->cv_uround, cv_mem->cv_h, ftemp, fpred,
-                       cv_mem->cv_ewt, cvdiag_mem->di_bit,
-                       cvdiag_mem->di_bitcomp, y, cvdiag_mem->di_M);
+    /* Construct and invert M in a single pass */
+    invOK = cvDiagSetup_buildM_fusedCPU(FRACT, cv_mem->cv_uround, cv_mem->cv_h,
+                                        ftemp, fpred, cv_mem->cv_ewt,
+                                        cvdiag_mem->di_M);
   }
   else
-#endif
   {
-    N_VLinearSum(ONE, cvdiag_mem->di_M, -ONE, fpred, cvdiag_mem->di_M);
-    N_VLinearSum(FRACT, ftemp, -(cv_mem->cv_h), cvdiag_mem->di_M,
-                 cvdiag_mem->di_M);
-    N_VProd(ftemp, cv_mem->cv_ewt, y);
-    /* Protect against deltay_i being at roundoff level */
-    N_VCompare(cv_mem->cv_uround, y, cvdiag_mem->di_bit);
-    N_VAddConst(cvdiag_mem->di_bit, -ONE, cvdiag_mem->di_bitcomp);
-    N_VProd(ftemp, cvdiag_mem->di_bit, y);
-    N_VLinearSum(FRACT, y, -ONE, cvdiag_mem->di_bitcomp, y);
-    N_VDiv(cvdiag_mem->di_M, y, cvdiag_mem->di_M);
-    N_VProd(cvdiag_mem->di_M, cvdiag_mem->di_bit, cvdiag_mem->di_M);
-    N_VLinearSum(ONE, cvdiag_mem->di_M, -ONE, cvdiag_mem->di_bitcomp,
-                 cvdiag_mem->di_M);
-  }
+#ifdef SUNDIALS_BUILD_PACKAGE_FUSED_KERNELS
+    if (cv_mem->cv_usefused)
+    {
+      cvDiagSetup_buildM(FRACT, cv_mem->cv_uround, cv_mem->cv_h, ftemp, fpred,
+                         cv_mem->cv_ewt, cvdiag_mem->di_bit,
+                         cvdiag_mem->di_bitcomp, y, cvdiag_mem->di_M);
+    }
+    else
+#endif
+    {
+      N_VLinearSum(ONE, cvdiag_mem->di_M, -ONE, fpred, cvdiag_mem->di_M);
+      N_VLinearSum(FRACT, ftemp, -(cv_mem->cv_h), cvdiag_mem->di_M,
+                   cvdiag_mem->di_M);
+      N_VProd(ftemp, cv_mem->cv_ewt, y);
+      /* Protect against deltay_i being at roundoff level */
+      N_VCompare(cv_mem->cv_uround, y, cvdiag_mem->di_bit);
+      N_VAddConst(cvdiag_mem->di_bit, -ONE, cvdiag_mem->di_bitcomp);
+      N_VProd(ftemp, cvdiag_mem->di_bit, y);
+      N_VLinearSum(FRACT, y, -ONE, cvdiag_mem->di_bitcomp, y);
+      N_VDiv(cvdiag_mem->di_M, y, cvdiag_mem->di_M);
+      N_VProd(cvdiag_mem->di_M, cvdiag_mem->di_bit, cvdiag_mem->di_M);
+      N_VLinearSum(ONE, cvdiag_mem->di_M, -ONE, cvdiag_mem->di_bitcomp,
+                   cvdiag_mem->di_M);
+    }
 
-  /* Invert M with test for zero components */
-  invOK = N_VInvTest(cvdiag_mem->di_M, cvdiag_mem->di_M);
+    /* Invert M with test for zero components */
+    invOK = N_VInvTest(cvdiag_mem->di_M, cvdiag_mem->di_M);
+  }
   if (!invOK)
   {
     cvdiag_mem->di_last_flag = CVDIAG_INV_FAIL;
@@ -410,17 +425,24 @@ static int CVDiagSolve(CVodeMem cv_mem, N_Vector b,
   if (cvdiag_mem->di_gammasv != cv_mem->cv_gamma)
   {
     r = cv_mem->cv_gamma / cvdiag_mem->di_gammasv;
-#ifdef SUNDIALS_BUILD_PACKAGE_FUSED_KERNELS
-    if (cv_mem->cv_usefused) { cvDiagSolve_updateM(r, cvdiag_mem->di_M); }
+    if (cv_mem->cv_usefusedcpu)
+    {
+      invOK = cvDiagSolve_updateM_fusedCPU(r, cvdiag_mem->di_M);
+    }
     else
-#endif
     {
-      N_VInv(cvdiag_mem->di_M, cvdiag_mem->di_M);
-      N_VAddConst(cvdiag_mem->di_M, -ONE, cvdiag_mem->di_M);
-      N_VScale(r, cvdiag_mem->di_M, cvdiag_mem->di_M);
-      N_VAddConst(cvdiag_mem->di_M, ONE, cvdiag_mem->di_M);
+#ifdef SUNDIALS_BUILD_PACKAGE_FUSED_KERNELS
+      if (cv_mem->cv_usefused) { cvDiagSolve_updateM(r, cvdiag_mem->di_M); }
+      else
+#endif
+      {
+        N_VInv(cvdiag_mem->di_M, cvdiag_mem->di_M);
+        N_VAddConst(cvdiag_mem->di_M, -ONE, cvdiag_mem->di_M);
+        N_VScale(r, cvdiag_mem->di_M, cvdiag_mem->di_M);
+        N_VAddConst(cvdiag_mem->di_M, ONE, cvdiag_mem->di_M);
+      }
+      invOK = N_VInvTest(cvdiag_mem->di_M, cvdiag_mem->di_M);
     }
-    invOK = N_VInvTest(cvdiag_mem->di_M, cvdiag_mem->di_M);
     if (!invOK)
     {
       cvdiag_mem->di_last_flag = CVDIAG_INV_FAIL;
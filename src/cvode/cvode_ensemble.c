@@ -0,0 +1,2559 @@
+/*
+ * -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2025-2026, Lawrence Livermore National Security,
+ * University of Maryland Baltimore County, and the SUNDIALS contributors.
+ * Copyright (c) 2013-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * Copyright (c) 2002-2013, Lawrence Livermore National Security.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * This is the implementation file for the CVODE ensemble interface.
+ * The systems of the ensemble are advanced in lockstep rounds. In
+ * each round every system that has not reached tout makes one
+ * attempt at its next step with its own step size and order, using
+ * the same step, error test, and step size selection logic as cvStep
+ * in cvode.c. The Newton iterations of all attempts share batched
+ * right-hand side evaluations and one block-dense linear solver, and
+ * all vector operations loop over the systems in the innermost loop
+ * so that they vectorize across the interleaved states. Blocks of
+ * systems are distributed over OpenMP threads.
+ * -----------------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <nvector/nvector_serial.h>
+#include <sundials/priv/sundials_errors_impl.h>
+#include <sundials/sundials_math.h>
+#include <sunlinsol/sunlinsol_blockdense.h>
+#include <sunmatrix/sunmatrix_blockdense.h>
+
+#include "cvode_ensemble_impl.h"
+#include "cvode_ls_impl.h"
+
+#if defined(SUNDIALS_OPENMP_ENABLED)
+#include <omp.h>
+#endif
+
+#define ZERO   SUN_RCONST(0.0)
+#define POINT2 SUN_RCONST(0.2)
+#define HALF   SUN_RCONST(0.5)
+#define ONE    SUN_RCONST(1.0)
+#define TWO    SUN_RCONST(2.0)
+
+/* Number of systems processed by one OpenMP work item. This is a
+   multiple of SUN_BLOCKDENSE_GROUP_SIZE, so a group of matrix blocks
+   is never shared by two work items. */
+#define ENS_BLOCK 64
+
+/* Nonlinear solver constants (see cvode_nls.c) */
+#define NLS_MAXCOR 3
+#define CRDOWN     SUN_RCONST(0.3)
+#define RDIV       TWO
+
+/* Difference quotient Jacobian constant (see cvode_ls.c) */
+#define MIN_INC_MULT SUN_RCONST(1000.0)
+
+/* Status of a system within a call to CVodeEnsemble */
+#define ENS_FAILED   -1 /* the integration failed, flag holds why   */
+#define ENS_DONE     0  /* the system has reached tout              */
+#define ENS_NEW_STEP 1  /* the system starts a new step             */
+#define ENS_ATTEMPT  2  /* the system attempts (again) a step       */
+#define ENS_RESTART  3  /* the system restarts at order 1           */
+
+/* Value of nls while the Newton iteration of a system is running.
+   Otherwise nls holds the result of the last iteration. */
+#define ENS_NLS_ITER SUN_NLS_CONTINUE
+
+/* Values of setup for a system that requested a linear solver setup */
+#define ENS_SETUP_REUSE 1 /* reuse the saved Jacobian         */
+#define ENS_SETUP_JAC   2 /* use an updated Jacobian          */
+
+/* Conditions under which a failed Newton iteration is retried with
+   an updated Jacobian (see SUNNonlinSolSolve_Newton) */
+#define ENS_RETRY_NEVER  0 /* failure outside of the iteration  */
+#define ENS_RETRY_INNER  1 /* retry if an update has been made  */
+#define ENS_RETRY_ALWAYS 2 /* failure inside of the iteration   */
+
+/* Number of real workspace arrays and access to array k */
+#define ENS_NRWORK    6
+#define RWORK(ens, k) ((ens)->rwork + (k) * (ens)->nsys)
+
+/* Access to entry j of the coefficient arrays of system s */
+#define ENS_L(ens, j, s)   ((ens)->l[(j) * (ens)->nsys + (s)])
+#define ENS_TQ(ens, j, s)  ((ens)->tq[(j) * (ens)->nsys + (s)])
+#define ENS_TAU(ens, j, s) ((ens)->tau[(j) * (ens)->nsys + (s)])
+
+/* Number of real, integer, and long integer arrays of length nsys */
+#define ENS_NREAL (15 + ENS_NRWORK + L_MAX + (NUM_TESTS + 1) + (L_MAX + 1))
+#define ENS_NINT  13
+#define ENS_NLONG 4
+
+/* Kernel applied to the systems s0 <= s < s1 */
+typedef void (*CVEnsKernelFn)(CVodeEnsembleMem ens, sunindextype s0,
+                              sunindextype s1, void* data);
+
+/* Input of the kernels */
+typedef struct
+{
+  sunrealtype tout;
+  sunrealtype* yout;
+} CVEnsOutput;
+
+typedef struct
+{
+  int code;
+  int retry;
+} CVEnsFailure;
+
+static void cvEnsProcessError(CVodeEnsembleMem ens, int error_code, int line,
+                              const char* func, const char* file,
+                              const char* msg);
+static int cvEnsCheckVector(CVodeEnsembleMem ens, N_Vector y, const char* func);
+static int cvEnsAllocate(CVodeEnsembleMem ens);
+static void cvEnsFreeData(CVodeEnsembleMem ens);
+static void cvEnsReset(CVodeEnsembleMem ens, sunrealtype t0, N_Vector y0);
+
+static void cvEnsForBlocks(CVodeEnsembleMem ens, CVEnsKernelFn kernel,
+                           void* data);
+static sunbooleantype cvEnsAny(const int* a, sunindextype n, int value);
+
+/* Initial setup */
+static int cvEnsInitialSetup(CVodeEnsembleMem ens, sunrealtype tout);
+static int cvEnsHin(CVodeEnsembleMem ens, sunrealtype tout);
+static void cvEnsEwtKernel(CVodeEnsembleMem ens, sunindextype s0,
+                           sunindextype s1, void* data);
+static void cvEnsHinBoundsKernel(CVodeEnsembleMem ens, sunindextype s0,
+                                 sunindextype s1, void* data);
+static void cvEnsHinTrialKernel(CVodeEnsembleMem ens, sunindextype s0,
+                                sunindextype s1, void* data);
+static void cvEnsHinReduceKernel(CVodeEnsembleMem ens, sunindextype s0,
+                                 sunindextype s1, void* data);
+static void cvEnsHinUpdateKernel(CVodeEnsembleMem ens, sunindextype s0,
+                                 sunindextype s1, void* data);
+static void cvEnsHinFinish(CVodeEnsembleMem ens, sunindextype s,
+                           sunrealtype hnew);
+static void cvEnsStartKernel(CVodeEnsembleMem ens, sunindextype s0,
+                             sunindextype s1, void* data);
+
+/* Step attempts */
+static void cvEnsBeginStepKernel(CVodeEnsembleMem ens, sunindextype s0,
+                                 sunindextype s1, void* data);
+static void cvEnsPredictKernel(CVodeEnsembleMem ens, sunindextype s0,
+                               sunindextype s1, void* data);
+static void cvEnsFinishKernel(CVodeEnsembleMem ens, sunindextype s0,
+                              sunindextype s1, void* data);
+static void cvEnsRestart(CVodeEnsembleMem ens);
+static void cvEnsRestartKernel(CVodeEnsembleMem ens, sunindextype s0,
+                               sunindextype s1, void* data);
+static void cvEnsOutputKernel(CVodeEnsembleMem ens, sunindextype s0,
+                              sunindextype s1, void* data);
+
+/* Nordsieck array and method coefficients */
+static void cvEnsShiftHistory(CVodeEnsembleMem ens, sunindextype s0,
+                              sunindextype s1, const int* mask,
+                              sunbooleantype predict);
+static void cvEnsRescale(CVodeEnsembleMem ens, sunindextype s0, sunindextype s1, const int* mask);
+static void cvEnsAdjustOrder(CVodeEnsembleMem ens, sunindextype s, int deltaq);
+static void cvEnsSet(CVodeEnsembleMem ens, sunindextype s);
+static void cvEnsSetEta(CVodeEnsembleMem ens, sunindextype s);
+
+/* Newton iteration */
+static void cvEnsNls(CVodeEnsembleMem ens);
+static void cvEnsFailKernel(CVodeEnsembleMem ens, sunindextype s0,
+                            sunindextype s1, void* data);
+static void cvEnsResidualKernel(CVodeEnsembleMem ens, sunindextype s0,
+                                sunindextype s1, void* data);
+static void cvEnsGatherKernel(CVodeEnsembleMem ens, sunindextype s0,
+                              sunindextype s1, void* data);
+static void cvEnsUpdateKernel(CVodeEnsembleMem ens, sunindextype s0,
+                              sunindextype s1, void* data);
+
+/* Linear solver setup */
+static void cvEnsLSetup(CVodeEnsembleMem ens);
+static void cvEnsJbadKernel(CVodeEnsembleMem ens, sunindextype s0,
+                            sunindextype s1, void* data);
+static void cvEnsBuildKernel(CVodeEnsembleMem ens, sunindextype s0,
+                             sunindextype s1, void* data);
+static void cvEnsSetupDoneKernel(CVodeEnsembleMem ens, sunindextype s0,
+                                 sunindextype s1, void* data);
+static int cvEnsDQJac(CVodeEnsembleMem ens);
+static void cvEnsDQIncKernel(CVodeEnsembleMem ens, sunindextype s0,
+                             sunindextype s1, void* data);
+static void cvEnsDQPerturbKernel(CVodeEnsembleMem ens, sunindextype s0,
+                                 sunindextype s1, void* data);
+static void cvEnsDQColumnKernel(CVodeEnsembleMem ens, sunindextype s0,
+                                sunindextype s1, void* data);
+
+/*
+ * -----------------------------------------------------------------
+ * Exported Functions -- Ensemble Creation
+ * -----------------------------------------------------------------
+ */
+
+/*
+ * CVodeEnsembleCreate
+ *
+ * Creates the ensemble memory for nsys systems of size N. The
+ * vectors, the block-dense matrices, and the linear solver are
+ * allocated in CVodeEnsembleInit.
+ */
+
+void* CVodeEnsembleCreate(int lmm, sunindextype nsys, sunindextype N,
+                          SUNContext sunctx)
+{
+  CVodeEnsembleMem ens;
+
+  if ((lmm != CV_ADAMS) && (lmm != CV_BDF))
+  {
+    cvEnsProcessError(NULL, CV_ILL_INPUT, __LINE__, __func__, __FILE__,
+                      MSGENS_BAD_LMM);
+    return (NULL);
+  }
+
+  if ((nsys <= 0) || (N <= 0))
+  {
+    cvEnsProcessError(NULL, CV_ILL_INPUT, __LINE__, __func__, __FILE__,
+                      MSGENS_BAD_SIZE);
+    return (NULL);
+  }
+
+  ens = (CVodeEnsembleMem)calloc(1, sizeof(struct CVodeEnsembleMemRec));
+  if (ens == NULL)
+  {
+    cvEnsProcessError(NULL, CV_MEM_FAIL, __LINE__, __func__, __FILE__,
+                      MSGENS_MEM_FAIL);
+    return (NULL);
+  }
+
+  ens->sunctx    = sunctx;
+  ens->lmm       = lmm;
+  ens->qmax      = (lmm == CV_ADAMS) ? ADAMS_Q_MAX : BDF_Q_MAX;
+  ens->nsys      = nsys;
+  ens->N         = N;
+  ens->f         = NULL;
+  ens->jac       = NULL;
+  ens->user_data = NULL;
+  ens->reltol    = -ONE;
+  ens->abstol    = -ONE;
+  ens->mxstep    = MXSTEP_DEFAULT;
+#if defined(SUNDIALS_OPENMP_ENABLED)
+  ens->nthreads = omp_get_max_threads();
+#else
+  ens->nthreads = 1;
+#endif
+  ens->uround      = SUN_UNIT_ROUNDOFF;
+  ens->eta_max_es  = ETA_MAX_ES_DEFAULT;
+  ens->eta_max_gs  = ETA_MAX_GS_DEFAULT;
+  ens->small_nst   = SMALL_NST_DEFAULT;
+  ens->malloc_done = SUNFALSE;
+
+  return ((void*)ens);
+}
+
+/*
+ * CVodeEnsembleInit
+ *
+ * Allocates the interleaved vectors, the block-dense matrix and
+ * linear solver, and the per-system arrays, all with the user's
+ * SUNContext, and initializes every system with its part of y0.
+ */
+
+int CVodeEnsembleInit(void* ens_mem, CVEnsembleRhsFn f, sunrealtype t0,
+                      N_Vector y0)
+{
+  CVodeEnsembleMem ens;
+  int retval;
+
+  if (ens_mem == NULL)
+  {
+    cvEnsProcessError(NULL, CV_MEM_NULL, __LINE__, __func__, __FILE__,
+                      MSGENS_MEM_NULL);
+    return (CV_MEM_NULL);
+  }
+  ens = (CVodeEnsembleMem)ens_mem;
+
+  if (ens->malloc_done)
+  {
+    cvEnsProcessError(ens, CV_ILL_INPUT, __LINE__, __func__, __FILE__,
+                      MSGENS_REINIT);
+    return (CV_ILL_INPUT);
+  }
+
+  if (f == NULL)
+  {
+    cvEnsProcessError(ens, CV_ILL_INPUT, __LINE__, __func__, __FILE__,
+                      MSGENS_NULL_F);
+    return (CV_ILL_INPUT);
+  }
+
+  retval = cvEnsCheckVector(ens, y0, __func__);
+  if (retval != CV_SUCCESS) { return (retval); }
+
+  retval = cvEnsAllocate(ens);
+  if (retval != CV_SUCCESS)
+  {
+    cvEnsFreeData(ens);
+    cvEnsProcessError(ens, CV_MEM_FAIL, __LINE__, __func__, __FILE__,
+                      MSGENS_MEM_FAIL);
+    return (CV_MEM_FAIL);
+  }
+
+  ens->f           = f;
+  ens->malloc_done = SUNTRUE;
+
+  cvEnsReset(ens, t0, y0);
+
+  return (CV_SUCCESS);
+}
+
+/*
+ * CVodeEnsembleReInit
+ *
+ * Reinitializes every system with its part of y0 at t0, keeping the
+ * right-hand side, Jacobian, tolerances, and optional inputs.
+ */
+
+int CVodeEnsembleReInit(void* ens_mem, sunrealtype t0, N_Vector y0)
+{
+  CVodeEnsembleMem ens;
+  int retval;
+
+  if (ens_mem == NULL)
+  {
+    cvEnsProcessError(NULL, CV_MEM_NULL, __LINE__, __func__, __FILE__,
+                      MSGENS_MEM_NULL);
+    return (CV_MEM_NULL);
+  }
+  ens = (CVodeEnsembleMem)ens_mem;
+
+  if (!ens->malloc_done)
+  {
+    cvEnsProcessError(ens, CV_NO_MALLOC, __LINE__, __func__, __FILE__,
+                      MSGENS_NO_INIT);
+    return (CV_NO_MALLOC);
+  }
+
+  retval = cvEnsCheckVector(ens, y0, __func__);
+  if (retval != CV_SUCCESS) { return (retval); }
+
+  cvEnsReset(ens, t0, y0);
+
+  return (CV_SUCCESS);
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Exported Functions -- Optional Inputs
+ * -----------------------------------------------------------------
+ */
+
+/*
+ * CVodeEnsembleSStolerances
+ *
+ * Sets the scalar relative and absolute tolerances of all systems.
+ */
+
+int CVodeEnsembleSStolerances(void* ens_mem, sunrealtype reltol,
+                              sunrealtype abstol)
+{
+  CVodeEnsembleMem ens;
+
+  if (ens_mem == NULL)
+  {
+    cvEnsProcessError(NULL, CV_MEM_NULL, __LINE__, __func__, __FILE__,
+                      MSGENS_MEM_NULL);
+    return (CV_MEM_NULL);
+  }
+  ens = (CVodeEnsembleMem)ens_mem;
+
+  if (!ens->malloc_done)
+  {
+    cvEnsProcessError(ens, CV_NO_MALLOC, __LINE__, __func__, __FILE__,
+                      MSGENS_NO_INIT);
+    return (CV_NO_MALLOC);
+  }
+
+  if ((reltol < ZERO) || (abstol < ZERO))
+  {
+    cvEnsProcessError(ens, CV_ILL_INPUT, __LINE__, __func__, __FILE__,
+                      MSGENS_BAD_TOL);
+    return (CV_ILL_INPUT);
+  }
+
+  ens->reltol = reltol;
+  ens->abstol = abstol;
+
+  return (CV_SUCCESS);
+}
+
+/*
+ * CVodeEnsembleSetJacFn
+ *
+ * Sets the batched Jacobian routine. With jac = NULL, the Jacobians
+ * are approximated by batched difference quotients.
+ */
+
+int CVodeEnsembleSetJacFn(void* ens_mem, CVEnsembleJacFn jac)
+{
+  CVodeEnsembleMem ens;
+
+  if (ens_mem == NULL)
+  {
+    cvEnsProcessError(NULL, CV_MEM_NULL, __LINE__, __func__, __FILE__,
+                      MSGENS_MEM_NULL);
+    return (CV_MEM_NULL);
+  }
+  ens = (CVodeEnsembleMem)ens_mem;
+
+  if (!ens->malloc_done)
+  {
+    cvEnsProcessError(ens, CV_NO_MALLOC, __LINE__, __func__, __FILE__,
+                      MSGENS_NO_INIT);
+    return (CV_NO_MALLOC);
+  }
+
+  ens->jac    = jac;
+  ens->forceA = SUNTRUE;
+
+  return (CV_SUCCESS);
+}
+
+/*
+ * CVodeEnsembleSetUserData
+ *
+ * Sets the user data pointer passed to the right-hand side and
+ * Jacobian routines.
+ */
+
+int CVodeEnsembleSetUserData(void* ens_mem, void* user_data)
+{
+  CVodeEnsembleMem ens;
+
+  if (ens_mem == NULL)
+  {
+    cvEnsProcessError(NULL, CV_MEM_NULL, __LINE__, __func__, __FILE__,
+                      MSGENS_MEM_NULL);
+    return (CV_MEM_NULL);
+  }
+  ens = (CVodeEnsembleMem)ens_mem;
+
+  ens->user_data = user_data;
+
+  return (CV_SUCCESS);
+}
+
+/*
+ * CVodeEnsembleSetMaxNumSteps
+ *
+ * Sets the maximum number of steps each system may take in one call
+ * to CVodeEnsemble. A value of zero restores the default and a
+ * negative value disables the test.
+ */
+
+int CVodeEnsembleSetMaxNumSteps(void* ens_mem, long int mxsteps)
+{
+  CVodeEnsembleMem ens;
+
+  if (ens_mem == NULL)
+  {
+    cvEnsProcessError(NULL, CV_MEM_NULL, __LINE__, __func__, __FILE__,
+                      MSGENS_MEM_NULL);
+    return (CV_MEM_NULL);
+  }
+  ens = (CVodeEnsembleMem)ens_mem;
+
+  ens->mxstep = (mxsteps == 0) ? MXSTEP_DEFAULT : mxsteps;
+
+  return (CV_SUCCESS);
+}
+
+/*
+ * CVodeEnsembleSetNumThreads
+ *
+ * Sets the number of OpenMP threads over which the blocks of systems
+ * are distributed. Without OpenMP the ensemble runs on one thread.
+ */
+
+int CVodeEnsembleSetNumThreads(void* ens_mem, int nthreads)
+{
+  CVodeEnsembleMem ens;
+
+  if (ens_mem == NULL)
+  {
+    cvEnsProcessError(NULL, CV_MEM_NULL, __LINE__, __func__, __FILE__,
+                      MSGENS_MEM_NULL);
+    return (CV_MEM_NULL);
+  }
+  ens = (CVodeEnsembleMem)ens_mem;
+
+  if (nthreads <= 0)
+  {
+    cvEnsProcessError(ens, CV_ILL_INPUT, __LINE__, __func__, __FILE__,
+                      MSGENS_BAD_NT);
+    return (CV_ILL_INPUT);
+  }
+
+  ens->nthreads = nthreads;
+
+  return (CV_SUCCESS);
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Exported Functions -- Integration
+ * -----------------------------------------------------------------
+ */
+
+/*
+ * CVodeEnsemble
+ *
+ * Advances every system to tout (CV_NORMAL mode) and returns the
+ * interleaved solutions in yout. If flags is not NULL, flags[s] is
+ * set to the CVODE return flag of system s. A system that fails
+ * stops at its last successful step, which is returned in yout,
+ * while the other systems continue. The return value is CV_SUCCESS
+ * if all systems succeeded and the first failure flag otherwise.
+ */
+
+int CVodeEnsemble(void* ens_mem, sunrealtype tout, N_Vector yout, int* flags)
+{
+  CVodeEnsembleMem ens;
+  CVEnsOutput out;
+  sunindextype s;
+  int retval;
+
+  if (ens_mem == NULL)
+  {
+    cvEnsProcessError(NULL, CV_MEM_NULL, __LINE__, __func__, __FILE__,
+                      MSGENS_MEM_NULL);
+    return (CV_MEM_NULL);
+  }
+  ens = (CVodeEnsembleMem)ens_mem;
+
+  if (!ens->malloc_done)
+  {
+    cvEnsProcessError(ens, CV_NO_MALLOC, __LINE__, __func__, __FILE__,
+                      MSGENS_NO_INIT);
+    return (CV_NO_MALLOC);
+  }
+
+  retval = cvEnsCheckVector(ens, yout, __func__);
+  if (retval != CV_SUCCESS) { return (retval); }
+
+  if (!ens->initialized)
+  {
+    retval = cvEnsInitialSetup(ens, tout);
+    if (retval != CV_SUCCESS) { return (retval); }
+  }
+
+  for (s = 0; s < ens->nsys; s++)
+  {
+    ens->status[s] = ENS_NEW_STEP;
+    ens->flag[s]   = CV_SUCCESS;
+    ens->nstloc[s] = 0;
+  }
+
+  out.tout = tout;
+  out.yout = N_VGetArrayPointer(yout);
+
+  /* Each round makes one step attempt for every system that has not
+     reached tout, until no system attempts a step anymore */
+  for (;;)
+  {
+    cvEnsForBlocks(ens, cvEnsBeginStepKernel, &out);
+    if (!cvEnsAny(ens->status, ens->nsys, ENS_ATTEMPT)) { break; }
+
+    cvEnsForBlocks(ens, cvEnsPredictKernel, NULL);
+    cvEnsNls(ens);
+    cvEnsForBlocks(ens, cvEnsFinishKernel, NULL);
+
+    if (cvEnsAny(ens->status, ens->nsys, ENS_RESTART)) { cvEnsRestart(ens); }
+  }
+
+  /* Failed systems return the solution at their last step */
+  cvEnsForBlocks(ens, cvEnsOutputKernel, &out);
+
+  retval = CV_SUCCESS;
+  for (s = 0; s < ens->nsys; s++)
+  {
+    if (flags) { flags[s] = ens->flag[s]; }
+    if ((retval == CV_SUCCESS) && (ens->flag[s] != CV_SUCCESS))
+    {
+      retval = ens->flag[s];
+    }
+  }
+
+  if (retval != CV_SUCCESS)
+  {
+    cvEnsProcessError(ens, retval, __LINE__, __func__, __FILE__,
+                      MSGENS_SYS_FAIL);
+  }
+
+  return (retval);
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Exported Functions -- Optional Outputs
+ * -----------------------------------------------------------------
+ */
+
+/*
+ * CVodeEnsembleGetNumSteps
+ *
+ * Returns the total number of steps taken by all systems.
+ */
+
+int CVodeEnsembleGetNumSteps(void* ens_mem, long int* nsteps)
+{
+  CVodeEnsembleMem ens;
+  sunindextype s;
+
+  if (ens_mem == NULL)
+  {
+    cvEnsProcessError(NULL, CV_MEM_NULL, __LINE__, __func__, __FILE__,
+                      MSGENS_MEM_NULL);
+    return (CV_MEM_NULL);
+  }
+  ens = (CVodeEnsembleMem)ens_mem;
+
+  if (!ens->malloc_done)
+  {
+    cvEnsProcessError(ens, CV_NO_MALLOC, __LINE__, __func__, __FILE__,
+                      MSGENS_NO_INIT);
+    return (CV_NO_MALLOC);
+  }
+
+  *nsteps = 0;
+  for (s = 0; s < ens->nsys; s++) { *nsteps += ens->nst[s]; }
+
+  return (CV_SUCCESS);
+}
+
+/*
+ * CVodeEnsembleGetNumRhsEvals
+ *
+ * Returns the number of batched right-hand side evaluations.
+ */
+
+int CVodeEnsembleGetNumRhsEvals(void* ens_mem, long int* nfevals)
+{
+  CVodeEnsembleMem ens;
+
+  if (ens_mem == NULL)
+  {
+    cvEnsProcessError(NULL, CV_MEM_NULL, __LINE__, __func__, __FILE__,
+                      MSGENS_MEM_NULL);
+    return (CV_MEM_NULL);
+  }
+  ens = (CVodeEnsembleMem)ens_mem;
+
+  *nfevals = ens->nfe;
+
+  return (CV_SUCCESS);
+}
+
+/*
+ * CVodeEnsembleGetNumLinSolvSetups
+ *
+ * Returns the number of block-dense factorizations.
+ */
+
+int CVodeEnsembleGetNumLinSolvSetups(void* ens_mem, long int* nlinsetups)
+{
+  CVodeEnsembleMem ens;
+
+  if (ens_mem == NULL)
+  {
+    cvEnsProcessError(NULL, CV_MEM_NULL, __LINE__, __func__, __FILE__,
+                      MSGENS_MEM_NULL);
+    return (CV_MEM_NULL);
+  }
+  ens = (CVodeEnsembleMem)ens_mem;
+
+  *nlinsetups = ens->nsetups;
+
+  return (CV_SUCCESS);
+}
+
+/*
+ * CVodeEnsembleGetNumJacEvals
+ *
+ * Returns the number of batched Jacobian evaluations.
+ */
+
+int CVodeEnsembleGetNumJacEvals(void* ens_mem, long int* njevals)
+{
+  CVodeEnsembleMem ens;
+
+  if (ens_mem == NULL)
+  {
+    cvEnsProcessError(NULL, CV_MEM_NULL, __LINE__, __func__, __FILE__,
+                      MSGENS_MEM_NULL);
+    return (CV_MEM_NULL);
+  }
+  ens = (CVodeEnsembleMem)ens_mem;
+
+  *njevals = ens->nje;
+
+  return (CV_SUCCESS);
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Exported Functions -- Deallocation
+ * -----------------------------------------------------------------
+ */
+
+void CVodeEnsembleFree(void** ens_mem)
+{
+  CVodeEnsembleMem ens;
+
+  if (ens_mem == NULL || *ens_mem == NULL) { return; }
+  ens = (CVodeEnsembleMem)(*ens_mem);
+
+  cvEnsFreeData(ens);
+
+  free(*ens_mem);
+  *ens_mem = NULL;
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Private Functions -- Memory
+ * -----------------------------------------------------------------
+ */
+
+/* Reports an ensemble level error with the user's SUNContext */
+
+static void cvEnsProcessError(CVodeEnsembleMem ens, int error_code, int line,
+                              const char* func, const char* file,
+                              const char* msg)
+{
+  SUNContext sunctx = (ens == NULL) ? NULL : ens->sunctx;
+
+  SUNHandleErrWithMsg(line, func, file, msg, error_code, sunctx);
+
+  /* Clear the last error value */
+  if (sunctx) { (void)SUNContext_GetLastError(sunctx); }
+}
+
+/* Checks that y holds the states of all systems in a data array */
+
+static int cvEnsCheckVector(CVodeEnsembleMem ens, N_Vector y, const char* func)
+{
+  if ((y == NULL) || (y->ops->nvgetlength == NULL) ||
+      (y->ops->nvgetarraypointer == NULL) ||
+      (N_VGetLength(y) != ens->nsys * ens->N) ||
+      (N_VGetArrayPointer(y) == NULL))
+  {
+    cvEnsProcessError(ens, CV_ILL_INPUT, __LINE__, func, __FILE__,
+                      MSGENS_BAD_Y);
+    return (CV_ILL_INPUT);
+  }
+
+  return (CV_SUCCESS);
+}
+
+/* Allocates the vectors, matrices, linear solver, and arrays */
+
+static int cvEnsAllocate(CVodeEnsembleMem ens)
+{
+  const sunindextype ns = ens->nsys;
+  sunrealtype* r;
+  int* iw;
+  long int* lw;
+  int j;
+
+  ens->ewt = N_VNew_Serial(ns * ens->N, ens->sunctx);
+  if (ens->ewt == NULL) { return (CV_MEM_FAIL); }
+
+  for (j = 0; j <= ens->qmax; j++)
+  {
+    ens->zn[j] = N_VClone(ens->ewt);
+    if (ens->zn[j] == NULL) { return (CV_MEM_FAIL); }
+  }
+
+  ens->y     = N_VClone(ens->ewt);
+  ens->acor  = N_VClone(ens->ewt);
+  ens->delta = N_VClone(ens->ewt);
+  ens->ftemp = N_VClone(ens->ewt);
+  ens->tempv = N_VClone(ens->ewt);
+  ens->lsx   = N_VClone(ens->ewt);
+  ens->lsb   = N_VClone(ens->ewt);
+  if ((ens->y == NULL) || (ens->acor == NULL) || (ens->delta == NULL) ||
+      (ens->ftemp == NULL) || (ens->tempv == NULL) || (ens->lsx == NULL) ||
+      (ens->lsb == NULL))
+  {
+    return (CV_MEM_FAIL);
+  }
+
+  ens->A = SUNMatrix_BlockDense(ns, ens->N, ens->N, ens->sunctx);
+  if (ens->A == NULL) { return (CV_MEM_FAIL); }
+
+  ens->savedJ = SUNMatClone(ens->A);
+  if (ens->savedJ == NULL) { return (CV_MEM_FAIL); }
+
+  ens->LS = SUNLinSol_BlockDense(ens->lsx, ens->A, ens->sunctx);
+  if (ens->LS == NULL) { return (CV_MEM_FAIL); }
+
+  if (SUNLinSolInitialize(ens->LS) != SUN_SUCCESS) { return (CV_MEM_FAIL); }
+
+  ens->rdata = (sunrealtype*)calloc(ENS_NREAL * ns, sizeof(sunrealtype));
+  ens->idata = (int*)calloc(ENS_NINT * ns, sizeof(int));
+  ens->ldata = (long int*)calloc(ENS_NLONG * ns, sizeof(long int));
+  if ((ens->rdata == NULL) || (ens->idata == NULL) || (ens->ldata == NULL))
+  {
+    return (CV_MEM_FAIL);
+  }
+
+  r              = ens->rdata;
+  ens->tn        = r;
+  ens->h         = (r += ns);
+  ens->hprime    = (r += ns);
+  ens->hscale    = (r += ns);
+  ens->eta       = (r += ns);
+  ens->etamax    = (r += ns);
+  ens->rl1       = (r += ns);
+  ens->gamma     = (r += ns);
+  ens->gammap    = (r += ns);
+  ens->gamrat    = (r += ns);
+  ens->crate     = (r += ns);
+  ens->delp      = (r += ns);
+  ens->acnrm     = (r += ns);
+  ens->saved_t   = (r += ns);
+  ens->saved_tq5 = (r += ns);
+  ens->rwork     = (r += ns);
+  ens->l         = (r += ENS_NRWORK * ns);
+  ens->tq        = (r += L_MAX * ns);
+  ens->tau       = (r += (NUM_TESTS + 1) * ns);
+
+  iw            = ens->idata;
+  ens->q        = iw;
+  ens->qprime   = (iw += ns);
+  ens->qwait    = (iw += ns);
+  ens->status   = (iw += ns);
+  ens->nflag    = (iw += ns);
+  ens->ncf      = (iw += ns);
+  ens->nef      = (iw += ns);
+  ens->convfail = (iw += ns);
+  ens->nls      = (iw += ns);
+  ens->mnewt    = (iw += ns);
+  ens->setup    = (iw += ns);
+  ens->jcur     = (iw += ns);
+  ens->flag     = (iw += ns);
+
+  lw          = ens->ldata;
+  ens->nst    = lw;
+  ens->nstloc = (lw += ns);
+  ens->nstlp  = (lw += ns);
+  ens->nstlj  = (lw += ns);
+
+  return (CV_SUCCESS);
+}
+
+/* Frees everything allocated by cvEnsAllocate */
+
+static void cvEnsFreeData(CVodeEnsembleMem ens)
+{
+  int j;
+
+  for (j = 0; j < L_MAX; j++)
+  {
+    if (ens->zn[j]) { N_VDestroy(ens->zn[j]); }
+    ens->zn[j] = NULL;
+  }
+
+  if (ens->ewt) { N_VDestroy(ens->ewt); }
+  if (ens->y) { N_VDestroy(ens->y); }
+  if (ens->acor) { N_VDestroy(ens->acor); }
+  if (ens->delta) { N_VDestroy(ens->delta); }
+  if (ens->ftemp) { N_VDestroy(ens->ftemp); }
+  if (ens->tempv) { N_VDestroy(ens->tempv); }
+  if (ens->lsx) { N_VDestroy(ens->lsx); }
+  if (ens->lsb) { N_VDestroy(ens->lsb); }
+  if (ens->LS) { SUNLinSolFree(ens->LS); }
+  if (ens->A) { SUNMatDestroy(ens->A); }
+  if (ens->savedJ) { SUNMatDestroy(ens->savedJ); }
+  free(ens->rdata);
+  free(ens->idata);
+  free(ens->ldata);
+
+  ens->ewt = ens->y = ens->acor = ens->delta = NULL;
+  ens->ftemp = ens->tempv = ens->lsx = ens->lsb = NULL;
+  ens->LS                                       = NULL;
+  ens->A = ens->savedJ = NULL;
+  ens->rdata           = NULL;
+  ens->idata           = NULL;
+  ens->ldata           = NULL;
+  ens->malloc_done     = SUNFALSE;
+}
+
+/* Sets the initial state of all systems (see CVodeInit) */
+
+static void cvEnsReset(CVodeEnsembleMem ens, sunrealtype t0, N_Vector y0)
+{
+  const sunindextype ns = ens->nsys;
+  sunrealtype* y0data   = N_VGetArrayPointer(y0);
+  sunrealtype* zn0      = N_VGetArrayPointer(ens->zn[0]);
+  sunindextype i, s;
+
+  for (i = 0; i < ns * ens->N; i++) { zn0[i] = y0data[i]; }
+
+  for (i = 0; i < ENS_NREAL * ns; i++) { ens->rdata[i] = ZERO; }
+  for (i = 0; i < ENS_NINT * ns; i++) { ens->idata[i] = 0; }
+  for (i = 0; i < ENS_NLONG * ns; i++) { ens->ldata[i] = 0; }
+
+  for (s = 0; s < ns; s++)
+  {
+    ens->tn[s]     = t0;
+    ens->q[s]      = 1;
+    ens->qprime[s] = 1;
+    ens->qwait[s]  = 2;
+    ens->eta[s]    = ONE;
+    ens->etamax[s] = ETA_MAX_FS_DEFAULT;
+    ens->crate[s]  = ONE;
+    ens->nflag[s]  = FIRST_CALL;
+    ens->nls[s]    = CV_SUCCESS;
+    ens->status[s] = ENS_DONE;
+  }
+
+  (void)SUNMatZero(ens->savedJ);
+
+  ens->initialized = SUNFALSE;
+  ens->forceA      = SUNTRUE;
+  ens->nfe         = 0;
+  ens->nsetups     = 0;
+  ens->nje         = 0;
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Private Functions -- Kernels
+ * -----------------------------------------------------------------
+ */
+
+/* Applies a kernel to all systems, one block of ENS_BLOCK systems at
+   a time. Within a kernel the loops over the systems of a block are
+   innermost, so they access the interleaved vectors contiguously. */
+
+static void cvEnsForBlocks(CVodeEnsembleMem ens, CVEnsKernelFn kernel, void* data)
+{
+  const sunindextype nblocks = (ens->nsys + ENS_BLOCK - 1) / ENS_BLOCK;
+  sunindextype b;
+
+#if defined(SUNDIALS_OPENMP_ENABLED)
+#pragma omp parallel for schedule(static) num_threads(ens->nthreads) \
+  if ((ens->nthreads > 1) && (nblocks > 1))
+#endif
+  for (b = 0; b < nblocks; b++)
+  {
+    kernel(ens, b * ENS_BLOCK, SUNMIN((b + 1) * ENS_BLOCK, ens->nsys), data);
+  }
+}
+
+/* Returns whether any entry of a equals value */
+
+static sunbooleantype cvEnsAny(const int* a, sunindextype n, int value)
+{
+  sunindextype s;
+
+  for (s = 0; s < n; s++)
+  {
+    if (a[s] == value) { return (SUNTRUE); }
+  }
+
+  return (SUNFALSE);
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Private Functions -- Initial Setup
+ * -----------------------------------------------------------------
+ */
+
+/*
+ * cvEnsInitialSetup
+ *
+ * Checks the tolerances and tout, computes the error weights, loads
+ * zn[1] = h0 * f(t0, y0) after selecting the initial step size h0 of
+ * each system with cvEnsHin (see cvInitialSetup and CVode).
+ */
+
+static int cvEnsInitialSetup(CVodeEnsembleMem ens, sunrealtype tout)
+{
+  sunrealtype tdist, tround;
+  sunindextype s;
+  int retval;
+
+  if (ens->reltol < ZERO)
+  {
+    cvEnsProcessError(ens, CV_ILL_INPUT, __LINE__, __func__, __FILE__,
+                      MSGCV_NO_TOL);
+    return (CV_ILL_INPUT);
+  }
+
+  tdist  = SUNRabs(tout - ens->tn[0]);
+  tround = ens->uround * SUNMAX(SUNRabs(ens->tn[0]), SUNRabs(tout));
+  if (tdist < TWO * tround)
+  {
+    cvEnsProcessError(ens, CV_TOO_CLOSE, __LINE__, __func__, __FILE__,
+                      MSGCV_TOO_CLOSE);
+    return (CV_TOO_CLOSE);
+  }
+
+  /* Error weights of all systems; failures are marked in status */
+  for (s = 0; s < ens->nsys; s++) { ens->status[s] = ENS_NEW_STEP; }
+  cvEnsForBlocks(ens, cvEnsEwtKernel, NULL);
+  if (cvEnsAny(ens->status, ens->nsys, ENS_FAILED))
+  {
+    cvEnsProcessError(ens, CV_ILL_INPUT, __LINE__, __func__, __FILE__,
+                      MSGCV_BAD_EWT);
+    return (CV_ILL_INPUT);
+  }
+
+  retval = ens->f(ens->tn, ens->zn[0], ens->zn[1], ens->user_data);
+  ens->nfe++;
+  if (retval != 0)
+  {
+    retval = (retval < 0) ? CV_RHSFUNC_FAIL : CV_FIRST_RHSFUNC_ERR;
+    cvEnsProcessError(ens, retval, __LINE__, __func__, __FILE__,
+                      MSGENS_RHS_FAIL);
+    return (retval);
+  }
+
+  retval = cvEnsHin(ens, tout);
+  if (retval != CV_SUCCESS)
+  {
+    cvEnsProcessError(ens, retval, __LINE__, __func__, __FILE__,
+                      MSGENS_HIN_FAIL);
+    return (retval);
+  }
+
+  cvEnsForBlocks(ens, cvEnsStartKernel, NULL);
+
+  ens->initialized = SUNTRUE;
+
+  return (CV_SUCCESS);
+}
+
+/* Computes the error weights of the systems in a new step. With
+   data != NULL, only the systems with nst > 0 are updated. Systems
+   with a nonpositive weight are marked as failed. */
+
+static void cvEnsEwtKernel(CVodeEnsembleMem ens, sunindextype s0,
+                           sunindextype s1, void* data)
+{
+  const sunindextype ns = ens->nsys, N = ens->N;
+  const sunrealtype* zn0 = N_VGetArrayPointer(ens->zn[0]);
+  sunrealtype* ewt       = N_VGetArrayPointer(ens->ewt);
+  sunrealtype wmin[ENS_BLOCK], w;
+  int upd[ENS_BLOCK];
+  sunindextype i, s;
+
+  for (s = s0; s < s1; s++)
+  {
+    upd[s - s0]  = (ens->status[s] == ENS_NEW_STEP) &&
+                  ((data == NULL) || (ens->nst[s] > 0));
+    wmin[s - s0] = ONE;
+  }
+
+  for (i = 0; i < N; i++)
+  {
+    for (s = s0; s < s1; s++)
+    {
+      if (!upd[s - s0]) { continue; }
+      w            = ens->reltol * SUNRabs(zn0[i * ns + s]) + ens->abstol;
+      wmin[s - s0] = SUNMIN(wmin[s - s0], w);
+      ewt[i * ns + s] = (w > ZERO) ? ONE / w : ZERO;
+    }
+  }
+
+  for (s = s0; s < s1; s++)
+  {
+    if (upd[s - s0] && (wmin[s - s0] <= ZERO))
+    {
+      ens->status[s] = ENS_FAILED;
+      ens->flag[s]   = CV_ILL_INPUT;
+    }
+  }
+}
+
+/*
+ * cvEnsHin
+ *
+ * Computes the initial step sizes with the algorithm of cvHin. The
+ * trial evaluations of f are batched over the systems that have not
+ * settled on a step size yet (status ENS_ATTEMPT), with t[s] = t_n
+ * for the others. A recoverable failure of f reduces the trial step
+ * sizes of all pending systems.
+ *
+ * The RWORK arrays hold hlb (0), hub (1), hg (2), hs (3), the trial
+ * times (4), and the signed trial step sizes (5).
+ */
+
+static int cvEnsHin(CVodeEnsembleMem ens, sunrealtype tout)
+{
+  int retval, count1, count2;
+  sunbooleantype hgOK;
+
+  cvEnsForBlocks(ens, cvEnsHinBoundsKernel, &tout);
+
+  for (count1 = 1; count1 <= MAX_ITERS; count1++)
+  {
+    if (!cvEnsAny(ens->status, ens->nsys, ENS_ATTEMPT)) { break; }
+
+    /* Attempts to estimate ydd */
+    hgOK = SUNFALSE;
+    for (count2 = 1; count2 <= MAX_ITERS; count2++)
+    {
+      cvEnsForBlocks(ens, cvEnsHinTrialKernel, NULL);
+      retval = ens->f(RWORK(ens, 4), ens->y, ens->tempv, ens->user_data);
+      ens->nfe++;
+      if (retval < 0) { return (CV_RHSFUNC_FAIL); }
+      if (retval == 0)
+      {
+        hgOK = SUNTRUE;
+        break;
+      }
+      cvEnsForBlocks(ens, cvEnsHinReduceKernel, NULL);
+    }
+
+    /* Fall back to the last feasible step sizes after two passes */
+    if (!hgOK)
+    {
+      if (count1 <= 2) { return (CV_REPTD_RHSFUNC_ERR); }
+      cvEnsForBlocks(ens, cvEnsHinReduceKernel, &hgOK);
+      break;
+    }
+
+    cvEnsForBlocks(ens, cvEnsHinUpdateKernel, &count1);
+  }
+
+  return (CV_SUCCESS);
+}
+
+/* Sets the step size bounds and first trial step sizes (see cvHin and
+   cvUpperBoundH0) */
+
+static void cvEnsHinBoundsKernel(CVodeEnsembleMem ens, sunindextype s0,
+                                 sunindextype s1, void* data)
+{
+  const sunindextype ns = ens->nsys, N = ens->N;
+  const sunrealtype tout = *((sunrealtype*)data);
+  const sunrealtype* zn0 = N_VGetArrayPointer(ens->zn[0]);
+  const sunrealtype* zn1 = N_VGetArrayPointer(ens->zn[1]);
+  const sunrealtype* ewt = N_VGetArrayPointer(ens->ewt);
+  sunrealtype *hlb = RWORK(ens, 0), *hub = RWORK(ens, 1);
+  sunrealtype *hg = RWORK(ens, 2), *hs = RWORK(ens, 3);
+  sunrealtype hub_inv[ENS_BLOCK], tdist, tround, temp;
+  sunindextype i, s;
+
+  for (s = s0; s < s1; s++) { hub_inv[s - s0] = ZERO; }
+
+  for (i = 0; i < N; i++)
+  {
+    for (s = s0; s < s1; s++)
+    {
+      temp = SUNRabs(zn1[i * ns + s]) /
+             (HUB_FACTOR * SUNRabs(zn0[i * ns + s]) + ONE / ewt[i * ns + s]);
+      hub_inv[s - s0] = SUNMAX(hub_inv[s - s0], temp);
+    }
+  }
+
+  for (s = s0; s < s1; s++)
+  {
+    tdist  = SUNRabs(tout - ens->tn[s]);
+    tround = ens->uround * SUNMAX(SUNRabs(ens->tn[s]), SUNRabs(tout));
+    hlb[s] = HLB_FACTOR * tround;
+    hub[s] = HUB_FACTOR * tdist;
+    if (hub[s] * hub_inv[s - s0] > ONE) { hub[s] = ONE / hub_inv[s - s0]; }
+    hg[s] = SUNRsqrt(hlb[s] * hub[s]);
+    hs[s] = hg[s];
+
+    /* The sign of the step is stored in h until the step is chosen */
+    ens->h[s] = (tout > ens->tn[s]) ? ONE : -ONE;
+
+    if (hub[s] < hlb[s])
+    {
+      ens->h[s]      = ens->h[s] * hg[s];
+      ens->status[s] = ENS_NEW_STEP;
+    }
+    else { ens->status[s] = ENS_ATTEMPT; }
+  }
+}
+
+/* Sets y = zn[0] + hg * zn[1] and t = t_n + hg for the pending systems
+   (see cvYddNorm) */
+
+static void cvEnsHinTrialKernel(CVodeEnsembleMem ens, sunindextype s0,
+                                sunindextype s1, SUNDIALS_MAYBE_UNUSED void* data)
+{
+  const sunindextype ns = ens->nsys, N = ens->N;
+  const sunrealtype* zn0 = N_VGetArrayPointer(ens->zn[0]);
+  const sunrealtype* zn1 = N_VGetArrayPointer(ens->zn[1]);
+  sunrealtype* y         = N_VGetArrayPointer(ens->y);
+  sunrealtype *ttmp = RWORK(ens, 4), *hgs = RWORK(ens, 5);
+  sunindextype i, s;
+
+  for (s = s0; s < s1; s++)
+  {
+    hgs[s]  = (ens->status[s] == ENS_ATTEMPT) ? RWORK(ens, 2)[s] * ens->h[s]
+                                              : ZERO;
+    ttmp[s] = ens->tn[s] + hgs[s];
+  }
+
+  for (i = 0; i < N; i++)
+  {
+    for (s = s0; s < s1; s++)
+    {
+      y[i * ns + s] = hgs[s] * zn1[i * ns + s] + zn0[i * ns + s];
+    }
+  }
+}
+
+/* Reduces the trial step sizes of the pending systems after a
+   recoverable failure of f. With data != NULL, the pending systems
+   instead settle on their last feasible step size. */
+
+static void cvEnsHinReduceKernel(CVodeEnsembleMem ens, sunindextype s0,
+                                 sunindextype s1, void* data)
+{
+  sunindextype s;
+
+  for (s = s0; s < s1; s++)
+  {
+    if (ens->status[s] != ENS_ATTEMPT) { continue; }
+    if (data) { cvEnsHinFinish(ens, s, RWORK(ens, 3)[s]); }
+    else { RWORK(ens, 2)[s] *= POINT2; }
+  }
+}
+
+/* Proposes new step sizes from the second derivative estimates (see
+   the outer loop of cvHin) */
+
+static void cvEnsHinUpdateKernel(CVodeEnsembleMem ens, sunindextype s0,
+                                 sunindextype s1, void* data)
+{
+  const sunindextype ns = ens->nsys, N = ens->N;
+  const int count1       = *((int*)data);
+  const sunrealtype* zn1 = N_VGetArrayPointer(ens->zn[1]);
+  const sunrealtype* ewt = N_VGetArrayPointer(ens->ewt);
+  const sunrealtype* f   = N_VGetArrayPointer(ens->tempv);
+  sunrealtype *hub = RWORK(ens, 1), *hg = RWORK(ens, 2), *hs = RWORK(ens, 3);
+  sunrealtype* hgs = RWORK(ens, 5);
+  sunrealtype yddnrm[ENS_BLOCK], hnew, hrat, ydd;
+  sunindextype i, s;
+
+  for (s = s0; s < s1; s++) { yddnrm[s - s0] = ZERO; }
+
+  for (i = 0; i < N; i++)
+  {
+    for (s = s0; s < s1; s++)
+    {
+      if (ens->status[s] != ENS_ATTEMPT) { continue; }
+      ydd = (ONE / hgs[s]) * (f[i * ns + s] - zn1[i * ns + s]);
+      ydd *= ewt[i * ns + s];
+      yddnrm[s - s0] += ydd * ydd;
+    }
+  }
+
+  for (s = s0; s < s1; s++)
+  {
+    if (ens->status[s] != ENS_ATTEMPT) { continue; }
+
+    yddnrm[s - s0] = SUNRsqrt(yddnrm[s - s0] / N);
+
+    /* The proposed step size is feasible. Save it. */
+    hs[s] = hg[s];
+
+    hnew = (yddnrm[s - s0] * hub[s] * hub[s] > TWO)
+             ? SUNRsqrt(TWO / yddnrm[s - s0])
+             : SUNRsqrt(hg[s] * hub[s]);
+
+    hrat = hnew / hg[s];
+
+    if ((count1 == MAX_ITERS) || ((hrat > HALF) && (hrat < TWO)))
+    {
+      cvEnsHinFinish(ens, s, hnew);
+    }
+    else if ((count1 > 1) && (hrat > TWO)) { cvEnsHinFinish(ens, s, hg[s]); }
+    else { hg[s] = hnew; }
+  }
+}
+
+/* Applies the bounds, bias factor, and sign to the step size of a
+   pending system */
+
+static void cvEnsHinFinish(CVodeEnsembleMem ens, sunindextype s, sunrealtype hnew)
+{
+  sunrealtype h0 = H_BIAS * hnew;
+
+  if (h0 < RWORK(ens, 0)[s]) { h0 = RWORK(ens, 0)[s]; }
+  if (h0 > RWORK(ens, 1)[s]) { h0 = RWORK(ens, 1)[s]; }
+
+  ens->h[s]      = ens->h[s] * h0;
+  ens->status[s] = ENS_NEW_STEP;
+}
+
+/* Scales zn[1] by the initial step size (see CVode) */
+
+static void cvEnsStartKernel(CVodeEnsembleMem ens, sunindextype s0,
+                             sunindextype s1, SUNDIALS_MAYBE_UNUSED void* data)
+{
+  const sunindextype ns = ens->nsys, N = ens->N;
+  sunrealtype* zn1      = N_VGetArrayPointer(ens->zn[1]);
+  sunindextype i, s;
+
+  for (s = s0; s < s1; s++)
+  {
+    ens->hscale[s] = ens->h[s];
+    ens->hprime[s] = ens->h[s];
+  }
+
+  for (i = 0; i < N; i++)
+  {
+    for (s = s0; s < s1; s++) { zn1[i * ns + s] *= ens->h[s]; }
+  }
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Private Functions -- Step Attempts
+ * -----------------------------------------------------------------
+ */
+
+/*
+ * cvEnsBeginStepKernel
+ *
+ * Handles the systems that start a new step (see CVode and cvStep).
+ * A system that has reached tout is interpolated to tout and is done.
+ * Otherwise its error weights are updated, the step limits checked,
+ * and the Nordsieck array adjusted to a new step size or order.
+ */
+
+static void cvEnsBeginStepKernel(CVodeEnsembleMem ens, sunindextype s0,
+                                 sunindextype s1, void* data)
+{
+  const sunindextype ns = ens->nsys, N = ens->N;
+  CVEnsOutput* out       = (CVEnsOutput*)data;
+  const sunrealtype* ewt = N_VGetArrayPointer(ens->ewt);
+  sunrealtype* zn[L_MAX];
+  sunrealtype sv[ENS_BLOCK], nrm[ENS_BLOCK], x;
+  int mask[ENS_BLOCK], qm;
+  sunindextype i, s;
+  int j;
+
+  for (j = 0; j <= ens->qmax; j++) { zn[j] = N_VGetArrayPointer(ens->zn[j]); }
+
+  /* Interpolate the systems that reached tout (see CVodeGetDky) */
+  qm = -1;
+  for (s = s0; s < s1; s++)
+  {
+    mask[s - s0] = 0;
+    if (ens->status[s] != ENS_NEW_STEP) { continue; }
+    if ((ens->tn[s] - out->tout) * ens->h[s] >= ZERO)
+    {
+      mask[s - s0]   = 1;
+      sv[s - s0]     = (out->tout - ens->tn[s]) / ens->h[s];
+      ens->status[s] = ENS_DONE;
+      qm             = SUNMAX(qm, ens->q[s]);
+    }
+  }
+
+  for (j = qm; j >= 0; j--)
+  {
+    for (i = 0; i < N; i++)
+    {
+      for (s = s0; s < s1; s++)
+      {
+        if (!mask[s - s0] || (j > ens->q[s])) { continue; }
+        out->yout[i * ns + s] = (j == ens->q[s])
+                                  ? zn[j][i * ns + s]
+                                  : zn[j][i * ns + s] +
+                                      sv[s - s0] * out->yout[i * ns + s];
+      }
+    }
+  }
+
+  /* Update the error weights and check the step limits */
+  cvEnsEwtKernel(ens, s0, s1, ens);
+
+  for (s = s0; s < s1; s++) { nrm[s - s0] = ZERO; }
+  for (i = 0; i < N; i++)
+  {
+    for (s = s0; s < s1; s++)
+    {
+      x = zn[0][i * ns + s] * ewt[i * ns + s];
+      nrm[s - s0] += x * x;
+    }
+  }
+
+  for (s = s0; s < s1; s++)
+  {
+    mask[s - s0] = 0;
+    if (ens->status[s] != ENS_NEW_STEP) { continue; }
+
+    if ((ens->mxstep > 0) && (ens->nstloc[s] >= ens->mxstep))
+    {
+      ens->status[s] = ENS_FAILED;
+      ens->flag[s]   = CV_TOO_MUCH_WORK;
+      continue;
+    }
+
+    if (ens->uround * SUNRsqrt(nrm[s - s0] / N) > ONE)
+    {
+      ens->status[s] = ENS_FAILED;
+      ens->flag[s]   = CV_TOO_MUCH_ACC;
+      continue;
+    }
+
+    /* Adjust the history array to a change of step size (and order) */
+    if ((ens->nst[s] > 0) && (ens->hprime[s] != ens->h[s]))
+    {
+      if (ens->qprime[s] != ens->q[s])
+      {
+        cvEnsAdjustOrder(ens, s, ens->qprime[s] - ens->q[s]);
+        ens->q[s]     = ens->qprime[s];
+        ens->qwait[s] = ens->q[s] + 1;
+      }
+      mask[s - s0] = 1;
+    }
+
+    ens->saved_t[s] = ens->tn[s];
+    ens->ncf[s]     = 0;
+    ens->nef[s]     = 0;
+    ens->nflag[s]   = FIRST_CALL;
+    ens->status[s]  = ENS_ATTEMPT;
+  }
+
+  cvEnsRescale(ens, s0, s1, mask);
+}
+
+/*
+ * cvEnsPredictKernel
+ *
+ * Predicts the solution of the attempted steps, computes the method
+ * coefficients, and starts the Newton iterations (see cvPredict,
+ * cvSet, and cvNls).
+ */
+
+static void cvEnsPredictKernel(CVodeEnsembleMem ens, sunindextype s0,
+                               sunindextype s1, SUNDIALS_MAYBE_UNUSED void* data)
+{
+  const sunindextype ns = ens->nsys, N = ens->N;
+  const sunrealtype* zn0 = N_VGetArrayPointer(ens->zn[0]);
+  sunrealtype* y         = N_VGetArrayPointer(ens->y);
+  sunrealtype* acor      = N_VGetArrayPointer(ens->acor);
+  int mask[ENS_BLOCK] = {0}, nflag;
+  sunindextype i, s;
+
+  for (s = s0; s < s1; s++)
+  {
+    mask[s - s0] = (ens->status[s] == ENS_ATTEMPT);
+    if (mask[s - s0]) { ens->tn[s] += ens->h[s]; }
+  }
+
+  cvEnsShiftHistory(ens, s0, s1, mask, SUNTRUE);
+
+  for (s = s0; s < s1; s++)
+  {
+    if (!mask[s - s0]) { continue; }
+
+    cvEnsSet(ens, s);
+
+    /* Decide whether to call the linear solver setup */
+    nflag            = ens->nflag[s];
+    ens->convfail[s] = ((nflag == FIRST_CALL) || (nflag == PREV_ERR_FAIL))
+                         ? CV_NO_FAILURES
+                         : CV_FAIL_OTHER;
+    ens->setup[s]    = ens->forceA || (nflag == PREV_CONV_FAIL) ||
+                    (nflag == PREV_ERR_FAIL) || (ens->nst[s] == 0) ||
+                    (ens->nst[s] >= ens->nstlp[s] + MSBP_DEFAULT) ||
+                    (SUNRabs(ens->gamrat[s] - ONE) > DGMAX_LSETUP_DEFAULT);
+
+    ens->nls[s]   = ENS_NLS_ITER;
+    ens->mnewt[s] = 0;
+    ens->jcur[s]  = SUNFALSE;
+  }
+
+  /* The other systems evaluate f at their last solution */
+  for (i = 0; i < N; i++)
+  {
+    for (s = s0; s < s1; s++)
+    {
+      acor[i * ns + s] = ZERO;
+      y[i * ns + s]    = zn0[i * ns + s];
+    }
+  }
+}
+
+/*
+ * cvEnsFinishKernel
+ *
+ * Completes the attempted steps (see cvHandleNFlag, cvDoErrorTest,
+ * cvCompleteStep, and cvPrepareNextStep). A failed attempt is undone
+ * and, if recoverable, reattempted with a smaller step size in the
+ * next round. A successful step updates the Nordsieck array and
+ * selects the step size and order of the next step.
+ */
+
+#define ENS_ACT_NONE     0
+#define ENS_ACT_SUCCESS  1
+#define ENS_ACT_CONVFAIL 2
+#define ENS_ACT_ERRFAIL  3
+
+static void cvEnsFinishKernel(CVodeEnsembleMem ens, sunindextype s0,
+                              sunindextype s1, SUNDIALS_MAYBE_UNUSED void* data)
+{
+  const sunindextype ns = ens->nsys, N = ens->N;
+  const int qmax         = ens->qmax;
+  const sunrealtype* ewt = N_VGetArrayPointer(ens->ewt);
+  sunrealtype* acor      = N_VGetArrayPointer(ens->acor);
+  sunrealtype* zn[L_MAX];
+  sunrealtype dsm[ENS_BLOCK], etaq[ENS_BLOCK], cquot[ENS_BLOCK];
+  sunrealtype nrm1[ENS_BLOCK], nrm2[ENS_BLOCK], etaqm1, etaqp1, x;
+  int act[ENS_BLOCK], mask[ENS_BLOCK] = {0}, save[ENS_BLOCK], order[ENS_BLOCK];
+  int j, q, qm, deltaq;
+  sunindextype i, s, k;
+
+  for (j = 0; j <= qmax; j++) { zn[j] = N_VGetArrayPointer(ens->zn[j]); }
+
+  /* Outcome of the nonlinear solve and the error test */
+  for (s = s0; s < s1; s++)
+  {
+    k      = s - s0;
+    act[k] = ENS_ACT_NONE;
+    if (ens->status[s] != ENS_ATTEMPT) { continue; }
+    if (ens->nls[s] != CV_SUCCESS) { act[k] = ENS_ACT_CONVFAIL; }
+    else
+    {
+      dsm[k] = ens->acnrm[s] * ENS_TQ(ens, 2, s);
+      act[k] = (dsm[k] <= ONE) ? ENS_ACT_SUCCESS : ENS_ACT_ERRFAIL;
+    }
+  }
+
+  /* Undo the prediction of failed attempts (see cvRestore) */
+  for (s = s0; s < s1; s++)
+  {
+    k       = s - s0;
+    mask[k] = (act[k] == ENS_ACT_CONVFAIL) || (act[k] == ENS_ACT_ERRFAIL);
+    if (mask[k]) { ens->tn[s] = ens->saved_t[s]; }
+  }
+  cvEnsShiftHistory(ens, s0, s1, mask, SUNFALSE);
+
+  /* Failure handling and scalar updates of successful steps */
+  for (s = s0; s < s1; s++)
+  {
+    k       = s - s0;
+    mask[k] = 0;
+    save[k] = 0;
+
+    if (act[k] == ENS_ACT_CONVFAIL)
+    {
+      if (ens->nls[s] < 0)
+      {
+        ens->status[s] = ENS_FAILED;
+        ens->flag[s]   = ens->nls[s];
+        continue;
+      }
+
+      ens->ncf[s]++;
+      ens->etamax[s] = ONE;
+
+      if (ens->ncf[s] == MXNCF)
+      {
+        ens->status[s] = ENS_FAILED;
+        ens->flag[s]   = (ens->nls[s] == RHSFUNC_RECVR) ? CV_REPTD_RHSFUNC_ERR
+                                                        : CV_CONV_FAILURE;
+        continue;
+      }
+
+      ens->eta[s]   = ETA_CF_DEFAULT;
+      ens->nflag[s] = PREV_CONV_FAIL;
+      mask[k]       = 1;
+    }
+    else if (act[k] == ENS_ACT_ERRFAIL)
+    {
+      ens->nef[s]++;
+      ens->nflag[s] = PREV_ERR_FAIL;
+
+      if (ens->nef[s] == MXNEF)
+      {
+        ens->status[s] = ENS_FAILED;
+        ens->flag[s]   = CV_ERR_FAILURE;
+        continue;
+      }
+
+      ens->etamax[s] = ONE;
+
+      if (ens->nef[s] <= MXNEF1)
+      {
+        ens->eta[s] = ONE / (SUNRpowerR(BIAS2 * dsm[k], ONE / (ens->q[s] + 1)) +
+                             ADDON);
+        ens->eta[s] = SUNMAX(ETA_MIN_EF_DEFAULT, ens->eta[s]);
+        if (ens->nef[s] >= SMALL_NEF_DEFAULT)
+        {
+          ens->eta[s] = SUNMIN(ens->eta[s], ETA_MAX_EF_DEFAULT);
+        }
+        mask[k] = 1;
+      }
+      else if (ens->q[s] > 1)
+      {
+        /* Force an order reduction */
+        ens->eta[s] = ETA_MIN_EF_DEFAULT;
+        cvEnsAdjustOrder(ens, s, -1);
+        ens->q[s]--;
+        ens->qwait[s] = ens->q[s] + 1;
+        mask[k]       = 1;
+      }
+      else
+      {
+        /* Restart at order 1 from f(t_n, zn[0]) */
+        ens->eta[s] = ETA_MIN_EF_DEFAULT;
+        ens->h[s] *= ens->eta[s];
+        ens->hscale[s] = ens->h[s];
+        ens->qwait[s]  = LONG_WAIT;
+        ens->status[s] = ENS_RESTART;
+      }
+    }
+    else if (act[k] == ENS_ACT_SUCCESS)
+    {
+      q = ens->q[s];
+      ens->nst[s]++;
+      ens->nstloc[s]++;
+      for (j = q; j >= 2; j--) { ENS_TAU(ens, j, s) = ENS_TAU(ens, j - 1, s); }
+      if ((q == 1) && (ens->nst[s] > 1))
+      {
+        ENS_TAU(ens, 2, s) = ENS_TAU(ens, 1, s);
+      }
+      ENS_TAU(ens, 1, s) = ens->h[s];
+
+      ens->qwait[s]--;
+      if ((ens->qwait[s] == 1) && (q != qmax))
+      {
+        save[k]           = 1;
+        ens->saved_tq5[s] = ENS_TQ(ens, 5, s);
+      }
+    }
+  }
+
+  cvEnsRescale(ens, s0, s1, mask);
+
+  /* Apply the corrections of the successful steps (see cvCompleteStep) */
+  qm = -1;
+  for (s = s0; s < s1; s++)
+  {
+    if (act[s - s0] == ENS_ACT_SUCCESS) { qm = SUNMAX(qm, ens->q[s]); }
+  }
+
+  for (j = 0; j <= qm; j++)
+  {
+    for (i = 0; i < N; i++)
+    {
+      for (s = s0; s < s1; s++)
+      {
+        if ((act[s - s0] != ENS_ACT_SUCCESS) || (j > ens->q[s])) { continue; }
+        zn[j][i * ns + s] += ENS_L(ens, j, s) * acor[i * ns + s];
+      }
+    }
+  }
+
+  /* Step size and order of the next step (see cvPrepareNextStep) */
+  for (s = s0; s < s1; s++)
+  {
+    k        = s - s0;
+    order[k] = 0;
+    cquot[k] = ZERO;
+    if (act[k] != ENS_ACT_SUCCESS) { continue; }
+
+    if (ens->etamax[s] == ONE)
+    {
+      ens->qwait[s]  = SUNMAX(ens->qwait[s], 2);
+      ens->qprime[s] = ens->q[s];
+      ens->hprime[s] = ens->h[s];
+      ens->eta[s]    = ONE;
+      continue;
+    }
+
+    etaq[k] = ONE /
+              (SUNRpowerR(BIAS2 * dsm[k], ONE / (ens->q[s] + 1)) + ADDON);
+
+    if (ens->qwait[s] != 0)
+    {
+      ens->eta[s]    = etaq[k];
+      ens->qprime[s] = ens->q[s];
+      cvEnsSetEta(ens, s);
+      continue;
+    }
+
+    /* Consider an order change */
+    ens->qwait[s] = 2;
+    order[k]      = 1;
+    if ((ens->q[s] != qmax) && (ens->saved_tq5[s] != ZERO))
+    {
+      cquot[k] = (ENS_TQ(ens, 5, s) / ens->saved_tq5[s]) *
+                 SUNRpowerI(ens->h[s] / ENS_TAU(ens, 2, s), ens->q[s] + 1);
+      order[k] = 2;
+    }
+  }
+
+  /* Norms for the orders q - 1 and q + 1 (see cvComputeEtaqm1qp1) */
+  for (s = s0; s < s1; s++)
+  {
+    nrm1[s - s0] = ZERO;
+    nrm2[s - s0] = ZERO;
+  }
+
+  for (i = 0; i < N; i++)
+  {
+    for (s = s0; s < s1; s++)
+    {
+      k = s - s0;
+      if (!order[k]) { continue; }
+      if (ens->q[s] > 1)
+      {
+        x = zn[ens->q[s]][i * ns + s] * ewt[i * ns + s];
+        nrm1[k] += x * x;
+      }
+      if (order[k] == 2)
+      {
+        x = (-cquot[k] * zn[qmax][i * ns + s] + acor[i * ns + s]) *
+            ewt[i * ns + s];
+        nrm2[k] += x * x;
+      }
+    }
+  }
+
+  for (s = s0; s < s1; s++)
+  {
+    k = s - s0;
+    if (!order[k]) { continue; }
+
+    q      = ens->q[s];
+    etaqm1 = ZERO;
+    etaqp1 = ZERO;
+    if (q > 1)
+    {
+      etaqm1 = ONE / (SUNRpowerR(BIAS1 * (SUNRsqrt(nrm1[k] / N) *
+                                          ENS_TQ(ens, 1, s)),
+                                 ONE / q) +
+                      ADDON);
+    }
+    if (order[k] == 2)
+    {
+      etaqp1 = ONE / (SUNRpowerR(BIAS3 * (SUNRsqrt(nrm2[k] / N) *
+                                          ENS_TQ(ens, 3, s)),
+                                 ONE / (q + 2)) +
+                      ADDON);
+    }
+
+    /* Choose the order with the largest step size (see cvChooseEta) */
+    deltaq = cvChooseOrder(etaqm1, etaq[k], etaqp1, ETA_MIN_FX_DEFAULT,
+                           ETA_MAX_FX_DEFAULT, &(ens->eta[s]));
+    ens->qprime[s] = q + deltaq;
+
+    /* Save acor for the order increase */
+    if ((deltaq == 1) && (ens->lmm == CV_BDF)) { save[k] = 1; }
+
+    cvEnsSetEta(ens, s);
+  }
+
+  for (i = 0; i < N; i++)
+  {
+    for (s = s0; s < s1; s++)
+    {
+      if (save[s - s0]) { zn[qmax][i * ns + s] = acor[i * ns + s]; }
+    }
+  }
+
+  for (s = s0; s < s1; s++)
+  {
+    if (act[s - s0] != ENS_ACT_SUCCESS) { continue; }
+    ens->etamax[s] = (ens->nst[s] <= ens->small_nst) ? ens->eta_max_es
+                                                     : ens->eta_max_gs;
+    ens->status[s] = ENS_NEW_STEP;
+  }
+}
+
+/*
+ * cvEnsRestart
+ *
+ * Reloads zn[1] = h * f(t_n, zn[0]) for the systems that restart at
+ * order 1 after repeated error test failures (see cvDoErrorTest).
+ */
+
+static void cvEnsRestart(CVodeEnsembleMem ens)
+{
+  int retval;
+
+  N_VScale(ONE, ens->zn[0], ens->y);
+
+  retval = ens->f(ens->tn, ens->y, ens->tempv, ens->user_data);
+  ens->nfe++;
+
+  cvEnsForBlocks(ens, cvEnsRestartKernel, &retval);
+}
+
+static void cvEnsRestartKernel(CVodeEnsembleMem ens, sunindextype s0,
+                               sunindextype s1, void* data)
+{
+  const sunindextype ns = ens->nsys, N = ens->N;
+  const int retval       = *((int*)data);
+  const sunrealtype* f   = N_VGetArrayPointer(ens->tempv);
+  sunrealtype* zn1       = N_VGetArrayPointer(ens->zn[1]);
+  sunindextype i, s;
+
+  for (s = s0; s < s1; s++)
+  {
+    if (ens->status[s] != ENS_RESTART) { continue; }
+    if (retval != 0)
+    {
+      ens->status[s] = ENS_FAILED;
+      ens->flag[s] = (retval < 0) ? CV_RHSFUNC_FAIL : CV_UNREC_RHSFUNC_ERR;
+    }
+  }
+
+  for (i = 0; i < N; i++)
+  {
+    for (s = s0; s < s1; s++)
+    {
+      if (ens->status[s] != ENS_RESTART) { continue; }
+      zn1[i * ns + s] = ens->h[s] * f[i * ns + s];
+    }
+  }
+
+  for (s = s0; s < s1; s++)
+  {
+    if (ens->status[s] == ENS_RESTART) { ens->status[s] = ENS_ATTEMPT; }
+  }
+}
+
+/* Copies the solution at the last step of failed systems to yout */
+
+static void cvEnsOutputKernel(CVodeEnsembleMem ens, sunindextype s0,
+                              sunindextype s1, void* data)
+{
+  const sunindextype ns = ens->nsys, N = ens->N;
+  CVEnsOutput* out       = (CVEnsOutput*)data;
+  const sunrealtype* zn0 = N_VGetArrayPointer(ens->zn[0]);
+  sunindextype i, s;
+
+  for (i = 0; i < N; i++)
+  {
+    for (s = s0; s < s1; s++)
+    {
+      if (ens->status[s] == ENS_FAILED)
+      {
+        out->yout[i * ns + s] = zn0[i * ns + s];
+      }
+    }
+  }
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Private Functions -- Nordsieck Array and Method Coefficients
+ * -----------------------------------------------------------------
+ */
+
+/* Applies (predict = SUNTRUE) or undoes the prediction of the masked
+   systems (see cvPredict and cvRestore) */
+
+static void cvEnsShiftHistory(CVodeEnsembleMem ens, sunindextype s0,
+                              sunindextype s1, const int* mask,
+                              sunbooleantype predict)
+{
+  const sunindextype ns = ens->nsys, N = ens->N;
+  sunrealtype* zn[L_MAX];
+  sunindextype i, s;
+  int j, k, qm;
+
+  qm = 0;
+  for (s = s0; s < s1; s++)
+  {
+    if (mask[s - s0]) { qm = SUNMAX(qm, ens->q[s]); }
+  }
+  if (qm == 0) { return; }
+
+  for (j = 0; j <= qm; j++) { zn[j] = N_VGetArrayPointer(ens->zn[j]); }
+
+  for (k = 1; k <= qm; k++)
+  {
+    for (j = qm; j >= k; j--)
+    {
+      for (i = 0; i < N; i++)
+      {
+        for (s = s0; s < s1; s++)
+        {
+          if (!mask[s - s0] || (j > ens->q[s])) { continue; }
+          if (predict) { zn[j - 1][i * ns + s] += zn[j][i * ns + s]; }
+          else { zn[j - 1][i * ns + s] -= zn[j][i * ns + s]; }
+        }
+      }
+    }
+  }
+}
+
+/* Rescales zn[j] by eta^j and sets h = hscale * eta for the masked
+   systems (see cvRescale) */
+
+static void cvEnsRescale(CVodeEnsembleMem ens, sunindextype s0,
+                         sunindextype s1, const int* mask)
+{
+  const sunindextype ns = ens->nsys, N = ens->N;
+  sunrealtype fac[ENS_BLOCK];
+  sunrealtype* znj;
+  sunindextype i, s;
+  int j, qm;
+
+  qm = 0;
+  for (s = s0; s < s1; s++)
+  {
+    fac[s - s0] = ONE;
+    if (!mask[s - s0]) { continue; }
+    qm             = SUNMAX(qm, ens->q[s]);
+    ens->h[s]      = ens->hscale[s] * ens->eta[s];
+    ens->hscale[s] = ens->h[s];
+  }
+
+  for (j = 1; j <= qm; j++)
+  {
+    znj = N_VGetArrayPointer(ens->zn[j]);
+    for (s = s0; s < s1; s++)
+    {
+      if (mask[s - s0] && (j <= ens->q[s])) { fac[s - s0] *= ens->eta[s]; }
+    }
+    for (i = 0; i < N; i++)
+    {
+      for (s = s0; s < s1; s++)
+      {
+        if (mask[s - s0] && (j <= ens->q[s])) { znj[i * ns + s] *= fac[s - s0]; }
+      }
+    }
+  }
+}
+
+/* Adjusts the history array of system s to an order change by deltaq
+   with the coefficients of cvIncreaseBDFCoeffs, cvDecreaseAdamsCoeffs,
+   and cvDecreaseBDFCoeffs (see cvAdjustOrder) */
+
+static void cvEnsAdjustOrder(CVodeEnsembleMem ens, sunindextype s, int deltaq)
+{
+  const sunindextype ns = ens->nsys, N = ens->N;
+  const int q           = ens->q[s];
+  sunrealtype l[L_MAX], tau[L_MAX + 1], A1;
+  sunrealtype *zn[L_MAX], *znL;
+  sunindextype i;
+  int j;
+
+  if ((q == 2) && (deltaq != 1)) { return; }
+
+  for (j = 0; j <= ens->qmax; j++) { zn[j] = N_VGetArrayPointer(ens->zn[j]); }
+
+  /* Adams order increase: the new column of zn is zero */
+  if ((deltaq == 1) && (ens->lmm == CV_ADAMS))
+  {
+    znL = zn[q + 1];
+    for (i = 0; i < N; i++) { znL[i * ns + s] = ZERO; }
+    return;
+  }
+
+  for (j = 1; j <= q; j++) { tau[j] = ENS_TAU(ens, j, s); }
+
+  /* BDF order increase: the new column of zn is a multiple of the
+     saved acor and each zn[j] is adjusted by a multiple of it */
+  if (deltaq == 1)
+  {
+    A1  = cvIncreaseBDFCoeffs(q, ens->qmax, ens->hscale[s], tau, l);
+    znL = zn[q + 1];
+    for (i = 0; i < N; i++) { znL[i * ns + s] = A1 * zn[ens->qmax][i * ns + s]; }
+    for (j = 2; j <= q; j++)
+    {
+      for (i = 0; i < N; i++) { zn[j][i * ns + s] += l[j] * znL[i * ns + s]; }
+    }
+    return;
+  }
+
+  /* Order decrease: each zn[j] is adjusted by a multiple of zn[q] */
+  if (ens->lmm == CV_ADAMS)
+  {
+    cvDecreaseAdamsCoeffs(q, ens->qmax, ens->hscale[s], tau, l);
+  }
+  else { cvDecreaseBDFCoeffs(q, ens->qmax, ens->hscale[s], tau, l); }
+
+  for (j = 2; j < q; j++)
+  {
+    for (i = 0; i < N; i++) { zn[j][i * ns + s] -= l[j] * zn[q][i * ns + s]; }
+  }
+}
+
+/* Computes the method coefficients and gamma of system s (see cvSet) */
+
+static void cvEnsSet(CVodeEnsembleMem ens, sunindextype s)
+{
+  const int q = ens->q[s];
+  sunrealtype l[L_MAX], tq[NUM_TESTS + 1], tau[L_MAX + 1];
+  int j;
+
+  for (j = 1; j <= q; j++) { tau[j] = ENS_TAU(ens, j, s); }
+  for (j = 1; j <= NUM_TESTS; j++) { tq[j] = ENS_TQ(ens, j, s); }
+
+  if (ens->lmm == CV_ADAMS)
+  {
+    cvSetAdamsCoeffs(q, ens->qwait[s], ens->h[s], tau, l, tq);
+  }
+  else { cvSetBDFCoeffs(q, ens->qwait[s], ens->h[s], tau, l, tq, NULL); }
+  tq[4] = CORTES / tq[2];
+
+  for (j = 0; j <= q; j++) { ENS_L(ens, j, s) = l[j]; }
+  for (j = 1; j <= NUM_TESTS; j++) { ENS_TQ(ens, j, s) = tq[j]; }
+
+  ens->rl1[s]   = ONE / l[1];
+  ens->gamma[s] = ens->h[s] * ens->rl1[s];
+  if (ens->nst[s] == 0) { ens->gammap[s] = ens->gamma[s]; }
+  ens->gamrat[s] = (ens->nst[s] > 0) ? ens->gamma[s] / ens->gammap[s] : ONE;
+}
+
+/* Limits the step size ratio of system s (see cvSetEta) */
+
+static void cvEnsSetEta(CVodeEnsembleMem ens, sunindextype s)
+{
+  if ((ens->eta[s] > ETA_MIN_FX_DEFAULT) && (ens->eta[s] < ETA_MAX_FX_DEFAULT))
+  {
+    ens->eta[s]    = ONE;
+    ens->hprime[s] = ens->h[s];
+    return;
+  }
+
+  ens->eta[s] = cvLimitEta(ens->eta[s], ens->etamax[s], ETA_MAX_FX_DEFAULT,
+                           ETA_MIN_DEFAULT, ens->h[s], HMIN_DEFAULT,
+                           HMAX_INV_DEFAULT);
+  ens->hprime[s] = ens->h[s] * ens->eta[s];
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Private Functions -- Newton Iteration
+ * -----------------------------------------------------------------
+ */
+
+/*
+ * cvEnsNls
+ *
+ * Runs the modified Newton iterations of all attempted steps in
+ * lockstep (see cvNls and SUNNonlinSolSolve_Newton). Each pass
+ * evaluates f for all systems, sets up the linear solver if any
+ * iterating system requests it, solves all Newton systems with one
+ * block-dense solve, and applies the convergence test per system.
+ * Systems that converged or failed are masked out of later passes.
+ */
+
+static void cvEnsNls(CVodeEnsembleMem ens)
+{
+  CVEnsFailure fail;
+  sunindextype s;
+  int retval;
+
+  while (cvEnsAny(ens->nls, ens->nsys, ENS_NLS_ITER))
+  {
+    retval = ens->f(ens->tn, ens->y, ens->ftemp, ens->user_data);
+    ens->nfe++;
+    if (retval != 0)
+    {
+      fail.code  = (retval < 0) ? CV_RHSFUNC_FAIL : RHSFUNC_RECVR;
+      fail.retry = ENS_RETRY_INNER;
+      cvEnsForBlocks(ens, cvEnsFailKernel, &fail);
+      continue;
+    }
+
+    cvEnsForBlocks(ens, cvEnsResidualKernel, NULL);
+
+    for (s = 0; s < ens->nsys; s++)
+    {
+      if ((ens->nls[s] == ENS_NLS_ITER) && ens->setup[s])
+      {
+        cvEnsLSetup(ens);
+        break;
+      }
+    }
+    if (!cvEnsAny(ens->nls, ens->nsys, ENS_NLS_ITER)) { break; }
+
+    cvEnsForBlocks(ens, cvEnsGatherKernel, NULL);
+
+    retval = SUNLinSolSolve(ens->LS, ens->A, ens->lsx, ens->lsb, ZERO);
+    if (retval != SUN_SUCCESS)
+    {
+      fail.code  = (retval < 0) ? CV_LSOLVE_FAIL : SUN_NLS_CONV_RECVR;
+      fail.retry = ENS_RETRY_ALWAYS;
+      cvEnsForBlocks(ens, cvEnsFailKernel, &fail);
+      continue;
+    }
+
+    cvEnsForBlocks(ens, cvEnsUpdateKernel, NULL);
+  }
+}
+
+/* Ends the Newton iterations of the iterating systems with a failure.
+   A recoverable failure inside of the iteration is retried with an
+   updated Jacobian if the current one is not fresh. Since f and the
+   linear solver are batched, a failure of either fails every system
+   that is iterating. */
+
+static void cvEnsFailKernel(CVodeEnsembleMem ens, sunindextype s0,
+                            sunindextype s1, void* data)
+{
+  const sunindextype ns = ens->nsys, N = ens->N;
+  const CVEnsFailure* fail = (CVEnsFailure*)data;
+  const sunrealtype* zn0   = N_VGetArrayPointer(ens->zn[0]);
+  sunrealtype* y           = N_VGetArrayPointer(ens->y);
+  sunrealtype* acor        = N_VGetArrayPointer(ens->acor);
+  int reset[ENS_BLOCK], retry;
+  sunindextype i, s;
+
+  for (s = s0; s < s1; s++)
+  {
+    reset[s - s0] = 0;
+    if (ens->nls[s] != ENS_NLS_ITER) { continue; }
+
+    reset[s - s0] = 1;
+    retry         = (fail->code > 0) && !ens->jcur[s] &&
+            ((fail->retry == ENS_RETRY_ALWAYS) ||
+             ((fail->retry == ENS_RETRY_INNER) && (ens->mnewt[s] > 0)));
+
+    if (retry)
+    {
+      ens->mnewt[s]    = 0;
+      ens->setup[s]    = 1;
+      ens->convfail[s] = CV_FAIL_BAD_J;
+    }
+    else { ens->nls[s] = fail->code; }
+  }
+
+  /* Restart from the prediction, which also keeps the input of the
+     batched f finite for the systems that stopped iterating */
+  for (i = 0; i < N; i++)
+  {
+    for (s = s0; s < s1; s++)
+    {
+      if (!reset[s - s0]) { continue; }
+      acor[i * ns + s] = ZERO;
+      y[i * ns + s]    = zn0[i * ns + s];
+    }
+  }
+}
+
+/* Computes the negative nonlinear residual
+   delta = gamma f(t_n, y) - rl1 zn[1] - acor (see cvNlsResidual) */
+
+static void cvEnsResidualKernel(CVodeEnsembleMem ens, sunindextype s0,
+                                sunindextype s1, SUNDIALS_MAYBE_UNUSED void* data)
+{
+  const sunindextype ns = ens->nsys, N = ens->N;
+  const sunrealtype* zn1  = N_VGetArrayPointer(ens->zn[1]);
+  const sunrealtype* acor = N_VGetArrayPointer(ens->acor);
+  const sunrealtype* f    = N_VGetArrayPointer(ens->ftemp);
+  sunrealtype* delta      = N_VGetArrayPointer(ens->delta);
+  sunindextype i, s, idx;
+
+  for (i = 0; i < N; i++)
+  {
+    for (s = s0; s < s1; s++)
+    {
+      if (ens->nls[s] != ENS_NLS_ITER) { continue; }
+      idx        = i * ns + s;
+      delta[idx] = -(-ens->gamma[s] * f[idx] +
+                     (ens->rl1[s] * zn1[idx] + acor[idx]));
+    }
+  }
+}
+
+/* Gathers the residuals into the system-major right-hand side of the
+   block-dense solve, with zeros for the systems not iterating */
+
+static void cvEnsGatherKernel(CVodeEnsembleMem ens, sunindextype s0,
+                              sunindextype s1, SUNDIALS_MAYBE_UNUSED void* data)
+{
+  const sunindextype ns = ens->nsys, N = ens->N;
+  const sunrealtype* delta = N_VGetArrayPointer(ens->delta);
+  sunrealtype* b           = N_VGetArrayPointer(ens->lsb);
+  sunindextype i, s;
+
+  for (s = s0; s < s1; s++)
+  {
+    if (ens->nls[s] == ENS_NLS_ITER)
+    {
+      for (i = 0; i < N; i++) { b[s * N + i] = delta[i * ns + s]; }
+    }
+    else
+    {
+      for (i = 0; i < N; i++) { b[s * N + i] = ZERO; }
+    }
+  }
+}
+
+/* Applies the Newton updates and the convergence test (see cvLsSolve
+   and cvNlsConvTest) */
+
+static void cvEnsUpdateKernel(CVodeEnsembleMem ens, sunindextype s0,
+                              sunindextype s1, SUNDIALS_MAYBE_UNUSED void* data)
+{
+  const sunindextype ns = ens->nsys, N = ens->N;
+  const sunrealtype* zn0 = N_VGetArrayPointer(ens->zn[0]);
+  const sunrealtype* ewt = N_VGetArrayPointer(ens->ewt);
+  const sunrealtype* x   = N_VGetArrayPointer(ens->lsx);
+  sunrealtype* delta     = N_VGetArrayPointer(ens->delta);
+  sunrealtype* acor      = N_VGetArrayPointer(ens->acor);
+  sunrealtype* y         = N_VGetArrayPointer(ens->y);
+  CVEnsFailure diverged = {SUN_NLS_CONV_RECVR, ENS_RETRY_ALWAYS};
+  sunrealtype scale[ENS_BLOCK], dnrm[ENS_BLOCK], anrm[ENS_BLOCK];
+  sunrealtype d, w, del, dcon;
+  sunindextype i, s, k, idx;
+
+  for (s = s0; s < s1; s++)
+  {
+    k       = s - s0;
+    dnrm[k] = ZERO;
+    anrm[k] = ZERO;
+
+    /* Scale the solution to account for a change in gamma */
+    scale[k] = ((ens->lmm == CV_BDF) && (ens->gamrat[s] != ONE))
+                 ? TWO / (ONE + ens->gamrat[s])
+                 : ONE;
+  }
+
+  for (i = 0; i < N; i++)
+  {
+    for (s = s0; s < s1; s++)
+    {
+      k = s - s0;
+      if (ens->nls[s] != ENS_NLS_ITER) { continue; }
+      idx = i * ns + s;
+      d   = x[s * N + i];
+      if (scale[k] != ONE) { d *= scale[k]; }
+      delta[idx] = d;
+      acor[idx] += d;
+      y[idx] = zn0[idx] + acor[idx];
+      w      = d * ewt[idx];
+      dnrm[k] += w * w;
+      w = acor[idx] * ewt[idx];
+      anrm[k] += w * w;
+    }
+  }
+
+  for (s = s0; s < s1; s++)
+  {
+    k = s - s0;
+    if (ens->nls[s] != ENS_NLS_ITER) { continue; }
+
+    del = SUNRsqrt(dnrm[k] / N);
+    if (ens->mnewt[s] > 0)
+    {
+      ens->crate[s] = SUNMAX(CRDOWN * ens->crate[s], del / ens->delp[s]);
+    }
+    dcon = del * SUNMIN(ONE, ens->crate[s]) / ENS_TQ(ens, 4, s);
+
+    if (dcon <= ONE)
+    {
+      ens->acnrm[s] = (ens->mnewt[s] == 0) ? del : SUNRsqrt(anrm[k] / N);
+      ens->nls[s]   = CV_SUCCESS;
+      continue;
+    }
+
+    if (((ens->mnewt[s] >= 1) && (del > RDIV * ens->delp[s])) ||
+        (ens->mnewt[s] + 1 >= NLS_MAXCOR))
+    {
+      cvEnsFailKernel(ens, s, s + 1, &diverged);
+      continue;
+    }
+
+    ens->delp[s] = del;
+    ens->mnewt[s]++;
+  }
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Private Functions -- Linear Solver Setup
+ * -----------------------------------------------------------------
+ */
+
+/*
+ * cvEnsLSetup
+ *
+ * Sets up the Newton matrices I - gamma J of the iterating systems
+ * that requested it (see cvNlsLSetup and cvLsSetup). If any of them
+ * needs an updated Jacobian, the batched Jacobian is evaluated once
+ * for all systems and saved for the systems that needed it. The
+ * blocks of the other systems are rebuilt from their saved Jacobian
+ * and their gamma at the last setup, so that one block-dense
+ * factorization serves all systems.
+ *
+ * The factorization aborts on the first singular block of a group,
+ * leaving the other blocks of that group unfactored, so a failed
+ * factorization is a recoverable failure of every iterating system,
+ * and the next setup refactors all blocks.
+ */
+
+static void cvEnsLSetup(CVodeEnsembleMem ens)
+{
+  CVEnsFailure fail;
+  sunbooleantype jeval;
+  int retval;
+
+  cvEnsForBlocks(ens, cvEnsJbadKernel, NULL);
+
+  jeval = SUNFALSE;
+  if (cvEnsAny(ens->setup, ens->nsys, ENS_SETUP_JAC))
+  {
+    (void)SUNMatZero(ens->A);
+    if (ens->jac)
+    {
+      retval = ens->jac(ens->tn, ens->y, ens->ftemp, ens->A, ens->user_data,
+                        ens->tempv, ens->lsx, ens->lsb);
+    }
+    else { retval = cvEnsDQJac(ens); }
+    ens->nje++;
+
+    if (retval != 0)
+    {
+      ens->forceA = SUNTRUE;
+      fail.code   = (retval < 0) ? CV_LSETUP_FAIL : SUN_NLS_CONV_RECVR;
+      fail.retry  = ENS_RETRY_NEVER;
+      cvEnsForBlocks(ens, cvEnsFailKernel, &fail);
+      return;
+    }
+    jeval = SUNTRUE;
+  }
+
+  cvEnsForBlocks(ens, cvEnsBuildKernel, &jeval);
+
+  retval = SUNLinSolSetup(ens->LS, ens->A);
+  ens->nsetups++;
+
+  cvEnsForBlocks(ens, cvEnsSetupDoneKernel, NULL);
+
+  ens->forceA = (retval != SUN_SUCCESS);
+  if (retval != SUN_SUCCESS)
+  {
+    fail.code  = (retval < 0) ? CV_LSETUP_FAIL : SUN_NLS_CONV_RECVR;
+    fail.retry = ENS_RETRY_NEVER;
+    cvEnsForBlocks(ens, cvEnsFailKernel, &fail);
+  }
+}
+
+/* Decides which requesting systems need an updated Jacobian (see
+   cvLsSetup) */
+
+static void cvEnsJbadKernel(CVodeEnsembleMem ens, sunindextype s0,
+                            sunindextype s1, SUNDIALS_MAYBE_UNUSED void* data)
+{
+  sunrealtype dgamma;
+  sunbooleantype jbad;
+  sunindextype s;
+
+  for (s = s0; s < s1; s++)
+  {
+    if (ens->nls[s] != ENS_NLS_ITER)
+    {
+      ens->setup[s] = 0;
+      continue;
+    }
+    if (!ens->setup[s]) { continue; }
+
+    dgamma = SUNRabs((ens->gamma[s] / ens->gammap[s]) - ONE);
+    jbad   = (ens->nst[s] == 0) || (ens->nst[s] >= ens->nstlj[s] + CVLS_MSBJ) ||
+           ((ens->convfail[s] == CV_FAIL_BAD_J) && (dgamma < CVLS_DGMAX)) ||
+           (ens->convfail[s] == CV_FAIL_OTHER);
+
+    ens->setup[s] = jbad ? ENS_SETUP_JAC : ENS_SETUP_REUSE;
+  }
+}
+
+/* Saves the updated Jacobian blocks and rebuilds every block of A,
+   since the factorization overwrites A. The requesting systems get
+   I - gamma J and the others the matrix I - gammap J of their last
+   setup. Failed systems get the identity, so that their last matrix
+   cannot fail the factorization of the other systems. */
+
+static void cvEnsBuildKernel(CVodeEnsembleMem ens, sunindextype s0,
+                             sunindextype s1, void* data)
+{
+  const sunindextype ns = ens->nsys, N = ens->N;
+  const sunbooleantype jeval = *((sunbooleantype*)data);
+  const sunindextype g0      = s0 / SUN_BLOCKDENSE_GROUP_SIZE;
+  const sunindextype g1 = (s1 + SUN_BLOCKDENSE_GROUP_SIZE - 1) /
+                          SUN_BLOCKDENSE_GROUP_SIZE;
+  sunrealtype gam[SUN_BLOCKDENSE_GROUP_SIZE];
+  int save[SUN_BLOCKDENSE_GROUP_SIZE];
+  sunrealtype *Ag, *Jg;
+  sunindextype g, i, j, l, s, idx;
+
+  for (g = g0; g < g1; g++)
+  {
+    Ag = SM_GROUP_BD(ens->A, g);
+    Jg = SM_GROUP_BD(ens->savedJ, g);
+
+    for (l = 0; l < SUN_BLOCKDENSE_GROUP_SIZE; l++)
+    {
+      s       = g * SUN_BLOCKDENSE_GROUP_SIZE + l;
+      gam[l]  = ZERO;
+      save[l] = 0;
+      if ((s >= ns) || (ens->status[s] == ENS_FAILED)) { continue; }
+      gam[l]  = (ens->setup[s]) ? ens->gamma[s] : ens->gammap[s];
+      save[l] = jeval && (ens->setup[s] == ENS_SETUP_JAC);
+    }
+
+    for (j = 0; j < N; j++)
+    {
+      for (i = 0; i < N; i++)
+      {
+        idx = (j * N + i) * SUN_BLOCKDENSE_GROUP_SIZE;
+        for (l = 0; l < SUN_BLOCKDENSE_GROUP_SIZE; l++)
+        {
+          if (save[l]) { Jg[idx + l] = Ag[idx + l]; }
+          Ag[idx + l] = ((i == j) ? ONE : ZERO) - gam[l] * Jg[idx + l];
+        }
+      }
+    }
+  }
+}
+
+/* Updates the setup bookkeeping of the requesting systems (see
+   cvNlsLSetup and cvLsSetup) */
+
+static void cvEnsSetupDoneKernel(CVodeEnsembleMem ens, sunindextype s0,
+                                 sunindextype s1, SUNDIALS_MAYBE_UNUSED void* data)
+{
+  sunindextype s;
+
+  for (s = s0; s < s1; s++)
+  {
+    if (!ens->setup[s]) { continue; }
+
+    ens->jcur[s] = (ens->setup[s] == ENS_SETUP_JAC);
+    if (ens->jcur[s]) { ens->nstlj[s] = ens->nst[s]; }
+
+    ens->gamrat[s] = ONE;
+    ens->gammap[s] = ens->gamma[s];
+    ens->crate[s]  = ONE;
+    ens->nstlp[s]  = ens->nst[s];
+    ens->setup[s]  = 0;
+  }
+}
+
+/*
+ * cvEnsDQJac
+ *
+ * Approximates the Jacobians of all systems by difference quotients
+ * (see cvLsDenseDQJac). Column j of every block is computed from one
+ * batched evaluation of f with component j of every system perturbed.
+ * The RWORK arrays hold the minimum increments (0), the saved
+ * components (1), and the increments (2).
+ */
+
+static int cvEnsDQJac(CVodeEnsembleMem ens)
+{
+  sunindextype j;
+  int retval;
+
+  cvEnsForBlocks(ens, cvEnsDQIncKernel, NULL);
+
+  for (j = 0; j < ens->N; j++)
+  {
+    cvEnsForBlocks(ens, cvEnsDQPerturbKernel, &j);
+    retval = ens->f(ens->tn, ens->y, ens->tempv, ens->user_data);
+    ens->nfe++;
+    cvEnsForBlocks(ens, cvEnsDQColumnKernel, &j);
+    if (retval != 0) { return (retval); }
+  }
+
+  return (0);
+}
+
+/* Computes the minimum increments from the norms of f */
+
+static void cvEnsDQIncKernel(CVodeEnsembleMem ens, sunindextype s0,
+                             sunindextype s1, SUNDIALS_MAYBE_UNUSED void* data)
+{
+  const sunindextype ns = ens->nsys, N = ens->N;
+  const sunrealtype* ewt = N_VGetArrayPointer(ens->ewt);
+  const sunrealtype* f   = N_VGetArrayPointer(ens->ftemp);
+  sunrealtype fnorm[ENS_BLOCK], x;
+  sunindextype i, s;
+
+  for (s = s0; s < s1; s++) { fnorm[s - s0] = ZERO; }
+
+  for (i = 0; i < N; i++)
+  {
+    for (s = s0; s < s1; s++)
+    {
+      x = f[i * ns + s] * ewt[i * ns + s];
+      fnorm[s - s0] += x * x;
+    }
+  }
+
+  for (s = s0; s < s1; s++)
+  {
+    fnorm[s - s0]     = SUNRsqrt(fnorm[s - s0] / N);
+    RWORK(ens, 0)[s] = (fnorm[s - s0] != ZERO)
+                         ? (MIN_INC_MULT * SUNRabs(ens->h[s]) * ens->uround *
+                            N * fnorm[s - s0])
+                         : ONE;
+  }
+}
+
+/* Perturbs component j of every system */
+
+static void cvEnsDQPerturbKernel(CVodeEnsembleMem ens, sunindextype s0,
+                                 sunindextype s1, void* data)
+{
+  const sunindextype ns = ens->nsys;
+  const sunindextype j   = *((sunindextype*)data);
+  const sunrealtype srur = SUNRsqrt(ens->uround);
+  const sunrealtype* ewt = N_VGetArrayPointer(ens->ewt);
+  sunrealtype* y         = N_VGetArrayPointer(ens->y);
+  sunrealtype *ysaved = RWORK(ens, 1), *inc = RWORK(ens, 2);
+  sunindextype s;
+
+  for (s = s0; s < s1; s++)
+  {
+    ysaved[s] = y[j * ns + s];
+    inc[s]    = SUNMAX(srur * SUNRabs(ysaved[s]),
+                       RWORK(ens, 0)[s] / ewt[j * ns + s]);
+    y[j * ns + s] += inc[s];
+  }
+}
+
+/* Stores column j of every block and restores component j */
+
+static void cvEnsDQColumnKernel(CVodeEnsembleMem ens, sunindextype s0,
+                                sunindextype s1, void* data)
+{
+  const sunindextype ns = ens->nsys, N = ens->N;
+  const sunindextype j   = *((sunindextype*)data);
+  const sunrealtype* fy  = N_VGetArrayPointer(ens->ftemp);
+  const sunrealtype* ftj = N_VGetArrayPointer(ens->tempv);
+  sunrealtype* y         = N_VGetArrayPointer(ens->y);
+  sunrealtype inc_inv;
+  sunindextype i, s;
+
+  for (s = s0; s < s1; s++)
+  {
+    inc_inv = ONE / RWORK(ens, 2)[s];
+    for (i = 0; i < N; i++)
+    {
+      SM_ELEMENT_BD(ens->A, s, i, j) = inc_inv *
+                                       (ftj[i * ns + s] - fy[i * ns + s]);
+    }
+    y[j * ns + s] = RWORK(ens, 1)[s];
+  }
+}
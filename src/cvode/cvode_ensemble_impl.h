@@ -0,0 +1,161 @@
+/*
+ * -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2025-2026, Lawrence Livermore National Security,
+ * University of Maryland Baltimore County, and the SUNDIALS contributors.
+ * Copyright (c) 2013-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * Copyright (c) 2002-2013, Lawrence Livermore National Security.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * Implementation header file for the CVODE ensemble interface.
+ * -----------------------------------------------------------------
+ */
+
+#ifndef _CVODE_ENSEMBLE_IMPL_H
+#define _CVODE_ENSEMBLE_IMPL_H
+
+#include <cvode/cvode_ensemble.h>
+#include <sundials/sundials_linearsolver.h>
+
+#include "cvode_impl.h"
+
+#ifdef __cplusplus /* wrapper to enable C++ usage */
+extern "C" {
+#endif
+
+typedef struct CVodeEnsembleMemRec* CVodeEnsembleMem;
+
+/*
+ * -----------------------------------------------------------------
+ * Types: CVodeEnsembleMemRec, CVodeEnsembleMem
+ * -----------------------------------------------------------------
+ * The ensemble is a structure of arrays. The Nordsieck array and
+ * the work vectors hold all systems in one interleaved vector each,
+ * with component i of system s in entry i * nsys + s. The scalar
+ * integrator state (t_n, h, q, gamma, ...) is stored in arrays of
+ * length nsys, and the method coefficients l, tq and the step size
+ * history tau in arrays with entry j of system s at j * nsys + s.
+ * The Newton matrices of all systems are the blocks of a single
+ * SUNMATRIX_BLOCKDENSE matrix factored by SUNLINSOL_BLOCKDENSE.
+ * -----------------------------------------------------------------
+ */
+
+struct CVodeEnsembleMemRec
+{
+  SUNContext sunctx; /* user's context, used by every ensemble object */
+
+  /* Problem specification */
+  int lmm;             /* CV_ADAMS or CV_BDF                       */
+  int qmax;            /* maximum method order                     */
+  sunindextype nsys;   /* number of systems                        */
+  sunindextype N;      /* size of each system                      */
+  CVEnsembleRhsFn f;   /* batched right-hand side                  */
+  CVEnsembleJacFn jac; /* batched Jacobian (NULL = DQ)             */
+  void* user_data;     /* user data passed to f and jac            */
+  sunrealtype reltol;  /* relative tolerance                       */
+  sunrealtype abstol;  /* absolute tolerance                       */
+  long int mxstep;     /* max steps per system and CVodeEnsemble   */
+  int nthreads;        /* number of OpenMP threads                 */
+  sunrealtype uround;  /* unit roundoff                            */
+
+  /* Step size change bounds after a successful step (see cvode.c) */
+  sunrealtype eta_max_es; /* eta <= eta_max_es on early steps         */
+  sunrealtype eta_max_gs; /* eta <= eta_max_gs on a general step      */
+  long int small_nst;     /* nst <= small_nst use eta_max_es          */
+
+  /* Interleaved vectors of length nsys * N */
+  N_Vector zn[L_MAX]; /* Nordsieck arrays                         */
+  N_Vector ewt;       /* error weights                            */
+  N_Vector y;         /* current iterate of the nonlinear solve   */
+  N_Vector acor;      /* accumulated correction                   */
+  N_Vector delta;     /* Newton update                            */
+  N_Vector ftemp;     /* f(t_n, y)                                */
+  N_Vector tempv;     /* temporary vector                         */
+
+  /* Linear algebra shared by all systems */
+  SUNMatrix A;           /* block-dense Newton matrix I - gamma J      */
+  SUNMatrix savedJ;      /* block-dense Jacobian at the last update    */
+  SUNLinearSolver LS;    /* block-dense LU solver                      */
+  N_Vector lsx, lsb;     /* solution and rhs in system-major layout    */
+  sunbooleantype forceA; /* A is invalid and every system must set up  */
+
+  /* Per-system scalars (arrays of length nsys) */
+  sunrealtype* tn;        /* current internal time                     */
+  sunrealtype* h;         /* current step size                         */
+  sunrealtype* hprime;    /* step size for the next step               */
+  sunrealtype* hscale;    /* step size the history is scaled to        */
+  sunrealtype* eta;       /* step size ratio                           */
+  sunrealtype* etamax;    /* maximum step size ratio                   */
+  sunrealtype* rl1;       /* 1 / l[1]                                  */
+  sunrealtype* gamma;     /* h * rl1                                   */
+  sunrealtype* gammap;    /* gamma at the last setup                   */
+  sunrealtype* gamrat;    /* gamma / gammap                            */
+  sunrealtype* crate;     /* estimated corrector convergence rate      */
+  sunrealtype* delp;      /* norm of the previous Newton update        */
+  sunrealtype* acnrm;     /* WRMS norm of acor                         */
+  sunrealtype* saved_t;   /* t_n at the start of the step attempt      */
+  sunrealtype* saved_tq5; /* tq[5] saved for an order increase         */
+  sunrealtype* rwork;     /* real workspace (ENS_NRWORK * nsys)        */
+  int* q;                 /* current order                             */
+  int* qprime;            /* order for the next step                   */
+  int* qwait;             /* steps to wait before an order change      */
+  int* status;            /* ENS_* status in the current call          */
+  int* nflag;             /* FIRST_CALL, PREV_CONV_FAIL, PREV_ERR_FAIL */
+  int* ncf;               /* convergence failures in this step         */
+  int* nef;               /* error test failures in this step          */
+  int* convfail;          /* convfail passed to the setup decision     */
+  int* nls;               /* ENS_NLS_* state of the Newton iteration   */
+  int* mnewt;             /* current Newton iteration                  */
+  int* setup;             /* the system requested a linear setup       */
+  int* jcur;              /* the system's Jacobian is current          */
+  int* flag;              /* CVODE return flag of the system           */
+  long int* nst;          /* steps taken                               */
+  long int* nstloc;       /* steps taken in the current call           */
+  long int* nstlp;        /* step of the last linear setup             */
+  long int* nstlj;        /* step of the last Jacobian update          */
+
+  /* Per-system method coefficients, entry j of system s at j*nsys+s */
+  sunrealtype* l;   /* polynomial coefficients l[0..qmax]         */
+  sunrealtype* tq;  /* test quantities tq[1..NUM_TESTS]            */
+  sunrealtype* tau; /* step size history tau[1..qmax+1]           */
+
+  /* Storage of the per-system arrays */
+  sunrealtype* rdata; /* real arrays                                */
+  int* idata;         /* integer arrays                             */
+  long int* ldata;    /* long integer arrays                        */
+
+  /* Ensemble status and counters */
+  sunbooleantype malloc_done; /* CVodeEnsembleInit has been called     */
+  sunbooleantype initialized; /* initial step sizes have been computed */
+  long int nfe;               /* batched f evaluations                 */
+  long int nsetups;           /* block-dense factorizations            */
+  long int nje;               /* batched Jacobian evaluations          */
+};
+
+/* Error Messages */
+
+#define MSGENS_MEM_NULL  "cvode ensemble memory is NULL."
+#define MSGENS_NO_INIT   "CVodeEnsembleInit has not been called."
+#define MSGENS_REINIT    "CVodeEnsembleInit has already been called."
+#define MSGENS_MEM_FAIL  "A memory request failed."
+#define MSGENS_BAD_LMM   "Illegal value for lmm."
+#define MSGENS_BAD_SIZE  "The number of systems and the system size must be positive."
+#define MSGENS_NULL_F    "f = NULL illegal."
+#define MSGENS_BAD_Y     "The vector must have length nsys * N and a data array."
+#define MSGENS_BAD_TOL   "reltol and abstol must be nonnegative."
+#define MSGENS_BAD_NT    "nthreads must be positive."
+#define MSGENS_RHS_FAIL  "The right-hand side routine failed at the first call."
+#define MSGENS_HIN_FAIL  "The initial step size could not be computed."
+#define MSGENS_SYS_FAIL  "The integration failed for at least one system."
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,420 @@
+/*
+ * -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2025-2026, Lawrence Livermore National Security,
+ * University of Maryland Baltimore County, and the SUNDIALS contributors.
+ * Copyright (c) 2013-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * Copyright (c) 2002-2013, Lawrence Livermore National Security.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * This file implements fused CPU kernels for CVODE. Each kernel
+ * replaces a sequence of N_Vector operations (and in some cases the
+ * norm or inversion test that follows them) with a single loop over
+ * the host data of serial, OpenMP, or Pthreads vectors. When OpenMP
+ * is enabled, the loops are threaded with the number of threads of
+ * NVECTOR_OPENMP and NVECTOR_PTHREADS vectors, and they are otherwise
+ * left to the compiler to vectorize.
+ * -----------------------------------------------------------------
+ */
+
+#include <sundials/sundials_math.h>
+
+#include "cvode_diag_impl.h"
+#include "cvode_impl.h"
+#include "sundials_macros.h"
+
+#if defined(SUNDIALS_OPENMP_ENABLED)
+#include <nvector/nvector_openmp.h>
+#if defined(SUNDIALS_PTHREADS_ENABLED)
+#include <nvector/nvector_pthreads.h>
+#endif
+#endif
+
+#define ZERO   SUN_RCONST(0.0)
+#define PT1    SUN_RCONST(0.1)
+#define ONEPT5 SUN_RCONST(1.50)
+#define ONE    SUN_RCONST(1.0)
+
+/*
+ * -----------------------------------------------------------------
+ * Number of OpenMP threads to use with the vector v (the number of
+ * threads of an NVECTOR_OPENMP or NVECTOR_PTHREADS vector and one
+ * otherwise).
+ * -----------------------------------------------------------------
+ */
+
+static int cvFusedNumThreads(N_Vector v)
+{
+#if defined(SUNDIALS_OPENMP_ENABLED)
+  if (N_VGetVectorID(v) == SUNDIALS_NVEC_OPENMP)
+  {
+    return NV_NUM_THREADS_OMP(v);
+  }
+#if defined(SUNDIALS_PTHREADS_ENABLED)
+  if (N_VGetVectorID(v) == SUNDIALS_NVEC_PTHREADS)
+  {
+    return NV_NUM_THREADS_PT(v);
+  }
+#endif
+#else
+  ((void)v);
+#endif
+  return 1;
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Check if the CPU fused kernels can be used with the vector v.
+ * -----------------------------------------------------------------
+ */
+
+sunbooleantype cvFusedCPUCompatible(N_Vector v)
+{
+  N_Vector_ID id = N_VGetVectorID(v);
+  return (id == SUNDIALS_NVEC_SERIAL || id == SUNDIALS_NVEC_OPENMP ||
+          id == SUNDIALS_NVEC_PTHREADS);
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Compute the ewt vector when the tol type is CV_SS. Returns -1 if
+ * atolmin0 is true and a component of reltol*|ycur| + Sabstol is
+ * non-positive (ewt is then left unchanged) and 0 otherwise.
+ * -----------------------------------------------------------------
+ */
+
+int cvEwtSetSS_fusedCPU(const sunbooleantype atolmin0, const sunrealtype reltol,
+                        const sunrealtype Sabstol, const N_Vector ycur,
+                        N_Vector weight)
+{
+  const sunindextype N  = N_VGetLength(weight);
+  const sunrealtype* yd = N_VGetArrayPointer(ycur);
+  sunrealtype* wd       = N_VGetArrayPointer(weight);
+  sunrealtype tmin      = SUN_BIG_REAL;
+  sunindextype i;
+
+  SUNDIALS_MAYBE_UNUSED const int nthreads = cvFusedNumThreads(weight);
+
+  /* check the weights are positive before inverting them */
+  if (atolmin0)
+  {
+#if defined(SUNDIALS_OPENMP_ENABLED)
+#pragma omp parallel for schedule(static) num_threads(nthreads) \
+  reduction(min : tmin) if (nthreads > 1)
+#endif
+    for (i = 0; i < N; i++)
+    {
+      tmin = SUNMIN(tmin, reltol * SUNRabs(yd[i]) + Sabstol);
+    }
+    if (tmin <= ZERO) { return (-1); }
+  }
+
+#if defined(SUNDIALS_OPENMP_ENABLED)
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+#endif
+  for (i = 0; i < N; i++) { wd[i] = ONE / (reltol * SUNRabs(yd[i]) + Sabstol); }
+
+  return (0);
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Compute the ewt vector when the tol type is CV_SV.
+ * -----------------------------------------------------------------
+ */
+
+int cvEwtSetSV_fusedCPU(const sunbooleantype atolmin0, const sunrealtype reltol,
+                        const N_Vector Vabstol, const N_Vector ycur,
+                        N_Vector weight)
+{
+  const sunindextype N  = N_VGetLength(weight);
+  const sunrealtype* yd = N_VGetArrayPointer(ycur);
+  const sunrealtype* ad = N_VGetArrayPointer(Vabstol);
+  sunrealtype* wd       = N_VGetArrayPointer(weight);
+  sunrealtype tmin      = SUN_BIG_REAL;
+  sunindextype i;
+
+  SUNDIALS_MAYBE_UNUSED const int nthreads = cvFusedNumThreads(weight);
+
+  /* check the weights are positive before inverting them */
+  if (atolmin0)
+  {
+#if defined(SUNDIALS_OPENMP_ENABLED)
+#pragma omp parallel for schedule(static) num_threads(nthreads) \
+  reduction(min : tmin) if (nthreads > 1)
+#endif
+    for (i = 0; i < N; i++)
+    {
+      tmin = SUNMIN(tmin, reltol * SUNRabs(yd[i]) + ad[i]);
+    }
+    if (tmin <= ZERO) { return (-1); }
+  }
+
+#if defined(SUNDIALS_OPENMP_ENABLED)
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+#endif
+  for (i = 0; i < N; i++) { wd[i] = ONE / (reltol * SUNRabs(yd[i]) + ad[i]); }
+
+  return (0);
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Compute the constraint correction vector and its WRMS norm. With
+ * a = c where |c| = 2 and zero otherwise, this sets
+ * save = -0.1 * a * ewt^{-1}, tmp = mm * (y + save), and returns
+ * ||tmp||_WRMS in vnorm.
+ * -----------------------------------------------------------------
+ */
+
+int cvCheckConstraints_fusedCPU(const N_Vector c, const N_Vector ewt,
+                                const N_Vector y, const N_Vector mm,
+                                N_Vector tmp, N_Vector save, sunrealtype* vnorm)
+{
+  const sunindextype N  = N_VGetLength(ewt);
+  const sunrealtype* cd = N_VGetArrayPointer(c);
+  const sunrealtype* wd = N_VGetArrayPointer(ewt);
+  const sunrealtype* yd = N_VGetArrayPointer(y);
+  const sunrealtype* md = N_VGetArrayPointer(mm);
+  sunrealtype* td       = N_VGetArrayPointer(tmp);
+  sunrealtype* sd       = N_VGetArrayPointer(save);
+  sunrealtype sum       = ZERO;
+  sunindextype i;
+
+  SUNDIALS_MAYBE_UNUSED const int nthreads = cvFusedNumThreads(ewt);
+
+#if defined(SUNDIALS_OPENMP_ENABLED)
+#pragma omp parallel for schedule(static) num_threads(nthreads) \
+  reduction(+ : sum) if (nthreads > 1)
+#endif
+  for (i = 0; i < N; i++)
+  {
+    const sunrealtype a = (SUNRabs(cd[i]) >= ONEPT5) ? cd[i] : ZERO;
+    const sunrealtype s = -PT1 * (a / wd[i]);
+    const sunrealtype v = md[i] * (yd[i] + s);
+    sd[i]               = s;
+    td[i]               = v;
+    sum += (v * wd[i]) * (v * wd[i]);
+  }
+
+  *vnorm = SUNRsqrt(sum / N);
+  return (0);
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Compute the nonlinear residual, res = rl1*zn1 + ycor + ngamma*ftemp.
+ * -----------------------------------------------------------------
+ */
+
+int cvNlsResid_fusedCPU(const sunrealtype rl1, const sunrealtype ngamma,
+                        const N_Vector zn1, const N_Vector ycor,
+                        const N_Vector ftemp, N_Vector res)
+{
+  const sunindextype N  = N_VGetLength(res);
+  const sunrealtype* zd = N_VGetArrayPointer(zn1);
+  const sunrealtype* cd = N_VGetArrayPointer(ycor);
+  const sunrealtype* fd = N_VGetArrayPointer(ftemp);
+  sunrealtype* rd       = N_VGetArrayPointer(res);
+  sunindextype i;
+
+  SUNDIALS_MAYBE_UNUSED const int nthreads = cvFusedNumThreads(res);
+
+#if defined(SUNDIALS_OPENMP_ENABLED)
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+#endif
+  for (i = 0; i < N; i++) { rd[i] = ngamma * fd[i] + (rl1 * zd[i] + cd[i]); }
+
+  return (0);
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Apply the final Newton correction, y = zn0 + acor, and when
+ * requested compute the WRMS norm of the correction used by the
+ * local error test in the same pass.
+ * -----------------------------------------------------------------
+ */
+
+int cvCorrectY_fusedCPU(const N_Vector zn0, const N_Vector acor,
+                        const N_Vector ewt, N_Vector y, sunrealtype* acnrm)
+{
+  const sunindextype N  = N_VGetLength(y);
+  const sunrealtype* zd = N_VGetArrayPointer(zn0);
+  const sunrealtype* ad = N_VGetArrayPointer(acor);
+  const sunrealtype* wd = N_VGetArrayPointer(ewt);
+  sunrealtype* yd       = N_VGetArrayPointer(y);
+  sunrealtype sum       = ZERO;
+  sunindextype i;
+
+  SUNDIALS_MAYBE_UNUSED const int nthreads = cvFusedNumThreads(y);
+
+  if (acnrm == NULL)
+  {
+#if defined(SUNDIALS_OPENMP_ENABLED)
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+#endif
+    for (i = 0; i < N; i++) { yd[i] = zd[i] + ad[i]; }
+  }
+  else
+  {
+#if defined(SUNDIALS_OPENMP_ENABLED)
+#pragma omp parallel for schedule(static) num_threads(nthreads) \
+  reduction(+ : sum) if (nthreads > 1)
+#endif
+    for (i = 0; i < N; i++)
+    {
+      yd[i] = zd[i] + ad[i];
+      sum += (ad[i] * wd[i]) * (ad[i] * wd[i]);
+    }
+    *acnrm = SUNRsqrt(sum / N);
+  }
+
+  return (0);
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Compute ||a*x + b*z||_WRMS with weights w without storing the
+ * linear sum (used for the order increase error estimate).
+ * -----------------------------------------------------------------
+ */
+
+sunrealtype cvWrmsNormLinearSum_fusedCPU(const sunrealtype a, const N_Vector x,
+                                         const sunrealtype b, const N_Vector z,
+                                         const N_Vector w)
+{
+  const sunindextype N  = N_VGetLength(w);
+  const sunrealtype* xd = N_VGetArrayPointer(x);
+  const sunrealtype* zd = N_VGetArrayPointer(z);
+  const sunrealtype* wd = N_VGetArrayPointer(w);
+  sunrealtype sum       = ZERO;
+  sunindextype i;
+
+  SUNDIALS_MAYBE_UNUSED const int nthreads = cvFusedNumThreads(w);
+
+#if defined(SUNDIALS_OPENMP_ENABLED)
+#pragma omp parallel for schedule(static) num_threads(nthreads) \
+  reduction(+ : sum) if (nthreads > 1)
+#endif
+  for (i = 0; i < N; i++)
+  {
+    const sunrealtype v = (a * xd[i] + b * zd[i]) * wd[i];
+    sum += v * v;
+  }
+
+  return (SUNRsqrt(sum / N));
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Form y with perturbation = FRACT*(func. iter. correction)
+ * -----------------------------------------------------------------
+ */
+
+int cvDiagSetup_formY_fusedCPU(const sunrealtype h, const sunrealtype r,
+                               const N_Vector fpred, const N_Vector zn1,
+                               const N_Vector ypred, N_Vector ftemp, N_Vector y)
+{
+  const sunindextype N   = N_VGetLength(y);
+  const sunrealtype* fpd = N_VGetArrayPointer(fpred);
+  const sunrealtype* zd  = N_VGetArrayPointer(zn1);
+  const sunrealtype* ypd = N_VGetArrayPointer(ypred);
+  sunrealtype* ftd       = N_VGetArrayPointer(ftemp);
+  sunrealtype* yd        = N_VGetArrayPointer(y);
+  sunindextype i;
+
+  SUNDIALS_MAYBE_UNUSED const int nthreads = cvFusedNumThreads(y);
+
+#if defined(SUNDIALS_OPENMP_ENABLED)
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+#endif
+  for (i = 0; i < N; i++)
+  {
+    const sunrealtype ft = h * fpd[i] - zd[i];
+    ftd[i]               = ft;
+    yd[i]                = r * ft + ypd[i];
+  }
+
+  return (0);
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Construct M = I - gamma*J with J = diag(deltaf_i/deltay_i),
+ * protecting against deltay_i being at roundoff level, and invert it.
+ * On input M holds f evaluated at the perturbed y. Returns SUNFALSE
+ * if a diagonal entry of M is zero (that entry is left unchanged).
+ * -----------------------------------------------------------------
+ */
+
+sunbooleantype cvDiagSetup_buildM_fusedCPU(const sunrealtype fract,
+                                           const sunrealtype uround,
+                                           const sunrealtype h,
+                                           const N_Vector ftemp,
+                                           const N_Vector fpred,
+                                           const N_Vector ewt, N_Vector M)
+{
+  const sunindextype N   = N_VGetLength(M);
+  const sunrealtype* ftd = N_VGetArrayPointer(ftemp);
+  const sunrealtype* fpd = N_VGetArrayPointer(fpred);
+  const sunrealtype* wd  = N_VGetArrayPointer(ewt);
+  sunrealtype* md        = N_VGetArrayPointer(M);
+  sunbooleantype invOK   = SUNTRUE;
+  sunindextype i;
+
+  SUNDIALS_MAYBE_UNUSED const int nthreads = cvFusedNumThreads(M);
+
+#if defined(SUNDIALS_OPENMP_ENABLED)
+#pragma omp parallel for schedule(static) num_threads(nthreads) \
+  reduction(&& : invOK) if (nthreads > 1)
+#endif
+  for (i = 0; i < N; i++)
+  {
+    sunrealtype m = ONE;
+    if (SUNRabs(ftd[i] * wd[i]) >= uround)
+    {
+      m = (fract * ftd[i] - h * (md[i] - fpd[i])) / (fract * ftd[i]);
+    }
+    if (m == ZERO) { invOK = SUNFALSE; }
+    else { md[i] = ONE / m; }
+  }
+
+  return (invOK);
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Update the inverse of M = I - gamma*J for a changed gamma with
+ * r = gamma/gammasv. Returns SUNFALSE if the updated M is singular.
+ * -----------------------------------------------------------------
+ */
+
+sunbooleantype cvDiagSolve_updateM_fusedCPU(const sunrealtype r, N_Vector M)
+{
+  const sunindextype N = N_VGetLength(M);
+  sunrealtype* md      = N_VGetArrayPointer(M);
+  sunbooleantype invOK = SUNTRUE;
+  sunindextype i;
+
+  SUNDIALS_MAYBE_UNUSED const int nthreads = cvFusedNumThreads(M);
+
+#if defined(SUNDIALS_OPENMP_ENABLED)
+#pragma omp parallel for schedule(static) num_threads(nthreads) \
+  reduction(&& : invOK) if (nthreads > 1)
+#endif
+  for (i = 0; i < N; i++)
+  {
+    const sunrealtype m = r * (ONE / md[i] - ONE) + ONE;
+    if (m == ZERO) { invOK = SUNFALSE; }
+    else { md[i] = ONE / m; }
+  }
+
+  return (invOK);
+}
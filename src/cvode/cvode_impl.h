@@ -117,6 +117,26 @@ extern "C" {
 
 #define LONG_WAIT 10
 
+/* Initial step size constants
+ * ---------------------------
+ * HLB_FACTOR  factor for upper bound on initial step size
+ * HUB_FACTOR  factor for lower bound on initial step size
+ * H_BIAS      bias factor in selection of initial step size
+ * MAX_ITERS   maximum attempts to compute the initial step size
+ */
+
+#define HLB_FACTOR SUN_RCONST(100.0)
+#define HUB_FACTOR SUN_RCONST(0.1)
+#define H_BIAS     SUN_RCONST(0.5)
+#define MAX_ITERS  4
+
+/* Nonlinear solver constants
+ * --------------------------
+ * CORTES  constant in nonlinear iteration convergence test
+ */
+
+#define CORTES SUN_RCONST(0.1)
+
 /* Failure limits
  * --------------
  * MXNCF   max no. of convergence failures during one step try
@@ -466,6 +486,7 @@ typedef struct CVodeMemRec
   N_Vector cv_Xvecs[L_MAX];    /* array of vectors */
 
   sunbooleantype cv_usefused; /* flag indicating if CVODE specific fused kernels should be used */
+  sunbooleantype cv_usefusedcpu; /* flag indicating if the CPU fused kernels should be used */
 
   /*----------------
     Resizing History
@@ -641,6 +662,28 @@ void cvRestore(CVodeMem cv_mem, sunrealtype saved_t);
 
 void cvRescale(CVodeMem cv_mem);
 
+/* Method coefficients, history array adjustments on an order change,
+   and step size ratio and order selection computed from plain arrays
+   and scalars, so that they can be applied to a single system of the
+   ensemble integrator as well */
+
+void cvSetAdamsCoeffs(int q, int qwait, sunrealtype h, const sunrealtype tau[],
+                      sunrealtype l[], sunrealtype tq[]);
+void cvSetBDFCoeffs(int q, int qwait, sunrealtype h, const sunrealtype tau[],
+                    sunrealtype l[], sunrealtype tq[], sunrealtype p[]);
+void cvDecreaseAdamsCoeffs(int q, int qmax, sunrealtype hscale,
+                           const sunrealtype tau[], sunrealtype l[]);
+sunrealtype cvIncreaseBDFCoeffs(int q, int qmax, sunrealtype hscale,
+                                const sunrealtype tau[], sunrealtype l[]);
+void cvDecreaseBDFCoeffs(int q, int qmax, sunrealtype hscale,
+                         const sunrealtype tau[], sunrealtype l[]);
+sunrealtype cvLimitEta(sunrealtype eta, sunrealtype etamax,
+                       sunrealtype eta_max_fx, sunrealtype eta_min,
+                       sunrealtype h, sunrealtype hmin, sunrealtype hmax_inv);
+int cvChooseOrder(sunrealtype etaqm1, sunrealtype etaq, sunrealtype etaqp1,
+                  sunrealtype eta_min_fx, sunrealtype eta_max_fx,
+                  sunrealtype* eta);
+
 #ifdef SUNDIALS_BUILD_PACKAGE_FUSED_KERNELS
 int cvEwtSetSS_fused(const sunbooleantype atolmin0, const sunrealtype reltol,
                      const sunrealtype Sabstol, const N_Vector ycur,
@@ -670,6 +713,46 @@ int cvDiagSetup_buildM(const sunrealtype fract, const sunrealtype uround,
 int cvDiagSolve_updateM(const sunrealtype r, N_Vector M);
 #endif
 
+/* CPU fused kernels for serial, OpenMP, and Pthreads vectors */
+
+sunbooleantype cvFusedCPUCompatible(N_Vector v);
+
+int cvEwtSetSS_fusedCPU(const sunbooleantype atolmin0, const sunrealtype reltol,
+                        const sunrealtype Sabstol, const N_Vector ycur,
+                        N_Vector weight);
+
+int cvEwtSetSV_fusedCPU(const sunbooleantype atolmin0, const sunrealtype reltol,
+                        const N_Vector Vabstol, const N_Vector ycur,
+                        N_Vector weight);
+
+int cvCheckConstraints_fusedCPU(const N_Vector c, const N_Vector ewt,
+                                const N_Vector y, const N_Vector mm,
+                                N_Vector tmp, N_Vector save, sunrealtype* vnorm);
+
+int cvNlsResid_fusedCPU(const sunrealtype rl1, const sunrealtype ngamma,
+                        const N_Vector zn1, const N_Vector ycor,
+                        const N_Vector ftemp, N_Vector res);
+
+int cvCorrectY_fusedCPU(const N_Vector zn0, const N_Vector acor,
+                        const N_Vector ewt, N_Vector y, sunrealtype* acnrm);
+
+sunrealtype cvWrmsNormLinearSum_fusedCPU(const sunrealtype a, const N_Vector x,
+                                         const sunrealtype b, const N_Vector z,
+                                         const N_Vector w);
+
+int cvDiagSetup_formY_fusedCPU(const sunrealtype h, const sunrealtype r,
+                               const N_Vector fpred, const N_Vector zn1,
+                               const N_Vector ypred, N_Vector ftemp, N_Vector y);
+
+sunbooleantype cvDiagSetup_buildM_fusedCPU(const sunrealtype fract,
+                                           const sunrealtype uround,
+                                           const sunrealtype h,
+                                           const N_Vector ftemp,
+                                           const N_Vector fpred,
+                                           const N_Vector ewt, N_Vector M);
+
+sunbooleantype cvDiagSolve_updateM_fusedCPU(const sunrealtype r, N_Vector M);
+
 /*
  * =================================================================
  *    E R R O R    M E S S A G E S
@@ -1081,10 +1081,24 @@ int CVodeSetUseIntegratorFusedKernels(void* cvode_mem, sunbooleantype onoff)
 
   cv_mem = (CVodeMem)cvode_mem;
 
+  if (cv_mem->cv_MallocDone == SUNFALSE)
+  {
+    cvProcessError(cv_mem, CV_NO_MALLOC, __LINE__, __func__, __FILE__,
+                   MSGCV_NO_MALLOC);
+    return (CV_NO_MALLOC);
+  }
+
+  /* CPU fused kernels are used with serial, OpenMP, and Pthreads vectors */
+  if (cvFusedCPUCompatible(cv_mem->cv_ewt))
+  {
+    cv_mem->cv_usefused    = SUNFALSE;
+    cv_mem->cv_usefusedcpu = onoff;
+    return (CV_SUCCESS);
+  }
+
 #ifdef SUNDIALS_BUILD_PACKAGE_FUSED_KERNELS
   id = N_VGetVectorID(cv_mem->cv_ewt);
-  if (!cv_mem->cv_MallocDone ||
-      (id != SUNDIALS_NVEC_CUDA && id != SUNDIALS_NVEC_HIP))
+  if (id != SUNDIALS_NVEC_CUDA && id != SUNDIALS_NVEC_HIP)
   {
     cvProcessError(cv_mem, CV_ILL_INPUT, __LINE__, __func__, __FILE__,
                    "Fused Kernels not supported for the provided vector");
@@ -1093,10 +1107,10 @@ int CVodeSetUseIntegratorFusedKernels(void* cvode_mem, sunbooleantype onoff)
   cv_mem->cv_usefused = onoff;
   return (CV_SUCCESS);
 #else
-  /* silence warnings when fused kernels are disabled */
+  /* silence warnings when fused GPU kernels are disabled */
   ((void)onoff);
   cvProcessError(cv_mem, CV_ILL_INPUT, __LINE__, __func__, __FILE__,
-                 "CVODE was not built with fused integrator kernels enabled");
+                 "Fused Kernels not supported for the provided vector");
   return (CV_ILL_INPUT);
 #endif
 }
@@ -23,6 +23,7 @@
 #include <string.h>
 #include <sundials/sundials_math.h>
 #include <sunmatrix/sunmatrix_band.h>
+#include <sunmatrix/sunmatrix_blockdense.h>
 #include <sunmatrix/sunmatrix_dense.h>
 #include <sunmatrix/sunmatrix_sparse.h>
 
@@ -187,6 +188,7 @@ int CVodeSetLinearSolver(void* cvode_mem, SUNLinearSolver LS, SUNMatrix A)
   cvls_mem->jtsetup  = NULL;
   cvls_mem->jtimes   = cvLsDQJtimes;
   cvls_mem->jt_f     = cv_mem->cv_f;
+  cvls_mem->jt_dir   = NULL;
   cvls_mem->jt_data  = cv_mem;
 
   cvls_mem->user_linsys = SUNFALSE;
@@ -209,6 +211,13 @@ int CVodeSetLinearSolver(void* cvode_mem, SUNLinearSolver LS, SUNMatrix A)
   cvls_mem->eplifac    = CVLS_EPLIN;
   cvls_mem->last_flag  = CVLS_SUCCESS;
 
+  /* Disable reuse of J/P data after a reinitialization */
+  cvls_mem->jcached     = SUNFALSE;
+  cvls_mem->dtmax_reuse = ZERO;
+  cvls_mem->dgmax_reuse = ZERO;
+  cvls_mem->tnlj        = ZERO;
+  cvls_mem->gamlj       = ZERO;
+
   /* If LS supports ATimes, attach CVLs routine */
   if (LS->ops->setatimes)
   {
@@ -321,6 +330,64 @@ int CVodeSetJacFn(void* cvode_mem, CVLsJacFn jac)
   cvls_mem->linsys      = cvLsLinSys;
   cvls_mem->A_data      = cv_mem;
 
+  /* data from a previous Jacobian function can not be reused */
+  cvls_mem->jcached = SUNFALSE;
+
+  return (CVLS_SUCCESS);
+}
+
+/* CVodeSetJacSparsityPattern specifies the sparsity pattern of the
+ * Jacobian for the sparse difference quotient approximation. The column
+ * coloring is computed here and reused until a different pattern is
+ * supplied. A NULL input removes any stored pattern. */
+int CVodeSetJacSparsityPattern(void* cvode_mem, SUNMatrix S)
+{
+  CVodeMem cv_mem;
+  CVLsMem cvls_mem;
+  SUNErrCode err;
+  int retval;
+
+  /* access CVLsMem structure */
+  retval = cvLs_AccessLMem(cvode_mem, __func__, &cv_mem, &cvls_mem);
+  if (retval != CVLS_SUCCESS) { return (retval); }
+
+  /* remove the stored pattern */
+  if (S == NULL)
+  {
+    SUNSparseDQ_Destroy(&(cvls_mem->sdq));
+    return (CVLS_SUCCESS);
+  }
+
+  /* the pattern is only used with a sparse system matrix */
+  if ((cvls_mem->A == NULL) || (SUNMatGetID(cvls_mem->A) != SUNMATRIX_SPARSE) ||
+      (SUNMatGetID(S) != SUNMATRIX_SPARSE))
+  {
+    cvProcessError(cv_mem, CVLS_ILL_INPUT, __LINE__, __func__, __FILE__,
+                   "Sparsity pattern requires sparse SUNMatrix inputs");
+    return (CVLS_ILL_INPUT);
+  }
+
+  /* keep the existing coloring if the pattern is unchanged */
+  if (SUNSparseDQ_SamePattern(cvls_mem->sdq, S)) { return (CVLS_SUCCESS); }
+
+  SUNSparseDQ_Destroy(&(cvls_mem->sdq));
+
+  err = SUNSparseDQ_Create(S, &(cvls_mem->sdq));
+  if (err == SUN_ERR_MALLOC_FAIL)
+  {
+    cvProcessError(cv_mem, CVLS_MEM_FAIL, __LINE__, __func__, __FILE__,
+                   MSG_LS_MEM_FAIL);
+    return (CVLS_MEM_FAIL);
+  }
+  if (!err) { err = SUNSparseDQ_CheckMatrix(cvls_mem->sdq, cvls_mem->A); }
+  if (err)
+  {
+    SUNSparseDQ_Destroy(&(cvls_mem->sdq));
+    cvProcessError(cv_mem, CVLS_ILL_INPUT, __LINE__, __func__, __FILE__,
+                   "Sparsity pattern is incompatible with the system matrix");
+    return (CVLS_ILL_INPUT);
+  }
+
   return (CVLS_SUCCESS);
 }
 
@@ -344,6 +411,30 @@ int CVodeSetDeltaGammaMaxBadJac(void* cvode_mem, sunrealtype dgmax_jbad)
   return (CVLS_SUCCESS);
 }
 
+/* CVodeSetJacReuseOnReInit allows the Jacobian or preconditioner data
+ * from before a call to CVodeReInit to be reused in the first step after
+ * it. The data is reused if the last update was at a time within dtmax of
+ * the new initial time and, if dgmax > 0, the ratio of the new gamma to
+ * the gamma at the last update satisfies |gamma/gamlj-1| <= dgmax. A
+ * value dtmax <= 0 disables reuse (the default). */
+int CVodeSetJacReuseOnReInit(void* cvode_mem, sunrealtype dtmax,
+                             sunrealtype dgmax)
+{
+  CVodeMem cv_mem;
+  CVLsMem cvls_mem;
+  int retval;
+
+  /* Access CVLsMem structure */
+  retval = cvLs_AccessLMem(cvode_mem, __func__, &cv_mem, &cvls_mem);
+  if (retval != CVLS_SUCCESS) { return (retval); }
+
+  /* Set values, non-positive inputs disable the corresponding test */
+  cvls_mem->dtmax_reuse = (dtmax <= ZERO) ? ZERO : dtmax;
+  cvls_mem->dgmax_reuse = (dgmax <= ZERO) ? ZERO : dgmax;
+
+  return (CVLS_SUCCESS);
+}
+
 /* CVodeSetEpsLin specifies the nonlinear -> linear tolerance scale factor */
 int CVodeSetEpsLin(void* cvode_mem, sunrealtype eplifac)
 {
@@ -468,6 +559,9 @@ int CVodeSetPreconditioner(void* cvode_mem, CVLsPrecSetupFn psetup,
   cvls_mem->pset   = psetup;
   cvls_mem->psolve = psolve;
 
+  /* data from a previous preconditioner can not be reused */
+  cvls_mem->jcached = SUNFALSE;
+
   /* issue error if LS object does not allow user-supplied preconditioning */
   if (cvls_mem->LS->ops->setpreconditioner == NULL)
   {
@@ -530,6 +624,52 @@ int CVodeSetJacTimes(void* cvode_mem, CVLsJacTimesSetupFn jtsetup,
     cvls_mem->jt_f     = cv_mem->cv_f;
     cvls_mem->jt_data  = cv_mem;
   }
+  cvls_mem->jt_dir = NULL;
+
+  return (CVLS_SUCCESS);
+}
+
+/* CVodeSetJacTimesDirDeriv specifies a user-supplied function computing the
+   exact directional derivative of the ODE right-hand side, e.g., by forward
+   mode automatic differentiation or dual numbers, to use in place of the
+   internal finite difference Jacobian-vector product */
+int CVodeSetJacTimesDirDeriv(void* cvode_mem, CVLsJacTimesDirDerivFn jtdir)
+{
+  CVodeMem cv_mem;
+  CVLsMem cvls_mem;
+  int retval;
+
+  /* access CVLsMem structure */
+  retval = cvLs_AccessLMem(cvode_mem, __func__, &cv_mem, &cvls_mem);
+  if (retval != CVLS_SUCCESS) { return (retval); }
+
+  /* issue error if LS object does not allow user-supplied ATimes */
+  if (cvls_mem->LS->ops->setatimes == NULL)
+  {
+    cvProcessError(cv_mem, CVLS_ILL_INPUT, __LINE__, __func__,
+                   __FILE__, "SUNLinearSolver object does not support user-supplied ATimes routine");
+    return (CVLS_ILL_INPUT);
+  }
+
+  /* store the directional derivative function, called by the internal jtimes
+     routine (NULL jtdir implies use of DQ default) */
+  if (jtdir != NULL)
+  {
+    cvls_mem->jtimesDQ = SUNFALSE;
+    cvls_mem->jtsetup  = NULL;
+    cvls_mem->jtimes   = cvLsDirDerivJtimes;
+    cvls_mem->jt_dir   = jtdir;
+    cvls_mem->jt_data  = cv_mem;
+  }
+  else
+  {
+    cvls_mem->jtimesDQ = SUNTRUE;
+    cvls_mem->jtsetup  = NULL;
+    cvls_mem->jtimes   = cvLsDQJtimes;
+    cvls_mem->jt_f     = cv_mem->cv_f;
+    cvls_mem->jt_dir   = NULL;
+    cvls_mem->jt_data  = cv_mem;
+  }
 
   return (CVLS_SUCCESS);
 }
@@ -595,6 +735,9 @@ int CVodeSetLinSysFn(void* cvode_mem, CVLsLinSysFn linsys)
     cvls_mem->A_data      = cv_mem;
   }
 
+  /* data from a previous linear system function can not be reused */
+  cvls_mem->jcached = SUNFALSE;
+
   return (CVLS_SUCCESS);
 }
 
@@ -976,7 +1119,7 @@ int cvLsPSolve(void* cvode_mem, N_Vector r, N_Vector z, sunrealtype tol, int lr)
 /*-----------------------------------------------------------------
   cvLsDQJac
 
-  This routine is a wrapper for the Dense and Band
+  This routine is a wrapper for the Dense, Band, and Sparse
   implementations of the difference quotient Jacobian
   approximation routines.
   ---------------------------------------------------------------*/
@@ -1027,6 +1170,14 @@ int cvLsDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
   {
     retval = cvLsBandDQJac(t, y, fy, Jac, cv_mem, tmp1, tmp2);
   }
+  else if (SUNMatGetID(Jac) == SUNMATRIX_BLOCKDENSE)
+  {
+    retval = cvLsBlockDenseDQJac(t, y, fy, Jac, cv_mem, tmp1, tmp2);
+  }
+  else if (SUNMatGetID(Jac) == SUNMATRIX_SPARSE)
+  {
+    retval = cvLsSparseDQJac(t, y, fy, Jac, cv_mem, tmp1, tmp2);
+  }
   else
   {
     cvProcessError(cv_mem, CVLS_ILL_INPUT, __LINE__, __func__, __FILE__,
@@ -1256,6 +1407,279 @@ int cvLsBandDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
   return (retval);
 }
 
+/*-----------------------------------------------------------------
+  cvLsBlockDenseDQJac
+
+  This routine generates a block-diagonal dense difference quotient
+  approximation to the Jacobian of f(t,y). Since the blocks are
+  independent, column j of every block is perturbed at the same
+  time, so only one call to f is needed per block column. The
+  difference quotients are loaded with SM_ELEMENT_BD.
+  -----------------------------------------------------------------*/
+int cvLsBlockDenseDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
+                        CVodeMem cv_mem, N_Vector tmp1, N_Vector tmp2)
+{
+  N_Vector ftemp, ytemp;
+  sunrealtype fnorm, minInc, inc, inc_inv, srur, conj;
+  sunrealtype *ewt_data, *fy_data, *ftemp_data;
+  sunrealtype *y_data, *ytemp_data, *cns_data;
+  sunindextype i, j, k, jj, N, Nb, nblocks;
+  CVLsMem cvls_mem;
+  int retval = 0;
+
+  /* initialize cns_data to avoid compiler warning */
+  cns_data = NULL;
+
+  /* access LsMem interface structure */
+  cvls_mem = (CVLsMem)cv_mem->cv_lmem;
+
+  /* access matrix dimensions */
+  Nb      = SM_BLOCKCOLUMNS_BD(Jac);
+  nblocks = SM_NUMBLOCKS_BD(Jac);
+  N       = SM_COLUMNS_BD(Jac);
+
+  /* Rename work vectors for use as temporary values of y and f */
+  ftemp = tmp1;
+  ytemp = tmp2;
+
+  /* Obtain pointers to the data for ewt, fy, ftemp, y, ytemp */
+  ewt_data   = N_VGetArrayPointer(cv_mem->cv_ewt);
+  fy_data    = N_VGetArrayPointer(fy);
+  ftemp_data = N_VGetArrayPointer(ftemp);
+  y_data     = N_VGetArrayPointer(y);
+  ytemp_data = N_VGetArrayPointer(ytemp);
+  if (cv_mem->cv_constraints)
+  {
+    cns_data = N_VGetArrayPointer(cv_mem->cv_constraints);
+  }
+
+  /* Load ytemp with y = predicted y vector */
+  N_VScale(ONE, y, ytemp);
+
+  /* Set minimum increment based on uround and norm of f */
+  srur   = SUNRsqrt(cv_mem->cv_uround);
+  fnorm  = N_VWrmsNorm(fy, cv_mem->cv_ewt);
+  minInc = (fnorm != ZERO) ? (MIN_INC_MULT * SUNRabs(cv_mem->cv_h) *
+                              cv_mem->cv_uround * N * fnorm)
+                           : ONE;
+
+  /* Loop over block columns */
+  for (j = 0; j < Nb; j++)
+  {
+    /* Increment column j of every block */
+    for (k = 0; k < nblocks; k++)
+    {
+      jj  = k * Nb + j;
+      inc = SUNMAX(srur * SUNRabs(y_data[jj]), minInc / ewt_data[jj]);
+
+      /* Adjust sign(inc) if yj has an inequality constraint. */
+      if (cv_mem->cv_constraints)
+      {
+        conj = cns_data[jj];
+        if (SUNRabs(conj) == ONE)
+        {
+          if ((ytemp_data[jj] + inc) * conj < ZERO) { inc = -inc; }
+        }
+        else if (SUNRabs(conj) == TWO)
+        {
+          if ((ytemp_data[jj] + inc) * conj <= ZERO) { inc = -inc; }
+        }
+      }
+
+      ytemp_data[jj] += inc;
+    }
+
+    /* Evaluate f with incremented y */
+    retval = cv_mem->cv_f(t, ytemp, ftemp, cv_mem->cv_user_data);
+    cvls_mem->nfeDQ++;
+    if (retval != 0) { break; }
+
+    /* Restore ytemp, then form and load difference quotients */
+    for (k = 0; k < nblocks; k++)
+    {
+      jj             = k * Nb + j;
+      ytemp_data[jj] = y_data[jj];
+      inc = SUNMAX(srur * SUNRabs(y_data[jj]), minInc / ewt_data[jj]);
+
+      /* Adjust sign(inc) as before. */
+      if (cv_mem->cv_constraints)
+      {
+        conj = cns_data[jj];
+        if (SUNRabs(conj) == ONE)
+        {
+          if ((ytemp_data[jj] + inc) * conj < ZERO) { inc = -inc; }
+        }
+        else if (SUNRabs(conj) == TWO)
+        {
+          if ((ytemp_data[jj] + inc) * conj <= ZERO) { inc = -inc; }
+        }
+      }
+
+      inc_inv = ONE / inc;
+      for (i = 0; i < Nb; i++)
+      {
+        SM_ELEMENT_BD(Jac, k, i, j) = inc_inv * (ftemp_data[k * Nb + i] -
+                                                 fy_data[k * Nb + i]);
+      }
+    }
+  }
+
+  return (retval);
+}
+
+/*-----------------------------------------------------------------
+  cvLsSparseDQJac
+
+  This routine generates a sparse difference quotient approximation
+  to the Jacobian of f(t,y) using the sparsity pattern and column
+  coloring supplied to CVodeSetJacSparsityPattern. All columns of
+  one color are structurally orthogonal, so they are perturbed
+  together and need a single call to f. The stored pattern is loaded
+  into the CSC or CSR matrix Jac before the difference quotients are
+  scattered into it.
+  -----------------------------------------------------------------*/
+int cvLsSparseDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
+                    CVodeMem cv_mem, N_Vector tmp1, N_Vector tmp2)
+{
+  N_Vector ftemp, ytemp;
+  sunrealtype fnorm, minInc, inc, srur, conj;
+  sunrealtype *ewt_data, *fy_data, *ftemp_data;
+  sunrealtype *y_data, *ytemp_data, *cns_data;
+  sunindextype color, j, k, N;
+  CVLsMem cvls_mem;
+  SUNSparseDQ sdq;
+  int retval = 0;
+
+  /* initialize cns_data to avoid compiler warning */
+  cns_data = NULL;
+
+  /* access LsMem interface structure */
+  cvls_mem = (CVLsMem)cv_mem->cv_lmem;
+  sdq      = cvls_mem->sdq;
+
+  if (sdq == NULL)
+  {
+    cvProcessError(cv_mem, CVLS_ILL_INPUT, __LINE__, __func__, __FILE__,
+                   MSG_LS_NO_PATTERN);
+    return (CVLS_ILL_INPUT);
+  }
+
+  /* load the sparsity pattern into Jac, growing its storage if needed */
+  if (SUNSparseMatrix_NNZ(Jac) < sdq->NNZ)
+  {
+    if (SUNSparseMatrix_Reallocate(Jac, sdq->NNZ))
+    {
+      cvProcessError(cv_mem, CVLS_SUNMAT_FAIL, __LINE__, __func__, __FILE__,
+                     MSG_LS_SUNMAT_FAILED);
+      return (CVLS_SUNMAT_FAIL);
+    }
+  }
+  if (SUNSparseDQ_LoadPattern(sdq, Jac))
+  {
+    cvProcessError(cv_mem, CVLS_SUNMAT_FAIL, __LINE__, __func__, __FILE__,
+                   MSG_LS_SUNMAT_FAILED);
+    return (CVLS_SUNMAT_FAIL);
+  }
+
+  /* access matrix dimension */
+  N = SUNSparseMatrix_Columns(Jac);
+
+  /* Rename work vectors for use as temporary values of y and f */
+  ftemp = tmp1;
+  ytemp = tmp2;
+
+  /* Obtain pointers to the data for ewt, fy, ftemp, y, ytemp */
+  ewt_data   = N_VGetArrayPointer(cv_mem->cv_ewt);
+  fy_data    = N_VGetArrayPointer(fy);
+  ftemp_data = N_VGetArrayPointer(ftemp);
+  y_data     = N_VGetArrayPointer(y);
+  ytemp_data = N_VGetArrayPointer(ytemp);
+  if (cv_mem->cv_constraints)
+  {
+    cns_data = N_VGetArrayPointer(cv_mem->cv_constraints);
+  }
+
+  /* Load ytemp with y = predicted y vector */
+  N_VScale(ONE, y, ytemp);
+
+  /* Set minimum increment based on uround and norm of f */
+  srur   = SUNRsqrt(cv_mem->cv_uround);
+  fnorm  = N_VWrmsNorm(fy, cv_mem->cv_ewt);
+  minInc = (fnorm != ZERO) ? (MIN_INC_MULT * SUNRabs(cv_mem->cv_h) *
+                              cv_mem->cv_uround * N * fnorm)
+                           : ONE;
+
+  /* Loop over column colors */
+  for (color = 0; color < sdq->ncolors; color++)
+  {
+    /* Increment all y_j with this color */
+    for (k = sdq->colorptrs[color]; k < sdq->colorptrs[color + 1]; k++)
+    {
+      j   = sdq->colorcols[k];
+      inc = SUNMAX(srur * SUNRabs(y_data[j]), minInc / ewt_data[j]);
+
+      /* Adjust sign(inc) if yj has an inequality constraint. */
+      if (cv_mem->cv_constraints)
+      {
+        conj = cns_data[j];
+        if (SUNRabs(conj) == ONE)
+        {
+          if ((ytemp_data[j] + inc) * conj < ZERO) { inc = -inc; }
+        }
+        else if (SUNRabs(conj) == TWO)
+        {
+          if ((ytemp_data[j] + inc) * conj <= ZERO) { inc = -inc; }
+        }
+      }
+
+      ytemp_data[j] += inc;
+    }
+
+    /* Evaluate f with incremented y */
+    retval = cv_mem->cv_f(t, ytemp, ftemp, cv_mem->cv_user_data);
+    cvls_mem->nfeDQ++;
+    if (retval != 0) { break; }
+
+    /* Restore ytemp, then form and load difference quotients */
+    for (k = sdq->colorptrs[color]; k < sdq->colorptrs[color + 1]; k++)
+    {
+      j             = sdq->colorcols[k];
+      inc           = ytemp_data[j] - y_data[j];
+      ytemp_data[j] = y_data[j];
+      SUNSparseDQ_ScatterColumn(sdq, Jac, j, ONE / inc, ftemp_data, fy_data);
+    }
+  }
+
+  return (retval);
+}
+
+/*-----------------------------------------------------------------
+  cvLsDirDerivJtimes
+
+  This routine computes the Jacobian times vector f_y(t,y) * v
+  exactly by calling the user-supplied directional derivative of
+  the right-hand side function.
+  -----------------------------------------------------------------*/
+int cvLsDirDerivJtimes(N_Vector v, N_Vector Jv, sunrealtype t, N_Vector y,
+                       SUNDIALS_MAYBE_UNUSED N_Vector fy, void* cvode_mem,
+                       SUNDIALS_MAYBE_UNUSED N_Vector work)
+{
+  CVodeMem cv_mem;
+  CVLsMem cvls_mem;
+  int retval;
+
+  /* access CVLsMem structure */
+  retval = cvLs_AccessLMem(cvode_mem, __func__, &cv_mem, &cvls_mem);
+  if (retval != CVLS_SUCCESS) { return (retval); }
+
+  /* Set Jv = f_y(t,y) v */
+  retval = cvls_mem->jt_dir(t, y, v, Jv, cv_mem->cv_user_data);
+  if (retval < 0) { return (-1); }
+  if (retval > 0) { return (+1); }
+
+  return (0);
+}
+
 /*-----------------------------------------------------------------
   cvLsDQJtimes
 
@@ -1434,14 +1858,27 @@ int cvLsInitialize(CVodeMem cv_mem)
       /* Check if an internal or user-supplied Jacobian function is used */
       if (cvls_mem->jacDQ)
       {
-        /* Internal difference quotient Jacobian. Check that A is dense or band,
-           otherwise return an error */
+        /* Internal difference quotient Jacobian. Check that A is dense, band,
+           or sparse with a sparsity pattern, otherwise return an error */
         retval = 0;
         if (cvls_mem->A->ops->getid)
         {
           if ((SUNMatGetID(cvls_mem->A) == SUNMATRIX_DENSE) ||
-              (SUNMatGetID(cvls_mem->A) == SUNMATRIX_BAND))
+              (SUNMatGetID(cvls_mem->A) == SUNMATRIX_BAND) ||
+              (SUNMatGetID(cvls_mem->A) == SUNMATRIX_BLOCKDENSE))
+          {
+            cvls_mem->jac    = cvLsDQJac;
+            cvls_mem->J_data = cv_mem;
+          }
+          else if (SUNMatGetID(cvls_mem->A) == SUNMATRIX_SPARSE)
           {
+            if (cvls_mem->sdq == NULL)
+            {
+              cvProcessError(cv_mem, CVLS_ILL_INPUT, __LINE__, __func__,
+                             __FILE__, MSG_LS_NO_PATTERN);
+              cvls_mem->last_flag = CVLS_ILL_INPUT;
+              return (CVLS_ILL_INPUT);
+            }
             cvls_mem->jac    = cvLsDQJac;
             cvls_mem->J_data = cv_mem;
           }
@@ -1499,6 +1936,12 @@ int cvLsInitialize(CVodeMem cv_mem)
     cvls_mem->jtimes  = cvLsDQJtimes;
     cvls_mem->jt_data = cv_mem;
   }
+  else if (cvls_mem->jt_dir)
+  {
+    cvls_mem->jtsetup = NULL;
+    cvls_mem->jtimes  = cvLsDirDerivJtimes;
+    cvls_mem->jt_data = cv_mem;
+  }
   else { cvls_mem->jt_data = cv_mem->cv_user_data; }
 
   /* if A is NULL and psetup is not present, then cvLsSetup does
@@ -1581,9 +2024,13 @@ int cvLsSetup(CVodeMem cv_mem, int convfail, N_Vector ypred, N_Vector fpred,
   cvls_mem->ycur = ypred;
   cvls_mem->fcur = fpred;
 
-  /* Use nst, gamma/gammap, and convfail to set J/P eval. flag jok */
+  /* Use nst, gamma/gammap, and convfail to set J/P eval. flag jok. In the
+     first step J/P is only current if data from before a reinitialization
+     can be reused. */
   dgamma         = SUNRabs((cv_mem->cv_gamma / cv_mem->cv_gammap) - ONE);
-  cvls_mem->jbad = (cv_mem->cv_nst == 0) || (cv_mem->first_step_after_resize) ||
+  cvls_mem->jbad = ((cv_mem->cv_nst == 0) &&
+                    !cvLsCanReuse(cv_mem, cvls_mem)) ||
+                   (cv_mem->first_step_after_resize) ||
                    (cv_mem->cv_nst >= cvls_mem->nstlj + cvls_mem->msbj) ||
                    ((convfail == CV_FAIL_BAD_J) &&
                     (dgamma < cvls_mem->dgmax_jbad)) ||
@@ -1601,8 +2048,10 @@ int cvLsSetup(CVodeMem cv_mem, int convfail, N_Vector ypred, N_Vector fpred,
     if (*jcurPtr)
     {
       cvls_mem->nje++;
-      cvls_mem->nstlj = cv_mem->cv_nst;
-      cvls_mem->tnlj  = cv_mem->cv_tn;
+      cvls_mem->nstlj   = cv_mem->cv_nst;
+      cvls_mem->tnlj    = cv_mem->cv_tn;
+      cvls_mem->gamlj   = cv_mem->cv_gamma;
+      cvls_mem->jcached = (retval == CVLS_SUCCESS);
     }
 
     /* Check linsys() return value and return if necessary */
@@ -1643,8 +2092,10 @@ int cvLsSetup(CVodeMem cv_mem, int convfail, N_Vector ypred, N_Vector fpred,
     if (*jcurPtr)
     {
       cvls_mem->npe++;
-      cvls_mem->nstlj = cv_mem->cv_nst;
-      cvls_mem->tnlj  = cv_mem->cv_tn;
+      cvls_mem->nstlj   = cv_mem->cv_nst;
+      cvls_mem->tnlj    = cv_mem->cv_tn;
+      cvls_mem->gamlj   = cv_mem->cv_gamma;
+      cvls_mem->jcached = (cvls_mem->last_flag == SUN_SUCCESS);
     }
 
     /* Update jcur flag if we suggested an update */
@@ -1654,6 +2105,35 @@ int cvLsSetup(CVodeMem cv_mem, int convfail, N_Vector ypred, N_Vector fpred,
   return (cvls_mem->last_flag);
 }
 
+/*-----------------------------------------------------------------
+  cvLsCanReuse
+
+  This routine determines if the Jacobian or preconditioner data
+  from before a reinitialization can be used in the first step,
+  based on the time and gamma value at the last J/P update.
+  -----------------------------------------------------------------*/
+sunbooleantype cvLsCanReuse(CVodeMem cv_mem, CVLsMem cvls_mem)
+{
+  if (!(cvls_mem->jcached) || (cvls_mem->dtmax_reuse <= ZERO))
+  {
+    return SUNFALSE;
+  }
+
+  if (SUNRabs(cv_mem->cv_tn - cvls_mem->tnlj) > cvls_mem->dtmax_reuse)
+  {
+    return SUNFALSE;
+  }
+
+  if ((cvls_mem->dgmax_reuse > ZERO) &&
+      (SUNRabs((cv_mem->cv_gamma / cvls_mem->gamlj) - ONE) >
+       cvls_mem->dgmax_reuse))
+  {
+    return SUNFALSE;
+  }
+
+  return SUNTRUE;
+}
+
 /*-----------------------------------------------------------------
   cvLsSolve
 
@@ -1666,8 +2146,10 @@ int cvLsSolve(CVodeMem cv_mem, N_Vector b, N_Vector weight, N_Vector ynow,
               N_Vector fnow)
 {
   CVLsMem cvls_mem;
-  sunrealtype bnorm = ZERO;
-  sunrealtype deltar, delta, w_mean;
+  sunrealtype bnorm  = ZERO;
+  sunrealtype w_mean = ONE;
+  sunrealtype deltar, delta, nrm[2];
+  N_Vector X[2], W[2];
   int curiter, nli_inc, retval;
 
   /* only used with logging */
@@ -1692,7 +2174,25 @@ int cvLsSolve(CVodeMem cv_mem, N_Vector b, N_Vector weight, N_Vector ynow,
   if (cvls_mem->iterative)
   {
     deltar = cvls_mem->eplifac * cv_mem->cv_tq[4];
-    bnorm  = N_VWrmsNorm(b, weight);
+
+    /* If the solver does not support scaling vectors, the mean weight is
+       needed to adjust the tolerance below. Compute it together with norm(b)
+       so that both require a single global reduction. */
+    if (cvls_mem->LS->ops->setscalingvectors)
+    {
+      bnorm = N_VWrmsNorm(b, weight);
+    }
+    else
+    {
+      N_VConst(ONE, cvls_mem->x);
+      X[0] = b;
+      W[0] = weight;
+      X[1] = weight;
+      W[1] = cvls_mem->x;
+      (void)N_VWrmsNormVectorArray(2, X, W, nrm);
+      bnorm  = nrm[0];
+      w_mean = nrm[1];
+    }
 
     SUNLogInfo(CV_LOGGER, "begin-linear-solve",
                "iterative = 1, b-norm = " SUN_FORMAT_G ", b-tol = " SUN_FORMAT_G
@@ -1754,12 +2254,7 @@ int cvLsSolve(CVodeMem cv_mem, N_Vector b, N_Vector weight, N_Vector ynow,
        <=> || b - A x ||_2 < tol / w_mean
      So we compute w_mean = ||w||_RMS = ||w||_2 and scale the desired tolerance accordingly. */
   }
-  else if (cvls_mem->iterative)
-  {
-    N_VConst(ONE, cvls_mem->x);
-    w_mean = N_VWrmsNorm(weight, cvls_mem->x);
-    delta /= w_mean;
-  }
+  else if (cvls_mem->iterative) { delta /= w_mean; }
 
   /* Set initial guess x = 0 to LS */
   N_VConst(ZERO, cvls_mem->x);
@@ -1905,6 +2400,9 @@ int cvLsFree(CVodeMem cv_mem)
     cvls_mem->savedJ = NULL;
   }
 
+  /* Free sparse DQ Jacobian coloring */
+  SUNSparseDQ_Destroy(&(cvls_mem->sdq));
+
   /* Nullify other N_Vector pointers */
   cvls_mem->ycur = NULL;
   cvls_mem->fcur = NULL;
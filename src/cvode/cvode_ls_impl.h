@@ -24,6 +24,7 @@
 #include <cvode/cvode_ls.h>
 
 #include "cvode_impl.h"
+#include "sundials_sparsedq_impl.h"
 
 #ifdef __cplusplus /* wrapper to enable C++ usage */
 extern "C" {
@@ -62,6 +63,14 @@ typedef struct CVLsMemRec
   sunbooleantype jbad;    /* heuristic suggestion for pset                */
   sunrealtype dgmax_jbad; /* if convfail = FAIL_BAD_J and the gamma ratio *
                         * |gamma/gammap-1| < dgmax_jbad then J is bad  */
+  SUNSparseDQ sdq;        /* sparsity pattern and column coloring for the *
+                        * sparse DQ Jacobian approximation             */
+
+  /* Reuse of the Jacobian or preconditioner data after a reinitialization */
+  sunbooleantype jcached; /* SUNTRUE if J/P data from a successful update *
+                        * is available for reuse                       */
+  sunrealtype dtmax_reuse; /* max |t0 - tnlj| for reuse (<= 0 disables)  */
+  sunrealtype dgmax_reuse; /* max |gamma/gamlj - 1| for reuse (<= 0 off)  */
 
   /* Matrix-based solver, scale solution to account for change in gamma */
   sunbooleantype scalesol;
@@ -92,6 +101,7 @@ typedef struct CVLsMemRec
   long int njtsetup; /* njtsetup = total number of calls to jtsetup  */
   long int njtimes;  /* njtimes = total number of calls to jtimes    */
   sunrealtype tnlj;  /* tnlj = t_n at last jac/pset call             */
+  sunrealtype gamlj; /* gamlj = gamma at last jac/pset call           */
 
   /* Preconditioner computation
    * (a) user-provided:
@@ -111,11 +121,16 @@ typedef struct CVLsMemRec
    *     - jtimesDQ == SUNFALSE
    * (b) internal jtimes
    *     - jt_data == cvode_mem
-   *     - jtimesDQ == SUNTRUE */
+   *     - jtimesDQ == SUNTRUE
+   * (c) internal jtimes calling a user-provided directional derivative:
+   *     - jt_data == cvode_mem
+   *     - jtimesDQ == SUNFALSE
+   *     - jt_dir != NULL */
   sunbooleantype jtimesDQ;
   CVLsJacTimesSetupFn jtsetup;
   CVLsJacTimesVecFn jtimes;
   CVRhsFn jt_f;
+  CVLsJacTimesDirDerivFn jt_dir;
   void* jt_data;
 
   /* Linear system setup function
@@ -143,6 +158,8 @@ int cvLsPSetup(void* cvode_mem);
 int cvLsPSolve(void* cvode_mem, N_Vector r, N_Vector z, sunrealtype tol, int lr);
 
 /* Difference quotient approximation for Jac times vector */
+int cvLsDirDerivJtimes(N_Vector v, N_Vector Jv, sunrealtype t, N_Vector y,
+                       N_Vector fy, void* cvode_mem, N_Vector work);
 int cvLsDQJtimes(N_Vector v, N_Vector Jv, sunrealtype t, N_Vector y,
                  N_Vector fy, void* data, N_Vector work);
 
@@ -153,6 +170,10 @@ int cvLsDenseDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
                    CVodeMem cv_mem, N_Vector tmp1);
 int cvLsBandDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
                   CVodeMem cv_mem, N_Vector tmp1, N_Vector tmp2);
+int cvLsBlockDenseDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
+                        CVodeMem cv_mem, N_Vector tmp1, N_Vector tmp2);
+int cvLsSparseDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
+                    CVodeMem cv_mem, N_Vector tmp1, N_Vector tmp2);
 
 /* Generic linit/lsetup/lsolve/lfree interface routines for CVode to call */
 int cvLsInitialize(CVodeMem cv_mem);
@@ -166,6 +187,7 @@ int cvLsFree(CVodeMem cv_mem);
 
 /* Auxiliary functions */
 int cvLsInitializeCounters(CVLsMem cvls_mem);
+sunbooleantype cvLsCanReuse(CVodeMem cv_mem, CVLsMem cvls_mem);
 int cvLs_AccessLMem(void* cvode_mem, const char* fname, CVodeMem* cv_mem,
                     CVLsMem* cvls_mem);
 
@@ -181,6 +203,9 @@ int cvLs_AccessLMem(void* cvode_mem, const char* fname, CVodeMem* cv_mem,
 #define MSG_LS_BAD_SIZES \
   "Illegal bandwidth parameter(s). Must have 0 <=  ml, mu <= N-1."
 #define MSG_LS_BAD_EPLIN "eplifac < 0 illegal."
+#define MSG_LS_NO_PATTERN                                                \
+  "A sparsity pattern is required for the difference quotient Jacobian " \
+  "approximation with a sparse SUNMatrix."
 
 #define MSG_LS_PSET_FAILED \
   "The preconditioner setup routine failed in an unrecoverable manner."
@@ -382,6 +382,13 @@ static int cvNlsResidual(N_Vector ycor, N_Vector res, void* cvode_mem)
   if (retval < 0) { return (CV_RHSFUNC_FAIL); }
   if (retval > 0) { return (RHSFUNC_RECVR); }
 
+  if (cv_mem->cv_usefusedcpu)
+  {
+    cvNlsResid_fusedCPU(cv_mem->cv_rl1, -cv_mem->cv_gamma, cv_mem->cv_zn[1],
+                        ycor, cv_mem->cv_ftemp, res);
+    return (CV_SUCCESS);
+  }
+
 #ifdef SUNDIALS_BUILD_PACKAGE_FUSED_KERNELS
   if (cv_mem->cv_usefused)
   {
@@ -929,6 +929,26 @@ SWIGEXPORT int _wrap_FCVodeGetDky(void *farg1, double const *farg2, int const *f
 }
 
 
+SWIGEXPORT int _wrap_FCVodeGetDkyBatch(void *farg1, int const *farg2, double *farg3, int const *farg4, void *farg5) {
+  int fresult ;
+  void *arg1 = (void *) 0 ;
+  int arg2 ;
+  sunrealtype *arg3 = (sunrealtype *) 0 ;
+  int arg4 ;
+  N_Vector *arg5 = (N_Vector *) 0 ;
+  int result;
+  
+  arg1 = (void *)(farg1);
+  arg2 = (int)(*farg2);
+  arg3 = (sunrealtype *)(farg3);
+  arg4 = (int)(*farg4);
+  arg5 = (N_Vector *)(farg5);
+  result = (int)CVodeGetDkyBatch(arg1,arg2,arg3,arg4,arg5);
+  fresult = (int)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FCVodeGetWorkSpace(void *farg1, long *farg2, long *farg3) {
   int fresult ;
   void *arg1 = (void *) 0 ;
@@ -1631,6 +1651,20 @@ SWIGEXPORT int _wrap_FCVodeSetJacFn(void *farg1, CVLsJacFn farg2) {
 }
 
 
+SWIGEXPORT int _wrap_FCVodeSetJacSparsityPattern(void *farg1, SUNMatrix farg2) {
+  int fresult ;
+  void *arg1 = (void *) 0 ;
+  SUNMatrix arg2 = (SUNMatrix) 0 ;
+  int result;
+  
+  arg1 = (void *)(farg1);
+  arg2 = (SUNMatrix)(farg2);
+  result = (int)CVodeSetJacSparsityPattern(arg1,arg2);
+  fresult = (int)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FCVodeSetJacEvalFrequency(void *farg1, long const *farg2) {
   int fresult ;
   void *arg1 = (void *) 0 ;
@@ -1673,6 +1707,22 @@ SWIGEXPORT int _wrap_FCVodeSetDeltaGammaMaxBadJac(void *farg1, double const *far
 }
 
 
+SWIGEXPORT int _wrap_FCVodeSetJacReuseOnReInit(void *farg1, double const *farg2, double const *farg3) {
+  int fresult ;
+  void *arg1 = (void *) 0 ;
+  sunrealtype arg2 ;
+  sunrealtype arg3 ;
+  int result;
+  
+  arg1 = (void *)(farg1);
+  arg2 = (sunrealtype)(*farg2);
+  arg3 = (sunrealtype)(*farg3);
+  result = (int)CVodeSetJacReuseOnReInit(arg1,arg2,arg3);
+  fresult = (int)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FCVodeSetEpsLin(void *farg1, double const *farg2) {
   int fresult ;
   void *arg1 = (void *) 0 ;
@@ -1733,6 +1783,20 @@ SWIGEXPORT int _wrap_FCVodeSetJacTimes(void *farg1, CVLsJacTimesSetupFn farg2, C
 }
 
 
+SWIGEXPORT int _wrap_FCVodeSetJacTimesDirDeriv(void *farg1, CVLsJacTimesDirDerivFn farg2) {
+  int fresult ;
+  void *arg1 = (void *) 0 ;
+  CVLsJacTimesDirDerivFn arg2 = (CVLsJacTimesDirDerivFn) 0 ;
+  int result;
+  
+  arg1 = (void *)(farg1);
+  arg2 = (CVLsJacTimesDirDerivFn)(farg2);
+  result = (int)CVodeSetJacTimesDirDeriv(arg1,arg2);
+  fresult = (int)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FCVodeSetLinSysFn(void *farg1, CVLsLinSysFn farg2) {
   int fresult ;
   void *arg1 = (void *) 0 ;
@@ -113,6 +113,7 @@ module fcvode_mod
  public :: FCVode
  public :: FCVodeComputeState
  public :: FCVodeGetDky
+ public :: FCVodeGetDkyBatch
  public :: FCVodeGetWorkSpace
  public :: FCVodeGetNumSteps
  public :: FCVodeGetNumRhsEvals
@@ -181,13 +182,16 @@ module fcvode_mod
  integer(C_INT), parameter, public :: CVLS_SUNLS_FAIL = -9_C_INT
  public :: FCVodeSetLinearSolver
  public :: FCVodeSetJacFn
+ public :: FCVodeSetJacSparsityPattern
  public :: FCVodeSetJacEvalFrequency
  public :: FCVodeSetLinearSolutionScaling
  public :: FCVodeSetDeltaGammaMaxBadJac
+ public :: FCVodeSetJacReuseOnReInit
  public :: FCVodeSetEpsLin
  public :: FCVodeSetLSNormFactor
  public :: FCVodeSetPreconditioner
  public :: FCVodeSetJacTimes
+ public :: FCVodeSetJacTimesDirDeriv
  public :: FCVodeSetLinSysFn
  public :: FCVodeGetJac
  public :: FCVodeGetJacTime
@@ -653,6 +657,18 @@ type(C_PTR), value :: farg4
 integer(C_INT) :: fresult
 end function
 
+function swigc_FCVodeGetDkyBatch(farg1, farg2, farg3, farg4, farg5) &
+bind(C, name="_wrap_FCVodeGetDkyBatch") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+type(C_PTR), value :: farg3
+integer(C_INT), intent(in) :: farg4
+type(C_PTR), value :: farg5
+integer(C_INT) :: fresult
+end function
+
 function swigc_FCVodeGetWorkSpace(farg1, farg2, farg3) &
 bind(C, name="_wrap_FCVodeGetWorkSpace") &
 result(fresult)
@@ -1102,6 +1118,15 @@ type(C_FUNPTR), value :: farg2
 integer(C_INT) :: fresult
 end function
 
+function swigc_FCVodeSetJacSparsityPattern(farg1, farg2) &
+bind(C, name="_wrap_FCVodeSetJacSparsityPattern") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+type(C_PTR), value :: farg2
+integer(C_INT) :: fresult
+end function
+
 function swigc_FCVodeSetJacEvalFrequency(farg1, farg2) &
 bind(C, name="_wrap_FCVodeSetJacEvalFrequency") &
 result(fresult)
@@ -1129,6 +1154,16 @@ real(C_DOUBLE), intent(in) :: farg2
 integer(C_INT) :: fresult
 end function
 
+function swigc_FCVodeSetJacReuseOnReInit(farg1, farg2, farg3) &
+bind(C, name="_wrap_FCVodeSetJacReuseOnReInit") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+real(C_DOUBLE), intent(in) :: farg2
+real(C_DOUBLE), intent(in) :: farg3
+integer(C_INT) :: fresult
+end function
+
 function swigc_FCVodeSetEpsLin(farg1, farg2) &
 bind(C, name="_wrap_FCVodeSetEpsLin") &
 result(fresult)
@@ -1167,6 +1202,15 @@ type(C_FUNPTR), value :: farg3
 integer(C_INT) :: fresult
 end function
 
+function swigc_FCVodeSetJacTimesDirDeriv(farg1, farg2) &
+bind(C, name="_wrap_FCVodeSetJacTimesDirDeriv") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+type(C_FUNPTR), value :: farg2
+integer(C_INT) :: fresult
+end function
+
 function swigc_FCVodeSetLinSysFn(farg1, farg2) &
 bind(C, name="_wrap_FCVodeSetLinSysFn") &
 result(fresult)
@@ -2193,6 +2237,31 @@ fresult = swigc_FCVodeGetDky(farg1, farg2, farg3, farg4)
 swig_result = fresult
 end function
 
+function FCVodeGetDkyBatch(cvode_mem, nt, t, k, dky) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: cvode_mem
+integer(C_INT), intent(in) :: nt
+real(C_DOUBLE), dimension(*), target, intent(inout) :: t
+integer(C_INT), intent(in) :: k
+type(C_PTR) :: dky
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+type(C_PTR) :: farg3 
+integer(C_INT) :: farg4 
+type(C_PTR) :: farg5 
+
+farg1 = cvode_mem
+farg2 = nt
+farg3 = c_loc(t(1))
+farg4 = k
+farg5 = dky
+fresult = swigc_FCVodeGetDkyBatch(farg1, farg2, farg3, farg4, farg5)
+swig_result = fresult
+end function
+
 function FCVodeGetWorkSpace(cvode_mem, lenrw, leniw) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -3031,6 +3100,22 @@ fresult = swigc_FCVodeSetJacFn(farg1, farg2)
 swig_result = fresult
 end function
 
+function FCVodeSetJacSparsityPattern(cvode_mem, s) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: cvode_mem
+type(SUNMatrix), target, intent(inout) :: s
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+type(C_PTR) :: farg2 
+
+farg1 = cvode_mem
+farg2 = c_loc(s)
+fresult = swigc_FCVodeSetJacSparsityPattern(farg1, farg2)
+swig_result = fresult
+end function
+
 function FCVodeSetJacEvalFrequency(cvode_mem, msbj) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -3079,6 +3164,25 @@ fresult = swigc_FCVodeSetDeltaGammaMaxBadJac(farg1, farg2)
 swig_result = fresult
 end function
 
+function FCVodeSetJacReuseOnReInit(cvode_mem, dtmax, dgmax) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: cvode_mem
+real(C_DOUBLE), intent(in) :: dtmax
+real(C_DOUBLE), intent(in) :: dgmax
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+real(C_DOUBLE) :: farg2 
+real(C_DOUBLE) :: farg3 
+
+farg1 = cvode_mem
+farg2 = dtmax
+farg3 = dgmax
+fresult = swigc_FCVodeSetJacReuseOnReInit(farg1, farg2, farg3)
+swig_result = fresult
+end function
+
 function FCVodeSetEpsLin(cvode_mem, eplifac) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -3149,6 +3253,22 @@ fresult = swigc_FCVodeSetJacTimes(farg1, farg2, farg3)
 swig_result = fresult
 end function
 
+function FCVodeSetJacTimesDirDeriv(cvode_mem, jtdir) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: cvode_mem
+type(C_FUNPTR), intent(in), value :: jtdir
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+type(C_FUNPTR) :: farg2 
+
+farg1 = cvode_mem
+farg2 = jtdir
+fresult = swigc_FCVodeSetJacTimesDirDeriv(farg1, farg2)
+swig_result = fresult
+end function
+
 function FCVodeSetLinSysFn(cvode_mem, linsys) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -82,6 +82,15 @@ static int CVApolynomialGetY(CVodeMem cv_mem, sunrealtype t, N_Vector y,
                              N_Vector* yS);
 static int CVApolynomialStorePnt(CVodeMem cv_mem, CVdtpntMem d);
 
+static sunbooleantype CVAcompressMalloc(CVodeMem cv_mem);
+static void CVAcompressFree(CVodeMem cv_mem);
+static int CVAcompressStorePnt(CVodeMem cv_mem, long int i, N_Vector y,
+                               N_Vector yd, N_Vector* yS, N_Vector* ySd);
+static int CVAhermiteGetPnt(CVodeMem cv_mem, long int i, int NS, N_Vector* y,
+                            N_Vector* yd, N_Vector** yS, N_Vector** ySd);
+static int CVApolynomialGetPnt(CVodeMem cv_mem, long int i, int NS,
+                               N_Vector y, N_Vector* yS);
+
 /* Wrappers */
 
 static int CVArhs(sunrealtype t, N_Vector yB, N_Vector yBdot, void* cvode_mem);
@@ -255,6 +264,26 @@ int CVodeAdjInit(void* cvode_mem, long int steps, int interp)
   ca_mem->ca_IMstoreSensi  = SUNTRUE;
   ca_mem->ca_IMinterpSensi = SUNFALSE;
 
+  /* By default the interpolation data is not compressed */
+
+  ca_mem->ca_ctype    = SUNDATACOMPRESSION_NONE;
+  ca_mem->ca_ctol     = ZERO;
+  ca_mem->ca_cy       = NULL;
+  ca_mem->ca_cyd      = NULL;
+  ca_mem->ca_cyS      = NULL;
+  ca_mem->ca_cySd     = NULL;
+  ca_mem->ca_cw       = NULL;
+  ca_mem->ca_cwS      = NULL;
+  ca_mem->ca_cidx[0]  = -1;
+  ca_mem->ca_cidx[1]  = -1;
+  ca_mem->ca_cidxS[0] = -1;
+  ca_mem->ca_cidxS[1] = -1;
+  for (i = 0; i < 4; i++)
+  {
+    ca_mem->ca_cvec[i]  = NULL;
+    ca_mem->ca_cvecS[i] = NULL;
+  }
+
   /* ------------------------------------
    * Initialize list of backward problems
    * ------------------------------------ */
@@ -2718,6 +2747,19 @@ static sunbooleantype CVAhermiteMalloc(CVodeMem cv_mem)
       break;
     }
 
+    content->index = i;
+    content->y     = NULL;
+    content->yd    = NULL;
+    content->yS    = NULL;
+    content->ySd   = NULL;
+
+    /* With compressed storage the vectors are not needed */
+    if (ca_mem->ca_ctype != SUNDATACOMPRESSION_NONE)
+    {
+      dt_mem[i]->content = content;
+      continue;
+    }
+
     content->y = N_VClone(cv_mem->cv_tempv);
     if (content->y == NULL)
     {
@@ -2770,6 +2812,14 @@ static sunbooleantype CVAhermiteMalloc(CVodeMem cv_mem)
     dt_mem[i]->content = content;
   }
 
+  /* Allocate the compressed storage */
+
+  if (allocOK && ca_mem->ca_ctype != SUNDATACOMPRESSION_NONE)
+  {
+    ii      = ca_mem->ca_nsteps + 1;
+    allocOK = CVAcompressMalloc(cv_mem);
+  }
+
   /* If an error occurred, deallocate and return */
 
   if (!allocOK)
@@ -2781,6 +2831,8 @@ static sunbooleantype CVAhermiteMalloc(CVodeMem cv_mem)
       N_VDestroyVectorArray(ca_mem->ca_yStmp, cv_mem->cv_Ns);
     }
 
+    CVAcompressFree(cv_mem);
+
     for (i = 0; i < ii; i++)
     {
       content = (CVhermiteDataMem)(dt_mem[i]->content);
@@ -2821,6 +2873,8 @@ static void CVAhermiteFree(CVodeMem cv_mem)
     N_VDestroyVectorArray(ca_mem->ca_yStmp, cv_mem->cv_Ns);
   }
 
+  CVAcompressFree(cv_mem);
+
   dt_mem = ca_mem->dt_mem;
 
   for (i = 0; i <= ca_mem->ca_nsteps; i++)
@@ -2850,6 +2904,8 @@ static int CVAhermiteStorePnt(CVodeMem cv_mem, CVdtpntMem d)
 {
   CVadjMem ca_mem;
   CVhermiteDataMem content;
+  N_Vector y, yd;
+  N_Vector *yS, *ySd;
   int is, retval;
 
   ca_mem = cv_mem->cv_adj_mem;
@@ -2858,34 +2914,48 @@ static int CVAhermiteStorePnt(CVodeMem cv_mem, CVdtpntMem d)
 
   /* Load solution */
 
-  N_VScale(ONE, cv_mem->cv_zn[0], content->y);
-
-  if (ca_mem->ca_IMstoreSensi)
+  if (ca_mem->ca_ctype == SUNDATACOMPRESSION_NONE)
   {
-    for (is = 0; is < cv_mem->cv_Ns; is++) { cv_mem->cv_cvals[is] = ONE; }
+    y   = content->y;
+    yd  = content->yd;
+    yS  = content->yS;
+    ySd = content->ySd;
 
-    retval = N_VScaleVectorArray(cv_mem->cv_Ns, cv_mem->cv_cvals,
-                                 cv_mem->cv_znS[0], content->yS);
-    if (retval != CV_SUCCESS) { return (CV_VECTOROP_ERR); }
+    N_VScale(ONE, cv_mem->cv_zn[0], y);
+
+    if (ca_mem->ca_IMstoreSensi)
+    {
+      for (is = 0; is < cv_mem->cv_Ns; is++) { cv_mem->cv_cvals[is] = ONE; }
+
+      retval = N_VScaleVectorArray(cv_mem->cv_Ns, cv_mem->cv_cvals,
+                                   cv_mem->cv_znS[0], yS);
+      if (retval != CV_SUCCESS) { return (CV_VECTOROP_ERR); }
+    }
+  }
+  else
+  {
+    /* The data is compressed below, use workspace for the derivatives */
+    y   = cv_mem->cv_zn[0];
+    yd  = ca_mem->ca_cvec[1];
+    yS  = cv_mem->cv_znS[0];
+    ySd = ca_mem->ca_cvecS[1];
   }
 
   /* Load derivative */
 
   if (cv_mem->cv_nst == 0)
   {
-    /* retval = */ cv_mem->cv_f(cv_mem->cv_tn, content->y, content->yd,
-                                cv_mem->cv_user_data);
+    /* retval = */ cv_mem->cv_f(cv_mem->cv_tn, y, yd, cv_mem->cv_user_data);
 
     if (ca_mem->ca_IMstoreSensi)
     {
-      /* retval = */ cvSensRhsWrapper(cv_mem, cv_mem->cv_tn, content->y,
-                                      content->yd, content->yS, content->ySd,
+      /* retval = */ cvSensRhsWrapper(cv_mem, cv_mem->cv_tn, y, yd, yS, ySd,
                                       cv_mem->cv_tempv, cv_mem->cv_ftemp);
     }
   }
   else
   {
-    N_VScale(ONE / cv_mem->cv_h, cv_mem->cv_zn[1], content->yd);
+    N_VScale(ONE / cv_mem->cv_h, cv_mem->cv_zn[1], yd);
 
     if (ca_mem->ca_IMstoreSensi)
     {
@@ -2895,11 +2965,16 @@ static int CVAhermiteStorePnt(CVodeMem cv_mem, CVdtpntMem d)
       }
 
       retval = N_VScaleVectorArray(cv_mem->cv_Ns, cv_mem->cv_cvals,
-                                   cv_mem->cv_znS[1], content->ySd);
+                                   cv_mem->cv_znS[1], ySd);
       if (retval != CV_SUCCESS) { return (CV_VECTOROP_ERR); }
     }
   }
 
+  if (ca_mem->ca_ctype != SUNDATACOMPRESSION_NONE)
+  {
+    return (CVAcompressStorePnt(cv_mem, content->index, y, yd, yS, ySd));
+  }
+
   return (0);
 }
 
@@ -2917,7 +2992,6 @@ static int CVAhermiteGetY(CVodeMem cv_mem, sunrealtype t, N_Vector y, N_Vector*
 {
   CVadjMem ca_mem;
   CVdtpntMem* dt_mem;
-  CVhermiteDataMem content0, content1;
 
   sunrealtype t0, t1, delta;
   sunrealtype factor1, factor2, factor3;
@@ -2952,14 +3026,16 @@ static int CVAhermiteGetY(CVodeMem cv_mem, sunrealtype t, N_Vector y, N_Vector*
 
   if (index == 0)
   {
-    content0 = (CVhermiteDataMem)(dt_mem[0]->content);
-    N_VScale(ONE, content0->y, y);
+    flag = CVAhermiteGetPnt(cv_mem, 0, NS, &y0, &yd0, &yS0, &ySd0);
+    if (flag != CV_SUCCESS) { return (flag); }
+
+    N_VScale(ONE, y0, y);
 
     if (NS > 0)
     {
       for (is = 0; is < NS; is++) { cv_mem->cv_cvals[is] = ONE; }
 
-      retval = N_VScaleVectorArray(NS, cv_mem->cv_cvals, content0->yS, yS);
+      retval = N_VScaleVectorArray(NS, cv_mem->cv_cvals, yS0, yS);
       if (retval != CV_SUCCESS) { return (CV_VECTOROP_ERR); }
     }
 
@@ -2972,23 +3048,15 @@ static int CVAhermiteGetY(CVodeMem cv_mem, sunrealtype t, N_Vector y, N_Vector*
   t1    = dt_mem[index]->t;
   delta = t1 - t0;
 
-  content0 = (CVhermiteDataMem)(dt_mem[index - 1]->content);
-  y0       = content0->y;
-  yd0      = content0->yd;
-  if (ca_mem->ca_IMinterpSensi)
-  {
-    yS0  = content0->yS;
-    ySd0 = content0->ySd;
-  }
+  flag = CVAhermiteGetPnt(cv_mem, index - 1, NS, &y0, &yd0, &yS0, &ySd0);
+  if (flag != CV_SUCCESS) { return (flag); }
 
   if (newpoint)
   {
     /* Recompute Y0 and Y1 */
 
-    content1 = (CVhermiteDataMem)(dt_mem[index]->content);
-
-    y1  = content1->y;
-    yd1 = content1->yd;
+    flag = CVAhermiteGetPnt(cv_mem, index, NS, &y1, &yd1, &yS1, &ySd1);
+    if (flag != CV_SUCCESS) { return (flag); }
 
     /* Y1 = delta (yd1 + yd0) - 2 (y1 - y0) */
     cvals[0] = -TWO;
@@ -3018,9 +3086,6 @@ static int CVAhermiteGetY(CVodeMem cv_mem, sunrealtype t, N_Vector y, N_Vector*
 
     if (NS > 0)
     {
-      yS1  = content1->yS;
-      ySd1 = content1->ySd;
-
       /* YS1 = delta (ySd1 + ySd0) - 2 (yS1 - yS0) */
       cvals[0]  = -TWO;
       XXvecs[0] = yS1;
@@ -3144,6 +3209,17 @@ static sunbooleantype CVApolynomialMalloc(CVodeMem cv_mem)
       break;
     }
 
+    content->index = i;
+    content->y     = NULL;
+    content->yS    = NULL;
+
+    /* With compressed storage the vectors are not needed */
+    if (ca_mem->ca_ctype != SUNDATACOMPRESSION_NONE)
+    {
+      dt_mem[i]->content = content;
+      continue;
+    }
+
     content->y = N_VClone(cv_mem->cv_tempv);
     if (content->y == NULL)
     {
@@ -3171,6 +3247,14 @@ static sunbooleantype CVApolynomialMalloc(CVodeMem cv_mem)
     dt_mem[i]->content = content;
   }
 
+  /* Allocate the compressed storage */
+
+  if (allocOK && ca_mem->ca_ctype != SUNDATACOMPRESSION_NONE)
+  {
+    ii      = ca_mem->ca_nsteps + 1;
+    allocOK = CVAcompressMalloc(cv_mem);
+  }
+
   /* If an error occurred, deallocate and return */
 
   if (!allocOK)
@@ -3182,6 +3266,8 @@ static sunbooleantype CVApolynomialMalloc(CVodeMem cv_mem)
       N_VDestroyVectorArray(ca_mem->ca_yStmp, cv_mem->cv_Ns);
     }
 
+    CVAcompressFree(cv_mem);
+
     for (i = 0; i < ii; i++)
     {
       content = (CVpolynomialDataMem)(dt_mem[i]->content);
@@ -3220,6 +3306,8 @@ static void CVApolynomialFree(CVodeMem cv_mem)
     N_VDestroyVectorArray(ca_mem->ca_yStmp, cv_mem->cv_Ns);
   }
 
+  CVAcompressFree(cv_mem);
+
   dt_mem = ca_mem->dt_mem;
 
   for (i = 0; i <= ca_mem->ca_nsteps; i++)
@@ -3253,6 +3341,14 @@ static int CVApolynomialStorePnt(CVodeMem cv_mem, CVdtpntMem d)
 
   content = (CVpolynomialDataMem)d->content;
 
+  content->order = cv_mem->cv_qu;
+
+  if (ca_mem->ca_ctype != SUNDATACOMPRESSION_NONE)
+  {
+    return (CVAcompressStorePnt(cv_mem, content->index, cv_mem->cv_zn[0],
+                                NULL, cv_mem->cv_znS[0], NULL));
+  }
+
   N_VScale(ONE, cv_mem->cv_zn[0], content->y);
 
   if (ca_mem->ca_IMstoreSensi)
@@ -3263,8 +3359,6 @@ static int CVApolynomialStorePnt(CVodeMem cv_mem, CVdtpntMem d)
     if (retval != CV_SUCCESS) { return (CV_VECTOROP_ERR); }
   }
 
-  content->order = cv_mem->cv_qu;
-
   return (0);
 }
 
@@ -3284,7 +3378,7 @@ static int CVApolynomialGetY(CVodeMem cv_mem, sunrealtype t, N_Vector y,
   CVdtpntMem* dt_mem;
   CVpolynomialDataMem content;
 
-  int flag, dir, order, i, j, is, NS, retval;
+  int flag, dir, order, i, j, NS, retval;
   long int index, base;
   sunbooleantype newpoint;
   sunrealtype dt, factor;
@@ -3304,20 +3398,7 @@ static int CVApolynomialGetY(CVodeMem cv_mem, sunrealtype t, N_Vector y,
   /* If we are beyond the left limit but close enough,
      then return y at the left limit. */
 
-  if (index == 0)
-  {
-    content = (CVpolynomialDataMem)(dt_mem[0]->content);
-    N_VScale(ONE, content->y, y);
-
-    if (NS > 0)
-    {
-      for (is = 0; is < NS; is++) { cv_mem->cv_cvals[is] = ONE; }
-      retval = N_VScaleVectorArray(NS, cv_mem->cv_cvals, content->yS, yS);
-      if (retval != CV_SUCCESS) { return (CV_VECTOROP_ERR); }
-    }
-
-    return (CV_SUCCESS);
-  }
+  if (index == 0) { return (CVApolynomialGetPnt(cv_mem, 0, NS, y, yS)); }
 
   /* Scaling factor */
 
@@ -3357,33 +3438,20 @@ static int CVApolynomialGetY(CVodeMem cv_mem, sunrealtype t, N_Vector y,
     {
       for (j = 0; j <= order; j++)
       {
+        flag = CVApolynomialGetPnt(cv_mem, base - j, NS, ca_mem->ca_Y[j],
+                                   ca_mem->ca_YS[j]);
+        if (flag != CV_SUCCESS) { return (flag); }
         ca_mem->ca_T[j] = dt_mem[base - j]->t;
-        content         = (CVpolynomialDataMem)(dt_mem[base - j]->content);
-        N_VScale(ONE, content->y, ca_mem->ca_Y[j]);
-
-        if (NS > 0)
-        {
-          for (is = 0; is < NS; is++) { cv_mem->cv_cvals[is] = ONE; }
-          retval = N_VScaleVectorArray(NS, cv_mem->cv_cvals, content->yS,
-                                       ca_mem->ca_YS[j]);
-          if (retval != CV_SUCCESS) { return (CV_VECTOROP_ERR); }
-        }
       }
     }
     else
     {
       for (j = 0; j <= order; j++)
       {
+        flag = CVApolynomialGetPnt(cv_mem, base - 1 + j, NS, ca_mem->ca_Y[j],
+                                   ca_mem->ca_YS[j]);
+        if (flag != CV_SUCCESS) { return (flag); }
         ca_mem->ca_T[j] = dt_mem[base - 1 + j]->t;
-        content         = (CVpolynomialDataMem)(dt_mem[base - 1 + j]->content);
-        N_VScale(ONE, content->y, ca_mem->ca_Y[j]);
-        if (NS > 0)
-        {
-          for (is = 0; is < NS; is++) { cv_mem->cv_cvals[is] = ONE; }
-          retval = N_VScaleVectorArray(NS, cv_mem->cv_cvals, content->yS,
-                                       ca_mem->ca_YS[j]);
-          if (retval != CV_SUCCESS) { return (CV_VECTOROP_ERR); }
-        }
       }
     }
 
@@ -3428,6 +3496,361 @@ static int CVApolynomialGetY(CVodeMem cv_mem, sunrealtype t, N_Vector y,
   return (CV_SUCCESS);
 }
 
+/*
+ * -----------------------------------------------------------------
+ * Functions for compressed storage of the interpolation data
+ * -----------------------------------------------------------------
+ */
+
+/*
+ * CVAcompressMalloc
+ *
+ * This routine allocates the compressed stores for the data points
+ * and the workspace used to encode and decode them.
+ */
+
+static sunbooleantype CVAcompressMalloc(CVodeMem cv_mem)
+{
+  CVadjMem ca_mem;
+  sunbooleantype hermite;
+  long int nslots;
+  int is, k;
+
+  ca_mem  = cv_mem->cv_adj_mem;
+  hermite = (ca_mem->ca_IMtype == CV_HERMITE);
+  nslots  = ca_mem->ca_nsteps + 1;
+
+  if (SUNCompressStore_Create(ca_mem->ca_ctype, nslots, cv_mem->cv_tempv,
+                              &ca_mem->ca_cy))
+  {
+    return (SUNFALSE);
+  }
+
+  ca_mem->ca_cw = N_VClone(cv_mem->cv_tempv);
+  if (ca_mem->ca_cw == NULL) { return (SUNFALSE); }
+
+  if (hermite)
+  {
+    if (SUNCompressStore_Create(ca_mem->ca_ctype, nslots, cv_mem->cv_tempv,
+                                &ca_mem->ca_cyd))
+    {
+      return (SUNFALSE);
+    }
+
+    for (k = 0; k < 4; k++)
+    {
+      ca_mem->ca_cvec[k] = N_VClone(cv_mem->cv_tempv);
+      if (ca_mem->ca_cvec[k] == NULL) { return (SUNFALSE); }
+    }
+  }
+
+  if (ca_mem->ca_IMstoreSensi)
+  {
+    ca_mem->ca_cyS = (SUNCompressStore*)calloc(cv_mem->cv_Ns,
+                                               sizeof(SUNCompressStore));
+    if (ca_mem->ca_cyS == NULL) { return (SUNFALSE); }
+
+    for (is = 0; is < cv_mem->cv_Ns; is++)
+    {
+      if (SUNCompressStore_Create(ca_mem->ca_ctype, nslots, cv_mem->cv_tempv,
+                                  &ca_mem->ca_cyS[is]))
+      {
+        return (SUNFALSE);
+      }
+    }
+
+    ca_mem->ca_cwS = N_VCloneVectorArray(cv_mem->cv_Ns, cv_mem->cv_tempv);
+    if (ca_mem->ca_cwS == NULL) { return (SUNFALSE); }
+
+    if (hermite)
+    {
+      ca_mem->ca_cySd = (SUNCompressStore*)calloc(cv_mem->cv_Ns,
+                                                  sizeof(SUNCompressStore));
+      if (ca_mem->ca_cySd == NULL) { return (SUNFALSE); }
+
+      for (is = 0; is < cv_mem->cv_Ns; is++)
+      {
+        if (SUNCompressStore_Create(ca_mem->ca_ctype, nslots,
+                                    cv_mem->cv_tempv, &ca_mem->ca_cySd[is]))
+        {
+          return (SUNFALSE);
+        }
+      }
+
+      for (k = 0; k < 4; k++)
+      {
+        ca_mem->ca_cvecS[k] = N_VCloneVectorArray(cv_mem->cv_Ns,
+                                                  cv_mem->cv_tempv);
+        if (ca_mem->ca_cvecS[k] == NULL) { return (SUNFALSE); }
+      }
+    }
+  }
+
+  ca_mem->ca_cidx[0]  = -1;
+  ca_mem->ca_cidx[1]  = -1;
+  ca_mem->ca_cidxS[0] = -1;
+  ca_mem->ca_cidxS[1] = -1;
+
+  return (SUNTRUE);
+}
+
+/*
+ * CVAcompressFree
+ *
+ * This routine frees the memory allocated by CVAcompressMalloc. It
+ * may be called on a partially allocated set of stores.
+ */
+
+static void CVAcompressFree(CVodeMem cv_mem)
+{
+  CVadjMem ca_mem;
+  int is, k;
+
+  ca_mem = cv_mem->cv_adj_mem;
+
+  SUNCompressStore_Destroy(&ca_mem->ca_cy);
+  SUNCompressStore_Destroy(&ca_mem->ca_cyd);
+
+  if (ca_mem->ca_cyS != NULL)
+  {
+    for (is = 0; is < cv_mem->cv_Ns; is++)
+    {
+      SUNCompressStore_Destroy(&ca_mem->ca_cyS[is]);
+    }
+    free(ca_mem->ca_cyS);
+    ca_mem->ca_cyS = NULL;
+  }
+
+  if (ca_mem->ca_cySd != NULL)
+  {
+    for (is = 0; is < cv_mem->cv_Ns; is++)
+    {
+      SUNCompressStore_Destroy(&ca_mem->ca_cySd[is]);
+    }
+    free(ca_mem->ca_cySd);
+    ca_mem->ca_cySd = NULL;
+  }
+
+  N_VDestroy(ca_mem->ca_cw);
+  ca_mem->ca_cw = NULL;
+
+  if (ca_mem->ca_cwS != NULL)
+  {
+    N_VDestroyVectorArray(ca_mem->ca_cwS, cv_mem->cv_Ns);
+    ca_mem->ca_cwS = NULL;
+  }
+
+  for (k = 0; k < 4; k++)
+  {
+    N_VDestroy(ca_mem->ca_cvec[k]);
+    ca_mem->ca_cvec[k] = NULL;
+
+    if (ca_mem->ca_cvecS[k] != NULL)
+    {
+      N_VDestroyVectorArray(ca_mem->ca_cvecS[k], cv_mem->cv_Ns);
+      ca_mem->ca_cvecS[k] = NULL;
+    }
+  }
+}
+
+/*
+ * CVAcompressStorePnt
+ *
+ * This routine encodes y (and yd, yS, ySd if not NULL) into the slot
+ * i of the compressed stores. The error bound ca_ctol is relative to
+ * the error weights of the forward problem at the data point; the
+ * bound on the derivatives is scaled by the step size so that their
+ * contribution to the Hermite interpolant is bounded in the same way.
+ * If the weights cannot be computed the data is stored losslessly.
+ */
+
+static int CVAcompressStorePnt(CVodeMem cv_mem, long int i, N_Vector y,
+                               N_Vector yd, N_Vector* yS, N_Vector* ySd)
+{
+  CVadjMem ca_mem;
+  sunrealtype tol, tolS, hd;
+  int is;
+
+  ca_mem = cv_mem->cv_adj_mem;
+
+  /* The slot is overwritten, invalidate the decoded copies */
+
+  for (is = 0; is < 2; is++)
+  {
+    if (ca_mem->ca_cidx[is] == i) { ca_mem->ca_cidx[is] = -1; }
+    if (ca_mem->ca_cidxS[is] == i) { ca_mem->ca_cidxS[is] = -1; }
+  }
+
+  /* The first data point is stored before the error weight function is set
+     up by CVode and is stored without loss */
+  tol = ca_mem->ca_ctol;
+  if (ca_mem->ca_firstCVodeFcall ||
+      cv_mem->cv_efun(y, ca_mem->ca_cw, cv_mem->cv_e_data) != 0)
+  {
+    tol = ZERO;
+  }
+
+  if (SUNCompressStore_Insert(ca_mem->ca_cy, i, y, ca_mem->ca_cw, tol))
+  {
+    return (CV_MEM_FAIL);
+  }
+
+  hd = SUNMAX(SUNRabs(cv_mem->cv_hu), SUNRabs(cv_mem->cv_h));
+
+  if (yd != NULL)
+  {
+    N_VScale(hd, ca_mem->ca_cw, ca_mem->ca_cw);
+    if (SUNCompressStore_Insert(ca_mem->ca_cyd, i, yd, ca_mem->ca_cw,
+                                (hd > ZERO) ? tol : ZERO))
+    {
+      return (CV_MEM_FAIL);
+    }
+  }
+
+  if (!ca_mem->ca_IMstoreSensi) { return (CV_SUCCESS); }
+
+  tolS = ca_mem->ca_ctol;
+  if (ca_mem->ca_firstCVodeFcall ||
+      cvSensEwtSet(cv_mem, yS, ca_mem->ca_cwS) != 0)
+  {
+    tolS = ZERO;
+  }
+
+  for (is = 0; is < cv_mem->cv_Ns; is++)
+  {
+    if (SUNCompressStore_Insert(ca_mem->ca_cyS[is], i, yS[is],
+                                ca_mem->ca_cwS[is], tolS))
+    {
+      return (CV_MEM_FAIL);
+    }
+
+    if (ySd != NULL)
+    {
+      N_VScale(hd, ca_mem->ca_cwS[is], ca_mem->ca_cwS[is]);
+      if (SUNCompressStore_Insert(ca_mem->ca_cySd[is], i, ySd[is],
+                                  ca_mem->ca_cwS[is],
+                                  (hd > ZERO) ? tolS : ZERO))
+      {
+        return (CV_MEM_FAIL);
+      }
+    }
+  }
+
+  return (CV_SUCCESS);
+}
+
+/*
+ * CVAhermiteGetPnt
+ *
+ * This routine returns the solution and derivative (and the first NS
+ * sensitivities and their derivatives) at the data point i. With
+ * compressed storage the data is decoded into one of two workspaces,
+ * selected by the parity of i so that two consecutive points can be
+ * held at once, and is only decoded again when i changes.
+ */
+
+static int CVAhermiteGetPnt(CVodeMem cv_mem, long int i, int NS, N_Vector* y,
+                            N_Vector* yd, N_Vector** yS, N_Vector** ySd)
+{
+  CVadjMem ca_mem;
+  CVhermiteDataMem content;
+  int is, k;
+
+  ca_mem = cv_mem->cv_adj_mem;
+
+  if (ca_mem->ca_ctype == SUNDATACOMPRESSION_NONE)
+  {
+    content = (CVhermiteDataMem)(ca_mem->dt_mem[i]->content);
+    *y      = content->y;
+    *yd     = content->yd;
+    *yS     = content->yS;
+    *ySd    = content->ySd;
+    return (CV_SUCCESS);
+  }
+
+  k    = (int)(i % 2);
+  *y   = ca_mem->ca_cvec[2 * k];
+  *yd  = ca_mem->ca_cvec[2 * k + 1];
+  *yS  = ca_mem->ca_cvecS[2 * k];
+  *ySd = ca_mem->ca_cvecS[2 * k + 1];
+
+  if (ca_mem->ca_cidx[k] != i)
+  {
+    if (SUNCompressStore_Load(ca_mem->ca_cy, i, *y) ||
+        SUNCompressStore_Load(ca_mem->ca_cyd, i, *yd))
+    {
+      ca_mem->ca_cidx[k] = -1;
+      return (CV_VECTOROP_ERR);
+    }
+    ca_mem->ca_cidx[k]  = i;
+    ca_mem->ca_cidxS[k] = -1;
+  }
+
+  if (NS > 0 && ca_mem->ca_cidxS[k] != i)
+  {
+    for (is = 0; is < cv_mem->cv_Ns; is++)
+    {
+      if (SUNCompressStore_Load(ca_mem->ca_cyS[is], i, (*yS)[is]) ||
+          SUNCompressStore_Load(ca_mem->ca_cySd[is], i, (*ySd)[is]))
+      {
+        ca_mem->ca_cidxS[k] = -1;
+        return (CV_VECTOROP_ERR);
+      }
+    }
+    ca_mem->ca_cidxS[k] = i;
+  }
+
+  return (CV_SUCCESS);
+}
+
+/*
+ * CVApolynomialGetPnt
+ *
+ * This routine copies the solution (and the first NS sensitivities)
+ * at the data point i into y (and yS), decoding it if the data is
+ * compressed.
+ */
+
+static int CVApolynomialGetPnt(CVodeMem cv_mem, long int i, int NS,
+                               N_Vector y, N_Vector* yS)
+{
+  CVadjMem ca_mem;
+  CVpolynomialDataMem content;
+  int is, retval;
+
+  ca_mem = cv_mem->cv_adj_mem;
+
+  if (ca_mem->ca_ctype != SUNDATACOMPRESSION_NONE)
+  {
+    if (SUNCompressStore_Load(ca_mem->ca_cy, i, y))
+    {
+      return (CV_VECTOROP_ERR);
+    }
+
+    for (is = 0; is < NS; is++)
+    {
+      if (SUNCompressStore_Load(ca_mem->ca_cyS[is], i, yS[is]))
+      {
+        return (CV_VECTOROP_ERR);
+      }
+    }
+
+    return (CV_SUCCESS);
+  }
+
+  content = (CVpolynomialDataMem)(ca_mem->dt_mem[i]->content);
+  N_VScale(ONE, content->y, y);
+
+  if (NS > 0)
+  {
+    for (is = 0; is < NS; is++) { cv_mem->cv_cvals[is] = ONE; }
+    retval = N_VScaleVectorArray(NS, cv_mem->cv_cvals, content->yS, yS);
+    if (retval != CV_SUCCESS) { return (CV_VECTOROP_ERR); }
+  }
+
+  return (CV_SUCCESS);
+}
+
 /*
  * =================================================================
  * WRAPPERS FOR ADJOINT SYSTEM
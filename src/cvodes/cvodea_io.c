@@ -41,7 +41,8 @@
  * =================================================================
  */
 
-#define ONE SUN_RCONST(1.0)
+#define ZERO SUN_RCONST(0.0)
+#define ONE  SUN_RCONST(1.0)
 
 /*
  * =================================================================
@@ -81,6 +82,69 @@ int CVodeSetAdjNoSensi(void* cvode_mem)
   return (CV_SUCCESS);
 }
 
+int CVodeSetAdjCompression(void* cvode_mem, SUNDataCompression ctype,
+                           sunrealtype tol)
+{
+  CVodeMem cv_mem;
+  CVadjMem ca_mem;
+
+  /* Check if cvode_mem exists */
+  if (cvode_mem == NULL)
+  {
+    cvProcessError(NULL, CV_MEM_NULL, __LINE__, __func__, __FILE__, MSGCV_NO_MEM);
+    return (CV_MEM_NULL);
+  }
+  cv_mem = (CVodeMem)cvode_mem;
+
+  /* Was ASA initialized? */
+  if (cv_mem->cv_adjMallocDone == SUNFALSE)
+  {
+    cvProcessError(cv_mem, CV_NO_ADJ, __LINE__, __func__, __FILE__, MSGCV_NO_ADJ);
+    return (CV_NO_ADJ);
+  }
+  ca_mem = cv_mem->cv_adj_mem;
+
+  if ((ctype != SUNDATACOMPRESSION_NONE) &&
+      (ctype != SUNDATACOMPRESSION_FLOAT) &&
+      (ctype != SUNDATACOMPRESSION_QUANTIZE) &&
+      (ctype != SUNDATACOMPRESSION_DELTA))
+  {
+    cvProcessError(cv_mem, CV_ILL_INPUT, __LINE__, __func__, __FILE__,
+                   MSGCV_BAD_CTYPE);
+    return (CV_ILL_INPUT);
+  }
+
+  if ((ctype == SUNDATACOMPRESSION_QUANTIZE ||
+       ctype == SUNDATACOMPRESSION_DELTA) &&
+      tol <= ZERO)
+  {
+    cvProcessError(cv_mem, CV_ILL_INPUT, __LINE__, __func__, __FILE__,
+                   MSGCV_BAD_CTOL);
+    return (CV_ILL_INPUT);
+  }
+
+  /* The data point storage is allocated in the first call to CVodeF */
+  if (ca_mem->ca_IMmallocDone)
+  {
+    cvProcessError(cv_mem, CV_ILL_INPUT, __LINE__, __func__, __FILE__,
+                   MSGCV_CMP_SET);
+    return (CV_ILL_INPUT);
+  }
+
+  if (ctype != SUNDATACOMPRESSION_NONE &&
+      !SUNCompress_VectorSupported(cv_mem->cv_tempv))
+  {
+    cvProcessError(cv_mem, CV_ILL_INPUT, __LINE__, __func__, __FILE__,
+                   MSGCV_CMP_NVECTOR);
+    return (CV_ILL_INPUT);
+  }
+
+  ca_mem->ca_ctype = ctype;
+  ca_mem->ca_ctol  = tol;
+
+  return (CV_SUCCESS);
+}
+
 /*
  * -----------------------------------------------------------------
  * Optional input functions for backward integration
@@ -707,6 +771,78 @@ int CVodeGetAdjCheckPointsInfo(void* cvode_mem, CVadjCheckPointRec* ckpnt)
   return (CV_SUCCESS);
 }
 
+/* Add the statistics of a compressed store (may be NULL) to the totals */
+static void CVAcompressStats(SUNCompressStore store, size_t* raw_bytes,
+                             size_t* stored_bytes, double* time)
+{
+  if (store == NULL) { return; }
+
+  *raw_bytes += store->raw_bytes;
+  *stored_bytes += store->stored_bytes;
+  *time += store->decode_time;
+}
+
+/*
+ * CVodeGetAdjCompressionStats
+ *
+ * This routine returns the ratio of the uncompressed to the compressed
+ * size of the stored interpolation data and the time spent decoding it.
+ */
+
+int CVodeGetAdjCompressionStats(void* cvode_mem, sunrealtype* ratio,
+                                sunrealtype* decode_time)
+{
+  CVodeMem cv_mem;
+  CVadjMem ca_mem;
+  size_t raw_bytes, stored_bytes;
+  double time;
+  int is;
+
+  /* Check if cvode_mem exists */
+  if (cvode_mem == NULL)
+  {
+    cvProcessError(NULL, CV_MEM_NULL, __LINE__, __func__, __FILE__, MSGCV_NO_MEM);
+    return (CV_MEM_NULL);
+  }
+  cv_mem = (CVodeMem)cvode_mem;
+
+  /* Was ASA initialized? */
+  if (cv_mem->cv_adjMallocDone == SUNFALSE)
+  {
+    cvProcessError(cv_mem, CV_NO_ADJ, __LINE__, __func__, __FILE__, MSGCV_NO_ADJ);
+    return (CV_NO_ADJ);
+  }
+  ca_mem = cv_mem->cv_adj_mem;
+
+  raw_bytes    = 0;
+  stored_bytes = 0;
+  time         = 0.0;
+
+  /* Sum over the stores of y, yd, yS, and ySd */
+  CVAcompressStats(ca_mem->ca_cy, &raw_bytes, &stored_bytes, &time);
+  CVAcompressStats(ca_mem->ca_cyd, &raw_bytes, &stored_bytes, &time);
+  for (is = 0; is < cv_mem->cv_Ns; is++)
+  {
+    if (ca_mem->ca_cyS != NULL)
+    {
+      CVAcompressStats(ca_mem->ca_cyS[is], &raw_bytes, &stored_bytes, &time);
+    }
+    if (ca_mem->ca_cySd != NULL)
+    {
+      CVAcompressStats(ca_mem->ca_cySd[is], &raw_bytes, &stored_bytes, &time);
+    }
+  }
+
+  if (ratio != NULL)
+  {
+    *ratio = (stored_bytes > 0) ? (sunrealtype)raw_bytes / stored_bytes : ONE;
+  }
+
+  if (decode_time != NULL) { *decode_time = (sunrealtype)time; }
+
+  return (CV_SUCCESS);
+}
+
 /*
  * -----------------------------------------------------------------
  * Undocumented Development User-Callable Functions
@@ -755,6 +891,17 @@ int CVodeGetAdjDataPointHermite(void* cvode_mem, int which, sunrealtype* t,
 
   *t = dt_mem[which]->t;
 
+  if (ca_mem->ca_ctype != SUNDATACOMPRESSION_NONE)
+  {
+    if ((y != NULL && SUNCompressStore_Load(ca_mem->ca_cy, which, y)) ||
+        (yd != NULL && SUNCompressStore_Load(ca_mem->ca_cyd, which, yd)))
+    {
+      return (CV_VECTOROP_ERR);
+    }
+
+    return (CV_SUCCESS);
+  }
+
   content = (CVhermiteDataMem)(dt_mem[which]->content);
 
   if (y != NULL) { N_VScale(ONE, content->y, y); }
@@ -808,7 +955,17 @@ int CVodeGetAdjDataPointPolynomial(void* cvode_mem, int which, sunrealtype* t,
 
   content = (CVpolynomialDataMem)(dt_mem[which]->content);
 
-  if (y != NULL) { N_VScale(ONE, content->y, y); }
+  if (y != NULL)
+  {
+    if (ca_mem->ca_ctype == SUNDATACOMPRESSION_NONE)
+    {
+      N_VScale(ONE, content->y, y);
+    }
+    else if (SUNCompressStore_Load(ca_mem->ca_cy, which, y))
+    {
+      return (CV_VECTOROP_ERR);
+    }
+  }
 
   *order = content->order;
 
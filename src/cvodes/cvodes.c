@@ -55,6 +55,7 @@
  *
  *   Interpolated output and extraction functions
  *      CVodeGetDky
+ *      CVodeGetDkyBatch
  *      CVodeGetQuad
  *      CVodeGetQuadDky
  *      CVodeGetSens
@@ -145,8 +146,9 @@
  *      cvCompleteStep
  *      cvPrepareNextStep
  *      cvSetEta
- *      cvComputeEtaqm1
- *      cvComputeEtaqp1
+ *      cvComputeEtaqm1qp1
+ *      cvAddNormVectors
+ *      cvMaxNorms
  *      cvChooseEta
  *
  *   Function to handle failures
@@ -203,6 +205,10 @@
 #include "cvodes_ls_impl.h"
 #include "sundials_utils.h"
 
+#if defined(SUNDIALS_OPENMP_ENABLED)
+#include <omp.h>
+#endif
+
 /*=================================================================*/
 /* CVODE Private Constants                                         */
 /*=================================================================*/
@@ -342,7 +348,6 @@ static int cvQuadEwtSet(CVodeMem cv_mem, N_Vector qcur, N_Vector weightQ);
 static int cvQuadEwtSetSS(CVodeMem cv_mem, N_Vector qcur, N_Vector weightQ);
 static int cvQuadEwtSetSV(CVodeMem cv_mem, N_Vector qcur, N_Vector weightQ);
 
-static int cvSensEwtSet(CVodeMem cv_mem, N_Vector* yScur, N_Vector* weightS);
 static int cvSensEwtSetEE(CVodeMem cv_mem, N_Vector* yScur, N_Vector* weightS);
 static int cvSensEwtSetSS(CVodeMem cv_mem, N_Vector* yScur, N_Vector* weightS);
 static int cvSensEwtSetSV(CVodeMem cv_mem, N_Vector* yScur, N_Vector* weightS);
@@ -411,8 +416,11 @@ static int cvDoErrorTest(CVodeMem cv_mem, int* nflagPtr, sunrealtype saved_t,
 static void cvCompleteStep(CVodeMem cv_mem);
 static void cvPrepareNextStep(CVodeMem cv_mem, sunrealtype dsm);
 static void cvSetEta(CVodeMem cv_mem);
-static sunrealtype cvComputeEtaqm1(CVodeMem cv_mem);
-static sunrealtype cvComputeEtaqp1(CVodeMem cv_mem);
+static void cvComputeEtaqm1qp1(CVodeMem cv_mem);
+static int cvAddNormVectors(CVodeMem cv_mem, int nvec, N_Vector x, N_Vector w,
+                            N_Vector* xS, N_Vector* wS);
+static void cvMaxNorms(CVodeMem cv_mem, int nvec, int nqm1, sunrealtype* ddn,
+                       sunrealtype* dup);
 static void cvChooseEta(CVodeMem cv_mem);
 
 /* Function to handle failures */
@@ -442,6 +450,16 @@ static sunrealtype cvQuadSensUpdateNorm(CVodeMem cv_mem, sunrealtype old_nrm,
 
 /* Internal sensitivity RHS DQ functions */
 
+static int cvSensRhs1DQ(CVodeMem cv_mem, sunrealtype t, N_Vector y,
+                        N_Vector ydot, int is, N_Vector yS, N_Vector ySdot,
+                        N_Vector ytemp, N_Vector ftemp, sunrealtype* p,
+                        void* user_data, long int* nfel);
+
+static int cvSensRhsThreaded(CVodeMem cv_mem, sunrealtype t, N_Vector y,
+                             N_Vector ydot, N_Vector* yS, N_Vector* ySdot,
+                             N_Vector temp1, N_Vector temp2, sunbooleantype dq,
+                             long int* nfS1);
+
 static int cvQuadSensRhsInternalDQ(int Ns, sunrealtype t, N_Vector y,
                                    N_Vector* yS, N_Vector yQdot, N_Vector* yQSdot,
                                    void* cvode_mem, N_Vector tmp, N_Vector tmpQ);
@@ -587,24 +605,28 @@ void* CVodeCreate(int lmm, SUNContext sunctx)
 
   /* Set default values for sensi. optional inputs */
 
-  cv_mem->cv_sensi     = SUNFALSE;
-  cv_mem->cv_fS_data   = NULL;
-  cv_mem->cv_fS        = cvSensRhsInternalDQ;
-  cv_mem->cv_fS1       = cvSensRhs1InternalDQ;
-  cv_mem->cv_fSDQ      = SUNTRUE;
-  cv_mem->cv_ifS       = CV_ONESENS;
-  cv_mem->cv_DQtype    = CV_CENTERED;
-  cv_mem->cv_DQrhomax  = ZERO;
-  cv_mem->cv_p         = NULL;
-  cv_mem->cv_pbar      = NULL;
-  cv_mem->cv_plist     = NULL;
-  cv_mem->cv_errconS   = SUNFALSE;
-  cv_mem->cv_ncfS1     = NULL;
-  cv_mem->cv_ncfnS1    = NULL;
-  cv_mem->cv_nniS1     = NULL;
-  cv_mem->cv_nnfS1     = NULL;
-  cv_mem->cv_itolS     = CV_NN;
-  cv_mem->cv_atolSmin0 = NULL;
+  cv_mem->cv_sensi         = SUNFALSE;
+  cv_mem->cv_fS_data       = NULL;
+  cv_mem->cv_fS            = cvSensRhsInternalDQ;
+  cv_mem->cv_fS1           = cvSensRhs1InternalDQ;
+  cv_mem->cv_fSDQ          = SUNTRUE;
+  cv_mem->cv_ifS           = CV_ONESENS;
+  cv_mem->cv_DQtype        = CV_CENTERED;
+  cv_mem->cv_DQrhomax      = ZERO;
+  cv_mem->cv_nthreadsS     = 1;
+  cv_mem->cv_tempvS_thr    = NULL;
+  cv_mem->cv_user_data_thr = NULL;
+  cv_mem->cv_p_thr         = NULL;
+  cv_mem->cv_p             = NULL;
+  cv_mem->cv_pbar          = NULL;
+  cv_mem->cv_plist         = NULL;
+  cv_mem->cv_errconS       = SUNFALSE;
+  cv_mem->cv_ncfS1         = NULL;
+  cv_mem->cv_ncfnS1        = NULL;
+  cv_mem->cv_nniS1         = NULL;
+  cv_mem->cv_nnfS1         = NULL;
+  cv_mem->cv_itolS         = CV_NN;
+  cv_mem->cv_atolSmin0     = NULL;
 
   /* Set default values for quad. sensi. optional inputs */
 
@@ -3880,6 +3902,138 @@ int CVodeGetDky(void* cvode_mem, sunrealtype t, int k, N_Vector dky)
   return (CV_SUCCESS);
 }
 
+/*
+ * CVodeGetDkyBatch
+ *
+ * This routine computes the k-th derivative of the interpolating
+ * polynomial at each of the nt times t[m] and stores the results in
+ * the vectors dky[m]. All of the times must satisfy the same
+ * conditions as for CVodeGetDky.
+ *
+ * The coefficients c(j,k) * ((t[m] - tn)/h)^(j-k) * h^(-k) are
+ * computed for all of the times at once and the outputs are formed
+ * with one fused vector operation per Nordsieck array column, rather
+ * than one linear combination of the columns per output time.
+ */
+
+int CVodeGetDkyBatch(void* cvode_mem, int nt, sunrealtype* t, int k,
+                     N_Vector* dky)
+{
+  sunrealtype s, r, cjk;
+  sunrealtype tfuzz, tp, tn1;
+  sunrealtype* c;
+  N_Vector* X;
+  int i, j, m, ncol, ier;
+  CVodeMem cv_mem;
+
+  /* Check all inputs for legality */
+
+  if (cvode_mem == NULL)
+  {
+    cvProcessError(NULL, CV_MEM_NULL, __LINE__, __func__, __FILE__, MSGCV_NO_MEM);
+    return (CV_MEM_NULL);
+  }
+  cv_mem = (CVodeMem)cvode_mem;
+
+  SUNDIALS_MARK_FUNCTION_BEGIN(CV_PROFILER);
+
+  if ((nt < 1) || (t == NULL))
+  {
+    cvProcessError(cv_mem, CV_ILL_INPUT, __LINE__, __func__, __FILE__,
+                   "nt must be positive and t must be non-NULL.");
+    SUNDIALS_MARK_FUNCTION_END(CV_PROFILER);
+    return (CV_ILL_INPUT);
+  }
+
+  if (dky == NULL)
+  {
+    cvProcessError(cv_mem, CV_BAD_DKY, __LINE__, __func__, __FILE__,
+                   MSGCV_NULL_DKY);
+    SUNDIALS_MARK_FUNCTION_END(CV_PROFILER);
+    return (CV_BAD_DKY);
+  }
+  for (m = 0; m < nt; m++)
+  {
+    if (dky[m] == NULL)
+    {
+      cvProcessError(cv_mem, CV_BAD_DKY, __LINE__, __func__, __FILE__,
+                     MSGCV_NULL_DKY);
+      SUNDIALS_MARK_FUNCTION_END(CV_PROFILER);
+      return (CV_BAD_DKY);
+    }
+  }
+
+  if ((k < 0) || (k > cv_mem->cv_q))
+  {
+    cvProcessError(cv_mem, CV_BAD_K, __LINE__, __func__, __FILE__, MSGCV_BAD_K);
+    SUNDIALS_MARK_FUNCTION_END(CV_PROFILER);
+    return (CV_BAD_K);
+  }
+
+  /* Allow for some slack */
+  tfuzz = FUZZ_FACTOR * cv_mem->cv_uround *
+          (SUNRabs(cv_mem->cv_tn) + SUNRabs(cv_mem->cv_hu));
+  if (cv_mem->cv_hu < ZERO) { tfuzz = -tfuzz; }
+  tp  = cv_mem->cv_tn - cv_mem->cv_hu - tfuzz;
+  tn1 = cv_mem->cv_tn + tfuzz;
+  for (m = 0; m < nt; m++)
+  {
+    if ((t[m] - tp) * (t[m] - tn1) > ZERO)
+    {
+      cvProcessError(cv_mem, CV_BAD_T, __LINE__, __func__, __FILE__,
+                     MSGCV_BAD_T, t[m], cv_mem->cv_tn - cv_mem->cv_hu,
+                     cv_mem->cv_tn);
+      SUNDIALS_MARK_FUNCTION_END(CV_PROFILER);
+      return (CV_BAD_T);
+    }
+  }
+
+  /* Allocate the coefficient table, c[(q-j)*nt+m] multiplies zn[j] in
+     dky[m], and an array repeating zn[q] for the first column */
+  ncol = cv_mem->cv_q - k + 1;
+  c    = (sunrealtype*)malloc((size_t)ncol * (size_t)nt * sizeof(sunrealtype));
+  X    = (N_Vector*)malloc((size_t)nt * sizeof(N_Vector));
+  if ((c == NULL) || (X == NULL))
+  {
+    free(c);
+    free(X);
+    cvProcessError(cv_mem, CV_MEM_FAIL, __LINE__, __func__, __FILE__,
+                   MSGCV_MEM_FAIL);
+    SUNDIALS_MARK_FUNCTION_END(CV_PROFILER);
+    return (CV_MEM_FAIL);
+  }
+
+  /* Compute the coefficients for all times, including the h^(-k) scaling */
+  r = (k == 0) ? ONE : SUNRpowerI(cv_mem->cv_h, -k);
+  for (m = 0; m < nt; m++)
+  {
+    s = (t[m] - cv_mem->cv_tn) / cv_mem->cv_h;
+    for (j = cv_mem->cv_q; j >= k; j--)
+    {
+      cjk = r;
+      for (i = j; i >= j - k + 1; i--) { cjk *= i; }
+      for (i = 0; i < j - k; i++) { cjk *= s; }
+      c[(cv_mem->cv_q - j) * nt + m] = cjk;
+    }
+    X[m] = cv_mem->cv_zn[cv_mem->cv_q];
+  }
+
+  /* Sum the differentiated interpolating polynomials */
+  ier = N_VScaleVectorArray(nt, c, X, dky);
+  for (j = cv_mem->cv_q - 1; (ier == 0) && (j >= k); j--)
+  {
+    ier = N_VScaleAddMulti(nt, c + (cv_mem->cv_q - j) * nt, cv_mem->cv_zn[j],
+                           dky, dky);
+  }
+
+  free(c);
+  free(X);
+
+  SUNDIALS_MARK_FUNCTION_END(CV_PROFILER);
+  if (ier != 0) { return (CV_VECTOROP_ERR); }
+  return (CV_SUCCESS);
+}
+
 /*
  * CVodeGetQuad
  *
@@ -4439,6 +4593,8 @@ void CVodeFree(void** cvode_mem)
 
   CVodeSensFree(cv_mem);
 
+  cvSensFreeThreadVectors(cv_mem);
+
   CVodeQuadSensFree(cv_mem);
 
   CVodeAdjFree(cv_mem);
@@ -5066,6 +5222,51 @@ static void cvSensFreeVectors(CVodeMem cv_mem)
   cv_mem->cv_SabstolSMallocDone = SUNFALSE;
 }
 
+/*
+ * cvSensAllocThreadVectors
+ *
+ * This routine allocates the work vectors used by the extra threads in
+ * cvSensRhsThreaded (two for each thread after the first), freeing any
+ * previously allocated ones, and sets cv_nthreadsS.
+ */
+
+int cvSensAllocThreadVectors(CVodeMem cv_mem, int nthreads, N_Vector tmpl)
+{
+  cvSensFreeThreadVectors(cv_mem);
+
+  if (nthreads > 1)
+  {
+    cv_mem->cv_tempvS_thr = N_VCloneVectorArray(2 * (nthreads - 1), tmpl);
+    if (cv_mem->cv_tempvS_thr == NULL) { return (CV_MEM_FAIL); }
+
+    cv_mem->cv_lrw += 2 * (nthreads - 1) * cv_mem->cv_lrw1;
+    cv_mem->cv_liw += 2 * (nthreads - 1) * cv_mem->cv_liw1;
+  }
+
+  cv_mem->cv_nthreadsS = nthreads;
+
+  return (CV_SUCCESS);
+}
+
+/*
+ * cvSensFreeThreadVectors
+ *
+ * This routine frees the vectors allocated in cvSensAllocThreadVectors.
+ */
+
+void cvSensFreeThreadVectors(CVodeMem cv_mem)
+{
+  if (cv_mem->cv_tempvS_thr == NULL) { return; }
+
+  N_VDestroyVectorArray(cv_mem->cv_tempvS_thr, 2 * (cv_mem->cv_nthreadsS - 1));
+  cv_mem->cv_tempvS_thr = NULL;
+
+  cv_mem->cv_lrw -= 2 * (cv_mem->cv_nthreadsS - 1) * cv_mem->cv_lrw1;
+  cv_mem->cv_liw -= 2 * (cv_mem->cv_nthreadsS - 1) * cv_mem->cv_liw1;
+
+  cv_mem->cv_nthreadsS = 1;
+}
+
 /*
  * cvQuadSensAllocVectors
  *
@@ -7945,9 +8146,8 @@ static void cvPrepareNextStep(CVodeMem cv_mem, sunrealtype dsm)
       /* If qwait = 0, consider an order change.   etaqm1 and etaqp1 are
         the ratios of new to old h at orders q-1 and q+1, respectively.
         cvChooseEta selects the largest; cvSetEta adjusts eta and acor */
-      cv_mem->cv_qwait  = 2;
-      cv_mem->cv_etaqm1 = cvComputeEtaqm1(cv_mem);
-      cv_mem->cv_etaqp1 = cvComputeEtaqp1(cv_mem);
+      cv_mem->cv_qwait = 2;
+      cvComputeEtaqm1qp1(cv_mem);
       cvChooseEta(cv_mem);
       cvSetEta(cv_mem);
     }
@@ -7999,97 +8199,183 @@ static void cvSetEta(CVodeMem cv_mem)
 }
 
 /*
- * cvComputeEtaqm1
+ * cvComputeEtaqm1qp1
  *
- * This routine computes and returns the value of etaqm1 for a
- * possible decrease in order by 1.
+ * This routine computes the values of etaqm1 and etaqp1 for a
+ * possible decrease or increase in order by 1. The WRMS norms of
+ * the state and sensitivity vectors needed by both are computed
+ * together so that, with distributed vectors, they require a single
+ * global reduction. The quadrature and quadrature sensitivity
+ * vectors, which may be of a different type, share a second one.
  */
 
-static sunrealtype cvComputeEtaqm1(CVodeMem cv_mem)
+static void cvComputeEtaqm1qp1(CVodeMem cv_mem)
 {
-  sunrealtype ddn;
+  sunrealtype ddn, dup, cquot;
+  sunbooleantype qm1, qp1, sens, quad, quadsens;
+  int nvec, nqm1;
 
   cv_mem->cv_etaqm1 = ZERO;
-  if (cv_mem->cv_q > 1)
+  cv_mem->cv_etaqp1 = ZERO;
+
+  qm1 = (cv_mem->cv_q > 1);
+  qp1 = (cv_mem->cv_q != cv_mem->cv_qmax) && (cv_mem->cv_saved_tq5 != ZERO);
+  if (!qm1 && !qp1) { return; }
+
+  sens     = cv_mem->cv_sensi && cv_mem->cv_errconS;
+  quad     = cv_mem->cv_quadr && cv_mem->cv_errconQ;
+  quadsens = cv_mem->cv_quadr_sensi && cv_mem->cv_errconQS;
+
+  /* Differences acor - cquot * zn[qmax] for order q+1 */
+  if (qp1)
   {
-    ddn = N_VWrmsNorm(cv_mem->cv_zn[cv_mem->cv_q], cv_mem->cv_ewt);
+    cquot = (cv_mem->cv_tq[5] / cv_mem->cv_saved_tq5) *
+            SUNRpowerI(cv_mem->cv_h / cv_mem->cv_tau[2], cv_mem->cv_L);
 
-    if (cv_mem->cv_quadr && cv_mem->cv_errconQ)
+    N_VLinearSum(-cquot, cv_mem->cv_zn[cv_mem->cv_qmax], ONE, cv_mem->cv_acor,
+                 cv_mem->cv_tempv);
+
+    if (quad)
     {
-      ddn = cvQuadUpdateNorm(cv_mem, ddn, cv_mem->cv_znQ[cv_mem->cv_q],
-                             cv_mem->cv_ewtQ);
+      N_VLinearSum(-cquot, cv_mem->cv_znQ[cv_mem->cv_qmax], ONE,
+                   cv_mem->cv_acorQ, cv_mem->cv_tempvQ);
     }
 
-    if (cv_mem->cv_sensi && cv_mem->cv_errconS)
+    if (sens)
     {
-      ddn = cvSensUpdateNorm(cv_mem, ddn, cv_mem->cv_znS[cv_mem->cv_q],
-                             cv_mem->cv_ewtS);
+      (void)N_VLinearSumVectorArray(cv_mem->cv_Ns, -cquot,
+                                    cv_mem->cv_znS[cv_mem->cv_qmax], ONE,
+                                    cv_mem->cv_acorS, cv_mem->cv_tempvS);
     }
 
-    if (cv_mem->cv_quadr_sensi && cv_mem->cv_errconQS)
+    if (quadsens)
     {
-      ddn = cvQuadSensUpdateNorm(cv_mem, ddn, cv_mem->cv_znQS[cv_mem->cv_q],
-                                 cv_mem->cv_ewtQS);
+      (void)N_VLinearSumVectorArray(cv_mem->cv_Ns, -cquot,
+                                    cv_mem->cv_znQS[cv_mem->cv_qmax], ONE,
+                                    cv_mem->cv_acorQS, cv_mem->cv_tempvQS);
     }
+  }
+
+  ddn = dup = ZERO;
 
+  /* State and sensitivity norms: zn[q] for order q-1 and the differences
+     for order q+1 */
+  nvec = 0;
+  if (qm1)
+  {
+    nvec = cvAddNormVectors(cv_mem, nvec, cv_mem->cv_zn[cv_mem->cv_q],
+                            cv_mem->cv_ewt,
+                            sens ? cv_mem->cv_znS[cv_mem->cv_q] : NULL,
+                            cv_mem->cv_ewtS);
+  }
+  nqm1 = nvec;
+  if (qp1)
+  {
+    nvec = cvAddNormVectors(cv_mem, nvec, cv_mem->cv_tempv, cv_mem->cv_ewt,
+                            sens ? cv_mem->cv_tempvS : NULL, cv_mem->cv_ewtS);
+  }
+  cvMaxNorms(cv_mem, nvec, nqm1, &ddn, &dup);
+
+  /* Quadrature and quadrature sensitivity norms */
+  if (quad || quadsens)
+  {
+    nvec = 0;
+    if (qm1)
+    {
+      nvec = cvAddNormVectors(cv_mem, nvec,
+                              quad ? cv_mem->cv_znQ[cv_mem->cv_q] : NULL,
+                              cv_mem->cv_ewtQ,
+                              quadsens ? cv_mem->cv_znQS[cv_mem->cv_q] : NULL,
+                              cv_mem->cv_ewtQS);
+    }
+    nqm1 = nvec;
+    if (qp1)
+    {
+      nvec = cvAddNormVectors(cv_mem, nvec, quad ? cv_mem->cv_tempvQ : NULL,
+                              cv_mem->cv_ewtQ,
+                              quadsens ? cv_mem->cv_tempvQS : NULL,
+                              cv_mem->cv_ewtQS);
+    }
+    cvMaxNorms(cv_mem, nvec, nqm1, &ddn, &dup);
+  }
+
+  if (qm1)
+  {
     ddn               = ddn * cv_mem->cv_tq[1];
     cv_mem->cv_etaqm1 = ONE /
                         (SUNRpowerR(BIAS1 * ddn, ONE / cv_mem->cv_q) + ADDON);
   }
-  return (cv_mem->cv_etaqm1);
+
+  if (qp1)
+  {
+    dup = dup * cv_mem->cv_tq[3];
+    cv_mem->cv_etaqp1 =
+      ONE / (SUNRpowerR(BIAS3 * dup, ONE / (cv_mem->cv_L + 1)) + ADDON);
+  }
 }
 
 /*
- * cvComputeEtaqp1
+ * cvAddNormVectors
  *
- * This routine computes and returns the value of etaqp1 for a
- * possible increase in order by 1.
+ * Appends x with weight w (if x is not NULL) and the Ns vectors xS
+ * with weights wS (if xS is not NULL) to the workspace arrays Xvecs
+ * and Zvecs starting at position nvec, and returns the new number of
+ * vectors. Called by cvComputeEtaqm1qp1, which adds at most 2*(1+Ns)
+ * vectors, within the size of the workspace arrays.
  */
 
-static sunrealtype cvComputeEtaqp1(CVodeMem cv_mem)
+static int cvAddNormVectors(CVodeMem cv_mem, int nvec, N_Vector x, N_Vector w,
+                            N_Vector* xS, N_Vector* wS)
 {
-  sunrealtype dup, cquot;
+  int is;
 
-  cv_mem->cv_etaqp1 = ZERO;
-  if (cv_mem->cv_q != cv_mem->cv_qmax)
+  if (x != NULL)
   {
-    if (cv_mem->cv_saved_tq5 == ZERO) { return (cv_mem->cv_etaqp1); }
-    cquot = (cv_mem->cv_tq[5] / cv_mem->cv_saved_tq5) *
-            SUNRpowerI(cv_mem->cv_h / cv_mem->cv_tau[2], cv_mem->cv_L);
-    N_VLinearSum(-cquot, cv_mem->cv_zn[cv_mem->cv_qmax], ONE, cv_mem->cv_acor,
-                 cv_mem->cv_tempv);
-    dup = N_VWrmsNorm(cv_mem->cv_tempv, cv_mem->cv_ewt);
+    cv_mem->cv_Xvecs[nvec] = x;
+    cv_mem->cv_Zvecs[nvec] = w;
+    nvec++;
+  }
 
-    if (cv_mem->cv_quadr && cv_mem->cv_errconQ)
+  if (xS != NULL)
+  {
+    for (is = 0; is < cv_mem->cv_Ns; is++)
     {
-      N_VLinearSum(-cquot, cv_mem->cv_znQ[cv_mem->cv_qmax], ONE,
-                   cv_mem->cv_acorQ, cv_mem->cv_tempvQ);
-      dup = cvQuadUpdateNorm(cv_mem, dup, cv_mem->cv_tempvQ, cv_mem->cv_ewtQ);
+      cv_mem->cv_Xvecs[nvec] = xS[is];
+      cv_mem->cv_Zvecs[nvec] = wS[is];
+      nvec++;
     }
+  }
 
-    if (cv_mem->cv_sensi && cv_mem->cv_errconS)
-    {
-      (void)N_VLinearSumVectorArray(cv_mem->cv_Ns, -cquot,
-                                    cv_mem->cv_znS[cv_mem->cv_qmax], ONE,
-                                    cv_mem->cv_acorS, cv_mem->cv_tempvS);
+  return (nvec);
+}
 
-      dup = cvSensUpdateNorm(cv_mem, dup, cv_mem->cv_tempvS, cv_mem->cv_ewtS);
-    }
+/*
+ * cvMaxNorms
+ *
+ * Computes the WRMS norms of the nvec vectors in Xvecs with weights
+ * Zvecs with a single call to N_VWrmsNormVectorArray and updates ddn
+ * with the largest of the first nqm1 norms and dup with the largest
+ * of the remaining ones.
+ */
 
-    if (cv_mem->cv_quadr_sensi && cv_mem->cv_errconQS)
-    {
-      (void)N_VLinearSumVectorArray(cv_mem->cv_Ns, -cquot,
-                                    cv_mem->cv_znQS[cv_mem->cv_qmax], ONE,
-                                    cv_mem->cv_acorQS, cv_mem->cv_tempvQS);
+static void cvMaxNorms(CVodeMem cv_mem, int nvec, int nqm1, sunrealtype* ddn,
+                       sunrealtype* dup)
+{
+  int i;
 
-      dup = cvSensUpdateNorm(cv_mem, dup, cv_mem->cv_tempvQS, cv_mem->cv_ewtQS);
-    }
+  if (nvec == 0) { return; }
 
-    dup = dup * cv_mem->cv_tq[3];
-    cv_mem->cv_etaqp1 =
-      ONE / (SUNRpowerR(BIAS3 * dup, ONE / (cv_mem->cv_L + 1)) + ADDON);
+  (void)N_VWrmsNormVectorArray(nvec, cv_mem->cv_Xvecs, cv_mem->cv_Zvecs,
+                               cv_mem->cv_cvals);
+
+  for (i = 0; i < nqm1; i++)
+  {
+    if (cv_mem->cv_cvals[i] > *ddn) { *ddn = cv_mem->cv_cvals[i]; }
+  }
+  for (i = nqm1; i < nvec; i++)
+  {
+    if (cv_mem->cv_cvals[i] > *dup) { *dup = cv_mem->cv_cvals[i]; }
   }
-  return (cv_mem->cv_etaqp1);
 }
 
 /*
@@ -8330,7 +8616,8 @@ static int cvHandleFailure(CVodeMem cv_mem, int flag)
 static void cvBDFStab(CVodeMem cv_mem)
 {
   int i, k, ldflag, factorial;
-  sunrealtype sq, sqm1, sqm2;
+  sunrealtype sq, sqm1, sqm2, nrm[2];
+  N_Vector X[2], W[2];
 
   /* If order is 3 or greater, then save scaled derivative data,
      push old data down in i, then add current values to top.    */
@@ -8348,10 +8635,13 @@ static void cvBDFStab(CVodeMem cv_mem)
     for (i = 1; i <= cv_mem->cv_q - 1; i++) { factorial *= i; }
     sq = factorial * cv_mem->cv_q * (cv_mem->cv_q + 1) * cv_mem->cv_acnrm /
          SUNMAX(cv_mem->cv_tq[5], TINY);
-    sqm1 = factorial * cv_mem->cv_q *
-           N_VWrmsNorm(cv_mem->cv_zn[cv_mem->cv_q], cv_mem->cv_ewt);
-    sqm2 = factorial *
-           N_VWrmsNorm(cv_mem->cv_zn[cv_mem->cv_q - 1], cv_mem->cv_ewt);
+    /* Compute both norms with a single global reduction */
+    X[0] = cv_mem->cv_zn[cv_mem->cv_q];
+    X[1] = cv_mem->cv_zn[cv_mem->cv_q - 1];
+    W[0] = W[1] = cv_mem->cv_ewt;
+    (void)N_VWrmsNormVectorArray(2, X, W, nrm);
+    sqm1 = factorial * cv_mem->cv_q * nrm[0];
+    sqm2 = factorial * nrm[1];
     cv_mem->cv_ssdat[1][1] = sqm2 * sqm2;
     cv_mem->cv_ssdat[1][2] = sqm1 * sqm1;
     cv_mem->cv_ssdat[1][3] = sq * sq;
@@ -9380,7 +9670,7 @@ static int cvQuadEwtSetSV(CVodeMem cv_mem, N_Vector qcur, N_Vector weightQ)
  *
  */
 
-static int cvSensEwtSet(CVodeMem cv_mem, N_Vector* yScur, N_Vector* weightS)
+int cvSensEwtSet(CVodeMem cv_mem, N_Vector* yScur, N_Vector* weightS)
 {
   int flag = 0;
 
@@ -9700,6 +9990,7 @@ int cvSensRhsWrapper(CVodeMem cv_mem, sunrealtype time, N_Vector ycur,
                      N_Vector temp1, N_Vector temp2)
 {
   int retval = 0, is;
+  long int nfS1;
 
   if (cv_mem->cv_ifS == CV_ALLSENS)
   {
@@ -9707,6 +9998,13 @@ int cvSensRhsWrapper(CVodeMem cv_mem, sunrealtype time, N_Vector ycur,
                            cv_mem->cv_fS_data, temp1, temp2);
     cv_mem->cv_nfSe++;
   }
+  else if (cv_mem->cv_nthreadsS > 1 &&
+           (!cv_mem->cv_fSDQ || cv_mem->cv_p_thr != NULL))
+  {
+    retval = cvSensRhsThreaded(cv_mem, time, ycur, fcur, yScur, fScur, temp1,
+                               temp2, cv_mem->cv_fSDQ, &nfS1);
+    cv_mem->cv_nfSe += nfS1;
+  }
   else
   {
     for (is = 0; is < cv_mem->cv_Ns; is++)
@@ -9768,7 +10066,19 @@ int cvSensRhsInternalDQ(int Ns, sunrealtype t, N_Vector y, N_Vector ydot,
                         N_Vector* yS, N_Vector* ySdot, void* cvode_mem,
                         N_Vector ytemp, N_Vector ftemp)
 {
+  CVodeMem cv_mem;
   int is, retval;
+  long int nfS1;
+
+  /* cvode_mem is passed here as user data */
+  cv_mem = (CVodeMem)cvode_mem;
+
+  /* the parameters are perturbed in place, so each thread needs its own */
+  if (cv_mem->cv_nthreadsS > 1 && cv_mem->cv_p_thr != NULL)
+  {
+    return (cvSensRhsThreaded(cv_mem, t, y, ydot, yS, ySdot, ytemp, ftemp,
+                              SUNTRUE, &nfS1));
+  }
 
   for (is = 0; is < Ns; is++)
   {
@@ -9795,8 +10105,37 @@ int cvSensRhs1InternalDQ(SUNDIALS_MAYBE_UNUSED int Ns, sunrealtype t, N_Vector y
                          void* cvode_mem, N_Vector ytemp, N_Vector ftemp)
 {
   CVodeMem cv_mem;
+  int retval;
+  long int nfel = 0;
+
+  /* cvode_mem is passed here as user data */
+  cv_mem = (CVodeMem)cvode_mem;
+
+  retval = cvSensRhs1DQ(cv_mem, t, y, ydot, is, yS, ySdot, ytemp, ftemp,
+                        cv_mem->cv_p, cv_mem->cv_user_data, &nfel);
+  if (retval != 0) { return (retval); }
+
+  /* Increment counter nfeS */
+  cv_mem->cv_nfeS += nfel;
+
+  return (0);
+}
+
+/*
+ * cvSensRhs1DQ
+ *
+ * cvSensRhs1DQ computes the is-th sensitivity right hand side by finite
+ * differences, perturbing the parameter array p and passing user_data to f.
+ * The number of calls to f is added to nfel.
+ */
+
+static int cvSensRhs1DQ(CVodeMem cv_mem, sunrealtype t, N_Vector y,
+                        N_Vector ydot, int is, N_Vector yS, N_Vector ySdot,
+                        N_Vector ytemp, N_Vector ftemp, sunrealtype* p,
+                        void* user_data, long int* nfel)
+{
   int retval, method;
-  int nfel = 0, which;
+  int which;
   sunrealtype psave, pbari;
   sunrealtype delta, rdelta;
   sunrealtype Deltap, rDeltap, r2Deltap;
@@ -9808,9 +10147,6 @@ int cvSensRhs1InternalDQ(SUNDIALS_MAYBE_UNUSED int Ns, sunrealtype t, N_Vector y
   sunrealtype cvals[3];
   N_Vector Xvecs[3];
 
-  /* cvode_mem is passed here as user data */
-  cv_mem = (CVodeMem)cvode_mem;
-
   delta  = SUNRsqrt(SUNMAX(cv_mem->cv_reltol, cv_mem->cv_uround));
   rdelta = ONE / delta;
 
@@ -9818,7 +10154,7 @@ int cvSensRhs1InternalDQ(SUNDIALS_MAYBE_UNUSED int Ns, sunrealtype t, N_Vector y
 
   which = cv_mem->cv_plist[is];
 
-  psave = cv_mem->cv_p[which];
+  psave = p[which];
 
   Deltap  = pbari * delta;
   rDeltap = ONE / Deltap;
@@ -9850,17 +10186,17 @@ int cvSensRhs1InternalDQ(SUNDIALS_MAYBE_UNUSED int Ns, sunrealtype t, N_Vector y
     r2Delta = HALF / Delta;
 
     N_VLinearSum(ONE, y, Delta, yS, ytemp);
-    cv_mem->cv_p[which] = psave + Delta;
+    p[which] = psave + Delta;
 
-    retval = cv_mem->cv_f(t, ytemp, ySdot, cv_mem->cv_user_data);
-    nfel++;
+    retval = cv_mem->cv_f(t, ytemp, ySdot, user_data);
+    (*nfel)++;
     if (retval != 0) { return (retval); }
 
     N_VLinearSum(ONE, y, -Delta, yS, ytemp);
-    cv_mem->cv_p[which] = psave - Delta;
+    p[which] = psave - Delta;
 
-    retval = cv_mem->cv_f(t, ytemp, ftemp, cv_mem->cv_user_data);
-    nfel++;
+    retval = cv_mem->cv_f(t, ytemp, ftemp, user_data);
+    (*nfel)++;
     if (retval != 0) { return (retval); }
 
     N_VLinearSum(r2Delta, ySdot, -r2Delta, ftemp, ySdot);
@@ -9874,26 +10210,26 @@ int cvSensRhs1InternalDQ(SUNDIALS_MAYBE_UNUSED int Ns, sunrealtype t, N_Vector y
 
     N_VLinearSum(ONE, y, Deltay, yS, ytemp);
 
-    retval = cv_mem->cv_f(t, ytemp, ySdot, cv_mem->cv_user_data);
-    nfel++;
+    retval = cv_mem->cv_f(t, ytemp, ySdot, user_data);
+    (*nfel)++;
     if (retval != 0) { return (retval); }
 
     N_VLinearSum(ONE, y, -Deltay, yS, ytemp);
 
-    retval = cv_mem->cv_f(t, ytemp, ftemp, cv_mem->cv_user_data);
-    nfel++;
+    retval = cv_mem->cv_f(t, ytemp, ftemp, user_data);
+    (*nfel)++;
     if (retval != 0) { return (retval); }
 
     N_VLinearSum(r2Deltay, ySdot, -r2Deltay, ftemp, ySdot);
 
-    cv_mem->cv_p[which] = psave + Deltap;
-    retval              = cv_mem->cv_f(t, y, ytemp, cv_mem->cv_user_data);
-    nfel++;
+    p[which] = psave + Deltap;
+    retval   = cv_mem->cv_f(t, y, ytemp, user_data);
+    (*nfel)++;
     if (retval != 0) { return (retval); }
 
-    cv_mem->cv_p[which] = psave - Deltap;
-    retval              = cv_mem->cv_f(t, y, ftemp, cv_mem->cv_user_data);
-    nfel++;
+    p[which] = psave - Deltap;
+    retval   = cv_mem->cv_f(t, y, ftemp, user_data);
+    (*nfel)++;
     if (retval != 0) { return (retval); }
 
     /* ySdot = ySdot + r2Deltap * ytemp - r2Deltap * ftemp */
@@ -9915,10 +10251,10 @@ int cvSensRhs1InternalDQ(SUNDIALS_MAYBE_UNUSED int Ns, sunrealtype t, N_Vector y
     rDelta = ONE / Delta;
 
     N_VLinearSum(ONE, y, Delta, yS, ytemp);
-    cv_mem->cv_p[which] = psave + Delta;
+    p[which] = psave + Delta;
 
-    retval = cv_mem->cv_f(t, ytemp, ySdot, cv_mem->cv_user_data);
-    nfel++;
+    retval = cv_mem->cv_f(t, ytemp, ySdot, user_data);
+    (*nfel)++;
     if (retval != 0) { return (retval); }
 
     N_VLinearSum(rDelta, ySdot, -rDelta, ydot, ySdot);
@@ -9929,15 +10265,15 @@ int cvSensRhs1InternalDQ(SUNDIALS_MAYBE_UNUSED int Ns, sunrealtype t, N_Vector y
 
     N_VLinearSum(ONE, y, Deltay, yS, ytemp);
 
-    retval = cv_mem->cv_f(t, ytemp, ySdot, cv_mem->cv_user_data);
-    nfel++;
+    retval = cv_mem->cv_f(t, ytemp, ySdot, user_data);
+    (*nfel)++;
     if (retval != 0) { return (retval); }
 
     N_VLinearSum(rDeltay, ySdot, -rDeltay, ydot, ySdot);
 
-    cv_mem->cv_p[which] = psave + Deltap;
-    retval              = cv_mem->cv_f(t, y, ytemp, cv_mem->cv_user_data);
-    nfel++;
+    p[which] = psave + Deltap;
+    retval   = cv_mem->cv_f(t, y, ytemp, user_data);
+    (*nfel)++;
     if (retval != 0) { return (retval); }
 
     /* ySdot = ySdot + rDeltap * ytemp - rDeltap * ydot */
@@ -9954,12 +10290,107 @@ int cvSensRhs1InternalDQ(SUNDIALS_MAYBE_UNUSED int Ns, sunrealtype t, N_Vector y
     break;
   }
 
-  cv_mem->cv_p[which] = psave;
+  p[which] = psave;
+
+  return (0);
+}
+
+/*
+ * cvSensRhsThreaded
+ *
+ * cvSensRhsThreaded computes the right hand sides of all sensitivity
+ * equations with the loop over the sensitivities split between
+ * cv_nthreadsS threads. Each thread uses its own pair of work vectors and,
+ * if set with CVodeSetSensThreadData, its own user data and (for the DQ
+ * approximation) parameter array. Each sensitivity is computed by one thread
+ * with the same operations as in the serial loop, so the results do not
+ * depend on the number of threads. If a function call fails, the return
+ * value is that of the failure with the smallest index is. The number of
+ * sensitivities computed is returned in nfS1.
+ */
+
+static int cvSensRhsThreaded(CVodeMem cv_mem, sunrealtype t, N_Vector y,
+                             N_Vector ydot, N_Vector* yS, N_Vector* ySdot,
+                             N_Vector temp1, N_Vector temp2, sunbooleantype dq,
+                             long int* nfS1)
+{
+  int is, tid, rv, fail_is, retval;
+  int Ns           = cv_mem->cv_Ns;
+  long int nfel    = 0;
+  long int nfSe    = 0;
+  long int nfel_is = 0;
+  N_Vector tmp1    = temp1;
+  N_Vector tmp2    = temp2;
+  void* user_data  = NULL;
+
+  fail_is = Ns;
+  retval  = 0;
+
+#if defined(SUNDIALS_OPENMP_ENABLED)
+#pragma omp parallel for schedule(static) num_threads(cv_mem->cv_nthreadsS) \
+  private(tid, rv, nfel_is, tmp1, tmp2, user_data)                          \
+  reduction(+ : nfel, nfSe)
+#endif
+  for (is = 0; is < Ns; is++)
+  {
+#if defined(SUNDIALS_OPENMP_ENABLED)
+    tid = omp_get_thread_num();
+#pragma omp atomic read
+    rv = fail_is;
+#else
+    tid = 0;
+    rv  = fail_is;
+#endif
+
+    /* skip the sensitivities after a failure */
+    if (is > rv) { continue; }
+
+    tmp1 = (tid == 0) ? temp1 : cv_mem->cv_tempvS_thr[2 * (tid - 1)];
+    tmp2 = (tid == 0) ? temp2 : cv_mem->cv_tempvS_thr[2 * (tid - 1) + 1];
+
+    if (cv_mem->cv_user_data_thr != NULL)
+    {
+      user_data = cv_mem->cv_user_data_thr[tid];
+    }
+    else { user_data = dq ? cv_mem->cv_user_data : cv_mem->cv_fS_data; }
+
+    if (dq)
+    {
+      nfel_is = 0;
+      rv      = cvSensRhs1DQ(cv_mem, t, y, ydot, is, yS[is], ySdot[is], tmp1,
+                             tmp2, cv_mem->cv_p_thr[tid], user_data, &nfel_is);
+      if (rv == 0) { nfel += nfel_is; }
+    }
+    else
+    {
+      rv = cv_mem->cv_fS1(Ns, t, y, ydot, is, yS[is], ySdot[is], user_data,
+                          tmp1, tmp2);
+    }
+    nfSe++;
+
+    if (rv != 0)
+    {
+#if defined(SUNDIALS_OPENMP_ENABLED)
+#pragma omp critical(cvSensRhsThreaded_fail)
+#endif
+      {
+        if (is < fail_is)
+        {
+#if defined(SUNDIALS_OPENMP_ENABLED)
+#pragma omp atomic write
+#endif
+          fail_is = is;
+          retval  = rv;
+        }
+      }
+    }
+  }
 
-  /* Increment counter nfeS */
   cv_mem->cv_nfeS += nfel;
 
-  return (0);
+  *nfS1 = nfSe;
+
+  return (retval);
 }
 
 /*
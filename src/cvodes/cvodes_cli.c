@@ -85,6 +85,7 @@ static int cvSetFromCommandLine(void* cvode_mem, const char* cvid, int argc,
      {"quad_err_con", CVodeSetQuadErrCon},
      {"sens_err_con", CVodeSetSensErrCon},
      {"sens_max_nonlin_iters", CVodeSetSensMaxNonlinIters},
+     {"sens_num_threads", CVodeSetSensNumThreads},
      {"quad_sens_err_con", CVodeSetQuadSensErrCon},
      {"linear_solution_scaling", CVodeSetLinearSolutionScaling},
      {"proj_err_est", CVodeSetProjErrEst},
@@ -125,7 +126,8 @@ static int cvSetFromCommandLine(void* cvode_mem, const char* cvid, int argc,
   static const struct sunKeyTwoRealPair tworeal_pairs[] =
     {{"eta_fixed_step_bounds", CVodeSetEtaFixedStepBounds},
      {"scalar_tolerances", CVodeSStolerances},
-     {"quad_scalar_tolerances", CVodeQuadSStolerances}};
+     {"quad_scalar_tolerances", CVodeQuadSStolerances},
+     {"jac_reuse_on_reinit", CVodeSetJacReuseOnReInit}};
   static const int num_tworeal_keys = sizeof(tworeal_pairs) /
                                       sizeof(*tworeal_pairs);
 
@@ -28,6 +28,7 @@
 #include <sundials/sundials_math.h>
 
 #include "cvodes_proj_impl.h"
+#include "sundials_compress_impl.h"
 #include "sundials_logger_impl.h"
 #include "sundials_macros.h"
 
@@ -288,6 +289,11 @@ typedef struct CVodeMemRec
   int cv_DQtype;           /* central/forward finite differences           */
   sunrealtype cv_DQrhomax; /* cut-off value for separate/simultaneous FD   */
 
+  int cv_nthreadsS;         /* threads used for the sensitivity RHS         */
+  N_Vector* cv_tempvS_thr;  /* two work vectors for each extra thread       */
+  void** cv_user_data_thr;  /* user data passed to f and fS1 by each thread */
+  sunrealtype** cv_p_thr;   /* parameters perturbed by each DQ thread       */
+
   sunbooleantype cv_errconS; /* SUNTRUE if yS are considered in err. control */
 
   int cv_itolS;
@@ -815,6 +821,7 @@ typedef struct CVhermiteDataMemRec
   N_Vector yd;
   N_Vector* yS;
   N_Vector* ySd;
+  long int index; /* index in dt_mem (slot in compressed storage) */
 }* CVhermiteDataMem;
 
 /* Data for polynomial interpolation */
@@ -823,6 +830,7 @@ typedef struct CVpolynomialDataMemRec
   N_Vector y;
   N_Vector* yS;
   int order;
+  long int index; /* index in dt_mem (slot in compressed storage) */
 }* CVpolynomialDataMem;
 
 /*
@@ -980,6 +988,22 @@ struct CVadjMemRec
   N_Vector* ca_YS[L_MAX]; /* pointers to znS[i] */
   sunrealtype ca_T[L_MAX];
 
+  /* Compressed storage of the interpolation data. When ca_ctype is not
+     SUNDATACOMPRESSION_NONE the data points hold no vectors and the data
+     is kept in one store per vector (y, yd, yS[is], ySd[is]) instead. */
+  SUNDataCompression ca_ctype; /* compression method                   */
+  sunrealtype ca_ctol;         /* error bound relative to the weights  */
+  SUNCompressStore ca_cy;      /* y at the data points                 */
+  SUNCompressStore ca_cyd;     /* yd at the data points (Hermite)      */
+  SUNCompressStore* ca_cyS;    /* yS at the data points                */
+  SUNCompressStore* ca_cySd;   /* ySd at the data points (Hermite)     */
+  N_Vector ca_cw;              /* error weights of a new data point    */
+  N_Vector* ca_cwS;            /* sensitivity weights of a new point   */
+  N_Vector ca_cvec[4];         /* decoded y, yd of two data points     */
+  N_Vector* ca_cvecS[4];       /* decoded yS, ySd of two data points   */
+  long int ca_cidx[2];         /* data points held in ca_cvec          */
+  long int ca_cidxS[2];        /* data points held in ca_cvecS         */
+
   /* -------------------------------
    * Workspace for wrapper functions
    * ------------------------------- */
@@ -1180,6 +1204,10 @@ int cvSensRhs1Wrapper(CVodeMem cv_mem, sunrealtype time, N_Vector ycur,
                       N_Vector fcur, int is, N_Vector yScur, N_Vector fScur,
                       N_Vector temp1, N_Vector temp2);
 
+/* Compute the sensitivity error weights */
+
+int cvSensEwtSet(CVodeMem cv_mem, N_Vector* yScur, N_Vector* weightS);
+
 /* Prototypes for internal sensitivity rhs DQ functions */
 
 int cvSensRhsInternalDQ(int Ns, sunrealtype t, N_Vector y, N_Vector ydot,
@@ -1190,6 +1218,12 @@ int cvSensRhs1InternalDQ(int Ns, sunrealtype t, N_Vector y, N_Vector ydot,
                          int is, N_Vector yS, N_Vector ySdot, void* fS_data,
                          N_Vector tempv, N_Vector ftemp);
 
+/* Prototypes for the per-thread sensitivity RHS work vectors */
+
+int cvSensAllocThreadVectors(CVodeMem cv_mem, int nthreads, N_Vector tmpl);
+
+void cvSensFreeThreadVectors(CVodeMem cv_mem);
+
 /* Function to destroy function table allocated by the Python binding code */
 
 #if defined(SUNDIALS_ENABLE_PYTHON)
@@ -1272,7 +1306,8 @@ void cvode_user_supplied_fn_table_destroy(void* ptr);
 #define MSGCV_NULL_DKYA   "dkyA = NULL illegal."
 #define MSGCV_BAD_DQTYPE \
   "Illegal value for DQtype. Legal values are: CV_CENTERED and CV_FORWARD."
-#define MSGCV_BAD_DQRHO "DQrhomax < 0 illegal."
+#define MSGCV_BAD_DQRHO    "DQrhomax < 0 illegal."
+#define MSGCV_BAD_NTHREADS "nthreads < 1 illegal."
 
 #define MSGCV_BAD_ITOLQS \
   "Illegal value for itolQS. The legal values are CV_SS, CV_SV, and CV_EE."
@@ -1447,6 +1482,13 @@ void cvode_user_supplied_fn_table_destroy(void* ptr);
 #define MSGCV_BAD_TINTERP "Bad t = " SUN_FORMAT_G " for interpolation."
 #define MSGCV_WRONG_INTERP \
   "This function cannot be called for the specified interp type."
+#define MSGCV_BAD_CTYPE "Illegal value for ctype."
+#define MSGCV_BAD_CTOL  "tol <= 0 illegal for the requested compression."
+#define MSGCV_CMP_SET \
+  "The compression cannot be changed after the first call to CVodeF."
+#define MSGCV_CMP_NVECTOR                                                 \
+  "The compression requires the N_Vector buffer operations (N_VBufSize, " \
+  "N_VBufPack, N_VBufUnpack)."
 
 #ifdef __cplusplus
 }
@@ -1284,6 +1284,73 @@ int CVodeSetSensParams(void* cvode_mem, sunrealtype* p, sunrealtype* pbar,
 
 /*-----------------------------------------------------------------*/
 
+int CVodeSetSensNumThreads(void* cvode_mem, int nthreads)
+{
+  CVodeMem cv_mem;
+  int retval;
+
+  if (cvode_mem == NULL)
+  {
+    cvProcessError(NULL, CV_MEM_NULL, __LINE__, __func__, __FILE__, MSGCV_NO_MEM);
+    return (CV_MEM_NULL);
+  }
+
+  cv_mem = (CVodeMem)cvode_mem;
+
+  if (cv_mem->cv_MallocDone == SUNFALSE)
+  {
+    cvProcessError(cv_mem, CV_NO_MALLOC, __LINE__, __func__, __FILE__,
+                   MSGCV_NO_MALLOC);
+    return (CV_NO_MALLOC);
+  }
+
+  if (nthreads < 1)
+  {
+    cvProcessError(cv_mem, CV_ILL_INPUT, __LINE__, __func__, __FILE__,
+                   MSGCV_BAD_NTHREADS);
+    return (CV_ILL_INPUT);
+  }
+
+  /* Without OpenMP the sensitivity right-hand sides are computed serially */
+#if !defined(SUNDIALS_OPENMP_ENABLED)
+  nthreads = 1;
+#endif
+
+  if (nthreads == cv_mem->cv_nthreadsS) { return (CV_SUCCESS); }
+
+  retval = cvSensAllocThreadVectors(cv_mem, nthreads, cv_mem->cv_tempv);
+  if (retval != CV_SUCCESS)
+  {
+    cvProcessError(cv_mem, CV_MEM_FAIL, __LINE__, __func__, __FILE__,
+                   MSGCV_MEM_FAIL);
+    return (CV_MEM_FAIL);
+  }
+
+  return (CV_SUCCESS);
+}
+
+/*-----------------------------------------------------------------*/
+
+int CVodeSetSensThreadData(void* cvode_mem, void** user_data, sunrealtype** p)
+{
+  CVodeMem cv_mem;
+
+  if (cvode_mem == NULL)
+  {
+    cvProcessError(NULL, CV_MEM_NULL, __LINE__, __func__, __FILE__, MSGCV_NO_MEM);
+    return (CV_MEM_NULL);
+  }
+
+  cv_mem = (CVodeMem)cvode_mem;
+
+  cv_mem->cv_user_data_thr = user_data;
+  cv_mem->cv_p_thr         = p;
+
+  return (CV_SUCCESS);
+}
+
+/*-----------------------------------------------------------------*/
+
 int CVodeSetQuadSensErrCon(void* cvode_mem, sunbooleantype errconQS)
 {
   CVodeMem cv_mem;
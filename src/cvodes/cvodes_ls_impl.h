@@ -24,6 +24,7 @@
 #include <cvodes/cvodes_ls.h>
 
 #include "cvodes_impl.h"
+#include "sundials_sparsedq_impl.h"
 
 #ifdef __cplusplus /* wrapper to enable C++ usage */
 extern "C" {
@@ -66,6 +67,14 @@ typedef struct CVLsMemRec
   sunbooleantype jbad;    /* heuristic suggestion for pset                */
   sunrealtype dgmax_jbad; /* if convfail = FAIL_BAD_J and the gamma ratio *
                         * |gamma/gammap-1| < dgmax_jbad then J is bad  */
+  SUNSparseDQ sdq;        /* sparsity pattern and column coloring for the *
+                        * sparse DQ Jacobian approximation             */
+
+  /* Reuse of the Jacobian or preconditioner data after a reinitialization */
+  sunbooleantype jcached; /* SUNTRUE if J/P data from a successful update *
+                        * is available for reuse                       */
+  sunrealtype dtmax_reuse; /* max |t0 - tnlj| for reuse (<= 0 disables)  */
+  sunrealtype dgmax_reuse; /* max |gamma/gamlj - 1| for reuse (<= 0 off)  */
 
   /* Matrix-based solver, scale solution to account for change in gamma */
   sunbooleantype scalesol;
@@ -96,6 +105,7 @@ typedef struct CVLsMemRec
   long int njtsetup; /* njtsetup = total number of calls to jtsetup  */
   long int njtimes;  /* njtimes = total number of calls to jtimes    */
   sunrealtype tnlj;  /* tnlj = t_n at last jac/pset call             */
+  sunrealtype gamlj; /* gamlj = gamma at last jac/pset call           */
 
   /* Preconditioner computation
    * (a) user-provided:
@@ -115,11 +125,16 @@ typedef struct CVLsMemRec
    *     - jtimesDQ == SUNFALSE
    * (b) internal jtimes
    *     - jt_data == cvode_mem
-   *     - jtimesDQ == SUNTRUE */
+   *     - jtimesDQ == SUNTRUE
+   * (c) internal jtimes calling a user-provided directional derivative:
+   *     - jt_data == cvode_mem
+   *     - jtimesDQ == SUNFALSE
+   *     - jt_dir != NULL */
   sunbooleantype jtimesDQ;
   CVLsJacTimesSetupFn jtsetup;
   CVLsJacTimesVecFn jtimes;
   CVRhsFn jt_f;
+  CVLsJacTimesDirDerivFn jt_dir;
   void* jt_data;
 
   /* Linear system setup function
@@ -147,6 +162,8 @@ int cvLsPSetup(void* cvode_mem);
 int cvLsPSolve(void* cvode_mem, N_Vector r, N_Vector z, sunrealtype tol, int lr);
 
 /* Difference quotient approximation for Jac times vector */
+int cvLsDirDerivJtimes(N_Vector v, N_Vector Jv, sunrealtype t, N_Vector y,
+                       N_Vector fy, void* cvode_mem, N_Vector work);
 int cvLsDQJtimes(N_Vector v, N_Vector Jv, sunrealtype t, N_Vector y,
                  N_Vector fy, void* data, N_Vector work);
 
@@ -157,6 +174,8 @@ int cvLsDenseDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
                    CVodeMem cv_mem, N_Vector tmp1);
 int cvLsBandDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
                   CVodeMem cv_mem, N_Vector tmp1, N_Vector tmp2);
+int cvLsSparseDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
+                    CVodeMem cv_mem, N_Vector tmp1, N_Vector tmp2);
 
 /* Generic linit/lsetup/lsolve/lfree interface routines for CVode to call */
 int cvLsInitialize(CVodeMem cv_mem);
@@ -170,6 +189,7 @@ int cvLsFree(CVodeMem cv_mem);
 
 /* Auxiliary functions */
 int cvLsInitializeCounters(CVLsMem cvls_mem);
+sunbooleantype cvLsCanReuse(CVodeMem cv_mem, CVLsMem cvls_mem);
 int cvLs_AccessLMem(void* cvode_mem, const char* fname, CVodeMem* cv_mem,
                     CVLsMem* cvls_mem);
 
@@ -231,6 +251,9 @@ int cvLs_AccessLMemBCur(void* cvode_mem, const char* fname, CVodeMem* cv_mem,
 #define MSG_LS_PSOLVE_REQ "pretype != PREC_NONE, but PSOLVE = NULL is illegal."
 #define MSG_LS_BAD_GSTYPE \
   "Illegal value for gstype. Legal values are MODIFIED_GS and CLASSICAL_GS."
+#define MSG_LS_NO_PATTERN                                                \
+  "A sparsity pattern is required for the difference quotient Jacobian " \
+  "approximation with a sparse SUNMatrix."
 
 #define MSG_LS_PSET_FAILED \
   "The preconditioner setup routine failed in an unrecoverable manner."
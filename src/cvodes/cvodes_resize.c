@@ -337,6 +337,17 @@ int CVodeResizeHistory(void* cvode_mem, sunrealtype* t_hist, N_Vector* y_hist,
     return CV_MEM_FAIL;
   }
 
+  if (cv_mem->cv_nthreadsS > 1)
+  {
+    retval = cvSensAllocThreadVectors(cv_mem, cv_mem->cv_nthreadsS, y_hist[0]);
+    if (retval)
+    {
+      cvProcessError(cv_mem, CV_MEM_FAIL, __LINE__, __func__, __FILE__,
+                     "A vector allocation failed");
+      return CV_MEM_FAIL;
+    }
+  }
+
   /* User will need to set a new vector of absolute tolerances */
   if (cv_mem->cv_VabstolMallocDone)
   {
@@ -1023,6 +1023,26 @@ SWIGEXPORT int _wrap_FCVodeGetDky(void *farg1, double const *farg2, int const *f
 }
 
 
+SWIGEXPORT int _wrap_FCVodeGetDkyBatch(void *farg1, int const *farg2, double *farg3, int const *farg4, void *farg5) {
+  int fresult ;
+  void *arg1 = (void *) 0 ;
+  int arg2 ;
+  sunrealtype *arg3 = (sunrealtype *) 0 ;
+  int arg4 ;
+  N_Vector *arg5 = (N_Vector *) 0 ;
+  int result;
+  
+  arg1 = (void *)(farg1);
+  arg2 = (int)(*farg2);
+  arg3 = (sunrealtype *)(farg3);
+  arg4 = (int)(*farg4);
+  arg5 = (N_Vector *)(farg5);
+  result = (int)CVodeGetDkyBatch(arg1,arg2,arg3,arg4,arg5);
+  fresult = (int)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FCVodeGetWorkSpace(void *farg1, long *farg2, long *farg3) {
   int fresult ;
   void *arg1 = (void *) 0 ;
@@ -1894,6 +1914,36 @@ SWIGEXPORT int _wrap_FCVodeSetSensParams(void *farg1, double *farg2, double *far
 }
 
 
+SWIGEXPORT int _wrap_FCVodeSetSensNumThreads(void *farg1, int const *farg2) {
+  int fresult ;
+  void *arg1 = (void *) 0 ;
+  int arg2 ;
+  int result;
+  
+  arg1 = (void *)(farg1);
+  arg2 = (int)(*farg2);
+  result = (int)CVodeSetSensNumThreads(arg1,arg2);
+  fresult = (int)(result);
+  return fresult;
+}
+
+
+SWIGEXPORT int _wrap_FCVodeSetSensThreadData(void *farg1, void *farg2, void *farg3) {
+  int fresult ;
+  void *arg1 = (void *) 0 ;
+  void **arg2 = (void **) 0 ;
+  sunrealtype **arg3 = (sunrealtype **) 0 ;
+  int result;
+  
+  arg1 = (void *)(farg1);
+  arg2 = (void **)(farg2);
+  arg3 = (sunrealtype **)(farg3);
+  result = (int)CVodeSetSensThreadData(arg1,arg2,arg3);
+  fresult = (int)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FCVodeSetNonlinearSolverSensSim(void *farg1, SUNNonlinearSolver farg2) {
   int fresult ;
   void *arg1 = (void *) 0 ;
@@ -2744,6 +2794,22 @@ SWIGEXPORT int _wrap_FCVodeSetAdjNoSensi(void *farg1) {
 }
 
 
+SWIGEXPORT int _wrap_FCVodeSetAdjCompression(void *farg1, int const *farg2, double const *farg3) {
+  int fresult ;
+  void *arg1 = (void *) 0 ;
+  SUNDataCompression arg2 ;
+  sunrealtype arg3 ;
+  int result;
+  
+  arg1 = (void *)(farg1);
+  arg2 = (SUNDataCompression)(*farg2);
+  arg3 = (sunrealtype)(*farg3);
+  result = (int)CVodeSetAdjCompression(arg1,arg2,arg3);
+  fresult = (int)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FCVodeSetUserDataB(void *farg1, int const *farg2, void *farg3) {
   int fresult ;
   void *arg1 = (void *) 0 ;
@@ -3200,6 +3266,22 @@ SWIGEXPORT int _wrap_FCVodeGetAdjCheckPointsInfo(void *farg1, SwigClassWrapper c
 }
 
 
+SWIGEXPORT int _wrap_FCVodeGetAdjCompressionStats(void *farg1, double *farg2, double *farg3) {
+  int fresult ;
+  void *arg1 = (void *) 0 ;
+  sunrealtype *arg2 = (sunrealtype *) 0 ;
+  sunrealtype *arg3 = (sunrealtype *) 0 ;
+  int result;
+  
+  arg1 = (void *)(farg1);
+  arg2 = (sunrealtype *)(farg2);
+  arg3 = (sunrealtype *)(farg3);
+  result = (int)CVodeGetAdjCompressionStats(arg1,arg2,arg3);
+  fresult = (int)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FCVodeSetJacTimesRhsFnB(void *farg1, int const *farg2, CVRhsFn farg3) {
   int fresult ;
   void *arg1 = (void *) 0 ;
@@ -3577,6 +3659,20 @@ SWIGEXPORT int _wrap_FCVodeSetJacFn(void *farg1, CVLsJacFn farg2) {
 }
 
 
+SWIGEXPORT int _wrap_FCVodeSetJacSparsityPattern(void *farg1, SUNMatrix farg2) {
+  int fresult ;
+  void *arg1 = (void *) 0 ;
+  SUNMatrix arg2 = (SUNMatrix) 0 ;
+  int result;
+  
+  arg1 = (void *)(farg1);
+  arg2 = (SUNMatrix)(farg2);
+  result = (int)CVodeSetJacSparsityPattern(arg1,arg2);
+  fresult = (int)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FCVodeSetJacEvalFrequency(void *farg1, long const *farg2) {
   int fresult ;
   void *arg1 = (void *) 0 ;
@@ -3619,6 +3715,22 @@ SWIGEXPORT int _wrap_FCVodeSetDeltaGammaMaxBadJac(void *farg1, double const *far
 }
 
 
+SWIGEXPORT int _wrap_FCVodeSetJacReuseOnReInit(void *farg1, double const *farg2, double const *farg3) {
+  int fresult ;
+  void *arg1 = (void *) 0 ;
+  sunrealtype arg2 ;
+  sunrealtype arg3 ;
+  int result;
+  
+  arg1 = (void *)(farg1);
+  arg2 = (sunrealtype)(*farg2);
+  arg3 = (sunrealtype)(*farg3);
+  result = (int)CVodeSetJacReuseOnReInit(arg1,arg2,arg3);
+  fresult = (int)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FCVodeSetEpsLin(void *farg1, double const *farg2) {
   int fresult ;
   void *arg1 = (void *) 0 ;
@@ -3679,6 +3791,20 @@ SWIGEXPORT int _wrap_FCVodeSetJacTimes(void *farg1, CVLsJacTimesSetupFn farg2, C
 }
 
 
+SWIGEXPORT int _wrap_FCVodeSetJacTimesDirDeriv(void *farg1, CVLsJacTimesDirDerivFn farg2) {
+  int fresult ;
+  void *arg1 = (void *) 0 ;
+  CVLsJacTimesDirDerivFn arg2 = (CVLsJacTimesDirDerivFn) 0 ;
+  int result;
+  
+  arg1 = (void *)(farg1);
+  arg2 = (CVLsJacTimesDirDerivFn)(farg2);
+  result = (int)CVodeSetJacTimesDirDeriv(arg1,arg2);
+  fresult = (int)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FCVodeSetLinSysFn(void *farg1, CVLsLinSysFn farg2) {
   int fresult ;
   void *arg1 = (void *) 0 ;
@@ -145,6 +145,7 @@ module fcvodes_mod
  public :: FCVodeComputeStateSens
  public :: FCVodeComputeStateSens1
  public :: FCVodeGetDky
+ public :: FCVodeGetDkyBatch
  public :: FCVodeGetWorkSpace
  public :: FCVodeGetNumSteps
  public :: FCVodeGetNumRhsEvals
@@ -206,6 +207,8 @@ module fcvodes_mod
  public :: FCVodeSetSensErrCon
  public :: FCVodeSetSensMaxNonlinIters
  public :: FCVodeSetSensParams
+ public :: FCVodeSetSensNumThreads
+ public :: FCVodeSetSensThreadData
  public :: FCVodeSetNonlinearSolverSensSim
  public :: FCVodeSetNonlinearSolverSensStg
  public :: FCVodeSetNonlinearSolverSensStg1
@@ -261,6 +264,7 @@ module fcvodes_mod
  public :: FCVodeF
  public :: FCVodeB
  public :: FCVodeSetAdjNoSensi
+ public :: FCVodeSetAdjCompression
  public :: FCVodeSetUserDataB
  public :: FCVodeSetMaxOrdB
  public :: FCVodeSetMaxNumStepsB
@@ -310,6 +314,7 @@ module fcvodes_mod
   module procedure swigf_create_CVadjCheckPointRec
  end interface
  public :: FCVodeGetAdjCheckPointsInfo
+ public :: FCVodeGetAdjCompressionStats
  public :: FCVodeSetJacTimesRhsFnB
  public :: FCVodeGetAdjDataPointHermite
  public :: FCVodeGetAdjDataPointPolynomial
@@ -353,13 +358,16 @@ module fcvodes_mod
  integer(C_INT), parameter, public :: CVLS_LMEMB_NULL = -102_C_INT
  public :: FCVodeSetLinearSolver
  public :: FCVodeSetJacFn
+ public :: FCVodeSetJacSparsityPattern
  public :: FCVodeSetJacEvalFrequency
  public :: FCVodeSetLinearSolutionScaling
  public :: FCVodeSetDeltaGammaMaxBadJac
+ public :: FCVodeSetJacReuseOnReInit
  public :: FCVodeSetEpsLin
  public :: FCVodeSetLSNormFactor
  public :: FCVodeSetPreconditioner
  public :: FCVodeSetJacTimes
+ public :: FCVodeSetJacTimesDirDeriv
  public :: FCVodeSetLinSysFn
  public :: FCVodeGetJac
  public :: FCVodeGetJacTime
@@ -841,6 +849,18 @@ type(C_PTR), value :: farg4
 integer(C_INT) :: fresult
 end function
 
+function swigc_FCVodeGetDkyBatch(farg1, farg2, farg3, farg4, farg5) &
+bind(C, name="_wrap_FCVodeGetDkyBatch") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+type(C_PTR), value :: farg3
+integer(C_INT), intent(in) :: farg4
+type(C_PTR), value :: farg5
+integer(C_INT) :: fresult
+end function
+
 function swigc_FCVodeGetWorkSpace(farg1, farg2, farg3) &
 bind(C, name="_wrap_FCVodeGetWorkSpace") &
 result(fresult)
@@ -1396,6 +1416,25 @@ type(C_PTR), value :: farg4
 integer(C_INT) :: fresult
 end function
 
+function swigc_FCVodeSetSensNumThreads(farg1, farg2) &
+bind(C, name="_wrap_FCVodeSetSensNumThreads") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+integer(C_INT) :: fresult
+end function
+
+function swigc_FCVodeSetSensThreadData(farg1, farg2, farg3) &
+bind(C, name="_wrap_FCVodeSetSensThreadData") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+type(C_PTR), value :: farg2
+type(C_PTR), value :: farg3
+integer(C_INT) :: fresult
+end function
+
 function swigc_FCVodeSetNonlinearSolverSensSim(farg1, farg2) &
 bind(C, name="_wrap_FCVodeSetNonlinearSolverSensSim") &
 result(fresult)
@@ -1931,6 +1970,16 @@ type(C_PTR), value :: farg1
 integer(C_INT) :: fresult
 end function
 
+function swigc_FCVodeSetAdjCompression(farg1, farg2, farg3) &
+bind(C, name="_wrap_FCVodeSetAdjCompression") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+real(C_DOUBLE), intent(in) :: farg3
+integer(C_INT) :: fresult
+end function
+
 function swigc_FCVodeSetUserDataB(farg1, farg2, farg3) &
 bind(C, name="_wrap_FCVodeSetUserDataB") &
 result(fresult)
@@ -2234,6 +2283,16 @@ type(SwigClassWrapper) :: farg2
 integer(C_INT) :: fresult
 end function
 
+function swigc_FCVodeGetAdjCompressionStats(farg1, farg2, farg3) &
+bind(C, name="_wrap_FCVodeGetAdjCompressionStats") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+type(C_PTR), value :: farg2
+type(C_PTR), value :: farg3
+integer(C_INT) :: fresult
+end function
+
 function swigc_FCVodeSetJacTimesRhsFnB(farg1, farg2, farg3) &
 bind(C, name="_wrap_FCVodeSetJacTimesRhsFnB") &
 result(fresult)
@@ -2467,6 +2526,15 @@ type(C_FUNPTR), value :: farg2
 integer(C_INT) :: fresult
 end function
 
+function swigc_FCVodeSetJacSparsityPattern(farg1, farg2) &
+bind(C, name="_wrap_FCVodeSetJacSparsityPattern") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+type(C_PTR), value :: farg2
+integer(C_INT) :: fresult
+end function
+
 function swigc_FCVodeSetJacEvalFrequency(farg1, farg2) &
 bind(C, name="_wrap_FCVodeSetJacEvalFrequency") &
 result(fresult)
@@ -2494,6 +2562,16 @@ real(C_DOUBLE), intent(in) :: farg2
 integer(C_INT) :: fresult
 end function
 
+function swigc_FCVodeSetJacReuseOnReInit(farg1, farg2, farg3) &
+bind(C, name="_wrap_FCVodeSetJacReuseOnReInit") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+real(C_DOUBLE), intent(in) :: farg2
+real(C_DOUBLE), intent(in) :: farg3
+integer(C_INT) :: fresult
+end function
+
 function swigc_FCVodeSetEpsLin(farg1, farg2) &
 bind(C, name="_wrap_FCVodeSetEpsLin") &
 result(fresult)
@@ -2532,6 +2610,15 @@ type(C_FUNPTR), value :: farg3
 integer(C_INT) :: fresult
 end function
 
+function swigc_FCVodeSetJacTimesDirDeriv(farg1, farg2) &
+bind(C, name="_wrap_FCVodeSetJacTimesDirDeriv") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+type(C_FUNPTR), value :: farg2
+integer(C_INT) :: fresult
+end function
+
 function swigc_FCVodeSetLinSysFn(farg1, farg2) &
 bind(C, name="_wrap_FCVodeSetLinSysFn") &
 result(fresult)
@@ -3636,6 +3723,31 @@ fresult = swigc_FCVodeGetDky(farg1, farg2, farg3, farg4)
 swig_result = fresult
 end function
 
+function FCVodeGetDkyBatch(cvode_mem, nt, t, k, dky) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: cvode_mem
+integer(C_INT), intent(in) :: nt
+real(C_DOUBLE), dimension(*), target, intent(inout) :: t
+integer(C_INT), intent(in) :: k
+type(C_PTR) :: dky
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+type(C_PTR) :: farg3 
+integer(C_INT) :: farg4 
+type(C_PTR) :: farg5 
+
+farg1 = cvode_mem
+farg2 = nt
+farg3 = c_loc(t(1))
+farg4 = k
+farg5 = dky
+fresult = swigc_FCVodeGetDkyBatch(farg1, farg2, farg3, farg4, farg5)
+swig_result = fresult
+end function
+
 function FCVodeGetWorkSpace(cvode_mem, lenrw, leniw) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -4675,6 +4787,41 @@ fresult = swigc_FCVodeSetSensParams(farg1, farg2, farg3, farg4)
 swig_result = fresult
 end function
 
+function FCVodeSetSensNumThreads(cvode_mem, nthreads) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: cvode_mem
+integer(C_INT), intent(in) :: nthreads
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+
+farg1 = cvode_mem
+farg2 = nthreads
+fresult = swigc_FCVodeSetSensNumThreads(farg1, farg2)
+swig_result = fresult
+end function
+
+function FCVodeSetSensThreadData(cvode_mem, user_data, p) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: cvode_mem
+type(C_PTR), dimension(*), target, intent(inout) :: user_data
+type(C_PTR), dimension(*), target, intent(inout) :: p
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+type(C_PTR) :: farg2 
+type(C_PTR) :: farg3 
+
+farg1 = cvode_mem
+farg2 = c_loc(user_data(1))
+farg3 = c_loc(p(1))
+fresult = swigc_FCVodeSetSensThreadData(farg1, farg2, farg3)
+swig_result = fresult
+end function
+
 function FCVodeSetNonlinearSolverSensSim(cvode_mem, nls) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -5681,6 +5828,25 @@ fresult = swigc_FCVodeSetAdjNoSensi(farg1)
 swig_result = fresult
 end function
 
+function FCVodeSetAdjCompression(cvode_mem, ctype, tol) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: cvode_mem
+integer(SUNDataCompression), intent(in) :: ctype
+real(C_DOUBLE), intent(in) :: tol
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+real(C_DOUBLE) :: farg3 
+
+farg1 = cvode_mem
+farg2 = ctype
+farg3 = tol
+fresult = swigc_FCVodeSetAdjCompression(farg1, farg2, farg3)
+swig_result = fresult
+end function
+
 function FCVodeSetUserDataB(cvode_mem, which, user_datab) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -6197,6 +6363,25 @@ fresult = swigc_FCVodeGetAdjCheckPointsInfo(farg1, farg2)
 swig_result = fresult
 end function
 
+function FCVodeGetAdjCompressionStats(cvode_mem, ratio, decode_time) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: cvode_mem
+real(C_DOUBLE), dimension(*), target, intent(inout) :: ratio
+real(C_DOUBLE), dimension(*), target, intent(inout) :: decode_time
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+type(C_PTR) :: farg2 
+type(C_PTR) :: farg3 
+
+farg1 = cvode_mem
+farg2 = c_loc(ratio(1))
+farg3 = c_loc(decode_time(1))
+fresult = swigc_FCVodeGetAdjCompressionStats(farg1, farg2, farg3)
+swig_result = fresult
+end function
+
 function FCVodeSetJacTimesRhsFnB(cvode_mem, which, jtimesrhsfn) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -6652,6 +6837,22 @@ fresult = swigc_FCVodeSetJacFn(farg1, farg2)
 swig_result = fresult
 end function
 
+function FCVodeSetJacSparsityPattern(cvode_mem, s) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: cvode_mem
+type(SUNMatrix), target, intent(inout) :: s
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+type(C_PTR) :: farg2 
+
+farg1 = cvode_mem
+farg2 = c_loc(s)
+fresult = swigc_FCVodeSetJacSparsityPattern(farg1, farg2)
+swig_result = fresult
+end function
+
 function FCVodeSetJacEvalFrequency(cvode_mem, msbj) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -6700,6 +6901,25 @@ fresult = swigc_FCVodeSetDeltaGammaMaxBadJac(farg1, farg2)
 swig_result = fresult
 end function
 
+function FCVodeSetJacReuseOnReInit(cvode_mem, dtmax, dgmax) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: cvode_mem
+real(C_DOUBLE), intent(in) :: dtmax
+real(C_DOUBLE), intent(in) :: dgmax
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+real(C_DOUBLE) :: farg2 
+real(C_DOUBLE) :: farg3 
+
+farg1 = cvode_mem
+farg2 = dtmax
+farg3 = dgmax
+fresult = swigc_FCVodeSetJacReuseOnReInit(farg1, farg2, farg3)
+swig_result = fresult
+end function
+
 function FCVodeSetEpsLin(cvode_mem, eplifac) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -6770,6 +6990,22 @@ fresult = swigc_FCVodeSetJacTimes(farg1, farg2, farg3)
 swig_result = fresult
 end function
 
+function FCVodeSetJacTimesDirDeriv(cvode_mem, jtdir) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: cvode_mem
+type(C_FUNPTR), intent(in), value :: jtdir
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+type(C_FUNPTR) :: farg2 
+
+farg1 = cvode_mem
+farg2 = jtdir
+fresult = swigc_FCVodeSetJacTimesDirDeriv(farg1, farg2)
+swig_result = fresult
+end function
+
 function FCVodeSetLinSysFn(cvode_mem, linsys) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -165,8 +165,10 @@ module fida_mod
  integer(C_INT), parameter, public :: IDALS_SUNLS_FAIL = -9_C_INT
  public :: FIDASetLinearSolver
  public :: FIDASetJacFn
+ public :: FIDASetJacSparsityPattern
  public :: FIDASetPreconditioner
  public :: FIDASetJacTimes
+ public :: FIDASetJacTimesDirDeriv
  public :: FIDASetEpsLin
  public :: FIDASetLSNormFactor
  public :: FIDASetLinearSolutionScaling
@@ -1011,6 +1013,15 @@ type(C_FUNPTR), value :: farg2
 integer(C_INT) :: fresult
 end function
 
+function swigc_FIDASetJacSparsityPattern(farg1, farg2) &
+bind(C, name="_wrap_FIDASetJacSparsityPattern") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+type(C_PTR), value :: farg2
+integer(C_INT) :: fresult
+end function
+
 function swigc_FIDASetPreconditioner(farg1, farg2, farg3) &
 bind(C, name="_wrap_FIDASetPreconditioner") &
 result(fresult)
@@ -1031,6 +1042,15 @@ type(C_FUNPTR), value :: farg3
 integer(C_INT) :: fresult
 end function
 
+function swigc_FIDASetJacTimesDirDeriv(farg1, farg2) &
+bind(C, name="_wrap_FIDASetJacTimesDirDeriv") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+type(C_FUNPTR), value :: farg2
+integer(C_INT) :: fresult
+end function
+
 function swigc_FIDASetEpsLin(farg1, farg2) &
 bind(C, name="_wrap_FIDASetEpsLin") &
 result(fresult)
@@ -2727,6 +2747,22 @@ fresult = swigc_FIDASetJacFn(farg1, farg2)
 swig_result = fresult
 end function
 
+function FIDASetJacSparsityPattern(ida_mem, s) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: ida_mem
+type(SUNMatrix), target, intent(inout) :: s
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+type(C_PTR) :: farg2 
+
+farg1 = ida_mem
+farg2 = c_loc(s)
+fresult = swigc_FIDASetJacSparsityPattern(farg1, farg2)
+swig_result = fresult
+end function
+
 function FIDASetPreconditioner(ida_mem, pset, psolve) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -2765,6 +2801,22 @@ fresult = swigc_FIDASetJacTimes(farg1, farg2, farg3)
 swig_result = fresult
 end function
 
+function FIDASetJacTimesDirDeriv(ida_mem, jtdir) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: ida_mem
+type(C_FUNPTR), intent(in), value :: jtdir
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+type(C_FUNPTR) :: farg2 
+
+farg1 = ida_mem
+farg2 = jtdir
+fresult = swigc_FIDASetJacTimesDirDeriv(farg1, farg2)
+swig_result = fresult
+end function
+
 function FIDASetEpsLin(ida_mem, eplifac) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
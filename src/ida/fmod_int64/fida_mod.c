@@ -1527,6 +1527,20 @@ SWIGEXPORT int _wrap_FIDASetJacFn(void *farg1, IDALsJacFn farg2) {
 }
 
 
+SWIGEXPORT int _wrap_FIDASetJacSparsityPattern(void *farg1, SUNMatrix farg2) {
+  int fresult ;
+  void *arg1 = (void *) 0 ;
+  SUNMatrix arg2 = (SUNMatrix) 0 ;
+  int result;
+  
+  arg1 = (void *)(farg1);
+  arg2 = (SUNMatrix)(farg2);
+  result = (int)IDASetJacSparsityPattern(arg1,arg2);
+  fresult = (int)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FIDASetPreconditioner(void *farg1, IDALsPrecSetupFn farg2, IDALsPrecSolveFn farg3) {
   int fresult ;
   void *arg1 = (void *) 0 ;
@@ -1559,6 +1573,20 @@ SWIGEXPORT int _wrap_FIDASetJacTimes(void *farg1, IDALsJacTimesSetupFn farg2, ID
 }
 
 
+SWIGEXPORT int _wrap_FIDASetJacTimesDirDeriv(void *farg1, IDALsJacTimesDirDerivFn farg2) {
+  int fresult ;
+  void *arg1 = (void *) 0 ;
+  IDALsJacTimesDirDerivFn arg2 = (IDALsJacTimesDirDerivFn) 0 ;
+  int result;
+  
+  arg1 = (void *)(farg1);
+  arg2 = (IDALsJacTimesDirDerivFn)(farg2);
+  result = (int)IDASetJacTimesDirDeriv(arg1,arg2);
+  fresult = (int)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FIDASetEpsLin(void *farg1, double const *farg2) {
   int fresult ;
   void *arg1 = (void *) 0 ;
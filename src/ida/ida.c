@@ -220,6 +220,8 @@ static int IDANls(IDAMem IDA_mem);
 
 static int IDATestError(IDAMem IDA_mem, sunrealtype ck, sunrealtype* err_k,
                         sunrealtype* err_km1);
+static void IDAWrmsNormArray(IDAMem IDA_mem, int nvec, N_Vector* X,
+                             N_Vector* W, sunbooleantype mask, sunrealtype* nrm);
 
 /* Handling of convergence and/or error test failures */
 
@@ -2964,10 +2966,38 @@ static int IDATestError(IDAMem IDA_mem, sunrealtype ck, sunrealtype* err_k,
   sunrealtype err_km2;                       /* estimated error at k-2 */
   sunrealtype enorm_k, enorm_km1, enorm_km2; /* error norms */
   sunrealtype terr_k, terr_km1, terr_km2;    /* local truncation error norms */
+  sunrealtype enorm[3];                      /* batched error norms */
+  N_Vector X[3], W[3];                       /* batched norm vectors */
+  int nvec;
+
+  /* Form the error vectors for orders k, k-1 and k-2 (as applicable) so that
+     their norms can be computed with a single global reduction. */
+  nvec = 1;
+  X[0] = IDA_mem->ida_ee;
+  W[0] = IDA_mem->ida_ewt;
+
+  if (IDA_mem->ida_kk > 1)
+  {
+    N_VLinearSum(ONE, IDA_mem->ida_phi[IDA_mem->ida_kk], ONE, IDA_mem->ida_ee,
+                 IDA_mem->ida_delta);
+    X[nvec] = IDA_mem->ida_delta;
+    W[nvec] = IDA_mem->ida_ewt;
+    nvec++;
+
+    if (IDA_mem->ida_kk > 2)
+    {
+      N_VLinearSum(ONE, IDA_mem->ida_phi[IDA_mem->ida_kk - 1], ONE,
+                   IDA_mem->ida_delta, IDA_mem->ida_tempv1);
+      X[nvec] = IDA_mem->ida_tempv1;
+      W[nvec] = IDA_mem->ida_ewt;
+      nvec++;
+    }
+  }
+
+  IDAWrmsNormArray(IDA_mem, nvec, X, W, IDA_mem->ida_suppressalg, enorm);
 
   /* Compute error for order k. */
-  enorm_k = IDAWrmsNorm(IDA_mem, IDA_mem->ida_ee, IDA_mem->ida_ewt,
-                        IDA_mem->ida_suppressalg);
+  enorm_k = enorm[0];
   *err_k  = IDA_mem->ida_sigma[IDA_mem->ida_kk] * enorm_k;
   terr_k  = (IDA_mem->ida_kk + 1) * (*err_k);
 
@@ -2979,10 +3009,7 @@ static int IDATestError(IDAMem IDA_mem, sunrealtype ck, sunrealtype* err_k,
   if (IDA_mem->ida_kk > 1)
   {
     /* Compute error at order k-1 */
-    N_VLinearSum(ONE, IDA_mem->ida_phi[IDA_mem->ida_kk], ONE, IDA_mem->ida_ee,
-                 IDA_mem->ida_delta);
-    enorm_km1 = IDAWrmsNorm(IDA_mem, IDA_mem->ida_delta, IDA_mem->ida_ewt,
-                            IDA_mem->ida_suppressalg);
+    enorm_km1 = enorm[1];
     *err_km1  = IDA_mem->ida_sigma[IDA_mem->ida_kk - 1] * enorm_km1;
     terr_km1  = IDA_mem->ida_kk * (*err_km1);
 
@@ -2993,10 +3020,7 @@ static int IDATestError(IDAMem IDA_mem, sunrealtype ck, sunrealtype* err_k,
     if (IDA_mem->ida_kk > 2)
     {
       /* Compute error at order k-2 */
-      N_VLinearSum(ONE, IDA_mem->ida_phi[IDA_mem->ida_kk - 1], ONE,
-                   IDA_mem->ida_delta, IDA_mem->ida_delta);
-      enorm_km2 = IDAWrmsNorm(IDA_mem, IDA_mem->ida_delta, IDA_mem->ida_ewt,
-                              IDA_mem->ida_suppressalg);
+      enorm_km2 = enorm[2];
       err_km2   = IDA_mem->ida_sigma[IDA_mem->ida_kk - 2] * enorm_km2;
       terr_km2  = (IDA_mem->ida_kk - 1) * err_km2;
 
@@ -3527,6 +3551,25 @@ sunrealtype IDAWrmsNorm(IDAMem IDA_mem, N_Vector x, N_Vector w,
   return (nrm);
 }
 
+/*
+ * IDAWrmsNormArray
+ *
+ *  Computes the WRMS norms of the nvec vectors X[i] with weights W[i],
+ *  masked by id when mask = SUNTRUE (see IDAWrmsNorm). The norms are
+ *  computed with N_VWrmsNorm(Mask)VectorArray so that vectors which
+ *  support it need only a single global reduction for all of them.
+ */
+
+static void IDAWrmsNormArray(IDAMem IDA_mem, int nvec, N_Vector* X,
+                             N_Vector* W, sunbooleantype mask, sunrealtype* nrm)
+{
+  if (mask)
+  {
+    (void)N_VWrmsNormMaskVectorArray(nvec, X, W, IDA_mem->ida_id, nrm);
+  }
+  else { (void)N_VWrmsNormVectorArray(nvec, X, W, nrm); }
+}
+
 /*
  * -----------------------------------------------------------------
  * Functions for rootfinding
@@ -1920,6 +1920,36 @@ SWIGEXPORT int _wrap_FIDASetSensParams(void *farg1, double *farg2, double *farg3
 }
 
 
+SWIGEXPORT int _wrap_FIDASetSensNumThreads(void *farg1, int const *farg2) {
+  int fresult ;
+  void *arg1 = (void *) 0 ;
+  int arg2 ;
+  int result;
+  
+  arg1 = (void *)(farg1);
+  arg2 = (int)(*farg2);
+  result = (int)IDASetSensNumThreads(arg1,arg2);
+  fresult = (int)(result);
+  return fresult;
+}
+
+
+SWIGEXPORT int _wrap_FIDASetSensThreadData(void *farg1, void *farg2, void *farg3) {
+  int fresult ;
+  void *arg1 = (void *) 0 ;
+  void **arg2 = (void **) 0 ;
+  sunrealtype **arg3 = (sunrealtype **) 0 ;
+  int result;
+  
+  arg1 = (void *)(farg1);
+  arg2 = (void **)(farg2);
+  arg3 = (sunrealtype **)(farg3);
+  result = (int)IDASetSensThreadData(arg1,arg2,arg3);
+  fresult = (int)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FIDASetNonlinearSolverSensSim(void *farg1, SUNNonlinearSolver farg2) {
   int fresult ;
   void *arg1 = (void *) 0 ;
@@ -2748,6 +2778,22 @@ SWIGEXPORT int _wrap_FIDAAdjSetNoSensi(void *farg1) {
 }
 
 
+SWIGEXPORT int _wrap_FIDAAdjSetCompression(void *farg1, int const *farg2, double const *farg3) {
+  int fresult ;
+  void *arg1 = (void *) 0 ;
+  SUNDataCompression arg2 ;
+  sunrealtype arg3 ;
+  int result;
+  
+  arg1 = (void *)(farg1);
+  arg2 = (SUNDataCompression)(*farg2);
+  arg3 = (sunrealtype)(*farg3);
+  result = (int)IDAAdjSetCompression(arg1,arg2,arg3);
+  fresult = (int)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FIDASetUserDataB(void *farg1, int const *farg2, void *farg3) {
   int fresult ;
   void *arg1 = (void *) 0 ;
@@ -3226,6 +3272,22 @@ SWIGEXPORT int _wrap_FIDAGetAdjCheckPointsInfo(void *farg1, SwigClassWrapper con
 }
 
 
+SWIGEXPORT int _wrap_FIDAGetAdjCompressionStats(void *farg1, double *farg2, double *farg3) {
+  int fresult ;
+  void *arg1 = (void *) 0 ;
+  sunrealtype *arg2 = (sunrealtype *) 0 ;
+  sunrealtype *arg3 = (sunrealtype *) 0 ;
+  int result;
+  
+  arg1 = (void *)(farg1);
+  arg2 = (sunrealtype *)(farg2);
+  arg3 = (sunrealtype *)(farg3);
+  result = (int)IDAGetAdjCompressionStats(arg1,arg2,arg3);
+  fresult = (int)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FIDASetJacTimesResFnB(void *farg1, int const *farg2, IDAResFn farg3) {
   int fresult ;
   void *arg1 = (void *) 0 ;
@@ -3452,6 +3514,20 @@ SWIGEXPORT int _wrap_FIDASetJacFn(void *farg1, IDALsJacFn farg2) {
 }
 
 
+SWIGEXPORT int _wrap_FIDASetJacSparsityPattern(void *farg1, SUNMatrix farg2) {
+  int fresult ;
+  void *arg1 = (void *) 0 ;
+  SUNMatrix arg2 = (SUNMatrix) 0 ;
+  int result;
+  
+  arg1 = (void *)(farg1);
+  arg2 = (SUNMatrix)(farg2);
+  result = (int)IDASetJacSparsityPattern(arg1,arg2);
+  fresult = (int)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FIDASetPreconditioner(void *farg1, IDALsPrecSetupFn farg2, IDALsPrecSolveFn farg3) {
   int fresult ;
   void *arg1 = (void *) 0 ;
@@ -3484,6 +3560,20 @@ SWIGEXPORT int _wrap_FIDASetJacTimes(void *farg1, IDALsJacTimesSetupFn farg2, ID
 }
 
 
+SWIGEXPORT int _wrap_FIDASetJacTimesDirDeriv(void *farg1, IDALsJacTimesDirDerivFn farg2) {
+  int fresult ;
+  void *arg1 = (void *) 0 ;
+  IDALsJacTimesDirDerivFn arg2 = (IDALsJacTimesDirDerivFn) 0 ;
+  int result;
+  
+  arg1 = (void *)(farg1);
+  arg2 = (IDALsJacTimesDirDerivFn)(farg2);
+  result = (int)IDASetJacTimesDirDeriv(arg1,arg2);
+  fresult = (int)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FIDASetEpsLin(void *farg1, double const *farg2) {
   int fresult ;
   void *arg1 = (void *) 0 ;
@@ -201,6 +201,8 @@ module fidas_mod
  public :: FIDASetSensErrCon
  public :: FIDASetSensMaxNonlinIters
  public :: FIDASetSensParams
+ public :: FIDASetSensNumThreads
+ public :: FIDASetSensThreadData
  public :: FIDASetNonlinearSolverSensSim
  public :: FIDASetNonlinearSolverSensStg
  public :: FIDASensToggleOff
@@ -253,6 +255,7 @@ module fidas_mod
  public :: FIDASolveF
  public :: FIDASolveB
  public :: FIDAAdjSetNoSensi
+ public :: FIDAAdjSetCompression
  public :: FIDASetUserDataB
  public :: FIDASetMaxOrdB
  public :: FIDASetMaxNumStepsB
@@ -303,6 +306,7 @@ module fidas_mod
   module procedure swigf_create_IDAadjCheckPointRec
  end interface
  public :: FIDAGetAdjCheckPointsInfo
+ public :: FIDAGetAdjCompressionStats
  public :: FIDASetJacTimesResFnB
  public :: FIDAGetAdjDataPointHermite
  public :: FIDAGetAdjDataPointPolynomial
@@ -327,8 +331,10 @@ module fidas_mod
  integer(C_INT), parameter, public :: IDALS_LMEMB_NULL = -102_C_INT
  public :: FIDASetLinearSolver
  public :: FIDASetJacFn
+ public :: FIDASetJacSparsityPattern
  public :: FIDASetPreconditioner
  public :: FIDASetJacTimes
+ public :: FIDASetJacTimesDirDeriv
  public :: FIDASetEpsLin
  public :: FIDASetLSNormFactor
  public :: FIDASetLinearSolutionScaling
@@ -1385,6 +1391,25 @@ type(C_PTR), value :: farg4
 integer(C_INT) :: fresult
 end function
 
+function swigc_FIDASetSensNumThreads(farg1, farg2) &
+bind(C, name="_wrap_FIDASetSensNumThreads") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+integer(C_INT) :: fresult
+end function
+
+function swigc_FIDASetSensThreadData(farg1, farg2, farg3) &
+bind(C, name="_wrap_FIDASetSensThreadData") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+type(C_PTR), value :: farg2
+type(C_PTR), value :: farg3
+integer(C_INT) :: fresult
+end function
+
 function swigc_FIDASetNonlinearSolverSensSim(farg1, farg2) &
 bind(C, name="_wrap_FIDASetNonlinearSolverSensSim") &
 result(fresult)
@@ -1903,6 +1928,16 @@ type(C_PTR), value :: farg1
 integer(C_INT) :: fresult
 end function
 
+function swigc_FIDAAdjSetCompression(farg1, farg2, farg3) &
+bind(C, name="_wrap_FIDAAdjSetCompression") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+real(C_DOUBLE), intent(in) :: farg3
+integer(C_INT) :: fresult
+end function
+
 function swigc_FIDASetUserDataB(farg1, farg2, farg3) &
 bind(C, name="_wrap_FIDASetUserDataB") &
 result(fresult)
@@ -2219,6 +2254,16 @@ type(SwigClassWrapper) :: farg2
 integer(C_INT) :: fresult
 end function
 
+function swigc_FIDAGetAdjCompressionStats(farg1, farg2, farg3) &
+bind(C, name="_wrap_FIDAGetAdjCompressionStats") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+type(C_PTR), value :: farg2
+type(C_PTR), value :: farg3
+integer(C_INT) :: fresult
+end function
+
 function swigc_FIDASetJacTimesResFnB(farg1, farg2, farg3) &
 bind(C, name="_wrap_FIDASetJacTimesResFnB") &
 result(fresult)
@@ -2356,6 +2401,15 @@ type(C_FUNPTR), value :: farg2
 integer(C_INT) :: fresult
 end function
 
+function swigc_FIDASetJacSparsityPattern(farg1, farg2) &
+bind(C, name="_wrap_FIDASetJacSparsityPattern") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+type(C_PTR), value :: farg2
+integer(C_INT) :: fresult
+end function
+
 function swigc_FIDASetPreconditioner(farg1, farg2, farg3) &
 bind(C, name="_wrap_FIDASetPreconditioner") &
 result(fresult)
@@ -2376,6 +2430,15 @@ type(C_FUNPTR), value :: farg3
 integer(C_INT) :: fresult
 end function
 
+function swigc_FIDASetJacTimesDirDeriv(farg1, farg2) &
+bind(C, name="_wrap_FIDASetJacTimesDirDeriv") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+type(C_FUNPTR), value :: farg2
+integer(C_INT) :: fresult
+end function
+
 function swigc_FIDASetEpsLin(farg1, farg2) &
 bind(C, name="_wrap_FIDASetEpsLin") &
 result(fresult)
@@ -4562,6 +4625,41 @@ fresult = swigc_FIDASetSensParams(farg1, farg2, farg3, farg4)
 swig_result = fresult
 end function
 
+function FIDASetSensNumThreads(ida_mem, nthreads) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: ida_mem
+integer(C_INT), intent(in) :: nthreads
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+
+farg1 = ida_mem
+farg2 = nthreads
+fresult = swigc_FIDASetSensNumThreads(farg1, farg2)
+swig_result = fresult
+end function
+
+function FIDASetSensThreadData(ida_mem, user_data, p) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: ida_mem
+type(C_PTR), dimension(*), target, intent(inout) :: user_data
+type(C_PTR), dimension(*), target, intent(inout) :: p
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+type(C_PTR) :: farg2 
+type(C_PTR) :: farg3 
+
+farg1 = ida_mem
+farg2 = c_loc(user_data(1))
+farg3 = c_loc(p(1))
+fresult = swigc_FIDASetSensThreadData(farg1, farg2, farg3)
+swig_result = fresult
+end function
+
 function FIDASetNonlinearSolverSensSim(ida_mem, nls) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -5550,6 +5648,25 @@ fresult = swigc_FIDAAdjSetNoSensi(farg1)
 swig_result = fresult
 end function
 
+function FIDAAdjSetCompression(ida_mem, ctype, tol) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: ida_mem
+integer(SUNDataCompression), intent(in) :: ctype
+real(C_DOUBLE), intent(in) :: tol
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+real(C_DOUBLE) :: farg3 
+
+farg1 = ida_mem
+farg2 = ctype
+farg3 = tol
+fresult = swigc_FIDAAdjSetCompression(farg1, farg2, farg3)
+swig_result = fresult
+end function
+
 function FIDASetUserDataB(ida_mem, which, user_datab) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -6094,6 +6211,25 @@ fresult = swigc_FIDAGetAdjCheckPointsInfo(farg1, farg2)
 swig_result = fresult
 end function
 
+function FIDAGetAdjCompressionStats(ida_mem, ratio, decode_time) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: ida_mem
+real(C_DOUBLE), dimension(*), target, intent(inout) :: ratio
+real(C_DOUBLE), dimension(*), target, intent(inout) :: decode_time
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+type(C_PTR) :: farg2 
+type(C_PTR) :: farg3 
+
+farg1 = ida_mem
+farg2 = c_loc(ratio(1))
+farg3 = c_loc(decode_time(1))
+fresult = swigc_FIDAGetAdjCompressionStats(farg1, farg2, farg3)
+swig_result = fresult
+end function
+
 function FIDASetJacTimesResFnB(ida_mem, which, jtimesresfn) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -6373,6 +6509,22 @@ fresult = swigc_FIDASetJacFn(farg1, farg2)
 swig_result = fresult
 end function
 
+function FIDASetJacSparsityPattern(ida_mem, s) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: ida_mem
+type(SUNMatrix), target, intent(inout) :: s
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+type(C_PTR) :: farg2 
+
+farg1 = ida_mem
+farg2 = c_loc(s)
+fresult = swigc_FIDASetJacSparsityPattern(farg1, farg2)
+swig_result = fresult
+end function
+
 function FIDASetPreconditioner(ida_mem, pset, psolve) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -6411,6 +6563,22 @@ fresult = swigc_FIDASetJacTimes(farg1, farg2, farg3)
 swig_result = fresult
 end function
 
+function FIDASetJacTimesDirDeriv(ida_mem, jtdir) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: ida_mem
+type(C_FUNPTR), intent(in), value :: jtdir
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+type(C_FUNPTR) :: farg2 
+
+farg1 = ida_mem
+farg2 = jtdir
+fresult = swigc_FIDASetJacTimesDirDeriv(farg1, farg2)
+swig_result = fresult
+end function
+
 function FIDASetEpsLin(ida_mem, eplifac) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -77,6 +77,15 @@ static int IDAApolynomialStorePnt(IDAMem IDA_mem, IDAdtpntMem d);
 static int IDAApolynomialGetY(IDAMem IDA_mem, sunrealtype t, N_Vector yy,
                               N_Vector yp, N_Vector* yyS, N_Vector* ypS);
 
+static sunbooleantype IDAAcompressMalloc(IDAMem IDA_mem);
+static void IDAAcompressFree(IDAMem IDA_mem);
+static int IDAAcompressStorePnt(IDAMem IDA_mem, long int i, N_Vector y,
+                                N_Vector yd, N_Vector* yS, N_Vector* ySd);
+static int IDAAhermiteGetPnt(IDAMem IDA_mem, long int i, int NS, N_Vector* y,
+                             N_Vector* yd, N_Vector** yS, N_Vector** ySd);
+static int IDAApolynomialGetPnt(IDAMem IDA_mem, long int i, int NS, N_Vector y,
+                                N_Vector* yS);
+
 static int IDAAfindIndex(IDAMem ida_mem, sunrealtype t, long int* index,
                          sunbooleantype* newpoint);
 
@@ -107,6 +116,7 @@ int IDAAdjInit(void* ida_mem, long int steps, int interp)
 {
   IDAadjMem IDAADJ_mem;
   IDAMem IDA_mem;
+  int k;
 
   /* Check arguments */
 
@@ -206,6 +216,25 @@ int IDAAdjInit(void* ida_mem, long int steps, int interp)
   IDAADJ_mem->ia_interpSensi = SUNFALSE;
   IDAADJ_mem->ia_noInterp    = SUNFALSE;
 
+  /* By default the interpolation data is not compressed */
+  IDAADJ_mem->ia_ctype    = SUNDATACOMPRESSION_NONE;
+  IDAADJ_mem->ia_ctol     = ZERO;
+  IDAADJ_mem->ia_cy       = NULL;
+  IDAADJ_mem->ia_cyd      = NULL;
+  IDAADJ_mem->ia_cyS      = NULL;
+  IDAADJ_mem->ia_cySd     = NULL;
+  IDAADJ_mem->ia_cw       = NULL;
+  IDAADJ_mem->ia_cwS      = NULL;
+  IDAADJ_mem->ia_cidx[0]  = -1;
+  IDAADJ_mem->ia_cidx[1]  = -1;
+  IDAADJ_mem->ia_cidxS[0] = -1;
+  IDAADJ_mem->ia_cidxS[1] = -1;
+  for (k = 0; k < 4; k++)
+  {
+    IDAADJ_mem->ia_cvec[k]  = NULL;
+    IDAADJ_mem->ia_cvecS[k] = NULL;
+  }
+
   /* Initialize backward problems. */
   IDAADJ_mem->IDAB_mem    = NULL;
   IDAADJ_mem->ia_bckpbCrt = NULL;
@@ -2638,6 +2667,19 @@ static sunbooleantype IDAAhermiteMalloc(IDAMem IDA_mem)
       break;
     }
 
+    content->index = i;
+    content->y     = NULL;
+    content->yd    = NULL;
+    content->yS    = NULL;
+    content->ySd   = NULL;
+
+    /* With compressed storage the vectors are not needed */
+    if (IDAADJ_mem->ia_ctype != SUNDATACOMPRESSION_NONE)
+    {
+      dt_mem[i]->content = content;
+      continue;
+    }
+
     content->y = N_VClone(IDA_mem->ida_tempv1);
     if (content->y == NULL)
     {
@@ -2690,6 +2732,14 @@ static sunbooleantype IDAAhermiteMalloc(IDAMem IDA_mem)
     dt_mem[i]->content = content;
   }
 
+  /* Allocate the compressed storage */
+
+  if (allocOK && IDAADJ_mem->ia_ctype != SUNDATACOMPRESSION_NONE)
+  {
+    ii      = IDAADJ_mem->ia_nsteps + 1;
+    allocOK = IDAAcompressMalloc(IDA_mem);
+  }
+
   /* If an error occurred, deallocate and return */
 
   if (!allocOK)
@@ -2703,6 +2753,8 @@ static sunbooleantype IDAAhermiteMalloc(IDAMem IDA_mem)
       N_VDestroyVectorArray(IDAADJ_mem->ia_ypSTmp, IDA_mem->ida_Ns);
     }
 
+    IDAAcompressFree(IDA_mem);
+
     for (i = 0; i < ii; i++)
     {
       content = (IDAhermiteDataMem)(dt_mem[i]->content);
@@ -2747,6 +2799,8 @@ static void IDAAhermiteFree(IDAMem IDA_mem)
     N_VDestroyVectorArray(IDAADJ_mem->ia_ypSTmp, IDA_mem->ida_Ns);
   }
 
+  IDAAcompressFree(IDA_mem);
+
   dt_mem = IDAADJ_mem->dt_mem;
 
   for (i = 0; i <= IDAADJ_mem->ia_nsteps; i++)
@@ -2787,6 +2841,22 @@ static int IDAAhermiteStorePnt(IDAMem IDA_mem, IDAdtpntMem d)
 
   content = (IDAhermiteDataMem)d->content;
 
+  /* With compressed storage, compute the derivatives in workspace and
+     encode them together with the solution(s) */
+  if (IDAADJ_mem->ia_ctype != SUNDATACOMPRESSION_NONE)
+  {
+    IDAAGettnSolutionYp(IDA_mem, IDAADJ_mem->ia_cvec[1]);
+
+    if (IDAADJ_mem->ia_storeSensi)
+    {
+      IDAAGettnSolutionYpS(IDA_mem, IDAADJ_mem->ia_cvecS[1]);
+    }
+
+    return (IDAAcompressStorePnt(IDA_mem, content->index, IDA_mem->ida_phi[0],
+                                 IDAADJ_mem->ia_cvec[1], IDA_mem->ida_phiS[0],
+                                 IDAADJ_mem->ia_cvecS[1]));
+  }
+
   /* Load solution(s) */
   N_VScale(ONE, IDA_mem->ida_phi[0], content->y);
 
@@ -2825,7 +2895,6 @@ static int IDAAhermiteGetY(IDAMem IDA_mem, sunrealtype t, N_Vector yy,
 {
   IDAadjMem IDAADJ_mem;
   IDAdtpntMem* dt_mem;
-  IDAhermiteDataMem content0, content1;
 
   sunrealtype t0, t1, delta;
   sunrealtype factor1, factor2, factor3;
@@ -2858,18 +2927,20 @@ static int IDAAhermiteGetY(IDAMem IDA_mem, sunrealtype t, N_Vector yy,
 
   if (index == 0)
   {
-    content0 = (IDAhermiteDataMem)(dt_mem[0]->content);
-    N_VScale(ONE, content0->y, yy);
-    N_VScale(ONE, content0->yd, yp);
+    flag = IDAAhermiteGetPnt(IDA_mem, 0, NS, &y0, &yd0, &yS0, &ySd0);
+    if (flag != IDA_SUCCESS) { return (flag); }
+
+    N_VScale(ONE, y0, yy);
+    N_VScale(ONE, yd0, yp);
 
     if (NS > 0)
     {
       for (is = 0; is < NS; is++) { IDA_mem->ida_cvals[is] = ONE; }
 
-      retval = N_VScaleVectorArray(NS, IDA_mem->ida_cvals, content0->yS, yyS);
+      retval = N_VScaleVectorArray(NS, IDA_mem->ida_cvals, yS0, yyS);
       if (retval != IDA_SUCCESS) { return (IDA_VECTOROP_ERR); }
 
-      retval = N_VScaleVectorArray(NS, IDA_mem->ida_cvals, content0->ySd, ypS);
+      retval = N_VScaleVectorArray(NS, IDA_mem->ida_cvals, ySd0, ypS);
       if (retval != IDA_SUCCESS) { return (IDA_VECTOROP_ERR); }
     }
 
@@ -2881,22 +2952,14 @@ static int IDAAhermiteGetY(IDAMem IDA_mem, sunrealtype t, N_Vector yy,
   t1    = dt_mem[index]->t;
   delta = t1 - t0;
 
-  content0 = (IDAhermiteDataMem)(dt_mem[index - 1]->content);
-  y0       = content0->y;
-  yd0      = content0->yd;
-  if (IDAADJ_mem->ia_interpSensi)
-  {
-    yS0  = content0->yS;
-    ySd0 = content0->ySd;
-  }
+  flag = IDAAhermiteGetPnt(IDA_mem, index - 1, NS, &y0, &yd0, &yS0, &ySd0);
+  if (flag != IDA_SUCCESS) { return (flag); }
 
   if (newpoint)
   {
     /* Recompute Y0 and Y1 */
-    content1 = (IDAhermiteDataMem)(dt_mem[index]->content);
-
-    y1  = content1->y;
-    yd1 = content1->yd;
+    flag = IDAAhermiteGetPnt(IDA_mem, index, NS, &y1, &yd1, &yS1, &ySd1);
+    if (flag != IDA_SUCCESS) { return (flag); }
 
     /* Y1 = delta (yd1 + yd0) - 2 (y1 - y0) */
     cvals[0] = -TWO;
@@ -2926,9 +2989,6 @@ static int IDAAhermiteGetY(IDAMem IDA_mem, sunrealtype t, N_Vector yy,
 
     if (NS > 0)
     {
-      yS1  = content1->yS;
-      ySd1 = content1->ySd;
-
       /* YS1 = delta (ySd1 + ySd0) - 2 (yS1 - yS0) */
       cvals[0]  = -TWO;
       XXvecs[0] = yS1;
@@ -3101,14 +3161,23 @@ static sunbooleantype IDAApolynomialMalloc(IDAMem IDA_mem)
       break;
     }
 
-    content->y = N_VClone(IDA_mem->ida_tempv1);
-    if (content->y == NULL)
+    content->index = i;
+    content->y     = NULL;
+    content->yS    = NULL;
+
+    /* With compressed storage y and yS are not needed (the derivatives at
+       the first data point are still stored uncompressed) */
+    if (IDAADJ_mem->ia_ctype == SUNDATACOMPRESSION_NONE)
     {
-      free(content);
-      content = NULL;
-      ii      = i;
-      allocOK = SUNFALSE;
-      break;
+      content->y = N_VClone(IDA_mem->ida_tempv1);
+      if (content->y == NULL)
+      {
+        free(content);
+        content = NULL;
+        ii      = i;
+        allocOK = SUNFALSE;
+        break;
+      }
     }
 
     /* Allocate space for yp also. Needed for the most left point interpolation. */
@@ -3134,16 +3203,19 @@ static sunbooleantype IDAApolynomialMalloc(IDAMem IDA_mem)
 
     if (IDAADJ_mem->ia_storeSensi)
     {
-      content->yS = N_VCloneVectorArray(IDA_mem->ida_Ns, IDA_mem->ida_tempv1);
-      if (content->yS == NULL)
+      if (IDAADJ_mem->ia_ctype == SUNDATACOMPRESSION_NONE)
       {
-        N_VDestroy(content->y);
-        if (content->yd) { N_VDestroy(content->yd); }
-        free(content);
-        content = NULL;
-        ii      = i;
-        allocOK = SUNFALSE;
-        break;
+        content->yS = N_VCloneVectorArray(IDA_mem->ida_Ns, IDA_mem->ida_tempv1);
+        if (content->yS == NULL)
+        {
+          N_VDestroy(content->y);
+          if (content->yd) { N_VDestroy(content->yd); }
+          free(content);
+          content = NULL;
+          ii      = i;
+          allocOK = SUNFALSE;
+          break;
+        }
       }
 
       if (i == 0)
@@ -3166,6 +3238,13 @@ static sunbooleantype IDAApolynomialMalloc(IDAMem IDA_mem)
     dt_mem[i]->content = content;
   }
 
+  /* Allocate the compressed storage */
+  if (allocOK && IDAADJ_mem->ia_ctype != SUNDATACOMPRESSION_NONE)
+  {
+    ii      = IDAADJ_mem->ia_nsteps + 1;
+    allocOK = IDAAcompressMalloc(IDA_mem);
+  }
+
   /* If an error occurred, deallocate and return */
   if (!allocOK)
   {
@@ -3177,6 +3256,8 @@ static sunbooleantype IDAApolynomialMalloc(IDAMem IDA_mem)
       N_VDestroyVectorArray(IDAADJ_mem->ia_ypSTmp, IDA_mem->ida_Ns);
     }
 
+    IDAAcompressFree(IDA_mem);
+
     for (i = 0; i < ii; i++)
     {
       content = (IDApolynomialDataMem)(dt_mem[i]->content);
@@ -3224,6 +3305,8 @@ static void IDAApolynomialFree(IDAMem IDA_mem)
     N_VDestroyVectorArray(IDAADJ_mem->ia_ypSTmp, IDA_mem->ida_Ns);
   }
 
+  IDAAcompressFree(IDA_mem);
+
   dt_mem = IDAADJ_mem->dt_mem;
 
   for (i = 0; i <= IDAADJ_mem->ia_nsteps; i++)
@@ -3272,12 +3355,26 @@ static int IDAApolynomialStorePnt(IDAMem IDA_mem, IDAdtpntMem d)
   IDAADJ_mem = IDA_mem->ida_adj_mem;
   content    = (IDApolynomialDataMem)d->content;
 
-  N_VScale(ONE, IDA_mem->ida_phi[0], content->y);
+  content->order = IDA_mem->ida_kused;
 
   /* copy also the derivative for the first data point (in this case
      content->yp is non-null). */
   if (content->yd) { IDAAGettnSolutionYp(IDA_mem, content->yd); }
 
+  /* store the sensitivity derivatives if it is the first data point. */
+  if (IDAADJ_mem->ia_storeSensi && content->ySd)
+  {
+    IDAAGettnSolutionYpS(IDA_mem, content->ySd);
+  }
+
+  if (IDAADJ_mem->ia_ctype != SUNDATACOMPRESSION_NONE)
+  {
+    return (IDAAcompressStorePnt(IDA_mem, content->index, IDA_mem->ida_phi[0],
+                                 NULL, IDA_mem->ida_phiS[0], NULL));
+  }
+
+  N_VScale(ONE, IDA_mem->ida_phi[0], content->y);
+
   if (IDAADJ_mem->ia_storeSensi)
   {
     for (is = 0; is < IDA_mem->ida_Ns; is++) { IDA_mem->ida_cvals[is] = ONE; }
@@ -3285,13 +3382,8 @@ static int IDAApolynomialStorePnt(IDAMem IDA_mem, IDAdtpntMem d)
     retval = N_VScaleVectorArray(IDA_mem->ida_Ns, IDA_mem->ida_cvals,
                                  IDA_mem->ida_phiS[0], content->yS);
     if (retval != IDA_SUCCESS) { return (IDA_VECTOROP_ERR); }
-
-    /* store the derivative if it is the first data point. */
-    if (content->ySd) { IDAAGettnSolutionYpS(IDA_mem, content->ySd); }
   }
 
-  content->order = IDA_mem->ida_kused;
-
   return (0);
 }
 
@@ -3331,17 +3423,16 @@ static int IDAApolynomialGetY(IDAMem IDA_mem, sunrealtype t, N_Vector yy,
 
   if (index == 0)
   {
+    flag = IDAApolynomialGetPnt(IDA_mem, 0, NS, yy, yyS);
+    if (flag != IDA_SUCCESS) { return (flag); }
+
     content = (IDApolynomialDataMem)(dt_mem[0]->content);
-    N_VScale(ONE, content->y, yy);
     N_VScale(ONE, content->yd, yp);
 
     if (NS > 0)
     {
       for (is = 0; is < NS; is++) { IDA_mem->ida_cvals[is] = ONE; }
 
-      retval = N_VScaleVectorArray(NS, IDA_mem->ida_cvals, content->yS, yyS);
-      if (retval != IDA_SUCCESS) { return (IDA_VECTOROP_ERR); }
-
       retval = N_VScaleVectorArray(NS, IDA_mem->ida_cvals, content->ySd, ypS);
       if (retval != IDA_SUCCESS) { return (IDA_VECTOROP_ERR); }
     }
@@ -3385,34 +3476,20 @@ static int IDAApolynomialGetY(IDAMem IDA_mem, sunrealtype t, N_Vector yy,
     {
       for (j = 0; j <= order; j++)
       {
+        flag = IDAApolynomialGetPnt(IDA_mem, base - j, NS, IDAADJ_mem->ia_Y[j],
+                                    IDAADJ_mem->ia_YS[j]);
+        if (flag != IDA_SUCCESS) { return (flag); }
         IDAADJ_mem->ia_T[j] = dt_mem[base - j]->t;
-        content             = (IDApolynomialDataMem)(dt_mem[base - j]->content);
-        N_VScale(ONE, content->y, IDAADJ_mem->ia_Y[j]);
-
-        if (NS > 0)
-        {
-          for (is = 0; is < NS; is++) { IDA_mem->ida_cvals[is] = ONE; }
-          retval = N_VScaleVectorArray(NS, IDA_mem->ida_cvals, content->yS,
-                                       IDAADJ_mem->ia_YS[j]);
-          if (retval != IDA_SUCCESS) { return (IDA_VECTOROP_ERR); }
-        }
       }
     }
     else
     {
       for (j = 0; j <= order; j++)
       {
+        flag = IDAApolynomialGetPnt(IDA_mem, base - 1 + j, NS,
+                                    IDAADJ_mem->ia_Y[j], IDAADJ_mem->ia_YS[j]);
+        if (flag != IDA_SUCCESS) { return (flag); }
         IDAADJ_mem->ia_T[j] = dt_mem[base - 1 + j]->t;
-        content = (IDApolynomialDataMem)(dt_mem[base - 1 + j]->content);
-        N_VScale(ONE, content->y, IDAADJ_mem->ia_Y[j]);
-
-        if (NS > 0)
-        {
-          for (is = 0; is < NS; is++) { IDA_mem->ida_cvals[is] = ONE; }
-          retval = N_VScaleVectorArray(NS, IDA_mem->ida_cvals, content->yS,
-                                       IDAADJ_mem->ia_YS[j]);
-          if (retval != IDA_SUCCESS) { return (IDA_VECTOROP_ERR); }
-        }
       }
     }
 
@@ -3496,6 +3573,363 @@ static int IDAApolynomialGetY(IDAMem IDA_mem, sunrealtype t, N_Vector yy,
   return (IDA_SUCCESS);
 }
 
+/*
+ * -----------------------------------------------------------------
+ * Functions for compressed storage of the interpolation data
+ * -----------------------------------------------------------------
+ */
+
+/*
+ * IDAAcompressMalloc
+ *
+ * This routine allocates the compressed stores for the data points
+ * and the workspace used to encode and decode them.
+ */
+
+static sunbooleantype IDAAcompressMalloc(IDAMem IDA_mem)
+{
+  IDAadjMem IDAADJ_mem;
+  sunbooleantype hermite;
+  long int nslots;
+  int is, k;
+
+  IDAADJ_mem = IDA_mem->ida_adj_mem;
+  hermite    = (IDAADJ_mem->ia_interpType == IDA_HERMITE);
+  nslots     = IDAADJ_mem->ia_nsteps + 1;
+
+  if (SUNCompressStore_Create(IDAADJ_mem->ia_ctype, nslots,
+                              IDA_mem->ida_tempv1, &IDAADJ_mem->ia_cy))
+  {
+    return (SUNFALSE);
+  }
+
+  IDAADJ_mem->ia_cw = N_VClone(IDA_mem->ida_tempv1);
+  if (IDAADJ_mem->ia_cw == NULL) { return (SUNFALSE); }
+
+  if (hermite)
+  {
+    if (SUNCompressStore_Create(IDAADJ_mem->ia_ctype, nslots,
+                                IDA_mem->ida_tempv1, &IDAADJ_mem->ia_cyd))
+    {
+      return (SUNFALSE);
+    }
+
+    for (k = 0; k < 4; k++)
+    {
+      IDAADJ_mem->ia_cvec[k] = N_VClone(IDA_mem->ida_tempv1);
+      if (IDAADJ_mem->ia_cvec[k] == NULL) { return (SUNFALSE); }
+    }
+  }
+
+  if (IDAADJ_mem->ia_storeSensi)
+  {
+    IDAADJ_mem->ia_cyS = (SUNCompressStore*)calloc(IDA_mem->ida_Ns,
+                                                   sizeof(SUNCompressStore));
+    if (IDAADJ_mem->ia_cyS == NULL) { return (SUNFALSE); }
+
+    for (is = 0; is < IDA_mem->ida_Ns; is++)
+    {
+      if (SUNCompressStore_Create(IDAADJ_mem->ia_ctype, nslots,
+                                  IDA_mem->ida_tempv1, &IDAADJ_mem->ia_cyS[is]))
+      {
+        return (SUNFALSE);
+      }
+    }
+
+    IDAADJ_mem->ia_cwS = N_VCloneVectorArray(IDA_mem->ida_Ns,
+                                             IDA_mem->ida_tempv1);
+    if (IDAADJ_mem->ia_cwS == NULL) { return (SUNFALSE); }
+
+    if (hermite)
+    {
+      IDAADJ_mem->ia_cySd = (SUNCompressStore*)calloc(IDA_mem->ida_Ns,
+                                                      sizeof(SUNCompressStore));
+      if (IDAADJ_mem->ia_cySd == NULL) { return (SUNFALSE); }
+
+      for (is = 0; is < IDA_mem->ida_Ns; is++)
+      {
+        if (SUNCompressStore_Create(IDAADJ_mem->ia_ctype, nslots,
+                                    IDA_mem->ida_tempv1,
+                                    &IDAADJ_mem->ia_cySd[is]))
+        {
+          return (SUNFALSE);
+        }
+      }
+
+      for (k = 0; k < 4; k++)
+      {
+        IDAADJ_mem->ia_cvecS[k] = N_VCloneVectorArray(IDA_mem->ida_Ns,
+                                                      IDA_mem->ida_tempv1);
+        if (IDAADJ_mem->ia_cvecS[k] == NULL) { return (SUNFALSE); }
+      }
+    }
+  }
+
+  IDAADJ_mem->ia_cidx[0]  = -1;
+  IDAADJ_mem->ia_cidx[1]  = -1;
+  IDAADJ_mem->ia_cidxS[0] = -1;
+  IDAADJ_mem->ia_cidxS[1] = -1;
+
+  return (SUNTRUE);
+}
+
+/*
+ * IDAAcompressFree
+ *
+ * This routine frees the memory allocated by IDAAcompressMalloc. It
+ * may be called on a partially allocated set of stores.
+ */
+
+static void IDAAcompressFree(IDAMem IDA_mem)
+{
+  IDAadjMem IDAADJ_mem;
+  int is, k;
+
+  IDAADJ_mem = IDA_mem->ida_adj_mem;
+
+  SUNCompressStore_Destroy(&IDAADJ_mem->ia_cy);
+  SUNCompressStore_Destroy(&IDAADJ_mem->ia_cyd);
+
+  if (IDAADJ_mem->ia_cyS != NULL)
+  {
+    for (is = 0; is < IDA_mem->ida_Ns; is++)
+    {
+      SUNCompressStore_Destroy(&IDAADJ_mem->ia_cyS[is]);
+    }
+    free(IDAADJ_mem->ia_cyS);
+    IDAADJ_mem->ia_cyS = NULL;
+  }
+
+  if (IDAADJ_mem->ia_cySd != NULL)
+  {
+    for (is = 0; is < IDA_mem->ida_Ns; is++)
+    {
+      SUNCompressStore_Destroy(&IDAADJ_mem->ia_cySd[is]);
+    }
+    free(IDAADJ_mem->ia_cySd);
+    IDAADJ_mem->ia_cySd = NULL;
+  }
+
+  N_VDestroy(IDAADJ_mem->ia_cw);
+  IDAADJ_mem->ia_cw = NULL;
+
+  if (IDAADJ_mem->ia_cwS != NULL)
+  {
+    N_VDestroyVectorArray(IDAADJ_mem->ia_cwS, IDA_mem->ida_Ns);
+    IDAADJ_mem->ia_cwS = NULL;
+  }
+
+  for (k = 0; k < 4; k++)
+  {
+    N_VDestroy(IDAADJ_mem->ia_cvec[k]);
+    IDAADJ_mem->ia_cvec[k] = NULL;
+
+    if (IDAADJ_mem->ia_cvecS[k] != NULL)
+    {
+      N_VDestroyVectorArray(IDAADJ_mem->ia_cvecS[k], IDA_mem->ida_Ns);
+      IDAADJ_mem->ia_cvecS[k] = NULL;
+    }
+  }
+}
+
+/*
+ * IDAAcompressStorePnt
+ *
+ * This routine encodes y (and yd, yS, ySd if not NULL) into the slot
+ * i of the compressed stores. The error bound ia_ctol is relative to
+ * the error weights of the forward problem at the data point; the
+ * bound on the derivatives is scaled by the step size so that their
+ * contribution to the Hermite interpolant is bounded in the same way.
+ * If the weights cannot be computed the data is stored losslessly.
+ */
+
+static int IDAAcompressStorePnt(IDAMem IDA_mem, long int i, N_Vector y,
+                                N_Vector yd, N_Vector* yS, N_Vector* ySd)
+{
+  IDAadjMem IDAADJ_mem;
+  sunrealtype tol, tolS, hd;
+  int is;
+
+  IDAADJ_mem = IDA_mem->ida_adj_mem;
+
+  /* The slot is overwritten, invalidate the decoded copies */
+
+  for (is = 0; is < 2; is++)
+  {
+    if (IDAADJ_mem->ia_cidx[is] == i) { IDAADJ_mem->ia_cidx[is] = -1; }
+    if (IDAADJ_mem->ia_cidxS[is] == i) { IDAADJ_mem->ia_cidxS[is] = -1; }
+  }
+
+  /* The first data point is stored before the error weight function is set
+     up by IDASolve and is stored without loss */
+  tol = IDAADJ_mem->ia_ctol;
+  if (IDAADJ_mem->ia_firstIDAFcall ||
+      IDA_mem->ida_efun(y, IDAADJ_mem->ia_cw, IDA_mem->ida_edata) != 0)
+  {
+    tol = ZERO;
+  }
+
+  if (SUNCompressStore_Insert(IDAADJ_mem->ia_cy, i, y, IDAADJ_mem->ia_cw, tol))
+  {
+    return (IDA_MEM_FAIL);
+  }
+
+  hd = SUNMAX(SUNRabs(IDA_mem->ida_hused), SUNRabs(IDA_mem->ida_hh));
+
+  if (yd != NULL)
+  {
+    N_VScale(hd, IDAADJ_mem->ia_cw, IDAADJ_mem->ia_cw);
+    if (SUNCompressStore_Insert(IDAADJ_mem->ia_cyd, i, yd, IDAADJ_mem->ia_cw,
+                                (hd > ZERO) ? tol : ZERO))
+    {
+      return (IDA_MEM_FAIL);
+    }
+  }
+
+  if (!IDAADJ_mem->ia_storeSensi) { return (IDA_SUCCESS); }
+
+  tolS = IDAADJ_mem->ia_ctol;
+  if (IDAADJ_mem->ia_firstIDAFcall ||
+      IDASensEwtSet(IDA_mem, yS, IDAADJ_mem->ia_cwS) != 0)
+  {
+    tolS = ZERO;
+  }
+
+  for (is = 0; is < IDA_mem->ida_Ns; is++)
+  {
+    if (SUNCompressStore_Insert(IDAADJ_mem->ia_cyS[is], i, yS[is],
+                                IDAADJ_mem->ia_cwS[is], tolS))
+    {
+      return (IDA_MEM_FAIL);
+    }
+
+    if (ySd != NULL)
+    {
+      N_VScale(hd, IDAADJ_mem->ia_cwS[is], IDAADJ_mem->ia_cwS[is]);
+      if (SUNCompressStore_Insert(IDAADJ_mem->ia_cySd[is], i, ySd[is],
+                                  IDAADJ_mem->ia_cwS[is],
+                                  (hd > ZERO) ? tolS : ZERO))
+      {
+        return (IDA_MEM_FAIL);
+      }
+    }
+  }
+
+  return (IDA_SUCCESS);
+}
+
+/*
+ * IDAAhermiteGetPnt
+ *
+ * This routine returns the solution and derivative (and the first NS
+ * sensitivities and their derivatives) at the data point i. With
+ * compressed storage the data is decoded into one of two workspaces,
+ * selected by the parity of i so that two consecutive points can be
+ * held at once, and is only decoded again when i changes.
+ */
+
+static int IDAAhermiteGetPnt(IDAMem IDA_mem, long int i, int NS, N_Vector* y,
+                             N_Vector* yd, N_Vector** yS, N_Vector** ySd)
+{
+  IDAadjMem IDAADJ_mem;
+  IDAhermiteDataMem content;
+  int is, k;
+
+  IDAADJ_mem = IDA_mem->ida_adj_mem;
+
+  if (IDAADJ_mem->ia_ctype == SUNDATACOMPRESSION_NONE)
+  {
+    content = (IDAhermiteDataMem)(IDAADJ_mem->dt_mem[i]->content);
+    *y      = content->y;
+    *yd     = content->yd;
+    *yS     = content->yS;
+    *ySd    = content->ySd;
+    return (IDA_SUCCESS);
+  }
+
+  k    = (int)(i % 2);
+  *y   = IDAADJ_mem->ia_cvec[2 * k];
+  *yd  = IDAADJ_mem->ia_cvec[2 * k + 1];
+  *yS  = IDAADJ_mem->ia_cvecS[2 * k];
+  *ySd = IDAADJ_mem->ia_cvecS[2 * k + 1];
+
+  if (IDAADJ_mem->ia_cidx[k] != i)
+  {
+    if (SUNCompressStore_Load(IDAADJ_mem->ia_cy, i, *y) ||
+        SUNCompressStore_Load(IDAADJ_mem->ia_cyd, i, *yd))
+    {
+      IDAADJ_mem->ia_cidx[k] = -1;
+      return (IDA_VECTOROP_ERR);
+    }
+    IDAADJ_mem->ia_cidx[k]  = i;
+    IDAADJ_mem->ia_cidxS[k] = -1;
+  }
+
+  if (NS > 0 && IDAADJ_mem->ia_cidxS[k] != i)
+  {
+    for (is = 0; is < IDA_mem->ida_Ns; is++)
+    {
+      if (SUNCompressStore_Load(IDAADJ_mem->ia_cyS[is], i, (*yS)[is]) ||
+          SUNCompressStore_Load(IDAADJ_mem->ia_cySd[is], i, (*ySd)[is]))
+      {
+        IDAADJ_mem->ia_cidxS[k] = -1;
+        return (IDA_VECTOROP_ERR);
+      }
+    }
+    IDAADJ_mem->ia_cidxS[k] = i;
+  }
+
+  return (IDA_SUCCESS);
+}
+
+/*
+ * IDAApolynomialGetPnt
+ *
+ * This routine copies the solution (and the first NS sensitivities)
+ * at the data point i into y (and yS), decoding it if the data is
+ * compressed.
+ */
+
+static int IDAApolynomialGetPnt(IDAMem IDA_mem, long int i, int NS, N_Vector y,
+                                N_Vector* yS)
+{
+  IDAadjMem IDAADJ_mem;
+  IDApolynomialDataMem content;
+  int is, retval;
+
+  IDAADJ_mem = IDA_mem->ida_adj_mem;
+
+  if (IDAADJ_mem->ia_ctype != SUNDATACOMPRESSION_NONE)
+  {
+    if (SUNCompressStore_Load(IDAADJ_mem->ia_cy, i, y))
+    {
+      return (IDA_VECTOROP_ERR);
+    }
+
+    for (is = 0; is < NS; is++)
+    {
+      if (SUNCompressStore_Load(IDAADJ_mem->ia_cyS[is], i, yS[is]))
+      {
+        return (IDA_VECTOROP_ERR);
+      }
+    }
+
+    return (IDA_SUCCESS);
+  }
+
+  content = (IDApolynomialDataMem)(IDAADJ_mem->dt_mem[i]->content);
+  N_VScale(ONE, content->y, y);
+
+  if (NS > 0)
+  {
+    for (is = 0; is < NS; is++) { IDA_mem->ida_cvals[is] = ONE; }
+    retval = N_VScaleVectorArray(NS, IDA_mem->ida_cvals, content->yS, yS);
+    if (retval != IDA_SUCCESS) { return (IDA_VECTOROP_ERR); }
+  }
+
+  return (IDA_SUCCESS);
+}
+
 /*
  * IDAAGettnSolutionYp
  *
@@ -41,7 +41,8 @@
  * =================================================================
  */
 
-#define ONE SUN_RCONST(1.0)
+#define ZERO SUN_RCONST(0.0)
+#define ONE  SUN_RCONST(1.0)
 
 /*
  * -----------------------------------------------------------------
@@ -85,6 +86,80 @@ int IDAAdjSetNoSensi(void* ida_mem)
   return (IDA_SUCCESS);
 }
 
+/*
+ * -----------------------------------------------------------------
+ * IDAAdjSetCompression
+ * -----------------------------------------------------------------
+ * Selects the compression of the data stored for interpolation of
+ * the forward solution.
+ * -----------------------------------------------------------------
+ */
+
+int IDAAdjSetCompression(void* ida_mem, SUNDataCompression ctype,
+                         sunrealtype tol)
+{
+  IDAMem IDA_mem;
+  IDAadjMem IDAADJ_mem;
+
+  /* Is ida_mem valid? */
+  if (ida_mem == NULL)
+  {
+    IDAProcessError(NULL, IDA_MEM_NULL, __LINE__, __func__, __FILE__,
+                    MSGAM_NULL_IDAMEM);
+    return IDA_MEM_NULL;
+  }
+  IDA_mem = (IDAMem)ida_mem;
+
+  /* Is ASA initialized? */
+  if (IDA_mem->ida_adjMallocDone == SUNFALSE)
+  {
+    IDAProcessError(IDA_mem, IDA_NO_ADJ, __LINE__, __func__, __FILE__,
+                    MSGAM_NO_ADJ);
+    return (IDA_NO_ADJ);
+  }
+  IDAADJ_mem = IDA_mem->ida_adj_mem;
+
+  if ((ctype != SUNDATACOMPRESSION_NONE) &&
+      (ctype != SUNDATACOMPRESSION_FLOAT) &&
+      (ctype != SUNDATACOMPRESSION_QUANTIZE) &&
+      (ctype != SUNDATACOMPRESSION_DELTA))
+  {
+    IDAProcessError(IDA_mem, IDA_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    MSGAM_BAD_CTYPE);
+    return (IDA_ILL_INPUT);
+  }
+
+  if ((ctype == SUNDATACOMPRESSION_QUANTIZE ||
+       ctype == SUNDATACOMPRESSION_DELTA) &&
+      tol <= ZERO)
+  {
+    IDAProcessError(IDA_mem, IDA_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    MSGAM_BAD_CTOL);
+    return (IDA_ILL_INPUT);
+  }
+
+  /* The data point storage is allocated in the first call to IDASolveF */
+  if (IDAADJ_mem->ia_mallocDone)
+  {
+    IDAProcessError(IDA_mem, IDA_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    MSGAM_CMP_SET);
+    return (IDA_ILL_INPUT);
+  }
+
+  if (ctype != SUNDATACOMPRESSION_NONE &&
+      !SUNCompress_VectorSupported(IDA_mem->ida_tempv1))
+  {
+    IDAProcessError(IDA_mem, IDA_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    MSGAM_CMP_NVECTOR);
+    return (IDA_ILL_INPUT);
+  }
+
+  IDAADJ_mem->ia_ctype = ctype;
+  IDAADJ_mem->ia_ctol  = tol;
+
+  return (IDA_SUCCESS);
+}
+
 /*
  * -----------------------------------------------------------------
  * Optional input functions for backward integration
@@ -670,6 +745,82 @@ int IDAGetAdjCheckPointsInfo(void* ida_mem, IDAadjCheckPointRec* ckpnt)
   return (IDA_SUCCESS);
 }
 
+/* Add the statistics of a compressed store (may be NULL) to the totals */
+static void IDAAcompressStats(SUNCompressStore store, size_t* raw_bytes,
+                              size_t* stored_bytes, double* time)
+{
+  if (store == NULL) { return; }
+
+  *raw_bytes += store->raw_bytes;
+  *stored_bytes += store->stored_bytes;
+  *time += store->decode_time;
+}
+
+/*
+ * IDAGetAdjCompressionStats
+ *
+ * Returns the ratio of the uncompressed to the compressed size of the
+ * stored interpolation data and the time spent decoding it.
+ */
+
+int IDAGetAdjCompressionStats(void* ida_mem, sunrealtype* ratio,
+                              sunrealtype* decode_time)
+{
+  IDAMem IDA_mem;
+  IDAadjMem IDAADJ_mem;
+  size_t raw_bytes, stored_bytes;
+  double time;
+  int is;
+
+  /* Is ida_mem valid? */
+  if (ida_mem == NULL)
+  {
+    IDAProcessError(NULL, IDA_MEM_NULL, __LINE__, __func__, __FILE__,
+                    MSGAM_NULL_IDAMEM);
+    return (IDA_MEM_NULL);
+  }
+  IDA_mem = (IDAMem)ida_mem;
+
+  /* Is ASA initialized? */
+  if (IDA_mem->ida_adjMallocDone == SUNFALSE)
+  {
+    IDAProcessError(IDA_mem, IDA_NO_ADJ, __LINE__, __func__, __FILE__,
+                    MSGAM_NO_ADJ);
+    return (IDA_NO_ADJ);
+  }
+  IDAADJ_mem = IDA_mem->ida_adj_mem;
+
+  raw_bytes    = 0;
+  stored_bytes = 0;
+  time         = 0.0;
+
+  /* Sum over the stores of y, yd, yS, and ySd */
+  IDAAcompressStats(IDAADJ_mem->ia_cy, &raw_bytes, &stored_bytes, &time);
+  IDAAcompressStats(IDAADJ_mem->ia_cyd, &raw_bytes, &stored_bytes, &time);
+  for (is = 0; is < IDA_mem->ida_Ns; is++)
+  {
+    if (IDAADJ_mem->ia_cyS != NULL)
+    {
+      IDAAcompressStats(IDAADJ_mem->ia_cyS[is], &raw_bytes, &stored_bytes,
+                        &time);
+    }
+    if (IDAADJ_mem->ia_cySd != NULL)
+    {
+      IDAAcompressStats(IDAADJ_mem->ia_cySd[is], &raw_bytes, &stored_bytes,
+                        &time);
+    }
+  }
+
+  if (ratio != NULL)
+  {
+    *ratio = (stored_bytes > 0) ? (sunrealtype)raw_bytes / stored_bytes : ONE;
+  }
+
+  if (decode_time != NULL) { *decode_time = (sunrealtype)time; }
+
+  return (IDA_SUCCESS);
+}
+
 /* IDAGetConsistentICB
  *
  * Returns the consistent initial conditions computed by IDACalcICB or
@@ -831,7 +982,19 @@ int IDAGetAdjDataPointHermite(void* ida_mem, int which, sunrealtype* t,
     return (IDA_ILL_INPUT);
   }
 
-  *t      = dt_mem[which]->t;
+  *t = dt_mem[which]->t;
+
+  if (IDAADJ_mem->ia_ctype != SUNDATACOMPRESSION_NONE)
+  {
+    if ((yy != NULL && SUNCompressStore_Load(IDAADJ_mem->ia_cy, which, yy)) ||
+        (yd != NULL && SUNCompressStore_Load(IDAADJ_mem->ia_cyd, which, yd)))
+    {
+      return (IDA_VECTOROP_ERR);
+    }
+
+    return (IDA_SUCCESS);
+  }
+
   content = (IDAhermiteDataMem)dt_mem[which]->content;
 
   if (yy != NULL) { N_VScale(ONE, content->y, yy); }
@@ -888,7 +1051,17 @@ int IDAGetAdjDataPointPolynomial(void* ida_mem, int which, sunrealtype* t,
   *t      = dt_mem[which]->t;
   content = (IDApolynomialDataMem)dt_mem[which]->content;
 
-  if (y != NULL) { N_VScale(ONE, content->y, y); }
+  if (y != NULL)
+  {
+    if (IDAADJ_mem->ia_ctype == SUNDATACOMPRESSION_NONE)
+    {
+      N_VScale(ONE, content->y, y);
+    }
+    else if (SUNCompressStore_Load(IDAADJ_mem->ia_cy, which, y))
+    {
+      return (IDA_VECTOROP_ERR);
+    }
+  }
 
   *order = content->order;
 
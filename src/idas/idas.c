@@ -113,6 +113,8 @@
  *   Norm functions
  *       IDAWrmsNorm
  *       IDASensWrmsNorm
+ *       IDAWrmsNormArray
+ *       IDASensWrmsNormPair
  *       IDAQuadSensWrmsNorm
  *       IDAQuadWrmsNormUpdate
  *       IDASensWrmsNormUpdate
@@ -154,6 +156,10 @@
 #include "idas_ls_impl.h"
 #include "sundials_utils.h"
 
+#if defined(SUNDIALS_OPENMP_ENABLED)
+#include <omp.h>
+#endif
+
 /*
  * =================================================================
  * IDAS PRIVATE CONSTANTS
@@ -275,7 +281,6 @@ static int IDAQuadEwtSetSS(IDAMem IDA_mem, N_Vector qcur, N_Vector weightQ);
 static int IDAQuadEwtSetSV(IDAMem IDA_mem, N_Vector qcur, N_Vector weightQ);
 
 /* Used in IC for sensitivities. */
-int IDASensEwtSet(IDAMem IDA_mem, N_Vector* yScur, N_Vector* weightS);
 static int IDASensEwtSetEE(IDAMem IDA_mem, N_Vector* yScur, N_Vector* weightS);
 static int IDASensEwtSetSS(IDAMem IDA_mem, N_Vector* yScur, N_Vector* weightS);
 static int IDASensEwtSetSV(IDAMem IDA_mem, N_Vector* yScur, N_Vector* weightS);
@@ -351,6 +356,11 @@ static int IDAHandleFailure(IDAMem IDA_mem, int sflag);
 
 /* Norm functions */
 
+static void IDAWrmsNormArray(IDAMem IDA_mem, int nvec, N_Vector* X, N_Vector* W, sunbooleantype mask, sunrealtype* nrm);
+static void IDASensWrmsNormPair(IDAMem IDA_mem, N_Vector* xS1, N_Vector* xS2,
+                                N_Vector* wS, sunbooleantype mask,
+                                sunrealtype* nrm1, sunrealtype* nrm2);
+
 static sunrealtype IDAQuadWrmsNormUpdate(IDAMem IDA_mem, sunrealtype old_nrm,
                                          N_Vector xQ, N_Vector wQ);
 
@@ -368,10 +378,16 @@ static int IDARootfind(IDAMem IDA_mem);
 
 /* Sensitivity residual DQ function */
 
-static int IDASensRes1DQ(int Ns, sunrealtype t, N_Vector yy, N_Vector yp,
-                         N_Vector resval, int iS, N_Vector yyS, N_Vector ypS,
-                         N_Vector resvalS, void* user_dataS, N_Vector ytemp,
-                         N_Vector yptemp, N_Vector restemp);
+static int IDASensRes1DQ(IDAMem IDA_mem, sunrealtype t, N_Vector yy,
+                         N_Vector yp, N_Vector resval, int iS, N_Vector yyS,
+                         N_Vector ypS, N_Vector resvalS, N_Vector ytemp,
+                         N_Vector yptemp, N_Vector restemp, sunrealtype* p,
+                         void* user_data, long int* nres);
+
+static int idaSensResThreaded(IDAMem IDA_mem, sunrealtype t, N_Vector yy,
+                              N_Vector yp, N_Vector resval, N_Vector* yyS,
+                              N_Vector* ypS, N_Vector* resvalS, N_Vector ytemp,
+                              N_Vector yptemp, N_Vector restemp);
 
 static int IDAQuadSensRhsInternalDQ(int Ns, sunrealtype t, N_Vector yy,
                                     N_Vector yp, N_Vector* yyS, N_Vector* ypS,
@@ -490,19 +506,23 @@ void* IDACreate(SUNContext sunctx)
   IDA_mem->ida_atolQmin0 = SUNTRUE;
 
   /* Set default values for sensi. optional inputs */
-  IDA_mem->ida_sensi      = SUNFALSE;
-  IDA_mem->ida_user_dataS = (void*)IDA_mem;
-  IDA_mem->ida_resS       = IDASensResDQ;
-  IDA_mem->ida_resSDQ     = SUNTRUE;
-  IDA_mem->ida_DQtype     = IDA_CENTERED;
-  IDA_mem->ida_DQrhomax   = ZERO;
-  IDA_mem->ida_p          = NULL;
-  IDA_mem->ida_pbar       = NULL;
-  IDA_mem->ida_plist      = NULL;
-  IDA_mem->ida_errconS    = SUNFALSE;
-  IDA_mem->ida_itolS      = IDA_EE;
-  IDA_mem->ida_atolSmin0  = NULL;
-  IDA_mem->ida_ism        = -1; /* initialize to invalid option */
+  IDA_mem->ida_sensi         = SUNFALSE;
+  IDA_mem->ida_user_dataS    = (void*)IDA_mem;
+  IDA_mem->ida_resS          = IDASensResDQ;
+  IDA_mem->ida_resSDQ        = SUNTRUE;
+  IDA_mem->ida_DQtype        = IDA_CENTERED;
+  IDA_mem->ida_DQrhomax      = ZERO;
+  IDA_mem->ida_nthreadsS     = 1;
+  IDA_mem->ida_tempvS_thr    = NULL;
+  IDA_mem->ida_user_data_thr = NULL;
+  IDA_mem->ida_p_thr         = NULL;
+  IDA_mem->ida_p             = NULL;
+  IDA_mem->ida_pbar          = NULL;
+  IDA_mem->ida_plist         = NULL;
+  IDA_mem->ida_errconS       = SUNFALSE;
+  IDA_mem->ida_itolS         = IDA_EE;
+  IDA_mem->ida_atolSmin0     = NULL;
+  IDA_mem->ida_ism           = -1; /* initialize to invalid option */
 
   /* Defaults for sensi. quadr. optional inputs. */
   IDA_mem->ida_quadr_sensi = SUNFALSE;
@@ -4064,6 +4084,8 @@ void IDAFree(void** ida_mem)
 
   IDASensFree(IDA_mem);
 
+  idaSensFreeThreadVectors(IDA_mem);
+
   IDAQuadSensFree(IDA_mem);
 
   IDAAdjFree(IDA_mem);
@@ -4786,6 +4808,52 @@ static void IDASensFreeVectors(IDAMem IDA_mem)
   }
 }
 
+/*
+ * idaSensAllocThreadVectors
+ *
+ * This routine allocates the work vectors used by the extra threads in
+ * idaSensResThreaded (three for each thread after the first), freeing any
+ * previously allocated ones, and sets ida_nthreadsS.
+ */
+
+int idaSensAllocThreadVectors(IDAMem IDA_mem, int nthreads, N_Vector tmpl)
+{
+  idaSensFreeThreadVectors(IDA_mem);
+
+  if (nthreads > 1)
+  {
+    IDA_mem->ida_tempvS_thr = N_VCloneVectorArray(3 * (nthreads - 1), tmpl);
+    if (IDA_mem->ida_tempvS_thr == NULL) { return (IDA_MEM_FAIL); }
+
+    IDA_mem->ida_lrw += 3 * (nthreads - 1) * IDA_mem->ida_lrw1;
+    IDA_mem->ida_liw += 3 * (nthreads - 1) * IDA_mem->ida_liw1;
+  }
+
+  IDA_mem->ida_nthreadsS = nthreads;
+
+  return (IDA_SUCCESS);
+}
+
+/*
+ * idaSensFreeThreadVectors
+ *
+ * This routine frees the vectors allocated in idaSensAllocThreadVectors.
+ */
+
+void idaSensFreeThreadVectors(IDAMem IDA_mem)
+{
+  if (IDA_mem->ida_tempvS_thr == NULL) { return; }
+
+  N_VDestroyVectorArray(IDA_mem->ida_tempvS_thr,
+                        3 * (IDA_mem->ida_nthreadsS - 1));
+  IDA_mem->ida_tempvS_thr = NULL;
+
+  IDA_mem->ida_lrw -= 3 * (IDA_mem->ida_nthreadsS - 1) * IDA_mem->ida_lrw1;
+  IDA_mem->ida_liw -= 3 * (IDA_mem->ida_nthreadsS - 1) * IDA_mem->ida_liw1;
+
+  IDA_mem->ida_nthreadsS = 1;
+}
+
 /*
  * IDAQuadSensAllocVectors
  *
@@ -6810,10 +6878,38 @@ static int IDATestError(IDAMem IDA_mem, sunrealtype ck, sunrealtype* err_k,
 {
   sunrealtype enorm_k, enorm_km1, enorm_km2; /* error norms */
   sunrealtype terr_k, terr_km1, terr_km2;    /* local truncation error norms */
+  sunrealtype enorm[3];                      /* batched error norms */
+  N_Vector X[3], W[3];                       /* batched norm vectors */
+  int nvec;
+
+  /* Form the error vectors for orders k, k-1 and k-2 (as applicable) so that
+     their norms can be computed with a single global reduction. */
+  nvec = 1;
+  X[0] = IDA_mem->ida_ee;
+  W[0] = IDA_mem->ida_ewt;
+
+  if (IDA_mem->ida_kk > 1)
+  {
+    N_VLinearSum(ONE, IDA_mem->ida_phi[IDA_mem->ida_kk], ONE, IDA_mem->ida_ee,
+                 IDA_mem->ida_delta);
+    X[nvec] = IDA_mem->ida_delta;
+    W[nvec] = IDA_mem->ida_ewt;
+    nvec++;
+
+    if (IDA_mem->ida_kk > 2)
+    {
+      N_VLinearSum(ONE, IDA_mem->ida_phi[IDA_mem->ida_kk - 1], ONE,
+                   IDA_mem->ida_delta, IDA_mem->ida_tempv1);
+      X[nvec] = IDA_mem->ida_tempv1;
+      W[nvec] = IDA_mem->ida_ewt;
+      nvec++;
+    }
+  }
+
+  IDAWrmsNormArray(IDA_mem, nvec, X, W, IDA_mem->ida_suppressalg, enorm);
 
   /* Compute error for order k. */
-  enorm_k = IDAWrmsNorm(IDA_mem, IDA_mem->ida_ee, IDA_mem->ida_ewt,
-                        IDA_mem->ida_suppressalg);
+  enorm_k = enorm[0];
   *err_k  = IDA_mem->ida_sigma[IDA_mem->ida_kk] * enorm_k;
   terr_k  = (IDA_mem->ida_kk + 1) * (*err_k);
 
@@ -6825,10 +6921,7 @@ static int IDATestError(IDAMem IDA_mem, sunrealtype ck, sunrealtype* err_k,
   if (IDA_mem->ida_kk > 1)
   {
     /* Compute error at order k-1 */
-    N_VLinearSum(ONE, IDA_mem->ida_phi[IDA_mem->ida_kk], ONE, IDA_mem->ida_ee,
-                 IDA_mem->ida_delta);
-    enorm_km1 = IDAWrmsNorm(IDA_mem, IDA_mem->ida_delta, IDA_mem->ida_ewt,
-                            IDA_mem->ida_suppressalg);
+    enorm_km1 = enorm[1];
     *err_km1  = IDA_mem->ida_sigma[IDA_mem->ida_kk - 1] * enorm_km1;
     terr_km1  = IDA_mem->ida_kk * (*err_km1);
 
@@ -6839,16 +6932,13 @@ static int IDATestError(IDAMem IDA_mem, sunrealtype ck, sunrealtype* err_k,
     if (IDA_mem->ida_kk > 2)
     {
       /* Compute error at order k-2 */
-      N_VLinearSum(ONE, IDA_mem->ida_phi[IDA_mem->ida_kk - 1], ONE,
-                   IDA_mem->ida_delta, IDA_mem->ida_delta);
-      enorm_km2 = IDAWrmsNorm(IDA_mem, IDA_mem->ida_delta, IDA_mem->ida_ewt,
-                              IDA_mem->ida_suppressalg);
+      enorm_km2 = enorm[2];
       *err_km2  = IDA_mem->ida_sigma[IDA_mem->ida_kk - 2] * enorm_km2;
       terr_km2  = (IDA_mem->ida_kk - 1) * (*err_km2);
 
       SUNLogDebug(IDA_LOGGER, "estimate-error-order-km2",
                   "err_km2 = " SUN_FORMAT_G ", terr_km2 = " SUN_FORMAT_G,
-                  err_km2, terr_km2);
+                  *err_km2, terr_km2);
 
       /* Decrease order if errors are reduced */
       if (SUNMAX(terr_km1, terr_km2) <= terr_k)
@@ -6896,14 +6986,34 @@ static int IDAQuadTestError(IDAMem IDA_mem, sunrealtype ck, sunrealtype* err_k,
   sunrealtype enormQ;
   sunrealtype errQ_k, errQ_km1, errQ_km2;
   sunrealtype terr_k, terr_km1, terr_km2;
-  N_Vector tempv;
+  sunrealtype nrm[2];
+  N_Vector tempv, X[2], W[2];
   sunbooleantype check_for_reduction = SUNFALSE;
+  int nvec;
 
   /* Rename ypQ */
   tempv = IDA_mem->ida_ypQ;
 
+  /* Compute the norms of the errors at orders k and k-1 (as applicable) with
+     a single global reduction. The error at order k-2 depends on these, so
+     it is computed below only when needed. */
+  nvec = 1;
+  X[0] = IDA_mem->ida_eeQ;
+  W[0] = IDA_mem->ida_ewtQ;
+
+  if (IDA_mem->ida_kk > 1)
+  {
+    N_VLinearSum(ONE, IDA_mem->ida_phiQ[IDA_mem->ida_kk], ONE, IDA_mem->ida_eeQ,
+                 tempv);
+    X[nvec] = tempv;
+    W[nvec] = IDA_mem->ida_ewtQ;
+    nvec++;
+  }
+
+  (void)N_VWrmsNormVectorArray(nvec, X, W, nrm);
+
   /* Update error for order k. */
-  enormQ = N_VWrmsNorm(IDA_mem->ida_eeQ, IDA_mem->ida_ewtQ);
+  enormQ = nrm[0];
   errQ_k = IDA_mem->ida_sigma[IDA_mem->ida_kk] * enormQ;
   if (errQ_k > *err_k)
   {
@@ -6915,10 +7025,7 @@ static int IDAQuadTestError(IDAMem IDA_mem, sunrealtype ck, sunrealtype* err_k,
   if (IDA_mem->ida_kk > 1)
   {
     /* Update error at order k-1 */
-    N_VLinearSum(ONE, IDA_mem->ida_phiQ[IDA_mem->ida_kk], ONE, IDA_mem->ida_eeQ,
-                 tempv);
-    errQ_km1 = IDA_mem->ida_sigma[IDA_mem->ida_kk - 1] *
-               N_VWrmsNorm(tempv, IDA_mem->ida_ewtQ);
+    errQ_km1 = IDA_mem->ida_sigma[IDA_mem->ida_kk - 1] * nrm[1];
     if (errQ_km1 > *err_km1)
     {
       *err_km1            = errQ_km1;
@@ -6982,7 +7089,7 @@ static int IDAQuadTestError(IDAMem IDA_mem, sunrealtype ck, sunrealtype* err_k,
 static int IDASensTestError(IDAMem IDA_mem, sunrealtype ck, sunrealtype* err_k,
                             sunrealtype* err_km1, sunrealtype* err_km2)
 {
-  sunrealtype enormS;
+  sunrealtype enormS, enormS_km1;
   sunrealtype errS_k, errS_km1, errS_km2;
   sunrealtype terr_k, terr_km1, terr_km2;
   N_Vector* tempv;
@@ -6992,9 +7099,22 @@ static int IDASensTestError(IDAMem IDA_mem, sunrealtype ck, sunrealtype* err_k,
   /* Rename deltaS */
   tempv = IDA_mem->ida_deltaS;
 
+  /* Compute the norms of the errors at orders k and k-1 (as applicable) with
+     a single global reduction. The error at order k-2 depends on these, so
+     it is computed below only when needed. */
+  if (IDA_mem->ida_kk > 1)
+  {
+    retval = N_VLinearSumVectorArray(IDA_mem->ida_Ns, ONE,
+                                     IDA_mem->ida_phiS[IDA_mem->ida_kk], ONE,
+                                     IDA_mem->ida_eeS, tempv);
+    if (retval != IDA_SUCCESS) { return (IDA_VECTOROP_ERR); }
+  }
+
+  IDASensWrmsNormPair(IDA_mem, IDA_mem->ida_eeS,
+                      (IDA_mem->ida_kk > 1) ? tempv : NULL, IDA_mem->ida_ewtS,
+                      IDA_mem->ida_suppressalg, &enormS, &enormS_km1);
+
   /* Update error for order k. */
-  enormS = IDASensWrmsNorm(IDA_mem, IDA_mem->ida_eeS, IDA_mem->ida_ewtS,
-                           IDA_mem->ida_suppressalg);
   errS_k = IDA_mem->ida_sigma[IDA_mem->ida_kk] * enormS;
   if (errS_k > *err_k)
   {
@@ -7006,14 +7126,7 @@ static int IDASensTestError(IDAMem IDA_mem, sunrealtype ck, sunrealtype* err_k,
   if (IDA_mem->ida_kk > 1)
   {
     /* Update error at order k-1 */
-    retval = N_VLinearSumVectorArray(IDA_mem->ida_Ns, ONE,
-                                     IDA_mem->ida_phiS[IDA_mem->ida_kk], ONE,
-                                     IDA_mem->ida_eeS, tempv);
-    if (retval != IDA_SUCCESS) { return (IDA_VECTOROP_ERR); }
-
-    errS_km1 = IDA_mem->ida_sigma[IDA_mem->ida_kk - 1] *
-               IDASensWrmsNorm(IDA_mem, tempv, IDA_mem->ida_ewtS,
-                               IDA_mem->ida_suppressalg);
+    errS_km1 = IDA_mem->ida_sigma[IDA_mem->ida_kk - 1] * enormS_km1;
 
     if (errS_km1 > *err_km1)
     {
@@ -7086,7 +7199,7 @@ static int IDAQuadSensTestError(IDAMem IDA_mem, sunrealtype ck,
                                 sunrealtype* err_k, sunrealtype* err_km1,
                                 sunrealtype* err_km2)
 {
-  sunrealtype enormQS;
+  sunrealtype enormQS, enormQS_km1;
   sunrealtype errQS_k, errQS_km1, errQS_km2;
   sunrealtype terr_k, terr_km1, terr_km2;
   N_Vector* tempv;
@@ -7095,7 +7208,21 @@ static int IDAQuadSensTestError(IDAMem IDA_mem, sunrealtype ck,
 
   tempv = IDA_mem->ida_yyQS;
 
-  enormQS = IDAQuadSensWrmsNorm(IDA_mem, IDA_mem->ida_eeQS, IDA_mem->ida_ewtQS);
+  /* Compute the norms of the errors at orders k and k-1 (as applicable) with
+     a single global reduction. The error at order k-2 depends on these, so
+     it is computed below only when needed. */
+  if (IDA_mem->ida_kk > 1)
+  {
+    retval = N_VLinearSumVectorArray(IDA_mem->ida_Ns, ONE,
+                                     IDA_mem->ida_phiQS[IDA_mem->ida_kk], ONE,
+                                     IDA_mem->ida_eeQS, tempv);
+    if (retval != IDA_SUCCESS) { return (IDA_VECTOROP_ERR); }
+  }
+
+  IDASensWrmsNormPair(IDA_mem, IDA_mem->ida_eeQS,
+                      (IDA_mem->ida_kk > 1) ? tempv : NULL, IDA_mem->ida_ewtQS,
+                      SUNFALSE, &enormQS, &enormQS_km1);
+
   errQS_k = IDA_mem->ida_sigma[IDA_mem->ida_kk] * enormQS;
 
   if (errQS_k > *err_k)
@@ -7108,13 +7235,7 @@ static int IDAQuadSensTestError(IDAMem IDA_mem, sunrealtype ck,
   if (IDA_mem->ida_kk > 1)
   {
     /* Update error at order k-1 */
-    retval = N_VLinearSumVectorArray(IDA_mem->ida_Ns, ONE,
-                                     IDA_mem->ida_phiQS[IDA_mem->ida_kk], ONE,
-                                     IDA_mem->ida_eeQS, tempv);
-    if (retval != IDA_SUCCESS) { return (IDA_VECTOROP_ERR); }
-
-    errQS_km1 = IDA_mem->ida_sigma[IDA_mem->ida_kk - 1] *
-                IDAQuadSensWrmsNorm(IDA_mem, tempv, IDA_mem->ida_ewtQS);
+    errQS_km1 = IDA_mem->ida_sigma[IDA_mem->ida_kk - 1] * enormQS_km1;
 
     if (errQS_km1 > *err_km1)
     {
@@ -7908,6 +8029,74 @@ sunrealtype IDASensWrmsNorm(IDAMem IDA_mem, N_Vector* xS, N_Vector* wS,
   return (nrm);
 }
 
+/*
+ * IDAWrmsNormArray
+ *
+ *  Computes the WRMS norms of the nvec vectors X[i] with weights W[i],
+ *  masked by id when mask = SUNTRUE (see IDAWrmsNorm). The norms are
+ *  computed with N_VWrmsNorm(Mask)VectorArray so that vectors which
+ *  support it need only a single global reduction for all of them.
+ */
+
+static void IDAWrmsNormArray(IDAMem IDA_mem, int nvec, N_Vector* X,
+                             N_Vector* W, sunbooleantype mask, sunrealtype* nrm)
+{
+  if (mask)
+  {
+    (void)N_VWrmsNormMaskVectorArray(nvec, X, W, IDA_mem->ida_id, nrm);
+  }
+  else { (void)N_VWrmsNormVectorArray(nvec, X, W, nrm); }
+}
+
+/*
+ * IDASensWrmsNormPair
+ *
+ *  Computes nrm1 = max { wrms(xS1[is],wS[is]) } and, if xS2 is not
+ *  NULL, nrm2 = max { wrms(xS2[is],wS[is]) } (see IDASensWrmsNorm)
+ *  with a single call to IDAWrmsNormArray. Otherwise nrm2 = 0.
+ */
+
+static void IDASensWrmsNormPair(IDAMem IDA_mem, N_Vector* xS1, N_Vector* xS2,
+                                N_Vector* wS, sunbooleantype mask,
+                                sunrealtype* nrm1, sunrealtype* nrm2)
+{
+  int is, Ns, nvec;
+
+  Ns   = IDA_mem->ida_Ns;
+  nvec = 0;
+
+  for (is = 0; is < Ns; is++)
+  {
+    IDA_mem->ida_Xvecs[nvec] = xS1[is];
+    IDA_mem->ida_Zvecs[nvec] = wS[is];
+    nvec++;
+  }
+
+  if (xS2 != NULL)
+  {
+    for (is = 0; is < Ns; is++)
+    {
+      IDA_mem->ida_Xvecs[nvec] = xS2[is];
+      IDA_mem->ida_Zvecs[nvec] = wS[is];
+      nvec++;
+    }
+  }
+
+  IDAWrmsNormArray(IDA_mem, nvec, IDA_mem->ida_Xvecs, IDA_mem->ida_Zvecs, mask,
+                   IDA_mem->ida_cvals);
+
+  *nrm1 = IDA_mem->ida_cvals[0];
+  *nrm2 = ZERO;
+  for (is = 0; is < Ns; is++)
+  {
+    if (IDA_mem->ida_cvals[is] > *nrm1) { *nrm1 = IDA_mem->ida_cvals[is]; }
+  }
+  for (is = Ns; is < nvec; is++)
+  {
+    if (IDA_mem->ida_cvals[is] > *nrm2) { *nrm2 = IDA_mem->ida_cvals[is]; }
+  }
+}
+
 /*
  * IDAQuadSensWrmsNorm
  *
@@ -8519,12 +8708,24 @@ int IDASensResDQ(int Ns, sunrealtype t, N_Vector yy, N_Vector yp,
                  N_Vector* resvalS, void* user_dataS, N_Vector ytemp,
                  N_Vector yptemp, N_Vector restemp)
 {
+  IDAMem IDA_mem;
   int retval, is;
 
+  /* user_dataS points to IDA_mem */
+  IDA_mem = (IDAMem)user_dataS;
+
+  /* the parameters are perturbed in place, so each thread needs its own */
+  if (IDA_mem->ida_nthreadsS > 1 && IDA_mem->ida_p_thr != NULL)
+  {
+    return (idaSensResThreaded(IDA_mem, t, yy, yp, resval, yyS, ypS, resvalS,
+                               ytemp, yptemp, restemp));
+  }
+
   for (is = 0; is < Ns; is++)
   {
-    retval = IDASensRes1DQ(Ns, t, yy, yp, resval, is, yyS[is], ypS[is],
-                           resvalS[is], user_dataS, ytemp, yptemp, restemp);
+    retval = IDASensRes1DQ(IDA_mem, t, yy, yp, resval, is, yyS[is], ypS[is],
+                           resvalS[is], ytemp, yptemp, restemp, IDA_mem->ida_p,
+                           IDA_mem->ida_user_data, &IDA_mem->ida_nreS);
     if (retval != 0) { return (retval); }
   }
   return (0);
@@ -8534,18 +8735,19 @@ int IDASensResDQ(int Ns, sunrealtype t, N_Vector yy, N_Vector yp,
  * IDASensRes1DQ
  *
  * IDASensRes1DQ computes the residual of the is-th sensitivity
- * equation by finite differences.
+ * equation by finite differences, perturbing the parameter array p and
+ * passing user_data to res. The number of calls to res is added to nres.
  *
  * Returns 0 if successful or the return value of res if res fails
  * (<0 if res fails unrecoverably, >0 if res has a recoverable error).
  */
 
-static int IDASensRes1DQ(SUNDIALS_MAYBE_UNUSED int Ns, sunrealtype t, N_Vector yy,
+static int IDASensRes1DQ(IDAMem IDA_mem, sunrealtype t, N_Vector yy,
                          N_Vector yp, N_Vector resval, int is, N_Vector yyS,
-                         N_Vector ypS, N_Vector resvalS, void* user_dataS,
-                         N_Vector ytemp, N_Vector yptemp, N_Vector restemp)
+                         N_Vector ypS, N_Vector resvalS, N_Vector ytemp,
+                         N_Vector yptemp, N_Vector restemp, sunrealtype* p,
+                         void* user_data, long int* nres)
 {
-  IDAMem IDA_mem;
   int method;
   int which;
   int retval;
@@ -8556,9 +8758,6 @@ static int IDASensRes1DQ(SUNDIALS_MAYBE_UNUSED int Ns, sunrealtype t, N_Vector y
   sunrealtype Del, rDel, r2Del;
   sunrealtype norms, ratio;
 
-  /* user_dataS points to IDA_mem */
-  IDA_mem = (IDAMem)user_dataS;
-
   /* Set base perturbation del */
   del  = SUNRsqrt(SUNMAX(IDA_mem->ida_rtol, IDA_mem->ida_uround));
   rdel = ONE / del;
@@ -8567,7 +8766,7 @@ static int IDASensRes1DQ(SUNDIALS_MAYBE_UNUSED int Ns, sunrealtype t, N_Vector y
 
   which = IDA_mem->ida_plist[is];
 
-  psave = IDA_mem->ida_p[which];
+  psave = p[which];
 
   Delp  = pbari * del;
   rDelp = ONE / Delp;
@@ -8604,21 +8803,21 @@ static int IDASensRes1DQ(SUNDIALS_MAYBE_UNUSED int Ns, sunrealtype t, N_Vector y
     /* Forward perturb y, y' and parameter */
     N_VLinearSum(Del, yyS, ONE, yy, ytemp);
     N_VLinearSum(Del, ypS, ONE, yp, yptemp);
-    IDA_mem->ida_p[which] = psave + Del;
+    p[which] = psave + Del;
 
     /* Save residual in resvalS */
-    retval = IDA_mem->ida_res(t, ytemp, yptemp, resvalS, IDA_mem->ida_user_data);
-    IDA_mem->ida_nreS++;
+    retval = IDA_mem->ida_res(t, ytemp, yptemp, resvalS, user_data);
+    (*nres)++;
     if (retval != 0) { return (retval); }
 
     /* Backward perturb y, y' and parameter */
     N_VLinearSum(-Del, yyS, ONE, yy, ytemp);
     N_VLinearSum(-Del, ypS, ONE, yp, yptemp);
-    IDA_mem->ida_p[which] = psave - Del;
+    p[which] = psave - Del;
 
     /* Save residual in restemp */
-    retval = IDA_mem->ida_res(t, ytemp, yptemp, restemp, IDA_mem->ida_user_data);
-    IDA_mem->ida_nreS++;
+    retval = IDA_mem->ida_res(t, ytemp, yptemp, restemp, user_data);
+    (*nres)++;
     if (retval != 0) { return (retval); }
 
     /* Estimate the residual for the i-th sensitivity equation */
@@ -8636,8 +8835,8 @@ static int IDASensRes1DQ(SUNDIALS_MAYBE_UNUSED int Ns, sunrealtype t, N_Vector y
     N_VLinearSum(Dely, ypS, ONE, yp, yptemp);
 
     /* Save residual in resvalS */
-    retval = IDA_mem->ida_res(t, ytemp, yptemp, resvalS, IDA_mem->ida_user_data);
-    IDA_mem->ida_nreS++;
+    retval = IDA_mem->ida_res(t, ytemp, yptemp, resvalS, user_data);
+    (*nres)++;
     if (retval != 0) { return (retval); }
 
     /* Backward perturb y and y' */
@@ -8645,27 +8844,27 @@ static int IDASensRes1DQ(SUNDIALS_MAYBE_UNUSED int Ns, sunrealtype t, N_Vector y
     N_VLinearSum(-Dely, ypS, ONE, yp, yptemp);
 
     /* Save residual in restemp */
-    retval = IDA_mem->ida_res(t, ytemp, yptemp, restemp, IDA_mem->ida_user_data);
-    IDA_mem->ida_nreS++;
+    retval = IDA_mem->ida_res(t, ytemp, yptemp, restemp, user_data);
+    (*nres)++;
     if (retval != 0) { return (retval); }
 
     /* Save the first difference quotient in resvalS */
     N_VLinearSum(r2Dely, resvalS, -r2Dely, restemp, resvalS);
 
     /* Forward perturb parameter */
-    IDA_mem->ida_p[which] = psave + Delp;
+    p[which] = psave + Delp;
 
     /* Save residual in ytemp */
-    retval = IDA_mem->ida_res(t, yy, yp, ytemp, IDA_mem->ida_user_data);
-    IDA_mem->ida_nreS++;
+    retval = IDA_mem->ida_res(t, yy, yp, ytemp, user_data);
+    (*nres)++;
     if (retval != 0) { return (retval); }
 
     /* Backward perturb parameter */
-    IDA_mem->ida_p[which] = psave - Delp;
+    p[which] = psave - Delp;
 
     /* Save residual in yptemp */
-    retval = IDA_mem->ida_res(t, yy, yp, yptemp, IDA_mem->ida_user_data);
-    IDA_mem->ida_nreS++;
+    retval = IDA_mem->ida_res(t, yy, yp, yptemp, user_data);
+    (*nres)++;
     if (retval != 0) { return (retval); }
 
     /* Save the second difference quotient in restemp */
@@ -8684,11 +8883,11 @@ static int IDASensRes1DQ(SUNDIALS_MAYBE_UNUSED int Ns, sunrealtype t, N_Vector y
     /* Forward perturb y, y' and parameter */
     N_VLinearSum(Del, yyS, ONE, yy, ytemp);
     N_VLinearSum(Del, ypS, ONE, yp, yptemp);
-    IDA_mem->ida_p[which] = psave + Del;
+    p[which] = psave + Del;
 
     /* Save residual in resvalS */
-    retval = IDA_mem->ida_res(t, ytemp, yptemp, resvalS, IDA_mem->ida_user_data);
-    IDA_mem->ida_nreS++;
+    retval = IDA_mem->ida_res(t, ytemp, yptemp, resvalS, user_data);
+    (*nres)++;
     if (retval != 0) { return (retval); }
 
     /* Estimate the residual for the i-th sensitivity equation */
@@ -8703,19 +8902,19 @@ static int IDASensRes1DQ(SUNDIALS_MAYBE_UNUSED int Ns, sunrealtype t, N_Vector y
     N_VLinearSum(Dely, ypS, ONE, yp, yptemp);
 
     /* Save residual in resvalS */
-    retval = IDA_mem->ida_res(t, ytemp, yptemp, resvalS, IDA_mem->ida_user_data);
-    IDA_mem->ida_nreS++;
+    retval = IDA_mem->ida_res(t, ytemp, yptemp, resvalS, user_data);
+    (*nres)++;
     if (retval != 0) { return (retval); }
 
     /* Save the first difference quotient in resvalS */
     N_VLinearSum(rDely, resvalS, -rDely, resval, resvalS);
 
     /* Forward perturb parameter */
-    IDA_mem->ida_p[which] = psave + Delp;
+    p[which] = psave + Delp;
 
     /* Save residual in restemp */
-    retval = IDA_mem->ida_res(t, yy, yp, restemp, IDA_mem->ida_user_data);
-    IDA_mem->ida_nreS++;
+    retval = IDA_mem->ida_res(t, yy, yp, restemp, user_data);
+    (*nres)++;
     if (retval != 0) { return (retval); }
 
     /* Save the second difference quotient in restemp */
@@ -8728,11 +8927,103 @@ static int IDASensRes1DQ(SUNDIALS_MAYBE_UNUSED int Ns, sunrealtype t, N_Vector y
   }
 
   /* Restore original value of parameter */
-  IDA_mem->ida_p[which] = psave;
+  p[which] = psave;
 
   return (0);
 }
 
+/*
+ * idaSensResThreaded
+ *
+ * idaSensResThreaded computes the DQ residuals of all sensitivity equations
+ * with the loop over the sensitivities split between ida_nthreadsS threads.
+ * Each thread uses its own three work vectors, its own parameter array, and
+ * (if set with IDASetSensThreadData) its own user data. Each sensitivity is
+ * computed by one thread with the same operations as in the serial loop, so
+ * the results do not depend on the number of threads. If a residual call
+ * fails, the return value is that of the failure with the smallest index is.
+ */
+
+static int idaSensResThreaded(IDAMem IDA_mem, sunrealtype t, N_Vector yy,
+                              N_Vector yp, N_Vector resval, N_Vector* yyS,
+                              N_Vector* ypS, N_Vector* resvalS, N_Vector ytemp,
+                              N_Vector yptemp, N_Vector restemp)
+{
+  int is, tid, rv, fail_is, retval;
+  int Ns          = IDA_mem->ida_Ns;
+  long int nres   = 0;
+  N_Vector* tmp   = NULL;
+  N_Vector tmp1   = ytemp;
+  N_Vector tmp2   = yptemp;
+  N_Vector tmp3   = restemp;
+  void* user_data = NULL;
+
+  fail_is = Ns;
+  retval  = 0;
+
+#if defined(SUNDIALS_OPENMP_ENABLED)
+#pragma omp parallel for schedule(static) num_threads(IDA_mem->ida_nthreadsS) \
+  private(tid, rv, tmp, tmp1, tmp2, tmp3, user_data) reduction(+ : nres)
+#endif
+  for (is = 0; is < Ns; is++)
+  {
+#if defined(SUNDIALS_OPENMP_ENABLED)
+    tid = omp_get_thread_num();
+#pragma omp atomic read
+    rv = fail_is;
+#else
+    tid = 0;
+    rv  = fail_is;
+#endif
+
+    /* skip the sensitivities after a failure */
+    if (is > rv) { continue; }
+
+    if (tid == 0)
+    {
+      tmp1 = ytemp;
+      tmp2 = yptemp;
+      tmp3 = restemp;
+    }
+    else
+    {
+      tmp  = IDA_mem->ida_tempvS_thr + 3 * (tid - 1);
+      tmp1 = tmp[0];
+      tmp2 = tmp[1];
+      tmp3 = tmp[2];
+    }
+
+    user_data = (IDA_mem->ida_user_data_thr != NULL)
+                  ? IDA_mem->ida_user_data_thr[tid]
+                  : IDA_mem->ida_user_data;
+
+    rv = IDASensRes1DQ(IDA_mem, t, yy, yp, resval, is, yyS[is], ypS[is],
+                       resvalS[is], tmp1, tmp2, tmp3, IDA_mem->ida_p_thr[tid],
+                       user_data, &nres);
+
+    if (rv != 0)
+    {
+#if defined(SUNDIALS_OPENMP_ENABLED)
+#pragma omp critical(idaSensResThreaded_fail)
+#endif
+      {
+        if (is < fail_is)
+        {
+#if defined(SUNDIALS_OPENMP_ENABLED)
+#pragma omp atomic write
+#endif
+          fail_is = is;
+          retval  = rv;
+        }
+      }
+    }
+  }
+
+  IDA_mem->ida_nreS += nres;
+
+  return (retval);
+}
+
 /* IDAQuadSensRhsInternalDQ   - internal IDAQuadSensRhsFn
  *
  * IDAQuadSensRhsInternalDQ computes right hand side of all quadrature
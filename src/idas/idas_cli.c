@@ -86,6 +86,7 @@ static int idaSetFromCommandLine(void* ida_mem, const char* idaid, int argc,
      {"quad_err_con", IDASetQuadErrCon},
      {"sens_err_con", IDASetSensErrCon},
      {"sens_max_nonlin_iters", IDASetSensMaxNonlinIters},
+     {"sens_num_threads", IDASetSensNumThreads},
      {"quad_sens_err_con", IDASetQuadSensErrCon},
      {"linear_solution_scaling", IDASetLinearSolutionScaling},
      {"max_num_constraint_fails", IDASetMaxNumConstraintFails}};
@@ -26,6 +26,7 @@
 #include <idas/idas.h>
 #include <sundials/priv/sundials_context_impl.h>
 
+#include "sundials_compress_impl.h"
 #include "sundials_logger_impl.h"
 #include "sundials_macros.h"
 
@@ -160,6 +161,11 @@ typedef struct IDAMemRec
   int ida_DQtype;
   sunrealtype ida_DQrhomax;
 
+  int ida_nthreadsS;        /* threads used for the DQ sensitivity residuals */
+  N_Vector* ida_tempvS_thr; /* three work vectors for each extra thread      */
+  void** ida_user_data_thr; /* user data passed to res by each thread        */
+  sunrealtype** ida_p_thr;  /* parameters perturbed by each thread           */
+
   sunbooleantype ida_errconS; /* SUNTRUE if sensitivities in err. control  */
 
   int ida_itolS;
@@ -666,6 +672,7 @@ typedef struct IDAhermiteDataMemRec
   N_Vector yd;
   N_Vector* yS;
   N_Vector* ySd;
+  long int index; /* index in dt_mem (slot in compressed storage) */
 }* IDAhermiteDataMem;
 
 /* Data for polynomial interpolation */
@@ -679,6 +686,7 @@ typedef struct IDApolynomialDataMemRec
   N_Vector yd;
   N_Vector* ySd;
   int order;
+  long int index; /* index in dt_mem (slot in compressed storage) */
 }* IDApolynomialDataMem;
 
 /*
@@ -842,6 +850,23 @@ struct IDAadjMemRec
   N_Vector* ia_YS[MXORDP1]; /* pointers phiS[i]               */
   sunrealtype ia_T[MXORDP1];
 
+  /* Compressed storage of the interpolation data. When ia_ctype is not
+     SUNDATACOMPRESSION_NONE the data points hold no y and yS vectors (nor
+     yd and ySd with Hermite interpolation) and the data is kept in one
+     store per vector instead. */
+  SUNDataCompression ia_ctype; /* compression method                   */
+  sunrealtype ia_ctol;         /* error bound relative to the weights  */
+  SUNCompressStore ia_cy;      /* y at the data points                 */
+  SUNCompressStore ia_cyd;     /* yd at the data points (Hermite)      */
+  SUNCompressStore* ia_cyS;    /* yS at the data points                */
+  SUNCompressStore* ia_cySd;   /* ySd at the data points (Hermite)     */
+  N_Vector ia_cw;              /* error weights of a new data point    */
+  N_Vector* ia_cwS;            /* sensitivity weights of a new point   */
+  N_Vector ia_cvec[4];         /* decoded y, yd of two data points     */
+  N_Vector* ia_cvecS[4];       /* decoded yS, ySd of two data points   */
+  long int ia_cidx[2];         /* data points held in ia_cvec          */
+  long int ia_cidxS[2];        /* data points held in ia_cvecS         */
+
   /* Workspace for wrapper functions */
   N_Vector ia_yyTmp, ia_ypTmp;
   N_Vector *ia_yySTmp, *ia_ypSTmp;
@@ -948,6 +973,10 @@ struct IDAadjMemRec
 
 int IDAEwtSet(N_Vector ycur, N_Vector weight, void* data);
 
+/* Compute the sensitivity error weights */
+
+int IDASensEwtSet(IDAMem IDA_mem, N_Vector* yScur, N_Vector* weightS);
+
 /* High level error handler */
 
 void IDAProcessError(IDAMem IDA_mem, int error_code, int line, const char* func,
@@ -983,6 +1012,12 @@ int IDASensResDQ(int Ns, sunrealtype t, N_Vector yy, N_Vector yp,
                  N_Vector* resvalS, void* user_dataS, N_Vector ytemp,
                  N_Vector yptemp, N_Vector restemp);
 
+/* Prototypes for the per-thread sensitivity residual work vectors */
+
+int idaSensAllocThreadVectors(IDAMem IDA_mem, int nthreads, N_Vector tmpl);
+
+void idaSensFreeThreadVectors(IDAMem IDA_mem);
+
 /* Function to destroy function table allocated by the Python binding code */
 
 #if defined(SUNDIALS_ENABLE_PYTHON)
@@ -1064,7 +1099,8 @@ void idas_user_supplied_fn_table_destroy(void* ptr);
 #define MSG_NULL_DKYA "dkyA = NULL illegal."
 #define MSG_BAD_DQTYPE \
   "Illegal value for DQtype. Legal values are: IDA_CENTERED and IDA_FORWARD."
-#define MSG_BAD_DQRHO "DQrhomax < 0 illegal."
+#define MSG_BAD_DQRHO    "DQrhomax < 0 illegal."
+#define MSG_BAD_NTHREADS "nthreads < 1 illegal."
 
 #define MSG_NULL_ABSTOLQS "abstolQS = NULL illegal parameter."
 #define MSG_BAD_RELTOLQS  "reltolQS < 0 illegal parameter."
@@ -1240,6 +1276,13 @@ void idas_user_supplied_fn_table_destroy(void* ptr);
   "This function cannot be called for the specified interp type."
 #define MSGAM_MEM_FAIL  "A memory request failed."
 #define MSGAM_NO_INITBS "Illegal attempt to call before calling IDAInitBS."
+#define MSGAM_BAD_CTYPE "Illegal value for ctype."
+#define MSGAM_BAD_CTOL  "tol <= 0 illegal for the requested compression."
+#define MSGAM_CMP_SET \
+  "The compression cannot be changed after the first call to IDASolveF."
+#define MSGAM_CMP_NVECTOR                                                 \
+  "The compression requires the N_Vector buffer operations (N_VBufSize, " \
+  "N_VBufPack, N_VBufUnpack)."
 
 #ifdef __cplusplus
 }
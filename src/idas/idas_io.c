@@ -1127,6 +1127,73 @@ int IDASetSensParams(void* ida_mem, sunrealtype* p, sunrealtype* pbar, int* plis
   return (IDA_SUCCESS);
 }
 
+/*-----------------------------------------------------------------*/
+
+int IDASetSensNumThreads(void* ida_mem, int nthreads)
+{
+  IDAMem IDA_mem;
+  int retval;
+
+  if (ida_mem == NULL)
+  {
+    IDAProcessError(NULL, IDA_MEM_NULL, __LINE__, __func__, __FILE__, MSG_NO_MEM);
+    return (IDA_MEM_NULL);
+  }
+
+  IDA_mem = (IDAMem)ida_mem;
+
+  if (IDA_mem->ida_MallocDone == SUNFALSE)
+  {
+    IDAProcessError(IDA_mem, IDA_NO_MALLOC, __LINE__, __func__, __FILE__,
+                    MSG_NO_MALLOC);
+    return (IDA_NO_MALLOC);
+  }
+
+  if (nthreads < 1)
+  {
+    IDAProcessError(IDA_mem, IDA_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    MSG_BAD_NTHREADS);
+    return (IDA_ILL_INPUT);
+  }
+
+  /* Without OpenMP the sensitivity residuals are computed serially */
+#if !defined(SUNDIALS_OPENMP_ENABLED)
+  nthreads = 1;
+#endif
+
+  if (nthreads == IDA_mem->ida_nthreadsS) { return (IDA_SUCCESS); }
+
+  retval = idaSensAllocThreadVectors(IDA_mem, nthreads, IDA_mem->ida_tempv1);
+  if (retval != IDA_SUCCESS)
+  {
+    IDAProcessError(IDA_mem, IDA_MEM_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_MEM_FAIL);
+    return (IDA_MEM_FAIL);
+  }
+
+  return (IDA_SUCCESS);
+}
+
+/*-----------------------------------------------------------------*/
+
+int IDASetSensThreadData(void* ida_mem, void** user_data, sunrealtype** p)
+{
+  IDAMem IDA_mem;
+
+  if (ida_mem == NULL)
+  {
+    IDAProcessError(NULL, IDA_MEM_NULL, __LINE__, __func__, __FILE__, MSG_NO_MEM);
+    return (IDA_MEM_NULL);
+  }
+
+  IDA_mem = (IDAMem)ida_mem;
+
+  IDA_mem->ida_user_data_thr = user_data;
+  IDA_mem->ida_p_thr         = p;
+
+  return (IDA_SUCCESS);
+}
+
 /*
  * -----------------------------------------------------------------
  * Function: IDASetQuadSensErrCon
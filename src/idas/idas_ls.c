@@ -233,6 +233,7 @@ int IDASetLinearSolver(void* ida_mem, SUNLinearSolver LS, SUNMatrix A)
   idals_mem->jtsetup  = NULL;
   idals_mem->jtimes   = idaLsDQJtimes;
   idals_mem->jt_res   = IDA_mem->ida_res;
+  idals_mem->jt_dir   = NULL;
   idals_mem->jt_data  = IDA_mem;
 
   /* Set defaults for preconditioner-related fields */
@@ -367,6 +368,62 @@ int IDASetJacFn(void* ida_mem, IDALsJacFn jac)
   return (IDALS_SUCCESS);
 }
 
+/* IDASetJacSparsityPattern specifies the sparsity pattern of the Jacobian
+   for the sparse difference quotient approximation. The column coloring is
+   computed here and reused until a different pattern is supplied. A NULL
+   input removes any stored pattern. */
+int IDASetJacSparsityPattern(void* ida_mem, SUNMatrix S)
+{
+  IDAMem IDA_mem;
+  IDALsMem idals_mem;
+  SUNErrCode err;
+  int retval;
+
+  /* access IDALsMem structure */
+  retval = idaLs_AccessLMem(ida_mem, __func__, &IDA_mem, &idals_mem);
+  if (retval != IDALS_SUCCESS) { return (retval); }
+
+  /* remove the stored pattern */
+  if (S == NULL)
+  {
+    SUNSparseDQ_Destroy(&(idals_mem->sdq));
+    return (IDALS_SUCCESS);
+  }
+
+  /* the pattern is only used with a sparse system matrix */
+  if ((idals_mem->J == NULL) ||
+      (SUNMatGetID(idals_mem->J) != SUNMATRIX_SPARSE) ||
+      (SUNMatGetID(S) != SUNMATRIX_SPARSE))
+  {
+    IDAProcessError(IDA_mem, IDALS_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "Sparsity pattern requires sparse SUNMatrix inputs");
+    return (IDALS_ILL_INPUT);
+  }
+
+  /* keep the existing coloring if the pattern is unchanged */
+  if (SUNSparseDQ_SamePattern(idals_mem->sdq, S)) { return (IDALS_SUCCESS); }
+
+  SUNSparseDQ_Destroy(&(idals_mem->sdq));
+
+  err = SUNSparseDQ_Create(S, &(idals_mem->sdq));
+  if (err == SUN_ERR_MALLOC_FAIL)
+  {
+    IDAProcessError(IDA_mem, IDALS_MEM_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_LS_MEM_FAIL);
+    return (IDALS_MEM_FAIL);
+  }
+  if (!err) { err = SUNSparseDQ_CheckMatrix(idals_mem->sdq, idals_mem->J); }
+  if (err)
+  {
+    SUNSparseDQ_Destroy(&(idals_mem->sdq));
+    IDAProcessError(IDA_mem, IDALS_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "Sparsity pattern is incompatible with the system matrix");
+    return (IDALS_ILL_INPUT);
+  }
+
+  return (IDALS_SUCCESS);
+}
+
 /* IDASetEpsLin specifies the nonlinear -> linear tolerance scale factor */
 int IDASetEpsLin(void* ida_mem, sunrealtype eplifac)
 {
@@ -548,6 +605,52 @@ int IDASetJacTimes(void* ida_mem, IDALsJacTimesSetupFn jtsetup,
     idals_mem->jt_res   = IDA_mem->ida_res;
     idals_mem->jt_data  = IDA_mem;
   }
+  idals_mem->jt_dir = NULL;
+
+  return (IDALS_SUCCESS);
+}
+
+/* IDASetJacTimesDirDeriv specifies a user-supplied function computing the
+   exact directional derivative of the DAE residual, e.g., by forward mode
+   automatic differentiation or dual numbers, to use in place of the internal
+   finite difference Jacobian-vector product */
+int IDASetJacTimesDirDeriv(void* ida_mem, IDALsJacTimesDirDerivFn jtdir)
+{
+  IDAMem IDA_mem;
+  IDALsMem idals_mem;
+  int retval;
+
+  /* access IDALsMem structure */
+  retval = idaLs_AccessLMem(ida_mem, __func__, &IDA_mem, &idals_mem);
+  if (retval != IDALS_SUCCESS) { return (retval); }
+
+  /* issue error if LS object does not allow user-supplied ATimes */
+  if (idals_mem->LS->ops->setatimes == NULL)
+  {
+    IDAProcessError(IDA_mem, IDALS_ILL_INPUT, __LINE__, __func__,
+                    __FILE__, "SUNLinearSolver object does not support user-supplied ATimes routine");
+    return (IDALS_ILL_INPUT);
+  }
+
+  /* store the directional derivative function, called by the internal jtimes
+     routine (NULL jtdir implies use of DQ default) */
+  if (jtdir != NULL)
+  {
+    idals_mem->jtimesDQ = SUNFALSE;
+    idals_mem->jtsetup  = NULL;
+    idals_mem->jtimes   = idaLsDirDerivJtimes;
+    idals_mem->jt_dir   = jtdir;
+    idals_mem->jt_data  = IDA_mem;
+  }
+  else
+  {
+    idals_mem->jtimesDQ = SUNTRUE;
+    idals_mem->jtsetup  = NULL;
+    idals_mem->jtimes   = idaLsDQJtimes;
+    idals_mem->jt_res   = IDA_mem->ida_res;
+    idals_mem->jt_dir   = NULL;
+    idals_mem->jt_data  = IDA_mem;
+  }
 
   return (IDALS_SUCCESS);
 }
@@ -926,7 +1029,7 @@ int idaLsPSolve(void* ida_mem, N_Vector r, N_Vector z, sunrealtype tol,
 /*---------------------------------------------------------------
   idaLsDQJac:
 
-  This routine is a wrapper for the Dense and Band
+  This routine is a wrapper for the Dense, Band, and Sparse
   implementations of the difference quotient Jacobian
   approximation routines.
 ---------------------------------------------------------------*/
@@ -976,6 +1079,10 @@ int idaLsDQJac(sunrealtype t, sunrealtype c_j, N_Vector y, N_Vector yp,
   {
     retval = idaLsBandDQJac(t, c_j, y, yp, r, Jac, IDA_mem, tmp1, tmp2, tmp3);
   }
+  else if (SUNMatGetID(Jac) == SUNMATRIX_SPARSE)
+  {
+    retval = idaLsSparseDQJac(t, c_j, y, yp, r, Jac, IDA_mem, tmp1, tmp2, tmp3);
+  }
   else
   {
     IDAProcessError(IDA_mem, IDA_ILL_INPUT, __LINE__, __func__, __FILE__,
@@ -1232,6 +1339,177 @@ int idaLsBandDQJac(sunrealtype tt, sunrealtype c_j, N_Vector yy, N_Vector yp,
   return (retval);
 }
 
+/*---------------------------------------------------------------
+  idaLsSparseDQJac
+
+  This routine generates a sparse difference quotient approximation
+  JJ to the DAE system Jacobian J using the sparsity pattern and
+  column coloring supplied to IDASetJacSparsityPattern. All columns
+  of one color are structurally orthogonal, so they are perturbed
+  together and the Jacobian is constructed using one call to the
+  res routine per color. The stored pattern is loaded into the CSC
+  or CSR matrix Jac before the difference quotients are scattered
+  into it. The return value is either IDALS_SUCCESS = 0, or the
+  nonzero value returned by the res routine, if any.
+  ---------------------------------------------------------------*/
+int idaLsSparseDQJac(sunrealtype tt, sunrealtype c_j, N_Vector yy, N_Vector yp,
+                     N_Vector rr, SUNMatrix Jac, IDAMem IDA_mem, N_Vector tmp1,
+                     N_Vector tmp2, N_Vector tmp3)
+{
+  sunrealtype inc, yj, ypj, srur, conj, ewtj;
+  sunrealtype *y_data, *yp_data, *ewt_data, *cns_data = NULL;
+  sunrealtype *ytemp_data, *yptemp_data, *rtemp_data, *r_data;
+  N_Vector rtemp, ytemp, yptemp;
+  sunindextype j, k, color;
+  IDALsMem idals_mem;
+  SUNSparseDQ sdq;
+  int retval = 0;
+
+  /* access LsMem interface structure */
+  idals_mem = (IDALsMem)IDA_mem->ida_lmem;
+  sdq       = idals_mem->sdq;
+
+  if (sdq == NULL)
+  {
+    IDAProcessError(IDA_mem, IDALS_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    MSG_LS_NO_PATTERN);
+    return (IDALS_ILL_INPUT);
+  }
+
+  /* load the sparsity pattern into Jac, growing its storage if needed */
+  if (SUNSparseMatrix_NNZ(Jac) < sdq->NNZ)
+  {
+    if (SUNSparseMatrix_Reallocate(Jac, sdq->NNZ))
+    {
+      IDAProcessError(IDA_mem, IDALS_SUNMAT_FAIL, __LINE__, __func__,
+                      __FILE__, MSG_LS_SUNMAT_FAILED);
+      return (IDALS_SUNMAT_FAIL);
+    }
+  }
+  if (SUNSparseDQ_LoadPattern(sdq, Jac))
+  {
+    IDAProcessError(IDA_mem, IDALS_SUNMAT_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_LS_SUNMAT_FAILED);
+    return (IDALS_SUNMAT_FAIL);
+  }
+
+  /* Rename work vectors for use as temporary values of r, y and yp */
+  rtemp  = tmp1;
+  ytemp  = tmp2;
+  yptemp = tmp3;
+
+  /* Obtain pointers to the data for all eight vectors used.  */
+  ewt_data    = N_VGetArrayPointer(IDA_mem->ida_ewt);
+  r_data      = N_VGetArrayPointer(rr);
+  y_data      = N_VGetArrayPointer(yy);
+  yp_data     = N_VGetArrayPointer(yp);
+  rtemp_data  = N_VGetArrayPointer(rtemp);
+  ytemp_data  = N_VGetArrayPointer(ytemp);
+  yptemp_data = N_VGetArrayPointer(yptemp);
+  if (IDA_mem->ida_constraints)
+  {
+    cns_data = N_VGetArrayPointer(IDA_mem->ida_constraints);
+  }
+
+  /* Initialize ytemp and yptemp. */
+  N_VScale(ONE, yy, ytemp);
+  N_VScale(ONE, yp, yptemp);
+
+  /* Compute miscellaneous values for the Jacobian computation. */
+  srur = SUNRsqrt(IDA_mem->ida_uround);
+
+  /* Loop over column colors. */
+  for (color = 0; color < sdq->ncolors; color++)
+  {
+    /* Increment all yy[j] and yp[j] for j with this color. */
+    for (k = sdq->colorptrs[color]; k < sdq->colorptrs[color + 1]; k++)
+    {
+      j    = sdq->colorcols[k];
+      yj   = y_data[j];
+      ypj  = yp_data[j];
+      ewtj = ewt_data[j];
+
+      /* Set increment inc to yj based on sqrt(uround)*abs(yj), with
+        adjustments using ypj and ewtj if this is small, and a further
+        adjustment to give it the same sign as hh*ypj. */
+      inc = SUNMAX(srur * SUNMAX(SUNRabs(yj), SUNRabs(IDA_mem->ida_hh * ypj)),
+                   ONE / ewtj);
+      if (IDA_mem->ida_hh * ypj < ZERO) { inc = -inc; }
+      inc = (yj + inc) - yj;
+
+      /* Adjust sign(inc) again if yj has an inequality constraint. */
+      if (IDA_mem->ida_constraints)
+      {
+        conj = cns_data[j];
+        if (SUNRabs(conj) == ONE)
+        {
+          if ((yj + inc) * conj < ZERO) { inc = -inc; }
+        }
+        else if (SUNRabs(conj) == TWO)
+        {
+          if ((yj + inc) * conj <= ZERO) { inc = -inc; }
+        }
+      }
+
+      /* Increment yj and ypj. */
+      ytemp_data[j] += inc;
+      yptemp_data[j] += c_j * inc;
+    }
+
+    /* Call res routine with incremented arguments. */
+    retval = IDA_mem->ida_res(tt, ytemp, yptemp, rtemp, IDA_mem->ida_user_data);
+    idals_mem->nreDQ++;
+    if (retval != 0) { break; }
+
+    /* Loop over the indices j with this color again. */
+    for (k = sdq->colorptrs[color]; k < sdq->colorptrs[color + 1]; k++)
+    {
+      /* Recover the increment and reset the perturbed components. */
+      j              = sdq->colorcols[k];
+      inc            = ytemp_data[j] - y_data[j];
+      ytemp_data[j]  = y_data[j];
+      yptemp_data[j] = yp_data[j];
+
+      /* Load the difference quotient Jacobian elements for column j */
+      SUNSparseDQ_ScatterColumn(sdq, Jac, j, ONE / inc, rtemp_data, r_data);
+    }
+  }
+
+  return (retval);
+}
+
+/*---------------------------------------------------------------
+  idaLsDirDerivJtimes
+
+  This routine computes the matrix-vector product z = Jv, where
+  J = dF/dy + cj dF/dy' is the system Jacobian, exactly by calling
+  the user-supplied directional derivative of the residual with
+  the directions v (for y) and cj*v (for y').
+  ---------------------------------------------------------------*/
+int idaLsDirDerivJtimes(sunrealtype tt, N_Vector yy, N_Vector yp,
+                        SUNDIALS_MAYBE_UNUSED N_Vector rr, N_Vector v,
+                        N_Vector Jv, sunrealtype c_j, void* ida_mem,
+                        N_Vector work1, SUNDIALS_MAYBE_UNUSED N_Vector work2)
+{
+  IDAMem IDA_mem;
+  IDALsMem idals_mem;
+  int retval;
+
+  /* access IDALsMem structure */
+  retval = idaLs_AccessLMem(ida_mem, __func__, &IDA_mem, &idals_mem);
+  if (retval != IDALS_SUCCESS) { return (retval); }
+
+  /* Set work1 = cj*v, the direction for yp */
+  N_VScale(c_j, v, work1);
+
+  /* Set Jv = F_y(t,y,yp) v + F_yp(t,y,yp) cj*v */
+  retval = idals_mem->jt_dir(tt, yy, yp, v, work1, Jv, IDA_mem->ida_user_data);
+  if (retval < 0) { return (-1); }
+  if (retval > 0) { return (+1); }
+
+  return (0);
+}
+
 /*---------------------------------------------------------------
   idaLsDQJtimes
 
@@ -1327,6 +1605,7 @@ int idaLsInitialize(IDAMem IDA_mem)
   {
     /* If J is non-NULL, and 'jac' is not user-supplied:
        - if J is dense or band, ensure that our DQ approx. is used
+       - if J is sparse, a sparsity pattern must have been supplied
        - otherwise => error */
     retval = 0;
     if (idals_mem->J->ops->getid)
@@ -1337,6 +1616,18 @@ int idaLsInitialize(IDAMem IDA_mem)
         idals_mem->jac    = idaLsDQJac;
         idals_mem->J_data = IDA_mem;
       }
+      else if (SUNMatGetID(idals_mem->J) == SUNMATRIX_SPARSE)
+      {
+        if (idals_mem->sdq == NULL)
+        {
+          IDAProcessError(IDA_mem, IDALS_ILL_INPUT, __LINE__, __func__,
+                          __FILE__, MSG_LS_NO_PATTERN);
+          idals_mem->last_flag = IDALS_ILL_INPUT;
+          return (IDALS_ILL_INPUT);
+        }
+        idals_mem->jac    = idaLsDQJac;
+        idals_mem->J_data = IDA_mem;
+      }
       else { retval++; }
     }
     else { retval++; }
@@ -1365,6 +1656,12 @@ int idaLsInitialize(IDAMem IDA_mem)
     idals_mem->jtimes  = idaLsDQJtimes;
     idals_mem->jt_data = IDA_mem;
   }
+  else if (idals_mem->jt_dir)
+  {
+    idals_mem->jtsetup = NULL;
+    idals_mem->jtimes  = idaLsDirDerivJtimes;
+    idals_mem->jt_data = IDA_mem;
+  }
   else { idals_mem->jt_data = IDA_mem->ida_user_data; }
 
   /* if J is NULL and psetup is not present, then idaLsSetup does
@@ -1770,6 +2067,9 @@ int idaLsFree(IDAMem IDA_mem)
   /* Nullify SUNMatrix pointer */
   idals_mem->J = NULL;
 
+  /* Free sparse DQ Jacobian coloring */
+  SUNSparseDQ_Destroy(&(idals_mem->sdq));
+
   /* Free preconditioner memory (if applicable) */
   if (idals_mem->pfree) { idals_mem->pfree(IDA_mem); }
 
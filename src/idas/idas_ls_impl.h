@@ -24,6 +24,7 @@
 #include <idas/idas_ls.h>
 
 #include "idas_impl.h"
+#include "sundials_sparsedq_impl.h"
 
 #ifdef __cplusplus /* wrapper to enable C++ usage */
 extern "C" {
@@ -46,6 +47,8 @@ typedef struct IDALsMemRec
   sunbooleantype jacDQ; /* SUNTRUE if using internal DQ Jacobian approx. */
   IDALsJacFn jac;       /* Jacobian routine to be called                 */
   void* J_data;         /* J_data is passed to jac                       */
+  SUNSparseDQ sdq;      /* sparsity pattern and column coloring for the  *
+                         * sparse DQ Jacobian approximation              */
 
   /* Linear solver, matrix and vector objects/pointers */
   SUNLinearSolver LS; /* generic linear solver object                  */
@@ -102,11 +105,16 @@ typedef struct IDALsMemRec
          - jtimesDQ == SUNFALSE
      (b) internal jtimes
          - jt_data == ida_mem
-         - jtimesDQ == SUNTRUE */
+         - jtimesDQ == SUNTRUE
+     (c) internal jtimes calling a user-provided directional derivative:
+         - jt_data == ida_mem
+         - jtimesDQ == SUNFALSE
+         - jt_dir != NULL */
   sunbooleantype jtimesDQ;
   IDALsJacTimesSetupFn jtsetup;
   IDALsJacTimesVecFn jtimes;
   IDAResFn jt_res;
+  IDALsJacTimesDirDerivFn jt_dir;
   void* jt_data;
 
 }* IDALsMem;
@@ -120,6 +128,11 @@ int idaLsATimes(void* ida_mem, N_Vector v, N_Vector z);
 int idaLsPSetup(void* ida_mem);
 int idaLsPSolve(void* ida_mem, N_Vector r, N_Vector z, sunrealtype tol, int lr);
 
+/* Jac times vector from a user-supplied directional derivative */
+int idaLsDirDerivJtimes(sunrealtype tt, N_Vector yy, N_Vector yp, N_Vector rr,
+                        N_Vector v, N_Vector Jv, sunrealtype c_j, void* data,
+                        N_Vector work1, N_Vector work2);
+
 /* Difference quotient approximation for Jac times vector */
 int idaLsDQJtimes(sunrealtype tt, N_Vector yy, N_Vector yp, N_Vector rr,
                   N_Vector v, N_Vector Jv, sunrealtype c_j, void* data,
@@ -134,6 +147,9 @@ int idaLsDenseDQJac(sunrealtype tt, sunrealtype c_j, N_Vector yy, N_Vector yp,
 int idaLsBandDQJac(sunrealtype tt, sunrealtype c_j, N_Vector yy, N_Vector yp,
                    N_Vector rr, SUNMatrix Jac, IDAMem IDA_mem, N_Vector tmp1,
                    N_Vector tmp2, N_Vector tmp3);
+int idaLsSparseDQJac(sunrealtype tt, sunrealtype c_j, N_Vector yy, N_Vector yp,
+                     N_Vector rr, SUNMatrix Jac, IDAMem IDA_mem, N_Vector tmp1,
+                     N_Vector tmp2, N_Vector tmp3);
 
 /* Generic linit/lsetup/lsolve/lperf/lfree interface routines for IDA to call */
 int idaLsInitialize(IDAMem IDA_mem);
@@ -168,6 +184,9 @@ int idaLs_AccessLMem(void* ida_mem, const char* fname, IDAMem* IDA_mem,
 #define MSG_LS_NEG_MAXRS    "maxrs < 0 illegal."
 #define MSG_LS_NEG_EPLIFAC  "eplifac < 0.0 illegal."
 #define MSG_LS_NEG_DQINCFAC "dqincfac < 0.0 illegal."
+#define MSG_LS_NO_PATTERN                                                \
+  "A sparsity pattern is required for the difference quotient Jacobian " \
+  "approximation with a sparse SUNMatrix."
 #define MSG_LS_PSET_FAILED \
   "The preconditioner setup routine failed in an unrecoverable manner."
 #define MSG_LS_PSOLVE_FAILED \
@@ -180,6 +199,8 @@ int idaLs_AccessLMem(void* ida_mem, const char* fname, IDAMem* IDA_mem,
   "The Jacobian routine failed in an unrecoverable manner."
 #define MSG_LS_MATZERO_FAILED \
   "The SUNMatZero routine failed in an unrecoverable manner."
+#define MSG_LS_SUNMAT_FAILED \
+  "A SUNMatrix routine failed in an unrecoverable manner."
 
 /* Warning Messages */
 #define MSG_LS_WARN \
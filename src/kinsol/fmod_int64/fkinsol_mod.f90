@@ -55,6 +55,7 @@ module fkinsol_mod
  integer(C_INT), parameter, public :: KIN_ORTH_ICWY = 1_C_INT
  integer(C_INT), parameter, public :: KIN_ORTH_CGS2 = 2_C_INT
  integer(C_INT), parameter, public :: KIN_ORTH_DCGS2 = 3_C_INT
+ integer(C_INT), parameter, public :: KIN_ORTH_DCGS2_FUSED = 4_C_INT
  integer(C_INT), parameter, public :: KIN_ETACHOICE1 = 1_C_INT
  integer(C_INT), parameter, public :: KIN_ETACHOICE2 = 2_C_INT
  integer(C_INT), parameter, public :: KIN_ETACONSTANT = 3_C_INT
@@ -125,6 +126,7 @@ module fkinsol_mod
  integer(C_INT), parameter, public :: KINLS_SUNLS_FAIL = -8_C_INT
  public :: FKINSetLinearSolver
  public :: FKINSetJacFn
+ public :: FKINSetJacSparsityPattern
  public :: FKINSetPreconditioner
  public :: FKINSetJacTimesVecFn
  public :: FKINGetJac
@@ -583,6 +585,15 @@ type(C_FUNPTR), value :: farg2
 integer(C_INT) :: fresult
 end function
 
+function swigc_FKINSetJacSparsityPattern(farg1, farg2) &
+bind(C, name="_wrap_FKINSetJacSparsityPattern") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+type(C_PTR), value :: farg2
+integer(C_INT) :: fresult
+end function
+
 function swigc_FKINSetPreconditioner(farg1, farg2, farg3) &
 bind(C, name="_wrap_FKINSetPreconditioner") &
 result(fresult)
@@ -1521,6 +1532,22 @@ fresult = swigc_FKINSetJacFn(farg1, farg2)
 swig_result = fresult
 end function
 
+function FKINSetJacSparsityPattern(kinmem, s) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: kinmem
+type(SUNMatrix), target, intent(inout) :: s
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+type(C_PTR) :: farg2 
+
+farg1 = kinmem
+farg2 = c_loc(s)
+fresult = swigc_FKINSetJacSparsityPattern(farg1, farg2)
+swig_result = fresult
+end function
+
 function FKINSetPreconditioner(kinmem, psetup, psolve) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
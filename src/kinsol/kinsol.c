@@ -271,6 +271,14 @@ void* KINCreate(SUNContext sunctx)
   kin_mem->kin_R_aa             = NULL;
   kin_mem->kin_cv               = NULL;
   kin_mem->kin_Xv               = NULL;
+  kin_mem->kin_dots_aa          = NULL;
+  kin_mem->kin_adapt_depth_aa   = SUNFALSE;
+  kin_mem->kin_shrink_aa        = SHRINK_AA_DEFAULT;
+  kin_mem->kin_grow_aa          = GROW_AA_DEFAULT;
+  kin_mem->kin_m_eff_aa         = 0;
+  kin_mem->kin_fnrm_aa          = ZERO;
+  kin_mem->kin_nred_aa          = 0;
+  kin_mem->kin_nflops_aa        = 0;
   kin_mem->kin_lmem             = NULL;
   kin_mem->kin_beta             = ONE;
   kin_mem->kin_damping          = SUNFALSE;
@@ -2611,39 +2619,49 @@ static int AndersonAccQRDelete(KINMem kin_mem, N_Vector* Q, sunrealtype* R,
 {
   /* Delete left-most column vector from QR factorization */
   sunrealtype a, b, temp, c, s;
+  N_Vector vtmp;
+  long int mMax = kin_mem->kin_m_aa;
 
   for (int i = 0; i < depth - 1; i++)
   {
-    a                          = R[(i + 1) * depth + i];
-    b                          = R[(i + 1) * depth + i + 1];
-    temp                       = SUNRsqrt(a * a + b * b);
-    c                          = a / temp;
-    s                          = b / temp;
-    R[(i + 1) * depth + i]     = temp;
-    R[(i + 1) * depth + i + 1] = ZERO;
+    a                         = R[(i + 1) * mMax + i];
+    b                         = R[(i + 1) * mMax + i + 1];
+    temp                      = SUNRsqrt(a * a + b * b);
+    c                         = a / temp;
+    s                         = b / temp;
+    R[(i + 1) * mMax + i]     = temp;
+    R[(i + 1) * mMax + i + 1] = ZERO;
     /* OK to reuse temp */
     if (i < depth - 1)
     {
       for (int j = i + 2; j < depth; j++)
       {
-        a                    = R[j * depth + i];
-        b                    = R[j * depth + i + 1];
-        temp                 = c * a + s * b;
-        R[j * depth + i + 1] = -s * a + c * b;
-        R[j * depth + i]     = temp;
+        a                   = R[j * mMax + i];
+        b                   = R[j * mMax + i + 1];
+        temp                = c * a + s * b;
+        R[j * mMax + i + 1] = -s * a + c * b;
+        R[j * mMax + i]     = temp;
       }
     }
     N_VLinearSum(c, Q[i], s, Q[i + 1], kin_mem->kin_vtemp2);
     N_VLinearSum(-s, Q[i], c, Q[i + 1], Q[i + 1]);
-    N_VScale(ONE, kin_mem->kin_vtemp2, Q[i]);
+
+    /* Swap the rotated column into Q rather than copying it */
+    vtmp                = Q[i];
+    Q[i]                = kin_mem->kin_vtemp2;
+    kin_mem->kin_vtemp2 = vtmp;
+    kin_mem->kin_nflops_aa += 6;
   }
 
+  /* The QRAdd functions use vtemp2 as workspace */
+  kin_mem->kin_qr_data->vtemp = kin_mem->kin_vtemp2;
+
   /* Shift R to the left by one. */
   for (int i = 1; i < depth; i++)
   {
     for (int j = 0; j < depth - 1; j++)
     {
-      R[(i - 1) * depth + j] = R[i * depth + j];
+      R[(i - 1) * mMax + j] = R[i * mMax + j];
     }
   }
 
@@ -2657,13 +2675,16 @@ static int AndersonAccQRDelete(KINMem kin_mem, N_Vector* Q, sunrealtype* R,
         for (int i = 2; i < depth; i++)
         {
           N_VDotProdMultiLocal(i, Q[i - 1], Q,
-                               kin_mem->kin_T_aa + (i - 1) * depth);
+                               kin_mem->kin_T_aa + (i - 1) * mMax);
+          kin_mem->kin_nflops_aa += 2 * i;
         }
-        N_VDotProdMultiAllReduce(depth * depth, Q[depth - 1], kin_mem->kin_T_aa);
+        N_VDotProdMultiAllReduce((int)(mMax * mMax), Q[depth - 1],
+                                 kin_mem->kin_T_aa);
+        kin_mem->kin_nred_aa++;
       }
       for (int i = 1; i < depth; i++)
       {
-        kin_mem->kin_T_aa[(i - 1) * depth + (i - 1)] = ONE;
+        kin_mem->kin_T_aa[(i - 1) * mMax + (i - 1)] = ONE;
       }
     }
     else
@@ -2671,8 +2692,10 @@ static int AndersonAccQRDelete(KINMem kin_mem, N_Vector* Q, sunrealtype* R,
       kin_mem->kin_T_aa[0] = ONE;
       for (int i = 2; i < depth; i++)
       {
-        N_VDotProdMulti(i - 1, Q[i - 1], Q, kin_mem->kin_T_aa + (i - 1) * depth);
-        kin_mem->kin_T_aa[(i - 1) * depth + (i - 1)] = ONE;
+        N_VDotProdMulti(i - 1, Q[i - 1], Q, kin_mem->kin_T_aa + (i - 1) * mMax);
+        kin_mem->kin_T_aa[(i - 1) * mMax + (i - 1)] = ONE;
+        kin_mem->kin_nred_aa++;
+        kin_mem->kin_nflops_aa += 2 * (i - 1);
       }
     }
   }
@@ -2680,6 +2703,217 @@ static int AndersonAccQRDelete(KINMem kin_mem, N_Vector* Q, sunrealtype* R,
   return KIN_SUCCESS;
 }
 
+/* Remove the ncols oldest columns from the acceleration space. The dg and df
+   pointers are rotated so the removed vectors are reused for new columns. */
+static int AndersonAccRemoveOldest(KINMem kin_mem, sunrealtype* R,
+                                   long int ncols)
+{
+  int retval;
+  N_Vector tmp_dg = NULL;
+  N_Vector tmp_df = NULL;
+
+  for (long int j = 0; j < ncols; j++)
+  {
+    tmp_dg = kin_mem->kin_dg_aa[0];
+    tmp_df = kin_mem->kin_df_aa[0];
+    for (long int i = 1; i < kin_mem->kin_current_depth; i++)
+    {
+      kin_mem->kin_dg_aa[i - 1] = kin_mem->kin_dg_aa[i];
+      kin_mem->kin_df_aa[i - 1] = kin_mem->kin_df_aa[i];
+    }
+    kin_mem->kin_dg_aa[kin_mem->kin_current_depth - 1] = tmp_dg;
+    kin_mem->kin_df_aa[kin_mem->kin_current_depth - 1] = tmp_df;
+
+    retval = AndersonAccQRDelete(kin_mem, kin_mem->kin_q_aa, R,
+                                 (int)kin_mem->kin_current_depth);
+    if (retval) { return retval; }
+
+    kin_mem->kin_current_depth--;
+  }
+
+  return KIN_SUCCESS;
+}
+
+/* Add the nominal cost of a QRAdd call with m existing columns to the number
+   of reductions and flops per vector entry */
+static void AndersonAccCountQRAdd(KINMem kin_mem, long int m)
+{
+  switch (kin_mem->kin_orth_aa)
+  {
+  case KIN_ORTH_MGS:
+    kin_mem->kin_nred_aa += m + 1;
+    kin_mem->kin_nflops_aa += 5 * m + 3;
+    break;
+  case KIN_ORTH_ICWY:
+    kin_mem->kin_nred_aa += (kin_mem->kin_dot_prod_sb) ? 2 : 3;
+    kin_mem->kin_nflops_aa += 6 * m + 5;
+    break;
+  case KIN_ORTH_CGS2:
+    kin_mem->kin_nred_aa += 3;
+    kin_mem->kin_nflops_aa += 8 * m + 7;
+    break;
+  default:
+    if (m > 1)
+    {
+      kin_mem->kin_nred_aa += (kin_mem->kin_dot_prod_sb) ? 2 : 3;
+      kin_mem->kin_nflops_aa += 8 * m + 3;
+    }
+    else
+    {
+      kin_mem->kin_nred_aa += 2;
+      kin_mem->kin_nflops_aa += 2 * m + 7;
+    }
+    break;
+  }
+}
+
+/* Add the newest column df to the QR factorization with delayed CGS2 and
+   compute gamma = Q^T fv and ||fv|| in the same global reduction. The
+   reorthogonalization of the previous column corrects the dot products with
+   it, and ||v|| and v^T fv for the new direction v = df - Q Q^T df follow from
+   the Pythagorean identity unless cancellation makes that inaccurate. */
+static int AndersonAccQRAddFused(KINMem kin_mem, N_Vector fv, sunrealtype* R,
+                                 sunrealtype* gamma, sunrealtype* fnrm)
+{
+  int retval;
+  int m           = (int)kin_mem->kin_current_depth - 1;
+  int ndots       = m + m + SUNMAX(m - 1, 0) + 3;
+  long int mMax   = kin_mem->kin_m_aa;
+  N_Vector* Q     = kin_mem->kin_q_aa;
+  N_Vector df     = kin_mem->kin_df_aa[m];
+  sunrealtype* a  = kin_mem->kin_dots_aa; /* Q^T df, df.df, df.fv   */
+  sunrealtype* c  = a + m + 2;            /* Q^T fv, fv.fv          */
+  sunrealtype* s  = c + m + 1;            /* Q_{m-2}^T Q(:,m-1)     */
+  sunrealtype* cv = kin_mem->kin_cv;
+  N_Vector* Xv    = kin_mem->kin_Xv;
+  sunrealtype aa  = ZERO;
+  sunrealtype ac  = ZERO;
+  sunrealtype rho, rho2, vfv;
+  sunrealtype vdots[2];
+
+  /* Xv = [Q_{m-1}, df, fv] so the dot products with df and fv each need one
+     multiple dot product */
+  for (int j = 0; j < m; j++) { Xv[j] = Q[j]; }
+  Xv[m]     = df;
+  Xv[m + 1] = fv;
+
+  retval = 0;
+  if (kin_mem->kin_dot_prod_sb)
+  {
+    retval += N_VDotProdMultiLocal(m + 2, df, Xv, a);
+    Xv[m] = fv;
+    retval += N_VDotProdMultiLocal(m + 1, fv, Xv, c);
+    if (m > 1) { retval += N_VDotProdMultiLocal(m - 1, Q[m - 1], Q, s); }
+    retval += N_VDotProdMultiAllReduce(ndots, df, a);
+    kin_mem->kin_nred_aa++;
+  }
+  else
+  {
+    retval += N_VDotProdMulti(m + 2, df, Xv, a);
+    Xv[m] = fv;
+    retval += N_VDotProdMulti(m + 1, fv, Xv, c);
+    kin_mem->kin_nred_aa += 2;
+    if (m > 1)
+    {
+      retval += N_VDotProdMulti(m - 1, Q[m - 1], Q, s);
+      kin_mem->kin_nred_aa++;
+    }
+  }
+  if (retval) { return KIN_VECTOROP_ERR; }
+  kin_mem->kin_nflops_aa += 2 * ndots;
+
+  /* Delayed reorthogonalization, Q(:,m-1) = Q(:,m-1) - Q_{m-2} s */
+  if (m > 1)
+  {
+    cv[0] = ONE;
+    Xv[0] = Q[m - 1];
+    for (int j = 0; j < m - 1; j++)
+    {
+      cv[j + 1] = -s[j];
+      Xv[j + 1] = Q[j];
+      R[(m - 1) * mMax + j] += s[j];
+      a[m - 1] -= s[j] * a[j];
+      c[m - 1] -= s[j] * c[j];
+    }
+    retval = N_VLinearCombination(m, cv, Xv, Q[m - 1]);
+    if (retval) { return KIN_VECTOROP_ERR; }
+    kin_mem->kin_nflops_aa += 2 * m - 1;
+  }
+
+  /* v = df - Q_{m-1} a */
+  cv[0] = ONE;
+  Xv[0] = df;
+  for (int j = 0; j < m; j++)
+  {
+    cv[j + 1]       = -a[j];
+    Xv[j + 1]       = Q[j];
+    R[m * mMax + j] = a[j];
+    aa += a[j] * a[j];
+    ac += a[j] * c[j];
+  }
+  retval = N_VLinearCombination(m + 1, cv, Xv, Q[m]);
+  if (retval) { return KIN_VECTOROP_ERR; }
+  kin_mem->kin_nflops_aa += 2 * m + 1;
+
+  rho2 = a[m] - aa;
+  vfv  = a[m + 1] - ac;
+
+  if (rho2 <= POINT01 * a[m])
+  {
+    Xv[0]  = Q[m];
+    Xv[1]  = fv;
+    retval = N_VDotProdMulti(2, Q[m], Xv, vdots);
+    if (retval) { return KIN_VECTOROP_ERR; }
+    rho2 = vdots[0];
+    vfv  = vdots[1];
+    kin_mem->kin_nred_aa++;
+    kin_mem->kin_nflops_aa += 4;
+  }
+
+  /* R(m,m) = ||v||, Q(:,m) = v / ||v|| */
+  rho             = SUNRsqrt(rho2);
+  R[m * mMax + m] = rho;
+  N_VScale(ONE / rho, Q[m], Q[m]);
+  kin_mem->kin_nflops_aa += 1;
+
+  /* gamma = Q^T fv */
+  for (int j = 0; j < m; j++) { gamma[j] = c[j]; }
+  gamma[m] = vfv / rho;
+
+  *fnrm = SUNRsqrt(c[m]);
+
+  return KIN_SUCCESS;
+}
+
+/* Update the depth allowed by the adaptive depth policy with the norm of the
+   latest residual. The new depth is used starting with the next iteration. */
+static void AndersonAccAdaptDepth(KINMem kin_mem, sunrealtype fnrm)
+{
+  sunrealtype ratio;
+
+  if (kin_mem->kin_fnrm_aa > ZERO)
+  {
+    ratio = fnrm / kin_mem->kin_fnrm_aa;
+    if (ratio > kin_mem->kin_shrink_aa)
+    {
+      /* poor progress, discard half of the history */
+      kin_mem->kin_m_eff_aa = SUNMAX(kin_mem->kin_m_eff_aa / 2, 1);
+    }
+    else if (ratio < kin_mem->kin_grow_aa)
+    {
+      kin_mem->kin_m_eff_aa = SUNMIN(kin_mem->kin_m_eff_aa + 1,
+                                     kin_mem->kin_m_aa);
+    }
+  }
+
+#if SUNDIALS_LOGGING_LEVEL >= SUNDIALS_LOGGING_INFO
+  KINPrintInfo(kin_mem, PRNT_OTHER, "KINSOL", __func__, "m_eff = %ld",
+               kin_mem->kin_m_eff_aa);
+#endif
+
+  kin_mem->kin_fnrm_aa = fnrm;
+}
+
 static int AndersonAcc(KINMem kin_mem, N_Vector gval, N_Vector fv, N_Vector x,
                        N_Vector xold, long int iter, sunrealtype* R,
                        sunrealtype* gamma)
@@ -2688,6 +2922,9 @@ static int AndersonAcc(KINMem kin_mem, N_Vector gval, N_Vector fv, N_Vector x,
   long int lAA;
   sunrealtype alfa;
   sunrealtype onembeta;
+  sunrealtype fnrm;
+  sunbooleantype fused     = (kin_mem->kin_orth_aa == KIN_ORTH_DCGS2_FUSED);
+  sunbooleantype have_qtfv = SUNFALSE;
 
   /* local shortcuts for fused vector operation */
   int nvec        = 0;
@@ -2696,30 +2933,19 @@ static int AndersonAcc(KINMem kin_mem, N_Vector gval, N_Vector fv, N_Vector x,
 
   /* Compute residual F(x) = G(x_old) - x_old */
   N_VLinearSum(ONE, gval, -ONE, xold, fv);
+  kin_mem->kin_nflops_aa += 3;
 
   if (iter > 0)
   {
     /* If we've filled the acceleration subspace, start recycling */
-    if (kin_mem->kin_current_depth == kin_mem->kin_m_aa)
+    if (kin_mem->kin_current_depth >= kin_mem->kin_m_eff_aa)
     {
-      /* Move the left-most column vector (oldest value) to the end so it gets
-         overwritten with the newest value below. */
-      N_Vector tmp_dg = kin_mem->kin_dg_aa[0];
-      N_Vector tmp_df = kin_mem->kin_df_aa[0];
-      for (long int i = 1; i < kin_mem->kin_m_aa; i++)
-      {
-        kin_mem->kin_dg_aa[i - 1] = kin_mem->kin_dg_aa[i];
-        kin_mem->kin_df_aa[i - 1] = kin_mem->kin_df_aa[i];
-      }
-      kin_mem->kin_dg_aa[kin_mem->kin_m_aa - 1] = tmp_dg;
-      kin_mem->kin_df_aa[kin_mem->kin_m_aa - 1] = tmp_df;
-
-      /* Delete left-most column vector from QR factorization */
-      retval = AndersonAccQRDelete(kin_mem, kin_mem->kin_q_aa, R,
-                                   (int)kin_mem->kin_m_aa);
+      /* Remove the left-most column vectors (oldest values) from the QR
+         factorization so the newest value fits below. */
+      retval = AndersonAccRemoveOldest(kin_mem, R,
+                                       kin_mem->kin_current_depth -
+                                         kin_mem->kin_m_eff_aa + 1);
       if (retval) { return retval; }
-
-      kin_mem->kin_current_depth--;
     }
 
     /* compute dg_new = gval - gval_old */
@@ -2731,6 +2957,7 @@ static int AndersonAcc(KINMem kin_mem, N_Vector gval, N_Vector fv, N_Vector x,
                  kin_mem->kin_df_aa[kin_mem->kin_current_depth]);
 
     kin_mem->kin_current_depth++;
+    kin_mem->kin_nflops_aa += 6;
   }
 
 #if SUNDIALS_LOGGING_LEVEL >= SUNDIALS_LOGGING_INFO
@@ -2738,6 +2965,16 @@ static int AndersonAcc(KINMem kin_mem, N_Vector gval, N_Vector fv, N_Vector x,
                kin_mem->kin_current_depth);
 #endif
 
+  /* The fused QR update computes ||fv|| along with the other dot products */
+  if (kin_mem->kin_adapt_depth_aa &&
+      !(fused && kin_mem->kin_current_depth > 0))
+  {
+    fnrm = SUNRsqrt(N_VDotProd(fv, fv));
+    kin_mem->kin_nred_aa++;
+    kin_mem->kin_nflops_aa += 2;
+    AndersonAccAdaptDepth(kin_mem, fnrm);
+  }
+
   N_VScale(ONE, gval, kin_mem->kin_gold_aa);
   N_VScale(ONE, fv, kin_mem->kin_fold_aa);
 
@@ -2768,6 +3005,7 @@ static int AndersonAcc(KINMem kin_mem, N_Vector gval, N_Vector fv, N_Vector x,
       /* damped fixed point */
       N_VLinearSum((ONE - kin_mem->kin_beta_aa), xold, kin_mem->kin_beta_aa,
                    gval, x);
+      kin_mem->kin_nflops_aa += 3;
     }
     else
     {
@@ -2780,11 +3018,21 @@ static int AndersonAcc(KINMem kin_mem, N_Vector gval, N_Vector fv, N_Vector x,
 
   /* Add a column to the QR factorization */
 
-  if (kin_mem->kin_current_depth == 1)
+  if (fused)
+  {
+    retval = AndersonAccQRAddFused(kin_mem, fv, R, gamma, &fnrm);
+    if (retval) { return retval; }
+    have_qtfv = SUNTRUE;
+
+    if (kin_mem->kin_adapt_depth_aa) { AndersonAccAdaptDepth(kin_mem, fnrm); }
+  }
+  else if (kin_mem->kin_current_depth == 1)
   {
     R[0] = SUNRsqrt(N_VDotProd(kin_mem->kin_df_aa[0], kin_mem->kin_df_aa[0]));
     alfa = ONE / R[0];
     N_VScale(alfa, kin_mem->kin_df_aa[0], kin_mem->kin_q_aa[0]);
+    kin_mem->kin_nred_aa++;
+    kin_mem->kin_nflops_aa += 3;
   }
   else
   {
@@ -2792,6 +3040,7 @@ static int AndersonAcc(KINMem kin_mem, N_Vector gval, N_Vector fv, N_Vector x,
                          kin_mem->kin_df_aa[kin_mem->kin_current_depth - 1],
                          (int)kin_mem->kin_current_depth - 1,
                          (int)kin_mem->kin_m_aa, (void*)kin_mem->kin_qr_data);
+    AndersonAccCountQRAdd(kin_mem, kin_mem->kin_current_depth - 1);
   }
 
   /* Adjust the depth */
@@ -2847,6 +3096,7 @@ static int AndersonAcc(KINMem kin_mem, N_Vector gval, N_Vector fv, N_Vector x,
         /* damped fixed point */
         N_VLinearSum((ONE - kin_mem->kin_beta_aa), xold, kin_mem->kin_beta_aa,
                      gval, x);
+        kin_mem->kin_nflops_aa += 3;
       }
       else
       {
@@ -2862,27 +3112,12 @@ static int AndersonAcc(KINMem kin_mem, N_Vector gval, N_Vector fv, N_Vector x,
     if (new_depth < kin_mem->kin_current_depth)
     {
       /* Remove columns from the left one at a time */
-      N_Vector tmp_dg = NULL;
-      N_Vector tmp_df = NULL;
-
-      for (int j = 0; j < kin_mem->kin_current_depth - new_depth; j++)
-      {
-        tmp_dg = kin_mem->kin_dg_aa[0];
-        tmp_df = kin_mem->kin_df_aa[0];
-        for (long int i = 1; i < kin_mem->kin_current_depth; i++)
-        {
-          kin_mem->kin_dg_aa[i - 1] = kin_mem->kin_dg_aa[i];
-          kin_mem->kin_df_aa[i - 1] = kin_mem->kin_df_aa[i];
-        }
-        kin_mem->kin_dg_aa[kin_mem->kin_current_depth - 1] = tmp_dg;
-        kin_mem->kin_df_aa[kin_mem->kin_current_depth - 1] = tmp_df;
-
-        retval = AndersonAccQRDelete(kin_mem, kin_mem->kin_q_aa, R,
-                                     (int)kin_mem->kin_current_depth);
-        if (retval) { return retval; }
+      retval = AndersonAccRemoveOldest(kin_mem, R,
+                                       kin_mem->kin_current_depth - new_depth);
+      if (retval) { return retval; }
 
-        kin_mem->kin_current_depth--;
-      }
+      /* Q has changed, recompute Q^T fv below */
+      have_qtfv = SUNFALSE;
     }
   }
 
@@ -2890,8 +3125,13 @@ static int AndersonAcc(KINMem kin_mem, N_Vector gval, N_Vector fv, N_Vector x,
   lAA = kin_mem->kin_current_depth;
 
   /* Compute Q^T fv */
-  retval = N_VDotProdMulti((int)lAA, fv, kin_mem->kin_q_aa, gamma);
-  if (retval != KIN_SUCCESS) { return (KIN_VECTOROP_ERR); }
+  if (!have_qtfv)
+  {
+    retval = N_VDotProdMulti((int)lAA, fv, kin_mem->kin_q_aa, gamma);
+    if (retval != KIN_SUCCESS) { return (KIN_VECTOROP_ERR); }
+    kin_mem->kin_nred_aa++;
+    kin_mem->kin_nflops_aa += 2 * lAA;
+  }
 
   /* Compute the damping factor before overwriting gamma below so we can pass
      gamma = Q^T fv (just computed above) to the damping function as it can be
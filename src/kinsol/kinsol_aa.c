@@ -33,6 +33,12 @@ int KINInitAA(KINMem kin_mem)
   // Initialize the current depth
   kin_mem->kin_current_depth = 0;
 
+  // Initialize the adaptive depth policy and the work counters
+  kin_mem->kin_m_eff_aa  = kin_mem->kin_m_aa;
+  kin_mem->kin_fnrm_aa   = SUN_RCONST(0.0);
+  kin_mem->kin_nred_aa   = 0;
+  kin_mem->kin_nflops_aa = 0;
+
   // Do we need to (re)allocate the AA workspace?
   sunbooleantype allocate = kin_mem->kin_m_aa > kin_mem->kin_m_aa_alloc;
 
@@ -131,6 +137,16 @@ int KINInitAA(KINMem kin_mem)
       KINProcessError(kin_mem, 0, __LINE__, __func__, __FILE__, MSG_MEM_FAIL);
       return KIN_MEM_FAIL;
     }
+
+    // Workspace array for the fused QR update reduction
+    kin_mem->kin_dots_aa =
+      (sunrealtype*)malloc(3 * (kin_mem->kin_m_aa + 1) * sizeof(sunrealtype));
+    if (kin_mem->kin_dots_aa == NULL)
+    {
+      KINFreeAA(kin_mem);
+      KINProcessError(kin_mem, 0, __LINE__, __func__, __FILE__, MSG_MEM_FAIL);
+      return KIN_MEM_FAIL;
+    }
   }
 
   return KIN_SUCCESS;
@@ -192,6 +208,12 @@ void KINFreeAA(KINMem kin_mem)
     kin_mem->kin_Xv = NULL;
   }
 
+  if (kin_mem->kin_dots_aa)
+  {
+    free(kin_mem->kin_dots_aa);
+    kin_mem->kin_dots_aa = NULL;
+  }
+
   // Reset AA workspace size
   kin_mem->kin_m_aa_alloc = 0;
 }
@@ -106,6 +106,11 @@ static int kinSetFromCommandLine(void* kinmem, const char* kinid, int argc,
   static const int num_tworeal_keys = sizeof(tworeal_pairs) /
                                       sizeof(*tworeal_pairs);
 
+  static const struct sunKeyIntRealRealPair int_real_real_pairs[] = {
+    {"adaptive_depth_aa", KINSetAdaptiveDepthAA}};
+  static const int num_int_real_real_keys = sizeof(int_real_real_pairs) /
+                                            sizeof(*int_real_real_pairs);
+
   /* Prefix for options to set */
   const char* default_id = "kinsol";
   size_t offset          = strlen(default_id) + 1;
@@ -171,6 +176,19 @@ static int kinSetFromCommandLine(void* kinmem, const char* kinid, int argc,
     }
     if (arg_used) continue;
 
+    /* check all int+real+real command-line options */
+    retval = sunCheckAndSetIntRealRealArgs(kinmem, &idx, argv, offset,
+                                           int_real_real_pairs,
+                                           num_int_real_real_keys, &arg_used, &j);
+    if (retval != KIN_SUCCESS)
+    {
+      KINProcessError(kin_mem, retval, __LINE__, __func__, __FILE__,
+                      "error setting key: %s", int_real_real_pairs[j].key);
+      free(prefix);
+      return retval;
+    }
+    if (arg_used) continue;
+
     /* warn for uninterpreted kinid.X arguments */
     KINProcessError(kin_mem, KIN_WARNING, __LINE__, __func__, __FILE__,
                     "WARNING: key %s was not handled\n", argv[idx]);
@@ -52,6 +52,9 @@ extern "C" {
 #define OMEGA_MIN SUN_RCONST(0.00001)
 #define OMEGA_MAX SUN_RCONST(0.9)
 
+#define SHRINK_AA_DEFAULT SUN_RCONST(1.0)
+#define GROW_AA_DEFAULT   SUN_RCONST(0.9)
+
 /*=================================================================*/
 /* Shortcuts                                                       */
 /*=================================================================*/
@@ -194,7 +197,9 @@ typedef struct KINMemRec
                                  0 - Modified Gram Schmidt (standard)
                                  1 - ICWY Modified Gram Schmidt (Bjorck)
                                  2 - CGS2 (Hernandez)
-                                 3 - Delayed CGS2 (Hernandez)                    */
+                                 3 - Delayed CGS2 (Hernandez)
+                                 4 - Delayed CGS2 fused with the least
+                                     squares reductions                          */
   long int kin_orth_aa_alloc; /* depth (m) used for orthogonalization memory allocations */
   SUNQRAddFn kin_qr_func; /* QRAdd function for AA orthogonalization         */
   SUNQRData kin_qr_data;  /* Additional parameters required for QRAdd routine
@@ -203,6 +208,18 @@ typedef struct KINMemRec
   sunbooleantype kin_dot_prod_sb; /* use single buffer dot product */
   sunrealtype* kin_cv; /* scalar array for fused vector operations        */
   N_Vector* kin_Xv;    /* vector array for fused vector operations        */
+  sunrealtype* kin_dots_aa; /* buffer of size 3*(maa+1) for the fused QR
+                               update reduction                              */
+
+  /* adaptive depth and work counters for AA */
+  sunbooleantype kin_adapt_depth_aa; /* adapt the AA depth to the residual
+                                        reduction                          */
+  sunrealtype kin_shrink_aa; /* halve the depth if ||f_k||/||f_k-1|| > shrink */
+  sunrealtype kin_grow_aa;   /* grow the depth if ||f_k||/||f_k-1|| < grow     */
+  long int kin_m_eff_aa;     /* depth currently allowed by adaptive policy     */
+  sunrealtype kin_fnrm_aa;   /* 2-norm of the previous AA residual             */
+  long int kin_nred_aa;      /* number of global reductions in AA              */
+  long int kin_nflops_aa;    /* number of flops per vector entry in AA         */
 
   /* space requirements for vector storage */
 
@@ -437,6 +454,7 @@ void kinsol_user_supplied_fn_table_destroy(void* ptr);
 #define MSG_BAD_MAA         "maa < 0 illegal."
 #define MSG_BAD_ORTHAA      "Illegal value for orthaa."
 #define MSG_ZERO_MAA        "maa = 0 illegal."
+#define MSG_BAD_ADAPT_AA    "Illegal values for the depth growth and shrink ratios."
 
 #define MSG_LSOLV_NO_MEM       "The linear solver memory pointer is NULL."
 #define MSG_UU_NULL            "uu = NULL illegal."
@@ -191,7 +191,7 @@ int KINSetOrthAA(void* kinmem, int orthaa)
 
   kin_mem = (KINMem)kinmem;
 
-  if ((orthaa < KIN_ORTH_MGS) || (orthaa > KIN_ORTH_DCGS2))
+  if ((orthaa < KIN_ORTH_MGS) || (orthaa > KIN_ORTH_DCGS2_FUSED))
   {
     KINProcessError(kin_mem, KIN_ILL_INPUT, __LINE__, __func__, __FILE__,
                     MSG_BAD_ORTHAA);
@@ -285,6 +285,43 @@ int KINSetDepthFn(void* kinmem, KINDepthFn depth_fn)
   return KIN_SUCCESS;
 }
 
+/*
+ * -----------------------------------------------------------------
+ * Function : KINSetAdaptiveDepthAA
+ * -----------------------------------------------------------------
+ */
+
+int KINSetAdaptiveDepthAA(void* kinmem, int onoff, sunrealtype shrink_ratio,
+                          sunrealtype grow_ratio)
+{
+  KINMem kin_mem;
+
+  if (kinmem == NULL)
+  {
+    KINProcessError(NULL, KIN_MEM_NULL, __LINE__, __func__, __FILE__, MSG_NO_MEM);
+    return (KIN_MEM_NULL);
+  }
+
+  kin_mem = (KINMem)kinmem;
+
+  /* non-positive values select the defaults */
+  if (shrink_ratio <= ZERO) { shrink_ratio = SHRINK_AA_DEFAULT; }
+  if (grow_ratio <= ZERO) { grow_ratio = GROW_AA_DEFAULT; }
+
+  if (grow_ratio > shrink_ratio)
+  {
+    KINProcessError(kin_mem, KIN_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    MSG_BAD_ADAPT_AA);
+    return (KIN_ILL_INPUT);
+  }
+
+  kin_mem->kin_adapt_depth_aa = onoff ? SUNTRUE : SUNFALSE;
+  kin_mem->kin_shrink_aa      = shrink_ratio;
+  kin_mem->kin_grow_aa        = grow_ratio;
+
+  return (KIN_SUCCESS);
+}
+
 /*
  * -----------------------------------------------------------------
  * Function : KINSetReturnNewest
@@ -1048,6 +1085,72 @@ int KINGetNumBacktrackOps(void* kinmem, long int* nbacktr)
   return (KIN_SUCCESS);
 }
 
+/*
+ * -----------------------------------------------------------------
+ * Function : KINGetNumReductionsAA
+ * -----------------------------------------------------------------
+ */
+
+int KINGetNumReductionsAA(void* kinmem, long int* nred)
+{
+  KINMem kin_mem;
+
+  if (kinmem == NULL)
+  {
+    KINProcessError(NULL, KIN_MEM_NULL, __LINE__, __func__, __FILE__, MSG_NO_MEM);
+    return (KIN_MEM_NULL);
+  }
+
+  kin_mem = (KINMem)kinmem;
+  *nred   = kin_mem->kin_nred_aa;
+
+  return (KIN_SUCCESS);
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Function : KINGetNumFlopsAA
+ * -----------------------------------------------------------------
+ */
+
+int KINGetNumFlopsAA(void* kinmem, long int* nflops)
+{
+  KINMem kin_mem;
+
+  if (kinmem == NULL)
+  {
+    KINProcessError(NULL, KIN_MEM_NULL, __LINE__, __func__, __FILE__, MSG_NO_MEM);
+    return (KIN_MEM_NULL);
+  }
+
+  kin_mem = (KINMem)kinmem;
+  *nflops = kin_mem->kin_nflops_aa;
+
+  return (KIN_SUCCESS);
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Function : KINGetCurrentDepthAA
+ * -----------------------------------------------------------------
+ */
+
+int KINGetCurrentDepthAA(void* kinmem, long int* depth)
+{
+  KINMem kin_mem;
+
+  if (kinmem == NULL)
+  {
+    KINProcessError(NULL, KIN_MEM_NULL, __LINE__, __func__, __FILE__, MSG_NO_MEM);
+    return (KIN_MEM_NULL);
+  }
+
+  kin_mem = (KINMem)kinmem;
+  *depth  = kin_mem->kin_current_depth;
+
+  return (KIN_SUCCESS);
+}
+
 /*
  * -----------------------------------------------------------------
  * Function : KINGetFuncNorm
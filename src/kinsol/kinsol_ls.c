@@ -265,6 +265,64 @@ int KINSetJacFn(void* kinmem, KINLsJacFn jac)
   return (KINLS_SUCCESS);
 }
 
+/*------------------------------------------------------------------
+  KINSetJacSparsityPattern specifies the sparsity pattern of the
+  Jacobian for the sparse difference quotient approximation. The
+  column coloring is computed here and reused until a different
+  pattern is supplied. A NULL input removes any stored pattern.
+  ------------------------------------------------------------------*/
+int KINSetJacSparsityPattern(void* kinmem, SUNMatrix S)
+{
+  KINMem kin_mem;
+  KINLsMem kinls_mem;
+  SUNErrCode err;
+  int retval;
+
+  /* access KINLsMem structure */
+  retval = kinLs_AccessLMem(kinmem, __func__, &kin_mem, &kinls_mem);
+  if (retval != KIN_SUCCESS) { return (retval); }
+
+  /* remove the stored pattern */
+  if (S == NULL)
+  {
+    SUNSparseDQ_Destroy(&(kinls_mem->sdq));
+    return (KINLS_SUCCESS);
+  }
+
+  /* the pattern is only used with a sparse system matrix */
+  if ((kinls_mem->J == NULL) ||
+      (SUNMatGetID(kinls_mem->J) != SUNMATRIX_SPARSE) ||
+      (SUNMatGetID(S) != SUNMATRIX_SPARSE))
+  {
+    KINProcessError(kin_mem, KINLS_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "Sparsity pattern requires sparse SUNMatrix inputs");
+    return (KINLS_ILL_INPUT);
+  }
+
+  /* keep the existing coloring if the pattern is unchanged */
+  if (SUNSparseDQ_SamePattern(kinls_mem->sdq, S)) { return (KINLS_SUCCESS); }
+
+  SUNSparseDQ_Destroy(&(kinls_mem->sdq));
+
+  err = SUNSparseDQ_Create(S, &(kinls_mem->sdq));
+  if (err == SUN_ERR_MALLOC_FAIL)
+  {
+    KINProcessError(kin_mem, KINLS_MEM_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_LS_MEM_FAIL);
+    return (KINLS_MEM_FAIL);
+  }
+  if (!err) { err = SUNSparseDQ_CheckMatrix(kinls_mem->sdq, kinls_mem->J); }
+  if (err)
+  {
+    SUNSparseDQ_Destroy(&(kinls_mem->sdq));
+    KINProcessError(kin_mem, KINLS_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "Sparsity pattern is incompatible with the system matrix");
+    return (KINLS_ILL_INPUT);
+  }
+
+  return (KINLS_SUCCESS);
+}
+
 /*------------------------------------------------------------------
   KINSetPreconditioner sets the preconditioner setup and solve
   functions
@@ -707,8 +765,9 @@ int kinLsPSolve(void* kinmem, N_Vector r, N_Vector z,
 /*------------------------------------------------------------------
   kinLsDQJac
 
-  This routine is a wrapper for the Dense and Band implementations
-  of the difference quotient Jacobian approximation routines.
+  This routine is a wrapper for the Dense, Band, and Sparse
+  implementations of the difference quotient Jacobian approximation
+  routines.
   ------------------------------------------------------------------*/
 int kinLsDQJac(N_Vector u, N_Vector fu, SUNMatrix Jac, void* kinmem,
                N_Vector tmp1, N_Vector tmp2)
@@ -742,6 +801,10 @@ int kinLsDQJac(N_Vector u, N_Vector fu, SUNMatrix Jac, void* kinmem,
   {
     retval = kinLsBandDQJac(u, fu, Jac, kin_mem, tmp1, tmp2);
   }
+  else if (SUNMatGetID(Jac) == SUNMATRIX_SPARSE)
+  {
+    retval = kinLsSparseDQJac(u, fu, Jac, kin_mem, tmp1, tmp2);
+  }
   else
   {
     KINProcessError(kin_mem, KIN_ILL_INPUT, __LINE__, __func__, __FILE__,
@@ -926,6 +989,93 @@ int kinLsBandDQJac(N_Vector u, N_Vector fu, SUNMatrix Jac, KINMem kin_mem,
   return (0);
 }
 
+/*------------------------------------------------------------------
+  kinLsSparseDQJac
+
+  This routine generates a sparse difference quotient approximation
+  to the Jacobian of F(u) using the sparsity pattern and column
+  coloring supplied to KINSetJacSparsityPattern. All columns of one
+  color are structurally orthogonal, so they are perturbed together
+  and need a single call to F. The stored pattern is loaded into the
+  CSC or CSR matrix Jac before the difference quotients are
+  scattered into it.
+
+  NOTE: Any type of failure of the system function here leads to an
+        unrecoverable failure of the Jacobian function and thus of
+        the linear solver setup function, stopping KINSOL.
+  ------------------------------------------------------------------*/
+int kinLsSparseDQJac(N_Vector u, N_Vector fu, SUNMatrix Jac, KINMem kin_mem,
+                     N_Vector tmp1, N_Vector tmp2)
+{
+  sunrealtype inc;
+  N_Vector futemp, utemp;
+  sunindextype color, j, k;
+  sunrealtype *fu_data, *futemp_data, *u_data, *utemp_data, *uscale_data;
+  KINLsMem kinls_mem;
+  SUNSparseDQ sdq;
+  int retval = 0;
+
+  /* access LsMem interface structure */
+  kinls_mem = (KINLsMem)kin_mem->kin_lmem;
+  sdq       = kinls_mem->sdq;
+
+  if (sdq == NULL)
+  {
+    KINProcessError(kin_mem, KINLS_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    MSG_LS_NO_PATTERN);
+    return (KINLS_ILL_INPUT);
+  }
+
+  /* load the sparsity pattern into Jac, growing its storage if needed */
+  if (SUNSparseMatrix_NNZ(Jac) < sdq->NNZ)
+  {
+    if (SUNSparseMatrix_Reallocate(Jac, sdq->NNZ)) { return (KINLS_SUNMAT_FAIL); }
+  }
+  if (SUNSparseDQ_LoadPattern(sdq, Jac)) { return (KINLS_SUNMAT_FAIL); }
+
+  /* Rename work vectors for use as temporary values of u and fu */
+  futemp = tmp1;
+  utemp  = tmp2;
+
+  /* Obtain pointers to the data for fu, futemp, u, utemp, uscale */
+  fu_data     = N_VGetArrayPointer(fu);
+  futemp_data = N_VGetArrayPointer(futemp);
+  u_data      = N_VGetArrayPointer(u);
+  uscale_data = N_VGetArrayPointer(kin_mem->kin_uscale);
+  utemp_data  = N_VGetArrayPointer(utemp);
+
+  /* Load utemp with u */
+  N_VScale(ONE, u, utemp);
+
+  for (color = 0; color < sdq->ncolors; color++)
+  {
+    /* Increment all utemp components with this color */
+    for (k = sdq->colorptrs[color]; k < sdq->colorptrs[color + 1]; k++)
+    {
+      j   = sdq->colorcols[k];
+      inc = kin_mem->kin_sqrt_relfunc *
+            SUNMAX(SUNRabs(u_data[j]), ONE / SUNRabs(uscale_data[j]));
+      utemp_data[j] += inc;
+    }
+
+    /* Evaluate f with incremented u */
+    retval = kin_mem->kin_func(utemp, futemp, kin_mem->kin_user_data);
+    kinls_mem->nfeDQ++;
+    if (retval != 0) { return (retval); }
+
+    /* Restore utemp components, then form and load difference quotients */
+    for (k = sdq->colorptrs[color]; k < sdq->colorptrs[color + 1]; k++)
+    {
+      j             = sdq->colorcols[k];
+      inc           = utemp_data[j] - u_data[j];
+      utemp_data[j] = u_data[j];
+      SUNSparseDQ_ScatterColumn(sdq, Jac, j, ONE / inc, futemp_data, fu_data);
+    }
+  }
+
+  return (0);
+}
+
 /*------------------------------------------------------------------
   kinLsDQJtimes
 
@@ -1029,6 +1179,7 @@ int kinLsInitialize(KINMem kin_mem)
   {
     /* If J is non-NULL, and 'jac' is not user-supplied:
        - if A is dense or band, ensure that our DQ approx. is used
+       - if A is sparse, a sparsity pattern must have been supplied
        - otherwise => error */
     retval = 0;
     if (kinls_mem->J->ops->getid)
@@ -1039,6 +1190,18 @@ int kinLsInitialize(KINMem kin_mem)
         kinls_mem->jac    = kinLsDQJac;
         kinls_mem->J_data = kin_mem;
       }
+      else if (SUNMatGetID(kinls_mem->J) == SUNMATRIX_SPARSE)
+      {
+        if (kinls_mem->sdq == NULL)
+        {
+          KINProcessError(kin_mem, KINLS_ILL_INPUT, __LINE__, __func__,
+                          __FILE__, MSG_LS_NO_PATTERN);
+          kinls_mem->last_flag = KINLS_ILL_INPUT;
+          return (KINLS_ILL_INPUT);
+        }
+        kinls_mem->jac    = kinLsDQJac;
+        kinls_mem->J_data = kin_mem;
+      }
       else { retval++; }
     }
     else { retval++; }
@@ -1355,6 +1518,9 @@ int kinLsFree(KINMem kin_mem)
   /* Nullify SUNMatrix pointer */
   kinls_mem->J = NULL;
 
+  /* Free sparse DQ Jacobian coloring */
+  SUNSparseDQ_Destroy(&(kinls_mem->sdq));
+
   /* Free preconditioner memory (if applicable) */
   if (kinls_mem->pfree) { kinls_mem->pfree(kin_mem); }
 
@@ -24,6 +24,7 @@
 #include <kinsol/kinsol_ls.h>
 
 #include "kinsol_impl.h"
+#include "sundials_sparsedq_impl.h"
 
 #ifdef __cplusplus /* wrapper to enable C++ usage */
 extern "C" {
@@ -52,6 +53,8 @@ typedef struct KINLsMemRec
   sunbooleantype jacDQ; /* SUNTRUE if using internal DQ Jacobian approx. */
   KINLsJacFn jac;       /* Jacobian routine to be called                 */
   void* J_data;         /* J_data is passed to jac                       */
+  SUNSparseDQ sdq;      /* sparsity pattern and column coloring for the  *
+                         * sparse DQ Jacobian approximation              */
 
   /* Linear solver, matrix and vector objects/pointers */
   SUNLinearSolver LS; /* generic iterative linear solver object        */
@@ -126,6 +129,9 @@ int kinLsDenseDQJac(N_Vector u, N_Vector fu, SUNMatrix Jac, KINMem kin_mem,
 int kinLsBandDQJac(N_Vector u, N_Vector fu, SUNMatrix Jac, KINMem kin_mem,
                    N_Vector tmp1, N_Vector tmp2);
 
+int kinLsSparseDQJac(N_Vector u, N_Vector fu, SUNMatrix Jac, KINMem kin_mem,
+                     N_Vector tmp1, N_Vector tmp2);
+
 /* Generic linit/lsetup/lsolve/lfree interface routines for KINSOL to call */
 int kinLsInitialize(KINMem kin_mem);
 int kinLsSetup(KINMem kin_mem);
@@ -149,6 +155,9 @@ int kinLs_AccessLMem(void* kinmem, const char* fname, KINMem* kin_mem,
 #define MSG_LS_NEG_MAXRS   "maxrs < 0 illegal."
 #define MSG_LS_BAD_SIZES \
   "Illegal bandwidth parameter(s). Must have 0 <=  ml, mu <= N-1."
+#define MSG_LS_NO_PATTERN                                                \
+  "A sparsity pattern is required for the difference quotient Jacobian " \
+  "approximation with a sparse SUNMatrix."
 
 #define MSG_LS_JACFUNC_FAILED \
   "The Jacobian routine failed in an unrecoverable manner."
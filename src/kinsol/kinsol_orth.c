@@ -105,8 +105,11 @@ int KINInitOrth(KINMem kin_mem)
     kin_mem->kin_qr_data->vtemp2     = kin_mem->kin_vtemp3; // Orth owns
     kin_mem->kin_qr_data->temp_array = kin_mem->kin_cv;     // AA owns
   }
-  else if (kin_mem->kin_orth_aa == KIN_ORTH_DCGS2)
+  else if (kin_mem->kin_orth_aa == KIN_ORTH_DCGS2 ||
+           kin_mem->kin_orth_aa == KIN_ORTH_DCGS2_FUSED)
   {
+    // With KIN_ORTH_DCGS2_FUSED, AndersonAcc performs the QR update itself and
+    // the QRAdd function is not called
     if (kin_mem->kin_dot_prod_sb)
     {
       kin_mem->kin_qr_func = (SUNQRAddFn)SUNQRAdd_DCGS2_SB;
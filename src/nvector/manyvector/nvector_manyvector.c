@@ -156,6 +156,9 @@ N_Vector N_VMake_MPIManyVector(MPI_Comm comm, sunindextype num_subvectors,
   /* single buffer reduction operations */
   v->ops->nvdotprodmultilocal     = N_VDotProdMultiLocal_MPIManyVector;
   v->ops->nvdotprodmultiallreduce = N_VDotProdMultiAllReduce_MPIManyVector;
+  v->ops->nvdotprodmultiallreducebegin =
+    N_VDotProdMultiAllReduceBegin_MPIManyVector;
+  v->ops->nvdotprodmultiallreduceend = N_VDotProdMultiAllReduceEnd_MPIManyVector;
 
   /* XBraid interface operations */
   v->ops->nvbufsize   = N_VBufSize_MPIManyVector;
@@ -180,6 +183,7 @@ N_Vector N_VMake_MPIManyVector(MPI_Comm comm, sunindextype num_subvectors,
   content->comm           = MPI_COMM_NULL;
   content->num_subvectors = num_subvectors;
   content->own_data       = SUNFALSE;
+  content->reduce_request = MPI_REQUEST_NULL;
   content->subvec_array   = NULL;
   content->subvec_array = (N_Vector*)malloc(num_subvectors * sizeof(N_Vector));
   SUNAssertNull(content->subvec_array, SUN_ERR_MALLOC_FAIL);
@@ -1463,6 +1467,39 @@ SUNErrCode N_VDotProdMultiAllReduce_MPIManyVector(int nvec_total, N_Vector x,
 
   return SUN_SUCCESS;
 }
+
+SUNErrCode N_VDotProdMultiAllReduceBegin_MPIManyVector(int nvec_total,
+                                                       N_Vector x,
+                                                       sunrealtype* sum)
+{
+  SUNFunctionBegin(x->sunctx);
+
+  if (MANYVECTOR_COMM(x) == MPI_COMM_NULL) { return SUN_ERR_ARG_CORRUPT; }
+
+  /* only one reduction may be pending on a vector at a time */
+  SUNAssert(MANYVECTOR_CONTENT(x)->reduce_request == MPI_REQUEST_NULL,
+            SUN_ERR_OP_FAIL);
+
+  /* start the reduction, the result is available after the matching end */
+  SUNCheckMPICall(MPI_Iallreduce(MPI_IN_PLACE, sum, nvec_total,
+                                 MPI_SUNREALTYPE, MPI_SUM, MANYVECTOR_COMM(x),
+                                 &(MANYVECTOR_CONTENT(x)->reduce_request)));
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode N_VDotProdMultiAllReduceEnd_MPIManyVector(
+  SUNDIALS_MAYBE_UNUSED int nvec_total, N_Vector x,
+  SUNDIALS_MAYBE_UNUSED sunrealtype* sum)
+{
+  SUNFunctionBegin(x->sunctx);
+
+  /* wait for the pending reduction (if any) to complete */
+  SUNCheckMPICall(
+    MPI_Wait(&(MANYVECTOR_CONTENT(x)->reduce_request), MPI_STATUS_IGNORE));
+
+  return SUN_SUCCESS;
+}
 #endif
 
 /* -----------------------------------------------------------------
@@ -2063,7 +2100,8 @@ static N_Vector ManyVectorClone(N_Vector w, sunbooleantype cloneempty)
 
   /* Set scalar components */
 #ifdef MANYVECTOR_BUILD_WITH_MPI
-  content->comm = MPI_COMM_NULL;
+  content->comm           = MPI_COMM_NULL;
+  content->reduce_request = MPI_REQUEST_NULL;
 #endif
   content->num_subvectors = MANYVECTOR_NUM_SUBVECS(w);
   content->global_length  = MANYVECTOR_GLOBLENGTH(w);
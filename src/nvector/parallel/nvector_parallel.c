@@ -155,8 +155,10 @@ N_Vector N_VNewEmpty_Parallel(MPI_Comm comm, sunindextype local_length,
   v->ops->nvwsqrsummasklocal = N_VWSqrSumMaskLocal_Parallel;
 
   /* single buffer reduction operations */
-  v->ops->nvdotprodmultilocal     = N_VDotProdMultiLocal_Parallel;
-  v->ops->nvdotprodmultiallreduce = N_VDotProdMultiAllReduce_Parallel;
+  v->ops->nvdotprodmultilocal          = N_VDotProdMultiLocal_Parallel;
+  v->ops->nvdotprodmultiallreduce      = N_VDotProdMultiAllReduce_Parallel;
+  v->ops->nvdotprodmultiallreducebegin = N_VDotProdMultiAllReduceBegin_Parallel;
+  v->ops->nvdotprodmultiallreduceend   = N_VDotProdMultiAllReduceEnd_Parallel;
 
   /* XBraid interface operations */
   v->ops->nvbufsize   = N_VBufSize_Parallel;
@@ -176,11 +178,12 @@ N_Vector N_VNewEmpty_Parallel(MPI_Comm comm, sunindextype local_length,
   v->content = content;
 
   /* Initialize content */
-  content->local_length  = local_length;
-  content->global_length = global_length;
-  content->comm          = comm;
-  content->own_data      = SUNFALSE;
-  content->data          = NULL;
+  content->local_length   = local_length;
+  content->global_length  = global_length;
+  content->comm           = comm;
+  content->own_data       = SUNFALSE;
+  content->data           = NULL;
+  content->reduce_request = MPI_REQUEST_NULL;
 
   return (v);
 }
@@ -325,11 +328,12 @@ N_Vector N_VCloneEmpty_Parallel(N_Vector w)
   v->content = content;
 
   /* Initialize content */
-  content->local_length  = NV_LOCLENGTH_P(w);
-  content->global_length = NV_GLOBLENGTH_P(w);
-  content->comm          = NV_COMM_P(w);
-  content->own_data      = SUNFALSE;
-  content->data          = NULL;
+  content->local_length   = NV_LOCLENGTH_P(w);
+  content->global_length  = NV_GLOBLENGTH_P(w);
+  content->comm           = NV_COMM_P(w);
+  content->own_data       = SUNFALSE;
+  content->data           = NULL;
+  content->reduce_request = MPI_REQUEST_NULL;
 
   return (v);
 }
@@ -1191,6 +1195,38 @@ SUNErrCode N_VDotProdMultiAllReduce_Parallel(int nvec, N_Vector x,
   return SUN_SUCCESS;
 }
 
+SUNErrCode N_VDotProdMultiAllReduceBegin_Parallel(int nvec, N_Vector x,
+                                                  sunrealtype* sum)
+{
+  SUNFunctionBegin(x->sunctx);
+
+  SUNAssert(nvec >= 1, SUN_ERR_ARG_OUTOFRANGE);
+
+  /* only one reduction may be pending on a vector at a time */
+  SUNAssert(NV_CONTENT_P(x)->reduce_request == MPI_REQUEST_NULL,
+            SUN_ERR_OP_FAIL);
+
+  /* start the reduction, the result is available after the matching end */
+  SUNCheckMPICall(MPI_Iallreduce(MPI_IN_PLACE, sum, nvec, MPI_SUNREALTYPE,
+                                 MPI_SUM, NV_COMM_P(x),
+                                 &(NV_CONTENT_P(x)->reduce_request)));
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode N_VDotProdMultiAllReduceEnd_Parallel(
+  SUNDIALS_MAYBE_UNUSED int nvec, N_Vector x,
+  SUNDIALS_MAYBE_UNUSED sunrealtype* sum)
+{
+  SUNFunctionBegin(x->sunctx);
+
+  /* wait for the pending reduction (if any) to complete */
+  SUNCheckMPICall(
+    MPI_Wait(&(NV_CONTENT_P(x)->reduce_request), MPI_STATUS_IGNORE));
+
+  return SUN_SUCCESS;
+}
+
 /*
  * -----------------------------------------------------------------
  * vector array operations
@@ -41,6 +41,53 @@
 #define ONE    SUN_RCONST(1.0)
 #define ONEPT5 SUN_RCONST(1.5)
 
+/* Atomic access to the pool dispatch counters and the number of times an
+   idle thread polls for new work before sleeping. Without compiler atomics
+   all accesses are made while holding the pool mutex and idle threads sleep
+   immediately rather than spinning. */
+#if defined(__GNUC__) || defined(__clang__)
+#define NVPT_HAVE_ATOMICS
+#define NVPT_SPIN_COUNT         20000
+#define NVPT_ATOMIC_LOAD(p)     __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define NVPT_ATOMIC_STORE(p, v) __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+#define NVPT_ATOMIC_DEC(p)      __atomic_sub_fetch((p), 1, __ATOMIC_ACQ_REL)
+#else
+#define NVPT_SPIN_COUNT         0
+#define NVPT_ATOMIC_LOAD(p)     (*(p))
+#define NVPT_ATOMIC_STORE(p, v) (*(p) = (v))
+#define NVPT_ATOMIC_DEC(p)      (--(*(p)))
+#endif
+
+/* Persistent thread pool shared by a vector and its clones. The thread
+   calling a vector operation does the work of thread 0 while the remaining
+   num_threads - 1 workers wait for the dispatch counter (epoch) to change.
+   Each worker decrements the pending counter when it finishes and the caller
+   waits for the counter to reach zero before returning (i.e., a barrier). */
+
+typedef struct
+{
+  Pthreads_Pool* pool; /* pool the worker belongs to */
+  int id;              /* worker thread id           */
+} Pthreads_WorkerArg;
+
+struct _Pthreads_Pool
+{
+  int num_threads;            /* number of threads including the caller */
+  int refcount;               /* number of vectors sharing the pool     */
+  pthread_t* workers;         /* worker threads (num_threads - 1)       */
+  Pthreads_WorkerArg* args;   /* worker thread arguments                */
+  Pthreads_Data* thread_data; /* thread data structs (num_threads)      */
+  void* (*func)(void*);       /* companion function to run              */
+  unsigned long epoch;        /* number of dispatches                   */
+  int pending;                /* workers still running the dispatch     */
+  int sleeping;               /* workers waiting on start_cond          */
+  sunbooleantype shutdown;    /* flag to terminate the workers          */
+  pthread_mutex_t run_mutex;  /* serializes operations using the pool   */
+  pthread_mutex_t mutex;      /* lock for the dispatch counters         */
+  pthread_cond_t start_cond;  /* signals workers a dispatch is ready    */
+  pthread_cond_t done_cond;   /* signals caller all workers finished    */
+};
+
 /* Private functions for special cases of vector operations */
 static void VCopy_Pthreads(N_Vector x, N_Vector z);             /* z=x       */
 static void VSum_Pthreads(N_Vector x, N_Vector y, N_Vector z);  /* z=x+y     */
@@ -147,6 +194,16 @@ static void nvSplitLoop(int myid, int* nthreads, sunindextype* N,
 /* Function to initialize thread data */
 static void nvInitThreadData(Pthreads_Data* thread_data);
 
+/* Functions to create, share, and destroy the thread pool */
+static Pthreads_Pool* nvPoolCreate(int num_threads);
+static void nvPoolRetain(Pthreads_Pool* pool);
+static void nvPoolRelease(Pthreads_Pool* pool);
+
+/* Functions to dispatch a companion function to the thread pool */
+static Pthreads_Data* nvPoolAcquire(Pthreads_Pool* pool, int* nthreads);
+static void nvPoolRun(Pthreads_Pool* pool, void* (*func)(void*));
+static void* nvPoolWorker(void* arg);
+
 /*
  * -----------------------------------------------------------------
  * exported functions
@@ -254,6 +311,10 @@ N_Vector N_VNewEmpty_Pthreads(sunindextype length, int num_threads,
   content->own_data    = SUNFALSE;
   content->data        = NULL;
 
+  /* Create the thread pool shared by this vector and its clones */
+  content->pool = nvPoolCreate(num_threads);
+  SUNAssertNull(content->pool, SUN_ERR_OP_FAIL);
+
   return (v);
 }
 
@@ -386,6 +447,10 @@ N_Vector N_VCloneEmpty_Pthreads(N_Vector w)
   content->num_threads = NV_NUM_THREADS_PT(w);
   content->own_data    = SUNFALSE;
   content->data        = NULL;
+  content->pool        = NV_POOL_PT(w);
+
+  /* Share the thread pool with the template vector */
+  nvPoolRetain(content->pool);
 
   return (v);
 }
@@ -440,6 +505,12 @@ void N_VDestroy_Pthreads(N_Vector v)
       free(NV_DATA_PT(v));
       NV_DATA_PT(v) = NULL;
     }
+    /* the last vector using the pool shuts it down */
+    if (NV_POOL_PT(v) != NULL)
+    {
+      nvPoolRelease(NV_POOL_PT(v));
+      NV_POOL_PT(v) = NULL;
+    }
     free(v->content);
     v->content = NULL;
   }
@@ -504,9 +575,7 @@ void N_VLinearSum_Pthreads(sunrealtype a, N_Vector x, sunrealtype b, N_Vector y,
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
   sunrealtype c;
   N_Vector v1, v2;
@@ -587,17 +656,9 @@ void N_VLinearSum_Pthreads(sunrealtype a, N_Vector x, sunrealtype b, N_Vector y,
      (2) a == 0.0, b == other - user should have called N_VScale
      (3) a,b == other, a !=b, a != -b */
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = (pthread_t*)malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
-
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get thread data structs from the thread pool */
+  N           = NV_LENGTH_PT(x);
+  thread_data = nvPoolAcquire(NV_POOL_PT(x), &nthreads);
 
   for (i = 0; i < nthreads; i++)
   {
@@ -613,18 +674,10 @@ void N_VLinearSum_Pthreads(sunrealtype a, N_Vector x, sunrealtype b, N_Vector y,
     thread_data[i].v1 = NV_DATA_PT(x);
     thread_data[i].v2 = NV_DATA_PT(y);
     thread_data[i].v3 = NV_DATA_PT(z);
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvLinearSumPt, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
-
-  /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  /* run companion function on all threads and wait for completion */
+  nvPoolRun(NV_POOL_PT(x), nvLinearSumPt);
 
   return;
 }
@@ -656,7 +709,7 @@ static void* nvLinearSumPt(void* thread_data)
   for (i = start; i < end; i++) { zd[i] = (a * xd[i]) + (b * yd[i]); }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -669,21 +722,11 @@ void N_VConst_Pthreads(sunrealtype c, N_Vector z)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(z);
-  nthreads = NV_NUM_THREADS_PT(z);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
-
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get thread data structs from the thread pool */
+  N           = NV_LENGTH_PT(z);
+  thread_data = nvPoolAcquire(NV_POOL_PT(z), &nthreads);
 
   for (i = 0; i < nthreads; i++)
   {
@@ -696,18 +739,10 @@ void N_VConst_Pthreads(sunrealtype c, N_Vector z)
     /* pack thread data */
     thread_data[i].c1 = c;
     thread_data[i].v1 = NV_DATA_PT(z);
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvConstPt, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
-
-  /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  /* run companion function on all threads and wait for completion */
+  nvPoolRun(NV_POOL_PT(z), nvConstPt);
 
   return;
 }
@@ -736,7 +771,7 @@ static void* nvConstPt(void* thread_data)
   for (i = start; i < end; i++) { zd[i] = c; }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -749,21 +784,11 @@ void N_VProd_Pthreads(N_Vector x, N_Vector y, N_Vector z)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
-
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get thread data structs from the thread pool */
+  N           = NV_LENGTH_PT(x);
+  thread_data = nvPoolAcquire(NV_POOL_PT(x), &nthreads);
 
   for (i = 0; i < nthreads; i++)
   {
@@ -777,18 +802,10 @@ void N_VProd_Pthreads(N_Vector x, N_Vector y, N_Vector z)
     thread_data[i].v1 = NV_DATA_PT(x);
     thread_data[i].v2 = NV_DATA_PT(y);
     thread_data[i].v3 = NV_DATA_PT(z);
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvProdPt, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
-
-  /* clean up and exit */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  /* run companion function on all threads and wait for completion */
+  nvPoolRun(NV_POOL_PT(x), nvProdPt);
 
   return;
 }
@@ -817,7 +834,7 @@ static void* nvProdPt(void* thread_data)
   for (i = start; i < end; i++) { zd[i] = xd[i] * yd[i]; }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -830,21 +847,11 @@ void N_VDiv_Pthreads(N_Vector x, N_Vector y, N_Vector z)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
-
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get thread data structs from the thread pool */
+  N           = NV_LENGTH_PT(x);
+  thread_data = nvPoolAcquire(NV_POOL_PT(x), &nthreads);
 
   for (i = 0; i < nthreads; i++)
   {
@@ -858,18 +865,10 @@ void N_VDiv_Pthreads(N_Vector x, N_Vector y, N_Vector z)
     thread_data[i].v1 = NV_DATA_PT(x);
     thread_data[i].v2 = NV_DATA_PT(y);
     thread_data[i].v3 = NV_DATA_PT(z);
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvDivPt, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
-
-  /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  /* run companion function on all threads and wait for completion */
+  nvPoolRun(NV_POOL_PT(x), nvDivPt);
 
   return;
 }
@@ -898,7 +897,7 @@ static void* nvDivPt(void* thread_data)
   for (i = start; i < end; i++) { zd[i] = xd[i] / yd[i]; }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -911,9 +910,7 @@ void N_VScale_Pthreads(sunrealtype c, N_Vector x, N_Vector z)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
   if (z == x)
   { /* BLAS usage: scale x <- cx */
@@ -933,17 +930,9 @@ void N_VScale_Pthreads(sunrealtype c, N_Vector x, N_Vector z)
   }
   else
   {
-    /* allocate threads and thread data structs */
-    N        = NV_LENGTH_PT(x);
-    nthreads = NV_NUM_THREADS_PT(x);
-    threads  = malloc(nthreads * sizeof(pthread_t));
-    SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
-    thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-    SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
-
-    /* set thread attributes */
-    pthread_attr_init(&attr);
-    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+    /* get thread data structs from the thread pool */
+    N           = NV_LENGTH_PT(x);
+    thread_data = nvPoolAcquire(NV_POOL_PT(x), &nthreads);
 
     for (i = 0; i < nthreads; i++)
     {
@@ -957,18 +946,10 @@ void N_VScale_Pthreads(sunrealtype c, N_Vector x, N_Vector z)
       thread_data[i].c1 = c;
       thread_data[i].v1 = NV_DATA_PT(x);
       thread_data[i].v2 = NV_DATA_PT(z);
-
-      /* create threads and call pthread companion function */
-      pthread_create(&threads[i], &attr, nvScalePt, (void*)&thread_data[i]);
     }
 
-    /* wait for all threads to finish */
-    for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
-
-    /* clean up */
-    pthread_attr_destroy(&attr);
-    free(threads);
-    free(thread_data);
+    /* run companion function on all threads and wait for completion */
+    nvPoolRun(NV_POOL_PT(x), nvScalePt);
   }
 
   return;
@@ -999,7 +980,7 @@ static void* nvScalePt(void* thread_data)
   for (i = start; i < end; i++) { zd[i] = c * xd[i]; }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -1012,21 +993,11 @@ void N_VAbs_Pthreads(N_Vector x, N_Vector z)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
-
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get thread data structs from the thread pool */
+  N           = NV_LENGTH_PT(x);
+  thread_data = nvPoolAcquire(NV_POOL_PT(x), &nthreads);
 
   for (i = 0; i < nthreads; i++)
   {
@@ -1039,18 +1010,10 @@ void N_VAbs_Pthreads(N_Vector x, N_Vector z)
     /* pack thread data */
     thread_data[i].v1 = NV_DATA_PT(x);
     thread_data[i].v2 = NV_DATA_PT(z);
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvAbsPt, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
-
-  /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  /* run companion function on all threads and wait for completion */
+  nvPoolRun(NV_POOL_PT(x), nvAbsPt);
 
   return;
 }
@@ -1078,7 +1041,7 @@ static void* nvAbsPt(void* thread_data)
   for (i = start; i < end; i++) { zd[i] = SUNRabs(xd[i]); }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -1091,21 +1054,11 @@ void N_VInv_Pthreads(N_Vector x, N_Vector z)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
-
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get thread data structs from the thread pool */
+  N           = NV_LENGTH_PT(x);
+  thread_data = nvPoolAcquire(NV_POOL_PT(x), &nthreads);
 
   for (i = 0; i < nthreads; i++)
   {
@@ -1118,18 +1071,10 @@ void N_VInv_Pthreads(N_Vector x, N_Vector z)
     /* pack thread data */
     thread_data[i].v1 = NV_DATA_PT(x);
     thread_data[i].v2 = NV_DATA_PT(z);
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvInvPt, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
-
-  /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  /* run companion function on all threads and wait for completion */
+  nvPoolRun(NV_POOL_PT(x), nvInvPt);
 
   return;
 }
@@ -1157,7 +1102,7 @@ static void* nvInvPt(void* thread_data)
   for (i = start; i < end; i++) { zd[i] = ONE / xd[i]; }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -1170,21 +1115,11 @@ void N_VAddConst_Pthreads(N_Vector x, sunrealtype b, N_Vector z)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
-
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get thread data structs from the thread pool */
+  N           = NV_LENGTH_PT(x);
+  thread_data = nvPoolAcquire(NV_POOL_PT(x), &nthreads);
 
   for (i = 0; i < nthreads; i++)
   {
@@ -1198,18 +1133,10 @@ void N_VAddConst_Pthreads(N_Vector x, sunrealtype b, N_Vector z)
     thread_data[i].c1 = b;
     thread_data[i].v1 = NV_DATA_PT(x);
     thread_data[i].v2 = NV_DATA_PT(z);
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvAddConstPt, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
-
-  /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  /* run companion function on all threads and wait for completion */
+  nvPoolRun(NV_POOL_PT(x), nvAddConstPt);
 
   return;
 }
@@ -1239,7 +1166,7 @@ static void* nvAddConstPt(void* thread_data)
   for (i = start; i < end; i++) { zd[i] = xd[i] + b; }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -1252,23 +1179,13 @@ sunrealtype N_VDotProd_Pthreads(N_Vector x, N_Vector y)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
   pthread_mutex_t global_mutex;
   sunrealtype sum = ZERO;
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
-
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get thread data structs from the thread pool */
+  N           = NV_LENGTH_PT(x);
+  thread_data = nvPoolAcquire(NV_POOL_PT(x), &nthreads);
 
   /* lock for reduction */
   pthread_mutex_init(&global_mutex, NULL);
@@ -1286,19 +1203,13 @@ sunrealtype N_VDotProd_Pthreads(N_Vector x, N_Vector y)
     thread_data[i].v2           = NV_DATA_PT(y);
     thread_data[i].global_val   = &sum;
     thread_data[i].global_mutex = &global_mutex;
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvDotProdPt, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on all threads and wait for completion */
+  nvPoolRun(NV_POOL_PT(x), nvDotProdPt);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
   pthread_mutex_destroy(&global_mutex);
-  free(threads);
-  free(thread_data);
 
   return (sum);
 }
@@ -1337,7 +1248,7 @@ static void* nvDotProdPt(void* thread_data)
   pthread_mutex_unlock(global_mutex);
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -1350,23 +1261,13 @@ sunrealtype N_VMaxNorm_Pthreads(N_Vector x)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
   pthread_mutex_t global_mutex;
   sunrealtype max = ZERO;
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
-
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get thread data structs from the thread pool */
+  N           = NV_LENGTH_PT(x);
+  thread_data = nvPoolAcquire(NV_POOL_PT(x), &nthreads);
 
   /* lock for reduction */
   pthread_mutex_init(&global_mutex, NULL);
@@ -1383,19 +1284,13 @@ sunrealtype N_VMaxNorm_Pthreads(N_Vector x)
     thread_data[i].v1           = NV_DATA_PT(x);
     thread_data[i].global_val   = &max;
     thread_data[i].global_mutex = &global_mutex;
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvMaxNormPt, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on all threads and wait for completion */
+  nvPoolRun(NV_POOL_PT(x), nvMaxNormPt);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
   pthread_mutex_destroy(&global_mutex);
-  free(threads);
-  free(thread_data);
 
   return (max);
 }
@@ -1436,7 +1331,7 @@ static void* nvMaxNormPt(void* thread_data)
   pthread_mutex_unlock(global_mutex);
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -1461,23 +1356,13 @@ sunrealtype N_VWSqrSumLocal_Pthreads(N_Vector x, N_Vector w)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
   pthread_mutex_t global_mutex;
   sunrealtype sum = ZERO;
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
-
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get thread data structs from the thread pool */
+  N           = NV_LENGTH_PT(x);
+  thread_data = nvPoolAcquire(NV_POOL_PT(x), &nthreads);
 
   /* lock for reduction */
   pthread_mutex_init(&global_mutex, NULL);
@@ -1495,19 +1380,13 @@ sunrealtype N_VWSqrSumLocal_Pthreads(N_Vector x, N_Vector w)
     thread_data[i].v2           = NV_DATA_PT(w);
     thread_data[i].global_val   = &sum;
     thread_data[i].global_mutex = &global_mutex;
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvWSqrSumPt, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on all threads and wait for completion */
+  nvPoolRun(NV_POOL_PT(x), nvWSqrSumPt);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
   pthread_mutex_destroy(&global_mutex);
-  free(threads);
-  free(thread_data);
 
   return (sum);
 }
@@ -1546,7 +1425,7 @@ static void* nvWSqrSumPt(void* thread_data)
   pthread_mutex_unlock(global_mutex);
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -1571,23 +1450,13 @@ sunrealtype N_VWSqrSumMaskLocal_Pthreads(N_Vector x, N_Vector w, N_Vector id)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
   pthread_mutex_t global_mutex;
   sunrealtype sum = ZERO;
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
-
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get thread data structs from the thread pool */
+  N           = NV_LENGTH_PT(x);
+  thread_data = nvPoolAcquire(NV_POOL_PT(x), &nthreads);
 
   /* lock for reduction */
   pthread_mutex_init(&global_mutex, NULL);
@@ -1606,19 +1475,13 @@ sunrealtype N_VWSqrSumMaskLocal_Pthreads(N_Vector x, N_Vector w, N_Vector id)
     thread_data[i].v3           = NV_DATA_PT(id);
     thread_data[i].global_val   = &sum;
     thread_data[i].global_mutex = &global_mutex;
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvWSqrSumMaskPt, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on all threads and wait for completion */
+  nvPoolRun(NV_POOL_PT(x), nvWSqrSumMaskPt);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
   pthread_mutex_destroy(&global_mutex);
-  free(threads);
-  free(thread_data);
 
   return (sum);
 }
@@ -1661,7 +1524,7 @@ static void* nvWSqrSumMaskPt(void* thread_data)
   pthread_mutex_unlock(global_mutex);
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -1674,26 +1537,16 @@ sunrealtype N_VMin_Pthreads(N_Vector x)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
   pthread_mutex_t global_mutex;
   sunrealtype min;
 
   /* initialize global min */
   min = NV_Ith_PT(x, 0);
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
-
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get thread data structs from the thread pool */
+  N           = NV_LENGTH_PT(x);
+  thread_data = nvPoolAcquire(NV_POOL_PT(x), &nthreads);
 
   /* lock for reduction */
   pthread_mutex_init(&global_mutex, NULL);
@@ -1710,19 +1563,13 @@ sunrealtype N_VMin_Pthreads(N_Vector x)
     thread_data[i].v1           = NV_DATA_PT(x);
     thread_data[i].global_val   = &min;
     thread_data[i].global_mutex = &global_mutex;
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvMinPt, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on all threads and wait for completion */
+  nvPoolRun(NV_POOL_PT(x), nvMinPt);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
   pthread_mutex_destroy(&global_mutex);
-  free(threads);
-  free(thread_data);
 
   return (min);
 }
@@ -1763,7 +1610,7 @@ static void* nvMinPt(void* thread_data)
   pthread_mutex_unlock(global_mutex);
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -1776,23 +1623,13 @@ sunrealtype N_VWL2Norm_Pthreads(N_Vector x, N_Vector w)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
   pthread_mutex_t global_mutex;
   sunrealtype sum = ZERO;
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
-
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get thread data structs from the thread pool */
+  N           = NV_LENGTH_PT(x);
+  thread_data = nvPoolAcquire(NV_POOL_PT(x), &nthreads);
 
   /* lock for reduction */
   pthread_mutex_init(&global_mutex, NULL);
@@ -1810,19 +1647,13 @@ sunrealtype N_VWL2Norm_Pthreads(N_Vector x, N_Vector w)
     thread_data[i].v2           = NV_DATA_PT(w);
     thread_data[i].global_val   = &sum;
     thread_data[i].global_mutex = &global_mutex;
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvWL2NormPt, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on all threads and wait for completion */
+  nvPoolRun(NV_POOL_PT(x), nvWL2NormPt);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
   pthread_mutex_destroy(&global_mutex);
-  free(threads);
-  free(thread_data);
 
   return (SUNRsqrt(sum));
 }
@@ -1861,7 +1692,7 @@ static void* nvWL2NormPt(void* thread_data)
   pthread_mutex_unlock(global_mutex);
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -1874,23 +1705,13 @@ sunrealtype N_VL1Norm_Pthreads(N_Vector x)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
   pthread_mutex_t global_mutex;
   sunrealtype sum = ZERO;
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
-
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get thread data structs from the thread pool */
+  N           = NV_LENGTH_PT(x);
+  thread_data = nvPoolAcquire(NV_POOL_PT(x), &nthreads);
 
   /* lock for reduction */
   pthread_mutex_init(&global_mutex, NULL);
@@ -1907,19 +1728,13 @@ sunrealtype N_VL1Norm_Pthreads(N_Vector x)
     thread_data[i].v1           = NV_DATA_PT(x);
     thread_data[i].global_val   = &sum;
     thread_data[i].global_mutex = &global_mutex;
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvL1NormPt, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on all threads and wait for completion */
+  nvPoolRun(NV_POOL_PT(x), nvL1NormPt);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
   pthread_mutex_destroy(&global_mutex);
-  free(threads);
-  free(thread_data);
 
   return (sum);
 }
@@ -1957,7 +1772,7 @@ static void* nvL1NormPt(void* thread_data)
   pthread_mutex_unlock(global_mutex);
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -1970,21 +1785,11 @@ void N_VCompare_Pthreads(sunrealtype c, N_Vector x, N_Vector z)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
-
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get thread data structs from the thread pool */
+  N           = NV_LENGTH_PT(x);
+  thread_data = nvPoolAcquire(NV_POOL_PT(x), &nthreads);
 
   for (i = 0; i < nthreads; i++)
   {
@@ -1998,18 +1803,10 @@ void N_VCompare_Pthreads(sunrealtype c, N_Vector x, N_Vector z)
     thread_data[i].c1 = c;
     thread_data[i].v1 = NV_DATA_PT(x);
     thread_data[i].v2 = NV_DATA_PT(z);
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvComparePt, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
-
-  /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  /* run companion function on all threads and wait for completion */
+  nvPoolRun(NV_POOL_PT(x), nvComparePt);
 
   return;
 }
@@ -2039,7 +1836,7 @@ static void* nvComparePt(void* thread_data)
   for (i = start; i < end; i++) { zd[i] = (SUNRabs(xd[i]) >= c) ? ONE : ZERO; }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -2052,23 +1849,13 @@ sunbooleantype N_VInvTest_Pthreads(N_Vector x, N_Vector z)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
   sunrealtype val = ZERO;
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
-
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get thread data structs from the thread pool */
+  N           = NV_LENGTH_PT(x);
+  thread_data = nvPoolAcquire(NV_POOL_PT(x), &nthreads);
 
   for (i = 0; i < nthreads; i++)
   {
@@ -2082,18 +1869,12 @@ sunbooleantype N_VInvTest_Pthreads(N_Vector x, N_Vector z)
     thread_data[i].v1         = NV_DATA_PT(x);
     thread_data[i].v2         = NV_DATA_PT(z);
     thread_data[i].global_val = &val;
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvInvTestPt, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on all threads and wait for completion */
+  nvPoolRun(NV_POOL_PT(x), nvInvTestPt);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
 
   if (val > ZERO) { return (SUNFALSE); }
   else { return (SUNTRUE); }
@@ -2133,7 +1914,7 @@ static void* nvInvTestPt(void* thread_data)
   if (local_val > ZERO) { *global_val = local_val; }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -2146,23 +1927,13 @@ sunbooleantype N_VConstrMask_Pthreads(N_Vector c, N_Vector x, N_Vector m)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
   sunrealtype val = ZERO;
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
-
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get thread data structs from the thread pool */
+  N           = NV_LENGTH_PT(x);
+  thread_data = nvPoolAcquire(NV_POOL_PT(x), &nthreads);
 
   for (i = 0; i < nthreads; i++)
   {
@@ -2177,18 +1948,12 @@ sunbooleantype N_VConstrMask_Pthreads(N_Vector c, N_Vector x, N_Vector m)
     thread_data[i].v2         = NV_DATA_PT(x);
     thread_data[i].v3         = NV_DATA_PT(m);
     thread_data[i].global_val = &val;
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvConstrMaskPt, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on all threads and wait for completion */
+  nvPoolRun(NV_POOL_PT(x), nvConstrMaskPt);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
 
   if (val > ZERO) { return (SUNFALSE); }
   else { return (SUNTRUE); }
@@ -2238,7 +2003,7 @@ static void* nvConstrMaskPt(void* thread_data)
   if (local_val > ZERO) { *global_val = local_val; }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -2251,23 +2016,13 @@ sunrealtype N_VMinQuotient_Pthreads(N_Vector num, N_Vector denom)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
   pthread_mutex_t global_mutex;
   sunrealtype min = SUN_BIG_REAL;
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(num);
-  nthreads = NV_NUM_THREADS_PT(num);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
-
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get thread data structs from the thread pool */
+  N           = NV_LENGTH_PT(num);
+  thread_data = nvPoolAcquire(NV_POOL_PT(num), &nthreads);
 
   /* lock for reduction */
   pthread_mutex_init(&global_mutex, NULL);
@@ -2285,19 +2040,13 @@ sunrealtype N_VMinQuotient_Pthreads(N_Vector num, N_Vector denom)
     thread_data[i].v2           = NV_DATA_PT(denom);
     thread_data[i].global_val   = &min;
     thread_data[i].global_mutex = &global_mutex;
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvMinQuotientPt, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on all threads and wait for completion */
+  nvPoolRun(NV_POOL_PT(num), nvMinQuotientPt);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
   pthread_mutex_destroy(&global_mutex);
-  free(threads);
-  free(thread_data);
 
   return (min);
 }
@@ -2340,7 +2089,7 @@ static void* nvMinQuotientPt(void* thread_data)
   pthread_mutex_unlock(global_mutex);
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /*
@@ -2360,9 +2109,7 @@ SUNErrCode N_VLinearCombination_Pthreads(int nvec, sunrealtype* c, N_Vector* X,
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
   /* invalid number of vectors */
   SUNAssert(nvec >= 1, SUN_ERR_ARG_OUTOFRANGE);
@@ -2383,17 +2130,9 @@ SUNErrCode N_VLinearCombination_Pthreads(int nvec, sunrealtype* c, N_Vector* X,
     return SUN_SUCCESS;
   }
 
-  /* get vector length and data array */
-  N        = NV_LENGTH_PT(z);
-  nthreads = NV_NUM_THREADS_PT(z);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
-
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get vector length and thread data structs */
+  N           = NV_LENGTH_PT(z);
+  thread_data = nvPoolAcquire(NV_POOL_PT(z), &nthreads);
 
   for (i = 0; i < nthreads; i++)
   {
@@ -2408,19 +2147,10 @@ SUNErrCode N_VLinearCombination_Pthreads(int nvec, sunrealtype* c, N_Vector* X,
     thread_data[i].cvals = c;
     thread_data[i].Y1    = X;
     thread_data[i].x1    = z;
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvLinearCombinationPt,
-                   (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
-
-  /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  /* run companion function on all threads and wait for completion */
+  nvPoolRun(NV_POOL_PT(z), nvLinearCombinationPt);
 
   return SUN_SUCCESS;
 }
@@ -2458,7 +2188,7 @@ static void* nvLinearCombinationPt(void* thread_data)
       xd = NV_DATA_PT(my_data->Y1[i]);
       for (j = start; j < end; j++) { zd[j] += c[i] * xd[j]; }
     }
-    pthread_exit(NULL);
+    return (NULL);
   }
 
   /*
@@ -2472,7 +2202,7 @@ static void* nvLinearCombinationPt(void* thread_data)
       xd = NV_DATA_PT(my_data->Y1[i]);
       for (j = start; j < end; j++) { zd[j] += c[i] * xd[j]; }
     }
-    pthread_exit(NULL);
+    return (NULL);
   }
 
   /*
@@ -2485,7 +2215,7 @@ static void* nvLinearCombinationPt(void* thread_data)
     xd = NV_DATA_PT(my_data->Y1[i]);
     for (j = start; j < end; j++) { zd[j] += c[i] * xd[j]; }
   }
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* -----------------------------------------------------------------------------
@@ -2499,9 +2229,7 @@ SUNErrCode N_VScaleAddMulti_Pthreads(int nvec, sunrealtype* a, N_Vector x,
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
   /* invalid number of vectors */
   SUNAssert(nvec >= 1, SUN_ERR_ARG_OUTOFRANGE);
@@ -2514,17 +2242,9 @@ SUNErrCode N_VScaleAddMulti_Pthreads(int nvec, sunrealtype* a, N_Vector x,
     return SUN_SUCCESS;
   }
 
-  /* get vector length and data array */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
-
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get vector length and thread data structs */
+  N           = NV_LENGTH_PT(x);
+  thread_data = nvPoolAcquire(NV_POOL_PT(x), &nthreads);
 
   for (i = 0; i < nthreads; i++)
   {
@@ -2540,18 +2260,10 @@ SUNErrCode N_VScaleAddMulti_Pthreads(int nvec, sunrealtype* a, N_Vector x,
     thread_data[i].x1    = x;
     thread_data[i].Y1    = Y;
     thread_data[i].Y2    = Z;
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvScaleAddMultiPt, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
-
-  /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  /* run companion function on all threads and wait for completion */
+  nvPoolRun(NV_POOL_PT(x), nvScaleAddMultiPt);
 
   return SUN_SUCCESS;
 }
@@ -2590,7 +2302,7 @@ static void* nvScaleAddMultiPt(void* thread_data)
       yd = NV_DATA_PT(my_data->Y1[i]);
       for (j = start; j < end; j++) { yd[j] += a[i] * xd[j]; }
     }
-    pthread_exit(NULL);
+    return (NULL);
   }
 
   /*
@@ -2602,7 +2314,7 @@ static void* nvScaleAddMultiPt(void* thread_data)
     zd = NV_DATA_PT(my_data->Y2[i]);
     for (j = start; j < end; j++) { zd[j] = a[i] * xd[j] + yd[j]; }
   }
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* -----------------------------------------------------------------------------
@@ -2616,9 +2328,7 @@ SUNErrCode N_VDotProdMulti_Pthreads(int nvec, N_Vector x, N_Vector* Y,
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
   pthread_mutex_t global_mutex;
 
   /* invalid number of vectors */
@@ -2635,17 +2345,9 @@ SUNErrCode N_VDotProdMulti_Pthreads(int nvec, N_Vector x, N_Vector* Y,
   /* initialize output array */
   for (i = 0; i < nvec; i++) { dotprods[i] = ZERO; }
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
-
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get thread data structs from the thread pool */
+  N           = NV_LENGTH_PT(x);
+  thread_data = nvPoolAcquire(NV_POOL_PT(x), &nthreads);
 
   /* lock for reduction */
   pthread_mutex_init(&global_mutex, NULL);
@@ -2665,19 +2367,13 @@ SUNErrCode N_VDotProdMulti_Pthreads(int nvec, N_Vector x, N_Vector* Y,
     thread_data[i].cvals = dotprods;
 
     thread_data[i].global_mutex = &global_mutex;
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvDotProdMultiPt, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on all threads and wait for completion */
+  nvPoolRun(NV_POOL_PT(x), nvDotProdMultiPt);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
   pthread_mutex_destroy(&global_mutex);
-  free(threads);
-  free(thread_data);
 
   return SUN_SUCCESS;
 }
@@ -2721,7 +2417,7 @@ static void* nvDotProdMultiPt(void* thread_data)
   }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /*
@@ -2742,9 +2438,7 @@ SUNErrCode N_VLinearSumVectorArray_Pthreads(int nvec, sunrealtype a,
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
   sunrealtype c;
   N_Vector* V1;
@@ -2839,17 +2533,9 @@ SUNErrCode N_VLinearSumVectorArray_Pthreads(int nvec, sunrealtype a,
   /*   (2) a == 0.0, b == other - user should have called N_VScale */
   /*   (3) a,b == other, a !=b, a != -b                            */
 
-  /* get vector length and data array */
-  N        = NV_LENGTH_PT(Z[0]);
-  nthreads = NV_NUM_THREADS_PT(Z[0]);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
-
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get vector length and thread data structs */
+  N           = NV_LENGTH_PT(Z[0]);
+  thread_data = nvPoolAcquire(NV_POOL_PT(Z[0]), &nthreads);
 
   for (i = 0; i < nthreads; i++)
   {
@@ -2866,19 +2552,10 @@ SUNErrCode N_VLinearSumVectorArray_Pthreads(int nvec, sunrealtype a,
     thread_data[i].Y1   = X;
     thread_data[i].Y2   = Y;
     thread_data[i].Y3   = Z;
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvLinearSumVectorArrayPt,
-                   (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
-
-  /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  /* run companion function on all threads and wait for completion */
+  nvPoolRun(NV_POOL_PT(Z[0]), nvLinearSumVectorArrayPt);
 
   return SUN_SUCCESS;
 }
@@ -2917,7 +2594,7 @@ static void* nvLinearSumVectorArrayPt(void* thread_data)
   }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* -----------------------------------------------------------------------------
@@ -2931,9 +2608,7 @@ SUNErrCode N_VScaleVectorArray_Pthreads(int nvec, sunrealtype* c, N_Vector* X,
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
   /* invalid number of vectors */
   SUNAssert(nvec >= 1, SUN_ERR_ARG_OUTOFRANGE);
@@ -2946,17 +2621,9 @@ SUNErrCode N_VScaleVectorArray_Pthreads(int nvec, sunrealtype* c, N_Vector* X,
     return SUN_SUCCESS;
   }
 
-  /* get vector length and data array */
-  N        = NV_LENGTH_PT(Z[0]);
-  nthreads = NV_NUM_THREADS_PT(Z[0]);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
-
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get vector length and thread data structs */
+  N           = NV_LENGTH_PT(Z[0]);
+  thread_data = nvPoolAcquire(NV_POOL_PT(Z[0]), &nthreads);
 
   for (i = 0; i < nthreads; i++)
   {
@@ -2971,19 +2638,10 @@ SUNErrCode N_VScaleVectorArray_Pthreads(int nvec, sunrealtype* c, N_Vector* X,
     thread_data[i].cvals = c;
     thread_data[i].Y1    = X;
     thread_data[i].Y2    = Z;
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvScaleVectorArrayPt,
-                   (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
-
-  /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  /* run companion function on all threads and wait for completion */
+  nvPoolRun(NV_POOL_PT(Z[0]), nvScaleVectorArrayPt);
 
   return SUN_SUCCESS;
 }
@@ -3020,7 +2678,7 @@ static void* nvScaleVectorArrayPt(void* thread_data)
       xd = NV_DATA_PT(my_data->Y1[i]);
       for (j = start; j < end; j++) { xd[j] *= c[i]; }
     }
-    pthread_exit(NULL);
+    return (NULL);
   }
 
   /*
@@ -3032,7 +2690,7 @@ static void* nvScaleVectorArrayPt(void* thread_data)
     zd = NV_DATA_PT(my_data->Y2[i]);
     for (j = start; j < end; j++) { zd[j] = c[i] * xd[j]; }
   }
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* -----------------------------------------------------------------------------
@@ -3045,9 +2703,7 @@ SUNErrCode N_VConstVectorArray_Pthreads(int nvec, sunrealtype c, N_Vector* Z)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
   /* invalid number of vectors */
   SUNAssert(nvec >= 1, SUN_ERR_ARG_OUTOFRANGE);
@@ -3060,17 +2716,9 @@ SUNErrCode N_VConstVectorArray_Pthreads(int nvec, sunrealtype c, N_Vector* Z)
     return SUN_SUCCESS;
   }
 
-  /* get vector length and data array */
-  N        = NV_LENGTH_PT(Z[0]);
-  nthreads = NV_NUM_THREADS_PT(Z[0]);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
-
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get vector length and thread data structs */
+  N           = NV_LENGTH_PT(Z[0]);
+  thread_data = nvPoolAcquire(NV_POOL_PT(Z[0]), &nthreads);
 
   for (i = 0; i < nthreads; i++)
   {
@@ -3084,19 +2732,10 @@ SUNErrCode N_VConstVectorArray_Pthreads(int nvec, sunrealtype c, N_Vector* Z)
     thread_data[i].nvec = nvec;
     thread_data[i].c1   = c;
     thread_data[i].Y1   = Z;
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvConstVectorArrayPt,
-                   (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
-
-  /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  /* run companion function on all threads and wait for completion */
+  nvPoolRun(NV_POOL_PT(Z[0]), nvConstVectorArrayPt);
 
   return SUN_SUCCESS;
 }
@@ -3127,7 +2766,7 @@ static void* nvConstVectorArrayPt(void* thread_data)
   }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -3141,9 +2780,7 @@ SUNErrCode N_VWrmsNormVectorArray_Pthreads(int nvec, N_Vector* X, N_Vector* W,
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
   pthread_mutex_t global_mutex;
 
   /* invalid number of vectors */
@@ -3160,17 +2797,9 @@ SUNErrCode N_VWrmsNormVectorArray_Pthreads(int nvec, N_Vector* X, N_Vector* W,
   /* initialize output array */
   for (i = 0; i < nvec; i++) { nrm[i] = ZERO; }
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(X[0]);
-  nthreads = NV_NUM_THREADS_PT(X[0]);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
-
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get thread data structs from the thread pool */
+  N           = NV_LENGTH_PT(X[0]);
+  thread_data = nvPoolAcquire(NV_POOL_PT(X[0]), &nthreads);
 
   /* lock for reduction */
   pthread_mutex_init(&global_mutex, NULL);
@@ -3190,23 +2819,16 @@ SUNErrCode N_VWrmsNormVectorArray_Pthreads(int nvec, N_Vector* X, N_Vector* W,
     thread_data[i].cvals = nrm;
 
     thread_data[i].global_mutex = &global_mutex;
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvWrmsNormVectorArrayPt,
-                   (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on all threads and wait for completion */
+  nvPoolRun(NV_POOL_PT(X[0]), nvWrmsNormVectorArrayPt);
 
   /* finalize wrms calculation */
   for (i = 0; i < nvec; i++) { nrm[i] = SUNRsqrt(nrm[i] / N); }
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
   pthread_mutex_destroy(&global_mutex);
-  free(threads);
-  free(thread_data);
 
   return SUN_SUCCESS;
 }
@@ -3250,7 +2872,7 @@ static void* nvWrmsNormVectorArrayPt(void* thread_data)
   }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -3264,9 +2886,7 @@ SUNErrCode N_VWrmsNormMaskVectorArray_Pthreads(int nvec, N_Vector* X, N_Vector*
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
   pthread_mutex_t global_mutex;
 
   /* invalid number of vectors */
@@ -3283,17 +2903,9 @@ SUNErrCode N_VWrmsNormMaskVectorArray_Pthreads(int nvec, N_Vector* X, N_Vector*
   /* initialize output array */
   for (i = 0; i < nvec; i++) { nrm[i] = ZERO; }
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(X[0]);
-  nthreads = NV_NUM_THREADS_PT(X[0]);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
-
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get thread data structs from the thread pool */
+  N           = NV_LENGTH_PT(X[0]);
+  thread_data = nvPoolAcquire(NV_POOL_PT(X[0]), &nthreads);
 
   /* lock for reduction */
   pthread_mutex_init(&global_mutex, NULL);
@@ -3314,23 +2926,16 @@ SUNErrCode N_VWrmsNormMaskVectorArray_Pthreads(int nvec, N_Vector* X, N_Vector*
     thread_data[i].cvals = nrm;
 
     thread_data[i].global_mutex = &global_mutex;
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvWrmsNormMaskVectorArrayPt,
-                   (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on all threads and wait for completion */
+  nvPoolRun(NV_POOL_PT(X[0]), nvWrmsNormMaskVectorArrayPt);
 
   /* finalize wrms calculation */
   for (i = 0; i < nvec; i++) { nrm[i] = SUNRsqrt(nrm[i] / N); }
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
   pthread_mutex_destroy(&global_mutex);
-  free(threads);
-  free(thread_data);
 
   return SUN_SUCCESS;
 }
@@ -3379,7 +2984,7 @@ static void* nvWrmsNormMaskVectorArrayPt(void* thread_data)
   }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* -----------------------------------------------------------------------------
@@ -3394,9 +2999,7 @@ SUNErrCode N_VScaleAddMultiVectorArray_Pthreads(int nvec, int nsum,
 
   sunindextype N;
   int i, j, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
   N_Vector* YY;
   N_Vector* ZZ;
@@ -3452,17 +3055,9 @@ SUNErrCode N_VScaleAddMultiVectorArray_Pthreads(int nvec, int nsum,
    * Compute multiple linear sums
    * ---------------------------- */
 
-  /* get vector length and data array */
-  N        = NV_LENGTH_PT(X[0]);
-  nthreads = NV_NUM_THREADS_PT(X[0]);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
-
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get vector length and thread data structs */
+  N           = NV_LENGTH_PT(X[0]);
+  thread_data = nvPoolAcquire(NV_POOL_PT(X[0]), &nthreads);
 
   for (i = 0; i < nthreads; i++)
   {
@@ -3479,19 +3074,10 @@ SUNErrCode N_VScaleAddMultiVectorArray_Pthreads(int nvec, int nsum,
     thread_data[i].Y1    = X;
     thread_data[i].ZZ1   = Y;
     thread_data[i].ZZ2   = Z;
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvScaleAddMultiVectorArrayPt,
-                   (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
-
-  /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  /* run companion function on all threads and wait for completion */
+  nvPoolRun(NV_POOL_PT(X[0]), nvScaleAddMultiVectorArrayPt);
 
   return SUN_SUCCESS;
 }
@@ -3533,7 +3119,7 @@ static void* nvScaleAddMultiVectorArrayPt(void* thread_data)
         for (k = start; k < end; k++) { yd[k] += a[j] * xd[k]; }
       }
     }
-    pthread_exit(NULL);
+    return (NULL);
   }
 
   /*
@@ -3549,7 +3135,7 @@ static void* nvScaleAddMultiVectorArrayPt(void* thread_data)
       for (k = start; k < end; k++) { zd[k] = a[j] * xd[k] + yd[k]; }
     }
   }
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* -----------------------------------------------------------------------------
@@ -3564,9 +3150,7 @@ SUNErrCode N_VLinearCombinationVectorArray_Pthreads(int nvec, int nsum,
 
   sunindextype N;
   int i, j, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
   sunrealtype* ctmp;
   N_Vector* Y;
@@ -3637,17 +3221,9 @@ SUNErrCode N_VLinearCombinationVectorArray_Pthreads(int nvec, int nsum,
    * Compute linear combination
    * -------------------------- */
 
-  /* get vector length and data array */
-  N        = NV_LENGTH_PT(Z[0]);
-  nthreads = NV_NUM_THREADS_PT(Z[0]);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
-
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get vector length and thread data structs */
+  N           = NV_LENGTH_PT(Z[0]);
+  thread_data = nvPoolAcquire(NV_POOL_PT(Z[0]), &nthreads);
 
   for (i = 0; i < nthreads; i++)
   {
@@ -3663,19 +3239,10 @@ SUNErrCode N_VLinearCombinationVectorArray_Pthreads(int nvec, int nsum,
     thread_data[i].cvals = c;
     thread_data[i].ZZ1   = X;
     thread_data[i].Y1    = Z;
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvLinearCombinationVectorArrayPt,
-                   (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
-
-  /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  /* run companion function on all threads and wait for completion */
+  nvPoolRun(NV_POOL_PT(Z[0]), nvLinearCombinationVectorArrayPt);
 
   return SUN_SUCCESS;
 }
@@ -3717,7 +3284,7 @@ static void* nvLinearCombinationVectorArrayPt(void* thread_data)
         for (k = start; k < end; k++) { zd[k] += c[i] * xd[k]; }
       }
     }
-    pthread_exit(NULL);
+    return (NULL);
   }
 
   /*
@@ -3735,7 +3302,7 @@ static void* nvLinearCombinationVectorArrayPt(void* thread_data)
         for (k = start; k < end; k++) { zd[k] += c[i] * xd[k]; }
       }
     }
-    pthread_exit(NULL);
+    return (NULL);
   }
 
   /*
@@ -3752,7 +3319,7 @@ static void* nvLinearCombinationVectorArrayPt(void* thread_data)
       for (k = start; k < end; k++) { zd[k] += c[i] * xd[k]; }
     }
   }
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /*
@@ -3781,23 +3348,13 @@ SUNErrCode N_VBufPack_Pthreads(N_Vector x, void* buf)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
   SUNAssert(buf, SUN_ERR_ARG_CORRUPT);
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
-
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get thread data structs from the thread pool */
+  N           = NV_LENGTH_PT(x);
+  thread_data = nvPoolAcquire(NV_POOL_PT(x), &nthreads);
 
   for (i = 0; i < nthreads; i++)
   {
@@ -3810,18 +3367,10 @@ SUNErrCode N_VBufPack_Pthreads(N_Vector x, void* buf)
     /* pack thread data */
     thread_data[i].v1 = NV_DATA_PT(x);
     thread_data[i].v2 = (sunrealtype*)buf;
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, VBufPack_PT, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
-
-  /* clean up */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  /* run companion function on all threads and wait for completion */
+  nvPoolRun(NV_POOL_PT(x), VBufPack_PT);
 
   return SUN_SUCCESS;
 }
@@ -3849,7 +3398,7 @@ static void* VBufPack_PT(void* thread_data)
   for (i = start; i < end; i++) { bd[i] = xd[i]; }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* -----------------------------------------------------------------------------
@@ -3862,23 +3411,13 @@ SUNErrCode N_VBufUnpack_Pthreads(N_Vector x, void* buf)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
   SUNAssert(buf, SUN_ERR_ARG_CORRUPT);
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
-
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get thread data structs from the thread pool */
+  N           = NV_LENGTH_PT(x);
+  thread_data = nvPoolAcquire(NV_POOL_PT(x), &nthreads);
 
   for (i = 0; i < nthreads; i++)
   {
@@ -3891,18 +3430,10 @@ SUNErrCode N_VBufUnpack_Pthreads(N_Vector x, void* buf)
     /* pack thread data */
     thread_data[i].v1 = NV_DATA_PT(x);
     thread_data[i].v2 = (sunrealtype*)buf;
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, VBufUnpack_PT, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
-
-  /* clean up */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  /* run companion function on all threads and wait for completion */
+  nvPoolRun(NV_POOL_PT(x), VBufUnpack_PT);
 
   return SUN_SUCCESS;
 }
@@ -3930,7 +3461,7 @@ static void* VBufUnpack_PT(void* thread_data)
   for (i = start; i < end; i++) { xd[i] = bd[i]; }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /*
@@ -3949,21 +3480,11 @@ static void VCopy_Pthreads(N_Vector x, N_Vector z)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
-
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get thread data structs from the thread pool */
+  N           = NV_LENGTH_PT(x);
+  thread_data = nvPoolAcquire(NV_POOL_PT(x), &nthreads);
 
   for (i = 0; i < nthreads; i++)
   {
@@ -3976,18 +3497,10 @@ static void VCopy_Pthreads(N_Vector x, N_Vector z)
     /* pack thread data */
     thread_data[i].v1 = NV_DATA_PT(x);
     thread_data[i].v2 = NV_DATA_PT(z);
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, VCopy_PT, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
-
-  /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  /* run companion function on all threads and wait for completion */
+  nvPoolRun(NV_POOL_PT(x), VCopy_PT);
 
   return;
 }
@@ -4015,7 +3528,7 @@ static void* VCopy_PT(void* thread_data)
   for (i = start; i < end; i++) { zd[i] = xd[i]; }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -4028,21 +3541,11 @@ static void VSum_Pthreads(N_Vector x, N_Vector y, N_Vector z)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
-
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get thread data structs from the thread pool */
+  N           = NV_LENGTH_PT(x);
+  thread_data = nvPoolAcquire(NV_POOL_PT(x), &nthreads);
 
   for (i = 0; i < nthreads; i++)
   {
@@ -4056,18 +3559,10 @@ static void VSum_Pthreads(N_Vector x, N_Vector y, N_Vector z)
     thread_data[i].v1 = NV_DATA_PT(x);
     thread_data[i].v2 = NV_DATA_PT(y);
     thread_data[i].v3 = NV_DATA_PT(z);
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, VSum_PT, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
-
-  /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  /* run companion function on all threads and wait for completion */
+  nvPoolRun(NV_POOL_PT(x), VSum_PT);
 
   return;
 }
@@ -4096,7 +3591,7 @@ static void* VSum_PT(void* thread_data)
   for (i = start; i < end; i++) { zd[i] = xd[i] + yd[i]; }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -4109,21 +3604,11 @@ static void VDiff_Pthreads(N_Vector x, N_Vector y, N_Vector z)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
-
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get thread data structs from the thread pool */
+  N           = NV_LENGTH_PT(x);
+  thread_data = nvPoolAcquire(NV_POOL_PT(x), &nthreads);
 
   for (i = 0; i < nthreads; i++)
   {
@@ -4137,18 +3622,10 @@ static void VDiff_Pthreads(N_Vector x, N_Vector y, N_Vector z)
     thread_data[i].v1 = NV_DATA_PT(x);
     thread_data[i].v2 = NV_DATA_PT(y);
     thread_data[i].v3 = NV_DATA_PT(z);
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, VDiff_PT, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
-
-  /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  /* run companion function on all threads and wait for completion */
+  nvPoolRun(NV_POOL_PT(x), VDiff_PT);
 
   return;
 }
@@ -4177,7 +3654,7 @@ static void* VDiff_PT(void* thread_data)
   for (i = start; i < end; i++) { zd[i] = xd[i] - yd[i]; }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -4190,21 +3667,11 @@ static void VNeg_Pthreads(N_Vector x, N_Vector z)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
-
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get thread data structs from the thread pool */
+  N           = NV_LENGTH_PT(x);
+  thread_data = nvPoolAcquire(NV_POOL_PT(x), &nthreads);
 
   for (i = 0; i < nthreads; i++)
   {
@@ -4217,18 +3684,10 @@ static void VNeg_Pthreads(N_Vector x, N_Vector z)
     /* pack thread data */
     thread_data[i].v1 = NV_DATA_PT(x);
     thread_data[i].v2 = NV_DATA_PT(z);
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, VNeg_PT, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
-
-  /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  /* run companion function on all threads and wait for completion */
+  nvPoolRun(NV_POOL_PT(x), VNeg_PT);
 
   return;
 }
@@ -4256,7 +3715,7 @@ static void* VNeg_PT(void* thread_data)
   for (i = start; i < end; i++) { zd[i] = -xd[i]; }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -4269,21 +3728,11 @@ static void VScaleSum_Pthreads(sunrealtype c, N_Vector x, N_Vector y, N_Vector z
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
-
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get thread data structs from the thread pool */
+  N           = NV_LENGTH_PT(x);
+  thread_data = nvPoolAcquire(NV_POOL_PT(x), &nthreads);
 
   for (i = 0; i < nthreads; i++)
   {
@@ -4298,18 +3747,10 @@ static void VScaleSum_Pthreads(sunrealtype c, N_Vector x, N_Vector y, N_Vector z
     thread_data[i].v1 = NV_DATA_PT(x);
     thread_data[i].v2 = NV_DATA_PT(y);
     thread_data[i].v3 = NV_DATA_PT(z);
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, VScaleSum_PT, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
-
-  /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  /* run companion function on all threads and wait for completion */
+  nvPoolRun(NV_POOL_PT(x), VScaleSum_PT);
 
   return;
 }
@@ -4340,7 +3781,7 @@ static void* VScaleSum_PT(void* thread_data)
   for (i = start; i < end; i++) { zd[i] = c * (xd[i] + yd[i]); }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -4353,21 +3794,11 @@ static void VScaleDiff_Pthreads(sunrealtype c, N_Vector x, N_Vector y, N_Vector
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
-
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get thread data structs from the thread pool */
+  N           = NV_LENGTH_PT(x);
+  thread_data = nvPoolAcquire(NV_POOL_PT(x), &nthreads);
 
   for (i = 0; i < nthreads; i++)
   {
@@ -4382,18 +3813,10 @@ static void VScaleDiff_Pthreads(sunrealtype c, N_Vector x, N_Vector y, N_Vector
     thread_data[i].v1 = NV_DATA_PT(x);
     thread_data[i].v2 = NV_DATA_PT(y);
     thread_data[i].v3 = NV_DATA_PT(z);
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, VScaleDiff_PT, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
-
-  /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  /* run companion function on all threads and wait for completion */
+  nvPoolRun(NV_POOL_PT(x), VScaleDiff_PT);
 
   return;
 }
@@ -4424,7 +3847,7 @@ static void* VScaleDiff_PT(void* thread_data)
   for (i = start; i < end; i++) { zd[i] = c * (xd[i] - yd[i]); }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -4437,21 +3860,11 @@ static void VLin1_Pthreads(sunrealtype a, N_Vector x, N_Vector y, N_Vector z)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
-
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get thread data structs from the thread pool */
+  N           = NV_LENGTH_PT(x);
+  thread_data = nvPoolAcquire(NV_POOL_PT(x), &nthreads);
 
   for (i = 0; i < nthreads; i++)
   {
@@ -4466,18 +3879,10 @@ static void VLin1_Pthreads(sunrealtype a, N_Vector x, N_Vector y, N_Vector z)
     thread_data[i].v1 = NV_DATA_PT(x);
     thread_data[i].v2 = NV_DATA_PT(y);
     thread_data[i].v3 = NV_DATA_PT(z);
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, VLin1_PT, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
-
-  /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  /* run companion function on all threads and wait for completion */
+  nvPoolRun(NV_POOL_PT(x), VLin1_PT);
 
   return;
 }
@@ -4508,7 +3913,7 @@ static void* VLin1_PT(void* thread_data)
   for (i = start; i < end; i++) { zd[i] = (a * xd[i]) + yd[i]; }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -4521,21 +3926,11 @@ static void VLin2_Pthreads(sunrealtype a, N_Vector x, N_Vector y, N_Vector z)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
-
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get thread data structs from the thread pool */
+  N           = NV_LENGTH_PT(x);
+  thread_data = nvPoolAcquire(NV_POOL_PT(x), &nthreads);
 
   for (i = 0; i < nthreads; i++)
   {
@@ -4550,18 +3945,10 @@ static void VLin2_Pthreads(sunrealtype a, N_Vector x, N_Vector y, N_Vector z)
     thread_data[i].v1 = NV_DATA_PT(x);
     thread_data[i].v2 = NV_DATA_PT(y);
     thread_data[i].v3 = NV_DATA_PT(z);
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, VLin2_PT, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
-
-  /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  /* run companion function on all threads and wait for completion */
+  nvPoolRun(NV_POOL_PT(x), VLin2_PT);
 
   return;
 }
@@ -4592,7 +3979,7 @@ static void* VLin2_PT(void* thread_data)
   for (i = start; i < end; i++) { zd[i] = (a * xd[i]) - yd[i]; }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -4605,21 +3992,11 @@ static void Vaxpy_Pthreads(sunrealtype a, N_Vector x, N_Vector y)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
-
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get thread data structs from the thread pool */
+  N           = NV_LENGTH_PT(x);
+  thread_data = nvPoolAcquire(NV_POOL_PT(x), &nthreads);
 
   for (i = 0; i < nthreads; i++)
   {
@@ -4633,18 +4010,10 @@ static void Vaxpy_Pthreads(sunrealtype a, N_Vector x, N_Vector y)
     thread_data[i].c1 = a;
     thread_data[i].v1 = NV_DATA_PT(x);
     thread_data[i].v2 = NV_DATA_PT(y);
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, Vaxpy_PT, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
-
-  /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  /* run companion function on all threads and wait for completion */
+  nvPoolRun(NV_POOL_PT(x), Vaxpy_PT);
 
   return;
 }
@@ -4676,7 +4045,7 @@ static void* Vaxpy_PT(void* thread_data)
     for (i = start; i < end; i++) { yd[i] += xd[i]; }
 
     /* exit */
-    pthread_exit(NULL);
+    return (NULL);
   }
 
   if (a == -ONE)
@@ -4684,13 +4053,13 @@ static void* Vaxpy_PT(void* thread_data)
     for (i = start; i < end; i++) { yd[i] -= xd[i]; }
 
     /* exit */
-    pthread_exit(NULL);
+    return (NULL);
   }
 
   for (i = start; i < end; i++) { yd[i] += a * xd[i]; }
 
   /* return */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -4703,21 +4072,11 @@ static void VScaleBy_Pthreads(sunrealtype a, N_Vector x)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
-
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get thread data structs from the thread pool */
+  N           = NV_LENGTH_PT(x);
+  thread_data = nvPoolAcquire(NV_POOL_PT(x), &nthreads);
 
   for (i = 0; i < nthreads; i++)
   {
@@ -4730,18 +4089,10 @@ static void VScaleBy_Pthreads(sunrealtype a, N_Vector x)
     /* pack thread data */
     thread_data[i].c1 = a;
     thread_data[i].v1 = NV_DATA_PT(x);
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, VScaleBy_PT, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
-
-  /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  /* run companion function on all threads and wait for completion */
+  nvPoolRun(NV_POOL_PT(x), VScaleBy_PT);
 
   return;
 }
@@ -4770,7 +4121,7 @@ static void* VScaleBy_PT(void* thread_data)
   for (i = start; i < end; i++) { xd[i] *= a; }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /*
@@ -4786,23 +4137,13 @@ static void VSumVectorArray_Pthreads(int nvec, N_Vector* X, N_Vector* Y,
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(X[0]);
-  nthreads = NV_NUM_THREADS_PT(X[0]);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
-
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get thread data structs from the thread pool */
+  N           = NV_LENGTH_PT(X[0]);
+  thread_data = nvPoolAcquire(NV_POOL_PT(X[0]), &nthreads);
 
-  /* pack thread data, distribute loop indices, and create threads/call kernel */
+  /* pack thread data and distribute loop indices */
   for (i = 0; i < nthreads; i++)
   {
     nvInitThreadData(&thread_data[i]);
@@ -4813,18 +4154,10 @@ static void VSumVectorArray_Pthreads(int nvec, N_Vector* X, N_Vector* Y,
     thread_data[i].Y3   = Z;
 
     nvSplitLoop(i, &nthreads, &N, &thread_data[i].start, &thread_data[i].end);
-
-    pthread_create(&threads[i], &attr, VSumVectorArray_PT,
-                   (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
-
-  /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  /* run companion function on all threads and wait for completion */
+  nvPoolRun(NV_POOL_PT(X[0]), VSumVectorArray_PT);
 }
 
 static void* VSumVectorArray_PT(void* thread_data)
@@ -4849,7 +4182,7 @@ static void* VSumVectorArray_PT(void* thread_data)
     for (j = start; j < end; j++) { zd[j] = xd[j] + yd[j]; }
   }
 
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 static void VDiffVectorArray_Pthreads(int nvec, N_Vector* X, N_Vector* Y,
@@ -4859,23 +4192,13 @@ static void VDiffVectorArray_Pthreads(int nvec, N_Vector* X, N_Vector* Y,
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
-
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(X[0]);
-  nthreads = NV_NUM_THREADS_PT(X[0]);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get thread data structs from the thread pool */
+  N           = NV_LENGTH_PT(X[0]);
+  thread_data = nvPoolAcquire(NV_POOL_PT(X[0]), &nthreads);
 
-  /* pack thread data, distribute loop indices, and create threads/call kernel */
+  /* pack thread data and distribute loop indices */
   for (i = 0; i < nthreads; i++)
   {
     nvInitThreadData(&thread_data[i]);
@@ -4886,18 +4209,10 @@ static void VDiffVectorArray_Pthreads(int nvec, N_Vector* X, N_Vector* Y,
     thread_data[i].Y3   = Z;
 
     nvSplitLoop(i, &nthreads, &N, &thread_data[i].start, &thread_data[i].end);
-
-    pthread_create(&threads[i], &attr, VDiffVectorArray_PT,
-                   (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
-
-  /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  /* run companion function on all threads and wait for completion */
+  nvPoolRun(NV_POOL_PT(X[0]), VDiffVectorArray_PT);
 }
 
 static void* VDiffVectorArray_PT(void* thread_data)
@@ -4922,7 +4237,7 @@ static void* VDiffVectorArray_PT(void* thread_data)
     for (j = start; j < end; j++) { zd[j] = xd[j] - yd[j]; }
   }
 
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 static void VScaleSumVectorArray_Pthreads(int nvec, sunrealtype c, N_Vector* X,
@@ -4932,23 +4247,13 @@ static void VScaleSumVectorArray_Pthreads(int nvec, sunrealtype c, N_Vector* X,
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(X[0]);
-  nthreads = NV_NUM_THREADS_PT(X[0]);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
+  /* get thread data structs from the thread pool */
+  N           = NV_LENGTH_PT(X[0]);
+  thread_data = nvPoolAcquire(NV_POOL_PT(X[0]), &nthreads);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-
-  /* pack thread data, distribute loop indices, and create threads/call kernel */
+  /* pack thread data and distribute loop indices */
   for (i = 0; i < nthreads; i++)
   {
     nvInitThreadData(&thread_data[i]);
@@ -4960,18 +4265,10 @@ static void VScaleSumVectorArray_Pthreads(int nvec, sunrealtype c, N_Vector* X,
     thread_data[i].Y3   = Z;
 
     nvSplitLoop(i, &nthreads, &N, &thread_data[i].start, &thread_data[i].end);
-
-    pthread_create(&threads[i], &attr, VScaleSumVectorArray_PT,
-                   (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
-
-  /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  /* run companion function on all threads and wait for completion */
+  nvPoolRun(NV_POOL_PT(X[0]), VScaleSumVectorArray_PT);
 }
 
 static void* VScaleSumVectorArray_PT(void* thread_data)
@@ -4998,7 +4295,7 @@ static void* VScaleSumVectorArray_PT(void* thread_data)
     for (j = start; j < end; j++) { zd[j] = c * (xd[j] + yd[j]); }
   }
 
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 static void VScaleDiffVectorArray_Pthreads(int nvec, sunrealtype c, N_Vector* X,
@@ -5008,23 +4305,13 @@ static void VScaleDiffVectorArray_Pthreads(int nvec, sunrealtype c, N_Vector* X,
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
-
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(X[0]);
-  nthreads = NV_NUM_THREADS_PT(X[0]);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get thread data structs from the thread pool */
+  N           = NV_LENGTH_PT(X[0]);
+  thread_data = nvPoolAcquire(NV_POOL_PT(X[0]), &nthreads);
 
-  /* pack thread data, distribute loop indices, and create threads/call kernel */
+  /* pack thread data and distribute loop indices */
   for (i = 0; i < nthreads; i++)
   {
     nvInitThreadData(&thread_data[i]);
@@ -5036,18 +4323,10 @@ static void VScaleDiffVectorArray_Pthreads(int nvec, sunrealtype c, N_Vector* X,
     thread_data[i].Y3   = Z;
 
     nvSplitLoop(i, &nthreads, &N, &thread_data[i].start, &thread_data[i].end);
-
-    pthread_create(&threads[i], &attr, VScaleDiffVectorArray_PT,
-                   (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
-
-  /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  /* run companion function on all threads and wait for completion */
+  nvPoolRun(NV_POOL_PT(X[0]), VScaleDiffVectorArray_PT);
 }
 
 static void* VScaleDiffVectorArray_PT(void* thread_data)
@@ -5074,7 +4353,7 @@ static void* VScaleDiffVectorArray_PT(void* thread_data)
     for (j = start; j < end; j++) { zd[j] = c * (xd[j] - yd[j]); }
   }
 
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 static void VLin1VectorArray_Pthreads(int nvec, sunrealtype a, N_Vector* X,
@@ -5084,23 +4363,13 @@ static void VLin1VectorArray_Pthreads(int nvec, sunrealtype a, N_Vector* X,
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(X[0]);
-  nthreads = NV_NUM_THREADS_PT(X[0]);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
-
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get thread data structs from the thread pool */
+  N           = NV_LENGTH_PT(X[0]);
+  thread_data = nvPoolAcquire(NV_POOL_PT(X[0]), &nthreads);
 
-  /* pack thread data, distribute loop indices, and create threads/call kernel */
+  /* pack thread data and distribute loop indices */
   for (i = 0; i < nthreads; i++)
   {
     nvInitThreadData(&thread_data[i]);
@@ -5112,18 +4381,10 @@ static void VLin1VectorArray_Pthreads(int nvec, sunrealtype a, N_Vector* X,
     thread_data[i].Y3   = Z;
 
     nvSplitLoop(i, &nthreads, &N, &thread_data[i].start, &thread_data[i].end);
-
-    pthread_create(&threads[i], &attr, VLin1VectorArray_PT,
-                   (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
-
-  /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  /* run companion function on all threads and wait for completion */
+  nvPoolRun(NV_POOL_PT(X[0]), VLin1VectorArray_PT);
 }
 
 static void* VLin1VectorArray_PT(void* thread_data)
@@ -5150,7 +4411,7 @@ static void* VLin1VectorArray_PT(void* thread_data)
     for (j = start; j < end; j++) { zd[j] = (a * xd[j]) + yd[j]; }
   }
 
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 static void VLin2VectorArray_Pthreads(int nvec, sunrealtype a, N_Vector* X,
@@ -5160,23 +4421,13 @@ static void VLin2VectorArray_Pthreads(int nvec, sunrealtype a, N_Vector* X,
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
-
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(X[0]);
-  nthreads = NV_NUM_THREADS_PT(X[0]);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get thread data structs from the thread pool */
+  N           = NV_LENGTH_PT(X[0]);
+  thread_data = nvPoolAcquire(NV_POOL_PT(X[0]), &nthreads);
 
-  /* pack thread data, distribute loop indices, and create threads/call kernel */
+  /* pack thread data and distribute loop indices */
   for (i = 0; i < nthreads; i++)
   {
     nvInitThreadData(&thread_data[i]);
@@ -5188,18 +4439,10 @@ static void VLin2VectorArray_Pthreads(int nvec, sunrealtype a, N_Vector* X,
     thread_data[i].Y3   = Z;
 
     nvSplitLoop(i, &nthreads, &N, &thread_data[i].start, &thread_data[i].end);
-
-    pthread_create(&threads[i], &attr, VLin2VectorArray_PT,
-                   (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
-
-  /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  /* run companion function on all threads and wait for completion */
+  nvPoolRun(NV_POOL_PT(X[0]), VLin2VectorArray_PT);
 }
 
 static void* VLin2VectorArray_PT(void* thread_data)
@@ -5226,7 +4469,7 @@ static void* VLin2VectorArray_PT(void* thread_data)
     for (j = start; j < end; j++) { zd[j] = (a * xd[j]) - yd[j]; }
   }
 
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 static void VaxpyVectorArray_Pthreads(int nvec, sunrealtype a, N_Vector* X,
@@ -5236,23 +4479,13 @@ static void VaxpyVectorArray_Pthreads(int nvec, sunrealtype a, N_Vector* X,
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(X[0]);
-  nthreads = NV_NUM_THREADS_PT(X[0]);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
-  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
-  SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
-
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  /* get thread data structs from the thread pool */
+  N           = NV_LENGTH_PT(X[0]);
+  thread_data = nvPoolAcquire(NV_POOL_PT(X[0]), &nthreads);
 
-  /* pack thread data, distribute loop indices, and create threads/call kernel */
+  /* pack thread data and distribute loop indices */
   for (i = 0; i < nthreads; i++)
   {
     nvInitThreadData(&thread_data[i]);
@@ -5263,18 +4496,10 @@ static void VaxpyVectorArray_Pthreads(int nvec, sunrealtype a, N_Vector* X,
     thread_data[i].Y2   = Y;
 
     nvSplitLoop(i, &nthreads, &N, &thread_data[i].start, &thread_data[i].end);
-
-    pthread_create(&threads[i], &attr, VaxpyVectorArray_PT,
-                   (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
-
-  /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
-  free(thread_data);
+  /* run companion function on all threads and wait for completion */
+  nvPoolRun(NV_POOL_PT(X[0]), VaxpyVectorArray_PT);
 }
 
 static void* VaxpyVectorArray_PT(void* thread_data)
@@ -5300,7 +4525,7 @@ static void* VaxpyVectorArray_PT(void* thread_data)
       yd = NV_DATA_PT(my_data->Y2[i]);
       for (j = start; j < end; j++) { yd[j] += xd[j]; }
     }
-    pthread_exit(NULL);
+    return (NULL);
   }
 
   if (a == -ONE)
@@ -5311,7 +4536,7 @@ static void* VaxpyVectorArray_PT(void* thread_data)
       yd = NV_DATA_PT(my_data->Y2[i]);
       for (j = start; j < end; j++) { yd[j] -= xd[j]; }
     }
-    pthread_exit(NULL);
+    return (NULL);
   }
 
   for (i = 0; i < my_data->nvec; i++)
@@ -5320,7 +4545,7 @@ static void* VaxpyVectorArray_PT(void* thread_data)
     yd = NV_DATA_PT(my_data->Y2[i]);
     for (j = start; j < end; j++) { yd[j] += a * xd[j]; }
   }
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /*
@@ -5386,6 +4611,248 @@ static void nvInitThreadData(Pthreads_Data* thread_data)
   thread_data->Y3    = NULL;
 }
 
+/* ----------------------------------------------------------------------------
+ * Create a thread pool with num_threads - 1 persistent worker threads
+ */
+
+static Pthreads_Pool* nvPoolCreate(int num_threads)
+{
+  int i, nworkers, retval;
+  pthread_attr_t attr;
+  Pthreads_Pool* pool;
+
+  if (num_threads < 1) { num_threads = 1; }
+  nworkers = num_threads - 1;
+
+  pool = (Pthreads_Pool*)malloc(sizeof(*pool));
+  if (pool == NULL) { return (NULL); }
+
+  pool->num_threads = num_threads;
+  pool->refcount    = 1;
+  pool->func        = NULL;
+  pool->epoch       = 0;
+  pool->pending     = 0;
+  pool->sleeping    = 0;
+  pool->shutdown    = SUNFALSE;
+  pool->workers     = NULL;
+  pool->args        = NULL;
+
+  pool->thread_data =
+    (Pthreads_Data*)malloc(num_threads * sizeof(struct _Pthreads_Data));
+  if (pool->thread_data == NULL)
+  {
+    free(pool);
+    return (NULL);
+  }
+
+  pthread_mutex_init(&pool->run_mutex, NULL);
+  pthread_mutex_init(&pool->mutex, NULL);
+  pthread_cond_init(&pool->start_cond, NULL);
+  pthread_cond_init(&pool->done_cond, NULL);
+
+  if (nworkers == 0) { return (pool); }
+
+  pool->workers = (pthread_t*)malloc(nworkers * sizeof(pthread_t));
+  pool->args = (Pthreads_WorkerArg*)malloc(nworkers * sizeof(Pthreads_WorkerArg));
+  if (pool->workers == NULL || pool->args == NULL)
+  {
+    pool->num_threads = 1;
+    nvPoolRelease(pool);
+    return (NULL);
+  }
+
+  /* set thread attributes */
+  pthread_attr_init(&attr);
+  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+
+  /* start the workers, thread 0 is the thread calling the vector operation */
+  for (i = 0; i < nworkers; i++)
+  {
+    pool->args[i].pool = pool;
+    pool->args[i].id   = i + 1;
+
+    retval = pthread_create(&pool->workers[i], &attr, nvPoolWorker,
+                            (void*)&pool->args[i]);
+    if (retval != 0)
+    {
+      /* only shut down the workers that were started */
+      pool->num_threads = i + 1;
+      pthread_attr_destroy(&attr);
+      nvPoolRelease(pool);
+      return (NULL);
+    }
+  }
+
+  pthread_attr_destroy(&attr);
+
+  return (pool);
+}
+
+/* ----------------------------------------------------------------------------
+ * Add a reference to a thread pool (e.g., when a vector is cloned)
+ */
+
+static void nvPoolRetain(Pthreads_Pool* pool)
+{
+  pthread_mutex_lock(&pool->mutex);
+  pool->refcount++;
+  pthread_mutex_unlock(&pool->mutex);
+}
+
+/* ----------------------------------------------------------------------------
+ * Remove a reference to a thread pool and destroy the pool when the last
+ * reference is removed
+ */
+
+static void nvPoolRelease(Pthreads_Pool* pool)
+{
+  int i, refcount;
+
+  pthread_mutex_lock(&pool->mutex);
+  refcount = --pool->refcount;
+  if (refcount == 0)
+  {
+    /* wake all workers and tell them to exit */
+    pool->shutdown = SUNTRUE;
+    NVPT_ATOMIC_STORE(&pool->epoch, pool->epoch + 1);
+    pthread_cond_broadcast(&pool->start_cond);
+  }
+  pthread_mutex_unlock(&pool->mutex);
+
+  if (refcount > 0) { return; }
+
+  for (i = 0; i < pool->num_threads - 1; i++)
+  {
+    pthread_join(pool->workers[i], NULL);
+  }
+
+  pthread_cond_destroy(&pool->done_cond);
+  pthread_cond_destroy(&pool->start_cond);
+  pthread_mutex_destroy(&pool->mutex);
+  pthread_mutex_destroy(&pool->run_mutex);
+
+  free(pool->args);
+  free(pool->workers);
+  free(pool->thread_data);
+  free(pool);
+}
+
+/* ----------------------------------------------------------------------------
+ * Lock the thread pool for a vector operation and return its thread data
+ * structs and number of threads. The lock is released by nvPoolRun once the
+ * operation completes.
+ */
+
+static Pthreads_Data* nvPoolAcquire(Pthreads_Pool* pool, int* nthreads)
+{
+  pthread_mutex_lock(&pool->run_mutex);
+  *nthreads = pool->num_threads;
+  return (pool->thread_data);
+}
+
+/* ----------------------------------------------------------------------------
+ * Run a companion function on all threads in the pool, wait for all threads
+ * to finish, and unlock the pool
+ */
+
+static void nvPoolRun(Pthreads_Pool* pool, void* (*func)(void*))
+{
+  int spin;
+
+  if (pool->num_threads > 1)
+  {
+    /* publish the work and start the next epoch */
+    pool->func = func;
+    NVPT_ATOMIC_STORE(&pool->pending, pool->num_threads - 1);
+
+    pthread_mutex_lock(&pool->mutex);
+    NVPT_ATOMIC_STORE(&pool->epoch, pool->epoch + 1);
+    if (pool->sleeping > 0) { pthread_cond_broadcast(&pool->start_cond); }
+    pthread_mutex_unlock(&pool->mutex);
+  }
+
+  /* the calling thread does the work for thread 0 */
+  func((void*)&pool->thread_data[0]);
+
+  if (pool->num_threads > 1)
+  {
+    /* spin briefly before waiting for the workers to finish */
+    for (spin = 0; spin < NVPT_SPIN_COUNT; spin++)
+    {
+      if (NVPT_ATOMIC_LOAD(&pool->pending) == 0) { break; }
+    }
+
+    pthread_mutex_lock(&pool->mutex);
+    while (NVPT_ATOMIC_LOAD(&pool->pending) > 0)
+    {
+      pthread_cond_wait(&pool->done_cond, &pool->mutex);
+    }
+    pthread_mutex_unlock(&pool->mutex);
+  }
+
+  pthread_mutex_unlock(&pool->run_mutex);
+}
+
+/* ----------------------------------------------------------------------------
+ * Worker thread loop, wait for a new epoch and run the companion function
+ */
+
+static void* nvPoolWorker(void* arg)
+{
+  Pthreads_Pool* pool = ((Pthreads_WorkerArg*)arg)->pool;
+  int id              = ((Pthreads_WorkerArg*)arg)->id;
+  unsigned long seen  = 0;
+  int spin;
+
+  for (;;)
+  {
+    /* spin briefly waiting for the next dispatch */
+    for (spin = 0; spin < NVPT_SPIN_COUNT; spin++)
+    {
+      if (NVPT_ATOMIC_LOAD(&pool->epoch) != seen) { break; }
+    }
+
+    /* sleep until the next dispatch */
+    if (spin == NVPT_SPIN_COUNT)
+    {
+      pthread_mutex_lock(&pool->mutex);
+      while (NVPT_ATOMIC_LOAD(&pool->epoch) == seen)
+      {
+        pool->sleeping++;
+        pthread_cond_wait(&pool->start_cond, &pool->mutex);
+        pool->sleeping--;
+      }
+      pthread_mutex_unlock(&pool->mutex);
+    }
+
+    /* each dispatch advances the epoch by one and the caller waits for every
+       worker to finish before the next dispatch */
+    seen++;
+    if (pool->shutdown) { break; }
+
+    pool->func((void*)&pool->thread_data[id]);
+
+    /* the last worker to finish wakes the caller */
+#ifdef NVPT_HAVE_ATOMICS
+    if (NVPT_ATOMIC_DEC(&pool->pending) == 0)
+    {
+      pthread_mutex_lock(&pool->mutex);
+      pthread_cond_signal(&pool->done_cond);
+      pthread_mutex_unlock(&pool->mutex);
+    }
+#else
+    pthread_mutex_lock(&pool->mutex);
+    if (NVPT_ATOMIC_DEC(&pool->pending) == 0)
+    {
+      pthread_cond_signal(&pool->done_cond);
+    }
+    pthread_mutex_unlock(&pool->mutex);
+#endif
+  }
+
+  return (NULL);
+}
+
 /*
  * -----------------------------------------------------------------
  * Enable / Disable fused and vector array operations
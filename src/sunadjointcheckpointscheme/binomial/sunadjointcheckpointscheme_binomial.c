@@ -0,0 +1,591 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2025-2026, Lawrence Livermore National Security,
+ * University of Maryland Baltimore County, and the SUNDIALS contributors.
+ * Copyright (c) 2013-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * Copyright (c) 2002-2013, Lawrence Livermore National Security.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * SUNAdjointCheckpointScheme_Binomial class definition.
+ *
+ * Checkpoints are placed according to the binomial schedule of
+ * Griewank and Walther (Algorithm 799: Revolve, ACM TOMS 26, 2000).
+ * A checkpoint of step k holds the state at the start of step k. In
+ * addition to the checkpoints, the scheme holds every stage of the
+ * first step, whose last stage is where the schedule starts from, and
+ * of the step that is being reversed. The latter is stored while
+ * recomputing or, for the last step, during the forward integration.
+ *
+ * When the adjoint integration needs a step that is not stored, the
+ * integrator looks for the last checkpoint and recomputes forward from
+ * it to the missing step through SUNAdjointStepper_RecomputeFwd. During
+ * this sweep the free checkpoint slots are filled following the same
+ * binomial schedule, so later recomputations start closer to the steps
+ * they need.
+ * ----------------------------------------------------------------*/
+
+#include <sunadjointcheckpointscheme/sunadjointcheckpointscheme_binomial.h>
+#include <sundials/sundials_adjointcheckpointscheme.h>
+#include <sundials/sundials_core.h>
+
+#include "sundials_adjointcheckpointscheme_impl.h"
+#include "sundials_datanode.h"
+#include "sundials_logger_impl.h"
+#include "sundials_macros.h"
+
+struct SUNAdjointCheckpointScheme_Binomial_Stages_
+{
+  suncountertype step;
+  suncountertype size;
+  SUNDataNode* node;
+};
+
+struct SUNAdjointCheckpointScheme_Binomial_Content_
+{
+  SUNMemoryHelper mem_helper;
+  SUNDataIOMode io_mode;
+
+  /* Maximum number of checkpoints and the (estimated) number of steps */
+  suncountertype max_checks;
+  suncountertype estimate;
+
+  /* Checkpoints ordered by step number */
+  suncountertype num_checks;
+  suncountertype* check_step;
+  SUNDataNode* check_node;
+
+  /* All stages of the first step and of the step being reversed */
+  struct SUNAdjointCheckpointScheme_Binomial_Stages_ first;
+  struct SUNAdjointCheckpointScheme_Binomial_Stages_ dense;
+
+  /* Step to store all stages of and the next step to checkpoint */
+  suncountertype target_step;
+  suncountertype next_check;
+  sunbooleantype recompute;
+
+  /* Statistics */
+  suncountertype nrecompute;
+  suncountertype max_num_checks;
+};
+
+typedef struct SUNAdjointCheckpointScheme_Binomial_Content_*
+  SUNAdjointCheckpointScheme_Binomial_Content;
+
+#define GET_CONTENT(S) ((SUNAdjointCheckpointScheme_Binomial_Content)S->content)
+#define IMPL_MEMBER(S, prop) (GET_CONTENT(S)->prop)
+
+typedef struct SUNAdjointCheckpointScheme_Binomial_Stages_* BinomialStages;
+
+/* Number of steps to advance before taking the next checkpoint when
+   reversing num_steps steps with snaps checkpoints, including the one
+   the advance starts from (see the numforw routine of Revolve). */
+static suncountertype binomialSplit(suncountertype num_steps,
+                                    suncountertype snaps)
+{
+  suncountertype reps  = 0;
+  suncountertype range = 1;
+  while (range < num_steps)
+  {
+    reps++;
+    range = range * (reps + snaps) / reps;
+  }
+
+  suncountertype bino1 = range * reps / (snaps + reps);
+  suncountertype bino2 = (snaps > 1) ? bino1 * snaps / (snaps + reps - 1) : 1;
+  suncountertype bino3 = 0;
+  if (snaps > 1)
+  {
+    bino3 = (snaps > 2) ? bino2 * (snaps - 1) / (snaps + reps - 2) : 1;
+  }
+  suncountertype bino4 = bino2 * (reps - 1) / snaps;
+  suncountertype bino5 = 0;
+  if (snaps > 2) { bino5 = (snaps > 3) ? bino3 * (snaps - 2) / reps : 1; }
+
+  suncountertype advance = 0;
+  if (num_steps <= bino1 + bino3) { advance = bino4; }
+  else if (num_steps >= range - bino5) { advance = bino1; }
+  else { advance = num_steps - bino2 - bino3; }
+
+  if (advance < 1) { advance = 1; }
+  if (advance > num_steps - 1) { advance = num_steps - 1; }
+
+  return advance;
+}
+
+/* Plan the next checkpoint after the last stored one */
+static void binomialPlan(SUNAdjointCheckpointScheme self)
+{
+  IMPL_MEMBER(self, next_check) = -1;
+  if (IMPL_MEMBER(self, first).step < 0) { return; }
+
+  /* The end of the first step acts as a checkpoint that takes no slot */
+  suncountertype num_checks = IMPL_MEMBER(self, num_checks);
+  suncountertype last       = IMPL_MEMBER(self, first).step + 1;
+  if (num_checks > 0) { last = IMPL_MEMBER(self, check_step)[num_checks - 1]; }
+
+  suncountertype num_steps = IMPL_MEMBER(self, target_step) - last + 1;
+  suncountertype snaps     = IMPL_MEMBER(self, max_checks) - num_checks + 1;
+
+  if (num_steps < 2 || snaps < 2) { return; }
+
+  IMPL_MEMBER(self, next_check) = last + binomialSplit(num_steps, snaps);
+}
+
+static SUNErrCode binomialFreeStages(SUNAdjointCheckpointScheme self,
+                                     BinomialStages stages)
+{
+  SUNFunctionBegin(self->sunctx);
+
+  for (suncountertype i = 0; i < stages->size; i++)
+  {
+    if (stages->node[i]) { SUNCheckCall(SUNDataNode_Destroy(&stages->node[i])); }
+  }
+  stages->step = -1;
+
+  return SUN_SUCCESS;
+}
+
+static SUNErrCode binomialStoreStage(SUNAdjointCheckpointScheme self,
+                                     BinomialStages stages,
+                                     suncountertype step_num,
+                                     suncountertype stage_num, sunrealtype t,
+                                     N_Vector y)
+{
+  SUNFunctionBegin(self->sunctx);
+
+  if (stages->step != step_num)
+  {
+    SUNCheckCall(binomialFreeStages(self, stages));
+    stages->step = step_num;
+  }
+
+  if (stage_num >= stages->size)
+  {
+    suncountertype new_size = 2 * (stage_num + 1);
+    SUNDataNode* new_node =
+      (SUNDataNode*)realloc(stages->node, new_size * sizeof(SUNDataNode));
+    SUNAssert(new_node, SUN_ERR_MALLOC_FAIL);
+    for (suncountertype i = stages->size; i < new_size; i++)
+    {
+      new_node[i] = NULL;
+    }
+    stages->node = new_node;
+    stages->size = new_size;
+  }
+
+  if (!stages->node[stage_num])
+  {
+    SUNCheckCall(SUNDataNode_CreateLeaf(IMPL_MEMBER(self, io_mode),
+                                        IMPL_MEMBER(self, mem_helper), SUNCTX_,
+                                        &stages->node[stage_num]));
+  }
+  SUNCheckCall(SUNDataNode_SetDataNvector(stages->node[stage_num], y, t));
+
+  SUNLogExtraDebug(SUNCTX_->logger, "insert-stage",
+                   "step_num = %d, stage_num = %d, t = " SUN_FORMAT_G, step_num,
+                   stage_num, t);
+
+  return SUN_SUCCESS;
+}
+
+static SUNDataNode binomialFindStage(BinomialStages stages,
+                                     suncountertype step_num,
+                                     suncountertype stage_num)
+{
+  if (stages->step != step_num || stage_num >= stages->size) { return NULL; }
+  return stages->node[stage_num];
+}
+
+static SUNErrCode binomialRemoveCheck(SUNAdjointCheckpointScheme self,
+                                      suncountertype idx)
+{
+  SUNFunctionBegin(self->sunctx);
+
+  SUNLogExtraDebug(SUNCTX_->logger, "remove-checkpoint", "step_num = %d",
+                   IMPL_MEMBER(self, check_step)[idx]);
+
+  SUNCheckCall(SUNDataNode_Destroy(&IMPL_MEMBER(self, check_node)[idx]));
+  for (suncountertype i = idx + 1; i < IMPL_MEMBER(self, num_checks); i++)
+  {
+    IMPL_MEMBER(self, check_step)[i - 1] = IMPL_MEMBER(self, check_step)[i];
+    IMPL_MEMBER(self, check_node)[i - 1] = IMPL_MEMBER(self, check_node)[i];
+  }
+  IMPL_MEMBER(self, num_checks)--;
+
+  return SUN_SUCCESS;
+}
+
+/* Drop the data that is no longer needed once the adjoint integration
+   has reached step_num */
+static SUNErrCode binomialRelease(SUNAdjointCheckpointScheme self,
+                                  suncountertype step_num)
+{
+  SUNFunctionBegin(self->sunctx);
+
+  while (IMPL_MEMBER(self, num_checks) > 0 &&
+         IMPL_MEMBER(self, check_step)[IMPL_MEMBER(self, num_checks) - 1] >
+           step_num)
+  {
+    SUNCheckCall(binomialRemoveCheck(self, IMPL_MEMBER(self, num_checks) - 1));
+  }
+
+  if (IMPL_MEMBER(self, dense).step > step_num)
+  {
+    SUNCheckCall(binomialFreeStages(self, &IMPL_MEMBER(self, dense)));
+  }
+  if (IMPL_MEMBER(self, first).step > step_num)
+  {
+    SUNCheckCall(binomialFreeStages(self, &IMPL_MEMBER(self, first)));
+  }
+
+  return SUN_SUCCESS;
+}
+
+/* Track the forward integration. A new forward integration starts when a
+   step at or before the first step is taken outside of a recomputation. If
+   the forward integration runs past the estimated number of steps, the
+   estimate is doubled and, when all of the checkpoints are in use, the
+   checkpoint whose removal leaves the shortest gap is released. */
+static SUNErrCode binomialForward(SUNAdjointCheckpointScheme self,
+                                  suncountertype step_num,
+                                  suncountertype stage_num)
+{
+  SUNFunctionBegin(self->sunctx);
+
+  if (IMPL_MEMBER(self, recompute) || stage_num != 0) { return SUN_SUCCESS; }
+
+  suncountertype first = IMPL_MEMBER(self, first).step;
+  if (first < 0 || step_num <= first)
+  {
+    SUNCheckCall(binomialRelease(self, -1));
+    IMPL_MEMBER(self, first).step  = step_num;
+    IMPL_MEMBER(self, target_step) = step_num + IMPL_MEMBER(self, estimate) - 1;
+    binomialPlan(self);
+    return SUN_SUCCESS;
+  }
+
+  if (step_num <= IMPL_MEMBER(self, target_step)) { return SUN_SUCCESS; }
+
+  while (step_num > IMPL_MEMBER(self, target_step))
+  {
+    IMPL_MEMBER(self, target_step) = first +
+                                     2 * (IMPL_MEMBER(self, target_step) -
+                                          first + 1) -
+                                     1;
+  }
+  SUNLogExtraDebug(SUNCTX_->logger, "grow-estimate", "target_step = %d",
+                   IMPL_MEMBER(self, target_step));
+
+  SUNCheckCall(binomialFreeStages(self, &IMPL_MEMBER(self, dense)));
+
+  suncountertype num_checks = IMPL_MEMBER(self, num_checks);
+  if (num_checks == IMPL_MEMBER(self, max_checks))
+  {
+    suncountertype* steps = IMPL_MEMBER(self, check_step);
+    suncountertype idx    = 0;
+    suncountertype gap    = -1;
+    for (suncountertype i = 0; i < num_checks; i++)
+    {
+      suncountertype prev = (i > 0) ? steps[i - 1] : first + 1;
+      suncountertype next = (i + 1 < num_checks) ? steps[i + 1] : step_num;
+      if (gap < 0 || next - prev < gap)
+      {
+        gap = next - prev;
+        idx = i;
+      }
+    }
+    SUNCheckCall(binomialRemoveCheck(self, idx));
+  }
+
+  binomialPlan(self);
+  if (IMPL_MEMBER(self, next_check) >= 0 &&
+      IMPL_MEMBER(self, next_check) < step_num)
+  {
+    IMPL_MEMBER(self, next_check) = step_num;
+  }
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNAdjointCheckpointScheme_Create_Binomial(
+  SUNDataIOMode io_mode, SUNMemoryHelper mem_helper,
+  suncountertype max_checkpoints, suncountertype estimate, SUNContext sunctx,
+  SUNAdjointCheckpointScheme* check_scheme_ptr)
+{
+  SUNFunctionBegin(sunctx);
+
+  SUNAssert(max_checkpoints > 0, SUN_ERR_ARG_OUTOFRANGE);
+
+  SUNAdjointCheckpointScheme check_scheme = NULL;
+  SUNCheckCall(SUNAdjointCheckpointScheme_NewEmpty(sunctx, &check_scheme));
+
+  check_scheme->ops->needssaving = SUNAdjointCheckpointScheme_NeedsSaving_Binomial;
+  check_scheme->ops->insertvector =
+    SUNAdjointCheckpointScheme_InsertVector_Binomial;
+  check_scheme->ops->loadvector = SUNAdjointCheckpointScheme_LoadVector_Binomial;
+  check_scheme->ops->enableDense =
+    SUNAdjointCheckpointScheme_EnableDense_Binomial;
+  check_scheme->ops->destroy = SUNAdjointCheckpointScheme_Destroy_Binomial;
+
+  SUNAdjointCheckpointScheme_Binomial_Content content = NULL;
+
+  content = malloc(sizeof(*content));
+  SUNAssert(content, SUN_ERR_MALLOC_FAIL);
+
+  content->mem_helper     = mem_helper;
+  content->io_mode        = io_mode;
+  content->max_checks     = max_checkpoints;
+  content->estimate       = (estimate > 0) ? estimate : 1;
+  content->num_checks     = 0;
+  content->check_step     = NULL;
+  content->check_node     = NULL;
+  content->first.step     = -1;
+  content->first.size     = 0;
+  content->first.node     = NULL;
+  content->dense.step     = -1;
+  content->dense.size     = 0;
+  content->dense.node     = NULL;
+  content->target_step    = -1;
+  content->next_check     = -1;
+  content->recompute      = SUNFALSE;
+  content->nrecompute     = 0;
+  content->max_num_checks = 0;
+
+  content->check_step = malloc(max_checkpoints * sizeof(suncountertype));
+  SUNAssert(content->check_step, SUN_ERR_MALLOC_FAIL);
+
+  content->check_node = malloc(max_checkpoints * sizeof(SUNDataNode));
+  SUNAssert(content->check_node, SUN_ERR_MALLOC_FAIL);
+
+  check_scheme->content = content;
+  *check_scheme_ptr     = check_scheme;
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNAdjointCheckpointScheme_NeedsSaving_Binomial(
+  SUNAdjointCheckpointScheme self, suncountertype step_num,
+  suncountertype stage_num, SUNDIALS_MAYBE_UNUSED sunrealtype t,
+  sunbooleantype* yes_or_no)
+{
+  SUNFunctionBegin(self->sunctx);
+
+  SUNCheckCall(binomialForward(self, step_num, stage_num));
+
+  if (IMPL_MEMBER(self, recompute) && stage_num == 0)
+  {
+    IMPL_MEMBER(self, nrecompute)++;
+  }
+
+  if (step_num == IMPL_MEMBER(self, first).step ||
+      step_num == IMPL_MEMBER(self, target_step) ||
+      (stage_num == 0 && step_num == IMPL_MEMBER(self, next_check)))
+  {
+    *yes_or_no = SUNTRUE;
+  }
+  else { *yes_or_no = SUNFALSE; }
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNAdjointCheckpointScheme_InsertVector_Binomial(
+  SUNAdjointCheckpointScheme self, suncountertype step_num,
+  suncountertype stage_num, sunrealtype t, N_Vector y)
+{
+  SUNFunctionBegin(self->sunctx);
+
+  SUNCheckCall(binomialForward(self, step_num, stage_num));
+
+  /* A checkpoint at the start of the step being recomputed is not needed
+     since the step is reversed next */
+  if (stage_num == 0 && step_num == IMPL_MEMBER(self, next_check) &&
+      !(IMPL_MEMBER(self, recompute) &&
+        step_num == IMPL_MEMBER(self, target_step)))
+  {
+    /* Only an online adjustment of the forward schedule can run out of
+       checkpoints, in which case the last one is replaced */
+    if (IMPL_MEMBER(self, num_checks) == IMPL_MEMBER(self, max_checks))
+    {
+      SUNCheckCall(binomialRemoveCheck(self, IMPL_MEMBER(self, num_checks) - 1));
+    }
+
+    suncountertype idx = IMPL_MEMBER(self, num_checks);
+    SUNCheckCall(SUNDataNode_CreateLeaf(IMPL_MEMBER(self, io_mode),
+                                        IMPL_MEMBER(self, mem_helper), SUNCTX_,
+                                        &IMPL_MEMBER(self, check_node)[idx]));
+    SUNCheckCall(
+      SUNDataNode_SetDataNvector(IMPL_MEMBER(self, check_node)[idx], y, t));
+    IMPL_MEMBER(self, check_step)[idx] = step_num;
+    IMPL_MEMBER(self, num_checks)++;
+
+    if (IMPL_MEMBER(self, num_checks) > IMPL_MEMBER(self, max_num_checks))
+    {
+      IMPL_MEMBER(self, max_num_checks) = IMPL_MEMBER(self, num_checks);
+    }
+
+    SUNLogExtraDebug(SUNCTX_->logger, "insert-checkpoint",
+                     "step_num = %d, t = " SUN_FORMAT_G, step_num, t);
+
+    binomialPlan(self);
+  }
+
+  if (step_num == IMPL_MEMBER(self, first).step)
+  {
+    SUNCheckCall(binomialStoreStage(self, &IMPL_MEMBER(self, first), step_num,
+                                    stage_num, t, y));
+  }
+  else if (step_num == IMPL_MEMBER(self, target_step))
+  {
+    SUNCheckCall(binomialStoreStage(self, &IMPL_MEMBER(self, dense), step_num,
+                                    stage_num, t, y));
+  }
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNAdjointCheckpointScheme_LoadVector_Binomial(
+  SUNAdjointCheckpointScheme self, suncountertype step_num,
+  suncountertype stage_num, sunbooleantype peek, N_Vector* yout,
+  sunrealtype* tout)
+{
+  SUNFunctionBegin(self->sunctx);
+
+  /* Checkpoints and stages after this step will not be needed again */
+  if (!peek) { SUNCheckCall(binomialRelease(self, step_num)); }
+
+  SUNDataNode node = binomialFindStage(&IMPL_MEMBER(self, dense), step_num,
+                                       stage_num);
+  if (!node)
+  {
+    node = binomialFindStage(&IMPL_MEMBER(self, first), step_num, stage_num);
+  }
+
+  /* The start of a step is the checkpoint of the step, and the end of a
+     step (which is what the integrator peeks at when it looks for a step
+     to recompute from) is the checkpoint of the next step */
+  for (suncountertype i = IMPL_MEMBER(self, num_checks) - 1; !node && i >= 0;
+       i--)
+  {
+    suncountertype check_step = IMPL_MEMBER(self, check_step)[i];
+    if ((stage_num == 0 && check_step == step_num) ||
+        (stage_num > 0 && peek && check_step == step_num + 1))
+    {
+      node = IMPL_MEMBER(self, check_node)[i];
+    }
+    else if (check_step < step_num) { break; }
+  }
+
+  if (!node)
+  {
+    SUNLogExtraDebug(SUNCTX_->logger, "stage-not-found",
+                     "step_num = %d, stage_num = %d", step_num, stage_num);
+
+    /* The adjoint integration needs this step, so all of its stages are
+       stored when it is recomputed */
+    if (!peek)
+    {
+      SUNCheckCall(binomialFreeStages(self, &IMPL_MEMBER(self, dense)));
+      IMPL_MEMBER(self, target_step) = step_num;
+    }
+
+    return SUN_ERR_CHECKPOINT_NOT_FOUND;
+  }
+
+  SUNCheckCall(SUNDataNode_GetDataNvector(node, *yout, tout));
+  SUNLogExtraDebug(SUNCTX_->logger, "stage-loaded",
+                   "step_num = %d, stage_num = %d, t = " SUN_FORMAT_G, step_num,
+                   stage_num, *tout);
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNAdjointCheckpointScheme_Destroy_Binomial(
+  SUNAdjointCheckpointScheme* self_ptr)
+{
+  SUNFunctionBegin((*self_ptr)->sunctx);
+
+  SUNAdjointCheckpointScheme self = *self_ptr;
+
+  SUNCheckCall(binomialRelease(self, -1));
+
+  free(IMPL_MEMBER(self, check_step));
+  free(IMPL_MEMBER(self, check_node));
+  free(IMPL_MEMBER(self, first).node);
+  free(IMPL_MEMBER(self, dense).node);
+  free(self->content);
+  free(self->ops);
+  free(self);
+
+  *self_ptr = NULL;
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNAdjointCheckpointScheme_EnableDense_Binomial(
+  SUNAdjointCheckpointScheme check_scheme, sunbooleantype on_or_off)
+{
+  SUNFunctionBegin(check_scheme->sunctx);
+
+  /* Dense output is requested while recomputing the missing steps. The
+     recomputation starts from the last checkpoint, so the remaining
+     checkpoints are placed from there. */
+  IMPL_MEMBER(check_scheme, recompute) = on_or_off;
+  if (on_or_off) { binomialPlan(check_scheme); }
+  else { IMPL_MEMBER(check_scheme, next_check) = -1; }
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNAdjointCheckpointScheme_GetNumRecompute_Binomial(
+  SUNAdjointCheckpointScheme check_scheme, suncountertype* num_recompute)
+{
+  SUNFunctionBegin(check_scheme->sunctx);
+
+  *num_recompute = IMPL_MEMBER(check_scheme, nrecompute);
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNAdjointCheckpointScheme_GetMaxNumCheckpoints_Binomial(
+  SUNAdjointCheckpointScheme check_scheme, suncountertype* max_num_checkpoints)
+{
+  SUNFunctionBegin(check_scheme->sunctx);
+
+  *max_num_checkpoints = IMPL_MEMBER(check_scheme, max_num_checks);
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNAdjointCheckpointScheme_PredictNumRecompute_Binomial(
+  suncountertype num_steps, suncountertype max_checkpoints,
+  suncountertype* num_recompute)
+{
+  if (num_steps < 0 || max_checkpoints < 1 || !num_recompute)
+  {
+    return SUN_ERR_ARG_OUTOFRANGE;
+  }
+
+  /* The first step is stored and the end of it is an extra checkpoint for
+     reversing the remaining n steps. With s checkpoints and r the smallest
+     integer such that binomial(s + r, s) >= n, the reversal recomputes
+     r n - binomial(s + r, s + 1) steps. */
+  suncountertype num_rev = (num_steps > 1) ? num_steps - 1 : 0;
+  suncountertype snaps   = max_checkpoints + 1;
+  suncountertype reps    = 0;
+  suncountertype range   = 1;
+  while (range < num_rev)
+  {
+    reps++;
+    range = range * (reps + snaps) / reps;
+  }
+
+  *num_recompute = reps * num_rev - range * reps / (snaps + 1);
+
+  return SUN_SUCCESS;
+}
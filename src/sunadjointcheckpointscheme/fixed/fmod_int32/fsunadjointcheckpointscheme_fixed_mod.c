@@ -211,6 +211,32 @@
 
 #include "sunadjointcheckpointscheme/sunadjointcheckpointscheme_fixed.h"
 
+
+#include <stdlib.h>
+#ifdef _MSC_VER
+# ifndef strtoull
+#  define strtoull _strtoui64
+# endif
+# ifndef strtoll
+#  define strtoll _strtoi64
+# endif
+#endif
+
+
+typedef struct {
+    void* data;
+    size_t size;
+} SwigArrayWrapper;
+
+
+SWIGINTERN SwigArrayWrapper SwigArrayWrapper_uninitialized() {
+  SwigArrayWrapper result;
+  result.data = NULL;
+  result.size = 0;
+  return result;
+}
+
+
 SWIGEXPORT int _wrap_FSUNAdjointCheckpointScheme_Create_Fixed(int const *farg1, SUNMemoryHelper farg2, long const *farg3, long const *farg4, int const *farg5, void *farg6, void *farg7) {
   int fresult ;
   SUNDataIOMode arg1 ;
@@ -323,4 +349,36 @@ SWIGEXPORT int _wrap_FSUNAdjointCheckpointScheme_EnableDense_Fixed(void *farg1,
 }
 
 
+SWIGEXPORT int _wrap_FSUNAdjointCheckpointScheme_SetMmapOptions_Fixed(void *farg1, SwigArrayWrapper *farg2, size_t const *farg3) {
+  int fresult ;
+  SUNAdjointCheckpointScheme arg1 = (SUNAdjointCheckpointScheme) 0 ;
+  char *arg2 = (char *) 0 ;
+  size_t arg3 ;
+  SUNErrCode result;
+  
+  arg1 = (SUNAdjointCheckpointScheme)(farg1);
+  arg2 = (char *)(farg2->data);
+  arg3 = (size_t)(*farg3);
+  result = (SUNErrCode)SUNAdjointCheckpointScheme_SetMmapOptions_Fixed(arg1,(char const *)arg2,arg3);
+  fresult = (SUNErrCode)(result);
+  return fresult;
+}
+
+
+
+SWIGEXPORT int _wrap_FSUNAdjointCheckpointScheme_SetCompression_Fixed(void *farg1, int const *farg2, double const *farg3) {
+  int fresult ;
+  SUNAdjointCheckpointScheme arg1 = (SUNAdjointCheckpointScheme) 0 ;
+  SUNDataCompression arg2 ;
+  sunrealtype arg3 ;
+  SUNErrCode result;
+  
+  arg1 = (SUNAdjointCheckpointScheme)(farg1);
+  arg2 = (SUNDataCompression)(*farg2);
+  arg3 = (sunrealtype)(*farg3);
+  result = (SUNErrCode)SUNAdjointCheckpointScheme_SetCompression_Fixed(arg1,arg2,arg3);
+  fresult = (SUNErrCode)(result);
+  return fresult;
+}
+
 
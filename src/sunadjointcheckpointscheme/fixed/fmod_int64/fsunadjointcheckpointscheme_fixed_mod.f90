@@ -34,6 +34,12 @@ module fsunadjointcheckpointscheme_fixed_mod
  public :: FSUNAdjointCheckpointScheme_LoadVector_Fixed
  public :: FSUNAdjointCheckpointScheme_Destroy_Fixed
  public :: FSUNAdjointCheckpointScheme_EnableDense_Fixed
+ type, bind(C) :: SwigArrayWrapper
+  type(C_PTR), public :: data = C_NULL_PTR
+  integer(C_SIZE_T), public :: size = 0
+ end type
+ public :: FSUNAdjointCheckpointScheme_SetMmapOptions_Fixed
+ public :: FSUNAdjointCheckpointScheme_SetCompression_Fixed
 
 ! WRAPPER DECLARATIONS
 interface
@@ -105,6 +111,27 @@ integer(C_INT), intent(in) :: farg2
 integer(C_INT) :: fresult
 end function
 
+function swigc_FSUNAdjointCheckpointScheme_SetMmapOptions_Fixed(farg1, farg2, farg3) &
+bind(C, name="_wrap_FSUNAdjointCheckpointScheme_SetMmapOptions_Fixed") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+import :: swigarraywrapper
+type(C_PTR), value :: farg1
+type(SwigArrayWrapper) :: farg2
+integer(C_SIZE_T), intent(in) :: farg3
+integer(C_INT) :: fresult
+end function
+
+function swigc_FSUNAdjointCheckpointScheme_SetCompression_Fixed(farg1, farg2, farg3) &
+bind(C, name="_wrap_FSUNAdjointCheckpointScheme_SetCompression_Fixed") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+real(C_DOUBLE), intent(in) :: farg3
+integer(C_INT) :: fresult
+end function
+
 end interface
 
 
@@ -249,4 +276,61 @@ swig_result = fresult
 end function
 
 
+subroutine SWIG_string_to_chararray(string, chars, wrap)
+  use, intrinsic :: ISO_C_BINDING
+  character(kind=C_CHAR, len=*), intent(IN) :: string
+  character(kind=C_CHAR), dimension(:), target, allocatable, intent(OUT) :: chars
+  type(SwigArrayWrapper), intent(OUT) :: wrap
+  integer :: i
+
+  allocate(character(kind=C_CHAR) :: chars(len(string) + 1))
+  do i=1,len(string)
+    chars(i) = string(i:i)
+  end do
+  i = len(string) + 1
+  chars(i) = C_NULL_CHAR ! C string compatibility
+  wrap%data = c_loc(chars)
+  wrap%size = len(string)
+end subroutine
+
+function FSUNAdjointCheckpointScheme_SetMmapOptions_Fixed(check_scheme, directory, memory_budget) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: check_scheme
+character(kind=C_CHAR, len=*), target :: directory
+character(kind=C_CHAR), dimension(:), allocatable, target :: farg2_chars
+integer(C_SIZE_T), intent(in) :: memory_budget
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+type(SwigArrayWrapper) :: farg2 
+integer(C_SIZE_T) :: farg3 
+
+farg1 = check_scheme
+call SWIG_string_to_chararray(directory, farg2_chars, farg2)
+farg3 = memory_budget
+fresult = swigc_FSUNAdjointCheckpointScheme_SetMmapOptions_Fixed(farg1, farg2, farg3)
+swig_result = fresult
+end function
+
+function FSUNAdjointCheckpointScheme_SetCompression_Fixed(check_scheme, ctype, errbound) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: check_scheme
+integer(SUNDataCompression), intent(in) :: ctype
+real(C_DOUBLE), intent(in) :: errbound
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+real(C_DOUBLE) :: farg3 
+
+farg1 = check_scheme
+farg2 = ctype
+farg3 = errbound
+fresult = swigc_FSUNAdjointCheckpointScheme_SetCompression_Fixed(farg1, farg2, farg3)
+swig_result = fresult
+end function
+
+
 end module
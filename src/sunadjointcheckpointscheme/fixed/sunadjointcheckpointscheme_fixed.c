@@ -17,12 +17,16 @@
  * SUNAdjointCheckpointScheme_Fixed class definition.
  * ----------------------------------------------------------------*/
 
+#include <string.h>
+
 #include <sunadjointcheckpointscheme/sunadjointcheckpointscheme_fixed.h>
 #include <sundials/sundials_adjointcheckpointscheme.h>
 #include <sundials/sundials_core.h>
 
 #include "sundatanode/sundatanode_inmem.h"
+#include "sundatanode/sundatanode_mmap.h"
 #include "sundials_adjointcheckpointscheme_impl.h"
+#include "sundials_compress_impl.h"
 #include "sundials_datanode.h"
 #include "sundials_logger_impl.h"
 #include "sundials_macros.h"
@@ -40,6 +44,17 @@ struct SUNAdjointCheckpointScheme_Fixed_Content_
   SUNDataNode current_load_step_node;
   SUNDataIOMode io_mode;
   sunbooleantype keep;
+  SUNDataArena_Mmap arena;
+  char* directory;
+  size_t memory_budget;
+  SUNDataCompression ctype; /* compression of the stored vectors    */
+  sunrealtype cbound;       /* absolute error bound                 */
+  sunrealtype* cwork;       /* packed vector buffer                 */
+  size_t cwork_len;         /* number of reals in cwork             */
+  void* cblob;              /* encoded vector buffer                */
+  size_t cblob_capacity;    /* allocated bytes of cblob             */
+  char* cpayload;           /* leaf payload (t followed by cblob)   */
+  size_t cpayload_capacity; /* allocated bytes of cpayload          */
 };
 
 typedef struct SUNAdjointCheckpointScheme_Fixed_Content_*
@@ -48,6 +63,101 @@ typedef struct SUNAdjointCheckpointScheme_Fixed_Content_*
 #define GET_CONTENT(S)       ((SUNAdjointCheckpointScheme_Fixed_Content)S->content)
 #define IMPL_MEMBER(S, prop) (GET_CONTENT(S)->prop)
 
+/* Make the packed vector buffer large enough for the vector v and return the
+   number of reals in the packed vector */
+static SUNErrCode fixedReserveWork(SUNAdjointCheckpointScheme self, N_Vector v,
+                                   size_t* len)
+{
+  SUNFunctionBegin(self->sunctx);
+
+  sunindextype buffer_size = 0;
+  SUNCheckCall(N_VBufSize(v, &buffer_size));
+
+  *len = (size_t)buffer_size / sizeof(sunrealtype);
+  if (*len > IMPL_MEMBER(self, cwork_len) || !IMPL_MEMBER(self, cwork))
+  {
+    sunrealtype* cwork = (sunrealtype*)realloc(IMPL_MEMBER(self, cwork),
+                                               SUNMAX(*len, 1) *
+                                                 sizeof(sunrealtype));
+    SUNAssert(cwork, SUN_ERR_MALLOC_FAIL);
+    IMPL_MEMBER(self, cwork)     = cwork;
+    IMPL_MEMBER(self, cwork_len) = SUNMAX(*len, 1);
+  }
+
+  return SUN_SUCCESS;
+}
+
+/* Store the compressed vector y and the time t in the leaf node */
+static SUNErrCode fixedSetDataCompressed(SUNAdjointCheckpointScheme self,
+                                         SUNDataNode node, N_Vector y,
+                                         sunrealtype t)
+{
+  SUNFunctionBegin(self->sunctx);
+
+  size_t len = 0;
+  SUNCheckCall(fixedReserveWork(self, y, &len));
+  SUNCheckCall(N_VBufPack(y, IMPL_MEMBER(self, cwork)));
+
+  size_t nbytes = 0;
+  SUNCheckCall(SUNCompress_Encode(IMPL_MEMBER(self, ctype), len,
+                                  IMPL_MEMBER(self, cwork), NULL, NULL,
+                                  IMPL_MEMBER(self, cbound), NULL,
+                                  &IMPL_MEMBER(self, cblob),
+                                  &IMPL_MEMBER(self, cblob_capacity), &nbytes));
+
+  /* The payload is t followed by the encoded vector */
+  size_t bytes = sizeof(sunrealtype) + nbytes;
+  if (bytes > IMPL_MEMBER(self, cpayload_capacity))
+  {
+    char* cpayload = (char*)realloc(IMPL_MEMBER(self, cpayload), bytes);
+    SUNAssert(cpayload, SUN_ERR_MALLOC_FAIL);
+    IMPL_MEMBER(self, cpayload)          = cpayload;
+    IMPL_MEMBER(self, cpayload_capacity) = bytes;
+  }
+  memcpy(IMPL_MEMBER(self, cpayload), &t, sizeof(sunrealtype));
+  memcpy(IMPL_MEMBER(self, cpayload) + sizeof(sunrealtype),
+         IMPL_MEMBER(self, cblob), nbytes);
+
+  SUNCheckCall(SUNDataNode_SetData(node, SUNMEMTYPE_HOST, SUNMEMTYPE_HOST,
+                                   IMPL_MEMBER(self, cpayload), 1, bytes));
+
+  return SUN_SUCCESS;
+}
+
+/* Load the compressed vector and the time stored in the leaf node */
+static SUNErrCode fixedGetDataCompressed(SUNAdjointCheckpointScheme self,
+                                         SUNDataNode node, N_Vector y,
+                                         sunrealtype* t)
+{
+  SUNFunctionBegin(self->sunctx);
+
+  void* data        = NULL;
+  size_t data_bytes = 0, data_stride = 0;
+  SUNCheckCall(SUNDataNode_GetData(node, &data, &data_stride, &data_bytes));
+  SUNAssert(data && data_bytes > sizeof(sunrealtype), SUN_ERR_ARG_CORRUPT);
+
+  size_t len = 0;
+  SUNCheckCall(fixedReserveWork(self, y, &len));
+
+  /* Copy the encoded vector to an aligned buffer before decoding it */
+  size_t nbytes = data_bytes - sizeof(sunrealtype);
+  if (nbytes > IMPL_MEMBER(self, cblob_capacity))
+  {
+    void* cblob = realloc(IMPL_MEMBER(self, cblob), nbytes);
+    SUNAssert(cblob, SUN_ERR_MALLOC_FAIL);
+    IMPL_MEMBER(self, cblob)          = cblob;
+    IMPL_MEMBER(self, cblob_capacity) = nbytes;
+  }
+  memcpy(t, data, sizeof(sunrealtype));
+  memcpy(IMPL_MEMBER(self, cblob), (char*)data + sizeof(sunrealtype), nbytes);
+
+  SUNCheckCall(SUNCompress_Decode(IMPL_MEMBER(self, cblob), len, NULL,
+                                  IMPL_MEMBER(self, cwork)));
+  SUNCheckCall(N_VBufUnpack(y, IMPL_MEMBER(self, cwork)));
+
+  return SUN_SUCCESS;
+}
+
 SUNErrCode SUNAdjointCheckpointScheme_Create_Fixed(
   SUNDataIOMode io_mode, SUNMemoryHelper mem_helper, suncountertype interval,
   suncountertype estimate, sunbooleantype keep, SUNContext sunctx,
@@ -78,6 +188,17 @@ SUNErrCode SUNAdjointCheckpointScheme_Create_Fixed(
   content->current_load_step_node     = NULL;
   content->step_num_of_current_load   = -2;
   content->io_mode                    = io_mode;
+  content->arena                      = NULL;
+  content->directory                  = NULL;
+  content->memory_budget              = 0;
+  content->ctype                      = SUNDATACOMPRESSION_NONE;
+  content->cbound                     = SUN_RCONST(0.0);
+  content->cwork                      = NULL;
+  content->cwork_len                  = 0;
+  content->cblob                      = NULL;
+  content->cblob_capacity             = 0;
+  content->cpayload                   = NULL;
+  content->cpayload_capacity          = 0;
 
   SUNCheckCall(
     SUNDataNode_CreateObject(io_mode, estimate, sunctx, &content->root_node));
@@ -131,10 +252,30 @@ SUNErrCode SUNAdjointCheckpointScheme_InsertVector_Fixed(
 
   /* Add the state data as a leaf node in the step node's list of children. */
   SUNDataNode solution_node = NULL;
-  SUNCheckCall(SUNDataNode_CreateLeaf(IMPL_MEMBER(self, io_mode),
-                                      IMPL_MEMBER(self, mem_helper), SUNCTX_,
-                                      &solution_node));
-  SUNCheckCall(SUNDataNode_SetDataNvector(solution_node, y, t));
+  if (IMPL_MEMBER(self, io_mode) == SUNDATAIOMODE_MMAP)
+  {
+    /* The file backing the leaves is created with the first checkpoint */
+    if (!IMPL_MEMBER(self, arena))
+    {
+      SUNCheckCall(SUNDataArena_Create_Mmap(IMPL_MEMBER(self, directory),
+                                            IMPL_MEMBER(self, memory_budget),
+                                            SUNCTX_, &IMPL_MEMBER(self, arena)));
+    }
+    SUNCheckCall(SUNDataNode_CreateLeaf_Mmap(IMPL_MEMBER(self, arena),
+                                             IMPL_MEMBER(self, mem_helper),
+                                             SUNCTX_, &solution_node));
+  }
+  else
+  {
+    SUNCheckCall(SUNDataNode_CreateLeaf(IMPL_MEMBER(self, io_mode),
+                                        IMPL_MEMBER(self, mem_helper), SUNCTX_,
+                                        &solution_node));
+  }
+  if (IMPL_MEMBER(self, ctype) == SUNDATACOMPRESSION_NONE)
+  {
+    SUNCheckCall(SUNDataNode_SetDataNvector(solution_node, y, t));
+  }
+  else { SUNCheckCall(fixedSetDataCompressed(self, solution_node, y, t)); }
 
   SUNLogExtraDebug(SUNCTX_->logger, "insert-stage",
                    "step_num = %d, stage_num = %d, t = " SUN_FORMAT_G, step_num,
@@ -235,7 +376,14 @@ SUNErrCode SUNAdjointCheckpointScheme_LoadVector_Fixed(
     return SUN_ERR_CHECKPOINT_NOT_FOUND;
   }
 
-  SUNCheckCall(SUNDataNode_GetDataNvector(solution_node, *yout, tout));
+  if (IMPL_MEMBER(self, ctype) == SUNDATACOMPRESSION_NONE)
+  {
+    SUNCheckCall(SUNDataNode_GetDataNvector(solution_node, *yout, tout));
+  }
+  else
+  {
+    SUNCheckCall(fixedGetDataCompressed(self, solution_node, *yout, tout));
+  }
   SUNLogExtraDebug(SUNCTX_->logger, "stage-loaded",
                    "step_num = %d, stage_num = %d, t = " SUN_FORMAT_G, step_num,
                    stage_num, *tout);
@@ -257,7 +405,12 @@ SUNErrCode SUNAdjointCheckpointScheme_Destroy_Fixed(
   SUNAdjointCheckpointScheme self = *self_ptr;
 
   SUNCheckCall(SUNDataNode_Destroy(&IMPL_MEMBER(self, root_node)));
+  SUNCheckCall(SUNDataArena_Destroy_Mmap(&IMPL_MEMBER(self, arena)));
 
+  free(IMPL_MEMBER(self, directory));
+  free(IMPL_MEMBER(self, cwork));
+  free(IMPL_MEMBER(self, cblob));
+  free(IMPL_MEMBER(self, cpayload));
   free(self->content);
   free(self->ops);
   free(self);
@@ -286,3 +439,53 @@ SUNErrCode SUNAdjointCheckpointScheme_EnableDense_Fixed(
 
   return SUN_SUCCESS;
 }
+
+SUNErrCode SUNAdjointCheckpointScheme_SetMmapOptions_Fixed(
+  SUNAdjointCheckpointScheme check_scheme, const char* directory,
+  size_t memory_budget)
+{
+  SUNFunctionBegin(check_scheme->sunctx);
+
+  /* The directory is only used when the first checkpoint is inserted */
+  free(IMPL_MEMBER(check_scheme, directory));
+  IMPL_MEMBER(check_scheme, directory) = NULL;
+  if (directory)
+  {
+    IMPL_MEMBER(check_scheme, directory) = (char*)malloc(strlen(directory) + 1);
+    SUNAssert(IMPL_MEMBER(check_scheme, directory), SUN_ERR_MALLOC_FAIL);
+    strcpy(IMPL_MEMBER(check_scheme, directory), directory);
+  }
+
+  IMPL_MEMBER(check_scheme, memory_budget) = memory_budget;
+  if (IMPL_MEMBER(check_scheme, arena))
+  {
+    SUNCheckCall(SUNDataArena_SetBudget_Mmap(IMPL_MEMBER(check_scheme, arena),
+                                             memory_budget));
+  }
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNAdjointCheckpointScheme_SetCompression_Fixed(
+  SUNAdjointCheckpointScheme check_scheme, SUNDataCompression ctype,
+  sunrealtype errbound)
+{
+  SUNFunctionBegin(check_scheme->sunctx);
+
+  /* Checkpoints may be loaded in any order, so delta encoding is not used */
+  SUNAssert(ctype == SUNDATACOMPRESSION_NONE ||
+              ctype == SUNDATACOMPRESSION_FLOAT ||
+              ctype == SUNDATACOMPRESSION_QUANTIZE,
+            SUN_ERR_ARG_OUTOFRANGE);
+  SUNAssert(ctype != SUNDATACOMPRESSION_QUANTIZE || errbound > SUN_RCONST(0.0),
+            SUN_ERR_ARG_OUTOFRANGE);
+
+  /* Checkpoints already stored keep their format */
+  SUNAssert(IMPL_MEMBER(check_scheme, step_num_of_current_insert) == -2,
+            SUN_ERR_ARG_INCOMPATIBLE);
+
+  IMPL_MEMBER(check_scheme, ctype)  = ctype;
+  IMPL_MEMBER(check_scheme, cbound) = errbound;
+
+  return SUN_SUCCESS;
+}
@@ -585,6 +585,64 @@ SWIGEXPORT int _wrap_FSUNProfiler_End(void *farg1, SwigArrayWrapper *farg2) {
 }
 
 
+SWIGEXPORT int _wrap_FSUNProfiler_GetTimer(void *farg1, SwigArrayWrapper *farg2, int *farg3) {
+  int fresult ;
+  SUNProfiler arg1 = (SUNProfiler) 0 ;
+  char *arg2 = (char *) 0 ;
+  int *arg3 = (int *) 0 ;
+  SUNErrCode result;
+  
+  arg1 = (SUNProfiler)(farg1);
+  arg2 = (char *)(farg2->data);
+  arg3 = (int *)(farg3);
+  result = (SUNErrCode)SUNProfiler_GetTimer(arg1,(char const *)arg2,arg3);
+  fresult = (SUNErrCode)(result);
+  return fresult;
+}
+
+
+SWIGEXPORT int _wrap_FSUNProfiler_BeginHandle(void *farg1, int const *farg2) {
+  int fresult ;
+  SUNProfiler arg1 = (SUNProfiler) 0 ;
+  int arg2 ;
+  SUNErrCode result;
+  
+  arg1 = (SUNProfiler)(farg1);
+  arg2 = (int)(*farg2);
+  result = (SUNErrCode)SUNProfiler_BeginHandle(arg1,arg2);
+  fresult = (SUNErrCode)(result);
+  return fresult;
+}
+
+
+SWIGEXPORT int _wrap_FSUNProfiler_EndHandle(void *farg1, int const *farg2) {
+  int fresult ;
+  SUNProfiler arg1 = (SUNProfiler) 0 ;
+  int arg2 ;
+  SUNErrCode result;
+  
+  arg1 = (SUNProfiler)(farg1);
+  arg2 = (int)(*farg2);
+  result = (SUNErrCode)SUNProfiler_EndHandle(arg1,arg2);
+  fresult = (SUNErrCode)(result);
+  return fresult;
+}
+
+
+SWIGEXPORT int _wrap_FSUNProfiler_SetHierarchical(void *farg1, int const *farg2) {
+  int fresult ;
+  SUNProfiler arg1 = (SUNProfiler) 0 ;
+  int arg2 ;
+  SUNErrCode result;
+  
+  arg1 = (SUNProfiler)(farg1);
+  arg2 = (int)(*farg2);
+  result = (SUNErrCode)SUNProfiler_SetHierarchical(arg1,arg2);
+  fresult = (SUNErrCode)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FSUNProfiler_GetTimerResolution(void *farg1, double *farg2) {
   int fresult ;
   SUNProfiler arg1 = (SUNProfiler) 0 ;
@@ -747,6 +805,20 @@ SWIGEXPORT int _wrap_FSUNLogger_SetInfoFilename(void *farg1, SwigArrayWrapper *f
 }
 
 
+SWIGEXPORT int _wrap_FSUNLogger_SetBinaryFilename(void *farg1, SwigArrayWrapper *farg2) {
+  int fresult ;
+  SUNLogger arg1 = (SUNLogger) 0 ;
+  char *arg2 = (char *) 0 ;
+  SUNErrCode result;
+  
+  arg1 = (SUNLogger)(farg1);
+  arg2 = (char *)(farg2->data);
+  result = (SUNErrCode)SUNLogger_SetBinaryFilename(arg1,(char const *)arg2);
+  fresult = (SUNErrCode)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FSUNLogger_QueueMsg(void *farg1, int const *farg2, SwigArrayWrapper *farg3, SwigArrayWrapper *farg4, SwigArrayWrapper *farg5) {
   int fresult ;
   SUNLogger arg1 = (SUNLogger) 0 ;
@@ -1562,6 +1634,38 @@ SWIGEXPORT int _wrap_FN_VDotProdMultiAllReduce(int const *farg1, N_Vector farg2,
 }
 
 
+SWIGEXPORT int _wrap_FN_VDotProdMultiAllReduceBegin(int const *farg1, N_Vector farg2, double *farg3) {
+  int fresult ;
+  int arg1 ;
+  N_Vector arg2 = (N_Vector) 0 ;
+  sunrealtype *arg3 = (sunrealtype *) 0 ;
+  SUNErrCode result;
+  
+  arg1 = (int)(*farg1);
+  arg2 = (N_Vector)(farg2);
+  arg3 = (sunrealtype *)(farg3);
+  result = (SUNErrCode)N_VDotProdMultiAllReduceBegin(arg1,arg2,arg3);
+  fresult = (SUNErrCode)(result);
+  return fresult;
+}
+
+
+SWIGEXPORT int _wrap_FN_VDotProdMultiAllReduceEnd(int const *farg1, N_Vector farg2, double *farg3) {
+  int fresult ;
+  int arg1 ;
+  N_Vector arg2 = (N_Vector) 0 ;
+  sunrealtype *arg3 = (sunrealtype *) 0 ;
+  SUNErrCode result;
+  
+  arg1 = (int)(*farg1);
+  arg2 = (N_Vector)(farg2);
+  arg3 = (sunrealtype *)(farg3);
+  result = (SUNErrCode)N_VDotProdMultiAllReduceEnd(arg1,arg2,arg3);
+  fresult = (SUNErrCode)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FN_VBufSize(N_Vector farg1, int32_t *farg2) {
   int fresult ;
   N_Vector arg1 = (N_Vector) 0 ;
@@ -65,9 +65,19 @@ module fsundials_core_mod
  ! enum SUNDataIOMode
  enum, bind(c)
   enumerator :: SUNDATAIOMODE_INMEM
+  enumerator :: SUNDATAIOMODE_MMAP
  end enum
  integer, parameter, public :: SUNDataIOMode = kind(SUNDATAIOMODE_INMEM)
- public :: SUNDATAIOMODE_INMEM
+ public :: SUNDATAIOMODE_INMEM, SUNDATAIOMODE_MMAP
+ ! enum SUNDataCompression
+ enum, bind(c)
+  enumerator :: SUNDATACOMPRESSION_NONE
+  enumerator :: SUNDATACOMPRESSION_FLOAT
+  enumerator :: SUNDATACOMPRESSION_QUANTIZE
+  enumerator :: SUNDATACOMPRESSION_DELTA
+ end enum
+ integer, parameter, public :: SUNDataCompression = kind(SUNDATACOMPRESSION_NONE)
+ public :: SUNDATACOMPRESSION_NONE, SUNDATACOMPRESSION_FLOAT, SUNDATACOMPRESSION_QUANTIZE, SUNDATACOMPRESSION_DELTA
  ! enum SUNErrCode_
  enum, bind(c)
   enumerator :: SUN_ERR_MINIMUM = -10000
@@ -134,6 +144,10 @@ module fsundials_core_mod
  public :: FSUNProfiler_Free
  public :: FSUNProfiler_Begin
  public :: FSUNProfiler_End
+ public :: FSUNProfiler_GetTimer
+ public :: FSUNProfiler_BeginHandle
+ public :: FSUNProfiler_EndHandle
+ public :: FSUNProfiler_SetHierarchical
  public :: FSUNProfiler_GetTimerResolution
  public :: FSUNProfiler_GetElapsedTime
  public :: FSUNProfiler_Print
@@ -156,6 +170,7 @@ module fsundials_core_mod
  public :: FSUNLogger_SetWarningFilename
  public :: FSUNLogger_SetDebugFilename
  public :: FSUNLogger_SetInfoFilename
+ public :: FSUNLogger_SetBinaryFilename
  public :: FSUNLogger_QueueMsg
  public :: FSUNLogger_Flush
  public :: FSUNLogger_GetOutputRank
@@ -242,6 +257,8 @@ module fsundials_core_mod
   type(C_FUNPTR), public :: nvwsqrsummasklocal
   type(C_FUNPTR), public :: nvdotprodmultilocal
   type(C_FUNPTR), public :: nvdotprodmultiallreduce
+  type(C_FUNPTR), public :: nvdotprodmultiallreducebegin
+  type(C_FUNPTR), public :: nvdotprodmultiallreduceend
   type(C_FUNPTR), public :: nvbufsize
   type(C_FUNPTR), public :: nvbufpack
   type(C_FUNPTR), public :: nvbufunpack
@@ -304,6 +321,8 @@ module fsundials_core_mod
  public :: FN_VMinQuotientLocal
  public :: FN_VDotProdMultiLocal
  public :: FN_VDotProdMultiAllReduce
+ public :: FN_VDotProdMultiAllReduceBegin
+ public :: FN_VDotProdMultiAllReduceEnd
  public :: FN_VBufSize
  public :: FN_VBufPack
  public :: FN_VBufUnpack
@@ -331,11 +350,13 @@ module fsundials_core_mod
   enumerator :: SUNMATRIX_GINKGO
   enumerator :: SUNMATRIX_GINKGOBATCH
   enumerator :: SUNMATRIX_KOKKOSDENSE
+  enumerator :: SUNMATRIX_BLOCKDENSE
   enumerator :: SUNMATRIX_CUSTOM
  end enum
  integer, parameter, public :: SUNMatrix_ID = kind(SUNMATRIX_DENSE)
  public :: SUNMATRIX_DENSE, SUNMATRIX_MAGMADENSE, SUNMATRIX_ONEMKLDENSE, SUNMATRIX_BAND, SUNMATRIX_SPARSE, SUNMATRIX_SLUNRLOC, &
-    SUNMATRIX_CUSPARSE, SUNMATRIX_GINKGO, SUNMATRIX_GINKGOBATCH, SUNMATRIX_KOKKOSDENSE, SUNMATRIX_CUSTOM
+    SUNMATRIX_CUSPARSE, SUNMATRIX_GINKGO, SUNMATRIX_GINKGOBATCH, SUNMATRIX_KOKKOSDENSE, SUNMATRIX_BLOCKDENSE, &
+    SUNMATRIX_CUSTOM
  ! struct struct _generic_SUNMatrix_Ops
  type, bind(C), public :: SUNMatrix_Ops
   type(C_FUNPTR), public :: getid
@@ -383,9 +404,10 @@ module fsundials_core_mod
  enum, bind(c)
   enumerator :: SUN_MODIFIED_GS = 1
   enumerator :: SUN_CLASSICAL_GS = 2
+  enumerator :: SUN_PIPELINED_GS = 3
  end enum
  integer, parameter, public :: SUNGramSchmidtType = kind(SUN_MODIFIED_GS)
- public :: SUN_MODIFIED_GS, SUN_CLASSICAL_GS
+ public :: SUN_MODIFIED_GS, SUN_CLASSICAL_GS, SUN_PIPELINED_GS
  public :: FSUNModifiedGS
  public :: FSUNClassicalGS
  public :: FSUNQRfact
@@ -426,6 +448,7 @@ module fsundials_core_mod
   enumerator :: SUNLINEARSOLVER_GINKGO
   enumerator :: SUNLINEARSOLVER_GINKGOBATCH
   enumerator :: SUNLINEARSOLVER_KOKKOSDENSE
+  enumerator :: SUNLINEARSOLVER_BLOCKDENSE
   enumerator :: SUNLINEARSOLVER_CUSTOM
  end enum
  integer, parameter, public :: SUNLinearSolver_ID = kind(SUNLINEARSOLVER_BAND)
@@ -433,7 +456,7 @@ module fsundials_core_mod
     SUNLINEARSOLVER_LAPACKDENSE, SUNLINEARSOLVER_PCG, SUNLINEARSOLVER_SPBCGS, SUNLINEARSOLVER_SPFGMR, SUNLINEARSOLVER_SPGMR, &
     SUNLINEARSOLVER_SPTFQMR, SUNLINEARSOLVER_SUPERLUDIST, SUNLINEARSOLVER_SUPERLUMT, SUNLINEARSOLVER_CUSOLVERSP_BATCHQR, &
     SUNLINEARSOLVER_MAGMADENSE, SUNLINEARSOLVER_ONEMKLDENSE, SUNLINEARSOLVER_GINKGO, SUNLINEARSOLVER_GINKGOBATCH, &
-    SUNLINEARSOLVER_KOKKOSDENSE, SUNLINEARSOLVER_CUSTOM
+    SUNLINEARSOLVER_KOKKOSDENSE, SUNLINEARSOLVER_BLOCKDENSE, SUNLINEARSOLVER_CUSTOM
  ! struct struct _generic_SUNLinearSolver_Ops
  type, bind(C), public :: SUNLinearSolver_Ops
   type(C_FUNPTR), public :: gettype
@@ -897,6 +920,44 @@ type(SwigArrayWrapper) :: farg2
 integer(C_INT) :: fresult
 end function
 
+function swigc_FSUNProfiler_GetTimer(farg1, farg2, farg3) &
+bind(C, name="_wrap_FSUNProfiler_GetTimer") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+import :: swigarraywrapper
+type(C_PTR), value :: farg1
+type(SwigArrayWrapper) :: farg2
+type(C_PTR), value :: farg3
+integer(C_INT) :: fresult
+end function
+
+function swigc_FSUNProfiler_BeginHandle(farg1, farg2) &
+bind(C, name="_wrap_FSUNProfiler_BeginHandle") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+integer(C_INT) :: fresult
+end function
+
+function swigc_FSUNProfiler_EndHandle(farg1, farg2) &
+bind(C, name="_wrap_FSUNProfiler_EndHandle") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+integer(C_INT) :: fresult
+end function
+
+function swigc_FSUNProfiler_SetHierarchical(farg1, farg2) &
+bind(C, name="_wrap_FSUNProfiler_SetHierarchical") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+integer(C_INT) :: fresult
+end function
+
 function swigc_FSUNProfiler_GetTimerResolution(farg1, farg2) &
 bind(C, name="_wrap_FSUNProfiler_GetTimerResolution") &
 result(fresult)
@@ -993,6 +1054,16 @@ type(SwigArrayWrapper) :: farg2
 integer(C_INT) :: fresult
 end function
 
+function swigc_FSUNLogger_SetBinaryFilename(farg1, farg2) &
+bind(C, name="_wrap_FSUNLogger_SetBinaryFilename") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+import :: swigarraywrapper
+type(C_PTR), value :: farg1
+type(SwigArrayWrapper) :: farg2
+integer(C_INT) :: fresult
+end function
+
 function swigc_FSUNLogger_QueueMsg(farg1, farg2, farg3, farg4, farg5) &
 bind(C, name="_wrap_FSUNLogger_QueueMsg") &
 result(fresult)
@@ -1514,6 +1585,26 @@ type(C_PTR), value :: farg3
 integer(C_INT) :: fresult
 end function
 
+function swigc_FN_VDotProdMultiAllReduceBegin(farg1, farg2, farg3) &
+bind(C, name="_wrap_FN_VDotProdMultiAllReduceBegin") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT), intent(in) :: farg1
+type(C_PTR), value :: farg2
+type(C_PTR), value :: farg3
+integer(C_INT) :: fresult
+end function
+
+function swigc_FN_VDotProdMultiAllReduceEnd(farg1, farg2, farg3) &
+bind(C, name="_wrap_FN_VDotProdMultiAllReduceEnd") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT), intent(in) :: farg1
+type(C_PTR), value :: farg2
+type(C_PTR), value :: farg3
+integer(C_INT) :: fresult
+end function
+
 function swigc_FN_VBufSize(farg1, farg2) &
 bind(C, name="_wrap_FN_VBufSize") &
 result(fresult)
@@ -3375,6 +3466,74 @@ fresult = swigc_FSUNProfiler_End(farg1, farg2)
 swig_result = fresult
 end function
 
+function FSUNProfiler_GetTimer(p, name, timer) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: p
+character(kind=C_CHAR, len=*), target :: name
+character(kind=C_CHAR), dimension(:), allocatable, target :: farg2_chars
+integer(C_INT), dimension(*), target, intent(inout) :: timer
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+type(SwigArrayWrapper) :: farg2 
+type(C_PTR) :: farg3 
+
+farg1 = p
+call SWIG_string_to_chararray(name, farg2_chars, farg2)
+farg3 = c_loc(timer(1))
+fresult = swigc_FSUNProfiler_GetTimer(farg1, farg2, farg3)
+swig_result = fresult
+end function
+
+function FSUNProfiler_BeginHandle(p, timer) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: p
+integer(C_INT), intent(in) :: timer
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+
+farg1 = p
+farg2 = timer
+fresult = swigc_FSUNProfiler_BeginHandle(farg1, farg2)
+swig_result = fresult
+end function
+
+function FSUNProfiler_EndHandle(p, timer) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: p
+integer(C_INT), intent(in) :: timer
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+
+farg1 = p
+farg2 = timer
+fresult = swigc_FSUNProfiler_EndHandle(farg1, farg2)
+swig_result = fresult
+end function
+
+function FSUNProfiler_SetHierarchical(p, onoff) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: p
+integer(C_INT), intent(in) :: onoff
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+
+farg1 = p
+farg2 = onoff
+fresult = swigc_FSUNProfiler_SetHierarchical(farg1, farg2)
+swig_result = fresult
+end function
+
 function FSUNProfiler_GetTimerResolution(p, resolution) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -3543,6 +3702,23 @@ fresult = swigc_FSUNLogger_SetInfoFilename(farg1, farg2)
 swig_result = fresult
 end function
 
+function FSUNLogger_SetBinaryFilename(logger, binary_filename) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: logger
+character(kind=C_CHAR, len=*), target :: binary_filename
+character(kind=C_CHAR), dimension(:), allocatable, target :: farg2_chars
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+type(SwigArrayWrapper) :: farg2 
+
+farg1 = logger
+call SWIG_string_to_chararray(binary_filename, farg2_chars, farg2)
+fresult = swigc_FSUNLogger_SetBinaryFilename(farg1, farg2)
+swig_result = fresult
+end function
+
 function FSUNLogger_QueueMsg(logger, lvl, scope, label, msg_txt) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -4492,6 +4668,44 @@ fresult = swigc_FN_VDotProdMultiAllReduce(farg1, farg2, farg3)
 swig_result = fresult
 end function
 
+function FN_VDotProdMultiAllReduceBegin(nvec_total, x, sum_1d) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+integer(C_INT), intent(in) :: nvec_total
+type(N_Vector), target, intent(inout) :: x
+real(C_DOUBLE), dimension(*), target, intent(inout) :: sum_1d
+integer(C_INT) :: fresult 
+integer(C_INT) :: farg1 
+type(C_PTR) :: farg2 
+type(C_PTR) :: farg3 
+
+farg1 = nvec_total
+farg2 = c_loc(x)
+farg3 = c_loc(sum_1d(1))
+fresult = swigc_FN_VDotProdMultiAllReduceBegin(farg1, farg2, farg3)
+swig_result = fresult
+end function
+
+function FN_VDotProdMultiAllReduceEnd(nvec_total, x, sum_1d) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+integer(C_INT), intent(in) :: nvec_total
+type(N_Vector), target, intent(inout) :: x
+real(C_DOUBLE), dimension(*), target, intent(inout) :: sum_1d
+integer(C_INT) :: fresult 
+integer(C_INT) :: farg1 
+type(C_PTR) :: farg2 
+type(C_PTR) :: farg3 
+
+farg1 = nvec_total
+farg2 = c_loc(x)
+farg3 = c_loc(sum_1d(1))
+fresult = swigc_FN_VDotProdMultiAllReduceEnd(farg1, farg2, farg3)
+swig_result = fresult
+end function
+
 function FN_VBufSize(x, size) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -461,13 +461,14 @@ static SUNErrCode sunDataNode_FreeKeyValue_InMem(SUNHashMapKeyValue* kv_ptr)
   SUNDataNode node = (SUNDataNode)((*kv_ptr)->value);
   free((*kv_ptr)->key);
   free(*kv_ptr);
-  SUNDataNode_Destroy_InMem(&node);
+  SUNDataNode_Destroy(&node);
   return SUN_SUCCESS;
 }
 
 /* This function is the callback provided to the child stlvector as the destroy function. */
 static SUNErrCode sunDataNode_FreeValue_InMem(SUNDataNode* nodeptr)
 {
-  SUNDataNode_Destroy_InMem(nodeptr);
+  if (!nodeptr || !(*nodeptr)) { return SUN_SUCCESS; }
+  SUNDataNode_Destroy(nodeptr);
   return SUN_SUCCESS;
 }
@@ -0,0 +1,585 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2025-2026, Lawrence Livermore National Security,
+ * University of Maryland Baltimore County, and the SUNDIALS contributors.
+ * Copyright (c) 2013-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * Copyright (c) 2002-2013, Lawrence Livermore National Security.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <sundials/sundials_config.h>
+#include <sundials/sundials_errors.h>
+#include <sundials/sundials_memory.h>
+#include <sundials/sundials_nvector.h>
+#include <sundials/sundials_types.h>
+
+#if defined(SUNDIALS_HAVE_MMAP)
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "sundatanode/sundatanode_inmem.h"
+#include "sundatanode/sundatanode_mmap.h"
+#include "sundials_datanode.h"
+#include "sundials_macros.h"
+
+#define GET_CONTENT(node)       ((SUNDataNode_MmapContent)(node)->content)
+#define IMPL_MEMBER(node, prop) (GET_CONTENT(node)->prop)
+#define BASE_MEMBER(node, prop) ((node)->prop)
+
+/* Default size of the file segments mapped at once (64 MiB) */
+#define SUNDATAARENA_SEGMENT_BYTES ((size_t)64 * 1024 * 1024)
+
+/* Alignment of the payloads in the file */
+#define SUNDATAARENA_ALIGN ((size_t)64)
+
+/* Default number of payloads to prefetch when reading from the file */
+#define SUNDATAARENA_READAHEAD 4
+
+/* -----------------------------------------------------------------
+ * Arena functions
+ * -----------------------------------------------------------------*/
+
+#if defined(SUNDIALS_HAVE_MMAP)
+
+static size_t sunRoundUp(size_t bytes, size_t align)
+{
+  return ((bytes + align - 1) / align) * align;
+}
+
+/* Map a new segment at the end of the file large enough to hold bytes */
+static SUNErrCode sunDataArena_AddSegment(SUNDataArena_Mmap arena, size_t bytes)
+{
+  if (arena->num_segments == arena->max_segments)
+  {
+    int new_max = (arena->max_segments > 0) ? 2 * arena->max_segments : 8;
+
+    char** new_ptr = (char**)realloc(arena->seg_ptr, new_max * sizeof(char*));
+    if (!new_ptr) { return SUN_ERR_MALLOC_FAIL; }
+    arena->seg_ptr = new_ptr;
+
+    size_t* new_sz = (size_t*)realloc(arena->seg_bytes, new_max * sizeof(size_t));
+    if (!new_sz) { return SUN_ERR_MALLOC_FAIL; }
+    arena->seg_bytes = new_sz;
+
+    new_sz = (size_t*)realloc(arena->seg_used, new_max * sizeof(size_t));
+    if (!new_sz) { return SUN_ERR_MALLOC_FAIL; }
+    arena->seg_used = new_sz;
+
+    arena->max_segments = new_max;
+  }
+
+  size_t seg_bytes = SUNMAX(arena->segment_bytes,
+                            sunRoundUp(bytes, arena->page_bytes));
+
+  if (ftruncate(arena->fd, (off_t)(arena->file_bytes + seg_bytes)))
+  {
+    return SUN_ERR_OP_FAIL;
+  }
+
+  void* ptr = mmap(NULL, seg_bytes, PROT_READ | PROT_WRITE, MAP_SHARED,
+                   arena->fd, (off_t)arena->file_bytes);
+  if (ptr == MAP_FAILED)
+  {
+    if (ftruncate(arena->fd, (off_t)arena->file_bytes)) { /* nothing to do */ }
+    return SUN_ERR_MEM_FAIL;
+  }
+
+  arena->seg_ptr[arena->num_segments]   = (char*)ptr;
+  arena->seg_bytes[arena->num_segments] = seg_bytes;
+  arena->seg_used[arena->num_segments]  = 0;
+  arena->num_segments++;
+  arena->file_bytes += seg_bytes;
+
+  return SUN_SUCCESS;
+}
+
+/* Release the file space above the last spilled payload. Payloads are
+   spilled in the order they were written, so the last spilled leaf holds
+   the top of the file. */
+static void sunDataArena_Trim(SUNDataArena_Mmap arena)
+{
+  SUNDataNode node = arena->next_spill ? IMPL_MEMBER(arena->next_spill, prev)
+                                       : arena->last;
+  int top_segment  = -1;
+  size_t top_used  = 0;
+  if (node)
+  {
+    top_segment = IMPL_MEMBER(node, segment);
+    top_used    = IMPL_MEMBER(node, offset) +
+               sunRoundUp(IMPL_MEMBER(node, bytes), SUNDATAARENA_ALIGN);
+  }
+
+  /* unmap the segments above the top */
+  while (arena->num_segments > top_segment + 1 && arena->num_segments > 1)
+  {
+    int s = arena->num_segments - 1;
+    munmap(arena->seg_ptr[s], arena->seg_bytes[s]);
+    arena->file_bytes -= arena->seg_bytes[s];
+    arena->num_segments--;
+  }
+
+  if (arena->num_segments > 0)
+  {
+    int s = arena->num_segments - 1;
+    arena->seg_used[s] = (top_segment == s) ? top_used : 0;
+  }
+
+  if (ftruncate(arena->fd, (off_t)arena->file_bytes)) { /* keep the space */ }
+}
+
+/* Append the payload of the oldest resident leaf to the file */
+static SUNErrCode sunDataArena_SpillNext(SUNDataArena_Mmap arena)
+{
+  SUNDataNode node = arena->next_spill;
+  size_t bytes     = IMPL_MEMBER(node, bytes);
+  size_t rbytes    = sunRoundUp(bytes, SUNDATAARENA_ALIGN);
+
+  int s = arena->num_segments - 1;
+  if (s < 0 || arena->seg_used[s] + rbytes > arena->seg_bytes[s])
+  {
+    SUNErrCode err = sunDataArena_AddSegment(arena, rbytes);
+    if (err) { return err; }
+    s = arena->num_segments - 1;
+  }
+
+  size_t offset = arena->seg_used[s];
+  char* dst     = arena->seg_ptr[s] + offset;
+  memcpy(dst, IMPL_MEMBER(node, buffer), bytes);
+  arena->seg_used[s] += rbytes;
+
+  /* start the write-back of the pages that were just filled */
+  size_t page_start = (offset / arena->page_bytes) * arena->page_bytes;
+  msync(arena->seg_ptr[s] + page_start, offset + bytes - page_start, MS_ASYNC);
+
+  free(IMPL_MEMBER(node, buffer));
+  IMPL_MEMBER(node, buffer)  = NULL;
+  IMPL_MEMBER(node, segment) = s;
+  IMPL_MEMBER(node, offset)  = offset;
+
+  arena->resident_bytes -= bytes;
+  arena->bytes_spilled += bytes;
+  arena->next_spill = IMPL_MEMBER(node, next);
+
+  return SUN_SUCCESS;
+}
+
+/* Spill resident payloads, oldest first, until the budget is met */
+static SUNErrCode sunDataArena_Enforce(SUNDataArena_Mmap arena)
+{
+  while (arena->resident_bytes > arena->budget && arena->next_spill)
+  {
+    SUNErrCode err = sunDataArena_SpillNext(arena);
+    if (err) { return err; }
+  }
+  return SUN_SUCCESS;
+}
+
+/* Ask the system to read ahead the spilled payloads written before node,
+   since checkpoints are loaded in the reverse of the order they were
+   written. */
+static void sunDataArena_ReadAhead(SUNDataArena_Mmap arena, SUNDataNode node)
+{
+  SUNDataNode prev = IMPL_MEMBER(node, prev);
+  for (int i = 0; i < arena->readahead && prev; i++)
+  {
+    if (IMPL_MEMBER(prev, segment) >= 0)
+    {
+      int s         = IMPL_MEMBER(prev, segment);
+      size_t offset = IMPL_MEMBER(prev, offset);
+      size_t start  = (offset / arena->page_bytes) * arena->page_bytes;
+      size_t length = offset + IMPL_MEMBER(prev, bytes) - start;
+      posix_madvise(arena->seg_ptr[s] + start, length, POSIX_MADV_WILLNEED);
+    }
+    prev = IMPL_MEMBER(prev, prev);
+  }
+}
+
+#endif
+
+SUNErrCode SUNDataArena_Create_Mmap(const char* directory, size_t budget,
+                                    SUNContext sunctx,
+                                    SUNDataArena_Mmap* arena_out)
+{
+  SUNFunctionBegin(sunctx);
+
+#if defined(SUNDIALS_HAVE_MMAP)
+  SUNDataArena_Mmap arena = (SUNDataArena_Mmap)malloc(sizeof(*arena));
+  SUNAssert(arena, SUN_ERR_MALLOC_FAIL);
+
+  if (!directory || directory[0] == '\0') { directory = getenv("TMPDIR"); }
+  if (!directory || directory[0] == '\0') { directory = "/tmp"; }
+
+  /* Create a new file and unlink it right away so it is removed once closed */
+  size_t path_len = strlen(directory) + 64;
+  char* path      = (char*)malloc(path_len);
+  SUNAssert(path, SUN_ERR_MALLOC_FAIL);
+
+  int fd = -1;
+  for (int attempt = 0; attempt < 100 && fd < 0; attempt++)
+  {
+    snprintf(path, path_len, "%s/sundials-data-%ld-%lx-%d", directory,
+             (long)getpid(), (unsigned long)(size_t)arena, attempt);
+    fd = open(path, O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);
+    if (fd < 0 && errno != EEXIST) { break; }
+  }
+
+  if (fd < 0)
+  {
+    free(path);
+    free(arena);
+    return SUN_ERR_FILE_OPEN;
+  }
+
+  unlink(path);
+  free(path);
+
+  long page_bytes = sysconf(_SC_PAGESIZE);
+
+  arena->sunctx             = sunctx;
+  arena->fd                 = fd;
+  arena->page_bytes         = (page_bytes > 0) ? (size_t)page_bytes : 4096;
+  arena->segment_bytes      = SUNDATAARENA_SEGMENT_BYTES;
+  arena->file_bytes         = 0;
+  arena->num_segments       = 0;
+  arena->max_segments       = 0;
+  arena->seg_ptr            = NULL;
+  arena->seg_bytes          = NULL;
+  arena->seg_used           = NULL;
+  arena->first              = NULL;
+  arena->last               = NULL;
+  arena->next_spill         = NULL;
+  arena->readahead          = SUNDATAARENA_READAHEAD;
+  arena->budget             = budget;
+  arena->resident_bytes     = 0;
+  arena->max_resident_bytes = 0;
+  arena->bytes_spilled      = 0;
+  arena->bytes_loaded       = 0;
+
+  *arena_out = arena;
+  return SUN_SUCCESS;
+#else
+  (void)directory;
+  (void)budget;
+  *arena_out = NULL;
+  return SUN_ERR_NOT_IMPLEMENTED;
+#endif
+}
+
+SUNErrCode SUNDataArena_SetBudget_Mmap(SUNDataArena_Mmap arena, size_t budget)
+{
+  SUNFunctionBegin(arena->sunctx);
+
+  arena->budget = budget;
+
+#if defined(SUNDIALS_HAVE_MMAP)
+  return sunDataArena_Enforce(arena);
+#else
+  return SUN_SUCCESS;
+#endif
+}
+
+SUNErrCode SUNDataArena_Destroy_Mmap(SUNDataArena_Mmap* arena_ptr)
+{
+  if (!arena_ptr || !(*arena_ptr)) { return SUN_SUCCESS; }
+
+  SUNDataArena_Mmap arena = *arena_ptr;
+
+  /* Detach any remaining leaves. Resident payloads are kept, while spilled
+     payloads are lost with the file, so the arena should outlive its leaves. */
+  SUNDataNode node = arena->first;
+  while (node)
+  {
+    SUNDataNode next = IMPL_MEMBER(node, next);
+    if (IMPL_MEMBER(node, segment) >= 0)
+    {
+      IMPL_MEMBER(node, segment) = -1;
+      IMPL_MEMBER(node, bytes)   = 0;
+    }
+    IMPL_MEMBER(node, arena) = NULL;
+    IMPL_MEMBER(node, prev)  = NULL;
+    IMPL_MEMBER(node, next)  = NULL;
+    node                     = next;
+  }
+
+#if defined(SUNDIALS_HAVE_MMAP)
+  for (int s = 0; s < arena->num_segments; s++)
+  {
+    munmap(arena->seg_ptr[s], arena->seg_bytes[s]);
+  }
+  close(arena->fd);
+#endif
+
+  free(arena->seg_ptr);
+  free(arena->seg_bytes);
+  free(arena->seg_used);
+  free(arena);
+  *arena_ptr = NULL;
+
+  return SUN_SUCCESS;
+}
+
+/* -----------------------------------------------------------------
+ * Leaf node functions
+ * -----------------------------------------------------------------*/
+
+/* Add a leaf with a new resident payload to the end of the arena */
+static SUNErrCode sunDataNode_Attach_Mmap(SUNDataNode self)
+{
+  SUNDataArena_Mmap arena = IMPL_MEMBER(self, arena);
+  if (!arena) { return SUN_SUCCESS; }
+
+  IMPL_MEMBER(self, prev) = arena->last;
+  IMPL_MEMBER(self, next) = NULL;
+  if (arena->last) { IMPL_MEMBER(arena->last, next) = self; }
+  else { arena->first = self; }
+  arena->last = self;
+  if (!arena->next_spill) { arena->next_spill = self; }
+
+  arena->resident_bytes += IMPL_MEMBER(self, bytes);
+  arena->max_resident_bytes = SUNMAX(arena->max_resident_bytes,
+                                     arena->resident_bytes);
+
+#if defined(SUNDIALS_HAVE_MMAP)
+  return sunDataArena_Enforce(arena);
+#else
+  return SUN_SUCCESS;
+#endif
+}
+
+/* Remove a leaf from the arena and release its payload */
+static void sunDataNode_Release_Mmap(SUNDataNode self)
+{
+  SUNDataArena_Mmap arena = IMPL_MEMBER(self, arena);
+  sunbooleantype spilled  = IMPL_MEMBER(self, segment) >= 0;
+  sunbooleantype linked   = arena && (arena->first == self ||
+                                    IMPL_MEMBER(self, prev) != NULL);
+
+  if (IMPL_MEMBER(self, buffer))
+  {
+    free(IMPL_MEMBER(self, buffer));
+    IMPL_MEMBER(self, buffer) = NULL;
+    if (arena) { arena->resident_bytes -= IMPL_MEMBER(self, bytes); }
+  }
+
+  if (linked)
+  {
+    SUNDataNode prev = IMPL_MEMBER(self, prev);
+    SUNDataNode next = IMPL_MEMBER(self, next);
+    if (prev) { IMPL_MEMBER(prev, next) = next; }
+    else { arena->first = next; }
+    if (next) { IMPL_MEMBER(next, prev) = prev; }
+    else { arena->last = prev; }
+    if (arena->next_spill == self) { arena->next_spill = next; }
+
+#if defined(SUNDIALS_HAVE_MMAP)
+    if (spilled) { sunDataArena_Trim(arena); }
+#endif
+  }
+
+  IMPL_MEMBER(self, prev)    = NULL;
+  IMPL_MEMBER(self, next)    = NULL;
+  IMPL_MEMBER(self, segment) = -1;
+  IMPL_MEMBER(self, offset)  = 0;
+  IMPL_MEMBER(self, bytes)   = 0;
+  IMPL_MEMBER(self, stride)  = 0;
+}
+
+/* Get a pointer to the payload, wherever it is */
+static void* sunDataNode_Payload_Mmap(SUNDataNode self)
+{
+  if (IMPL_MEMBER(self, buffer)) { return IMPL_MEMBER(self, buffer); }
+
+#if defined(SUNDIALS_HAVE_MMAP)
+  SUNDataArena_Mmap arena = IMPL_MEMBER(self, arena);
+  if (arena && IMPL_MEMBER(self, segment) >= 0)
+  {
+    arena->bytes_loaded += IMPL_MEMBER(self, bytes);
+    sunDataArena_ReadAhead(arena, self);
+    return arena->seg_ptr[IMPL_MEMBER(self, segment)] + IMPL_MEMBER(self, offset);
+  }
+#endif
+
+  return NULL;
+}
+
+SUNErrCode SUNDataNode_CreateLeaf_Mmap(SUNDataArena_Mmap arena,
+                                       SUNMemoryHelper mem_helper,
+                                       SUNContext sunctx, SUNDataNode* node_out)
+{
+  SUNFunctionBegin(sunctx);
+
+  SUNDataNode node;
+  SUNCheckCall(SUNDataNode_CreateEmpty(sunctx, &node));
+
+  node->ops->haschildren    = SUNDataNode_HasChildren_InMem;
+  node->ops->isleaf         = SUNDataNode_IsLeaf_InMem;
+  node->ops->islist         = SUNDataNode_IsList_InMem;
+  node->ops->isobject       = SUNDataNode_IsObject_InMem;
+  node->ops->getdata        = SUNDataNode_GetData_Mmap;
+  node->ops->getdatanvector = SUNDataNode_GetDataNvector_Mmap;
+  node->ops->setdata        = SUNDataNode_SetData_Mmap;
+  node->ops->setdatanvector = SUNDataNode_SetDataNvector_Mmap;
+  node->ops->destroy        = SUNDataNode_Destroy_Mmap;
+
+  SUNDataNode_MmapContent content =
+    (SUNDataNode_MmapContent)malloc(sizeof(*content));
+  SUNAssert(content, SUN_ERR_MALLOC_FAIL);
+
+  content->base.parent             = NULL;
+  content->base.mem_helper         = mem_helper;
+  content->base.leaf_data          = NULL;
+  content->base.name               = NULL;
+  content->base.named_children     = NULL;
+  content->base.num_named_children = 0;
+  content->base.anon_children      = NULL;
+
+  content->arena   = arena;
+  content->buffer  = NULL;
+  content->bytes   = 0;
+  content->stride  = 0;
+  content->segment = -1;
+  content->offset  = 0;
+  content->prev    = NULL;
+  content->next    = NULL;
+
+  BASE_MEMBER(node, dtype)   = SUNDATANODE_LEAF;
+  BASE_MEMBER(node, content) = (void*)content;
+
+  *node_out = node;
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNDataNode_GetData_Mmap(const SUNDataNode self, void** data,
+                                    size_t* data_stride, size_t* data_bytes)
+{
+  SUNFunctionBegin(self->sunctx);
+
+  *data_stride = IMPL_MEMBER(self, stride);
+  *data_bytes  = IMPL_MEMBER(self, bytes);
+  *data        = sunDataNode_Payload_Mmap(self);
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNDataNode_GetDataNvector_Mmap(const SUNDataNode self, N_Vector v,
+                                           sunrealtype* t)
+{
+  SUNFunctionBegin(self->sunctx);
+
+  sunindextype buffer_size = 0;
+  SUNCheckCall(N_VBufSize(v, &buffer_size));
+  SUNAssert((buffer_size + sizeof(sunrealtype)) == IMPL_MEMBER(self, bytes),
+            SUN_ERR_ARG_INCOMPATIBLE);
+
+  /* Spilled payloads are unpacked directly from the mapped file */
+  sunrealtype* data_ptr = (sunrealtype*)sunDataNode_Payload_Mmap(self);
+  SUNAssert(data_ptr, SUN_ERR_ARG_CORRUPT);
+
+  *t = data_ptr[0];
+  SUNCheckCall(N_VBufUnpack(v, &data_ptr[1]));
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNDataNode_SetData_Mmap(SUNDataNode self, SUNMemoryType src_mem_type,
+                                    SUNDIALS_MAYBE_UNUSED SUNMemoryType node_mem_type,
+                                    void* data, size_t data_stride,
+                                    size_t data_bytes)
+{
+  SUNFunctionBegin(self->sunctx);
+
+  /* Use the default queue for the memory helper */
+  void* queue = NULL;
+
+  SUNAssert(BASE_MEMBER(self, dtype) == SUNDATANODE_LEAF, SUN_ERR_ARG_WRONGTYPE);
+
+  /* File-backed payloads always live on the host */
+  SUNAssert(node_mem_type == SUNMEMTYPE_HOST, SUN_ERR_ARG_INCOMPATIBLE);
+
+  sunDataNode_Release_Mmap(self);
+
+  void* buffer = malloc(data_bytes);
+  SUNAssert(buffer, SUN_ERR_MALLOC_FAIL);
+
+  if (src_mem_type == SUNMEMTYPE_HOST) { memcpy(buffer, data, data_bytes); }
+  else
+  {
+    SUNMemoryHelper mem_helper = IMPL_MEMBER(self, base.mem_helper);
+
+    SUNMemory data_mem_src = SUNMemoryHelper_Wrap(mem_helper, data,
+                                                  src_mem_type);
+    SUNCheckLastErr();
+    SUNMemory data_mem_dst = SUNMemoryHelper_Wrap(mem_helper, buffer,
+                                                  SUNMEMTYPE_HOST);
+    SUNCheckLastErr();
+
+    SUNCheckCall(SUNMemoryHelper_Copy(mem_helper, data_mem_dst, data_mem_src,
+                                      data_bytes, queue));
+
+    SUNMemoryHelper_Dealloc(mem_helper, data_mem_src, queue);
+    SUNMemoryHelper_Dealloc(mem_helper, data_mem_dst, queue);
+  }
+
+  IMPL_MEMBER(self, buffer) = buffer;
+  IMPL_MEMBER(self, bytes)  = data_bytes;
+  IMPL_MEMBER(self, stride) = data_stride;
+
+  return sunDataNode_Attach_Mmap(self);
+}
+
+SUNErrCode SUNDataNode_SetDataNvector_Mmap(SUNDataNode self, N_Vector v,
+                                           sunrealtype t)
+{
+  SUNFunctionBegin(self->sunctx);
+
+  SUNAssert(BASE_MEMBER(self, dtype) == SUNDATANODE_LEAF, SUN_ERR_ARG_WRONGTYPE);
+
+  sunindextype buffer_size = 0;
+  SUNCheckCall(N_VBufSize(v, &buffer_size));
+
+  sunDataNode_Release_Mmap(self);
+
+  /* We allocate 1 extra sunrealtype for storing t */
+  size_t bytes          = (size_t)buffer_size + sizeof(sunrealtype);
+  sunrealtype* data_ptr = (sunrealtype*)malloc(bytes);
+  SUNAssert(data_ptr, SUN_ERR_MALLOC_FAIL);
+
+  /* BufPack will handle any necessary copies from the device */
+  data_ptr[0] = t;
+  SUNCheckCall(N_VBufPack(v, &data_ptr[1]));
+
+  IMPL_MEMBER(self, buffer) = data_ptr;
+  IMPL_MEMBER(self, bytes)  = bytes;
+  IMPL_MEMBER(self, stride) = sizeof(sunrealtype);
+
+  return sunDataNode_Attach_Mmap(self);
+}
+
+SUNErrCode SUNDataNode_Destroy_Mmap(SUNDataNode* node)
+{
+  if (!node || !(*node)) { return SUN_SUCCESS; }
+
+  sunDataNode_Release_Mmap(*node);
+
+  free(BASE_MEMBER(*node, content));
+  BASE_MEMBER(*node, content) = NULL;
+  free(BASE_MEMBER(*node, ops));
+  free(*node);
+  *node = NULL;
+
+  return SUN_SUCCESS;
+}
@@ -0,0 +1,131 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2025-2026, Lawrence Livermore National Security,
+ * University of Maryland Baltimore County, and the SUNDIALS contributors.
+ * Copyright (c) 2013-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * Copyright (c) 2002-2013, Lawrence Livermore National Security.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * File-backed SUNDataNode leaves. List and object nodes are the
+ * in-memory nodes, since they only hold references to children.
+ * Leaf payloads are kept in memory until the total size of the
+ * resident payloads exceeds the memory budget of the arena, at which
+ * point the oldest payloads are appended to a memory-mapped file.
+ * Spilled payloads are read directly from the mapping, and the file
+ * is truncated as the most recently spilled payloads are destroyed,
+ * so the arena behaves like a stack when checkpoints are consumed in
+ * reverse order.
+ * -----------------------------------------------------------------*/
+
+#ifndef _SUNDATANODE_MMAP_H
+#define _SUNDATANODE_MMAP_H
+
+#include <sundials/priv/sundials_errors_impl.h>
+#include <sundials/sundials_memory.h>
+#include <sundials/sundials_types.h>
+
+#include "sundatanode/sundatanode_inmem.h"
+#include "sundials_datanode.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct SUNDataArena_Mmap_* SUNDataArena_Mmap;
+
+struct SUNDataArena_Mmap_
+{
+  SUNContext sunctx;
+
+  // Backing file (unlinked after creation) and its mapped segments
+  int fd;
+  size_t page_bytes;
+  size_t segment_bytes;
+  size_t file_bytes;
+  int num_segments;
+  int max_segments;
+  char** seg_ptr;
+  size_t* seg_bytes;
+  size_t* seg_used;
+
+  // Leaves holding data in the order they were written. All leaves before
+  // next_spill have been spilled to the file.
+  SUNDataNode first;
+  SUNDataNode last;
+  SUNDataNode next_spill;
+
+  // Number of preceding payloads to prefetch when a spilled payload is read
+  int readahead;
+
+  // Memory budget and usage for resident payloads
+  size_t budget;
+  size_t resident_bytes;
+  size_t max_resident_bytes;
+
+  // Statistics
+  size_t bytes_spilled;
+  size_t bytes_loaded;
+};
+
+typedef struct SUNDataNode_MmapContent_* SUNDataNode_MmapContent;
+
+struct SUNDataNode_MmapContent_
+{
+  // In-memory node properties, this must be the first member so that
+  // list and object nodes can hold file-backed leaves.
+  struct SUNDataNode_InMemContent_ base;
+
+  // Arena the payload is spilled to (NULL if the payload is always resident)
+  SUNDataArena_Mmap arena;
+
+  // Resident payload, NULL once spilled
+  void* buffer;
+  size_t bytes;
+  size_t stride;
+
+  // Location of the spilled payload (segment < 0 if not spilled)
+  int segment;
+  size_t offset;
+
+  // Neighbors in the arena write order
+  SUNDataNode prev;
+  SUNDataNode next;
+};
+
+SUNErrCode SUNDataArena_Create_Mmap(const char* directory, size_t budget,
+                                    SUNContext sunctx, SUNDataArena_Mmap* arena);
+
+SUNErrCode SUNDataArena_SetBudget_Mmap(SUNDataArena_Mmap arena, size_t budget);
+
+SUNErrCode SUNDataArena_Destroy_Mmap(SUNDataArena_Mmap* arena);
+
+SUNErrCode SUNDataNode_CreateLeaf_Mmap(SUNDataArena_Mmap arena,
+                                       SUNMemoryHelper mem_helper,
+                                       SUNContext sunctx, SUNDataNode* node_out);
+
+SUNErrCode SUNDataNode_GetData_Mmap(const SUNDataNode self, void** data,
+                                    size_t* data_stride, size_t* data_bytes);
+
+SUNErrCode SUNDataNode_GetDataNvector_Mmap(const SUNDataNode self, N_Vector v,
+                                           sunrealtype* t);
+
+SUNErrCode SUNDataNode_SetData_Mmap(SUNDataNode self, SUNMemoryType src_mem_type,
+                                    SUNMemoryType node_mem_type, void* data,
+                                    size_t data_stride, size_t data_bytes);
+
+SUNErrCode SUNDataNode_SetDataNvector_Mmap(SUNDataNode self, N_Vector v,
+                                           sunrealtype t);
+
+SUNErrCode SUNDataNode_Destroy_Mmap(SUNDataNode* node);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _SUNDATANODE_MMAP_H
@@ -0,0 +1,660 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2025-2026, Lawrence Livermore National Security,
+ * University of Maryland Baltimore County, and the SUNDIALS contributors.
+ * Copyright (c) 2013-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * Copyright (c) 2002-2013, Lawrence Livermore National Security.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * Implementation of the lossy compression of stored vector data.
+ *
+ * An encoded buffer starts with two 64-bit words holding the method
+ * and the number of values, followed by
+ *   - raw:   the values as sunrealtype,
+ *   - float: the values as float,
+ *   - quant: for each block of COMPRESS_BLOCK values the quantization
+ *            step (sunrealtype) and the bits per value (uint8_t),
+ *            followed by the zigzag encoded quantized values packed
+ *            into 64-bit words.
+ * Values in a block are rounded to the nearest multiple of the step,
+ * 1.6 times the smallest error bound in the block, relative to the
+ * reference. A block containing values that are not finite or that
+ * need more bits than a sunrealtype is stored uncompressed, as is
+ * the whole array if quantization does not reduce its size.
+ * ----------------------------------------------------------------*/
+
+#include <float.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <sundials/sundials_config.h>
+#include <sundials/sundials_errors.h>
+#include <sundials/sundials_math.h>
+#include <sundials/sundials_nvector.h>
+#include <sundials/sundials_types.h>
+
+#include "sundials_compress_impl.h"
+#include "sundials_utils.h"
+
+#define ZERO SUN_RCONST(0.0)
+
+/* Ratio of the quantization step to the error bound */
+#define STEPFAC SUN_RCONST(1.6)
+
+/* Encoding methods stored in the buffer header */
+#define COMPRESS_RAW   0
+#define COMPRESS_FLOAT 1
+#define COMPRESS_QUANT 2
+
+/* Number of values sharing a quantization step */
+#define COMPRESS_BLOCK 64
+
+/* Bits per value marking an uncompressed block */
+#define COMPRESS_RAWBLOCK 255
+
+/* Size of the buffer header */
+#define COMPRESS_HEADER (2 * sizeof(uint64_t))
+
+/* Bits in a sunrealtype */
+#define COMPRESS_REALBITS ((int)(8 * sizeof(sunrealtype)))
+
+static size_t compress_Align(size_t bytes)
+{
+  return (bytes + sizeof(uint64_t) - 1) & ~(sizeof(uint64_t) - 1);
+}
+
+static size_t compress_NumBlocks(size_t n)
+{
+  return (n + COMPRESS_BLOCK - 1) / COMPRESS_BLOCK;
+}
+
+/* Grow the buffer to hold nbytes bytes */
+static SUNErrCode compress_Reserve(void** blob, size_t* capacity, size_t nbytes)
+{
+  void* tmp;
+
+  if (*blob && *capacity >= nbytes) { return SUN_SUCCESS; }
+
+  tmp = realloc(*blob, nbytes);
+  if (tmp == NULL) { return SUN_ERR_MALLOC_FAIL; }
+
+  *blob     = tmp;
+  *capacity = nbytes;
+
+  return SUN_SUCCESS;
+}
+
+static void compress_SetHeader(void* blob, uint64_t method, size_t n)
+{
+  uint64_t header[2];
+
+  header[0] = method;
+  header[1] = (uint64_t)n;
+  memcpy(blob, header, COMPRESS_HEADER);
+}
+
+#if !defined(SUNDIALS_EXTENDED_PRECISION)
+
+static uint64_t compress_RealToBits(sunrealtype x)
+{
+#if defined(SUNDIALS_SINGLE_PRECISION)
+  uint32_t u;
+#else
+  uint64_t u;
+#endif
+  memcpy(&u, &x, sizeof(u));
+  return (uint64_t)u;
+}
+
+static sunrealtype compress_BitsToReal(uint64_t bits)
+{
+  sunrealtype x;
+#if defined(SUNDIALS_SINGLE_PRECISION)
+  uint32_t u = (uint32_t)bits;
+#else
+  uint64_t u = bits;
+#endif
+  memcpy(&x, &u, sizeof(u));
+  return x;
+}
+
+static uint64_t compress_ZigZag(int64_t q)
+{
+  return ((uint64_t)q << 1) ^ (uint64_t)(-(int64_t)(q < 0));
+}
+
+static int64_t compress_UnZigZag(uint64_t z)
+{
+  return (int64_t)(z >> 1) ^ -(int64_t)(z & 1);
+}
+
+/* Write the nbits low bits of v at bit position pos (words are zeroed) */
+static void compress_PutBits(uint64_t* words, size_t pos, int nbits, uint64_t v)
+{
+  size_t k = pos >> 6;
+  int off  = (int)(pos & 63);
+
+  words[k] |= v << off;
+  if (off + nbits > 64) { words[k + 1] |= v >> (64 - off); }
+}
+
+/* Read nbits (> 0) bits at bit position pos */
+static uint64_t compress_GetBits(const uint64_t* words, size_t pos, int nbits)
+{
+  size_t k   = pos >> 6;
+  int off    = (int)(pos & 63);
+  uint64_t v = words[k] >> off;
+
+  if (off + nbits > 64) { v |= words[k + 1] << (64 - off); }
+  if (nbits < 64) { v &= ((uint64_t)1 << nbits) - 1; }
+
+  return v;
+}
+
+/* Quantization step of the values lo..hi-1. Rounding to the nearest
+   multiple contributes at most 0.8 times the smallest bound and the
+   reconstruction (see compress_BlockBits) at most 0.2 times. */
+static sunrealtype compress_Step(size_t lo, size_t hi, const sunrealtype* w,
+                                 sunrealtype tol)
+{
+  size_t i;
+  sunrealtype wmax = ZERO;
+
+  if (w == NULL) { return STEPFAC * tol; }
+
+  for (i = lo; i < hi; i++)
+  {
+    if (!(w[i] <= wmax)) { wmax = w[i]; }
+  }
+
+  return STEPFAC * tol / wmax;
+}
+
+/* Bits per quantized value in the values lo..hi-1 or COMPRESS_RAWBLOCK if
+   the block cannot be quantized */
+static int compress_BlockBits(size_t lo, size_t hi, const sunrealtype* x,
+                              const sunrealtype* ref, sunrealtype step)
+{
+  size_t i;
+  int nbits;
+  sunrealtype s;
+  uint64_t z, zmax = 0;
+
+  /* largest value with a reconstruction error below step / 8 */
+  const sunrealtype xmax = step / (SUN_RCONST(8.0) * SUN_UNIT_ROUNDOFF);
+
+  if (!(step > ZERO && step <= SUN_BIG_REAL)) { return COMPRESS_RAWBLOCK; }
+
+  for (i = lo; i < hi; i++)
+  {
+    s = (ref ? x[i] - ref[i] : x[i]) / step;
+    if (!(SUNRabs(x[i]) <= xmax && SUNRabs(s) <= xmax))
+    {
+      return COMPRESS_RAWBLOCK;
+    }
+    z = compress_ZigZag((int64_t)SUNRround(s));
+    if (z > zmax) { zmax = z; }
+  }
+
+  for (nbits = 0; zmax; nbits++) { zmax >>= 1; }
+
+  return (nbits < COMPRESS_REALBITS) ? nbits : COMPRESS_RAWBLOCK;
+}
+
+static SUNErrCode compress_Quantize(size_t n, const sunrealtype* x,
+                                    const sunrealtype* ref,
+                                    const sunrealtype* w, sunrealtype tol,
+                                    sunrealtype* xrec, void** blob,
+                                    size_t* capacity, size_t* nbytes)
+{
+  SUNErrCode err;
+  size_t b, i, lo, hi, pos, nwords, size;
+  size_t nblocks = compress_NumBlocks(n);
+  size_t nbits_total;
+  int nbits;
+  int64_t q;
+  sunrealtype step, r;
+  sunrealtype* steps;
+  uint8_t* bits;
+  uint64_t* words;
+  char* data;
+
+  /* size the buffer */
+  nbits_total = 0;
+  for (b = 0; b < nblocks; b++)
+  {
+    lo    = b * COMPRESS_BLOCK;
+    hi    = SUNMIN(lo + COMPRESS_BLOCK, n);
+    step  = compress_Step(lo, hi, w, tol);
+    nbits = compress_BlockBits(lo, hi, x, ref, step);
+    if (nbits == COMPRESS_RAWBLOCK) { nbits = COMPRESS_REALBITS; }
+    nbits_total += (hi - lo) * (size_t)nbits;
+  }
+
+  nwords = (nbits_total + 63) / 64;
+  size   = COMPRESS_HEADER + compress_Align(nblocks * sizeof(sunrealtype)) +
+         compress_Align(nblocks) + nwords * sizeof(uint64_t);
+
+  /* not worth it, store the values instead */
+  if (size >= COMPRESS_HEADER + n * sizeof(sunrealtype))
+  {
+    return SUN_ERR_OP_FAIL;
+  }
+
+  err = compress_Reserve(blob, capacity, size);
+  if (err) { return err; }
+
+  data  = (char*)(*blob);
+  steps = (sunrealtype*)(data + COMPRESS_HEADER);
+  bits  = (uint8_t*)(data + COMPRESS_HEADER +
+                    compress_Align(nblocks * sizeof(sunrealtype)));
+  words = (uint64_t*)(data + COMPRESS_HEADER +
+                      compress_Align(nblocks * sizeof(sunrealtype)) +
+                      compress_Align(nblocks));
+
+  compress_SetHeader(*blob, COMPRESS_QUANT, n);
+  memset(words, 0, nwords * sizeof(uint64_t));
+
+  /* encode */
+  pos = 0;
+  for (b = 0; b < nblocks; b++)
+  {
+    lo       = b * COMPRESS_BLOCK;
+    hi       = SUNMIN(lo + COMPRESS_BLOCK, n);
+    step     = compress_Step(lo, hi, w, tol);
+    nbits    = compress_BlockBits(lo, hi, x, ref, step);
+    steps[b] = step;
+    bits[b]  = (uint8_t)nbits;
+
+    if (nbits == COMPRESS_RAWBLOCK)
+    {
+      for (i = lo; i < hi; i++)
+      {
+        compress_PutBits(words, pos, COMPRESS_REALBITS,
+                         compress_RealToBits(x[i]));
+        pos += COMPRESS_REALBITS;
+        if (xrec) { xrec[i] = x[i]; }
+      }
+      continue;
+    }
+
+    for (i = lo; i < hi; i++)
+    {
+      r = ref ? ref[i] : ZERO;
+      q = (int64_t)SUNRround((ref ? x[i] - ref[i] : x[i]) / step);
+      if (nbits > 0)
+      {
+        compress_PutBits(words, pos, nbits, compress_ZigZag(q));
+        pos += (size_t)nbits;
+      }
+      if (xrec) { xrec[i] = r + (sunrealtype)q * step; }
+    }
+  }
+
+  *nbytes = size;
+
+  return SUN_SUCCESS;
+}
+
+static void compress_Dequantize(const void* blob, size_t n,
+                                const sunrealtype* ref, sunrealtype* x)
+{
+  size_t b, i, lo, hi, pos;
+  size_t nblocks = compress_NumBlocks(n);
+  int nbits;
+  int64_t q;
+  sunrealtype r;
+  const char* data = (const char*)blob;
+  const sunrealtype* steps;
+  const uint8_t* bits;
+  const uint64_t* words;
+
+  steps = (const sunrealtype*)(data + COMPRESS_HEADER);
+  bits  = (const uint8_t*)(data + COMPRESS_HEADER +
+                          compress_Align(nblocks * sizeof(sunrealtype)));
+  words = (const uint64_t*)(data + COMPRESS_HEADER +
+                            compress_Align(nblocks * sizeof(sunrealtype)) +
+                            compress_Align(nblocks));
+
+  pos = 0;
+  for (b = 0; b < nblocks; b++)
+  {
+    lo    = b * COMPRESS_BLOCK;
+    hi    = SUNMIN(lo + COMPRESS_BLOCK, n);
+    nbits = bits[b];
+
+    if (nbits == COMPRESS_RAWBLOCK)
+    {
+      for (i = lo; i < hi; i++)
+      {
+        x[i] = compress_BitsToReal(
+          compress_GetBits(words, pos, COMPRESS_REALBITS));
+        pos += COMPRESS_REALBITS;
+      }
+      continue;
+    }
+
+    for (i = lo; i < hi; i++)
+    {
+      r = ref ? ref[i] : ZERO;
+      q = 0;
+      if (nbits > 0)
+      {
+        q = compress_UnZigZag(compress_GetBits(words, pos, nbits));
+        pos += (size_t)nbits;
+      }
+      x[i] = r + (sunrealtype)q * steps[b];
+    }
+  }
+}
+
+#endif
+
+static SUNErrCode compress_Raw(size_t n, const sunrealtype* x,
+                               sunrealtype* xrec, void** blob,
+                               size_t* capacity, size_t* nbytes)
+{
+  SUNErrCode err;
+  size_t size = COMPRESS_HEADER + n * sizeof(sunrealtype);
+
+  err = compress_Reserve(blob, capacity, size);
+  if (err) { return err; }
+
+  compress_SetHeader(*blob, COMPRESS_RAW, n);
+  memcpy((char*)(*blob) + COMPRESS_HEADER, x, n * sizeof(sunrealtype));
+  if (xrec && xrec != x) { memcpy(xrec, x, n * sizeof(sunrealtype)); }
+
+  *nbytes = size;
+
+  return SUN_SUCCESS;
+}
+
+#if !defined(SUNDIALS_SINGLE_PRECISION)
+
+static SUNErrCode compress_Float(size_t n, const sunrealtype* x,
+                                 sunrealtype* xrec, void** blob,
+                                 size_t* capacity, size_t* nbytes)
+{
+  SUNErrCode err;
+  size_t i;
+  size_t size = COMPRESS_HEADER + compress_Align(n * sizeof(float));
+  float* data;
+
+  /* values that overflow a float are stored instead */
+  for (i = 0; i < n; i++)
+  {
+    if (SUNRabs(x[i]) > FLT_MAX && SUNRabs(x[i]) <= SUN_BIG_REAL)
+    {
+      return SUN_ERR_OP_FAIL;
+    }
+  }
+
+  err = compress_Reserve(blob, capacity, size);
+  if (err) { return err; }
+
+  compress_SetHeader(*blob, COMPRESS_FLOAT, n);
+  data = (float*)((char*)(*blob) + COMPRESS_HEADER);
+  for (i = 0; i < n; i++) { data[i] = (float)x[i]; }
+  if (xrec)
+  {
+    for (i = 0; i < n; i++) { xrec[i] = (sunrealtype)data[i]; }
+  }
+
+  *nbytes = size;
+
+  return SUN_SUCCESS;
+}
+
+#endif
+
+SUNErrCode SUNCompress_Encode(SUNDataCompression type, size_t n,
+                              const sunrealtype* x, const sunrealtype* ref,
+                              const sunrealtype* w, sunrealtype tol,
+                              sunrealtype* xrec, void** blob, size_t* capacity,
+                              size_t* nbytes)
+{
+  SUNErrCode err = SUN_ERR_OP_FAIL;
+
+  switch (type)
+  {
+  case SUNDATACOMPRESSION_NONE: break;
+  case SUNDATACOMPRESSION_FLOAT:
+#if !defined(SUNDIALS_SINGLE_PRECISION)
+    err = compress_Float(n, x, xrec, blob, capacity, nbytes);
+#endif
+    break;
+  case SUNDATACOMPRESSION_QUANTIZE:
+  case SUNDATACOMPRESSION_DELTA:
+#if !defined(SUNDIALS_EXTENDED_PRECISION)
+    if (tol > ZERO)
+    {
+      err = compress_Quantize(n, x, ref, w, tol, xrec, blob, capacity, nbytes);
+    }
+#endif
+    break;
+  default: return SUN_ERR_ARG_OUTOFRANGE;
+  }
+
+  /* fall back to storing the values */
+  if (err == SUN_ERR_OP_FAIL)
+  {
+    err = compress_Raw(n, x, xrec, blob, capacity, nbytes);
+  }
+
+  return err;
+}
+
+SUNErrCode SUNCompress_Decode(const void* blob, size_t n,
+                              const sunrealtype* ref, sunrealtype* x)
+{
+  size_t i;
+  uint64_t header[2];
+  const char* data = (const char*)blob;
+
+  if (blob == NULL || x == NULL) { return SUN_ERR_ARG_CORRUPT; }
+
+  memcpy(header, blob, COMPRESS_HEADER);
+  if (header[1] != (uint64_t)n) { return SUN_ERR_ARG_INCOMPATIBLE; }
+
+  switch (header[0])
+  {
+  case COMPRESS_RAW:
+    memcpy(x, data + COMPRESS_HEADER, n * sizeof(sunrealtype));
+    break;
+  case COMPRESS_FLOAT:
+    for (i = 0; i < n; i++)
+    {
+      x[i] = (sunrealtype)((const float*)(data + COMPRESS_HEADER))[i];
+    }
+    break;
+#if !defined(SUNDIALS_EXTENDED_PRECISION)
+  case COMPRESS_QUANT: compress_Dequantize(blob, n, ref, x); break;
+#endif
+  default: return SUN_ERR_ARG_CORRUPT;
+  }
+
+  return SUN_SUCCESS;
+}
+
+sunbooleantype SUNCompress_VectorSupported(N_Vector v)
+{
+  return (v && v->ops->nvbufsize && v->ops->nvbufpack && v->ops->nvbufunpack)
+           ? SUNTRUE
+           : SUNFALSE;
+}
+
+SUNErrCode SUNCompressStore_Create(SUNDataCompression type, long int nslots,
+                                   N_Vector tmpl, SUNCompressStore* store_ptr)
+{
+  SUNErrCode err;
+  sunindextype bytes = 0;
+  SUNCompressStore store;
+
+  if (store_ptr == NULL || nslots < 1) { return SUN_ERR_ARG_CORRUPT; }
+  if (type < SUNDATACOMPRESSION_NONE || type > SUNDATACOMPRESSION_DELTA)
+  {
+    return SUN_ERR_ARG_OUTOFRANGE;
+  }
+  if (!SUNCompress_VectorSupported(tmpl)) { return SUN_ERR_NOT_IMPLEMENTED; }
+
+  err = N_VBufSize(tmpl, &bytes);
+  if (err) { return err; }
+  if (bytes < 0 || bytes % (sunindextype)sizeof(sunrealtype))
+  {
+    return SUN_ERR_ARG_INCOMPATIBLE;
+  }
+
+  store = (SUNCompressStore)calloc(1, sizeof(*store));
+  if (store == NULL) { return SUN_ERR_MALLOC_FAIL; }
+
+  store->type   = type;
+  store->nslots = nslots;
+  store->n      = (size_t)bytes / sizeof(sunrealtype);
+  store->last   = -1;
+
+  store->blob     = (void**)calloc((size_t)nslots, sizeof(void*));
+  store->capacity = (size_t*)calloc((size_t)nslots, sizeof(size_t));
+  store->nbytes   = (size_t*)calloc((size_t)nslots, sizeof(size_t));
+  store->keyframe = (sunbooleantype*)calloc((size_t)nslots,
+                                            sizeof(sunbooleantype));
+  store->x = (sunrealtype*)malloc(SUNMAX(store->n, 1) * sizeof(sunrealtype));
+  store->w = (sunrealtype*)malloc(SUNMAX(store->n, 1) * sizeof(sunrealtype));
+  if (type == SUNDATACOMPRESSION_DELTA)
+  {
+    store->prev = (sunrealtype*)malloc(SUNMAX(store->n, 1) *
+                                       sizeof(sunrealtype));
+  }
+
+  if (!store->blob || !store->capacity || !store->nbytes || !store->keyframe ||
+      !store->x || !store->w ||
+      (type == SUNDATACOMPRESSION_DELTA && !store->prev))
+  {
+    SUNCompressStore_Destroy(&store);
+    return SUN_ERR_MALLOC_FAIL;
+  }
+
+  *store_ptr = store;
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNCompressStore_Insert(SUNCompressStore store, long int i,
+                                   N_Vector v, N_Vector w, sunrealtype tol)
+{
+  SUNErrCode err;
+  sunbooleantype key    = SUNTRUE;
+  const sunrealtype* ref = NULL;
+  sunrealtype* xrec      = NULL;
+
+  if (i < 0 || i >= store->nslots) { return SUN_ERR_ARG_OUTOFRANGE; }
+
+  err = N_VBufPack(v, store->x);
+  if (err) { return err; }
+
+  if (w)
+  {
+    err = N_VBufPack(w, store->w);
+    if (err) { return err; }
+  }
+
+  /* encode against the previous slot unless this is a keyframe */
+  if (store->type == SUNDATACOMPRESSION_DELTA)
+  {
+    key  = (i % SUN_COMPRESS_KEYFRAME_INTERVAL == 0) || (store->last != i - 1);
+    ref  = key ? NULL : store->prev;
+    xrec = store->prev;
+  }
+
+  if (store->nbytes[i])
+  {
+    store->raw_bytes -= store->n * sizeof(sunrealtype);
+    store->stored_bytes -= store->nbytes[i];
+    store->nbytes[i] = 0;
+  }
+
+  err = SUNCompress_Encode(store->type, store->n, store->x, ref,
+                           w ? store->w : NULL, tol, xrec, &store->blob[i],
+                           &store->capacity[i], &store->nbytes[i]);
+  if (err) { return err; }
+
+  store->keyframe[i] = key;
+  store->last        = i;
+  store->raw_bytes += store->n * sizeof(sunrealtype);
+  store->stored_bytes += store->nbytes[i];
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNCompressStore_Load(SUNCompressStore store, long int i,
+                                 N_Vector v)
+{
+  SUNErrCode err;
+  long int k;
+  double t0;
+
+  if (i < 0 || i >= store->nslots || !store->nbytes[i])
+  {
+    return SUN_ERR_ARG_OUTOFRANGE;
+  }
+
+  t0 = sunWallTime();
+
+  /* decode from the preceding keyframe */
+  k = i;
+  if (store->type == SUNDATACOMPRESSION_DELTA)
+  {
+    while (k > 0 && !store->keyframe[k]) { k--; }
+  }
+
+  err = SUNCompress_Decode(store->blob[k], store->n, NULL, store->x);
+  if (err) { return err; }
+
+  for (k = k + 1; k <= i; k++)
+  {
+    err = SUNCompress_Decode(store->blob[k], store->n, store->x, store->x);
+    if (err) { return err; }
+  }
+
+  err = N_VBufUnpack(v, store->x);
+  if (err) { return err; }
+
+  store->ndecode++;
+  store->decode_time += sunWallTime() - t0;
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNCompressStore_Destroy(SUNCompressStore* store_ptr)
+{
+  long int i;
+  SUNCompressStore store;
+
+  if (store_ptr == NULL || *store_ptr == NULL) { return SUN_SUCCESS; }
+
+  store = *store_ptr;
+
+  if (store->blob)
+  {
+    for (i = 0; i < store->nslots; i++) { free(store->blob[i]); }
+  }
+
+  free(store->blob);
+  free(store->capacity);
+  free(store->nbytes);
+  free(store->keyframe);
+  free(store->x);
+  free(store->w);
+  free(store->prev);
+  free(store);
+
+  *store_ptr = NULL;
+
+  return SUN_SUCCESS;
+}
@@ -0,0 +1,118 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2025-2026, Lawrence Livermore National Security,
+ * University of Maryland Baltimore County, and the SUNDIALS contributors.
+ * Copyright (c) 2013-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * Copyright (c) 2002-2013, Lawrence Livermore National Security.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * Lossy compression of stored vector data (e.g., checkpoints and
+ * interpolation data for adjoints).
+ *
+ * SUNCompress_Encode and SUNCompress_Decode convert an array of
+ * reals to and from a self-describing byte buffer. The values are
+ * either downcast to float or quantized with an absolute error
+ * bound, optionally relative to a reference array (delta encoding).
+ *
+ * A SUNCompressStore holds the compressed copies of a fixed number
+ * of vectors (slots), packed to the host with N_VBufPack. In delta
+ * mode each slot is encoded against the previously inserted slot,
+ * with a full (keyframe) slot at a fixed interval, so slots must be
+ * inserted in increasing order.
+ * ----------------------------------------------------------------*/
+
+#ifndef _SUNDIALS_COMPRESS_IMPL_H
+#define _SUNDIALS_COMPRESS_IMPL_H
+
+#include <stddef.h>
+
+#include <sundials/sundials_errors.h>
+#include <sundials/sundials_nvector.h>
+#include <sundials/sundials_types.h>
+
+#ifdef __cplusplus /* wrapper to enable C++ usage */
+extern "C" {
+#endif
+
+/* Number of slots between keyframes in delta mode */
+#define SUN_COMPRESS_KEYFRAME_INTERVAL 8
+
+/* Encode the n values x. With SUNDATACOMPRESSION_QUANTIZE or
+   SUNDATACOMPRESSION_DELTA, the error in value i is at most tol / w[i]
+   (tol if w is NULL) and the values are encoded relative to ref (zero if
+   ref is NULL). The buffer *blob of *capacity bytes is reallocated as
+   needed and *nbytes is set to the encoded size. If xrec is not NULL it
+   holds the decoded values on return (xrec may alias ref). */
+SUNDIALS_EXPORT
+SUNErrCode SUNCompress_Encode(SUNDataCompression type, size_t n,
+                              const sunrealtype* x, const sunrealtype* ref,
+                              const sunrealtype* w, sunrealtype tol,
+                              sunrealtype* xrec, void** blob, size_t* capacity,
+                              size_t* nbytes);
+
+/* Decode the n values in blob with reference ref (zero if NULL) into x
+   (x may alias ref) */
+SUNDIALS_EXPORT
+SUNErrCode SUNCompress_Decode(const void* blob, size_t n,
+                              const sunrealtype* ref, sunrealtype* x);
+
+typedef struct SUNCompressStore_* SUNCompressStore;
+
+struct SUNCompressStore_
+{
+  SUNDataCompression type; /* compression method                    */
+  long int nslots;         /* number of slots                       */
+  size_t n;                /* number of reals in a packed vector    */
+
+  void** blob;              /* encoded data of each slot             */
+  size_t* capacity;         /* allocated bytes of each slot          */
+  size_t* nbytes;           /* encoded bytes of each slot (0 = empty) */
+  sunbooleantype* keyframe; /* delta: slot encoded without reference */
+  long int last;            /* delta: slot of the last insert        */
+
+  sunrealtype* x;    /* packed vector buffer                      */
+  sunrealtype* w;    /* packed weight vector buffer               */
+  sunrealtype* prev; /* delta: decoded values of the last insert  */
+
+  /* statistics */
+  size_t raw_bytes;    /* uncompressed size of the occupied slots */
+  size_t stored_bytes; /* encoded size of the occupied slots      */
+  long int ndecode;    /* number of loads                         */
+  double decode_time;  /* total time spent in loads (s)           */
+};
+
+/* Create a store with nslots slots for vectors like tmpl */
+SUNDIALS_EXPORT
+SUNErrCode SUNCompressStore_Create(SUNDataCompression type, long int nslots,
+                                   N_Vector tmpl, SUNCompressStore* store_ptr);
+
+/* Encode v into slot i with the error bound tol / w (see
+   SUNCompress_Encode, w may be NULL) */
+SUNDIALS_EXPORT
+SUNErrCode SUNCompressStore_Insert(SUNCompressStore store, long int i,
+                                   N_Vector v, N_Vector w, sunrealtype tol);
+
+/* Decode slot i into v */
+SUNDIALS_EXPORT
+SUNErrCode SUNCompressStore_Load(SUNCompressStore store, long int i,
+                                 N_Vector v);
+
+/* Free the memory allocated by SUNCompressStore_Create */
+SUNDIALS_EXPORT
+SUNErrCode SUNCompressStore_Destroy(SUNCompressStore* store_ptr);
+
+/* Check if the vector v provides the buffer operations used by a store */
+SUNDIALS_EXPORT
+sunbooleantype SUNCompress_VectorSupported(N_Vector v);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -36,6 +36,7 @@
 #include <sundials/sundials_core.h>
 
 #include "sundatanode/sundatanode_inmem.h"
+#include "sundatanode/sundatanode_mmap.h"
 #include "sundials/sundials_errors.h"
 #include "sundials/sundials_memory.h"
 #include "sundials_datanode.h"
@@ -98,6 +99,10 @@ SUNErrCode SUNDataNode_CreateLeaf(SUNDataIOMode io_mode,
   case (SUNDATAIOMODE_INMEM):
     err = SUNDataNode_CreateLeaf_InMem(mem_helper, sunctx, node_out);
     break;
+  case (SUNDATAIOMODE_MMAP):
+    /* without an arena the payload stays resident */
+    err = SUNDataNode_CreateLeaf_Mmap(NULL, mem_helper, sunctx, node_out);
+    break;
   default: err = SUN_ERR_ARG_OUTOFRANGE;
   }
 
@@ -127,6 +132,7 @@ SUNErrCode SUNDataNode_CreateList(SUNDataIOMode io_mode,
   switch (io_mode)
   {
   case (SUNDATAIOMODE_INMEM):
+  case (SUNDATAIOMODE_MMAP):
     err = SUNDataNode_CreateList_InMem(num_elements, sunctx, node_out);
     break;
   default: err = SUN_ERR_ARG_OUTOFRANGE;
@@ -158,6 +164,7 @@ SUNErrCode SUNDataNode_CreateObject(SUNDataIOMode io_mode,
   switch (io_mode)
   {
   case (SUNDATAIOMODE_INMEM):
+  case (SUNDATAIOMODE_MMAP):
     err = SUNDataNode_CreateObject_InMem(num_elements, sunctx, node_out);
     break;
   default: err = SUN_ERR_ARG_OUTOFRANGE;
@@ -82,15 +82,38 @@ void SUNDlsMat_DenseMatvec(SUNDlsMat A, sunrealtype* x, sunrealtype* y)
   SUNDlsMat_denseMatvec(A->cols, x, y, A->M, A->N);
 }
 
-sunindextype SUNDlsMat_denseGETRF(sunrealtype** a, sunindextype m,
-                                  sunindextype n, sunindextype* p)
+/*
+ * LU factorization with partial pivoting. Matrices with at least
+ * DENSE_BLOCK_MIN_N columns are factored in panels of DENSE_BLOCK_SIZE
+ * columns (right-looking blocked LU): each panel is factored with the
+ * unblocked algorithm, its row interchanges are applied to the remaining
+ * columns, and the trailing submatrix is updated with the panel at once.
+ * The trailing update works on blocks of DENSE_ROW_BLOCK rows so the panel
+ * multipliers stay in cache while they are applied to every trailing column,
+ * and, when OpenMP is enabled and more than one thread is requested with
+ * SUNDlsMat_denseGETRF_Threaded, it is threaded if it requires at least
+ * DENSE_OMP_MIN_WORK multiply-adds. Smaller matrices are factored in a single
+ * panel, i.e., with the unblocked algorithm.
+ */
+
+#define DENSE_BLOCK_SIZE   32
+#define DENSE_BLOCK_MIN_N  64
+#define DENSE_ROW_BLOCK    256
+#define DENSE_OMP_MIN_WORK SUN_RCONST(1.0e6)
+
+/* Factor the m-k0 by kb panel starting at a(k0,k0), interchanging rows only
+ * within the panel columns */
+static sunindextype denseGETRF_Panel(sunrealtype** a, sunindextype m,
+                                     sunindextype k0, sunindextype kb,
+                                     sunindextype* p)
 {
   sunindextype i, j, k, l;
   sunrealtype *col_j, *col_k;
   sunrealtype temp, mult, a_kj;
+  const sunindextype kend = k0 + kb;
 
   /* k-th elimination step number */
-  for (k = 0; k < n; k++)
+  for (k = k0; k < kend; k++)
   {
     col_k = a[k];
 
@@ -105,14 +128,14 @@ sunindextype SUNDlsMat_denseGETRF(sunrealtype** a, sunindextype m,
     /* check for zero pivot element */
     if (col_k[l] == ZERO) { return (k + 1); }
 
-    /* swap a(k,1:n) and a(l,1:n) if necessary */
+    /* swap a(k,k0:kend-1) and a(l,k0:kend-1) if necessary */
     if (l != k)
     {
-      for (i = 0; i < n; i++)
+      for (j = k0; j < kend; j++)
       {
-        temp    = a[i][l];
-        a[i][l] = a[i][k];
-        a[i][k] = temp;
+        temp    = a[j][l];
+        a[j][l] = a[j][k];
+        a[j][k] = temp;
       }
     }
 
@@ -128,9 +151,9 @@ sunindextype SUNDlsMat_denseGETRF(sunrealtype** a, sunindextype m,
     /* row_i = row_i - [a(i,k)/a(k,k)] row_k, i=k+1, ..., m-1 */
     /* row k is the pivot row after swapping with row l.      */
     /* The computation is done one column at a time,          */
-    /* column j=k+1, ..., n-1.                                */
+    /* column j=k+1, ..., kend-1.                             */
 
-    for (j = k + 1; j < n; j++)
+    for (j = k + 1; j < kend; j++)
     {
       col_j = a[j];
       a_kj  = col_j[k];
@@ -145,6 +168,147 @@ sunindextype SUNDlsMat_denseGETRF(sunrealtype** a, sunindextype m,
     }
   }
 
+  return (0);
+}
+
+/* Apply the panel row interchanges to column col_j and, for a trailing column,
+ * overwrite a(k0:kend-1,j) with U12 = L11^{-1} a(k0:kend-1,j) */
+static void denseGETRF_PanelColumn(sunrealtype** a, sunrealtype* col_j,
+                                   sunindextype k0, sunindextype kend,
+                                   const sunindextype* p, sunbooleantype solve)
+{
+  sunindextype i, k;
+  sunrealtype *col_k, temp, a_kj;
+
+  for (k = k0; k < kend; k++)
+  {
+    if (p[k] != k)
+    {
+      temp        = col_j[p[k]];
+      col_j[p[k]] = col_j[k];
+      col_j[k]    = temp;
+    }
+  }
+
+  if (!solve) { return; }
+
+  for (k = k0; k < kend - 1; k++)
+  {
+    col_k = a[k];
+    a_kj  = col_j[k];
+    if (a_kj != ZERO)
+    {
+      for (i = k + 1; i < kend; i++) { col_j[i] -= a_kj * col_k[i]; }
+    }
+  }
+}
+
+/* Update rows i0:i1-1 of the trailing columns, A22 = A22 - L21 U12, applying
+ * four panel columns per pass over each trailing column */
+static void denseGETRF_UpdateRows(sunrealtype** a, sunindextype n,
+                                  sunindextype k0, sunindextype kend,
+                                  sunindextype i0, sunindextype i1)
+{
+  sunindextype i, j, k;
+  sunrealtype* col_j;
+  const sunrealtype *l0, *l1, *l2, *l3;
+  sunrealtype u0, u1, u2, u3;
+
+  for (j = kend; j < n; j++)
+  {
+    col_j = a[j];
+
+    for (k = k0; k + 3 < kend; k += 4)
+    {
+      l0 = a[k];
+      l1 = a[k + 1];
+      l2 = a[k + 2];
+      l3 = a[k + 3];
+      u0 = col_j[k];
+      u1 = col_j[k + 1];
+      u2 = col_j[k + 2];
+      u3 = col_j[k + 3];
+      for (i = i0; i < i1; i++)
+      {
+        col_j[i] -= u0 * l0[i] + u1 * l1[i] + u2 * l2[i] + u3 * l3[i];
+      }
+    }
+
+    for (; k < kend; k++)
+    {
+      l0 = a[k];
+      u0 = col_j[k];
+      for (i = i0; i < i1; i++) { col_j[i] -= u0 * l0[i]; }
+    }
+  }
+}
+
+/* Apply the row interchanges and elimination of the panel a(k0:m-1,k0:kend-1)
+ * to the remaining columns */
+static void denseGETRF_UpdateBlock(sunrealtype** a, sunindextype m,
+                                   sunindextype n, sunindextype k0,
+                                   sunindextype kend, const sunindextype* p,
+                                   int nthreads)
+{
+  sunindextype j, ib;
+  const sunindextype nrb = (m - kend + DENSE_ROW_BLOCK - 1) / DENSE_ROW_BLOCK;
+
+#if defined(SUNDIALS_OPENMP_ENABLED)
+  const sunbooleantype threaded = nthreads > 1 && (sunrealtype)(m - kend) *
+                                      (sunrealtype)(n - kend) *
+                                      (sunrealtype)(kend - k0) >=
+                                    DENSE_OMP_MIN_WORK;
+#pragma omp parallel if (threaded) num_threads(nthreads) private(j, ib)
+#else
+  (void)nthreads;
+#endif
+  {
+#if defined(SUNDIALS_OPENMP_ENABLED)
+#pragma omp for schedule(static)
+#endif
+    for (j = 0; j < n; j++)
+    {
+      if (j >= k0 && j < kend) { continue; }
+      denseGETRF_PanelColumn(a, a[j], k0, kend, p, j >= kend);
+    }
+
+#if defined(SUNDIALS_OPENMP_ENABLED)
+#pragma omp for schedule(static)
+#endif
+    for (ib = 0; ib < nrb; ib++)
+    {
+      const sunindextype i0 = kend + ib * DENSE_ROW_BLOCK;
+      const sunindextype i1 = SUNMIN(i0 + DENSE_ROW_BLOCK, m);
+      denseGETRF_UpdateRows(a, n, k0, kend, i0, i1);
+    }
+  }
+}
+
+sunindextype SUNDlsMat_denseGETRF(sunrealtype** a, sunindextype m,
+                                  sunindextype n, sunindextype* p)
+{
+  return (SUNDlsMat_denseGETRF_Threaded(a, m, n, p, 1));
+}
+
+sunindextype SUNDlsMat_denseGETRF_Threaded(sunrealtype** a, sunindextype m,
+                                           sunindextype n, sunindextype* p,
+                                           int nthreads)
+{
+  sunindextype k0, kb, retval;
+  const sunindextype nb = (n < DENSE_BLOCK_MIN_N) ? n : DENSE_BLOCK_SIZE;
+
+  for (k0 = 0; k0 < n; k0 += nb)
+  {
+    kb = SUNMIN(nb, n - k0);
+
+    /* factor the panel, returning the column of a zero pivot */
+    retval = denseGETRF_Panel(a, m, k0, kb, p);
+    if (retval) { return (retval); }
+
+    /* apply the panel to the left and trailing columns */
+    if (kb < n) { denseGETRF_UpdateBlock(a, m, n, k0, k0 + kb, p, nthreads); }
+  }
+
   /* return 0 to indicate success */
 
   return (0);
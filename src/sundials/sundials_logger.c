@@ -15,7 +15,9 @@
  * SUNDIALS Copyright End
  * -----------------------------------------------------------------*/
 
+#include <ctype.h>
 #include <stdarg.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -92,6 +94,428 @@ static FILE* sunOpenLogFile(const char* fname, const char* mode)
 }
 #endif
 
+#if SUNDIALS_LOGGING_LEVEL >= SUNDIALS_LOGGING_INFO
+
+/* -----------------------------------------------------------------
+ * Binary output
+ *
+ * Info and debug messages can be written as binary records rather than
+ * formatted text. A binary log file begins with the 8 character magic string
+ * SUN_BINARY_LOG_MAGIC_ followed by the 32-bit value SUN_BINARY_LOG_BYTE_ORDER_
+ * (to detect the byte order) and then a sequence of records in native byte
+ * order. Each record begins with a 1 byte record type:
+ *
+ *   string record:  id (u32), length (u32), characters (no terminating null)
+ *   message record: level (u8), rank (i32), scope id (u32), label id (u32),
+ *                   format id (u32), time (f64), arguments
+ *
+ * The string record for an id always precedes the first message using it. The
+ * message arguments are stored in the order they are consumed by the format
+ * string: integers and pointers as 64-bit values, floating point values as
+ * doubles, and strings as a length (u32) followed by the characters. The time
+ * is in seconds since the binary output was enabled.
+ *
+ * Records are accumulated in a buffer that is written to the file when it is
+ * full, when the logger is flushed, or when it is destroyed.
+ * ----------------------------------------------------------------*/
+
+/* default size of the buffer for binary records (1 MiB) */
+#define SUN_DEFAULT_BINARY_BUFFER_SIZE_ 1048576
+
+/* initial number of interned strings for binary output */
+#define SUN_DEFAULT_BINARY_STRINGS_ 256
+
+/* binary log file header and record types */
+#define SUN_BINARY_LOG_MAGIC_        "SUNLOGB1"
+#define SUN_BINARY_LOG_BYTE_ORDER_   0x01020304
+#define SUN_BINARY_LOG_STRING_RECORD 1
+#define SUN_BINARY_LOG_MSG_RECORD    2
+
+static SUNErrCode sunLoggerBinaryDrain(SUNLogger logger)
+{
+  size_t used = logger->binary_buffer_used;
+
+  logger->binary_buffer_used = 0;
+  if (used && fwrite(logger->binary_buffer, 1, used, logger->binary_fp) != used)
+  {
+    return SUN_ERR_OP_FAIL;
+  }
+
+  return SUN_SUCCESS;
+}
+
+static SUNErrCode sunLoggerBinaryWrite(SUNLogger logger, const void* data,
+                                       size_t n)
+{
+  if (logger->binary_buffer_used + n > logger->binary_buffer_size)
+  {
+    SUNErrCode err = sunLoggerBinaryDrain(logger);
+    if (err) { return err; }
+
+    /* Write records larger than the buffer directly */
+    if (n > logger->binary_buffer_size)
+    {
+      if (fwrite(data, 1, n, logger->binary_fp) != n) { return SUN_ERR_OP_FAIL; }
+      return SUN_SUCCESS;
+    }
+  }
+
+  memcpy(logger->binary_buffer + logger->binary_buffer_used, data, n);
+  logger->binary_buffer_used += n;
+
+  return SUN_SUCCESS;
+}
+
+/*
+  Parse a printf format string and determine the type of each argument it
+  consumes (including * widths and precisions). The kinds are
+
+    i (int), l (long), q (long long), j (intmax_t), t (ptrdiff_t),
+    u (unsigned int), m (unsigned long), Q (unsigned long long),
+    J (uintmax_t), z (size_t), d (double), D (long double), s (string),
+    p (pointer)
+ */
+static SUNErrCode sunLoggerParseFormat(const char* fmt, char** kinds_out,
+                                       int* nargs_out)
+{
+  int nargs   = 0;
+  char* kinds = (char*)malloc(strlen(fmt) + 1);
+  if (!kinds) { return SUN_ERR_MALLOC_FAIL; }
+
+  for (const char* c = fmt; *c; c++)
+  {
+    char length = 0;
+
+    if (*c != '%') { continue; }
+    c++;
+    if (*c == '%') { continue; }
+
+    /* flags */
+    while (*c && strchr("-+ #0'", *c)) { c++; }
+
+    /* width */
+    if (*c == '*')
+    {
+      kinds[nargs++] = 'i';
+      c++;
+    }
+    else
+    {
+      while (isdigit((unsigned char)*c)) { c++; }
+    }
+
+    /* precision */
+    if (*c == '.')
+    {
+      c++;
+      if (*c == '*')
+      {
+        kinds[nargs++] = 'i';
+        c++;
+      }
+      else
+      {
+        while (isdigit((unsigned char)*c)) { c++; }
+      }
+    }
+
+    /* length modifier */
+    switch (*c)
+    {
+    case 'h':
+      length = 'h';
+      c++;
+      if (*c == 'h') { c++; }
+      break;
+    case 'l':
+      length = 'l';
+      c++;
+      if (*c == 'l')
+      {
+        length = 'q';
+        c++;
+      }
+      break;
+    case 'j':
+    case 'z':
+    case 't':
+    case 'L':
+      length = *c;
+      c++;
+      break;
+    default: break;
+    }
+
+    /* conversion */
+    switch (*c)
+    {
+    case 'd':
+    case 'i':
+      if (length == 'l' || length == 'q' || length == 'j' || length == 'z' ||
+          length == 't')
+      {
+        kinds[nargs++] = length;
+      }
+      else { kinds[nargs++] = 'i'; }
+      break;
+    case 'o':
+    case 'u':
+    case 'x':
+    case 'X':
+      if (length == 'l') { kinds[nargs++] = 'm'; }
+      else if (length == 'q') { kinds[nargs++] = 'Q'; }
+      else if (length == 'j') { kinds[nargs++] = 'J'; }
+      else if (length == 'z' || length == 't') { kinds[nargs++] = length; }
+      else { kinds[nargs++] = 'u'; }
+      break;
+    case 'c': kinds[nargs++] = 'i'; break;
+    case 'a':
+    case 'A':
+    case 'e':
+    case 'E':
+    case 'f':
+    case 'F':
+    case 'g':
+    case 'G': kinds[nargs++] = (length == 'L') ? 'D' : 'd'; break;
+    case 's': kinds[nargs++] = 's'; break;
+    case 'p':
+    case 'n': kinds[nargs++] = 'p'; break;
+    case '\0': c--; break;
+    default: break;
+    }
+  }
+
+  *kinds_out = kinds;
+  *nargs_out = nargs;
+
+  return SUN_SUCCESS;
+}
+
+static size_t sunLoggerHashAddress(const char* addr, int table_size)
+{
+  return ((size_t)((uintptr_t)addr >> 3) * 2654435761u) &
+         (size_t)(table_size - 1);
+}
+
+static SUNErrCode sunLoggerRebuildStringTable(SUNLogger logger, int table_size)
+{
+  int* table = (int*)malloc(table_size * sizeof(int));
+  if (!table) { return SUN_ERR_MALLOC_FAIL; }
+  for (int i = 0; i < table_size; i++) { table[i] = -1; }
+
+  /* Later strings with the same address replace earlier ones */
+  for (int id = 0; id < logger->num_strings; id++)
+  {
+    const char* addr = logger->strings[id].addr;
+    size_t i         = sunLoggerHashAddress(addr, table_size);
+    while (table[i] >= 0 && logger->strings[table[i]].addr != addr)
+    {
+      i = (i + 1) & (size_t)(table_size - 1);
+    }
+    table[i] = id;
+  }
+
+  free(logger->string_table);
+  logger->string_table      = table;
+  logger->string_table_size = table_size;
+
+  return SUN_SUCCESS;
+}
+
+/* Get the id of a string, adding it to the binary output if necessary */
+static SUNErrCode sunLoggerInternString(SUNLogger logger, const char* str,
+                                        int* id)
+{
+  SUNErrCode err;
+  sunLogString* entry;
+  unsigned char header[9];
+  uint32_t id32, len32;
+  size_t i = sunLoggerHashAddress(str, logger->string_table_size);
+
+  while (logger->string_table[i] >= 0)
+  {
+    entry = &logger->strings[logger->string_table[i]];
+    if (entry->addr == str)
+    {
+      if (!strcmp(entry->str, str))
+      {
+        *id = logger->string_table[i];
+        return SUN_SUCCESS;
+      }
+      break; /* the address was reused for a different string */
+    }
+    i = (i + 1) & (size_t)(logger->string_table_size - 1);
+  }
+
+  if (logger->num_strings == logger->strings_capacity)
+  {
+    int new_capacity = 2 * logger->strings_capacity;
+    sunLogString* new_strings =
+      (sunLogString*)realloc(logger->strings,
+                             new_capacity * sizeof(sunLogString));
+    if (!new_strings) { return SUN_ERR_MALLOC_FAIL; }
+    logger->strings          = new_strings;
+    logger->strings_capacity = new_capacity;
+  }
+
+  entry        = &logger->strings[logger->num_strings];
+  entry->addr  = str;
+  entry->kinds = NULL;
+  entry->nargs = 0;
+  entry->str   = (char*)malloc(strlen(str) + 1);
+  if (!entry->str) { return SUN_ERR_MALLOC_FAIL; }
+  strcpy(entry->str, str);
+
+  *id                      = logger->num_strings++;
+  logger->string_table[i] = *id;
+
+  if (2 * logger->num_strings > logger->string_table_size)
+  {
+    err = sunLoggerRebuildStringTable(logger, 2 * logger->string_table_size);
+    if (err) { return err; }
+  }
+
+  /* Write the string record */
+  id32      = (uint32_t)*id;
+  len32     = (uint32_t)strlen(str);
+  header[0] = SUN_BINARY_LOG_STRING_RECORD;
+  memcpy(header + 1, &id32, sizeof(uint32_t));
+  memcpy(header + 5, &len32, sizeof(uint32_t));
+
+  err = sunLoggerBinaryWrite(logger, header, sizeof(header));
+  if (err) { return err; }
+  return sunLoggerBinaryWrite(logger, str, len32);
+}
+
+static SUNErrCode sunLoggerQueueBinaryMsg(SUNLogger logger, SUNLogLevel lvl,
+                                          int rank, const char* scope,
+                                          const char* label,
+                                          const char* msg_txt, va_list args)
+{
+  SUNErrCode err;
+  int scope_id, label_id, fmt_id;
+  sunLogString* fmt;
+  unsigned char record[26];
+  uint32_t id32;
+  int32_t rank32;
+  double time;
+
+  err = sunLoggerInternString(logger, scope, &scope_id);
+  if (err) { return err; }
+  err = sunLoggerInternString(logger, label, &label_id);
+  if (err) { return err; }
+  err = sunLoggerInternString(logger, msg_txt, &fmt_id);
+  if (err) { return err; }
+
+  fmt = &logger->strings[fmt_id];
+  if (!fmt->kinds)
+  {
+    err = sunLoggerParseFormat(fmt->str, &fmt->kinds, &fmt->nargs);
+    if (err) { return err; }
+  }
+
+  /* Write the message record */
+  rank32    = (int32_t)rank;
+  time      = sunWallTime() - logger->binary_epoch;
+  record[0] = SUN_BINARY_LOG_MSG_RECORD;
+  record[1] = (unsigned char)lvl;
+  memcpy(record + 2, &rank32, sizeof(int32_t));
+  id32 = (uint32_t)scope_id;
+  memcpy(record + 6, &id32, sizeof(uint32_t));
+  id32 = (uint32_t)label_id;
+  memcpy(record + 10, &id32, sizeof(uint32_t));
+  id32 = (uint32_t)fmt_id;
+  memcpy(record + 14, &id32, sizeof(uint32_t));
+  memcpy(record + 18, &time, sizeof(double));
+
+  err = sunLoggerBinaryWrite(logger, record, sizeof(record));
+  if (err) { return err; }
+
+  for (int i = 0; i < fmt->nargs; i++)
+  {
+    int64_t ival  = 0;
+    uint64_t uval = 0;
+    double dval   = 0.0;
+    const char* sval;
+    uint32_t len32;
+
+    switch (fmt->kinds[i])
+    {
+    case 'i': ival = (int64_t)va_arg(args, int); break;
+    case 'l': ival = (int64_t)va_arg(args, long); break;
+    case 'q': ival = (int64_t)va_arg(args, long long); break;
+    case 'j': ival = (int64_t)va_arg(args, intmax_t); break;
+    case 't': ival = (int64_t)va_arg(args, ptrdiff_t); break;
+    case 'u': uval = (uint64_t)va_arg(args, unsigned int); break;
+    case 'm': uval = (uint64_t)va_arg(args, unsigned long); break;
+    case 'Q': uval = (uint64_t)va_arg(args, unsigned long long); break;
+    case 'J': uval = (uint64_t)va_arg(args, uintmax_t); break;
+    case 'z': uval = (uint64_t)va_arg(args, size_t); break;
+    case 'p': uval = (uint64_t)(uintptr_t)va_arg(args, void*); break;
+    case 'd': dval = va_arg(args, double); break;
+    case 'D': dval = (double)va_arg(args, long double); break;
+    case 's':
+      sval = va_arg(args, const char*);
+      if (!sval) { sval = "(null)"; }
+      len32 = (uint32_t)strlen(sval);
+      err   = sunLoggerBinaryWrite(logger, &len32, sizeof(uint32_t));
+      if (!err) { err = sunLoggerBinaryWrite(logger, sval, len32); }
+      if (err) { return err; }
+      continue;
+    default: return SUN_ERR_UNREACHABLE;
+    }
+
+    switch (fmt->kinds[i])
+    {
+    case 'd':
+    case 'D': err = sunLoggerBinaryWrite(logger, &dval, sizeof(double)); break;
+    case 'i':
+    case 'l':
+    case 'q':
+    case 'j':
+    case 't': err = sunLoggerBinaryWrite(logger, &ival, sizeof(int64_t)); break;
+    default: err = sunLoggerBinaryWrite(logger, &uval, sizeof(uint64_t)); break;
+    }
+    if (err) { return err; }
+  }
+
+  return SUN_SUCCESS;
+}
+
+static SUNErrCode sunLoggerCloseBinary(SUNLogger logger)
+{
+  SUNErrCode err = SUN_SUCCESS;
+
+  if (logger->binary_fp)
+  {
+    err = sunLoggerBinaryDrain(logger);
+    fclose(logger->binary_fp);
+    logger->binary_fp = NULL;
+  }
+
+  for (int id = 0; id < logger->num_strings; id++)
+  {
+    free(logger->strings[id].str);
+    free(logger->strings[id].kinds);
+  }
+  free(logger->strings);
+  free(logger->string_table);
+  free(logger->binary_buffer);
+
+  logger->strings            = NULL;
+  logger->num_strings        = 0;
+  logger->strings_capacity   = 0;
+  logger->string_table       = NULL;
+  logger->string_table_size  = 0;
+  logger->binary_buffer      = NULL;
+  logger->binary_buffer_size = 0;
+  logger->binary_buffer_used = 0;
+
+  return err;
+}
+
+#endif
+
 static void sunCloseLogFile(void* fp)
 {
   if (fp && fp != stdout && fp != stderr) { fclose((FILE*)fp); }
@@ -171,6 +595,19 @@ SUNErrCode SUNLogger_Create(SUNComm comm, int output_rank, SUNLogger* logger_ptr
   logger->warning_fp = stdout;
   logger->debug_fp   = NULL;
   logger->info_fp    = NULL;
+
+  /* binary output is disabled by default */
+  logger->binary_fp          = NULL;
+  logger->binary_buffer      = NULL;
+  logger->binary_buffer_size = 0;
+  logger->binary_buffer_used = 0;
+  logger->binary_epoch       = 0.0;
+  logger->strings            = NULL;
+  logger->num_strings        = 0;
+  logger->strings_capacity   = 0;
+  logger->string_table       = NULL;
+  logger->string_table_size  = 0;
+
   if (sunLoggerIsOutputRank(logger, NULL))
   {
     /* We store the FILE* in a hash map so that we can ensure
@@ -194,6 +631,7 @@ SUNErrCode SUNLogger_CreateFromEnv(SUNComm comm, SUNLogger* logger_out)
   const char* warning_fname_env = getenv("SUNLOGGER_WARNING_FILENAME");
   const char* info_fname_env    = getenv("SUNLOGGER_INFO_FILENAME");
   const char* debug_fname_env   = getenv("SUNLOGGER_DEBUG_FILENAME");
+  const char* binary_fname_env  = getenv("SUNLOGGER_BINARY_FILENAME");
 
   if (SUNLogger_Create(comm, output_rank, &logger))
   {
@@ -209,6 +647,8 @@ SUNErrCode SUNLogger_CreateFromEnv(SUNComm comm, SUNLogger* logger_out)
     err = SUNLogger_SetDebugFilename(logger, debug_fname_env);
     if (err) { break; }
     err = SUNLogger_SetInfoFilename(logger, info_fname_env);
+    if (err) { break; }
+    err = SUNLogger_SetBinaryFilename(logger, binary_fname_env);
   }
   while (0);
 
@@ -339,6 +779,67 @@ SUNErrCode SUNLogger_SetDebugFilename(SUNLogger logger, const char* debug_filena
   return SUN_SUCCESS;
 }
 
+SUNErrCode SUNLogger_SetBinaryFilename(
+  SUNLogger logger, SUNDIALS_MAYBE_UNUSED const char* binary_filename)
+{
+  if (!logger) { return SUN_ERR_ARG_CORRUPT; }
+
+  if (!sunLoggerIsOutputRank(logger, NULL)) { return SUN_SUCCESS; }
+
+#if SUNDIALS_LOGGING_LEVEL >= SUNDIALS_LOGGING_INFO
+  {
+    SUNErrCode err;
+    uint32_t byte_order = SUN_BINARY_LOG_BYTE_ORDER_;
+
+    /* Write out and close any existing binary output */
+    err = sunLoggerCloseBinary(logger);
+    if (err) { return err; }
+
+    if (!binary_filename || !strcmp(binary_filename, ""))
+    {
+      return SUN_SUCCESS;
+    }
+
+    logger->binary_fp = fopen(binary_filename, "wb");
+    if (!logger->binary_fp) { return SUN_ERR_FILE_OPEN; }
+
+    logger->binary_buffer = (char*)malloc(SUN_DEFAULT_BINARY_BUFFER_SIZE_);
+    logger->strings       = (sunLogString*)malloc(SUN_DEFAULT_BINARY_STRINGS_ *
+                                                  sizeof(sunLogString));
+    if (!logger->binary_buffer || !logger->strings)
+    {
+      sunLoggerCloseBinary(logger);
+      return SUN_ERR_MALLOC_FAIL;
+    }
+    logger->binary_buffer_size = SUN_DEFAULT_BINARY_BUFFER_SIZE_;
+    logger->strings_capacity   = SUN_DEFAULT_BINARY_STRINGS_;
+
+    err = sunLoggerRebuildStringTable(logger, 2 * SUN_DEFAULT_BINARY_STRINGS_);
+    if (err)
+    {
+      sunLoggerCloseBinary(logger);
+      return err;
+    }
+
+    err = sunLoggerBinaryWrite(logger, SUN_BINARY_LOG_MAGIC_,
+                               strlen(SUN_BINARY_LOG_MAGIC_));
+    if (!err)
+    {
+      err = sunLoggerBinaryWrite(logger, &byte_order, sizeof(uint32_t));
+    }
+    if (err)
+    {
+      sunLoggerCloseBinary(logger);
+      return err;
+    }
+
+    logger->binary_epoch = sunWallTime();
+  }
+#endif
+
+  return SUN_SUCCESS;
+}
+
 SUNErrCode SUNLogger_QueueMsg(SUNLogger logger, SUNLogLevel lvl,
                               const char* scope, const char* label,
                               const char* msg_txt, ...)
@@ -363,8 +864,20 @@ SUNErrCode SUNLogger_QueueMsg(SUNLogger logger, SUNLogLevel lvl,
     else
     {
       /* Default implementation */
-      int rank = 0;
-      if (sunLoggerIsOutputRank(logger, &rank))
+      int rank                     = 0;
+      sunbooleantype is_output_rank = sunLoggerIsOutputRank(logger, &rank);
+      if (is_output_rank && logger->binary_fp &&
+          (lvl == SUN_LOGLEVEL_INFO || lvl == SUN_LOGLEVEL_DEBUG))
+      {
+#if SUNDIALS_LOGGING_LEVEL >= SUNDIALS_LOGGING_INFO
+        va_list args;
+        va_start(args, msg_txt);
+        retval = sunLoggerQueueBinaryMsg(logger, lvl, rank, scope, label,
+                                         msg_txt, args);
+        va_end(args);
+#endif
+      }
+      else if (is_output_rank)
       {
         char* log_msg = NULL;
         va_list args;
@@ -425,6 +938,15 @@ SUNErrCode SUNLogger_Flush(SUNLogger logger, SUNLogLevel lvl)
     /* Default implementation */
     if (sunLoggerIsOutputRank(logger, NULL))
     {
+#if SUNDIALS_LOGGING_LEVEL >= SUNDIALS_LOGGING_INFO
+      if (logger->binary_fp &&
+          (lvl == SUN_LOGLEVEL_INFO || lvl == SUN_LOGLEVEL_DEBUG ||
+           lvl == SUN_LOGLEVEL_ALL))
+      {
+        retval = sunLoggerBinaryDrain(logger);
+        fflush(logger->binary_fp);
+      }
+#endif
       switch (lvl)
       {
       case (SUN_LOGLEVEL_DEBUG):
@@ -481,6 +1003,9 @@ SUNErrCode SUNLogger_Destroy(SUNLogger* logger_ptr)
     if (sunLoggerIsOutputRank(logger, NULL))
     {
       SUNHashMap_Destroy(&logger->filenames);
+#if SUNDIALS_LOGGING_LEVEL >= SUNDIALS_LOGGING_INFO
+      retval = sunLoggerCloseBinary(logger);
+#endif
     }
 
 #if SUNDIALS_MPI_ENABLED
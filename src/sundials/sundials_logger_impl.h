@@ -138,6 +138,21 @@
 #define SUNLogExtraDebugVecArray(logger, label, nvecs, vecs, msg_txt)
 #endif
 
+/*
+  An interned scope, label, or format string for binary output. Strings are
+  looked up by address and the contents are compared to catch reused buffers.
+  For format strings, kinds holds one character per argument consumed by the
+  format (see sunLoggerParseFormat) or is NULL if the format was not parsed.
+ */
+
+typedef struct sunLogString_
+{
+  const char* addr;
+  char* str;
+  char* kinds;
+  int nargs;
+} sunLogString;
+
 struct SUNLogger_
 {
   /* MPI information */
@@ -153,6 +168,18 @@ struct SUNLogger_
   /* Hashmap used to store filename, FILE* pairs */
   SUNHashMap filenames;
 
+  /* Binary output of info and debug messages */
+  FILE* binary_fp;
+  char* binary_buffer;
+  size_t binary_buffer_size;
+  size_t binary_buffer_used;
+  double binary_epoch;
+  sunLogString* strings; /* interned strings, the index is the string id */
+  int num_strings;
+  int strings_capacity;
+  int* string_table; /* open addressing table of string ids keyed by address */
+  int string_table_size;
+
   /* Slic-style format string */
   const char* format;
 
@@ -140,8 +140,10 @@ N_Vector N_VNewEmpty(SUNContext sunctx)
   ops->nvwsqrsummasklocal = NULL;
 
   /* single buffer reduction operations */
-  ops->nvdotprodmultilocal     = NULL;
-  ops->nvdotprodmultiallreduce = NULL;
+  ops->nvdotprodmultilocal          = NULL;
+  ops->nvdotprodmultiallreduce      = NULL;
+  ops->nvdotprodmultiallreducebegin = NULL;
+  ops->nvdotprodmultiallreduceend   = NULL;
 
   /* XBraid interface operations */
   ops->nvbufsize   = NULL;
@@ -262,8 +264,10 @@ SUNErrCode N_VCopyOps(N_Vector w, N_Vector v)
   v->ops->nvwsqrsummasklocal = w->ops->nvwsqrsummasklocal;
 
   /* single buffer reduction operations */
-  v->ops->nvdotprodmultilocal     = w->ops->nvdotprodmultilocal;
-  v->ops->nvdotprodmultiallreduce = w->ops->nvdotprodmultiallreduce;
+  v->ops->nvdotprodmultilocal          = w->ops->nvdotprodmultilocal;
+  v->ops->nvdotprodmultiallreduce      = w->ops->nvdotprodmultiallreduce;
+  v->ops->nvdotprodmultiallreducebegin = w->ops->nvdotprodmultiallreducebegin;
+  v->ops->nvdotprodmultiallreduceend   = w->ops->nvdotprodmultiallreduceend;
 
   /* XBraid interface operations */
   v->ops->nvbufsize   = w->ops->nvbufsize;
@@ -701,6 +705,21 @@ SUNErrCode N_VWrmsNormVectorArray(int nvec, N_Vector* X, N_Vector* W,
   {
     ier = X[0]->ops->nvwrmsnormvectorarray(nvec, X, W, nrm);
   }
+  else if (nvec > 1 && X[0]->ops->nvwsqrsumlocal != NULL &&
+           X[0]->ops->nvdotprodmultiallreduce != NULL &&
+           X[0]->ops->nvgetlength != NULL)
+  {
+    /* combine the global reductions into a single buffer reduction */
+    for (i = 0; i < nvec; i++)
+    {
+      nrm[i] = X[0]->ops->nvwsqrsumlocal(X[i], W[i]);
+    }
+    ier = X[0]->ops->nvdotprodmultiallreduce(nvec, X[0], nrm);
+    for (i = 0; i < nvec; i++)
+    {
+      nrm[i] = SUNRsqrt(nrm[i] / X[0]->ops->nvgetlength(X[i]));
+    }
+  }
   else
   {
     for (i = 0; i < nvec; i++) { nrm[i] = X[0]->ops->nvwrmsnorm(X[i], W[i]); }
@@ -723,6 +742,21 @@ SUNErrCode N_VWrmsNormMaskVectorArray(int nvec, N_Vector* X, N_Vector* W,
   {
     ier = id->ops->nvwrmsnormmaskvectorarray(nvec, X, W, id, nrm);
   }
+  else if (nvec > 1 && id->ops->nvwsqrsummasklocal != NULL &&
+           id->ops->nvdotprodmultiallreduce != NULL &&
+           id->ops->nvgetlength != NULL)
+  {
+    /* combine the global reductions into a single buffer reduction */
+    for (i = 0; i < nvec; i++)
+    {
+      nrm[i] = id->ops->nvwsqrsummasklocal(X[i], W[i], id);
+    }
+    ier = id->ops->nvdotprodmultiallreduce(nvec, id, nrm);
+    for (i = 0; i < nvec; i++)
+    {
+      nrm[i] = SUNRsqrt(nrm[i] / id->ops->nvgetlength(X[i]));
+    }
+  }
   else
   {
     for (i = 0; i < nvec; i++)
@@ -960,6 +994,40 @@ SUNErrCode N_VDotProdMultiAllReduce(int nvec, N_Vector x, sunrealtype* sum)
   return ier;
 }
 
+/* Starts a reduction of sum across all processes. If the vector does not
+   provide split-phase reductions this performs a blocking reduction and the
+   matching N_VDotProdMultiAllReduceEnd call does nothing. */
+SUNErrCode N_VDotProdMultiAllReduceBegin(int nvec, N_Vector x, sunrealtype* sum)
+{
+  SUNFunctionBegin(x->sunctx);
+  SUNErrCode ier = SUN_SUCCESS;
+  SUNDIALS_MARK_FUNCTION_BEGIN(getSUNProfiler(x));
+  if (x->ops->nvdotprodmultiallreducebegin)
+  {
+    ier = x->ops->nvdotprodmultiallreducebegin(nvec, x, sum);
+  }
+  else
+  {
+    SUNAssert(x->ops->nvdotprodmultiallreduce, SUN_ERR_NOT_IMPLEMENTED);
+    ier = x->ops->nvdotprodmultiallreduce(nvec, x, sum);
+  }
+  SUNDIALS_MARK_FUNCTION_END(getSUNProfiler(x));
+  return ier;
+}
+
+/* Completes a reduction started by N_VDotProdMultiAllReduceBegin */
+SUNErrCode N_VDotProdMultiAllReduceEnd(int nvec, N_Vector x, sunrealtype* sum)
+{
+  SUNErrCode ier = SUN_SUCCESS;
+  SUNDIALS_MARK_FUNCTION_BEGIN(getSUNProfiler(x));
+  if (x->ops->nvdotprodmultiallreduceend)
+  {
+    ier = x->ops->nvdotprodmultiallreduceend(nvec, x, sum);
+  }
+  SUNDIALS_MARK_FUNCTION_END(getSUNProfiler(x));
+  return ier;
+}
+
 /* ------------------------------------
  * OPTIONAL XBraid interface operations
  * ------------------------------------*/
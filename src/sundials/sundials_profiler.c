@@ -37,9 +37,21 @@
 static SUNErrCode sunCollectTimers(SUNProfiler p);
 #endif
 static void sunPrintTimer(SUNHashMapKeyValue kv, FILE* fp, void* pvoid);
+static void sunPrintTimerNode(SUNProfiler p, sunTimerNode* node, int depth,
+                              FILE* fp);
 static int sunCompareTimes(const void* l, const void* r);
 static int sunclock_gettime_monotonic(sunTimespec* tp);
 
+/* A timer handle is the index of the timer plus a per-profiler offset. The
+   offset changes with each new profiler so that a handle cached for a freed
+   profiler (e.g., by the SUNDIALS_MARK_* macros) is rejected by a profiler
+   later allocated at the same address. The low bits hold the index. */
+#define SUN_PROFILER_INDEX_BITS 16
+#define SUN_PROFILER_MAX_TIMERS (1 << SUN_PROFILER_INDEX_BITS)
+#define SUN_PROFILER_NUM_BASES  32767
+
+static int sunProfilerCount = 0;
+
 static sunTimerStruct* sunTimerStructNew(void)
 {
   sunTimerStruct* ts = (sunTimerStruct*)malloc(sizeof(sunTimerStruct));
@@ -51,6 +63,7 @@ static sunTimerStruct* sunTimerStructNew(void)
   ts->average        = 0.0;
   ts->maximum        = 0.0;
   ts->count          = 0;
+  ts->id             = -1;
   return ts;
 }
 
@@ -74,18 +87,27 @@ static SUNErrCode sunProfilerDestroyKeyValue(SUNHashMapKeyValue* kv_ptr)
   return SUN_SUCCESS;
 }
 
+/* Free the handle tables. The timers are owned by the hashmap. */
+static void sunProfilerFreeTimerNames(SUNProfiler p)
+{
+  for (int i = 0; i < p->num_timers; i++) { free(p->timer_names[i]); }
+  free(p->timer_names);
+  free(p->timers);
+  p->timer_names = NULL;
+  p->timers      = NULL;
+  p->num_timers  = 0;
+}
+
 static void sunStartTiming(sunTimerStruct* entry)
 {
   sunclock_gettime_monotonic(entry->tic);
 }
 
-static void sunStopTiming(sunTimerStruct* entry)
+static void sunAccumulateTiming(sunTimerStruct* entry)
 {
   long s_difference  = 0;
   long ns_difference = 0;
 
-  sunclock_gettime_monotonic(entry->toc);
-
   s_difference  = entry->toc->tv_sec - entry->tic->tv_sec;
   ns_difference = entry->toc->tv_nsec - entry->tic->tv_nsec;
   if (ns_difference < 0)
@@ -99,6 +121,12 @@ static void sunStopTiming(sunTimerStruct* entry)
   entry->maximum = entry->elapsed;
 }
 
+static void sunStopTiming(sunTimerStruct* entry)
+{
+  sunclock_gettime_monotonic(entry->toc);
+  sunAccumulateTiming(entry);
+}
+
 static void sunResetTiming(sunTimerStruct* entry)
 {
   entry->tic->tv_sec  = 0;
@@ -111,11 +139,162 @@ static void sunResetTiming(sunTimerStruct* entry)
   entry->count        = 0;
 }
 
+static sunTimerNode* sunTimerNodeNew(int id, sunTimerNode* parent)
+{
+  sunTimerNode* node = (sunTimerNode*)malloc(sizeof(sunTimerNode));
+  if (!node) { return NULL; }
+  node->timer = sunTimerStructNew();
+  if (!node->timer)
+  {
+    free(node);
+    return NULL;
+  }
+  node->timer->id = id;
+  node->id        = id;
+  node->parent    = parent;
+  node->child     = NULL;
+  node->sibling   = NULL;
+  return node;
+}
+
+static void sunTimerNodeFree(sunTimerNode* node)
+{
+  while (node)
+  {
+    sunTimerNode* sibling = node->sibling;
+    sunTimerNodeFree(node->child);
+    sunTimerStructFree(node->timer);
+    free(node);
+    node = sibling;
+  }
+}
+
+static void sunTimerNodeReset(sunTimerNode* node)
+{
+  for (; node; node = node->sibling)
+  {
+    sunResetTiming(node->timer);
+    sunTimerNodeReset(node->child);
+  }
+}
+
+/* Get the timer struct for a region name, adding the timer to the profiler
+   the first time the name is used. The handle of a timer is its index in the
+   profiler's timers array. */
+static SUNErrCode sunProfilerGetTimerStruct(SUNProfiler p, const char* name,
+                                            sunTimerStruct** ts)
+{
+  int64_t ier;
+  char* name_copy;
+
+  if (!SUNHashMap_GetValue(p->map, name, (void**)ts)) { return SUN_SUCCESS; }
+
+  if (p->num_timers == SUN_PROFILER_MAX_TIMERS)
+  {
+    return SUN_ERR_PROFILER_MAPFULL;
+  }
+
+  if (p->num_timers == p->timers_capacity)
+  {
+    int new_capacity = p->timers_capacity ? 2 * p->timers_capacity : 64;
+    sunTimerStruct** new_timers =
+      (sunTimerStruct**)realloc(p->timers,
+                                new_capacity * sizeof(sunTimerStruct*));
+    if (!new_timers) { return SUN_ERR_MALLOC_FAIL; }
+    p->timers        = new_timers;
+    char** new_names = (char**)realloc(p->timer_names,
+                                       new_capacity * sizeof(char*));
+    if (!new_names) { return SUN_ERR_MALLOC_FAIL; }
+    p->timer_names     = new_names;
+    p->timers_capacity = new_capacity;
+  }
+
+  name_copy = (char*)malloc((strlen(name) + 1) * sizeof(char));
+  if (!name_copy) { return SUN_ERR_MALLOC_FAIL; }
+  strcpy(name_copy, name);
+
+  *ts = sunTimerStructNew();
+  ier = SUNHashMap_Insert(p->map, name, (void*)*ts);
+  if (ier)
+  {
+    free(name_copy);
+    sunTimerStructFree(*ts);
+    *ts = NULL;
+    if (ier == SUNHASHMAP_DUPLICATE) { return SUN_ERR_PROFILER_MAPFULL; }
+    return SUN_ERR_PROFILER_MAPINSERT;
+  }
+
+  (*ts)->id                     = p->num_timers;
+  p->timers[p->num_timers]      = *ts;
+  p->timer_names[p->num_timers] = name_copy;
+  p->num_timers++;
+
+  return SUN_SUCCESS;
+}
+
+static SUNErrCode sunProfilerStartTimer(SUNProfiler p, sunTimerStruct* timer)
+{
+  sunTimerNode* node = NULL;
+
+  timer->count++;
+  sunStartTiming(timer);
+
+  /* The root timer spans the whole profile so it is not part of the tree */
+  if (!p->hierarchical || timer->id == p->root_id) { return SUN_SUCCESS; }
+
+  for (node = p->current->child; node; node = node->sibling)
+  {
+    if (node->id == timer->id) { break; }
+  }
+
+  if (!node)
+  {
+    sunTimerNode* last = p->current->child;
+    node               = sunTimerNodeNew(timer->id, p->current);
+    if (!node) { return SUN_ERR_MALLOC_FAIL; }
+    if (!last) { p->current->child = node; }
+    else
+    {
+      while (last->sibling) { last = last->sibling; }
+      last->sibling = node;
+    }
+  }
+
+  node->timer->count++;
+  *(node->timer->tic) = *(timer->tic);
+  p->current          = node;
+
+  return SUN_SUCCESS;
+}
+
+static void sunProfilerStopTimer(SUNProfiler p, sunTimerStruct* timer)
+{
+  sunTimerNode* node = NULL;
+
+  sunStopTiming(timer);
+
+  if (!p->hierarchical || timer->id == p->root_id) { return; }
+
+  /* Close the innermost open region with this timer. Any regions opened
+     inside of it that were not ended are closed without being timed. */
+  for (node = p->current; node && node != p->tree; node = node->parent)
+  {
+    if (node->id == timer->id) { break; }
+  }
+  if (!node || node == p->tree) { return; }
+
+  *(node->timer->toc) = *(timer->toc);
+  sunAccumulateTiming(node->timer);
+  p->current = node->parent;
+}
+
 SUNErrCode SUNProfiler_Create(SUNComm comm, const char* title, SUNProfiler* p)
 {
   SUNProfiler profiler;
+  sunTimerStruct* root = NULL;
   int max_entries;
   char* max_entries_env;
+  char* hierarchical_env;
 
   *p = profiler = (SUNProfiler)malloc(sizeof(struct SUNProfiler_));
 
@@ -146,6 +325,43 @@ SUNErrCode SUNProfiler_Create(SUNComm comm, const char* title, SUNProfiler* p)
     return SUN_ERR_MALLOC_FAIL;
   }
 
+  profiler->timers          = NULL;
+  profiler->timer_names     = NULL;
+  profiler->num_timers      = 0;
+  profiler->timers_capacity = 0;
+  profiler->hierarchical    = SUNFALSE;
+  profiler->tree            = NULL;
+  profiler->current         = NULL;
+
+  sunProfilerCount      = sunProfilerCount % SUN_PROFILER_NUM_BASES + 1;
+  profiler->handle_base = sunProfilerCount << SUN_PROFILER_INDEX_BITS;
+
+  if (sunProfilerGetTimerStruct(profiler, SUNDIALS_ROOT_TIMER, &root))
+  {
+    sunProfilerFreeTimerNames(profiler);
+    SUNHashMap_Destroy(&profiler->map);
+    sunTimerStructFree((void*)profiler->overhead);
+    free(profiler);
+    *p = profiler = NULL;
+    return SUN_ERR_MALLOC_FAIL;
+  }
+  profiler->root_id = root->id;
+
+  /* Check to see if hierarchical profiling was requested */
+  hierarchical_env = getenv("SUNPROFILER_HIERARCHICAL");
+  if (hierarchical_env && atoi(hierarchical_env))
+  {
+    if (SUNProfiler_SetHierarchical(profiler, SUNTRUE))
+    {
+      sunProfilerFreeTimerNames(profiler);
+      SUNHashMap_Destroy(&profiler->map);
+      sunTimerStructFree((void*)profiler->overhead);
+      free(profiler);
+      *p = profiler = NULL;
+      return SUN_ERR_MALLOC_FAIL;
+    }
+  }
+
   /* Attach the comm, duplicating it if MPI is used. */
 #if SUNDIALS_MPI_ENABLED
   profiler->comm = SUN_COMM_NULL;
@@ -182,6 +398,8 @@ SUNErrCode SUNProfiler_Free(SUNProfiler* p)
   if (*p)
   {
     SUNHashMap_Destroy(&(*p)->map);
+    sunProfilerFreeTimerNames(*p);
+    sunTimerNodeFree((*p)->tree);
     sunTimerStructFree((void*)(*p)->overhead);
 #if SUNDIALS_MPI_ENABLED
     if ((*p)->comm != SUN_COMM_NULL) { MPI_Comm_free(&(*p)->comm); }
@@ -196,31 +414,18 @@ SUNErrCode SUNProfiler_Free(SUNProfiler* p)
 
 SUNErrCode SUNProfiler_Begin(SUNProfiler p, const char* name)
 {
-  int64_t ier;
+  SUNErrCode err;
   sunTimerStruct* timer = NULL;
 
   if (!p) { return SUN_ERR_ARG_CORRUPT; }
 
   sunStartTiming(p->overhead);
 
-  if (SUNHashMap_GetValue(p->map, name, (void**)&timer))
-  {
-    timer = sunTimerStructNew();
-    ier   = SUNHashMap_Insert(p->map, name, (void*)timer);
-    if (ier)
-    {
-      sunTimerStructFree(timer);
-      sunStopTiming(p->overhead);
-      if (ier == SUNHASHMAP_ERROR) { return SUN_ERR_PROFILER_MAPINSERT; }
-      if (ier == SUNHASHMAP_DUPLICATE) { return SUN_ERR_PROFILER_MAPFULL; }
-    }
-  }
-
-  timer->count++;
-  sunStartTiming(timer);
+  err = sunProfilerGetTimerStruct(p, name, &timer);
+  if (!err) { err = sunProfilerStartTimer(p, timer); }
 
   sunStopTiming(p->overhead);
-  return SUN_SUCCESS;
+  return err;
 }
 
 SUNErrCode SUNProfiler_End(SUNProfiler p, const char* name)
@@ -243,12 +448,86 @@ SUNErrCode SUNProfiler_End(SUNProfiler p, const char* name)
     }
   }
 
-  sunStopTiming(timer);
+  sunProfilerStopTimer(p, timer);
 
   sunStopTiming(p->overhead);
   return SUN_SUCCESS;
 }
 
+SUNErrCode SUNProfiler_GetTimer(SUNProfiler p, const char* name, int* timer)
+{
+  SUNErrCode err;
+  sunTimerStruct* ts = NULL;
+
+  if (!p) { return SUN_ERR_ARG_CORRUPT; }
+
+  sunStartTiming(p->overhead);
+
+  err = sunProfilerGetTimerStruct(p, name, &ts);
+  if (!err) { *timer = p->handle_base + ts->id; }
+
+  sunStopTiming(p->overhead);
+  return err;
+}
+
+SUNErrCode SUNProfiler_BeginHandle(SUNProfiler p, int timer)
+{
+  SUNErrCode err;
+
+  if (!p) { return SUN_ERR_ARG_CORRUPT; }
+
+  sunStartTiming(p->overhead);
+
+  /* reject handles from other profilers */
+  if (timer < p->handle_base || timer - p->handle_base >= p->num_timers)
+  {
+    sunStopTiming(p->overhead);
+    return SUN_ERR_PROFILER_MAPKEYNOTFOUND;
+  }
+
+  err = sunProfilerStartTimer(p, p->timers[timer - p->handle_base]);
+
+  sunStopTiming(p->overhead);
+  return err;
+}
+
+SUNErrCode SUNProfiler_EndHandle(SUNProfiler p, int timer)
+{
+  if (!p) { return SUN_ERR_ARG_CORRUPT; }
+
+  sunStartTiming(p->overhead);
+
+  /* reject handles from other profilers */
+  if (timer < p->handle_base || timer - p->handle_base >= p->num_timers)
+  {
+    sunStopTiming(p->overhead);
+    return SUN_ERR_PROFILER_MAPKEYNOTFOUND;
+  }
+
+  sunProfilerStopTimer(p, p->timers[timer - p->handle_base]);
+
+  sunStopTiming(p->overhead);
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNProfiler_SetHierarchical(SUNProfiler p, sunbooleantype onoff)
+{
+  if (!p) { return SUN_ERR_ARG_CORRUPT; }
+
+  if (onoff && !p->tree)
+  {
+    p->tree = sunTimerNodeNew(p->root_id, NULL);
+    if (!p->tree) { return SUN_ERR_MALLOC_FAIL; }
+  }
+
+  /* Regions that are open when the call tree is enabled are not part of it */
+  if (onoff && !p->hierarchical) { p->current = p->tree; }
+
+  p->hierarchical = onoff;
+
+  return SUN_SUCCESS;
+}
+
 SUNErrCode SUNProfiler_GetTimerResolution(SUNProfiler p, double* resolution)
 {
   if (!p) { return SUN_ERR_ARG_CORRUPT; }
@@ -309,6 +588,9 @@ SUNErrCode SUNProfiler_Reset(SUNProfiler p)
     if (timer) { sunResetTiming(timer); }
   }
 
+  /* Reset the call tree */
+  if (p->tree) { sunTimerNodeReset(p->tree); }
+
   /* Reset the overall timer. */
   p->sundials_time = 0.0;
 
@@ -380,6 +662,16 @@ SUNErrCode SUNProfiler_Print(SUNProfiler p, FILE* fp)
       if (sorted[i]) { sunPrintTimer(sorted[i], fp, (void*)p); }
     }
     free(sorted);
+
+    /* Print the call tree (the times are for this rank only) */
+    if (p->tree && p->tree->child)
+    {
+      fprintf(fp, "\n%-40s\t %% time (inclusive) \t time/rank \t\t count \n",
+              "CALL TREE (rank 0):");
+      fprintf(fp, "=========================================================="
+                  "======================================================\n");
+      sunPrintTimerNode(p, p->tree->child, 0, fp);
+    }
   }
 
   sunStopTiming(p->overhead);
@@ -503,6 +795,23 @@ void sunPrintTimer(SUNHashMapKeyValue kv, FILE* fp, void* pvoid)
           percent, maximum, average, ts->count);
 }
 
+/* Print out the call tree with the regions called from a region indented
+   below it: timer name, percentage of exec time, time, and the counter. */
+void sunPrintTimerNode(SUNProfiler p, sunTimerNode* node, int depth, FILE* fp)
+{
+  int width = 40 - 2 * depth;
+  if (width < 0) { width = 0; }
+
+  for (; node; node = node->sibling)
+  {
+    fprintf(fp, "%*s%-*s\t %6.2f%% \t         %.6fs \t %ld\n", 2 * depth, "",
+            width, p->timer_names[node->id],
+            node->timer->elapsed / p->sundials_time * 100,
+            node->timer->elapsed, node->timer->count);
+    sunPrintTimerNode(p, node->child, depth + 1, fp);
+  }
+}
+
 /* Comparator for qsort that compares key-value pairs
    based on the maximum time in the sunTimerStruct. */
 int sunCompareTimes(const void* l, const void* r)
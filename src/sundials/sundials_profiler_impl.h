@@ -72,15 +72,42 @@ struct _sunTimerStruct
   double maximum;
   double elapsed;
   long count;
+  int id; /* index in the profiler's timers array */
 };
 
 typedef struct _sunTimerStruct sunTimerStruct;
 
+/*
+  sunTimerNode.
+  A private structure holding the timing of a region for one path through
+  the call tree when hierarchical profiling is enabled.
+ */
+
+typedef struct _sunTimerNode sunTimerNode;
+
+struct _sunTimerNode
+{
+  int id;
+  sunTimerStruct* timer;
+  sunTimerNode* parent;
+  sunTimerNode* child;   /* first child */
+  sunTimerNode* sibling; /* next child of the parent */
+};
+
 struct SUNProfiler_
 {
   SUNComm comm;
   char* title;
   SUNHashMap map;
+  sunTimerStruct** timers; /* timers indexed by handle */
+  char** timer_names;      /* region names indexed by handle */
+  int num_timers;          /* number of timers */
+  int timers_capacity;     /* allocated length of timers and timer_names */
+  int root_id;             /* index of SUNDIALS_ROOT_TIMER */
+  int handle_base;         /* offset added to an index to form a handle */
+  sunbooleantype hierarchical;
+  sunTimerNode* tree;    /* root of the call tree */
+  sunTimerNode* current; /* innermost open region of the call tree */
   sunTimerStruct* overhead;
   double sundials_time;
 };
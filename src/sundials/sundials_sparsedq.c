@@ -0,0 +1,363 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2025-2026, Lawrence Livermore National Security,
+ * University of Maryland Baltimore County, and the SUNDIALS contributors.
+ * Copyright (c) 2013-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * Copyright (c) 2002-2013, Lawrence Livermore National Security.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * Implementation of the shared engine for graph-colored difference
+ * quotient approximations of sparse Jacobian matrices.
+ *
+ * Two columns may share a color (be perturbed simultaneously) if
+ * they have no nonzero row in common. The coloring is computed with
+ * a greedy distance-2 coloring of the column intersection graph,
+ * visiting the columns in their natural order. For the banded
+ * patterns arising from stencil discretizations this recovers the
+ * ml+mu+1 groups used by the band difference quotient routines.
+ * ----------------------------------------------------------------*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <sundials/sundials_errors.h>
+#include <sundials/sundials_math.h>
+#include <sundials/sundials_types.h>
+#include <sunmatrix/sunmatrix_sparse.h>
+
+#include "sundials_sparsedq_impl.h"
+
+/* Compute the transpose of the pattern (ptrs, vals) with n compressed
+   indices and m uncompressed indices. On return tpos[p] is the location
+   of entry p in the transposed pattern. */
+static void sparseDQ_Transpose(sunindextype n, sunindextype m,
+                               const sunindextype* ptrs,
+                               const sunindextype* vals, sunindextype* tptrs,
+                               sunindextype* tvals, sunindextype* tpos)
+{
+  sunindextype i, j, p, q;
+
+  /* count the entries in each transposed row/column */
+  for (i = 0; i <= m; i++) { tptrs[i] = 0; }
+  for (p = 0; p < ptrs[n]; p++) { tptrs[vals[p] + 1]++; }
+  for (i = 0; i < m; i++) { tptrs[i + 1] += tptrs[i]; }
+
+  /* fill the transposed pattern, use tpos to track the next open slot */
+  for (j = 0; j < n; j++)
+  {
+    for (p = ptrs[j]; p < ptrs[j + 1]; p++)
+    {
+      i        = vals[p];
+      q        = tptrs[i]++;
+      tvals[q] = j;
+      tpos[p]  = q;
+    }
+  }
+
+  /* shift the pointers back */
+  for (i = m; i > 0; i--) { tptrs[i] = tptrs[i - 1]; }
+  tptrs[0] = 0;
+}
+
+/* Greedy distance-2 coloring of the columns */
+static SUNErrCode sparseDQ_Color(SUNSparseDQ sdq)
+{
+  sunindextype i, j, k, c, p, q;
+  sunindextype* color;
+  sunindextype* mark;
+
+  color = (sunindextype*)malloc(sdq->N * sizeof(sunindextype));
+  if (color == NULL && sdq->N > 0) { return SUN_ERR_MALLOC_FAIL; }
+
+  mark = (sunindextype*)malloc((sdq->N + 1) * sizeof(sunindextype));
+  if (mark == NULL)
+  {
+    free(color);
+    return SUN_ERR_MALLOC_FAIL;
+  }
+  for (c = 0; c <= sdq->N; c++) { mark[c] = -1; }
+
+  sdq->ncolors = 0;
+  for (j = 0; j < sdq->N; j++)
+  {
+    /* mark the colors of previously colored columns sharing a row with j */
+    for (p = sdq->colptrs[j]; p < sdq->colptrs[j + 1]; p++)
+    {
+      i = sdq->rowvals[p];
+      for (q = sdq->rowptrs[i]; q < sdq->rowptrs[i + 1]; q++)
+      {
+        k = sdq->colvals[q];
+        if (k < j) { mark[color[k]] = j; }
+      }
+    }
+
+    /* assign the smallest available color */
+    c = 0;
+    while (mark[c] == j) { c++; }
+    color[j] = c;
+    if (c + 1 > sdq->ncolors) { sdq->ncolors = c + 1; }
+  }
+
+  /* group the columns by color */
+  sdq->colorptrs = (sunindextype*)malloc((sdq->ncolors + 1) *
+                                         sizeof(sunindextype));
+  sdq->colorcols = (sunindextype*)malloc(sdq->N * sizeof(sunindextype));
+  if (sdq->colorptrs == NULL || (sdq->colorcols == NULL && sdq->N > 0))
+  {
+    free(color);
+    free(mark);
+    return SUN_ERR_MALLOC_FAIL;
+  }
+
+  for (c = 0; c <= sdq->ncolors; c++) { sdq->colorptrs[c] = 0; }
+  for (j = 0; j < sdq->N; j++) { sdq->colorptrs[color[j] + 1]++; }
+  for (c = 0; c < sdq->ncolors; c++)
+  {
+    sdq->colorptrs[c + 1] += sdq->colorptrs[c];
+    mark[c] = sdq->colorptrs[c];
+  }
+  for (j = 0; j < sdq->N; j++) { sdq->colorcols[mark[color[j]]++] = j; }
+
+  free(color);
+  free(mark);
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNSparseDQ_Create(SUNMatrix S, SUNSparseDQ* sdq_ptr)
+{
+  SUNSparseDQ sdq;
+  sunindextype p, np, nt, NNZ;
+  sunindextype *ptrs, *vals, *tptrs, *tvals, *tpos;
+  SUNErrCode err;
+
+  if (S == NULL || sdq_ptr == NULL) { return SUN_ERR_ARG_CORRUPT; }
+  if (SUNMatGetID(S) != SUNMATRIX_SPARSE) { return SUN_ERR_ARG_WRONGTYPE; }
+
+  *sdq_ptr = NULL;
+
+  sdq = (SUNSparseDQ)malloc(sizeof(*sdq));
+  if (sdq == NULL) { return SUN_ERR_MALLOC_FAIL; }
+
+  sdq->M         = SM_ROWS_S(S);
+  sdq->N         = SM_COLUMNS_S(S);
+  sdq->colptrs   = NULL;
+  sdq->rowvals   = NULL;
+  sdq->rowptrs   = NULL;
+  sdq->colvals   = NULL;
+  sdq->csrpos    = NULL;
+  sdq->ncolors   = 0;
+  sdq->colorptrs = NULL;
+  sdq->colorcols = NULL;
+
+  /* compressed and transposed dimensions of the input pattern */
+  if (SM_SPARSETYPE_S(S) == SUN_CSC_MAT)
+  {
+    np = sdq->N;
+    nt = sdq->M;
+  }
+  else
+  {
+    np = sdq->M;
+    nt = sdq->N;
+  }
+
+  NNZ      = SM_INDEXPTRS_S(S)[np];
+  sdq->NNZ = NNZ;
+
+  sdq->colptrs = (sunindextype*)malloc((sdq->N + 1) * sizeof(sunindextype));
+  sdq->rowptrs = (sunindextype*)malloc((sdq->M + 1) * sizeof(sunindextype));
+  sdq->rowvals = (sunindextype*)malloc(SUNMAX(NNZ, 1) * sizeof(sunindextype));
+  sdq->colvals = (sunindextype*)malloc(SUNMAX(NNZ, 1) * sizeof(sunindextype));
+  sdq->csrpos  = (sunindextype*)malloc(SUNMAX(NNZ, 1) * sizeof(sunindextype));
+  if (sdq->colptrs == NULL || sdq->rowptrs == NULL || sdq->rowvals == NULL ||
+      sdq->colvals == NULL || sdq->csrpos == NULL)
+  {
+    SUNSparseDQ_Destroy(&sdq);
+    return SUN_ERR_MALLOC_FAIL;
+  }
+
+  /* copy the input pattern and build its transpose, for CSR input the
+     transpose map is the inverse of csrpos */
+  if (SM_SPARSETYPE_S(S) == SUN_CSC_MAT)
+  {
+    ptrs  = sdq->colptrs;
+    vals  = sdq->rowvals;
+    tptrs = sdq->rowptrs;
+    tvals = sdq->colvals;
+    tpos  = sdq->csrpos;
+  }
+  else
+  {
+    ptrs  = sdq->rowptrs;
+    vals  = sdq->colvals;
+    tptrs = sdq->colptrs;
+    tvals = sdq->rowvals;
+    tpos  = (sunindextype*)malloc(SUNMAX(NNZ, 1) * sizeof(sunindextype));
+    if (tpos == NULL)
+    {
+      SUNSparseDQ_Destroy(&sdq);
+      return SUN_ERR_MALLOC_FAIL;
+    }
+  }
+
+  memcpy(ptrs, SM_INDEXPTRS_S(S), (np + 1) * sizeof(sunindextype));
+  memcpy(vals, SM_INDEXVALS_S(S), NNZ * sizeof(sunindextype));
+
+  err = SUN_SUCCESS;
+  for (p = 0; p < NNZ; p++)
+  {
+    if (vals[p] < 0 || vals[p] >= nt) { err = SUN_ERR_ARG_OUTOFRANGE; }
+  }
+
+  if (!err)
+  {
+    sparseDQ_Transpose(np, nt, ptrs, vals, tptrs, tvals, tpos);
+    if (SM_SPARSETYPE_S(S) == SUN_CSR_MAT)
+    {
+      for (p = 0; p < NNZ; p++) { sdq->csrpos[tpos[p]] = p; }
+    }
+  }
+
+  if (tpos != sdq->csrpos) { free(tpos); }
+  if (err)
+  {
+    SUNSparseDQ_Destroy(&sdq);
+    return err;
+  }
+
+  err = sparseDQ_Color(sdq);
+  if (err)
+  {
+    SUNSparseDQ_Destroy(&sdq);
+    return err;
+  }
+
+  *sdq_ptr = sdq;
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNSparseDQ_Destroy(SUNSparseDQ* sdq_ptr)
+{
+  SUNSparseDQ sdq;
+
+  if (sdq_ptr == NULL || *sdq_ptr == NULL) { return SUN_SUCCESS; }
+
+  sdq = *sdq_ptr;
+
+  free(sdq->colptrs);
+  free(sdq->rowvals);
+  free(sdq->rowptrs);
+  free(sdq->colvals);
+  free(sdq->csrpos);
+  free(sdq->colorptrs);
+  free(sdq->colorcols);
+  free(sdq);
+
+  *sdq_ptr = NULL;
+
+  return SUN_SUCCESS;
+}
+
+sunbooleantype SUNSparseDQ_SamePattern(SUNSparseDQ sdq, SUNMatrix S)
+{
+  sunindextype np;
+  sunindextype *ptrs, *vals;
+
+  if (sdq == NULL || S == NULL) { return SUNFALSE; }
+  if (SUNMatGetID(S) != SUNMATRIX_SPARSE) { return SUNFALSE; }
+  if (SM_ROWS_S(S) != sdq->M || SM_COLUMNS_S(S) != sdq->N) { return SUNFALSE; }
+
+  if (SM_SPARSETYPE_S(S) == SUN_CSC_MAT)
+  {
+    np   = sdq->N;
+    ptrs = sdq->colptrs;
+    vals = sdq->rowvals;
+  }
+  else
+  {
+    np   = sdq->M;
+    ptrs = sdq->rowptrs;
+    vals = sdq->colvals;
+  }
+
+  if (SM_INDEXPTRS_S(S)[np] != sdq->NNZ) { return SUNFALSE; }
+  if (memcmp(ptrs, SM_INDEXPTRS_S(S), (np + 1) * sizeof(sunindextype)))
+  {
+    return SUNFALSE;
+  }
+  if (memcmp(vals, SM_INDEXVALS_S(S), sdq->NNZ * sizeof(sunindextype)))
+  {
+    return SUNFALSE;
+  }
+
+  return SUNTRUE;
+}
+
+SUNErrCode SUNSparseDQ_CheckMatrix(SUNSparseDQ sdq, SUNMatrix J)
+{
+  if (sdq == NULL || J == NULL) { return SUN_ERR_ARG_CORRUPT; }
+  if (SUNMatGetID(J) != SUNMATRIX_SPARSE) { return SUN_ERR_ARG_WRONGTYPE; }
+  if (SM_ROWS_S(J) != sdq->M || SM_COLUMNS_S(J) != sdq->N)
+  {
+    return SUN_ERR_ARG_DIMSMISMATCH;
+  }
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNSparseDQ_LoadPattern(SUNSparseDQ sdq, SUNMatrix J)
+{
+  sunindextype p;
+  SUNErrCode err;
+
+  err = SUNSparseDQ_CheckMatrix(sdq, J);
+  if (err) { return err; }
+  if (SM_NNZ_S(J) < sdq->NNZ) { return SUN_ERR_ARG_DIMSMISMATCH; }
+
+  if (SM_SPARSETYPE_S(J) == SUN_CSC_MAT)
+  {
+    memcpy(SM_INDEXPTRS_S(J), sdq->colptrs, (sdq->N + 1) * sizeof(sunindextype));
+    memcpy(SM_INDEXVALS_S(J), sdq->rowvals, sdq->NNZ * sizeof(sunindextype));
+  }
+  else
+  {
+    memcpy(SM_INDEXPTRS_S(J), sdq->rowptrs, (sdq->M + 1) * sizeof(sunindextype));
+    memcpy(SM_INDEXVALS_S(J), sdq->colvals, sdq->NNZ * sizeof(sunindextype));
+  }
+
+  for (p = 0; p < sdq->NNZ; p++) { SM_DATA_S(J)[p] = SUN_RCONST(0.0); }
+
+  return SUN_SUCCESS;
+}
+
+void SUNSparseDQ_ScatterColumn(SUNSparseDQ sdq, SUNMatrix J, sunindextype j,
+                               sunrealtype inc_inv, const sunrealtype* fpert,
+                               const sunrealtype* fbase)
+{
+  sunindextype i, p;
+  sunrealtype* data = SM_DATA_S(J);
+
+  if (SM_SPARSETYPE_S(J) == SUN_CSC_MAT)
+  {
+    for (p = sdq->colptrs[j]; p < sdq->colptrs[j + 1]; p++)
+    {
+      i       = sdq->rowvals[p];
+      data[p] = inc_inv * (fpert[i] - fbase[i]);
+    }
+  }
+  else
+  {
+    for (p = sdq->colptrs[j]; p < sdq->colptrs[j + 1]; p++)
+    {
+      i                    = sdq->rowvals[p];
+      data[sdq->csrpos[p]] = inc_inv * (fpert[i] - fbase[i]);
+    }
+  }
+}
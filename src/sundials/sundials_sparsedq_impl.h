@@ -0,0 +1,94 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2025-2026, Lawrence Livermore National Security,
+ * University of Maryland Baltimore County, and the SUNDIALS contributors.
+ * Copyright (c) 2013-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * Copyright (c) 2002-2013, Lawrence Livermore National Security.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * Shared engine for graph-colored difference quotient approximations
+ * of sparse Jacobian matrices. A SUNSparseDQ object holds a copy of
+ * a user-supplied sparsity pattern (in both CSC and CSR form) and a
+ * partition of the columns into structurally orthogonal groups
+ * (colors). All columns of one color may be perturbed at once, so a
+ * Jacobian can be approximated with one residual/right-hand side
+ * evaluation per color rather than one per column.
+ *
+ * The packages compute the column increments and call the residual
+ * function; this module provides the coloring and scatters the
+ * difference quotients into a CSC or CSR SUNSparseMatrix.
+ * ----------------------------------------------------------------*/
+
+#ifndef _SUNDIALS_SPARSEDQ_IMPL_H
+#define _SUNDIALS_SPARSEDQ_IMPL_H
+
+#include <sundials/sundials_errors.h>
+#include <sundials/sundials_matrix.h>
+#include <sundials/sundials_types.h>
+
+#ifdef __cplusplus /* wrapper to enable C++ usage */
+extern "C" {
+#endif
+
+typedef struct SUNSparseDQ_* SUNSparseDQ;
+
+struct SUNSparseDQ_
+{
+  sunindextype M;   /* number of rows                                 */
+  sunindextype N;   /* number of columns                              */
+  sunindextype NNZ; /* number of nonzeros in the pattern              */
+
+  /* sparsity pattern in compressed-sparse-column form */
+  sunindextype* colptrs; /* column j entries: colptrs[j]..colptrs[j+1]-1 */
+  sunindextype* rowvals; /* row index of each CSC entry                  */
+
+  /* sparsity pattern in compressed-sparse-row form */
+  sunindextype* rowptrs; /* row i entries: rowptrs[i]..rowptrs[i+1]-1    */
+  sunindextype* colvals; /* column index of each CSR entry               */
+  sunindextype* csrpos;  /* CSR data location of each CSC entry          */
+
+  /* column coloring */
+  sunindextype ncolors;    /* number of column groups                     */
+  sunindextype* colorptrs; /* color c columns: colorptrs[c]..colorptrs[c+1]-1 */
+  sunindextype* colorcols; /* columns ordered by color                    */
+};
+
+/* Copy the pattern of the sparse matrix S and compute a column coloring */
+SUNDIALS_EXPORT
+SUNErrCode SUNSparseDQ_Create(SUNMatrix S, SUNSparseDQ* sdq_ptr);
+
+/* Free the memory allocated by SUNSparseDQ_Create */
+SUNDIALS_EXPORT
+SUNErrCode SUNSparseDQ_Destroy(SUNSparseDQ* sdq_ptr);
+
+/* Check if the sparse matrix S has the same pattern as the SUNSparseDQ */
+SUNDIALS_EXPORT
+sunbooleantype SUNSparseDQ_SamePattern(SUNSparseDQ sdq, SUNMatrix S);
+
+/* Check if the sparse matrix J is compatible with the SUNSparseDQ */
+SUNDIALS_EXPORT
+SUNErrCode SUNSparseDQ_CheckMatrix(SUNSparseDQ sdq, SUNMatrix J);
+
+/* Load the stored pattern into J and zero its data. The capacity of J
+   must be at least sdq->NNZ (see SUNSparseMatrix_Reallocate). */
+SUNDIALS_EXPORT
+SUNErrCode SUNSparseDQ_LoadPattern(SUNSparseDQ sdq, SUNMatrix J);
+
+/* Store the difference quotients inc_inv * (fpert - fbase) for the
+   nonzeros of column j into the sparse matrix J */
+SUNDIALS_EXPORT
+void SUNSparseDQ_ScatterColumn(SUNSparseDQ sdq, SUNMatrix J, sunindextype j,
+                               sunrealtype inc_inv, const sunrealtype* fpert,
+                               const sunrealtype* fbase);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -25,6 +25,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <sundials/sundials_config.h>
+#include <time.h>
 #include <sundials/sundials_types.h>
 
 /* width of name field in sunfprintf_<type> for aligning table output */
@@ -76,6 +77,19 @@ static inline int sunvasnprintf(char** str, const char* fmt, va_list args)
   return size;
 }
 
+/* Wall clock time in seconds, used for the timing statistics of the
+   packages (differences of two calls are meaningful) */
+static inline double sunWallTime(void)
+{
+#if defined(SUNDIALS_HAVE_POSIX_TIMERS)
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec + 1e-9 * (double)ts.tv_nsec;
+#else
+  return (double)clock() / CLOCKS_PER_SEC;
+#endif
+}
+
 static inline void sunCompensatedSum(sunrealtype base, sunrealtype inc,
                                      sunrealtype* sum, sunrealtype* error)
 {
@@ -337,4 +337,40 @@ SWIGEXPORT int _wrap_FSUNLinSolFree_Band(SUNLinearSolver farg1) {
 }
 
 
+SWIGEXPORT int _wrap_FSUNLinSol_BandSetMixedPrecision(SUNLinearSolver farg1, int const *farg2, int const *farg3, double const *farg4) {
+  int fresult ;
+  SUNLinearSolver arg1 = (SUNLinearSolver) 0 ;
+  int arg2 ;
+  int arg3 ;
+  sunrealtype arg4 ;
+  SUNErrCode result;
+  
+  arg1 = (SUNLinearSolver)(farg1);
+  arg2 = (int)(*farg2);
+  arg3 = (int)(*farg3);
+  arg4 = (sunrealtype)(*farg4);
+  result = (SUNErrCode)SUNLinSol_BandSetMixedPrecision(arg1,arg2,arg3,arg4);
+  fresult = (SUNErrCode)(result);
+  return fresult;
+}
+
+
+SWIGEXPORT int _wrap_FSUNLinSol_BandGetRefinementStats(SUNLinearSolver farg1, long *farg2, long *farg3, long *farg4) {
+  int fresult ;
+  SUNLinearSolver arg1 = (SUNLinearSolver) 0 ;
+  long *arg2 = (long *) 0 ;
+  long *arg3 = (long *) 0 ;
+  long *arg4 = (long *) 0 ;
+  SUNErrCode result;
+  
+  arg1 = (SUNLinearSolver)(farg1);
+  arg2 = (long *)(farg2);
+  arg3 = (long *)(farg3);
+  arg4 = (long *)(farg4);
+  result = (SUNErrCode)SUNLinSol_BandGetRefinementStats(arg1,arg2,arg3,arg4);
+  fresult = (SUNErrCode)(result);
+  return fresult;
+}
+
+
 
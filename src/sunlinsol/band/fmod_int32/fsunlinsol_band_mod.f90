@@ -37,6 +37,8 @@ module fsunlinsol_band_mod
  public :: FSUNLinSolLastFlag_Band
  public :: FSUNLinSolSpace_Band
  public :: FSUNLinSolFree_Band
+ public :: FSUNLinSol_BandSetMixedPrecision
+ public :: FSUNLinSol_BandGetRefinementStats
 
 ! WRAPPER DECLARATIONS
 interface
@@ -121,6 +123,28 @@ type(C_PTR), value :: farg1
 integer(C_INT) :: fresult
 end function
 
+function swigc_FSUNLinSol_BandSetMixedPrecision(farg1, farg2, farg3, farg4) &
+bind(C, name="_wrap_FSUNLinSol_BandSetMixedPrecision") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+integer(C_INT), intent(in) :: farg3
+real(C_DOUBLE), intent(in) :: farg4
+integer(C_INT) :: fresult
+end function
+
+function swigc_FSUNLinSol_BandGetRefinementStats(farg1, farg2, farg3, farg4) &
+bind(C, name="_wrap_FSUNLinSol_BandGetRefinementStats") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+type(C_PTR), value :: farg2
+type(C_PTR), value :: farg3
+type(C_PTR), value :: farg4
+integer(C_INT) :: fresult
+end function
+
 end interface
 
 
@@ -270,5 +294,49 @@ fresult = swigc_FSUNLinSolFree_Band(farg1)
 swig_result = fresult
 end function
 
+function FSUNLinSol_BandSetMixedPrecision(s, onoff, max_refine, refine_tol) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(SUNLinearSolver), target, intent(inout) :: s
+integer(C_INT), intent(in) :: onoff
+integer(C_INT), intent(in) :: max_refine
+real(C_DOUBLE), intent(in) :: refine_tol
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+integer(C_INT) :: farg3 
+real(C_DOUBLE) :: farg4 
+
+farg1 = c_loc(s)
+farg2 = onoff
+farg3 = max_refine
+farg4 = refine_tol
+fresult = swigc_FSUNLinSol_BandSetMixedPrecision(farg1, farg2, farg3, farg4)
+swig_result = fresult
+end function
+
+function FSUNLinSol_BandGetRefinementStats(s, nsolves, nrefine, nfallbacks) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(SUNLinearSolver), target, intent(inout) :: s
+integer(C_LONG), dimension(*), target, intent(inout) :: nsolves
+integer(C_LONG), dimension(*), target, intent(inout) :: nrefine
+integer(C_LONG), dimension(*), target, intent(inout) :: nfallbacks
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+type(C_PTR) :: farg2 
+type(C_PTR) :: farg3 
+type(C_PTR) :: farg4 
+
+farg1 = c_loc(s)
+farg2 = c_loc(nsolves(1))
+farg3 = c_loc(nrefine(1))
+farg4 = c_loc(nfallbacks(1))
+fresult = swigc_FSUNLinSol_BandGetRefinementStats(farg1, farg2, farg3, farg4)
+swig_result = fresult
+end function
+
 
 end module
@@ -18,6 +18,7 @@
  * the SUNLINSOL package.
  * -----------------------------------------------------------------*/
 
+#include <float.h>
 #include <stdio.h>
 #include <stdlib.h>
 
@@ -28,7 +29,19 @@
 
 #include "sundials_macros.h"
 
-#define ONE SUN_RCONST(1.0)
+#define ZERO SUN_RCONST(0.0)
+#define HALF SUN_RCONST(0.5)
+#define ONE  SUN_RCONST(1.0)
+
+#define ROW(i, j, smu) (i - j + smu)
+
+/* mixed precision refinement defaults: maximum number of steps and relative
+   tolerance on the correction */
+#define MAX_REFINE_DEFAULT 10
+#define REFINE_TOL_DEFAULT (SUN_RCONST(10.0) * SUN_UNIT_ROUNDOFF)
+
+/* corrections that stagnate above this size indicate a failed refinement */
+#define STALL_TOL SUNRsqrt(FLT_EPSILON)
 
 /*
  * -----------------------------------------------------------------
@@ -40,6 +53,21 @@
 #define PIVOTS(S)       (BAND_CONTENT(S)->pivots)
 #define LASTFLAG(S)     (BAND_CONTENT(S)->last_flag)
 
+/*
+ * -----------------------------------------------------------------
+ * private function prototypes
+ * -----------------------------------------------------------------
+ */
+
+static sunindextype bandGBTRF_Float(sunrealtype** a, sunindextype n,
+                                    sunindextype mu, sunindextype ml,
+                                    sunindextype smu, sunindextype ldim,
+                                    float* af, sunindextype* p);
+static void bandGBTRS_Float(const float* af, sunindextype n, sunindextype smu,
+                            sunindextype ml, sunindextype ldim,
+                            const sunindextype* p, float* b);
+static int bandSolveMixed(SUNLinearSolver S, SUNMatrix A, N_Vector x, N_Vector b);
+
 /*
  * -----------------------------------------------------------------
  * exported functions
@@ -95,9 +123,20 @@ SUNLinearSolver SUNLinSol_Band(SUNDIALS_MAYBE_UNUSED N_Vector y, SUNMatrix A,
   S->content = content;
 
   /* Fill content */
-  content->N         = MatrixRows;
-  content->last_flag = 0;
-  content->pivots    = NULL;
+  content->N          = MatrixRows;
+  content->last_flag  = 0;
+  content->pivots     = NULL;
+  content->mixed      = SUNFALSE;
+  content->fallback   = SUNFALSE;
+  content->max_refine = MAX_REFINE_DEFAULT;
+  content->refine_tol = REFINE_TOL_DEFAULT;
+  content->Af         = NULL;
+  content->ldim       = 0;
+  content->bf         = NULL;
+  content->r          = NULL;
+  content->nsolves    = 0;
+  content->nrefine    = 0;
+  content->nfallbacks = 0;
 
   /* Allocate content */
   content->pivots = (sunindextype*)malloc(MatrixRows * sizeof(sunindextype));
@@ -151,6 +190,33 @@ int SUNLinSolSetup_Band(SUNLinearSolver S, SUNMatrix A)
               SUNMIN(SM_COLUMNS_B(A) - 1, SM_UBAND_B(A) + SM_LBAND_B(A)),
             SUN_ERR_ARG_INCOMPATIBLE);
 
+  /* in mixed precision mode the factors of a float copy are computed and A is
+     left unchanged, if this fails A is factored in working precision */
+  if (BAND_CONTENT(S)->mixed)
+  {
+    BAND_CONTENT(S)->fallback = SUNFALSE;
+
+    /* (re)allocate the float factors for the storage of A */
+    if (BAND_CONTENT(S)->ldim != SM_LDIM_B(A))
+    {
+      free(BAND_CONTENT(S)->Af);
+      BAND_CONTENT(S)->Af = (float*)malloc((size_t)SM_LDIM_B(A) *
+                                           (size_t)SM_COLUMNS_B(A) *
+                                           sizeof(float));
+      SUNAssert(BAND_CONTENT(S)->Af, SUN_ERR_MALLOC_FAIL);
+      BAND_CONTENT(S)->ldim = SM_LDIM_B(A);
+    }
+
+    LASTFLAG(S) = bandGBTRF_Float(A_cols, SM_COLUMNS_B(A), SM_UBAND_B(A),
+                                  SM_LBAND_B(A), SM_SUBAND_B(A),
+                                  BAND_CONTENT(S)->ldim, BAND_CONTENT(S)->Af,
+                                  pivots);
+    if (LASTFLAG(S) == 0) { return SUN_SUCCESS; }
+
+    BAND_CONTENT(S)->fallback = SUNTRUE;
+    BAND_CONTENT(S)->nfallbacks++;
+  }
+
   /* perform LU factorization of input matrix */
   LASTFLAG(S) = SUNDlsMat_bandGBTRF(A_cols, SM_COLUMNS_B(A), SM_UBAND_B(A),
                                     SM_LBAND_B(A), SM_SUBAND_B(A), pivots);
@@ -166,6 +232,28 @@ int SUNLinSolSolve_Band(SUNLinearSolver S, SUNMatrix A, N_Vector x, N_Vector b,
   SUNFunctionBegin(S->sunctx);
   sunrealtype **A_cols, *xdata;
   sunindextype* pivots;
+  int retval;
+
+  /* solve with the float factors and refine in working precision, if the
+     refinement fails A is factored in working precision and these factors are
+     used until the next setup */
+  if (BAND_CONTENT(S)->mixed && !BAND_CONTENT(S)->fallback)
+  {
+    retval = bandSolveMixed(S, A, x, b);
+    if (retval != SUNLS_CONV_FAIL)
+    {
+      LASTFLAG(S) = retval;
+      return retval;
+    }
+
+    BAND_CONTENT(S)->fallback = SUNTRUE;
+    BAND_CONTENT(S)->nfallbacks++;
+
+    LASTFLAG(S) = SUNDlsMat_bandGBTRF(SM_COLS_B(A), SM_COLUMNS_B(A),
+                                      SM_UBAND_B(A), SM_LBAND_B(A),
+                                      SM_SUBAND_B(A), PIVOTS(S));
+    if (LASTFLAG(S) > 0) { return (SUNLS_LUFACT_FAIL); }
+  }
 
   /* copy b into x */
   N_VScale(ONE, b, x);
@@ -199,9 +287,16 @@ SUNErrCode SUNLinSolSpace_Band(SUNLinearSolver S, long int* lenrwLS,
                                long int* leniwLS)
 {
   SUNFunctionBegin(S->sunctx);
+  long int N;
   SUNAssert(SUNLinSolGetID(S) == SUNLINEARSOLVER_BAND, SUN_ERR_ARG_WRONGTYPE);
-  *leniwLS = 2 + BAND_CONTENT(S)->N;
+  N        = BAND_CONTENT(S)->N;
+  *leniwLS = 2 + N;
   *lenrwLS = 0;
+  /* mixed precision storage, float values are counted as half a real */
+  if (BAND_CONTENT(S)->mixed)
+  {
+    *lenrwLS = (BAND_CONTENT(S)->ldim * N + N) / 2 + N;
+  }
   return SUN_SUCCESS;
 }
 
@@ -218,6 +313,21 @@ SUNErrCode SUNLinSolFree_Band(SUNLinearSolver S)
       free(PIVOTS(S));
       PIVOTS(S) = NULL;
     }
+    if (BAND_CONTENT(S)->Af)
+    {
+      free(BAND_CONTENT(S)->Af);
+      BAND_CONTENT(S)->Af = NULL;
+    }
+    if (BAND_CONTENT(S)->bf)
+    {
+      free(BAND_CONTENT(S)->bf);
+      BAND_CONTENT(S)->bf = NULL;
+    }
+    if (BAND_CONTENT(S)->r)
+    {
+      N_VDestroy(BAND_CONTENT(S)->r);
+      BAND_CONTENT(S)->r = NULL;
+    }
     free(S->content);
     S->content = NULL;
   }
@@ -230,3 +340,307 @@ SUNErrCode SUNLinSolFree_Band(SUNLinearSolver S)
   S = NULL;
   return SUN_SUCCESS;
 }
+
+/* ----------------------------------------------------------------------------
+ * Function to enable or disable the mixed precision mode: Setup factors a
+ * float copy of the matrix (leaving A unchanged) and Solve applies up to
+ * max_refine steps of iterative refinement with residuals computed by
+ * SUNMatMatvec in working precision. Refinement stops once every component of
+ * the correction is at most refine_tol times the corresponding solution
+ * component, or when the corrections stop decreasing. Non-positive values
+ * select the defaults (10 steps and 10 times the unit roundoff). If the float
+ * factorization fails or refinement does not converge, A is factored in working
+ * precision and used until the next Setup.
+ */
+
+SUNErrCode SUNLinSol_BandSetMixedPrecision(SUNLinearSolver S,
+                                           sunbooleantype onoff, int max_refine,
+                                           sunrealtype refine_tol)
+{
+  SUNFunctionBegin(S->sunctx);
+  SUNLinearSolverContent_Band content;
+
+  SUNAssert(SUNLinSolGetID(S) == SUNLINEARSOLVER_BAND, SUN_ERR_ARG_WRONGTYPE);
+  content = BAND_CONTENT(S);
+
+  /* allocate the float work vector on first use, the float factors are
+     allocated in Setup once the storage of the matrix is known */
+  if (onoff && !content->bf)
+  {
+    content->bf = (float*)malloc((size_t)content->N * sizeof(float));
+    SUNAssert(content->bf, SUN_ERR_MALLOC_FAIL);
+  }
+
+  content->mixed      = onoff;
+  content->max_refine = (max_refine > 0) ? max_refine : MAX_REFINE_DEFAULT;
+  content->refine_tol = (refine_tol > ZERO) ? refine_tol : REFINE_TOL_DEFAULT;
+
+  return SUN_SUCCESS;
+}
+
+/* ----------------------------------------------------------------------------
+ * Function to get the mixed precision solve counters
+ */
+
+SUNErrCode SUNLinSol_BandGetRefinementStats(SUNLinearSolver S,
+                                            long int* nsolves,
+                                            long int* nrefine,
+                                            long int* nfallbacks)
+{
+  SUNFunctionBegin(S->sunctx);
+  SUNAssert(SUNLinSolGetID(S) == SUNLINEARSOLVER_BAND, SUN_ERR_ARG_WRONGTYPE);
+  SUNAssert(nsolves, SUN_ERR_ARG_CORRUPT);
+  SUNAssert(nrefine, SUN_ERR_ARG_CORRUPT);
+  SUNAssert(nfallbacks, SUN_ERR_ARG_CORRUPT);
+
+  *nsolves    = BAND_CONTENT(S)->nsolves;
+  *nrefine    = BAND_CONTENT(S)->nrefine;
+  *nfallbacks = BAND_CONTENT(S)->nfallbacks;
+
+  return SUN_SUCCESS;
+}
+
+/*
+ * -----------------------------------------------------------------
+ * private functions
+ * -----------------------------------------------------------------
+ */
+
+/* Copy the band matrix a (with storage upper bandwidth smu) to the float array
+ * af, whose columns have length ldim, and compute its LU factorization in
+ * place as in SUNDlsMat_bandGBTRF. Returns k > 0 if a(k-1,k-1) is a zero pivot
+ * or a value in column k-1 does not fit in a float. */
+static sunindextype bandGBTRF_Float(sunrealtype** a, sunindextype n,
+                                    sunindextype mu, sunindextype ml,
+                                    sunindextype smu, sunindextype ldim,
+                                    float* af, sunindextype* p)
+{
+  sunindextype i, j, k, l, storage_l, storage_k, last_col_k, last_row_k;
+  float *col_k, *diag_k, *sub_diag_k, *col_j, *kptr, *jptr;
+  float max, temp, mult, a_kj;
+  sunbooleantype swap;
+
+  /* copy the band and zero out the first smu - mu rows */
+  for (j = 0; j < n; j++)
+  {
+    col_j = af + j * ldim;
+    for (i = 0; i < smu - mu; i++) { col_j[i] = 0.0f; }
+    for (i = smu - mu; i < ldim; i++)
+    {
+      if (SUNRabs(a[j][i]) > FLT_MAX) { return (j + 1); }
+      col_j[i] = (float)a[j][i];
+    }
+  }
+
+  /* k = elimination step number */
+  for (k = 0; k < n - 1; k++)
+  {
+    col_k      = af + k * ldim;
+    diag_k     = col_k + smu;
+    sub_diag_k = diag_k + 1;
+    last_row_k = SUNMIN(n - 1, k + ml);
+
+    /* find l = pivot row number */
+    l   = k;
+    max = SUNRabs(*diag_k);
+    for (i = k + 1, kptr = sub_diag_k; i <= last_row_k; i++, kptr++)
+    {
+      if (SUNRabs(*kptr) > max)
+      {
+        l   = i;
+        max = SUNRabs(*kptr);
+      }
+    }
+    storage_l = ROW(l, k, smu);
+    p[k]      = l;
+
+    /* check for zero pivot element */
+    if (col_k[storage_l] == 0.0f) { return (k + 1); }
+
+    /* swap a(l,k) and a(k,k) if necessary */
+    if ((swap = (l != k)))
+    {
+      temp             = col_k[storage_l];
+      col_k[storage_l] = *diag_k;
+      *diag_k          = temp;
+    }
+
+    /* store the multipliers -a(i,k)/a(k,k) in a(i,k), i=k+1, ..., last_row_k */
+    mult = -1.0f / (*diag_k);
+    for (i = k + 1, kptr = sub_diag_k; i <= last_row_k; i++, kptr++)
+    {
+      (*kptr) *= mult;
+    }
+
+    /* row_i = row_i - [a(i,k)/a(k,k)] row_k, one column j at a time */
+    last_col_k = SUNMIN(k + smu, n - 1);
+    for (j = k + 1; j <= last_col_k; j++)
+    {
+      col_j     = af + j * ldim;
+      storage_l = ROW(l, j, smu);
+      storage_k = ROW(k, j, smu);
+      a_kj      = col_j[storage_l];
+
+      /* Swap the elements a(k,j) and a(k,l) if l!=k. */
+      if (swap)
+      {
+        col_j[storage_l] = col_j[storage_k];
+        col_j[storage_k] = a_kj;
+      }
+
+      if (a_kj != 0.0f)
+      {
+        for (i = k + 1, kptr = sub_diag_k, jptr = col_j + ROW(k + 1, j, smu);
+             i <= last_row_k; i++, kptr++, jptr++)
+        {
+          (*jptr) += a_kj * (*kptr);
+        }
+      }
+    }
+  }
+
+  /* set the last pivot row to be n-1 and check for a zero pivot */
+  p[n - 1] = n - 1;
+  if (af[(n - 1) * ldim + smu] == 0.0f) { return (n); }
+
+  return (0);
+}
+
+/* Solve Ax = b with the float LU factors from bandGBTRF_Float, overwriting b
+ * with x */
+static void bandGBTRS_Float(const float* af, sunindextype n, sunindextype smu,
+                            sunindextype ml, sunindextype ldim,
+                            const sunindextype* p, float* b)
+{
+  sunindextype k, l, i, first_row_k, last_row_k;
+  const float* diag_k;
+  float mult;
+
+  /* Solve Ly = Pb, store solution y in b */
+  for (k = 0; k < n - 1; k++)
+  {
+    l    = p[k];
+    mult = b[l];
+    if (l != k)
+    {
+      b[l] = b[k];
+      b[k] = mult;
+    }
+    diag_k     = af + k * ldim + smu;
+    last_row_k = SUNMIN(n - 1, k + ml);
+    for (i = k + 1; i <= last_row_k; i++) { b[i] += mult * diag_k[i - k]; }
+  }
+
+  /* Solve Ux = y, store solution x in b */
+  for (k = n - 1; k >= 0; k--)
+  {
+    diag_k      = af + k * ldim + smu;
+    first_row_k = SUNMAX(0, k - smu);
+    b[k] /= (*diag_k);
+    mult = -b[k];
+    for (i = first_row_k; i <= k - 1; i++) { b[i] += mult * diag_k[i - k]; }
+  }
+}
+
+/* Solve Ax = b with the float factors of A followed by iterative refinement.
+ * The size of a correction d is measured componentwise relative to x as
+ * max_i |d_i| / (|x_i| + eps ||x||). Returns SUNLS_CONV_FAIL if the corrections
+ * stop decreasing while still above single precision level, i.e., the float
+ * factorization is too inaccurate for A, if a nonzero residual gives a zero
+ * correction, or if max_refine steps do not reach refine_tol. The right-hand
+ * sides of the float solves are scaled by their max norm, so that b and r can
+ * be represented in float whatever their magnitude. */
+static int bandSolveMixed(SUNLinearSolver S, SUNMatrix A, N_Vector x,
+                          N_Vector b)
+{
+  SUNFunctionBegin(S->sunctx);
+  SUNLinearSolverContent_Band content;
+  sunrealtype *xdata, *bdata, *rdata;
+  sunrealtype d, w, bnorm, rnorm, xnorm, dnorm, dmax, dnorm_old;
+  sunindextype i, N, smu, ml;
+  int iter;
+
+  content = BAND_CONTENT(S);
+  N       = content->N;
+  smu     = SM_SUBAND_B(A);
+  ml      = SM_LBAND_B(A);
+  SUNAssert(content->Af && content->bf, SUN_ERR_ARG_CORRUPT);
+
+  /* create the residual vector on first use */
+  if (!content->r)
+  {
+    content->r = N_VClone(b);
+    SUNCheckLastErr();
+  }
+
+  xdata = N_VGetArrayPointer(x);
+  SUNCheckLastErr();
+  bdata = N_VGetArrayPointer(b);
+  SUNCheckLastErr();
+  rdata = N_VGetArrayPointer(content->r);
+  SUNCheckLastErr();
+  SUNAssert(xdata && bdata && rdata, SUN_ERR_ARG_CORRUPT);
+
+  content->nsolves++;
+
+  /* initial solve in single precision with the scaled right-hand side */
+  bnorm = N_VMaxNorm(b);
+  SUNCheckLastErr();
+  if (bnorm == ZERO)
+  {
+    N_VConst(ZERO, x);
+    SUNCheckLastErr();
+    return SUN_SUCCESS;
+  }
+  for (i = 0; i < N; i++) { content->bf[i] = (float)(bdata[i] / bnorm); }
+  bandGBTRS_Float(content->Af, N, smu, ml, content->ldim, content->pivots,
+                  content->bf);
+  for (i = 0; i < N; i++) { xdata[i] = bnorm * (sunrealtype)content->bf[i]; }
+
+  dnorm_old = SUN_BIG_REAL;
+  for (iter = 0; iter < content->max_refine; iter++)
+  {
+    /* r = b - A x in working precision */
+    SUNCheckCall(SUNMatMatvec(A, x, content->r));
+    N_VLinearSum(ONE, b, -ONE, content->r, content->r);
+    SUNCheckLastErr();
+    rnorm = N_VMaxNorm(content->r);
+    SUNCheckLastErr();
+    if (rnorm == ZERO) { return SUN_SUCCESS; }
+    xnorm = N_VMaxNorm(x);
+    SUNCheckLastErr();
+
+    /* solve A d = r in single precision with the scaled residual and update
+       x = x + d */
+    for (i = 0; i < N; i++) { content->bf[i] = (float)(rdata[i] / rnorm); }
+    bandGBTRS_Float(content->Af, N, smu, ml, content->ldim, content->pivots,
+                    content->bf);
+    dnorm = ZERO;
+    dmax  = ZERO;
+    for (i = 0; i < N; i++)
+    {
+      d = rnorm * (sunrealtype)content->bf[i];
+      w = SUNRabs(xdata[i]) + SUN_UNIT_ROUNDOFF * xnorm;
+      if (w > ZERO) { dnorm = SUNMAX(dnorm, SUNRabs(d) / w); }
+      else if (d != ZERO) { dnorm = SUN_BIG_REAL; }
+      dmax = SUNMAX(dmax, SUNRabs(d));
+      xdata[i] += d;
+    }
+    content->nrefine++;
+
+    /* a zero correction cannot reduce the nonzero residual */
+    if (dmax == ZERO) { return SUNLS_CONV_FAIL; }
+
+    if (dnorm <= content->refine_tol) { return SUN_SUCCESS; }
+
+    /* stop once the corrections stagnate, which fails unless the attainable
+       accuracy has been reached */
+    if (dnorm > HALF * dnorm_old)
+    {
+      return (dnorm > STALL_TOL) ? SUNLS_CONV_FAIL : SUN_SUCCESS;
+    }
+    dnorm_old = dnorm;
+  }
+
+  return SUNLS_CONV_FAIL;
+}
@@ -0,0 +1,423 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2025-2026, Lawrence Livermore National Security,
+ * University of Maryland Baltimore County, and the SUNDIALS contributors.
+ * Copyright (c) 2013-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * Copyright (c) 2002-2013, Lawrence Livermore National Security.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * This is the implementation file for the block-diagonal dense
+ * implementation of the SUNLINSOL package.
+ *
+ * The blocks of a SUNMATRIX_BLOCKDENSE matrix are stored in groups
+ * of SUN_BLOCKDENSE_GROUP_SIZE interleaved blocks. The factorization
+ * and triangular solves below work on one group at a time and keep
+ * the innermost loop over the blocks (lanes) of the group, so the
+ * compiler can vectorize the elimination across blocks. Only the
+ * pivot search and row swaps, which differ between blocks, are done
+ * lane by lane.
+ * -----------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <sundials/priv/sundials_errors_impl.h>
+#include <sundials/sundials_errors.h>
+#include <sundials/sundials_math.h>
+#include <sunlinsol/sunlinsol_blockdense.h>
+
+#include "sundials_macros.h"
+
+#define ZERO SUN_RCONST(0.0)
+#define ONE  SUN_RCONST(1.0)
+
+#define GSIZE SUN_BLOCKDENSE_GROUP_SIZE
+
+/*
+ * -----------------------------------------------------------------
+ * Block-diagonal dense solver structure accessibility macros:
+ * -----------------------------------------------------------------
+ */
+
+#define BD_CONTENT(S) ((SUNLinearSolverContent_BlockDense)(S->content))
+#define PIVOTS(S)     (BD_CONTENT(S)->pivots)
+#define WORK(S)       (BD_CONTENT(S)->work)
+#define LASTFLAG(S)   (BD_CONTENT(S)->last_flag)
+
+/* Private function prototypes */
+static sunindextype groupGETRF(sunrealtype* a, sunindextype n, sunindextype nl,
+                               sunindextype* p);
+static void groupGETRS(const sunrealtype* a, sunindextype n,
+                       const sunindextype* p, sunrealtype* w);
+
+/*
+ * -----------------------------------------------------------------
+ * exported functions
+ * -----------------------------------------------------------------
+ */
+
+/* ----------------------------------------------------------------------------
+ * Function to create a new block-diagonal dense linear solver
+ */
+
+SUNLinearSolver SUNLinSol_BlockDense(SUNDIALS_MAYBE_UNUSED N_Vector y,
+                                     SUNMatrix A, SUNContext sunctx)
+{
+  SUNFunctionBegin(sunctx);
+  SUNLinearSolver S;
+  SUNLinearSolverContent_BlockDense content;
+  sunindextype N, ngroups;
+
+  SUNAssertNull(SUNMatGetID(A) == SUNMATRIX_BLOCKDENSE, SUN_ERR_ARG_WRONGTYPE);
+  SUNAssertNull(SUNMatrix_BlockDense_BlockRows(A) ==
+                  SUNMatrix_BlockDense_BlockColumns(A),
+                SUN_ERR_ARG_DIMSMISMATCH);
+  SUNAssertNull(y->ops->nvgetarraypointer, SUN_ERR_ARG_INCOMPATIBLE);
+  SUNAssertNull(SUNMatrix_BlockDense_Rows(A) == N_VGetLength(y),
+                SUN_ERR_ARG_DIMSMISMATCH);
+
+  N       = SUNMatrix_BlockDense_BlockRows(A);
+  ngroups = SM_NUMGROUPS_BD(A);
+
+  /* Create an empty linear solver */
+  S = NULL;
+  S = SUNLinSolNewEmpty(sunctx);
+  SUNCheckLastErrNull();
+
+  /* Attach operations */
+  S->ops->gettype    = SUNLinSolGetType_BlockDense;
+  S->ops->getid      = SUNLinSolGetID_BlockDense;
+  S->ops->initialize = SUNLinSolInitialize_BlockDense;
+  S->ops->setup      = SUNLinSolSetup_BlockDense;
+  S->ops->solve      = SUNLinSolSolve_BlockDense;
+  S->ops->lastflag   = SUNLinSolLastFlag_BlockDense;
+  S->ops->free       = SUNLinSolFree_BlockDense;
+
+  /* Create content */
+  content = NULL;
+  content = (SUNLinearSolverContent_BlockDense)malloc(sizeof *content);
+  SUNAssertNull(content, SUN_ERR_MALLOC_FAIL);
+
+  /* Attach content */
+  S->content = content;
+
+  /* Fill content */
+  content->N         = N;
+  content->nblocks   = SUNMatrix_BlockDense_NumBlocks(A);
+  content->ngroups   = ngroups;
+  content->last_flag = 0;
+  content->pivots    = NULL;
+  content->work      = NULL;
+
+  /* Allocate content */
+  content->pivots =
+    (sunindextype*)malloc(ngroups * GSIZE * N * sizeof(sunindextype));
+  SUNAssertNull(content->pivots, SUN_ERR_MALLOC_FAIL);
+
+  content->work = (sunrealtype*)malloc(ngroups * GSIZE * N * sizeof(sunrealtype));
+  SUNAssertNull(content->work, SUN_ERR_MALLOC_FAIL);
+
+  return (S);
+}
+
+/*
+ * -----------------------------------------------------------------
+ * implementation of linear solver operations
+ * -----------------------------------------------------------------
+ */
+
+SUNLinearSolver_Type SUNLinSolGetType_BlockDense(
+  SUNDIALS_MAYBE_UNUSED SUNLinearSolver S)
+{
+  return (SUNLINEARSOLVER_DIRECT);
+}
+
+SUNLinearSolver_ID SUNLinSolGetID_BlockDense(SUNDIALS_MAYBE_UNUSED SUNLinearSolver S)
+{
+  return (SUNLINEARSOLVER_BLOCKDENSE);
+}
+
+SUNErrCode SUNLinSolInitialize_BlockDense(SUNLinearSolver S)
+{
+  /* all solver-specific memory has already been allocated */
+  LASTFLAG(S) = SUN_SUCCESS;
+  return SUN_SUCCESS;
+}
+
+int SUNLinSolSetup_BlockDense(SUNLinearSolver S, SUNMatrix A)
+{
+  SUNFunctionBegin(S->sunctx);
+  sunindextype g, flag;
+  sunindextype* pivots;
+  const sunindextype N       = BD_CONTENT(S)->N;
+  const sunindextype nblocks = BD_CONTENT(S)->nblocks;
+  const sunindextype ngroups = BD_CONTENT(S)->ngroups;
+
+  SUNAssert(A, SUN_ERR_ARG_CORRUPT);
+  SUNAssert(SUNMatGetID(A) == SUNMATRIX_BLOCKDENSE, SUN_ERR_ARG_WRONGTYPE);
+  SUNAssert(SM_NUMBLOCKS_BD(A) == nblocks && SM_BLOCKROWS_BD(A) == N &&
+              SM_BLOCKCOLUMNS_BD(A) == N,
+            SUN_ERR_ARG_DIMSMISMATCH);
+
+  /* access data pointers (return with failure on NULL) */
+  pivots = PIVOTS(S);
+  SUNAssert(pivots, SUN_ERR_ARG_CORRUPT);
+  SUNAssert(SM_DATA_BD(A), SUN_ERR_ARG_CORRUPT);
+
+  /* factor every block group, keeping the first failing column (if any) */
+  flag = N + 1;
+#if defined(SUNDIALS_OPENMP_ENABLED)
+#pragma omp parallel for schedule(static) reduction(min : flag) if (ngroups > 1)
+#endif
+  for (g = 0; g < ngroups; g++)
+  {
+    sunindextype gflag = groupGETRF(SM_GROUP_BD(A, g), N,
+                                    SUNMIN(GSIZE, nblocks - g * GSIZE),
+                                    pivots + g * GSIZE * N);
+    if (gflag > 0 && gflag < flag) { flag = gflag; }
+  }
+
+  /* store error flag (if nonzero, this row encountered zero-valued pivot) */
+  LASTFLAG(S) = (flag > N) ? 0 : flag;
+  if (LASTFLAG(S) > 0) { return (SUNLS_LUFACT_FAIL); }
+  return SUN_SUCCESS;
+}
+
+int SUNLinSolSolve_BlockDense(SUNLinearSolver S, SUNMatrix A, N_Vector x,
+                              N_Vector b, SUNDIALS_MAYBE_UNUSED sunrealtype tol)
+{
+  SUNFunctionBegin(S->sunctx);
+  sunrealtype *xdata, *bdata, *work;
+  sunindextype* pivots;
+  sunindextype g;
+  const sunindextype N       = BD_CONTENT(S)->N;
+  const sunindextype nblocks = BD_CONTENT(S)->nblocks;
+  const sunindextype ngroups = BD_CONTENT(S)->ngroups;
+
+  /* access data pointers (return with failure on NULL) */
+  xdata = N_VGetArrayPointer(x);
+  SUNCheckLastErr();
+  bdata = N_VGetArrayPointer(b);
+  SUNCheckLastErr();
+  pivots = PIVOTS(S);
+  work   = WORK(S);
+
+  SUNAssert(SM_DATA_BD(A), SUN_ERR_ARG_CORRUPT);
+  SUNAssert(xdata, SUN_ERR_ARG_CORRUPT);
+  SUNAssert(bdata, SUN_ERR_ARG_CORRUPT);
+  SUNAssert(pivots, SUN_ERR_ARG_CORRUPT);
+  SUNAssert(work, SUN_ERR_ARG_CORRUPT);
+
+  /* solve using the LU factors of each block group */
+#if defined(SUNDIALS_OPENMP_ENABLED)
+#pragma omp parallel for schedule(static) if (ngroups > 1)
+#endif
+  for (g = 0; g < ngroups; g++)
+  {
+    const sunindextype k0 = g * GSIZE;
+    const sunindextype nl = SUNMIN(GSIZE, nblocks - k0);
+    sunrealtype* w        = work + k0 * N;
+    sunindextype i, l;
+
+    /* gather b into the interleaved layout (padding lanes solve with 0) */
+    for (i = 0; i < N; i++)
+    {
+      for (l = 0; l < nl; l++) { w[i * GSIZE + l] = bdata[(k0 + l) * N + i]; }
+      for (l = nl; l < GSIZE; l++) { w[i * GSIZE + l] = ZERO; }
+    }
+
+    groupGETRS(SM_GROUP_BD(A, g), N, pivots + k0 * N, w);
+
+    /* scatter the solution back into x */
+    for (i = 0; i < N; i++)
+    {
+      for (l = 0; l < nl; l++) { xdata[(k0 + l) * N + i] = w[i * GSIZE + l]; }
+    }
+  }
+
+  LASTFLAG(S) = SUN_SUCCESS;
+  return SUN_SUCCESS;
+}
+
+sunindextype SUNLinSolLastFlag_BlockDense(SUNLinearSolver S)
+{
+  /* return the stored 'last_flag' value */
+  return (LASTFLAG(S));
+}
+
+SUNErrCode SUNLinSolFree_BlockDense(SUNLinearSolver S)
+{
+  /* return if S is already free */
+  if (S == NULL) { return SUN_SUCCESS; }
+
+  /* delete items from contents, then delete generic structure */
+  if (S->content)
+  {
+    if (PIVOTS(S))
+    {
+      free(PIVOTS(S));
+      PIVOTS(S) = NULL;
+    }
+    if (WORK(S))
+    {
+      free(WORK(S));
+      WORK(S) = NULL;
+    }
+    free(S->content);
+    S->content = NULL;
+  }
+  if (S->ops)
+  {
+    free(S->ops);
+    S->ops = NULL;
+  }
+  free(S);
+  S = NULL;
+  return SUN_SUCCESS;
+}
+
+/*
+ * -----------------------------------------------------------------
+ * private functions
+ * -----------------------------------------------------------------
+ */
+
+/* ----------------------------------------------------------------------------
+ * LU factorization with partial pivoting of the n by n blocks in a block
+ * group. Entry (i,j) of lane l is a[(j*n + i)*GSIZE + l] and the pivot row for
+ * column k of lane l is stored in p[k*GSIZE + l]. Lanes nl, ..., GSIZE-1 are
+ * padding and are reset to the identity so they cannot fail. Returns 0 on
+ * success or k+1 if column k of an active lane has a zero pivot.
+ */
+
+static sunindextype groupGETRF(sunrealtype* a, sunindextype n, sunindextype nl,
+                               sunindextype* p)
+{
+  sunindextype i, j, k, l;
+  sunrealtype mult[GSIZE];
+
+  for (l = nl; l < GSIZE; l++)
+  {
+    for (j = 0; j < n; j++)
+    {
+      for (i = 0; i < n; i++)
+      {
+        a[(j * n + i) * GSIZE + l] = (i == j) ? ONE : ZERO;
+      }
+    }
+  }
+
+  for (k = 0; k < n; k++)
+  {
+    sunrealtype* col_k = a + k * n * GSIZE;
+
+    /* find and apply the pivot of each lane */
+    for (l = 0; l < GSIZE; l++)
+    {
+      sunindextype piv = k;
+      for (i = k + 1; i < n; i++)
+      {
+        if (SUNRabs(col_k[i * GSIZE + l]) > SUNRabs(col_k[piv * GSIZE + l]))
+        {
+          piv = i;
+        }
+      }
+      p[k * GSIZE + l] = piv;
+
+      if (col_k[piv * GSIZE + l] == ZERO) { return (k + 1); }
+
+      if (piv != k)
+      {
+        for (j = 0; j < n; j++)
+        {
+          sunrealtype* col_j     = a + j * n * GSIZE;
+          sunrealtype temp       = col_j[piv * GSIZE + l];
+          col_j[piv * GSIZE + l] = col_j[k * GSIZE + l];
+          col_j[k * GSIZE + l]   = temp;
+        }
+      }
+    }
+
+    /* scale the subdiagonal of column k */
+    for (l = 0; l < GSIZE; l++) { mult[l] = ONE / col_k[k * GSIZE + l]; }
+    for (i = k + 1; i < n; i++)
+    {
+      for (l = 0; l < GSIZE; l++) { col_k[i * GSIZE + l] *= mult[l]; }
+    }
+
+    /* update the trailing submatrix */
+    for (j = k + 1; j < n; j++)
+    {
+      sunrealtype* col_j = a + j * n * GSIZE;
+      for (i = k + 1; i < n; i++)
+      {
+        for (l = 0; l < GSIZE; l++)
+        {
+          col_j[i * GSIZE + l] -= col_j[k * GSIZE + l] * col_k[i * GSIZE + l];
+        }
+      }
+    }
+  }
+
+  return (0);
+}
+
+/* ----------------------------------------------------------------------------
+ * Solve with the LU factors computed by groupGETRF. The right-hand sides are
+ * interleaved in w, i.e., entry i of lane l is w[i*GSIZE + l], and are
+ * overwritten with the solutions.
+ */
+
+static void groupGETRS(const sunrealtype* a, sunindextype n,
+                       const sunindextype* p, sunrealtype* w)
+{
+  sunindextype i, k, l;
+
+  /* permute the right-hand sides */
+  for (k = 0; k < n; k++)
+  {
+    for (l = 0; l < GSIZE; l++)
+    {
+      sunindextype piv = p[k * GSIZE + l];
+      if (piv != k)
+      {
+        sunrealtype temp   = w[k * GSIZE + l];
+        w[k * GSIZE + l]   = w[piv * GSIZE + l];
+        w[piv * GSIZE + l] = temp;
+      }
+    }
+  }
+
+  /* solve Ly = b, L has a unit diagonal */
+  for (k = 0; k < n - 1; k++)
+  {
+    const sunrealtype* col_k = a + k * n * GSIZE;
+    for (i = k + 1; i < n; i++)
+    {
+      for (l = 0; l < GSIZE; l++)
+      {
+        w[i * GSIZE + l] -= col_k[i * GSIZE + l] * w[k * GSIZE + l];
+      }
+    }
+  }
+
+  /* solve Ux = y */
+  for (k = n - 1; k >= 0; k--)
+  {
+    const sunrealtype* col_k = a + k * n * GSIZE;
+    for (l = 0; l < GSIZE; l++) { w[k * GSIZE + l] /= col_k[k * GSIZE + l]; }
+    for (i = 0; i < k; i++)
+    {
+      for (l = 0; l < GSIZE; l++)
+      {
+        w[i * GSIZE + l] -= col_k[i * GSIZE + l] * w[k * GSIZE + l];
+      }
+    }
+  }
+}
@@ -37,6 +37,9 @@ module fsunlinsol_dense_mod
  public :: FSUNLinSolLastFlag_Dense
  public :: FSUNLinSolSpace_Dense
  public :: FSUNLinSolFree_Dense
+ public :: FSUNLinSol_DenseSetMixedPrecision
+ public :: FSUNLinSol_DenseSetNumThreads
+ public :: FSUNLinSol_DenseGetRefinementStats
 
 ! WRAPPER DECLARATIONS
 interface
@@ -121,6 +124,37 @@ type(C_PTR), value :: farg1
 integer(C_INT) :: fresult
 end function
 
+function swigc_FSUNLinSol_DenseSetMixedPrecision(farg1, farg2, farg3, farg4) &
+bind(C, name="_wrap_FSUNLinSol_DenseSetMixedPrecision") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+integer(C_INT), intent(in) :: farg3
+real(C_DOUBLE), intent(in) :: farg4
+integer(C_INT) :: fresult
+end function
+
+function swigc_FSUNLinSol_DenseSetNumThreads(farg1, farg2) &
+bind(C, name="_wrap_FSUNLinSol_DenseSetNumThreads") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+integer(C_INT) :: fresult
+end function
+
+function swigc_FSUNLinSol_DenseGetRefinementStats(farg1, farg2, farg3, farg4) &
+bind(C, name="_wrap_FSUNLinSol_DenseGetRefinementStats") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+type(C_PTR), value :: farg2
+type(C_PTR), value :: farg3
+type(C_PTR), value :: farg4
+integer(C_INT) :: fresult
+end function
+
 end interface
 
 
@@ -270,5 +304,65 @@ fresult = swigc_FSUNLinSolFree_Dense(farg1)
 swig_result = fresult
 end function
 
+function FSUNLinSol_DenseSetMixedPrecision(s, onoff, max_refine, refine_tol) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(SUNLinearSolver), target, intent(inout) :: s
+integer(C_INT), intent(in) :: onoff
+integer(C_INT), intent(in) :: max_refine
+real(C_DOUBLE), intent(in) :: refine_tol
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+integer(C_INT) :: farg3 
+real(C_DOUBLE) :: farg4 
+
+farg1 = c_loc(s)
+farg2 = onoff
+farg3 = max_refine
+farg4 = refine_tol
+fresult = swigc_FSUNLinSol_DenseSetMixedPrecision(farg1, farg2, farg3, farg4)
+swig_result = fresult
+end function
+
+function FSUNLinSol_DenseSetNumThreads(s, nthreads) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(SUNLinearSolver), target, intent(inout) :: s
+integer(C_INT), intent(in) :: nthreads
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+
+farg1 = c_loc(s)
+farg2 = nthreads
+fresult = swigc_FSUNLinSol_DenseSetNumThreads(farg1, farg2)
+swig_result = fresult
+end function
+
+function FSUNLinSol_DenseGetRefinementStats(s, nsolves, nrefine, nfallbacks) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(SUNLinearSolver), target, intent(inout) :: s
+integer(C_LONG), dimension(*), target, intent(inout) :: nsolves
+integer(C_LONG), dimension(*), target, intent(inout) :: nrefine
+integer(C_LONG), dimension(*), target, intent(inout) :: nfallbacks
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+type(C_PTR) :: farg2 
+type(C_PTR) :: farg3 
+type(C_PTR) :: farg4 
+
+farg1 = c_loc(s)
+farg2 = c_loc(nsolves(1))
+farg3 = c_loc(nrefine(1))
+farg4 = c_loc(nfallbacks(1))
+fresult = swigc_FSUNLinSol_DenseGetRefinementStats(farg1, farg2, farg3, farg4)
+swig_result = fresult
+end function
+
 
 end module
@@ -337,4 +337,54 @@ SWIGEXPORT int _wrap_FSUNLinSolFree_Dense(SUNLinearSolver farg1) {
 }
 
 
+SWIGEXPORT int _wrap_FSUNLinSol_DenseSetMixedPrecision(SUNLinearSolver farg1, int const *farg2, int const *farg3, double const *farg4) {
+  int fresult ;
+  SUNLinearSolver arg1 = (SUNLinearSolver) 0 ;
+  int arg2 ;
+  int arg3 ;
+  sunrealtype arg4 ;
+  SUNErrCode result;
+  
+  arg1 = (SUNLinearSolver)(farg1);
+  arg2 = (int)(*farg2);
+  arg3 = (int)(*farg3);
+  arg4 = (sunrealtype)(*farg4);
+  result = (SUNErrCode)SUNLinSol_DenseSetMixedPrecision(arg1,arg2,arg3,arg4);
+  fresult = (SUNErrCode)(result);
+  return fresult;
+}
+
+
+SWIGEXPORT int _wrap_FSUNLinSol_DenseSetNumThreads(SUNLinearSolver farg1, int const *farg2) {
+  int fresult ;
+  SUNLinearSolver arg1 = (SUNLinearSolver) 0 ;
+  int arg2 ;
+  SUNErrCode result;
+  
+  arg1 = (SUNLinearSolver)(farg1);
+  arg2 = (int)(*farg2);
+  result = (SUNErrCode)SUNLinSol_DenseSetNumThreads(arg1,arg2);
+  fresult = (SUNErrCode)(result);
+  return fresult;
+}
+
+
+SWIGEXPORT int _wrap_FSUNLinSol_DenseGetRefinementStats(SUNLinearSolver farg1, long *farg2, long *farg3, long *farg4) {
+  int fresult ;
+  SUNLinearSolver arg1 = (SUNLinearSolver) 0 ;
+  long *arg2 = (long *) 0 ;
+  long *arg3 = (long *) 0 ;
+  long *arg4 = (long *) 0 ;
+  SUNErrCode result;
+  
+  arg1 = (SUNLinearSolver)(farg1);
+  arg2 = (long *)(farg2);
+  arg3 = (long *)(farg3);
+  arg4 = (long *)(farg4);
+  result = (SUNErrCode)SUNLinSol_DenseGetRefinementStats(arg1,arg2,arg3,arg4);
+  fresult = (SUNErrCode)(result);
+  return fresult;
+}
+
+
 
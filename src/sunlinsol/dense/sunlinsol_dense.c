@@ -18,6 +18,7 @@
  * the SUNLINSOL package.
  * -----------------------------------------------------------------*/
 
+#include <float.h>
 #include <stdio.h>
 #include <stdlib.h>
 
@@ -29,7 +30,17 @@
 #include "sundials_logger_impl.h"
 #include "sundials_macros.h"
 
-#define ONE SUN_RCONST(1.0)
+#define ZERO SUN_RCONST(0.0)
+#define HALF SUN_RCONST(0.5)
+#define ONE  SUN_RCONST(1.0)
+
+/* mixed precision refinement defaults: maximum number of steps and relative
+   tolerance on the correction */
+#define MAX_REFINE_DEFAULT 10
+#define REFINE_TOL_DEFAULT (SUN_RCONST(10.0) * SUN_UNIT_ROUNDOFF)
+
+/* corrections that stagnate above this size indicate a failed refinement */
+#define STALL_TOL SUNRsqrt(FLT_EPSILON)
 
 /*
  * -----------------------------------------------------------------
@@ -41,6 +52,19 @@
 #define PIVOTS(S)        (DENSE_CONTENT(S)->pivots)
 #define LASTFLAG(S)      (DENSE_CONTENT(S)->last_flag)
 
+/*
+ * -----------------------------------------------------------------
+ * private function prototypes
+ * -----------------------------------------------------------------
+ */
+
+static sunindextype denseGETRF_Float(sunrealtype** a, sunindextype n, float* af,
+                                     sunindextype* p);
+static void denseGETRS_Float(const float* af, sunindextype n,
+                             const sunindextype* p, float* b);
+static int denseSolveMixed(SUNLinearSolver S, SUNMatrix A, N_Vector x,
+                           N_Vector b);
+
 /*
  * -----------------------------------------------------------------
  * exported functions
@@ -91,9 +115,20 @@ SUNLinearSolver SUNLinSol_Dense(SUNDIALS_MAYBE_UNUSED N_Vector y, SUNMatrix A,
   S->content = content;
 
   /* Fill content */
-  content->N         = MatrixRows;
-  content->last_flag = 0;
-  content->pivots    = NULL;
+  content->N          = MatrixRows;
+  content->last_flag  = 0;
+  content->pivots     = NULL;
+  content->nthreads   = 1;
+  content->mixed      = SUNFALSE;
+  content->fallback   = SUNFALSE;
+  content->max_refine = MAX_REFINE_DEFAULT;
+  content->refine_tol = REFINE_TOL_DEFAULT;
+  content->Af         = NULL;
+  content->bf         = NULL;
+  content->r          = NULL;
+  content->nsolves    = 0;
+  content->nrefine    = 0;
+  content->nfallbacks = 0;
 
   /* Allocate content */
   content->pivots = (sunindextype*)malloc(MatrixRows * sizeof(sunindextype));
@@ -142,9 +177,24 @@ int SUNLinSolSetup_Dense(SUNLinearSolver S, SUNMatrix A)
   SUNAssert(pivots, SUN_ERR_ARG_CORRUPT);
   SUNAssert(A_cols, SUN_ERR_ARG_CORRUPT);
 
+  /* in mixed precision mode the factors of a float copy are computed and A is
+     left unchanged, if this fails A is factored in working precision */
+  if (DENSE_CONTENT(S)->mixed)
+  {
+    DENSE_CONTENT(S)->fallback = SUNFALSE;
+
+    LASTFLAG(S) = denseGETRF_Float(A_cols, SUNDenseMatrix_Rows(A),
+                                   DENSE_CONTENT(S)->Af, pivots);
+    if (LASTFLAG(S) == 0) { return SUN_SUCCESS; }
+
+    DENSE_CONTENT(S)->fallback = SUNTRUE;
+    DENSE_CONTENT(S)->nfallbacks++;
+  }
+
   /* perform LU factorization of input matrix */
-  LASTFLAG(S) = SUNDlsMat_denseGETRF(A_cols, SUNDenseMatrix_Rows(A),
-                                     SUNDenseMatrix_Columns(A), pivots);
+  LASTFLAG(S) = SUNDlsMat_denseGETRF_Threaded(A_cols, SUNDenseMatrix_Rows(A),
+                                              SUNDenseMatrix_Columns(A), pivots,
+                                              DENSE_CONTENT(S)->nthreads);
 
   /* store error flag (if nonzero, this row encountered zero-valued pivod) */
   if (LASTFLAG(S) > 0) { return (SUNLS_LUFACT_FAIL); }
@@ -157,6 +207,30 @@ int SUNLinSolSolve_Dense(SUNLinearSolver S, SUNMatrix A, N_Vector x, N_Vector b,
   SUNFunctionBegin(S->sunctx);
   sunrealtype **A_cols, *xdata;
   sunindextype* pivots;
+  int retval;
+
+  /* solve with the float factors and refine in working precision, if the
+     refinement fails A is factored in working precision and these factors are
+     used until the next setup */
+  if (DENSE_CONTENT(S)->mixed && !DENSE_CONTENT(S)->fallback)
+  {
+    retval = denseSolveMixed(S, A, x, b);
+    if (retval != SUNLS_CONV_FAIL)
+    {
+      LASTFLAG(S) = retval;
+      return retval;
+    }
+
+    DENSE_CONTENT(S)->fallback = SUNTRUE;
+    DENSE_CONTENT(S)->nfallbacks++;
+
+    LASTFLAG(S) = SUNDlsMat_denseGETRF_Threaded(SUNDenseMatrix_Cols(A),
+                                                SUNDenseMatrix_Rows(A),
+                                                SUNDenseMatrix_Columns(A),
+                                                PIVOTS(S),
+                                                DENSE_CONTENT(S)->nthreads);
+    if (LASTFLAG(S) > 0) { return (SUNLS_LUFACT_FAIL); }
+  }
 
   /* copy b into x */
   N_VScale(ONE, b, x);
@@ -192,9 +266,13 @@ SUNErrCode SUNLinSolSpace_Dense(SUNLinearSolver S, long int* lenrwLS,
                                 long int* leniwLS)
 {
   SUNFunctionBegin(S->sunctx);
+  long int N;
   SUNAssert(SUNLinSolGetID(S) == SUNLINEARSOLVER_DENSE, SUN_ERR_ARG_WRONGTYPE);
-  *leniwLS = 2 + DENSE_CONTENT(S)->N;
+  N        = DENSE_CONTENT(S)->N;
+  *leniwLS = 2 + N;
   *lenrwLS = 0;
+  /* mixed precision storage, float values are counted as half a real */
+  if (DENSE_CONTENT(S)->mixed) { *lenrwLS = (N * N + N) / 2 + N; }
   return SUN_SUCCESS;
 }
 
@@ -211,6 +289,21 @@ SUNErrCode SUNLinSolFree_Dense(SUNLinearSolver S)
       free(PIVOTS(S));
       PIVOTS(S) = NULL;
     }
+    if (DENSE_CONTENT(S)->Af)
+    {
+      free(DENSE_CONTENT(S)->Af);
+      DENSE_CONTENT(S)->Af = NULL;
+    }
+    if (DENSE_CONTENT(S)->bf)
+    {
+      free(DENSE_CONTENT(S)->bf);
+      DENSE_CONTENT(S)->bf = NULL;
+    }
+    if (DENSE_CONTENT(S)->r)
+    {
+      N_VDestroy(DENSE_CONTENT(S)->r);
+      DENSE_CONTENT(S)->r = NULL;
+    }
     free(S->content);
     S->content = NULL;
   }
@@ -223,3 +316,296 @@ SUNErrCode SUNLinSolFree_Dense(SUNLinearSolver S)
   S = NULL;
   return SUN_SUCCESS;
 }
+
+/* ----------------------------------------------------------------------------
+ * Function to enable or disable the mixed precision mode: Setup factors a
+ * float copy of the matrix (leaving A unchanged) and Solve applies up to
+ * max_refine steps of iterative refinement with residuals computed by
+ * SUNMatMatvec in working precision. Refinement stops once every component of
+ * the correction is at most refine_tol times the corresponding solution
+ * component, or when the corrections stop decreasing. Non-positive values
+ * select the defaults (10 steps and 10 times the unit roundoff). If the float
+ * factorization fails or refinement does not converge, A is factored in working
+ * precision and used until the next Setup.
+ */
+
+SUNErrCode SUNLinSol_DenseSetMixedPrecision(SUNLinearSolver S,
+                                            sunbooleantype onoff,
+                                            int max_refine,
+                                            sunrealtype refine_tol)
+{
+  SUNFunctionBegin(S->sunctx);
+  SUNLinearSolverContent_Dense content;
+
+  SUNAssert(SUNLinSolGetID(S) == SUNLINEARSOLVER_DENSE, SUN_ERR_ARG_WRONGTYPE);
+  content = DENSE_CONTENT(S);
+
+  /* allocate the float factors and work vector on first use */
+  if (onoff && !content->Af)
+  {
+    content->Af = (float*)malloc((size_t)content->N * (size_t)content->N *
+                                 sizeof(float));
+    SUNAssert(content->Af, SUN_ERR_MALLOC_FAIL);
+  }
+  if (onoff && !content->bf)
+  {
+    content->bf = (float*)malloc((size_t)content->N * sizeof(float));
+    SUNAssert(content->bf, SUN_ERR_MALLOC_FAIL);
+  }
+
+  content->mixed      = onoff;
+  content->max_refine = (max_refine > 0) ? max_refine : MAX_REFINE_DEFAULT;
+  content->refine_tol = (refine_tol > ZERO) ? refine_tol : REFINE_TOL_DEFAULT;
+
+  return SUN_SUCCESS;
+}
+
+/* ----------------------------------------------------------------------------
+ * Function to set the number of OpenMP threads used by the working precision LU
+ * factorization of large matrices (the default is 1). The value is ignored when
+ * SUNDIALS is built without OpenMP.
+ */
+
+SUNErrCode SUNLinSol_DenseSetNumThreads(SUNLinearSolver S, int nthreads)
+{
+  SUNFunctionBegin(S->sunctx);
+  SUNAssert(SUNLinSolGetID(S) == SUNLINEARSOLVER_DENSE, SUN_ERR_ARG_WRONGTYPE);
+  SUNAssert(nthreads > 0, SUN_ERR_ARG_OUTOFRANGE);
+
+  DENSE_CONTENT(S)->nthreads = nthreads;
+
+  return SUN_SUCCESS;
+}
+
+/* ----------------------------------------------------------------------------
+ * Function to get the mixed precision solve counters
+ */
+
+SUNErrCode SUNLinSol_DenseGetRefinementStats(SUNLinearSolver S,
+                                             long int* nsolves,
+                                             long int* nrefine,
+                                             long int* nfallbacks)
+{
+  SUNFunctionBegin(S->sunctx);
+  SUNAssert(SUNLinSolGetID(S) == SUNLINEARSOLVER_DENSE, SUN_ERR_ARG_WRONGTYPE);
+  SUNAssert(nsolves, SUN_ERR_ARG_CORRUPT);
+  SUNAssert(nrefine, SUN_ERR_ARG_CORRUPT);
+  SUNAssert(nfallbacks, SUN_ERR_ARG_CORRUPT);
+
+  *nsolves    = DENSE_CONTENT(S)->nsolves;
+  *nrefine    = DENSE_CONTENT(S)->nrefine;
+  *nfallbacks = DENSE_CONTENT(S)->nfallbacks;
+
+  return SUN_SUCCESS;
+}
+
+/*
+ * -----------------------------------------------------------------
+ * private functions
+ * -----------------------------------------------------------------
+ */
+
+/* Copy the n by n matrix a to the column-major float array af and compute its
+ * LU factorization with partial pivoting in place. The row interchanges are
+ * applied to entire rows, so the pivots are applied to b in order in
+ * denseGETRS_Float. Returns k > 0 if a(k-1,k-1) is a zero pivot or a value in
+ * column k-1 does not fit in a float. */
+static sunindextype denseGETRF_Float(sunrealtype** a, sunindextype n,
+                                     float* af, sunindextype* p)
+{
+  sunindextype i, j, k, l;
+  float *col_j, *col_k;
+  float temp, mult, a_kj;
+
+  for (j = 0; j < n; j++)
+  {
+    col_j = af + j * n;
+    for (i = 0; i < n; i++)
+    {
+      if (SUNRabs(a[j][i]) > FLT_MAX) { return (j + 1); }
+      col_j[i] = (float)a[j][i];
+    }
+  }
+
+  /* k-th elimination step number */
+  for (k = 0; k < n; k++)
+  {
+    col_k = af + k * n;
+
+    /* find l = pivot row number */
+    l = k;
+    for (i = k + 1; i < n; i++)
+    {
+      if (SUNRabs(col_k[i]) > SUNRabs(col_k[l])) { l = i; }
+    }
+    p[k] = l;
+
+    /* check for zero pivot element */
+    if (col_k[l] == 0.0f) { return (k + 1); }
+
+    /* swap rows k and l if necessary */
+    if (l != k)
+    {
+      for (j = 0; j < n; j++)
+      {
+        col_j    = af + j * n;
+        temp     = col_j[l];
+        col_j[l] = col_j[k];
+        col_j[k] = temp;
+      }
+    }
+
+    /* store the multipliers a(i,k)/a(k,k) in a(i,k), i=k+1, ..., n-1 */
+    mult = 1.0f / col_k[k];
+    for (i = k + 1; i < n; i++) { col_k[i] *= mult; }
+
+    /* a(i,j) = a(i,j) - [a(i,k)/a(k,k)]*a(k,j), j=k+1, ..., n-1 */
+    for (j = k + 1; j < n; j++)
+    {
+      col_j = af + j * n;
+      a_kj  = col_j[k];
+      if (a_kj != 0.0f)
+      {
+        for (i = k + 1; i < n; i++) { col_j[i] -= a_kj * col_k[i]; }
+      }
+    }
+  }
+
+  return (0);
+}
+
+/* Solve Ax = b with the float LU factors from denseGETRF_Float, overwriting b
+ * with x */
+static void denseGETRS_Float(const float* af, sunindextype n,
+                             const sunindextype* p, float* b)
+{
+  sunindextype i, k, pk;
+  const float* col_k;
+  float tmp;
+
+  /* Permute b, based on pivot information in p */
+  for (k = 0; k < n; k++)
+  {
+    pk = p[k];
+    if (pk != k)
+    {
+      tmp   = b[k];
+      b[k]  = b[pk];
+      b[pk] = tmp;
+    }
+  }
+
+  /* Solve Ly = b, store solution y in b */
+  for (k = 0; k < n - 1; k++)
+  {
+    col_k = af + k * n;
+    for (i = k + 1; i < n; i++) { b[i] -= col_k[i] * b[k]; }
+  }
+
+  /* Solve Ux = y, store solution x in b */
+  for (k = n - 1; k >= 0; k--)
+  {
+    col_k = af + k * n;
+    b[k] /= col_k[k];
+    for (i = 0; i < k; i++) { b[i] -= col_k[i] * b[k]; }
+  }
+}
+
+/* Solve Ax = b with the float factors of A followed by iterative refinement.
+ * The size of a correction d is measured componentwise relative to x as
+ * max_i |d_i| / (|x_i| + eps ||x||). Returns SUNLS_CONV_FAIL if the corrections
+ * stop decreasing while still above single precision level, i.e., the float
+ * factorization is too inaccurate for A, if a nonzero residual gives a zero
+ * correction, or if max_refine steps do not reach refine_tol. The right-hand
+ * sides of the float solves are scaled by their max norm, so that b and r can
+ * be represented in float whatever their magnitude. */
+static int denseSolveMixed(SUNLinearSolver S, SUNMatrix A, N_Vector x,
+                           N_Vector b)
+{
+  SUNFunctionBegin(S->sunctx);
+  SUNLinearSolverContent_Dense content;
+  sunrealtype *xdata, *bdata, *rdata;
+  sunrealtype d, w, bnorm, rnorm, xnorm, dnorm, dmax, dnorm_old;
+  sunindextype i, N;
+  int iter;
+
+  content = DENSE_CONTENT(S);
+  N       = content->N;
+  SUNAssert(content->Af && content->bf, SUN_ERR_ARG_CORRUPT);
+
+  /* create the residual vector on first use */
+  if (!content->r)
+  {
+    content->r = N_VClone(b);
+    SUNCheckLastErr();
+  }
+
+  xdata = N_VGetArrayPointer(x);
+  SUNCheckLastErr();
+  bdata = N_VGetArrayPointer(b);
+  SUNCheckLastErr();
+  rdata = N_VGetArrayPointer(content->r);
+  SUNCheckLastErr();
+  SUNAssert(xdata && bdata && rdata, SUN_ERR_ARG_CORRUPT);
+
+  content->nsolves++;
+
+  /* initial solve in single precision with the scaled right-hand side */
+  bnorm = N_VMaxNorm(b);
+  SUNCheckLastErr();
+  if (bnorm == ZERO)
+  {
+    N_VConst(ZERO, x);
+    SUNCheckLastErr();
+    return SUN_SUCCESS;
+  }
+  for (i = 0; i < N; i++) { content->bf[i] = (float)(bdata[i] / bnorm); }
+  denseGETRS_Float(content->Af, N, content->pivots, content->bf);
+  for (i = 0; i < N; i++) { xdata[i] = bnorm * (sunrealtype)content->bf[i]; }
+
+  dnorm_old = SUN_BIG_REAL;
+  for (iter = 0; iter < content->max_refine; iter++)
+  {
+    /* r = b - A x in working precision */
+    SUNCheckCall(SUNMatMatvec(A, x, content->r));
+    N_VLinearSum(ONE, b, -ONE, content->r, content->r);
+    SUNCheckLastErr();
+    rnorm = N_VMaxNorm(content->r);
+    SUNCheckLastErr();
+    if (rnorm == ZERO) { return SUN_SUCCESS; }
+    xnorm = N_VMaxNorm(x);
+    SUNCheckLastErr();
+
+    /* solve A d = r in single precision with the scaled residual and update
+       x = x + d */
+    for (i = 0; i < N; i++) { content->bf[i] = (float)(rdata[i] / rnorm); }
+    denseGETRS_Float(content->Af, N, content->pivots, content->bf);
+    dnorm = ZERO;
+    dmax  = ZERO;
+    for (i = 0; i < N; i++)
+    {
+      d = rnorm * (sunrealtype)content->bf[i];
+      w = SUNRabs(xdata[i]) + SUN_UNIT_ROUNDOFF * xnorm;
+      if (w > ZERO) { dnorm = SUNMAX(dnorm, SUNRabs(d) / w); }
+      else if (d != ZERO) { dnorm = SUN_BIG_REAL; }
+      dmax = SUNMAX(dmax, SUNRabs(d));
+      xdata[i] += d;
+    }
+    content->nrefine++;
+
+    /* a zero correction cannot reduce the nonzero residual */
+    if (dmax == ZERO) { return SUNLS_CONV_FAIL; }
+
+    if (dnorm <= content->refine_tol) { return SUN_SUCCESS; }
+
+    /* stop once the corrections stagnate, which fails unless the attainable
+       accuracy has been reached */
+    if (dnorm > HALF * dnorm_old)
+    {
+      return (dnorm > STALL_TOL) ? SUNLS_CONV_FAIL : SUN_SUCCESS;
+    }
+    dnorm_old = dnorm;
+  }
+
+  return SUNLS_CONV_FAIL;
+}
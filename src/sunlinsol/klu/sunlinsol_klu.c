@@ -31,9 +31,14 @@
 
 #include "sundials_cli.h"
 #include "sundials_macros.h"
+#include "sundials_utils.h"
 
-#define ONE       SUN_RCONST(1.0)
-#define TWOTHIRDS SUN_RCONST(0.666666666666666666666666666666667)
+#define ZERO SUN_RCONST(0.0)
+#define ONE  SUN_RCONST(1.0)
+
+/* FNV-1a parameters for the sparsity pattern fingerprint */
+#define FNV_OFFSET_BASIS UINT64_C(14695981039346656037)
+#define FNV_PRIME        UINT64_C(1099511628211)
 
 /*
  * -----------------------------------------------------------------
@@ -48,6 +53,10 @@
 #define NUMERIC(S)        (KLU_CONTENT(S)->numeric)
 #define COMMON(S)         (KLU_CONTENT(S)->common)
 #define SOLVE(S)          (KLU_CONTENT(S)->klu_solver)
+#define PATTERNHASH(S)    (KLU_CONTENT(S)->pattern_hash)
+#define PATTERNORDER(S)   (KLU_CONTENT(S)->pattern_ordering)
+#define PIVOTTOL(S)       (KLU_CONTENT(S)->pivot_growth_tol)
+#define RCONDFACTOR(S)    (KLU_CONTENT(S)->rcond_factor)
 
 /*
  * ----------------------------------------------------------------------------
@@ -58,6 +67,12 @@
 static SUNErrCode setFromCommandLine_KLU(SUNLinearSolver S, const char* LSid,
                                          int argc, char* argv[]);
 
+static uint64_t patternHash_KLU(SUNMatrix A);
+static sunbooleantype samePattern_KLU(SUNLinearSolver S, SUNMatrix A,
+                                      uint64_t hash);
+static int savePattern_KLU(SUNLinearSolver S, SUNMatrix A, uint64_t hash);
+static int factor_KLU(SUNLinearSolver S, SUNMatrix A);
+
 SUNErrCode SUNLinSolSetOptions_KLU(SUNLinearSolver S, const char* LSid,
                                    const char* file_name, int argc, char* argv[]);
 
@@ -120,10 +135,25 @@ SUNLinearSolver SUNLinSol_KLU(N_Vector y, SUNMatrix A, SUNContext sunctx)
   S->content = content;
 
   /* Fill content */
-  content->last_flag       = 0;
-  content->first_factorize = 1;
-  content->symbolic        = NULL;
-  content->numeric         = NULL;
+  content->last_flag        = 0;
+  content->first_factorize  = 1;
+  content->symbolic         = NULL;
+  content->numeric          = NULL;
+  content->pattern_hash     = 0;
+  content->pattern_np       = -1;
+  content->pattern_ptrs     = NULL;
+  content->pattern_vals     = NULL;
+  content->pattern_ordering = SUNKLU_ORDERING_DEFAULT;
+  content->pivot_growth_tol = SUNKLU_PIVOT_GROWTH_DEFAULT;
+  content->rcond_factor     = ZERO;
+  content->nanalyze         = 0;
+  content->nfactor          = 0;
+  content->nrefactor        = 0;
+  content->nsolve           = 0;
+  content->t_analyze        = 0.0;
+  content->t_factor         = 0.0;
+  content->t_refactor       = 0.0;
+  content->t_solve          = 0.0;
 
 #if defined(SUNDIALS_INT64_T)
   if (SUNSparseMatrix_SparseType(A) == SUN_CSC_MAT)
@@ -178,8 +208,9 @@ SUNErrCode SUNLinSol_KLUReInit(SUNLinearSolver S, SUNMatrix A, sunindextype nnz,
     if (SUNSparseMatrix_Reallocate(A, nnz) != 0) { return SUN_ERR_MEM_FAIL; }
   }
 
-  /* Free the prior factorization and reset for first factorization */
-  if (SYMBOLIC(S) != NULL) { sun_klu_free_symbolic(&SYMBOLIC(S), &COMMON(S)); }
+  /* Free the prior numeric factorization and reset for first factorization.
+     The symbolic analysis is kept and only redone at the next setup if the
+     sparsity pattern of the matrix passed to it has changed. */
   if (NUMERIC(S) != NULL) { sun_klu_free_numeric(&NUMERIC(S), &COMMON(S)); }
   FIRSTFACTORIZE(S) = 1;
 
@@ -246,6 +277,20 @@ static SUNErrCode setFromCommandLine_KLU(SUNLinearSolver S, const char* LSid,
       }
       continue;
     }
+
+    /* control over SetPivotGrowthTol function */
+    if (strcmp(argv[idx] + offset, "pivot_growth_tol") == 0)
+    {
+      idx += 1;
+      sunrealtype rarg = SUNStrToReal(argv[idx]);
+      retval           = SUNLinSol_KLUSetPivotGrowthTol(S, rarg);
+      if (retval != SUN_SUCCESS)
+      {
+        free(prefix);
+        return retval;
+      }
+      continue;
+    }
   }
   free(prefix);
   return SUN_SUCCESS;
@@ -272,6 +317,25 @@ SUNErrCode SUNLinSol_KLUSetOrdering(SUNLinearSolver S, int ordering_choice)
   return SUN_SUCCESS;
 }
 
+/* ----------------------------------------------------------------------------
+ * Function to set the tolerance on the decrease of the reciprocal pivot growth
+ * that triggers a full factorization instead of a refactorization
+ */
+
+SUNErrCode SUNLinSol_KLUSetPivotGrowthTol(SUNLinearSolver S, sunrealtype tol)
+{
+  /* Check for non-NULL SUNLinearSolver */
+  if (S == NULL) { return SUN_ERR_ARG_CORRUPT; }
+
+  /* Check for legal tol */
+  if (tol >= ONE) { return SUN_ERR_ARG_OUTOFRANGE; }
+
+  /* A negative value restores the default */
+  PIVOTTOL(S) = (tol < ZERO) ? SUNKLU_PIVOT_GROWTH_DEFAULT : tol;
+
+  return SUN_SUCCESS;
+}
+
 /*
  * -----------------------------------------------------------------
  * accessor functions
@@ -293,6 +357,34 @@ sun_klu_common* SUNLinSol_KLUGetCommon(SUNLinearSolver S)
   return (&(COMMON(S)));
 }
 
+SUNErrCode SUNLinSol_KLUGetStats(SUNLinearSolver S, long int* nanalyze,
+                                 long int* nfactor, long int* nrefactor,
+                                 long int* nsolve)
+{
+  if (S == NULL) { return SUN_ERR_ARG_CORRUPT; }
+
+  if (nanalyze) { *nanalyze = KLU_CONTENT(S)->nanalyze; }
+  if (nfactor) { *nfactor = KLU_CONTENT(S)->nfactor; }
+  if (nrefactor) { *nrefactor = KLU_CONTENT(S)->nrefactor; }
+  if (nsolve) { *nsolve = KLU_CONTENT(S)->nsolve; }
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNLinSol_KLUGetTimes(SUNLinearSolver S, double* t_analyze,
+                                 double* t_factor, double* t_refactor,
+                                 double* t_solve)
+{
+  if (S == NULL) { return SUN_ERR_ARG_CORRUPT; }
+
+  if (t_analyze) { *t_analyze = KLU_CONTENT(S)->t_analyze; }
+  if (t_factor) { *t_factor = KLU_CONTENT(S)->t_factor; }
+  if (t_refactor) { *t_refactor = KLU_CONTENT(S)->t_refactor; }
+  if (t_solve) { *t_solve = KLU_CONTENT(S)->t_solve; }
+
+  return SUN_SUCCESS;
+}
+
 /*
  * -----------------------------------------------------------------
  * implementation of linear solver operations
@@ -321,9 +413,8 @@ SUNErrCode SUNLinSolInitialize_KLU(SUNLinearSolver S)
 int SUNLinSolSetup_KLU(SUNLinearSolver S, SUNMatrix A)
 {
   int retval;
-  sunrealtype uround_twothirds;
-
-  uround_twothirds = SUNRpowerR(SUN_UNIT_ROUNDOFF, TWOTHIRDS);
+  uint64_t hash;
+  double t0;
 
   /* Ensure that A is a sparse matrix */
   if (SUNMatGetID(A) != SUNMATRIX_SPARSE)
@@ -335,27 +426,42 @@ int SUNLinSolSetup_KLU(SUNLinearSolver S, SUNMatrix A)
   /* On first decomposition, get the symbolic factorization */
   if (FIRSTFACTORIZE(S))
   {
-    /* Perform symbolic analysis of sparsity structure */
-    if (SYMBOLIC(S)) { sun_klu_free_symbolic(&SYMBOLIC(S), &COMMON(S)); }
-    SYMBOLIC(S) = sun_klu_analyze(SUNSparseMatrix_NP(A),
-                                  SUNSparseMatrix_IndexPointers(A),
-                                  SUNSparseMatrix_IndexValues(A), &COMMON(S));
-    if (SYMBOLIC(S) == NULL)
+    /* Only redo the symbolic analysis if the sparsity pattern or the ordering
+       changed since the last analysis */
+    hash = patternHash_KLU(A);
+    if ((SYMBOLIC(S) == NULL) || !samePattern_KLU(S, A, hash) ||
+        (COMMON(S).ordering != PATTERNORDER(S)))
     {
-      LASTFLAG(S) = SUN_ERR_EXT_FAIL;
-      return (LASTFLAG(S));
+      /* Perform symbolic analysis of sparsity structure */
+      if (NUMERIC(S)) { sun_klu_free_numeric(&NUMERIC(S), &COMMON(S)); }
+      if (SYMBOLIC(S)) { sun_klu_free_symbolic(&SYMBOLIC(S), &COMMON(S)); }
+      t0          = sunWallTime();
+      SYMBOLIC(S) = sun_klu_analyze(SUNSparseMatrix_NP(A),
+                                    SUNSparseMatrix_IndexPointers(A),
+                                    SUNSparseMatrix_IndexValues(A), &COMMON(S));
+      KLU_CONTENT(S)->t_analyze += sunWallTime() - t0;
+      KLU_CONTENT(S)->nanalyze++;
+      if (SYMBOLIC(S) == NULL)
+      {
+        LASTFLAG(S) = SUN_ERR_EXT_FAIL;
+        return (LASTFLAG(S));
+      }
+      retval = savePattern_KLU(S, A, hash);
+      if (retval != SUN_SUCCESS)
+      {
+        LASTFLAG(S) = retval;
+        return (LASTFLAG(S));
+      }
+      PATTERNORDER(S) = COMMON(S).ordering;
     }
 
     /* ------------------------------------------------------------
        Compute the LU factorization of the matrix
        ------------------------------------------------------------*/
-    if (NUMERIC(S)) { sun_klu_free_numeric(&NUMERIC(S), &COMMON(S)); }
-    NUMERIC(S) = sun_klu_factor(SUNSparseMatrix_IndexPointers(A),
-                                SUNSparseMatrix_IndexValues(A),
-                                SUNSparseMatrix_Data(A), SYMBOLIC(S), &COMMON(S));
-    if (NUMERIC(S) == NULL)
+    retval = factor_KLU(S, A);
+    if (retval != SUN_SUCCESS)
     {
-      LASTFLAG(S) = SUN_ERR_EXT_FAIL;
+      LASTFLAG(S) = retval;
       return (LASTFLAG(S));
     }
 
@@ -364,57 +470,44 @@ int SUNLinSolSetup_KLU(SUNLinearSolver S, SUNMatrix A)
   else
   { /* not the first decomposition, so just refactor */
 
+    t0     = sunWallTime();
     retval = sun_klu_refactor(SUNSparseMatrix_IndexPointers(A),
                               SUNSparseMatrix_IndexValues(A),
                               SUNSparseMatrix_Data(A), SYMBOLIC(S), NUMERIC(S),
                               &COMMON(S));
     if (retval == 0)
     {
+      KLU_CONTENT(S)->t_refactor += sunWallTime() - t0;
       LASTFLAG(S) = SUNLS_PACKAGE_FAIL_REC;
       return (LASTFLAG(S));
     }
 
     /*-----------------------------------------------------------
-      Check if a cheap estimate of the reciprocal of the condition
-      number is getting too small.  If so, delete
-      the prior numeric factorization and recompute it.
+      Check for pivot growth with the cheap estimate of the
+      reciprocal condition number, min |U_ii| / max |U_ii|. The
+      refactorization reuses the pivots of the last full
+      factorization, so if this estimate has decreased by more
+      than a factor of pivot_growth_tol since then, the pivots
+      are no longer adequate and the matrix is factored again.
       -----------------------------------------------------------*/
 
     retval = sun_klu_rcond(SYMBOLIC(S), NUMERIC(S), &COMMON(S));
+    KLU_CONTENT(S)->t_refactor += sunWallTime() - t0;
+    KLU_CONTENT(S)->nrefactor++;
     if (retval == 0)
     {
       LASTFLAG(S) = SUNLS_PACKAGE_FAIL_REC;
       return (LASTFLAG(S));
     }
 
-    if (COMMON(S).rcond < uround_twothirds)
+    if (COMMON(S).rcond < PIVOTTOL(S) * RCONDFACTOR(S))
     {
-      /* Condition number may be getting large.
-	 Compute more accurate estimate */
-      retval = sun_klu_condest(SUNSparseMatrix_IndexPointers(A),
-                               SUNSparseMatrix_Data(A), SYMBOLIC(S), NUMERIC(S),
-                               &COMMON(S));
-      if (retval == 0)
+      retval = factor_KLU(S, A);
+      if (retval != SUN_SUCCESS)
       {
-        LASTFLAG(S) = SUNLS_PACKAGE_FAIL_REC;
+        LASTFLAG(S) = retval;
         return (LASTFLAG(S));
       }
-
-      if (COMMON(S).condest > (ONE / uround_twothirds))
-      {
-        /* More accurate estimate also says condition number is
-           large, so recompute the numeric factorization */
-        sun_klu_free_numeric(&NUMERIC(S), &COMMON(S));
-        NUMERIC(S) = sun_klu_factor(SUNSparseMatrix_IndexPointers(A),
-                                    SUNSparseMatrix_IndexValues(A),
-                                    SUNSparseMatrix_Data(A), SYMBOLIC(S),
-                                    &COMMON(S));
-        if (NUMERIC(S) == NULL)
-        {
-          LASTFLAG(S) = SUN_ERR_EXT_FAIL;
-          return (LASTFLAG(S));
-        }
-      }
     }
   }
 
@@ -427,6 +520,7 @@ int SUNLinSolSolve_KLU(SUNLinearSolver S, SUNMatrix A, N_Vector x, N_Vector b,
 {
   int flag;
   sunrealtype* xdata;
+  double t0;
 
   /* check for valid inputs */
   if ((A == NULL) || (S == NULL) || (x == NULL) || (b == NULL))
@@ -446,8 +540,11 @@ int SUNLinSolSolve_KLU(SUNLinearSolver S, SUNMatrix A, N_Vector x, N_Vector b,
   }
 
   /* Call KLU to solve the linear system */
+  t0   = sunWallTime();
   flag = SOLVE(S)(SYMBOLIC(S), NUMERIC(S), SUNSparseMatrix_NP(A), 1, xdata,
                   &COMMON(S));
+  KLU_CONTENT(S)->t_solve += sunWallTime() - t0;
+  KLU_CONTENT(S)->nsolve++;
   if (flag == 0)
   {
     LASTFLAG(S) = SUNLS_PACKAGE_FAIL_REC;
@@ -480,6 +577,8 @@ SUNErrCode SUNLinSolFree_KLU(SUNLinearSolver S)
   {
     if (NUMERIC(S)) { sun_klu_free_numeric(&NUMERIC(S), &COMMON(S)); }
     if (SYMBOLIC(S)) { sun_klu_free_symbolic(&SYMBOLIC(S), &COMMON(S)); }
+    free(KLU_CONTENT(S)->pattern_ptrs);
+    free(KLU_CONTENT(S)->pattern_vals);
     free(S->content);
     S->content = NULL;
   }
@@ -494,3 +593,134 @@ SUNErrCode SUNLinSolFree_KLU(SUNLinearSolver S)
   S = NULL;
   return SUN_SUCCESS;
 }
+
+/*
+ * -----------------------------------------------------------------
+ * private functions
+ * -----------------------------------------------------------------
+ */
+
+/* ----------------------------------------------------------------------------
+ * Compute a fingerprint (FNV-1a hash) of the sparsity pattern of A, i.e., of
+ * its dimension and index arrays, to detect when the symbolic analysis can be
+ * reused.
+ */
+
+static uint64_t patternHash_KLU(SUNMatrix A)
+{
+  sunindextype np          = SUNSparseMatrix_NP(A);
+  const sunindextype* ptrs = SUNSparseMatrix_IndexPointers(A);
+  const sunindextype* vals = SUNSparseMatrix_IndexValues(A);
+  uint64_t hash            = FNV_OFFSET_BASIS;
+  sunindextype i;
+
+  hash = (hash ^ (uint64_t)np) * FNV_PRIME;
+  for (i = 0; i <= np; i++) { hash = (hash ^ (uint64_t)ptrs[i]) * FNV_PRIME; }
+  for (i = 0; i < ptrs[np]; i++)
+  {
+    hash = (hash ^ (uint64_t)vals[i]) * FNV_PRIME;
+  }
+
+  return hash;
+}
+
+/* ----------------------------------------------------------------------------
+ * Check if the sparsity pattern of A matches the one used in the last symbolic
+ * analysis. The hash is only used to quickly reject a changed pattern, a match
+ * is confirmed by comparing the index arrays with the saved copies.
+ */
+
+static sunbooleantype samePattern_KLU(SUNLinearSolver S, SUNMatrix A,
+                                      uint64_t hash)
+{
+  sunindextype np          = SUNSparseMatrix_NP(A);
+  const sunindextype* ptrs = SUNSparseMatrix_IndexPointers(A);
+  const sunindextype* vals = SUNSparseMatrix_IndexValues(A);
+
+  if ((hash != PATTERNHASH(S)) || (np != KLU_CONTENT(S)->pattern_np))
+  {
+    return SUNFALSE;
+  }
+
+  if (memcmp(ptrs, KLU_CONTENT(S)->pattern_ptrs,
+             (size_t)(np + 1) * sizeof(sunindextype)) != 0)
+  {
+    return SUNFALSE;
+  }
+
+  if (memcmp(vals, KLU_CONTENT(S)->pattern_vals,
+             (size_t)ptrs[np] * sizeof(sunindextype)) != 0)
+  {
+    return SUNFALSE;
+  }
+
+  return SUNTRUE;
+}
+
+/* ----------------------------------------------------------------------------
+ * Save the hash and a copy of the index arrays of the sparsity pattern of A
+ * after a symbolic analysis for the comparison in samePattern_KLU.
+ */
+
+static int savePattern_KLU(SUNLinearSolver S, SUNMatrix A, uint64_t hash)
+{
+  sunindextype np          = SUNSparseMatrix_NP(A);
+  const sunindextype* ptrs = SUNSparseMatrix_IndexPointers(A);
+  const sunindextype* vals = SUNSparseMatrix_IndexValues(A);
+  sunindextype* tmp;
+
+  /* Invalidate the saved pattern until the copy is complete */
+  KLU_CONTENT(S)->pattern_np = -1;
+
+  tmp = (sunindextype*)realloc(KLU_CONTENT(S)->pattern_ptrs,
+                               (size_t)(np + 1) * sizeof(sunindextype));
+  if (tmp == NULL) { return SUN_ERR_MEM_FAIL; }
+  KLU_CONTENT(S)->pattern_ptrs = tmp;
+
+  /* Allocate at least one entry so that an empty pattern is not NULL */
+  tmp = (sunindextype*)realloc(KLU_CONTENT(S)->pattern_vals,
+                               (size_t)SUNMAX(ptrs[np], 1) * sizeof(sunindextype));
+  if (tmp == NULL) { return SUN_ERR_MEM_FAIL; }
+  KLU_CONTENT(S)->pattern_vals = tmp;
+
+  memcpy(KLU_CONTENT(S)->pattern_ptrs, ptrs,
+         (size_t)(np + 1) * sizeof(sunindextype));
+  memcpy(KLU_CONTENT(S)->pattern_vals, vals,
+         (size_t)ptrs[np] * sizeof(sunindextype));
+
+  PATTERNHASH(S)             = hash;
+  KLU_CONTENT(S)->pattern_np = np;
+
+  return SUN_SUCCESS;
+}
+
+/* ----------------------------------------------------------------------------
+ * Compute a full numeric factorization (with partial pivoting) of A using the
+ * current symbolic analysis and record its reciprocal pivot growth estimate
+ * for the refactorization policy in SUNLinSolSetup_KLU.
+ */
+
+static int factor_KLU(SUNLinearSolver S, SUNMatrix A)
+{
+  double t0 = sunWallTime();
+  int retval;
+
+  if (NUMERIC(S)) { sun_klu_free_numeric(&NUMERIC(S), &COMMON(S)); }
+  NUMERIC(S) = sun_klu_factor(SUNSparseMatrix_IndexPointers(A),
+                              SUNSparseMatrix_IndexValues(A),
+                              SUNSparseMatrix_Data(A), SYMBOLIC(S), &COMMON(S));
+  if (NUMERIC(S) == NULL)
+  {
+    KLU_CONTENT(S)->t_factor += sunWallTime() - t0;
+    return SUN_ERR_EXT_FAIL;
+  }
+
+  retval = sun_klu_rcond(SYMBOLIC(S), NUMERIC(S), &COMMON(S));
+  KLU_CONTENT(S)->t_factor += sunWallTime() - t0;
+  KLU_CONTENT(S)->nfactor++;
+  if (retval == 0) { return SUNLS_PACKAGE_FAIL_REC; }
+
+  RCONDFACTOR(S) = COMMON(S).rcond;
+
+  return SUN_SUCCESS;
+}
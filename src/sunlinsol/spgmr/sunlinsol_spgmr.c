@@ -32,8 +32,9 @@
 #include "sundials_cli.h"
 #include "sundials_macros.h"
 
-#define ZERO SUN_RCONST(0.0)
-#define ONE  SUN_RCONST(1.0)
+#define ZERO   SUN_RCONST(0.0)
+#define ONE    SUN_RCONST(1.0)
+#define FACTOR SUN_RCONST(1000.0)
 
 /*
  * -----------------------------------------------------------------
@@ -53,6 +54,11 @@
 static SUNErrCode setFromCommandLine_SPGMR(SUNLinearSolver S, const char* LSid,
                                            int argc, char* argv[]);
 
+static int applyATilde_SPGMR(SUNLinearSolver S, N_Vector x, N_Vector y,
+                             sunrealtype delta);
+
+static SUNErrCode allocPipelinedGS_SPGMR(SUNLinearSolver S);
+
 SUNErrCode SUNLinSolSetOptions_SPGMR(SUNLinearSolver S, const char* LSid,
                                      const char* file_name, int argc,
                                      char* argv[]);
@@ -143,6 +149,8 @@ SUNLinearSolver SUNLinSol_SPGMR(N_Vector y, int pretype, int maxl,
   content->yg           = NULL;
   content->cv           = NULL;
   content->Xv           = NULL;
+  content->Hcopy        = NULL;
+  content->dv           = NULL;
 
   /* Allocate content */
   content->xcor = N_VClone(y);
@@ -271,11 +279,20 @@ SUNErrCode SUNLinSol_SPGMRSetGSType(SUNLinearSolver S, int gstype)
 {
   SUNFunctionBegin(S->sunctx);
   /* Check for legal gstype */
-  SUNAssert(gstype == SUN_MODIFIED_GS || gstype == SUN_CLASSICAL_GS,
+  SUNAssert(gstype == SUN_MODIFIED_GS || gstype == SUN_CLASSICAL_GS ||
+              gstype == SUN_PIPELINED_GS,
             SUN_ERR_ARG_OUTOFRANGE);
 
   /* Set pretype */
   SPGMR_CONTENT(S)->gstype = gstype;
+
+  /* If the solver has already been initialized, allocate the arrays
+     needed by the pipelined orthogonalization */
+  if (gstype == SUN_PIPELINED_GS && SPGMR_CONTENT(S)->Hes != NULL)
+  {
+    SUNCheckCall(allocPipelinedGS_SPGMR(S));
+  }
+
   return SUN_SUCCESS;
 }
 
@@ -389,6 +406,12 @@ SUNErrCode SUNLinSolInitialize_SPGMR(SUNLinearSolver S)
     SUNAssert(content->Xv, SUN_ERR_MALLOC_FAIL);
   }
 
+  /*    Hessenberg copy and dot product arrays for pipelined Gram-Schmidt */
+  if (content->gstype == SUN_PIPELINED_GS)
+  {
+    SUNCheckCall(allocPipelinedGS_SPGMR(S));
+  }
+
   return SUN_SUCCESS;
 }
 
@@ -465,11 +488,12 @@ int SUNLinSolSolve_SPGMR(SUNLinearSolver S, SUNDIALS_MAYBE_UNUSED SUNMatrix A,
 
   /* local data and shortcut variables */
   N_Vector *V, xcor, vtemp, s1, s2;
-  sunrealtype **Hes, *givens, *yg, *res_norm;
-  sunrealtype beta, rotation_product, r_norm, s_product, rho;
+  sunrealtype **Hes, **Hcopy, *givens, *yg, *dv, *res_norm;
+  sunrealtype beta, rotation_product, r_norm, s_product, rho, hsq, hnorm;
   sunbooleantype preOnLeft, preOnRight, scale2, scale1, converged;
+  sunbooleantype splitreduce, overlap, pending;
   sunbooleantype* zeroguess;
-  int i, j, k, l, l_plus_1, l_max, krydim, ntries, max_restarts, gstype;
+  int i, j, k, l, l_plus_1, l_max, krydim, ntries, max_restarts, gstype, nvec;
   int* nli;
   void *A_data, *P_data;
   SUNATimesFn atimes;
@@ -481,6 +505,8 @@ int SUNLinSolSolve_SPGMR(SUNLinearSolver S, SUNDIALS_MAYBE_UNUSED SUNMatrix A,
   /* Initialize some variables */
   l_plus_1 = 0;
   krydim   = 0;
+  nvec     = 0;
+  pending  = SUNFALSE;
 
   /* Make local shortcuts to solver variables. */
   l_max        = SPGMR_CONTENT(S)->maxl;
@@ -488,6 +514,7 @@ int SUNLinSolSolve_SPGMR(SUNLinearSolver S, SUNDIALS_MAYBE_UNUSED SUNMatrix A,
   gstype       = SPGMR_CONTENT(S)->gstype;
   V            = SPGMR_CONTENT(S)->V;
   Hes          = SPGMR_CONTENT(S)->Hes;
+  Hcopy        = SPGMR_CONTENT(S)->Hcopy;
   givens       = SPGMR_CONTENT(S)->givens;
   xcor         = SPGMR_CONTENT(S)->xcor;
   yg           = SPGMR_CONTENT(S)->yg;
@@ -503,6 +530,7 @@ int SUNLinSolSolve_SPGMR(SUNLinearSolver S, SUNDIALS_MAYBE_UNUSED SUNMatrix A,
   res_norm     = &(SPGMR_CONTENT(S)->resnorm);
   cv           = SPGMR_CONTENT(S)->cv;
   Xv           = SPGMR_CONTENT(S)->Xv;
+  dv           = SPGMR_CONTENT(S)->dv;
 
   /* Initialize counters and convergence flag */
   *nli      = 0;
@@ -522,6 +550,16 @@ int SUNLinSolSolve_SPGMR(SUNLinearSolver S, SUNDIALS_MAYBE_UNUSED SUNMatrix A,
   /* If preconditioning, check if psolve has been set */
   SUNAssert(!(preOnLeft || preOnRight) || psolve, SUN_ERR_ARG_CORRUPT);
 
+  /* If using pipelined Gram-Schmidt, check if Hcopy and dv have been
+     allocated, if the reductions can be split into local and global phases,
+     and if the global phase can be overlapped with other work */
+  SUNAssert(gstype != SUN_PIPELINED_GS || (Hcopy && dv), SUN_ERR_ARG_CORRUPT);
+
+  splitreduce = (vtemp->ops->nvdotprodmultiallreduce != NULL) &&
+                ((vtemp->ops->nvdotprodmultilocal != NULL) ||
+                 (vtemp->ops->nvdotprodlocal != NULL));
+  overlap = splitreduce && (vtemp->ops->nvdotprodmultiallreducebegin != NULL);
+
   SUNLogInfo(S->sunctx->logger, "linear-solver", "solver = spgmr");
 
   SUNLogInfo(S->sunctx->logger, "begin-iterations-list", "");
@@ -630,6 +668,24 @@ int SUNLinSolSolve_SPGMR(SUNLinearSolver S, SUNDIALS_MAYBE_UNUSED SUNMatrix A,
     N_VScale(ONE / r_norm, V[0], V[0]);
     SUNCheckLastErr();
 
+    /* With pipelined Gram-Schmidt, compute the first Gram-Schmidt pass of
+       V[1] = A-tilde V[0]. The second pass is done in the first iteration. */
+    if (gstype == SUN_PIPELINED_GS)
+    {
+      status = applyATilde_SPGMR(S, V[0], V[1], delta);
+      if (status != SUN_SUCCESS)
+      {
+        *zeroguess = SUNFALSE;
+        return status;
+      }
+
+      Hes[0][0] = N_VDotProd(V[1], V[0]);
+      SUNCheckLastErr();
+
+      N_VLinearSum(ONE, V[1], -Hes[0][0], V[0], V[1]);
+      SUNCheckLastErr();
+    }
+
     /* Inner loop: generate Krylov sequence and Arnoldi basis */
     for (l = 0; l < l_max; l++)
     {
@@ -638,101 +694,133 @@ int SUNLinSolSolve_SPGMR(SUNLinearSolver S, SUNDIALS_MAYBE_UNUSED SUNMatrix A,
       (*nli)++;
       krydim = l_plus_1 = l + 1;
 
-      /* Generate A-tilde V[l], where A-tilde = s1 P1_inv A P2_inv s2_inv */
-
-      /*   Apply right scaling: vtemp = s2_inv V[l] */
-      if (scale2)
-      {
-        N_VDiv(V[l], s2, vtemp);
-        SUNCheckLastErr();
-      }
-      else
+      if (gstype == SUN_PIPELINED_GS)
       {
-        N_VScale(ONE, V[l], vtemp);
-        SUNCheckLastErr();
-      }
-
-      /*   Apply right preconditioner: vtemp = P2_inv s2_inv V[l] */
-      if (preOnRight)
-      {
-        N_VScale(ONE, vtemp, V[l_plus_1]);
-        SUNCheckLastErr();
-        status = psolve(P_data, V[l_plus_1], vtemp, delta, SUN_PREC_RIGHT);
-        if (status != 0)
+        /* V[l+1] holds the first Gram-Schmidt pass of A-tilde V[l]. Compute
+           its dot products with V[0], ..., V[l+1] for the delayed second
+           pass and, except in the last iteration, the dot products of
+           w = A-tilde V[l+1] (stored in V[l+2]) with the same vectors. If
+           the vector supports it, the local dot products are computed
+           separately and the global reduction of the first set is overlapped
+           with computing w while the reduction of the second set is
+           overlapped with the second pass below. Otherwise the two global
+           reductions are combined into one. */
+        nvec = l + 2;
+        for (k = 0; k <= l_plus_1; k++) { Xv[k] = V[k]; }
+
+        if (splitreduce)
         {
-          *zeroguess  = SUNFALSE;
-          LASTFLAG(S) = (status < 0) ? SUNLS_PSOLVE_FAIL_UNREC
-                                     : SUNLS_PSOLVE_FAIL_REC;
-
-          SUNLogInfo(S->sunctx->logger, "end-iterations-list",
-                     "status = failed preconditioner solve, retval = %d", status);
-
-          return (LASTFLAG(S));
+          SUNCheckCall(N_VDotProdMultiLocal(nvec, V[l_plus_1], Xv, dv));
         }
-      }
+        else { SUNCheckCall(N_VDotProdMulti(nvec, V[l_plus_1], Xv, dv)); }
 
-      /* Apply A: V[l+1] = A P2_inv s2_inv V[l] */
-      status = atimes(A_data, vtemp, V[l_plus_1]);
-      if (status != 0)
-      {
-        *zeroguess  = SUNFALSE;
-        LASTFLAG(S) = (status < 0) ? SUNLS_ATIMES_FAIL_UNREC
-                                   : SUNLS_ATIMES_FAIL_REC;
-
-        SUNLogInfo(S->sunctx->logger, "end-iterations-list",
-                   "status = failed matvec, retval = %d", status);
+        if (overlap)
+        {
+          SUNCheckCall(N_VDotProdMultiAllReduceBegin(nvec, V[l_plus_1], dv));
+        }
 
-        return (LASTFLAG(S));
-      }
+        if (l_plus_1 < l_max)
+        {
+          status = applyATilde_SPGMR(S, V[l_plus_1], V[l + 2], delta);
+          if (status != SUN_SUCCESS)
+          {
+            if (overlap)
+            {
+              SUNCheckCall(N_VDotProdMultiAllReduceEnd(nvec, V[l_plus_1], dv));
+            }
+            *zeroguess = SUNFALSE;
+            return status;
+          }
+
+          if (splitreduce)
+          {
+            SUNCheckCall(N_VDotProdMultiLocal(nvec, V[l + 2], Xv, dv + nvec));
+          }
+          else {
+            SUNCheckCall(N_VDotProdMulti(nvec, V[l + 2], Xv, dv + nvec));
+          }
+
+          if (overlap)
+          {
+            SUNCheckCall(
+              N_VDotProdMultiAllReduceBegin(nvec, V[l + 2], dv + nvec));
+            pending = SUNTRUE;
+          }
+        }
 
-      /* Apply left preconditioning: vtemp = P1_inv A P2_inv s2_inv V[l] */
-      if (preOnLeft)
-      {
-        status = psolve(P_data, V[l_plus_1], vtemp, delta, SUN_PREC_LEFT);
-        if (status != 0)
+        if (overlap)
         {
-          *zeroguess  = SUNFALSE;
-          LASTFLAG(S) = (status < 0) ? SUNLS_PSOLVE_FAIL_UNREC
-                                     : SUNLS_PSOLVE_FAIL_REC;
+          SUNCheckCall(N_VDotProdMultiAllReduceEnd(nvec, V[l_plus_1], dv));
+        }
+        else if (splitreduce)
+        {
+          SUNCheckCall(N_VDotProdMultiAllReduce((l_plus_1 < l_max) ? 2 * nvec
+                                                                   : nvec,
+                                                V[l_plus_1], dv));
+        }
 
-          SUNLogInfo(S->sunctx->logger, "end-iterations-list",
-                     "status = failed preconditioner solve, retval = %d", status);
+        /* Second pass: V[l+1] = V[l+1] - sum_k dv[k] V[k], which completes
+           column l of Hes. The norm of the result follows from the
+           Pythagorean identity unless there is too much cancellation. */
+        hsq   = dv[l_plus_1];
+        cv[0] = ONE;
+        Xv[0] = V[l_plus_1];
+        for (k = 0; k <= l; k++)
+        {
+          Hes[k][l] += dv[k];
+          hsq -= dv[k] * dv[k];
+          cv[k + 1] = -dv[k];
+          Xv[k + 1] = V[k];
+        }
+        SUNCheckCall(N_VLinearCombination(l + 2, cv, Xv, V[l_plus_1]));
 
-          return (LASTFLAG(S));
+        if (FACTOR * FACTOR * hsq > dv[l_plus_1])
+        {
+          Hes[l_plus_1][l] = SUNRsqrt(hsq);
+        }
+        else
+        {
+          hsq = N_VDotProd(V[l_plus_1], V[l_plus_1]);
+          SUNCheckLastErr();
+          Hes[l_plus_1][l] = SUNRsqrt(hsq);
         }
-      }
-      else
-      {
-        N_VScale(ONE, V[l_plus_1], vtemp);
-        SUNCheckLastErr();
-      }
 
-      /* Apply left scaling: V[l+1] = s1 P1_inv A P2_inv s2_inv V[l] */
-      if (scale1)
-      {
-        N_VProd(s1, vtemp, V[l_plus_1]);
-        SUNCheckLastErr();
+        /* Save column l before it is overwritten by the QR factorization */
+        for (k = 0; k <= l_plus_1; k++) { Hcopy[k][l] = Hes[k][l]; }
       }
       else
       {
-        N_VScale(ONE, vtemp, V[l_plus_1]);
-        SUNCheckLastErr();
-      }
+        /* Generate V[l+1] = A-tilde V[l], where
+           A-tilde = s1 P1_inv A P2_inv s2_inv */
+        status = applyATilde_SPGMR(S, V[l], V[l_plus_1], delta);
+        if (status != SUN_SUCCESS)
+        {
+          *zeroguess = SUNFALSE;
+          return status;
+        }
 
-      /*  Orthogonalize V[l+1] against previous V[i]: V[l+1] = w_tilde */
-      if (gstype == SUN_CLASSICAL_GS)
-      {
-        SUNCheckCall(
-          SUNClassicalGS(V, Hes, l_plus_1, l_max, &(Hes[l_plus_1][l]), cv, Xv));
-      }
-      else
-      {
-        SUNCheckCall(SUNModifiedGS(V, Hes, l_plus_1, l_max, &(Hes[l_plus_1][l])));
+        /*  Orthogonalize V[l+1] against previous V[i]: V[l+1] = w_tilde */
+        if (gstype == SUN_CLASSICAL_GS)
+        {
+          SUNCheckCall(SUNClassicalGS(V, Hes, l_plus_1, l_max,
+                                      &(Hes[l_plus_1][l]), cv, Xv));
+        }
+        else
+        {
+          SUNCheckCall(
+            SUNModifiedGS(V, Hes, l_plus_1, l_max, &(Hes[l_plus_1][l])));
+        }
       }
 
       /*  Update the QR factorization of Hes */
       if (SUNQRfact(krydim, Hes, givens, l) != 0)
       {
+        if (pending)
+        {
+          SUNCheckCall(N_VDotProdMultiAllReduceEnd(nvec, V[l + 2], dv + nvec));
+          pending = SUNFALSE;
+        }
+
         *zeroguess  = SUNFALSE;
         LASTFLAG(S) = SUNLS_QRFACT_FAIL;
 
@@ -752,6 +840,12 @@ int SUNLinSolSolve_SPGMR(SUNLinearSolver S, SUNDIALS_MAYBE_UNUSED SUNMatrix A,
 
       if (rho <= delta)
       {
+        if (pending)
+        {
+          SUNCheckCall(N_VDotProdMultiAllReduceEnd(nvec, V[l + 2], dv + nvec));
+          pending = SUNFALSE;
+        }
+
         converged = SUNTRUE;
         break;
       }
@@ -760,6 +854,49 @@ int SUNLinSolSolve_SPGMR(SUNLinearSolver S, SUNDIALS_MAYBE_UNUSED SUNMatrix A,
       N_VScale(ONE / Hes[l_plus_1][l], V[l_plus_1], V[l_plus_1]);
       SUNCheckLastErr();
 
+      /* Complete the reduction of the dot products of w */
+      if (pending)
+      {
+        SUNCheckCall(N_VDotProdMultiAllReduceEnd(nvec, V[l + 2], dv + nvec));
+        pending = SUNFALSE;
+      }
+
+      /* With pipelined Gram-Schmidt, compute the first Gram-Schmidt pass of
+         A-tilde V[l+1] from w = A-tilde (h V[l+1] + sum_k dv[k] V[k]) in
+         V[l+2], where h = Hes[l+1][l]. Using the Arnoldi relation
+         A-tilde V[k] = sum_i Hcopy[i][k] V[i] gives
+           A-tilde V[l+1] = (w - sum_i cv[i] V[i]) / h,  cv = Hcopy dv,
+         and the projections onto V[0], ..., V[l+1] follow from the dot
+         products of w computed above. The entries of cv are stored in yg,
+         which is not needed until the inner loop is done. */
+      if (gstype == SUN_PIPELINED_GS && l_plus_1 < l_max)
+      {
+        hnorm = Hcopy[l_plus_1][l];
+
+        /* Dot product of w with the normalized V[l+1] */
+        hsq = dv[nvec + l_plus_1];
+        for (k = 0; k <= l; k++) { hsq -= dv[k] * dv[nvec + k]; }
+        hsq /= hnorm;
+
+        cv[0] = ONE / hnorm;
+        Xv[0] = V[l + 2];
+        for (i = 0; i <= l_plus_1; i++)
+        {
+          yg[i] = ZERO;
+          for (k = (i > 0) ? i - 1 : 0; k <= l; k++)
+          {
+            yg[i] += Hcopy[i][k] * dv[k];
+          }
+
+          Hes[i][l_plus_1] = ((i <= l) ? dv[nvec + i] : hsq) - yg[i];
+          Hes[i][l_plus_1] /= hnorm;
+
+          cv[i + 1] = -(yg[i] / hnorm + Hes[i][l_plus_1]);
+          Xv[i + 1] = V[i];
+        }
+        SUNCheckCall(N_VLinearCombination(l + 3, cv, Xv, V[l + 2]));
+      }
+
       SUNLogInfoIf(l < l_max - 1, S->sunctx->logger, "end-iterations-list",
                    "status = continue");
     }
@@ -968,6 +1105,7 @@ SUNErrCode SUNLinSolSpace_SPGMR(SUNLinearSolver S, long int* lenrwLS,
   else { lrw1 = liw1 = 0; }
   *lenrwLS = lrw1 * (maxl + 5) + maxl * (maxl + 5) + 2;
   *leniwLS = liw1 * (maxl + 5);
+  if (SPGMR_CONTENT(S)->Hcopy) { *lenrwLS += (maxl + 1) * (maxl + 2); }
   return SUN_SUCCESS;
 }
 
@@ -1026,6 +1164,24 @@ SUNErrCode SUNLinSolFree_SPGMR(SUNLinearSolver S)
       free(SPGMR_CONTENT(S)->Xv);
       SPGMR_CONTENT(S)->Xv = NULL;
     }
+    if (SPGMR_CONTENT(S)->Hcopy)
+    {
+      for (k = 0; k <= SPGMR_CONTENT(S)->maxl; k++)
+      {
+        if (SPGMR_CONTENT(S)->Hcopy[k])
+        {
+          free(SPGMR_CONTENT(S)->Hcopy[k]);
+          SPGMR_CONTENT(S)->Hcopy[k] = NULL;
+        }
+      }
+      free(SPGMR_CONTENT(S)->Hcopy);
+      SPGMR_CONTENT(S)->Hcopy = NULL;
+    }
+    if (SPGMR_CONTENT(S)->dv)
+    {
+      free(SPGMR_CONTENT(S)->dv);
+      SPGMR_CONTENT(S)->dv = NULL;
+    }
     free(S->content);
     S->content = NULL;
   }
@@ -1038,3 +1194,151 @@ SUNErrCode SUNLinSolFree_SPGMR(SUNLinearSolver S)
   S = NULL;
   return SUN_SUCCESS;
 }
+
+/*
+ * -----------------------------------------------------------------
+ * private functions
+ * -----------------------------------------------------------------
+ */
+
+/* ----------------------------------------------------------------------------
+ * Function to compute y = A-tilde x, where A-tilde = s1 P1_inv A P2_inv s2_inv.
+ * The vectors x and y must differ and vtemp is used as workspace.
+ */
+
+static int applyATilde_SPGMR(SUNLinearSolver S, N_Vector x, N_Vector y,
+                             sunrealtype delta)
+{
+  SUNFunctionBegin(S->sunctx);
+
+  N_Vector vtemp            = SPGMR_CONTENT(S)->vtemp;
+  N_Vector s1               = SPGMR_CONTENT(S)->s1;
+  N_Vector s2               = SPGMR_CONTENT(S)->s2;
+  void* A_data              = SPGMR_CONTENT(S)->ATData;
+  void* P_data              = SPGMR_CONTENT(S)->PData;
+  SUNATimesFn atimes        = SPGMR_CONTENT(S)->ATimes;
+  SUNPSolveFn psolve        = SPGMR_CONTENT(S)->Psolve;
+  sunbooleantype preOnLeft  = ((SPGMR_CONTENT(S)->pretype == SUN_PREC_LEFT) ||
+                              (SPGMR_CONTENT(S)->pretype == SUN_PREC_BOTH));
+  sunbooleantype preOnRight = ((SPGMR_CONTENT(S)->pretype == SUN_PREC_RIGHT) ||
+                               (SPGMR_CONTENT(S)->pretype == SUN_PREC_BOTH));
+  int status;
+
+  /* Apply right scaling: vtemp = s2_inv x */
+  if (s2 != NULL)
+  {
+    N_VDiv(x, s2, vtemp);
+    SUNCheckLastErr();
+  }
+  else
+  {
+    N_VScale(ONE, x, vtemp);
+    SUNCheckLastErr();
+  }
+
+  /* Apply right preconditioner: vtemp = P2_inv s2_inv x */
+  if (preOnRight)
+  {
+    N_VScale(ONE, vtemp, y);
+    SUNCheckLastErr();
+    status = psolve(P_data, y, vtemp, delta, SUN_PREC_RIGHT);
+    if (status != 0)
+    {
+      LASTFLAG(S) = (status < 0) ? SUNLS_PSOLVE_FAIL_UNREC
+                                 : SUNLS_PSOLVE_FAIL_REC;
+
+      SUNLogInfo(S->sunctx->logger, "end-iterations-list",
+                 "status = failed preconditioner solve, retval = %d", status);
+
+      return (LASTFLAG(S));
+    }
+  }
+
+  /* Apply A: y = A P2_inv s2_inv x */
+  status = atimes(A_data, vtemp, y);
+  if (status != 0)
+  {
+    LASTFLAG(S) = (status < 0) ? SUNLS_ATIMES_FAIL_UNREC : SUNLS_ATIMES_FAIL_REC;
+
+    SUNLogInfo(S->sunctx->logger, "end-iterations-list",
+               "status = failed matvec, retval = %d", status);
+
+    return (LASTFLAG(S));
+  }
+
+  /* Apply left preconditioning: vtemp = P1_inv A P2_inv s2_inv x */
+  if (preOnLeft)
+  {
+    status = psolve(P_data, y, vtemp, delta, SUN_PREC_LEFT);
+    if (status != 0)
+    {
+      LASTFLAG(S) = (status < 0) ? SUNLS_PSOLVE_FAIL_UNREC
+                                 : SUNLS_PSOLVE_FAIL_REC;
+
+      SUNLogInfo(S->sunctx->logger, "end-iterations-list",
+                 "status = failed preconditioner solve, retval = %d", status);
+
+      return (LASTFLAG(S));
+    }
+  }
+  else
+  {
+    N_VScale(ONE, y, vtemp);
+    SUNCheckLastErr();
+  }
+
+  /* Apply left scaling: y = s1 P1_inv A P2_inv s2_inv x */
+  if (s1 != NULL)
+  {
+    N_VProd(s1, vtemp, y);
+    SUNCheckLastErr();
+  }
+  else
+  {
+    N_VScale(ONE, vtemp, y);
+    SUNCheckLastErr();
+  }
+
+  return SUN_SUCCESS;
+}
+
+/* ----------------------------------------------------------------------------
+ * Function to allocate the copy of the Hessenberg matrix and the dot product
+ * array used by the pipelined Gram-Schmidt process (if not already allocated)
+ */
+
+static SUNErrCode allocPipelinedGS_SPGMR(SUNLinearSolver S)
+{
+  int k;
+  SUNLinearSolverContent_SPGMR content;
+  SUNFunctionBegin(S->sunctx);
+
+  /* set shortcut to SPGMR memory structure */
+  content = SPGMR_CONTENT(S);
+
+  /*   Hessenberg matrix copy Hcopy */
+  if (content->Hcopy == NULL)
+  {
+    content->Hcopy =
+      (sunrealtype**)malloc((content->maxl + 1) * sizeof(sunrealtype*));
+    SUNAssert(content->Hcopy, SUN_ERR_MALLOC_FAIL);
+
+    for (k = 0; k <= content->maxl; k++)
+    {
+      content->Hcopy[k] = NULL;
+      content->Hcopy[k] =
+        (sunrealtype*)malloc(content->maxl * sizeof(sunrealtype));
+      SUNAssert(content->Hcopy[k], SUN_ERR_MALLOC_FAIL);
+    }
+  }
+
+  /*   dv vector for the dot products of two vectors */
+  if (content->dv == NULL)
+  {
+    content->dv =
+      (sunrealtype*)malloc(2 * (content->maxl + 1) * sizeof(sunrealtype));
+    SUNAssert(content->dv, SUN_ERR_MALLOC_FAIL);
+  }
+
+  return SUN_SUCCESS;
+}
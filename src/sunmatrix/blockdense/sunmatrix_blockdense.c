@@ -0,0 +1,463 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2025-2026, Lawrence Livermore National Security,
+ * University of Maryland Baltimore County, and the SUNDIALS contributors.
+ * Copyright (c) 2013-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * Copyright (c) 2002-2013, Lawrence Livermore National Security.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * This is the implementation file for the block-diagonal dense
+ * implementation of the SUNMATRIX package.
+ * -----------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <sundials/priv/sundials_errors_impl.h>
+#include <sundials/sundials_errors.h>
+#include <sundials/sundials_math.h>
+#include <sunmatrix/sunmatrix_blockdense.h>
+
+#include "sundials_macros.h"
+
+#define ZERO SUN_RCONST(0.0)
+#define ONE  SUN_RCONST(1.0)
+
+#define GSIZE SUN_BLOCKDENSE_GROUP_SIZE
+
+/* Private function prototypes */
+static sunbooleantype compatibleMatrices(SUNMatrix A, SUNMatrix B);
+static sunbooleantype compatibleMatrixAndVectors(SUNMatrix A, N_Vector x,
+                                                 N_Vector y);
+
+/*
+ * -----------------------------------------------------------------
+ * exported functions
+ * -----------------------------------------------------------------
+ */
+
+/* ----------------------------------------------------------------------------
+ * Function to create a new block-diagonal dense matrix
+ */
+
+SUNMatrix SUNMatrix_BlockDense(sunindextype nblocks, sunindextype M,
+                               sunindextype N, SUNContext sunctx)
+{
+  SUNFunctionBegin(sunctx);
+  SUNMatrix A;
+  SUNMatrixContent_BlockDense content;
+
+  /* return with NULL matrix on illegal dimension input */
+  SUNAssertNull(nblocks > 0 && N > 0 && M > 0, SUN_ERR_ARG_OUTOFRANGE);
+
+  /* Create an empty matrix object */
+  A = NULL;
+  A = SUNMatNewEmpty(sunctx);
+  SUNCheckLastErrNull();
+
+  /* Attach operations */
+  A->ops->getid                    = SUNMatGetID_BlockDense;
+  A->ops->clone                    = SUNMatClone_BlockDense;
+  A->ops->destroy                  = SUNMatDestroy_BlockDense;
+  A->ops->zero                     = SUNMatZero_BlockDense;
+  A->ops->copy                     = SUNMatCopy_BlockDense;
+  A->ops->scaleadd                 = SUNMatScaleAdd_BlockDense;
+  A->ops->scaleaddi                = SUNMatScaleAddI_BlockDense;
+  A->ops->matvec                   = SUNMatMatvec_BlockDense;
+  A->ops->mathermitiantransposevec = SUNMatHermitianTransposeVec_BlockDense;
+
+  /* Create content */
+  content = NULL;
+  content = (SUNMatrixContent_BlockDense)malloc(sizeof *content);
+  SUNAssertNull(content, SUN_ERR_MALLOC_FAIL);
+
+  /* Attach content */
+  A->content = content;
+
+  /* Fill content */
+  content->M       = M;
+  content->N       = N;
+  content->nblocks = nblocks;
+  content->ngroups = (nblocks + GSIZE - 1) / GSIZE;
+  content->ldata   = content->ngroups * GSIZE * M * N;
+  content->data    = NULL;
+
+  /* Allocate content */
+  content->data = (sunrealtype*)calloc(content->ldata, sizeof(sunrealtype));
+  SUNAssertNull(content->data, SUN_ERR_MALLOC_FAIL);
+
+  return (A);
+}
+
+/* ----------------------------------------------------------------------------
+ * Function to print the block-diagonal dense matrix
+ */
+
+void SUNMatrix_BlockDense_Print(SUNMatrix A, FILE* outfile)
+{
+  SUNFunctionBegin(A->sunctx);
+  sunindextype i, j, k;
+
+  SUNAssertVoid(SUNMatGetID(A) == SUNMATRIX_BLOCKDENSE, SUN_ERR_ARG_WRONGTYPE);
+
+  /* perform operation */
+  for (k = 0; k < SM_NUMBLOCKS_BD(A); k++)
+  {
+    fprintf(outfile, "\nBlock %ld:\n", (long int)k);
+    for (i = 0; i < SM_BLOCKROWS_BD(A); i++)
+    {
+      for (j = 0; j < SM_BLOCKCOLUMNS_BD(A); j++)
+      {
+        fprintf(outfile, SUN_FORMAT_E "  ", SM_ELEMENT_BD(A, k, i, j));
+      }
+      fprintf(outfile, "\n");
+    }
+  }
+  fprintf(outfile, "\n");
+  return;
+}
+
+/* ----------------------------------------------------------------------------
+ * Functions to access the contents of the block-diagonal dense matrix
+ */
+
+sunindextype SUNMatrix_BlockDense_Rows(SUNMatrix A)
+{
+  SUNFunctionBegin(A->sunctx);
+  SUNAssertNoRet(SUNMatGetID(A) == SUNMATRIX_BLOCKDENSE, SUN_ERR_ARG_WRONGTYPE);
+  return SM_ROWS_BD(A);
+}
+
+sunindextype SUNMatrix_BlockDense_Columns(SUNMatrix A)
+{
+  SUNFunctionBegin(A->sunctx);
+  SUNAssertNoRet(SUNMatGetID(A) == SUNMATRIX_BLOCKDENSE, SUN_ERR_ARG_WRONGTYPE);
+  return SM_COLUMNS_BD(A);
+}
+
+sunindextype SUNMatrix_BlockDense_BlockRows(SUNMatrix A)
+{
+  SUNFunctionBegin(A->sunctx);
+  SUNAssertNoRet(SUNMatGetID(A) == SUNMATRIX_BLOCKDENSE, SUN_ERR_ARG_WRONGTYPE);
+  return SM_BLOCKROWS_BD(A);
+}
+
+sunindextype SUNMatrix_BlockDense_BlockColumns(SUNMatrix A)
+{
+  SUNFunctionBegin(A->sunctx);
+  SUNAssertNoRet(SUNMatGetID(A) == SUNMATRIX_BLOCKDENSE, SUN_ERR_ARG_WRONGTYPE);
+  return SM_BLOCKCOLUMNS_BD(A);
+}
+
+sunindextype SUNMatrix_BlockDense_NumBlocks(SUNMatrix A)
+{
+  SUNFunctionBegin(A->sunctx);
+  SUNAssertNoRet(SUNMatGetID(A) == SUNMATRIX_BLOCKDENSE, SUN_ERR_ARG_WRONGTYPE);
+  return SM_NUMBLOCKS_BD(A);
+}
+
+sunindextype SUNMatrix_BlockDense_LData(SUNMatrix A)
+{
+  SUNFunctionBegin(A->sunctx);
+  SUNAssertNoRet(SUNMatGetID(A) == SUNMATRIX_BLOCKDENSE, SUN_ERR_ARG_WRONGTYPE);
+  return SM_LDATA_BD(A);
+}
+
+sunrealtype* SUNMatrix_BlockDense_Data(SUNMatrix A)
+{
+  SUNFunctionBegin(A->sunctx);
+  SUNAssertNull(SUNMatGetID(A) == SUNMATRIX_BLOCKDENSE, SUN_ERR_ARG_WRONGTYPE);
+  return SM_DATA_BD(A);
+}
+
+sunrealtype* SUNMatrix_BlockDense_Element(SUNMatrix A, sunindextype k,
+                                          sunindextype i, sunindextype j)
+{
+  SUNFunctionBegin(A->sunctx);
+  SUNAssertNull(SUNMatGetID(A) == SUNMATRIX_BLOCKDENSE, SUN_ERR_ARG_WRONGTYPE);
+  SUNAssertNull(k >= 0 && k < SM_NUMBLOCKS_BD(A), SUN_ERR_ARG_OUTOFRANGE);
+  SUNAssertNull(i >= 0 && i < SM_BLOCKROWS_BD(A), SUN_ERR_ARG_OUTOFRANGE);
+  SUNAssertNull(j >= 0 && j < SM_BLOCKCOLUMNS_BD(A), SUN_ERR_ARG_OUTOFRANGE);
+  return &SM_ELEMENT_BD(A, k, i, j);
+}
+
+/*
+ * -----------------------------------------------------------------
+ * implementation of matrix operations
+ * -----------------------------------------------------------------
+ */
+
+SUNMatrix_ID SUNMatGetID_BlockDense(SUNDIALS_MAYBE_UNUSED SUNMatrix A)
+{
+  return SUNMATRIX_BLOCKDENSE;
+}
+
+SUNMatrix SUNMatClone_BlockDense(SUNMatrix A)
+{
+  SUNFunctionBegin(A->sunctx);
+  SUNMatrix B = SUNMatrix_BlockDense(SM_NUMBLOCKS_BD(A), SM_BLOCKROWS_BD(A),
+                                     SM_BLOCKCOLUMNS_BD(A), A->sunctx);
+  SUNCheckLastErrNull();
+  return (B);
+}
+
+void SUNMatDestroy_BlockDense(SUNMatrix A)
+{
+  if (A == NULL) { return; }
+
+  /* free content */
+  if (A->content != NULL)
+  {
+    /* free data array */
+    if (SM_DATA_BD(A) != NULL)
+    {
+      free(SM_DATA_BD(A));
+      SM_DATA_BD(A) = NULL;
+    }
+    /* free content struct */
+    free(A->content);
+    A->content = NULL;
+  }
+
+  /* free ops and matrix */
+  if (A->ops)
+  {
+    free(A->ops);
+    A->ops = NULL;
+  }
+  free(A);
+  A = NULL;
+
+  return;
+}
+
+SUNErrCode SUNMatZero_BlockDense(SUNMatrix A)
+{
+  SUNFunctionBegin(A->sunctx);
+  sunindextype i;
+  sunrealtype* Adata;
+
+  SUNAssert(SUNMatGetID(A) == SUNMATRIX_BLOCKDENSE, SUN_ERR_ARG_WRONGTYPE);
+
+  /* Perform operation A_ij = 0 */
+  Adata = SM_DATA_BD(A);
+  for (i = 0; i < SM_LDATA_BD(A); i++) { Adata[i] = ZERO; }
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNMatCopy_BlockDense(SUNMatrix A, SUNMatrix B)
+{
+  SUNFunctionBegin(A->sunctx);
+  sunindextype i;
+  sunrealtype *Adata, *Bdata;
+
+  SUNAssert(SUNMatGetID(A) == SUNMATRIX_BLOCKDENSE, SUN_ERR_ARG_WRONGTYPE);
+  SUNAssert(SUNMatGetID(B) == SUNMATRIX_BLOCKDENSE, SUN_ERR_ARG_WRONGTYPE);
+  SUNCheck(compatibleMatrices(A, B), SUN_ERR_ARG_DIMSMISMATCH);
+
+  /* Perform operation B_ij = A_ij */
+  Adata = SM_DATA_BD(A);
+  Bdata = SM_DATA_BD(B);
+  for (i = 0; i < SM_LDATA_BD(A); i++) { Bdata[i] = Adata[i]; }
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNMatScaleAddI_BlockDense(sunrealtype c, SUNMatrix A)
+{
+  SUNFunctionBegin(A->sunctx);
+  sunindextype g, i, l, ndiag;
+  sunrealtype *Adata, *Gdata;
+
+  SUNAssert(SUNMatGetID(A) == SUNMATRIX_BLOCKDENSE, SUN_ERR_ARG_WRONGTYPE);
+
+  /* Perform operation A = c*A + I */
+  Adata = SM_DATA_BD(A);
+  for (i = 0; i < SM_LDATA_BD(A); i++) { Adata[i] *= c; }
+
+  /* Add one to the diagonal of every block, including padding blocks */
+  ndiag = SUNMIN(SM_BLOCKROWS_BD(A), SM_BLOCKCOLUMNS_BD(A));
+  for (g = 0; g < SM_NUMGROUPS_BD(A); g++)
+  {
+    Gdata = SM_GROUP_BD(A, g);
+    for (i = 0; i < ndiag; i++)
+    {
+      sunrealtype* diag = Gdata + (i * SM_BLOCKROWS_BD(A) + i) * GSIZE;
+      for (l = 0; l < GSIZE; l++) { diag[l] += ONE; }
+    }
+  }
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNMatScaleAdd_BlockDense(sunrealtype c, SUNMatrix A, SUNMatrix B)
+{
+  SUNFunctionBegin(A->sunctx);
+  sunindextype i;
+  sunrealtype *Adata, *Bdata;
+
+  SUNAssert(SUNMatGetID(A) == SUNMATRIX_BLOCKDENSE, SUN_ERR_ARG_WRONGTYPE);
+  SUNAssert(SUNMatGetID(B) == SUNMATRIX_BLOCKDENSE, SUN_ERR_ARG_WRONGTYPE);
+  SUNCheck(compatibleMatrices(A, B), SUN_ERR_ARG_DIMSMISMATCH);
+
+  /* Perform operation A = c*A + B */
+  Adata = SM_DATA_BD(A);
+  Bdata = SM_DATA_BD(B);
+  for (i = 0; i < SM_LDATA_BD(A); i++) { Adata[i] = c * Adata[i] + Bdata[i]; }
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNMatMatvec_BlockDense(SUNMatrix A, N_Vector x, N_Vector y)
+{
+  SUNFunctionBegin(A->sunctx);
+  sunrealtype *xd, *yd;
+  sunindextype g;
+  const sunindextype M       = SM_BLOCKROWS_BD(A);
+  const sunindextype N       = SM_BLOCKCOLUMNS_BD(A);
+  const sunindextype nblocks = SM_NUMBLOCKS_BD(A);
+
+  SUNAssert(SUNMatGetID(A) == SUNMATRIX_BLOCKDENSE, SUN_ERR_ARG_WRONGTYPE);
+  SUNCheck(compatibleMatrixAndVectors(A, x, y), SUN_ERR_ARG_DIMSMISMATCH);
+
+  /* access vector data (return if NULL data pointers) */
+  xd = N_VGetArrayPointer(x);
+  SUNCheckLastErr();
+  yd = N_VGetArrayPointer(y);
+  SUNCheckLastErr();
+
+  SUNAssert(xd, SUN_ERR_MEM_FAIL);
+  SUNAssert(yd, SUN_ERR_MEM_FAIL);
+  SUNAssert(xd != yd, SUN_ERR_MEM_FAIL);
+
+  /* Perform operation y = Ax one block group at a time */
+#if defined(SUNDIALS_OPENMP_ENABLED)
+#pragma omp parallel for schedule(static) if (SM_NUMGROUPS_BD(A) > 1)
+#endif
+  for (g = 0; g < SM_NUMGROUPS_BD(A); g++)
+  {
+    const sunrealtype* Gdata = SM_GROUP_BD(A, g);
+    const sunindextype k0    = g * GSIZE;
+    const sunindextype nl    = SUNMIN(GSIZE, nblocks - k0);
+    sunindextype i, j, l;
+
+    for (l = 0; l < nl; l++)
+    {
+      for (i = 0; i < M; i++) { yd[(k0 + l) * M + i] = ZERO; }
+    }
+    for (j = 0; j < N; j++)
+    {
+      for (i = 0; i < M; i++)
+      {
+        const sunrealtype* a_ij = Gdata + (j * M + i) * GSIZE;
+        for (l = 0; l < nl; l++)
+        {
+          yd[(k0 + l) * M + i] += a_ij[l] * xd[(k0 + l) * N + j];
+        }
+      }
+    }
+  }
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNMatHermitianTransposeVec_BlockDense(SUNMatrix A, N_Vector x,
+                                                  N_Vector y)
+{
+  SUNFunctionBegin(A->sunctx);
+  sunrealtype *xd, *yd;
+  sunindextype g;
+  const sunindextype M       = SM_BLOCKROWS_BD(A);
+  const sunindextype N       = SM_BLOCKCOLUMNS_BD(A);
+  const sunindextype nblocks = SM_NUMBLOCKS_BD(A);
+
+  SUNAssert(SUNMatGetID(A) == SUNMATRIX_BLOCKDENSE, SUN_ERR_ARG_WRONGTYPE);
+  SUNCheck(compatibleMatrixAndVectors(A, y, x), SUN_ERR_ARG_DIMSMISMATCH);
+
+  /* access vector data (return if NULL data pointers) */
+  xd = N_VGetArrayPointer(x);
+  SUNCheckLastErr();
+  yd = N_VGetArrayPointer(y);
+  SUNCheckLastErr();
+
+  SUNAssert(xd, SUN_ERR_MEM_FAIL);
+  SUNAssert(yd, SUN_ERR_MEM_FAIL);
+  SUNAssert(xd != yd, SUN_ERR_MEM_FAIL);
+
+  /* Perform operation y = A^T x one block group at a time */
+#if defined(SUNDIALS_OPENMP_ENABLED)
+#pragma omp parallel for schedule(static) if (SM_NUMGROUPS_BD(A) > 1)
+#endif
+  for (g = 0; g < SM_NUMGROUPS_BD(A); g++)
+  {
+    const sunrealtype* Gdata = SM_GROUP_BD(A, g);
+    const sunindextype k0    = g * GSIZE;
+    const sunindextype nl    = SUNMIN(GSIZE, nblocks - k0);
+    sunindextype i, j, l;
+
+    for (l = 0; l < nl; l++)
+    {
+      for (j = 0; j < N; j++) { yd[(k0 + l) * N + j] = ZERO; }
+    }
+    for (j = 0; j < N; j++)
+    {
+      for (i = 0; i < M; i++)
+      {
+        const sunrealtype* a_ij = Gdata + (j * M + i) * GSIZE;
+        for (l = 0; l < nl; l++)
+        {
+          yd[(k0 + l) * N + j] += a_ij[l] * xd[(k0 + l) * M + i];
+        }
+      }
+    }
+  }
+
+  return SUN_SUCCESS;
+}
+
+/*
+ * -----------------------------------------------------------------
+ * private functions
+ * -----------------------------------------------------------------
+ */
+
+SUNDIALS_MAYBE_UNUSED
+static sunbooleantype compatibleMatrices(SUNMatrix A, SUNMatrix B)
+{
+  /* both matrices must have the same number and shape of blocks */
+  if ((SM_NUMBLOCKS_BD(A) != SM_NUMBLOCKS_BD(B)) ||
+      (SM_BLOCKROWS_BD(A) != SM_BLOCKROWS_BD(B)) ||
+      (SM_BLOCKCOLUMNS_BD(A) != SM_BLOCKCOLUMNS_BD(B)))
+  {
+    return SUNFALSE;
+  }
+
+  return SUNTRUE;
+}
+
+SUNDIALS_MAYBE_UNUSED
+static sunbooleantype compatibleMatrixAndVectors(SUNMatrix A, N_Vector x,
+                                                 N_Vector y)
+{
+  /* Vectors must provide nvgetarraypointer and cannot be a parallel vector */
+  if (!x->ops->nvgetarraypointer || !y->ops->nvgetarraypointer)
+  {
+    return SUNFALSE;
+  }
+
+  /* Check that the dimensions agree */
+  if ((N_VGetLength(x) != SM_COLUMNS_BD(A)) ||
+      (N_VGetLength(y) != SM_ROWS_BD(A)))
+  {
+    return SUNFALSE;
+  }
+
+  return SUNTRUE;
+}
@@ -36,9 +36,40 @@
 
 #include "sundials_macros.h"
 
+#if defined(SUNDIALS_OPENMP_ENABLED)
+#include <omp.h>
+#endif
+
 #define ZERO SUN_RCONST(0.0)
 #define ONE  SUN_RCONST(1.0)
 
+/* minimum number of nonzeros for threading the pattern-locked operations and
+   the matrix-vector products */
+#define SPARSE_OMP_MIN_NNZ 100000
+
+/* rows per slice (C) and sorting window (sigma) of the SELL-C-sigma format */
+#define SPARSE_SELL_C     8
+#define SPARSE_SELL_SIGMA 256
+
+/* Cached structures for SUNMatMatvec with a locked pattern. The products
+   always read the values from the data array of the matrix, so only the
+   pattern is cached. */
+struct _SUNSparseMatvecData
+{
+  sunindextype nnz; /* nonzeros when the structures were built         */
+  /* CSR shadow of a CSC matrix */
+  sunindextype* tptrs; /* row pointers                                  */
+  sunindextype* tvals; /* column index of each entry                    */
+  sunindextype* tpos;  /* position of each entry in the data array      */
+  /* SELL-C-sigma slices of the rows of a CSR matrix (or CSR shadow) */
+  sunindextype nslices;
+  sunindextype* sperm; /* rows sorted by length in windows of sigma     */
+  sunindextype* sptrs; /* start of each slice in scols and spos         */
+  sunindextype* smin;  /* length of the shortest row in each slice      */
+  sunindextype* scols; /* column of each interleaved entry              */
+  sunindextype* spos;  /* position in the data array of each such entry */
+};
+
 /* Private function prototypes */
 static sunbooleantype compatibleMatrices(SUNMatrix A, SUNMatrix B);
 static sunbooleantype compatibleMatrixAndVectors(SUNMatrix A, N_Vector x,
@@ -48,6 +79,25 @@ static SUNErrCode Matvec_SparseCSR(SUNMatrix A, N_Vector x, N_Vector y);
 static SUNErrCode MatTransposeVec_SparseCSC(SUNMatrix A, N_Vector x, N_Vector y);
 static SUNErrCode MatTransposeVec_SparseCSR(SUNMatrix A, N_Vector x, N_Vector y);
 static SUNErrCode format_convert(const SUNMatrix A, SUNMatrix B);
+static SUNErrCode buildDiagIndex(SUNMatrix A);
+static SUNErrCode buildAddIndex(SUNMatrix A, SUNMatrix B);
+static sunbooleantype validDiagIndex(SUNMatrix A);
+static sunbooleantype validAddIndex(SUNMatrix A, SUNMatrix B);
+static void freeLockedIndices(SUNMatrix A);
+static SUNErrCode updateMatvecData(SUNMatrix A);
+static SUNErrCode buildShadowCSR(SUNMatrix A);
+static SUNErrCode buildSlicesSELL(SUNMatrix A);
+static void freeMatvecData(SUNMatrix A);
+static sunindextype rowPartition(const sunindextype* ptrs, sunindextype nrows,
+                                 int part, int nparts);
+static void gatherProduct(sunindextype nrows, const sunindextype* ptrs,
+                          const sunindextype* idx, const sunindextype* pos,
+                          const sunrealtype* data, const sunrealtype* xd,
+                          sunrealtype* yd);
+static void sellProduct(struct _SUNSparseMatvecData* md, sunindextype nrows,
+                        const sunindextype* ptrs, const sunindextype* idx,
+                        const sunindextype* pos, const sunrealtype* data,
+                        const sunrealtype* xd, sunrealtype* yd);
 
 /*
  * -----------------------------------------------------------------
@@ -126,9 +176,17 @@ SUNMatrix SUNSparseMatrix(sunindextype M, sunindextype N, sunindextype NNZ,
     content->rowvals = NULL;
     content->colptrs = NULL;
   }
-  content->data      = NULL;
-  content->indexvals = NULL;
-  content->indexptrs = NULL;
+  content->data          = NULL;
+  content->indexvals     = NULL;
+  content->indexptrs     = NULL;
+  content->locked        = SUNFALSE;
+  content->diagidx       = NULL;
+  content->diag_nnz      = 0;
+  content->addidx        = NULL;
+  content->add_nnz       = 0;
+  content->add_bnnz      = 0;
+  content->matvec_format = SUN_SPARSE_MATVEC_DEFAULT;
+  content->matvec_data   = NULL;
 
   /* Allocate content */
   content->data = (sunrealtype*)calloc(NNZ, sizeof(sunrealtype));
@@ -388,6 +446,48 @@ SUNErrCode SUNSparseMatrix_Reallocate(SUNMatrix A, sunindextype NNZ)
   return SUN_SUCCESS;
 }
 
+/* ----------------------------------------------------------------------------
+ * Function to lock (or unlock) the sparsity pattern of a sparse matrix. While
+ * locked, SUNMatScaleAddI and SUNMatScaleAdd store the position of the
+ * diagonal in each column (row) and the position in A of each nonzero of B the
+ * first time they are called, and reuse them to update A in a single pass
+ * without allocations as long as the number of nonzeros does not change.
+ */
+
+SUNErrCode SUNSparseMatrix_LockPattern(SUNMatrix A, sunbooleantype lock)
+{
+  SUNFunctionBegin(A->sunctx);
+  SUNAssert(SUNMatGetID(A) == SUNMATRIX_SPARSE, SUN_ERR_ARG_WRONGTYPE);
+
+  if (!lock) { freeLockedIndices(A); }
+  SM_CONTENT_S(A)->locked = lock;
+
+  return SUN_SUCCESS;
+}
+
+/* ----------------------------------------------------------------------------
+ * Function to set the storage used by SUNMatMatvec when the pattern is locked.
+ * With SUN_SPARSE_MATVEC_DEFAULT, CSR matrices are used as is and the product
+ * with a CSC matrix uses a CSR copy of its pattern. With SUN_SPARSE_MATVEC_SELL,
+ * the rows are additionally grouped into slices of rows with similar lengths
+ * (SELL-C-sigma) so that the product can be vectorized across rows. The
+ * storage is built at the first product after locking the pattern.
+ */
+
+SUNErrCode SUNSparseMatrix_SetMatvecFormat(SUNMatrix A, int format)
+{
+  SUNFunctionBegin(A->sunctx);
+  SUNAssert(SUNMatGetID(A) == SUNMATRIX_SPARSE, SUN_ERR_ARG_WRONGTYPE);
+  SUNAssert(format == SUN_SPARSE_MATVEC_DEFAULT ||
+              format == SUN_SPARSE_MATVEC_SELL,
+            SUN_ERR_ARG_OUTOFRANGE);
+
+  if (format != SM_CONTENT_S(A)->matvec_format) { freeMatvecData(A); }
+  SM_CONTENT_S(A)->matvec_format = format;
+
+  return SUN_SUCCESS;
+}
+
 /* ----------------------------------------------------------------------------
  * Function to print the sparse matrix
  */
@@ -540,6 +640,8 @@ void SUNMatDestroy_Sparse(SUNMatrix A)
       SM_CONTENT_S(A)->colptrs = NULL;
       SM_CONTENT_S(A)->rowptrs = NULL;
     }
+    /* free pattern-locked index arrays */
+    freeLockedIndices(A);
     /* free content struct */
     free(A->content);
     A->content = NULL;
@@ -634,6 +736,27 @@ SUNErrCode SUNMatScaleAddI_Sparse(sunrealtype c, SUNMatrix A)
   sunrealtype* Ax = SM_DATA_S(A);
   SUNAssert(Ax, SUN_ERR_ARG_CORRUPT);
 
+  /* With a locked pattern, update the values using the stored diagonal
+     positions if they are still the diagonal entries of A */
+  if (SM_CONTENT_S(A)->locked && SM_CONTENT_S(A)->diagidx &&
+      SM_CONTENT_S(A)->diag_nnz == Ap[N] && validDiagIndex(A))
+  {
+    const sunindextype* d = SM_CONTENT_S(A)->diagidx;
+    sunindextype j, i;
+
+#if defined(SUNDIALS_OPENMP_ENABLED)
+#pragma omp parallel for private(i) \
+  schedule(static) if (Ap[N] >= SPARSE_OMP_MIN_NNZ)
+#endif
+    for (j = 0; j < N; j++)
+    {
+      for (i = Ap[j]; i < Ap[j + 1]; i++) { Ax[i] *= c; }
+      if (d[j] >= 0) { Ax[d[j]] += ONE; }
+    }
+
+    return SUN_SUCCESS;
+  }
+
   sunindextype newvals = 0;
   for (sunindextype j = 0; j < N; j++)
   {
@@ -687,6 +810,14 @@ SUNErrCode SUNMatScaleAddI_Sparse(sunrealtype c, SUNMatrix A)
     }
   }
 
+  /* With a locked pattern, store the positions for the next call. The
+     pattern may have changed, so the cached matvec structures are rebuilt. */
+  if (SM_CONTENT_S(A)->locked)
+  {
+    SUNCheckCall(buildDiagIndex(A));
+    freeMatvecData(A);
+  }
+
   return SUN_SUCCESS;
 }
 
@@ -731,6 +862,27 @@ SUNErrCode SUNMatScaleAdd_Sparse(sunrealtype c, SUNMatrix A, SUNMatrix B)
   Bx = SM_DATA_S(B);
   SUNAssert(Bx, SUN_ERR_ARG_CORRUPT);
 
+  /* With a locked pattern, scatter B into A using the stored positions if
+     they still match the patterns of A and B */
+  if (SM_CONTENT_S(A)->locked && SM_CONTENT_S(A)->addidx &&
+      SM_CONTENT_S(A)->add_nnz == Ap[N] &&
+      SM_CONTENT_S(A)->add_bnnz == Bp[N] && validAddIndex(A, B))
+  {
+    const sunindextype* map = SM_CONTENT_S(A)->addidx;
+
+#if defined(SUNDIALS_OPENMP_ENABLED)
+#pragma omp parallel for private(i) schedule(static) \
+  if (Ap[N] >= SPARSE_OMP_MIN_NNZ)
+#endif
+    for (j = 0; j < N; j++)
+    {
+      for (i = Ap[j]; i < Ap[j + 1]; i++) { Ax[i] *= c; }
+      for (i = Bp[j]; i < Bp[j + 1]; i++) { Ax[map[i]] += Bx[i]; }
+    }
+
+    return SUN_SUCCESS;
+  }
+
   /* create work arrays for row indices and nonzero column values */
   w = (sunindextype*)malloc(M * sizeof(sunindextype));
   SUNAssert(w, SUN_ERR_MALLOC_FAIL);
@@ -920,6 +1072,14 @@ SUNErrCode SUNMatScaleAdd_Sparse(sunrealtype c, SUNMatrix A, SUNMatrix B)
   free(w);
   free(x);
 
+  /* With a locked pattern, store the positions for the next call. The
+     pattern may have changed, so the cached matvec structures are rebuilt. */
+  if (SM_CONTENT_S(A)->locked)
+  {
+    SUNCheckCall(buildAddIndex(A, B));
+    freeMatvecData(A);
+  }
+
   /* return success */
   return SUN_SUCCESS;
 }
@@ -930,6 +1090,49 @@ SUNErrCode SUNMatMatvec_Sparse(SUNMatrix A, N_Vector x, N_Vector y)
   SUNAssert(SUNMatGetID(A) == SUNMATRIX_SPARSE, SUN_ERR_ARG_WRONGTYPE);
   SUNCheck(compatibleMatrixAndVectors(A, x, y), SUN_ERR_ARG_DIMSMISMATCH);
 
+  /* With a locked pattern, use the cached CSR shadow or SELL-C-sigma slices */
+  if (SM_CONTENT_S(A)->locked &&
+      (SM_SPARSETYPE_S(A) == SUN_CSC_MAT ||
+       SM_CONTENT_S(A)->matvec_format == SUN_SPARSE_MATVEC_SELL))
+  {
+    struct _SUNSparseMatvecData* md;
+    const sunindextype *ptrs, *idx, *pos;
+    sunrealtype *xd, *yd;
+
+    SUNCheckCall(updateMatvecData(A));
+    md = SM_CONTENT_S(A)->matvec_data;
+
+    xd = N_VGetArrayPointer(x);
+    SUNCheckLastErr();
+    yd = N_VGetArrayPointer(y);
+    SUNCheckLastErr();
+    SUNAssert(xd != yd, SUN_ERR_ARG_CORRUPT);
+
+    if (SM_SPARSETYPE_S(A) == SUN_CSC_MAT)
+    {
+      ptrs = md->tptrs;
+      idx  = md->tvals;
+      pos  = md->tpos;
+    }
+    else
+    {
+      ptrs = SM_INDEXPTRS_S(A);
+      idx  = SM_INDEXVALS_S(A);
+      pos  = NULL;
+    }
+
+    if (SM_CONTENT_S(A)->matvec_format == SUN_SPARSE_MATVEC_SELL)
+    {
+      sellProduct(md, SM_ROWS_S(A), ptrs, idx, pos, SM_DATA_S(A), xd, yd);
+    }
+    else
+    {
+      gatherProduct(SM_ROWS_S(A), ptrs, idx, pos, SM_DATA_S(A), xd, yd);
+    }
+
+    return SUN_SUCCESS;
+  }
+
   /* Perform operation */
   if (SM_SPARSETYPE_S(A) == SUN_CSC_MAT)
   {
@@ -1060,7 +1263,6 @@ SUNErrCode Matvec_SparseCSC(SUNMatrix A, N_Vector x, N_Vector y)
 
 SUNErrCode MatTransposeVec_SparseCSC(SUNMatrix A, N_Vector x, N_Vector y)
 {
-  sunindextype i, j;
   sunindextype *Ap, *Ai;
   sunrealtype *Ax, *xd, *yd;
   SUNFunctionBegin(A->sunctx);
@@ -1079,15 +1281,8 @@ SUNErrCode MatTransposeVec_SparseCSC(SUNMatrix A, N_Vector x, N_Vector y)
   yd = N_VGetArrayPointer(y);
   SUNCheckLastErr();
 
-  /* initialize result vector */
-  for (i = 0; i < SM_COLUMNS_S(A); i++) { yd[i] = ZERO; }
-
-  /* iterate through matrix columns (rows of the transposed matrix) */
-  for (j = 0; j < SM_COLUMNS_S(A); j++)
-  {
-    /* iterate through non-zero elements in the current column */
-    for (i = Ap[j]; i < Ap[j + 1]; i++) { yd[j] += Ax[i] * xd[Ai[i]]; }
-  }
+  /* the columns of A are the rows of the transposed matrix */
+  gatherProduct(SM_COLUMNS_S(A), Ap, Ai, NULL, Ax, xd, yd);
 
   return SUN_SUCCESS;
 }
@@ -1101,7 +1296,6 @@ SUNErrCode MatTransposeVec_SparseCSC(SUNMatrix A, N_Vector x, N_Vector y)
  */
 SUNErrCode Matvec_SparseCSR(SUNMatrix A, N_Vector x, N_Vector y)
 {
-  sunindextype i, j;
   sunindextype *Ap, *Aj;
   sunrealtype *Ax, *xd, *yd;
   SUNFunctionBegin(A->sunctx);
@@ -1123,15 +1317,8 @@ SUNErrCode Matvec_SparseCSR(SUNMatrix A, N_Vector x, N_Vector y)
   SUNAssert(yd, SUN_ERR_ARG_CORRUPT);
   SUNAssert(xd != yd, SUN_ERR_ARG_CORRUPT);
 
-  /* initialize result */
-  for (i = 0; i < SM_ROWS_S(A); i++) { yd[i] = ZERO; }
-
-  /* iterate through matrix rows */
-  for (i = 0; i < SM_ROWS_S(A); i++)
-  {
-    /* iterate along row of A, performing product */
-    for (j = Ap[i]; j < Ap[i + 1]; j++) { yd[i] += Ax[j] * xd[Aj[j]]; }
-  }
+  /* iterate through matrix rows, performing the product */
+  gatherProduct(SM_ROWS_S(A), Ap, Aj, NULL, Ax, xd, yd);
 
   return SUN_SUCCESS;
 }
@@ -1247,3 +1434,510 @@ SUNErrCode format_convert(const SUNMatrix A, SUNMatrix B)
 
   return SUN_SUCCESS;
 }
+
+/* -----------------------------------------------------------------
+ * Function to store the position of the diagonal in each column (row) of a
+ * pattern-locked matrix, or -1 if the column (row) has no diagonal element
+ */
+
+SUNErrCode buildDiagIndex(SUNMatrix A)
+{
+  SUNFunctionBegin(A->sunctx);
+  const sunindextype NP  = SM_NP_S(A);
+  const sunindextype* Ap = SM_INDEXPTRS_S(A);
+  const sunindextype* Ai = SM_INDEXVALS_S(A);
+  sunindextype j, i;
+
+  if (SM_CONTENT_S(A)->diagidx == NULL)
+  {
+    SM_CONTENT_S(A)->diagidx =
+      (sunindextype*)malloc(SUNMAX(NP, 1) * sizeof(sunindextype));
+    SUNAssert(SM_CONTENT_S(A)->diagidx, SUN_ERR_MALLOC_FAIL);
+  }
+
+  for (j = 0; j < NP; j++)
+  {
+    SM_CONTENT_S(A)->diagidx[j] = -1;
+    for (i = Ap[j]; i < Ap[j + 1]; i++)
+    {
+      if (Ai[i] == j) { SM_CONTENT_S(A)->diagidx[j] = i; }
+    }
+  }
+  SM_CONTENT_S(A)->diag_nnz = Ap[NP];
+
+  return SUN_SUCCESS;
+}
+
+/* -----------------------------------------------------------------
+ * Function to store the position in a pattern-locked matrix A of each nonzero
+ * of B. The pattern of B must be contained in the pattern of A.
+ */
+
+SUNErrCode buildAddIndex(SUNMatrix A, SUNMatrix B)
+{
+  SUNFunctionBegin(A->sunctx);
+  const sunindextype NP  = SM_NP_S(A);
+  const sunindextype M   = (SM_SPARSETYPE_S(A) == SUN_CSC_MAT) ? SM_ROWS_S(A)
+                                                               : SM_COLUMNS_S(A);
+  const sunindextype* Ap = SM_INDEXPTRS_S(A);
+  const sunindextype* Ai = SM_INDEXVALS_S(A);
+  const sunindextype* Bp = SM_INDEXPTRS_S(B);
+  const sunindextype* Bi = SM_INDEXVALS_S(B);
+  sunindextype *w, *map;
+  sunindextype j, i;
+
+  /* work array with the position in A of each row (column) of the current
+     column (row), or -1 if it is not in the pattern */
+  w = (sunindextype*)malloc(SUNMAX(M, 1) * sizeof(sunindextype));
+  SUNAssert(w, SUN_ERR_MALLOC_FAIL);
+  for (i = 0; i < M; i++) { w[i] = -1; }
+
+  free(SM_CONTENT_S(A)->addidx);
+  map = (sunindextype*)malloc(SUNMAX(Bp[NP], 1) * sizeof(sunindextype));
+  SM_CONTENT_S(A)->addidx = map;
+  if (map == NULL) { free(w); }
+  SUNAssert(map, SUN_ERR_MALLOC_FAIL);
+
+  for (j = 0; j < NP; j++)
+  {
+    for (i = Ap[j]; i < Ap[j + 1]; i++) { w[Ai[i]] = i; }
+    for (i = Bp[j]; i < Bp[j + 1]; i++) { map[i] = w[Bi[i]]; }
+    for (i = Ap[j]; i < Ap[j + 1]; i++) { w[Ai[i]] = -1; }
+  }
+  free(w);
+
+  SM_CONTENT_S(A)->add_nnz  = Ap[NP];
+  SM_CONTENT_S(A)->add_bnnz = Bp[NP];
+
+  return SUN_SUCCESS;
+}
+
+/* -----------------------------------------------------------------
+ * Function to check that the stored diagonal positions of a pattern-locked
+ * matrix are the diagonal entries of its current pattern. Columns (rows) that
+ * can hold a diagonal entry always have one once buildDiagIndex has run.
+ */
+
+sunbooleantype validDiagIndex(SUNMatrix A)
+{
+  const sunindextype NP  = SM_NP_S(A);
+  const sunindextype M   = (SM_SPARSETYPE_S(A) == SUN_CSC_MAT) ? SM_ROWS_S(A)
+                                                               : SM_COLUMNS_S(A);
+  const sunindextype* Ap = SM_INDEXPTRS_S(A);
+  const sunindextype* Ai = SM_INDEXVALS_S(A);
+  const sunindextype* d  = SM_CONTENT_S(A)->diagidx;
+  sunindextype j;
+  int valid = 1;
+
+#if defined(SUNDIALS_OPENMP_ENABLED)
+#pragma omp parallel for reduction(&& : valid) schedule(static) \
+  if (Ap[NP] >= SPARSE_OMP_MIN_NNZ)
+#endif
+  for (j = 0; j < NP; j++)
+  {
+    if (j < M)
+    {
+      valid = valid && d[j] >= Ap[j] && d[j] < Ap[j + 1] && Ai[d[j]] == j;
+    }
+  }
+
+  return valid ? SUNTRUE : SUNFALSE;
+}
+
+/* -----------------------------------------------------------------
+ * Function to check that the stored position in a pattern-locked matrix A of
+ * each nonzero of B holds the same row (column) in the same column (row) of A.
+ * The stored positions may have been built for a different B or a different
+ * pattern of A with the same number of nonzeros.
+ */
+
+sunbooleantype validAddIndex(SUNMatrix A, SUNMatrix B)
+{
+  const sunindextype NP    = SM_NP_S(A);
+  const sunindextype* Ap   = SM_INDEXPTRS_S(A);
+  const sunindextype* Ai   = SM_INDEXVALS_S(A);
+  const sunindextype* Bp   = SM_INDEXPTRS_S(B);
+  const sunindextype* Bi   = SM_INDEXVALS_S(B);
+  const sunindextype* map  = SM_CONTENT_S(A)->addidx;
+  sunindextype j, i;
+  int valid = 1;
+
+#if defined(SUNDIALS_OPENMP_ENABLED)
+#pragma omp parallel for private(i) reduction(&& : valid) schedule(static) \
+  if (Ap[NP] >= SPARSE_OMP_MIN_NNZ)
+#endif
+  for (j = 0; j < NP; j++)
+  {
+    for (i = Bp[j]; i < Bp[j + 1]; i++)
+    {
+      valid = valid && map[i] >= Ap[j] && map[i] < Ap[j + 1] &&
+              Ai[map[i]] == Bi[i];
+    }
+  }
+
+  return valid ? SUNTRUE : SUNFALSE;
+}
+
+/* -----------------------------------------------------------------
+ * Function to free the index arrays of a pattern-locked matrix
+ */
+
+void freeLockedIndices(SUNMatrix A)
+{
+  freeMatvecData(A);
+  free(SM_CONTENT_S(A)->diagidx);
+  SM_CONTENT_S(A)->diagidx  = NULL;
+  SM_CONTENT_S(A)->diag_nnz = 0;
+  free(SM_CONTENT_S(A)->addidx);
+  SM_CONTENT_S(A)->addidx   = NULL;
+  SM_CONTENT_S(A)->add_nnz  = 0;
+  SM_CONTENT_S(A)->add_bnnz = 0;
+}
+
+/* -----------------------------------------------------------------
+ * Function to build (or rebuild, if the number of nonzeros changed) the
+ * cached structures used by SUNMatMatvec with a locked pattern
+ */
+
+SUNErrCode updateMatvecData(SUNMatrix A)
+{
+  SUNFunctionBegin(A->sunctx);
+  struct _SUNSparseMatvecData* md = SM_CONTENT_S(A)->matvec_data;
+
+  if (md && md->nnz == SM_INDEXPTRS_S(A)[SM_NP_S(A)]) { return SUN_SUCCESS; }
+
+  freeMatvecData(A);
+  md = (struct _SUNSparseMatvecData*)calloc(1, sizeof(*md));
+  SUNAssert(md, SUN_ERR_MALLOC_FAIL);
+  SM_CONTENT_S(A)->matvec_data = md;
+
+  if (SM_SPARSETYPE_S(A) == SUN_CSC_MAT) { SUNCheckCall(buildShadowCSR(A)); }
+  if (SM_CONTENT_S(A)->matvec_format == SUN_SPARSE_MATVEC_SELL)
+  {
+    SUNCheckCall(buildSlicesSELL(A));
+  }
+  md->nnz = SM_INDEXPTRS_S(A)[SM_NP_S(A)];
+
+  return SUN_SUCCESS;
+}
+
+/* -----------------------------------------------------------------
+ * Function to build a CSR copy of the pattern of a CSC matrix, along with the
+ * position in the data array of each entry, with a counting sort by row
+ */
+
+SUNErrCode buildShadowCSR(SUNMatrix A)
+{
+  SUNFunctionBegin(A->sunctx);
+  struct _SUNSparseMatvecData* md = SM_CONTENT_S(A)->matvec_data;
+  const sunindextype M            = SM_ROWS_S(A);
+  const sunindextype N            = SM_COLUMNS_S(A);
+  const sunindextype* Ap          = SM_INDEXPTRS_S(A);
+  const sunindextype* Ai          = SM_INDEXVALS_S(A);
+  const sunindextype nnz          = Ap[N];
+  sunindextype *next, i, j, p, k;
+
+  md->tptrs = (sunindextype*)calloc(M + 1, sizeof(sunindextype));
+  SUNAssert(md->tptrs, SUN_ERR_MALLOC_FAIL);
+  md->tvals = (sunindextype*)malloc(SUNMAX(nnz, 1) * sizeof(sunindextype));
+  SUNAssert(md->tvals, SUN_ERR_MALLOC_FAIL);
+  md->tpos = (sunindextype*)malloc(SUNMAX(nnz, 1) * sizeof(sunindextype));
+  SUNAssert(md->tpos, SUN_ERR_MALLOC_FAIL);
+  next = (sunindextype*)malloc(SUNMAX(M, 1) * sizeof(sunindextype));
+  SUNAssert(next, SUN_ERR_MALLOC_FAIL);
+
+  /* count the entries in each row and compute the row pointers */
+  for (p = 0; p < nnz; p++) { md->tptrs[Ai[p] + 1]++; }
+  for (i = 0; i < M; i++)
+  {
+    md->tptrs[i + 1] += md->tptrs[i];
+    next[i] = md->tptrs[i];
+  }
+
+  /* scatter the columns, the entries of each row stay sorted by column */
+  for (j = 0; j < N; j++)
+  {
+    for (p = Ap[j]; p < Ap[j + 1]; p++)
+    {
+      k            = next[Ai[p]]++;
+      md->tvals[k] = j;
+      md->tpos[k]  = p;
+    }
+  }
+
+  free(next);
+
+  return SUN_SUCCESS;
+}
+
+/* -----------------------------------------------------------------
+ * Functions to build the SELL-C-sigma slices. Within each window of sigma rows,
+ * the rows are sorted by decreasing length and grouped into slices of C rows.
+ * The first (shortest row length) entries of the rows of a slice are stored
+ * interleaved, so that the product processes the C rows together. The
+ * remaining entries of each row are read from the CSR pattern.
+ */
+
+typedef struct
+{
+  sunindextype len;
+  sunindextype row;
+} sellRowLength;
+
+static int compareRowLength(const void* a, const void* b)
+{
+  const sellRowLength* ra = (const sellRowLength*)a;
+  const sellRowLength* rb = (const sellRowLength*)b;
+
+  if (ra->len != rb->len) { return (ra->len > rb->len) ? -1 : 1; }
+  return (ra->row < rb->row) ? -1 : (ra->row > rb->row);
+}
+
+SUNErrCode buildSlicesSELL(SUNMatrix A)
+{
+  SUNFunctionBegin(A->sunctx);
+  struct _SUNSparseMatvecData* md = SM_CONTENT_S(A)->matvec_data;
+  const sunindextype M            = SM_ROWS_S(A);
+  const sunindextype *ptrs, *idx, *pos;
+  sellRowLength* rows;
+  sunindextype s, r, k, w, r0, cs, row, off;
+
+  /* slice the CSR pattern, or the CSR shadow of a CSC matrix */
+  if (SM_SPARSETYPE_S(A) == SUN_CSC_MAT)
+  {
+    ptrs = md->tptrs;
+    idx  = md->tvals;
+    pos  = md->tpos;
+  }
+  else
+  {
+    ptrs = SM_INDEXPTRS_S(A);
+    idx  = SM_INDEXVALS_S(A);
+    pos  = NULL;
+  }
+
+  md->nslices = (M + SPARSE_SELL_C - 1) / SPARSE_SELL_C;
+
+  md->sperm = (sunindextype*)malloc(SUNMAX(M, 1) * sizeof(sunindextype));
+  SUNAssert(md->sperm, SUN_ERR_MALLOC_FAIL);
+  md->sptrs = (sunindextype*)malloc((md->nslices + 1) * sizeof(sunindextype));
+  SUNAssert(md->sptrs, SUN_ERR_MALLOC_FAIL);
+  md->smin = (sunindextype*)malloc(SUNMAX(md->nslices, 1) *
+                                   sizeof(sunindextype));
+  SUNAssert(md->smin, SUN_ERR_MALLOC_FAIL);
+  rows = (sellRowLength*)malloc(SUNMAX(M, 1) * sizeof(sellRowLength));
+  SUNAssert(rows, SUN_ERR_MALLOC_FAIL);
+
+  /* sort the rows by decreasing length within each window */
+  for (r = 0; r < M; r++)
+  {
+    rows[r].len = ptrs[r + 1] - ptrs[r];
+    rows[r].row = r;
+  }
+  for (w = 0; w < M; w += SPARSE_SELL_SIGMA)
+  {
+    qsort(rows + w, (size_t)SUNMIN(SPARSE_SELL_SIGMA, M - w),
+          sizeof(sellRowLength), compareRowLength);
+  }
+  for (r = 0; r < M; r++) { md->sperm[r] = rows[r].row; }
+
+  /* the shortest row of each slice determines its interleaved part */
+  off = 0;
+  for (s = 0; s < md->nslices; s++)
+  {
+    r0           = s * SPARSE_SELL_C;
+    cs           = SUNMIN(SPARSE_SELL_C, M - r0);
+    md->sptrs[s] = off;
+    md->smin[s]  = rows[r0].len;
+    for (r = 1; r < cs; r++)
+    {
+      md->smin[s] = SUNMIN(md->smin[s], rows[r0 + r].len);
+    }
+    off += md->smin[s] * cs;
+  }
+  md->sptrs[md->nslices] = off;
+  free(rows);
+
+  md->scols = (sunindextype*)malloc(SUNMAX(off, 1) * sizeof(sunindextype));
+  SUNAssert(md->scols, SUN_ERR_MALLOC_FAIL);
+  md->spos = (sunindextype*)malloc(SUNMAX(off, 1) * sizeof(sunindextype));
+  SUNAssert(md->spos, SUN_ERR_MALLOC_FAIL);
+
+  for (s = 0; s < md->nslices; s++)
+  {
+    r0  = s * SPARSE_SELL_C;
+    cs  = SUNMIN(SPARSE_SELL_C, M - r0);
+    off = md->sptrs[s];
+    for (k = 0; k < md->smin[s]; k++)
+    {
+      for (r = 0; r < cs; r++)
+      {
+        row             = md->sperm[r0 + r];
+        md->scols[off]  = idx[ptrs[row] + k];
+        md->spos[off++] = pos ? pos[ptrs[row] + k] : ptrs[row] + k;
+      }
+    }
+  }
+
+  return SUN_SUCCESS;
+}
+
+/* -----------------------------------------------------------------
+ * Function to free the cached structures used by SUNMatMatvec
+ */
+
+void freeMatvecData(SUNMatrix A)
+{
+  struct _SUNSparseMatvecData* md = SM_CONTENT_S(A)->matvec_data;
+
+  if (md == NULL) { return; }
+
+  free(md->tptrs);
+  free(md->tvals);
+  free(md->tpos);
+  free(md->sperm);
+  free(md->sptrs);
+  free(md->smin);
+  free(md->scols);
+  free(md->spos);
+  free(md);
+  SM_CONTENT_S(A)->matvec_data = NULL;
+}
+
+/* -----------------------------------------------------------------
+ * Function to split the rows of a CSR pattern into nparts contiguous parts with
+ * about the same number of nonzeros. Returns the first row of the given part.
+ */
+
+sunindextype rowPartition(const sunindextype* ptrs, sunindextype nrows,
+                          int part, int nparts)
+{
+  sunindextype lo = 0, hi = nrows, mid, target;
+
+  if (part >= nparts) { return nrows; }
+
+  /* find the first row that starts at or after the target nonzero */
+  target = (sunindextype)((double)ptrs[nrows] * part / nparts);
+  while (lo < hi)
+  {
+    mid = lo + (hi - lo) / 2;
+    if (ptrs[mid] < target) { lo = mid + 1; }
+    else { hi = mid; }
+  }
+
+  return lo;
+}
+
+/* -----------------------------------------------------------------
+ * Computes yd = A xd for a CSR pattern (ptrs, idx) with nrows rows. The value
+ * of entry k is data[pos[k]], or data[k] if pos is NULL. With OpenMP, the rows
+ * are split over the threads so that each gets about the same number of
+ * nonzeros.
+ */
+
+void gatherProduct(sunindextype nrows, const sunindextype* ptrs,
+                   const sunindextype* idx, const sunindextype* pos,
+                   const sunrealtype* data, const sunrealtype* xd,
+                   sunrealtype* yd)
+{
+#if defined(SUNDIALS_OPENMP_ENABLED)
+  const sunbooleantype threaded = ptrs[nrows] >= SPARSE_OMP_MIN_NNZ;
+#pragma omp parallel if (threaded)
+#endif
+  {
+    sunindextype lo = 0, hi = nrows, i, k;
+    sunrealtype sum;
+
+#if defined(SUNDIALS_OPENMP_ENABLED)
+    lo = rowPartition(ptrs, nrows, omp_get_thread_num(), omp_get_num_threads());
+    hi = rowPartition(ptrs, nrows, omp_get_thread_num() + 1,
+                      omp_get_num_threads());
+#endif
+
+    if (pos)
+    {
+      for (i = lo; i < hi; i++)
+      {
+        sum = ZERO;
+        for (k = ptrs[i]; k < ptrs[i + 1]; k++)
+        {
+          sum += data[pos[k]] * xd[idx[k]];
+        }
+        yd[i] = sum;
+      }
+    }
+    else
+    {
+      for (i = lo; i < hi; i++)
+      {
+        sum = ZERO;
+        for (k = ptrs[i]; k < ptrs[i + 1]; k++) { sum += data[k] * xd[idx[k]]; }
+        yd[i] = sum;
+      }
+    }
+  }
+}
+
+/* -----------------------------------------------------------------
+ * Computes yd = A xd with the SELL-C-sigma slices of a CSR pattern (ptrs, idx,
+ * pos as in gatherProduct). With OpenMP, the slices are split over the threads.
+ */
+
+void sellProduct(struct _SUNSparseMatvecData* md, sunindextype nrows,
+                 const sunindextype* ptrs, const sunindextype* idx,
+                 const sunindextype* pos, const sunrealtype* data,
+                 const sunrealtype* xd, sunrealtype* yd)
+{
+  sunindextype s;
+
+#if defined(SUNDIALS_OPENMP_ENABLED)
+  const sunbooleantype threaded = ptrs[nrows] >= SPARSE_OMP_MIN_NNZ;
+#pragma omp parallel for schedule(static) if (threaded)
+#endif
+  for (s = 0; s < md->nslices; s++)
+  {
+    const sunindextype r0   = s * SPARSE_SELL_C;
+    const sunindextype cs   = SUNMIN(SPARSE_SELL_C, nrows - r0);
+    const sunindextype mlen = md->smin[s];
+    const sunindextype* sc  = md->scols + md->sptrs[s];
+    const sunindextype* sp  = md->spos + md->sptrs[s];
+    sunrealtype sum[SPARSE_SELL_C];
+    sunindextype r, k, row;
+
+    for (r = 0; r < SPARSE_SELL_C; r++) { sum[r] = ZERO; }
+
+    /* interleaved part, processing the rows of the slice together */
+    if (cs == SPARSE_SELL_C)
+    {
+      for (k = 0; k < mlen; k++)
+      {
+        for (r = 0; r < SPARSE_SELL_C; r++)
+        {
+          sum[r] += data[sp[k * SPARSE_SELL_C + r]] *
+                    xd[sc[k * SPARSE_SELL_C + r]];
+        }
+      }
+    }
+    else
+    {
+      for (k = 0; k < mlen; k++)
+      {
+        for (r = 0; r < cs; r++)
+        {
+          sum[r] += data[sp[k * cs + r]] * xd[sc[k * cs + r]];
+        }
+      }
+    }
+
+    /* remaining entries of each row */
+    for (r = 0; r < cs; r++)
+    {
+      row = md->sperm[r0 + r];
+      for (k = ptrs[row] + mlen; k < ptrs[row + 1]; k++)
+      {
+        sum[r] += data[pos ? pos[k] : k] * xd[idx[k]];
+      }
+      yd[row] = sum[r];
+    }
+  }
+}
@@ -0,0 +1,384 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2025-2026, Lawrence Livermore National Security,
+ * University of Maryland Baltimore County, and the SUNDIALS contributors.
+ * Copyright (c) 2013-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * Copyright (c) 2002-2013, Lawrence Livermore National Security.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * SUNDIALS memory helper implementation that caches system memory
+ * allocations in size-class free lists.
+ *
+ * Requests are rounded up to a size class. Classes start at
+ * SUN_POOL_MIN_BYTES_ and each power of two interval is split into
+ * SUN_POOL_STEPS_ classes, so at most 1/SUN_POOL_STEPS_ of a block
+ * is unused. Freed blocks are pushed onto the free list of their
+ * class (the list link is stored in the block itself) and reused by
+ * later requests of the same class. The SUNMemory structures are
+ * recycled in the same way.
+ * ----------------------------------------------------------------*/
+
+#include <limits.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <sundials/priv/sundials_errors_impl.h>
+#include <sundials/sundials_errors.h>
+#include <sundials/sundials_math.h>
+#include <sundials/sundials_memory.h>
+#include <sunmemory/sunmemory_system.h>
+
+#include "sundials_debug.h"
+#include "sundials_macros.h"
+
+/* smallest size class (must hold a pointer) and log2 of it */
+#define SUN_POOL_MIN_BYTES_ ((size_t)64)
+#define SUN_POOL_MIN_LOG2_  6
+
+/* number of size classes in each power of two interval (a power of two) */
+#define SUN_POOL_STEPS_      4
+#define SUN_POOL_STEPS_LOG2_ 2
+
+/* largest pooled request, larger requests are not cached */
+#define SUN_POOL_BITS_      (sizeof(size_t) * CHAR_BIT)
+#define SUN_POOL_MAX_BYTES_ (((size_t)1) << (SUN_POOL_BITS_ - 2))
+
+#define SUN_POOL_NUM_CLASSES_ \
+  ((SUN_POOL_BITS_ - SUN_POOL_MIN_LOG2_) * SUN_POOL_STEPS_ + 1)
+
+struct SUNMemoryHelper_Content_SysPool_
+{
+  /* allocation statistics (as in SUNMemoryHelper_Sys) */
+  unsigned long num_allocations;
+  unsigned long num_deallocations;
+  size_t bytes_allocated;
+  size_t bytes_high_watermark;
+
+  /* pool statistics */
+  unsigned long num_hits;
+  unsigned long num_misses;
+  size_t bytes_reserved;
+  size_t bytes_cached;
+
+  /* limit on the bytes held in the free lists */
+  size_t max_cached_bytes;
+
+  /* free block lists for each size class and recycled SUNMemory objects */
+  void** free_lists;
+  SUNMemory free_mems;
+};
+
+typedef struct SUNMemoryHelper_Content_SysPool_ SUNMemoryHelper_Content_SysPool;
+
+#define SUNHELPER_CONTENT(h) ((SUNMemoryHelper_Content_SysPool*)h->content)
+
+/* Returns the number of bytes in blocks of the size class class_idx */
+static size_t sunPoolClassSize(size_t class_idx)
+{
+  size_t p, k;
+
+  if (class_idx == 0) { return SUN_POOL_MIN_BYTES_; }
+
+  p = (class_idx - 1) / SUN_POOL_STEPS_ + SUN_POOL_MIN_LOG2_;
+  k = (class_idx - 1) % SUN_POOL_STEPS_ + 1;
+
+  return (((size_t)1) << p) + k * (((size_t)1) << (p - SUN_POOL_STEPS_LOG2_));
+}
+
+/* Returns the size class index for a request of mem_size bytes, requests
+   larger than SUN_POOL_MAX_BYTES_ return the number of classes */
+static size_t sunPoolSizeClass(size_t mem_size)
+{
+  size_t p, step;
+
+  if (mem_size <= SUN_POOL_MIN_BYTES_) { return 0; }
+  if (mem_size > SUN_POOL_MAX_BYTES_) { return SUN_POOL_NUM_CLASSES_; }
+
+  /* mem_size is in (2^p, 2^(p+1)] and the interval is split into steps */
+  p = 0;
+  while (((mem_size - 1) >> (p + 1)) != 0) { p++; }
+
+  step = ((size_t)1) << (p - SUN_POOL_STEPS_LOG2_);
+
+  return (p - SUN_POOL_MIN_LOG2_) * SUN_POOL_STEPS_ +
+         (mem_size - (((size_t)1) << p) + step - 1) / step;
+}
+
+/* Releases cached blocks, starting with the largest classes, until no more
+   than max_cached_bytes are held in the free lists */
+static void sunPoolTrim(SUNMemoryHelper_Content_SysPool* content,
+                        size_t max_cached_bytes)
+{
+  size_t i, class_size;
+
+  for (i = SUN_POOL_NUM_CLASSES_; i > 0; i--)
+  {
+    if (content->bytes_cached <= max_cached_bytes) { break; }
+
+    if (content->free_lists[i - 1] == NULL) { continue; }
+
+    class_size = sunPoolClassSize(i - 1);
+
+    while (content->free_lists[i - 1] != NULL &&
+           content->bytes_cached > max_cached_bytes)
+    {
+      void* block                = content->free_lists[i - 1];
+      content->free_lists[i - 1] = *((void**)block);
+      free(block);
+      content->bytes_cached -= class_size;
+      content->bytes_reserved -= class_size;
+    }
+  }
+}
+
+SUNMemoryHelper SUNMemoryHelper_SysPool(SUNContext sunctx)
+{
+  SUNFunctionBegin(sunctx);
+
+  SUNMemoryHelper helper;
+
+  /* Allocate the helper */
+  helper = SUNMemoryHelper_NewEmpty(sunctx);
+  SUNCheckLastErrNull();
+
+  /* Set the ops */
+  helper->ops->alloc         = SUNMemoryHelper_Alloc_SysPool;
+  helper->ops->allocstrided  = SUNMemoryHelper_AllocStrided_SysPool;
+  helper->ops->dealloc       = SUNMemoryHelper_Dealloc_SysPool;
+  helper->ops->copy          = SUNMemoryHelper_Copy_Sys;
+  helper->ops->getallocstats = SUNMemoryHelper_GetAllocStats_SysPool;
+  helper->ops->clone         = SUNMemoryHelper_Clone_SysPool;
+  helper->ops->destroy       = SUNMemoryHelper_Destroy_SysPool;
+
+  /* Attach content and ops */
+  helper->content = (SUNMemoryHelper_Content_SysPool*)malloc(
+    sizeof(SUNMemoryHelper_Content_SysPool));
+  SUNAssertNull(helper->content, SUN_ERR_MALLOC_FAIL);
+
+  SUNHELPER_CONTENT(helper)->num_allocations      = 0;
+  SUNHELPER_CONTENT(helper)->num_deallocations    = 0;
+  SUNHELPER_CONTENT(helper)->bytes_allocated      = 0;
+  SUNHELPER_CONTENT(helper)->bytes_high_watermark = 0;
+  SUNHELPER_CONTENT(helper)->num_hits             = 0;
+  SUNHELPER_CONTENT(helper)->num_misses           = 0;
+  SUNHELPER_CONTENT(helper)->bytes_reserved       = 0;
+  SUNHELPER_CONTENT(helper)->bytes_cached         = 0;
+  SUNHELPER_CONTENT(helper)->max_cached_bytes     = SIZE_MAX;
+  SUNHELPER_CONTENT(helper)->free_mems            = NULL;
+
+  SUNHELPER_CONTENT(helper)->free_lists =
+    (void**)calloc(SUN_POOL_NUM_CLASSES_, sizeof(void*));
+  SUNAssertNull(SUNHELPER_CONTENT(helper)->free_lists, SUN_ERR_MALLOC_FAIL);
+
+  return helper;
+}
+
+SUNErrCode SUNMemoryHelper_SetMaxCachedBytes_SysPool(SUNMemoryHelper helper,
+                                                     size_t max_cached_bytes)
+{
+  SUNFunctionBegin(helper->sunctx);
+  SUNHELPER_CONTENT(helper)->max_cached_bytes = max_cached_bytes;
+  sunPoolTrim(SUNHELPER_CONTENT(helper), max_cached_bytes);
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNMemoryHelper_Trim_SysPool(SUNMemoryHelper helper)
+{
+  SUNFunctionBegin(helper->sunctx);
+
+  sunPoolTrim(SUNHELPER_CONTENT(helper), 0);
+
+  while (SUNHELPER_CONTENT(helper)->free_mems)
+  {
+    SUNMemory mem                        = SUNHELPER_CONTENT(helper)->free_mems;
+    SUNHELPER_CONTENT(helper)->free_mems = (SUNMemory)mem->ptr;
+    free(mem);
+  }
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNMemoryHelper_GetPoolStats_SysPool(SUNMemoryHelper helper,
+                                                unsigned long* num_hits,
+                                                unsigned long* num_misses,
+                                                size_t* bytes_reserved,
+                                                size_t* bytes_cached)
+{
+  SUNFunctionBegin(helper->sunctx);
+  *num_hits       = SUNHELPER_CONTENT(helper)->num_hits;
+  *num_misses     = SUNHELPER_CONTENT(helper)->num_misses;
+  *bytes_reserved = SUNHELPER_CONTENT(helper)->bytes_reserved;
+  *bytes_cached   = SUNHELPER_CONTENT(helper)->bytes_cached;
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNMemoryHelper_Alloc_SysPool(SUNMemoryHelper helper,
+                                         SUNMemory* memptr, size_t mem_size,
+                                         SUNMemoryType mem_type,
+                                         SUNDIALS_MAYBE_UNUSED void* queue)
+{
+  SUNFunctionBegin(helper->sunctx);
+
+  SUNAssert(mem_type == SUNMEMTYPE_HOST || mem_type == SUNMEMTYPE_UVM,
+            SUN_ERR_ARG_INCOMPATIBLE);
+
+  SUNMemoryHelper_Content_SysPool* content = SUNHELPER_CONTENT(helper);
+
+  SUNMemory mem = NULL;
+  if (content->free_mems)
+  {
+    mem                = content->free_mems;
+    content->free_mems = (SUNMemory)mem->ptr;
+  }
+  else
+  {
+    mem = SUNMemoryNewEmpty(helper->sunctx);
+    SUNCheckLastErr();
+  }
+
+  mem->ptr    = NULL;
+  mem->own    = SUNTRUE;
+  mem->type   = mem_type;
+  mem->bytes  = mem_size;
+  mem->stride = 1;
+
+  size_t class_idx  = sunPoolSizeClass(mem_size);
+  size_t class_size = (class_idx < SUN_POOL_NUM_CLASSES_)
+                        ? sunPoolClassSize(class_idx)
+                        : mem_size;
+
+  if (class_idx < SUN_POOL_NUM_CLASSES_ && content->free_lists[class_idx])
+  {
+    mem->ptr                       = content->free_lists[class_idx];
+    content->free_lists[class_idx] = *((void**)mem->ptr);
+    content->bytes_cached -= class_size;
+    content->num_hits++;
+  }
+  else
+  {
+    mem->ptr = malloc(class_size);
+    SUNAssert(mem->ptr, SUN_ERR_MALLOC_FAIL);
+    content->bytes_reserved += class_size;
+    content->num_misses++;
+  }
+
+  content->bytes_allocated += mem_size;
+  content->num_allocations++;
+  content->bytes_high_watermark = SUNMAX(content->bytes_allocated,
+                                         content->bytes_high_watermark);
+
+  *memptr = mem;
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNMemoryHelper_AllocStrided_SysPool(SUNMemoryHelper helper,
+                                                SUNMemory* memptr,
+                                                size_t mem_size, size_t stride,
+                                                SUNMemoryType mem_type,
+                                                void* queue)
+{
+  SUNFunctionBegin(helper->sunctx);
+
+  SUNCheckCall(
+    SUNMemoryHelper_Alloc_SysPool(helper, memptr, mem_size, mem_type, queue));
+
+  (*memptr)->stride = stride;
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNMemoryHelper_Dealloc_SysPool(SUNMemoryHelper helper,
+                                           SUNMemory mem,
+                                           SUNDIALS_MAYBE_UNUSED void* queue)
+{
+  SUNFunctionBegin(helper->sunctx);
+
+  if (mem == NULL) { return SUN_SUCCESS; }
+
+  SUNAssert(mem->type == SUNMEMTYPE_HOST || mem->type == SUNMEMTYPE_UVM,
+            SUN_ERR_ARG_INCOMPATIBLE);
+
+  SUNMemoryHelper_Content_SysPool* content = SUNHELPER_CONTENT(helper);
+
+  if (mem->ptr != NULL && mem->own)
+  {
+    size_t class_idx  = sunPoolSizeClass(mem->bytes);
+    size_t class_size = (class_idx < SUN_POOL_NUM_CLASSES_)
+                          ? sunPoolClassSize(class_idx)
+                          : mem->bytes;
+
+    content->num_deallocations++;
+    content->bytes_allocated -= mem->bytes;
+
+    if (class_idx < SUN_POOL_NUM_CLASSES_ &&
+        content->bytes_cached + class_size <= content->max_cached_bytes)
+    {
+      *((void**)mem->ptr)            = content->free_lists[class_idx];
+      content->free_lists[class_idx] = mem->ptr;
+      content->bytes_cached += class_size;
+    }
+    else
+    {
+      free(mem->ptr);
+      content->bytes_reserved -= class_size;
+    }
+    mem->ptr = NULL;
+  }
+
+  /* keep the SUNMemory object for reuse, the list link is stored in ptr */
+  mem->ptr           = content->free_mems;
+  content->free_mems = mem;
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNMemoryHelper_GetAllocStats_SysPool(
+  SUNMemoryHelper helper, SUNDIALS_MAYBE_UNUSED SUNMemoryType mem_type,
+  unsigned long* num_allocations, unsigned long* num_deallocations,
+  size_t* bytes_allocated, size_t* bytes_high_watermark)
+{
+  SUNFunctionBegin(helper->sunctx);
+  SUNAssert(mem_type == SUNMEMTYPE_HOST || mem_type == SUNMEMTYPE_UVM,
+            SUN_ERR_ARG_INCOMPATIBLE);
+  *num_allocations      = SUNHELPER_CONTENT(helper)->num_allocations;
+  *num_deallocations    = SUNHELPER_CONTENT(helper)->num_deallocations;
+  *bytes_allocated      = SUNHELPER_CONTENT(helper)->bytes_allocated;
+  *bytes_high_watermark = SUNHELPER_CONTENT(helper)->bytes_high_watermark;
+  return SUN_SUCCESS;
+}
+
+SUNMemoryHelper SUNMemoryHelper_Clone_SysPool(SUNMemoryHelper helper)
+{
+  SUNFunctionBegin(helper->sunctx);
+  SUNMemoryHelper hclone = SUNMemoryHelper_SysPool(helper->sunctx);
+  SUNCheckLastErrNull();
+  SUNHELPER_CONTENT(hclone)->max_cached_bytes =
+    SUNHELPER_CONTENT(helper)->max_cached_bytes;
+  return hclone;
+}
+
+SUNErrCode SUNMemoryHelper_Destroy_SysPool(SUNMemoryHelper helper)
+{
+  if (helper)
+  {
+    if (helper->content)
+    {
+      if (SUNHELPER_CONTENT(helper)->free_lists)
+      {
+        SUNMemoryHelper_Trim_SysPool(helper);
+        free(SUNHELPER_CONTENT(helper)->free_lists);
+      }
+      free(helper->content);
+    }
+    if (helper->ops) { free(helper->ops); }
+    free(helper);
+  }
+  return SUN_SUCCESS;
+}
@@ -30,8 +30,9 @@
 // nvector_impl macro defines some ignore and inserts with the vector name appended
 %nvector_impl(Pthreads)
 
-// ignore the Pthreads_Data struct
+// ignore the Pthreads_Data and Pthreads_Pool structs
 %ignore _Pthreads_Data;
+%ignore _Pthreads_Pool;
 
 // Process and wrap functions in the following files
 %include "nvector/nvector_pthreads.h"
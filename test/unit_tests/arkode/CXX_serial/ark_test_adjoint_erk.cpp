@@ -35,6 +35,7 @@
 
 #include <nvector/nvector_manyvector.h>
 #include <nvector/nvector_serial.h>
+#include <sunadjointcheckpointscheme/sunadjointcheckpointscheme_binomial.h>
 #include <sunadjointcheckpointscheme/sunadjointcheckpointscheme_fixed.h>
 #include <sundials/sundials_adjointstepper.h>
 #include <sunmatrix/sunmatrix_dense.h>
@@ -65,6 +66,7 @@ struct ProgramArgs
   int order;
   int check_freq;
   sunbooleantype keep_checks;
+  int max_checks;
 };
 
 static int neg_rhs(sunrealtype t, N_Vector uvec, N_Vector udotvec, void* user_data)
@@ -200,6 +202,9 @@ static void print_help(int argc, char* argv[], int exit_code)
   fprintf(stderr, "--check-freq <int>  how often to checkpoint (in steps)\n");
   fprintf(stderr,
           "--dont-keep         don't keep checkpoints around after loading\n");
+  fprintf(stderr,
+          "--binomial <int>    use binomial checkpointing with this many "
+          "checkpoints\n");
   fprintf(stderr, "--help              print these options\n");
   exit(exit_code);
 }
@@ -217,6 +222,10 @@ static void parse_args(int argc, char* argv[], ProgramArgs* args)
       args->check_freq = atoi(argv[++argi]);
     }
     else if (!strcmp(arg, "--dont-keep")) { args->keep_checks = SUNFALSE; }
+    else if (!strcmp(arg, "--binomial"))
+    {
+      args->max_checks = atoi(argv[++argi]);
+    }
     else if (!strcmp(arg, "--help")) { print_help(argc, argv, 0); }
     else { print_help(argc, argv, 1); }
   }
@@ -236,6 +245,7 @@ int main(int argc, char* argv[])
   args.order       = 4;
   args.keep_checks = SUNTRUE;
   args.check_freq  = 2;
+  args.max_checks  = 0;
   parse_args(argc, argv, &args);
 
   // Create UserData and set the params
@@ -274,9 +284,18 @@ int main(int argc, char* argv[])
   const sunbooleantype keep_check              = args.keep_checks;
   SUNAdjointCheckpointScheme checkpoint_scheme = NULL;
   SUNMemoryHelper mem_helper                   = SUNMemoryHelper_Sys(sunctx);
-  SUNAdjointCheckpointScheme_Create_Fixed(SUNDATAIOMODE_INMEM, mem_helper,
-                                          check_interval, ncheck, keep_check,
-                                          sunctx, &checkpoint_scheme);
+  if (args.max_checks > 0)
+  {
+    SUNAdjointCheckpointScheme_Create_Binomial(SUNDATAIOMODE_INMEM, mem_helper,
+                                               args.max_checks, ncheck, sunctx,
+                                               &checkpoint_scheme);
+  }
+  else
+  {
+    SUNAdjointCheckpointScheme_Create_Fixed(SUNDATAIOMODE_INMEM, mem_helper,
+                                            check_interval, ncheck, keep_check,
+                                            sunctx, &checkpoint_scheme);
+  }
   ARKodeSetAdjointCheckpointScheme(arkode_mem, checkpoint_scheme);
 
   //
@@ -367,9 +386,18 @@ int main(int argc, char* argv[])
   arkode_mem = ERKStepCreate(neg_rhs, tau0, u, sunctx);
   ARKodeSetOrder(arkode_mem, order);
   ARKodeSetMaxNumSteps(arkode_mem, nsteps + 1);
-  SUNAdjointCheckpointScheme_Create_Fixed(SUNDATAIOMODE_INMEM, mem_helper,
-                                          check_interval, ncheck, keep_check,
-                                          sunctx, &checkpoint_scheme);
+  if (args.max_checks > 0)
+  {
+    SUNAdjointCheckpointScheme_Create_Binomial(SUNDATAIOMODE_INMEM, mem_helper,
+                                               args.max_checks, ncheck, sunctx,
+                                               &checkpoint_scheme);
+  }
+  else
+  {
+    SUNAdjointCheckpointScheme_Create_Fixed(SUNDATAIOMODE_INMEM, mem_helper,
+                                            check_interval, ncheck, keep_check,
+                                            sunctx, &checkpoint_scheme);
+  }
   ARKodeSetAdjointCheckpointScheme(arkode_mem, checkpoint_scheme);
 
   forward_solution(sunctx, arkode_mem, tau0, tauf, -dt, u);
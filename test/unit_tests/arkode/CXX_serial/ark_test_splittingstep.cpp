@@ -496,6 +496,104 @@ static int test_reinit(const sundials::Context& ctx)
   return fail;
 }
 
+/* Integrates the ODE
+ *
+ * y' = \sum_{i=0}^{P-1} 2^i / (1 - 2^P) * y,    y(0) = 1
+ *
+ * with a splitting method that has multiple sequential methods, first with a
+ * single set of ERK steppers and then with a separate set of steppers attached
+ * to each sequential method. The sequential methods are then evolved
+ * independently and we check that the solutions and the number of partition
+ * evolves match.
+ */
+static int test_sequential_steppers(sundials::Context& ctx, const char* name,
+                                    SplittingStepCoefficients coefficients)
+{
+  constexpr auto t0        = SUN_RCONST(0.0);
+  constexpr auto tf        = SUN_RCONST(1.0);
+  constexpr auto dt        = SUN_RCONST(8.0e-3);
+  constexpr auto local_tol = SUN_RCONST(1.0e-6);
+  const int partitions     = coefficients->partitions;
+  const int methods        = coefficients->sequential_methods;
+
+  ARKRhsFn f = [](sunrealtype, N_Vector z, N_Vector zdot, void* user_data)
+  {
+    auto lambda = *static_cast<sunrealtype*>(user_data);
+    N_VScale(lambda, z, zdot);
+    return 0;
+  };
+
+  std::vector<sunrealtype> lambda(partitions);
+  for (int k = 0; k < partitions; k++)
+  {
+    lambda[k] = std::pow(SUN_RCONST(2.0), k) /
+                (1 - std::pow(SUN_RCONST(2.0), partitions));
+  }
+
+  sunrealtype solutions[2];
+  long int evolves[2];
+
+  for (int run = 0; run < 2; run++)
+  {
+    auto y = N_VNew_Serial(1, ctx);
+    N_VConst(SUN_RCONST(1.0), y);
+
+    /* One set of steppers per sequential method on the second run */
+    const int sets = (run == 0) ? 1 : methods;
+    std::vector<void*> partition_mem(sets * partitions);
+    std::vector<SUNStepper> steppers(sets * partitions);
+    for (int i = 0; i < sets * partitions; i++)
+    {
+      partition_mem[i] = ERKStepCreate(f, t0, y, ctx);
+      ARKodeSetUserData(partition_mem[i], &lambda[i % partitions]);
+      ARKodeSStolerances(partition_mem[i], local_tol, local_tol);
+      ARKodeCreateSUNStepper(partition_mem[i], &steppers[i]);
+    }
+
+    auto arkode_mem = SplittingStepCreate(steppers.data(), partitions, t0, y,
+                                          ctx);
+    for (int i = 1; i < sets; i++)
+    {
+      SplittingStepSetSequentialSteppers(arkode_mem, i,
+                                         steppers.data() + i * partitions);
+    }
+    ARKodeSetFixedStep(arkode_mem, dt);
+    SplittingStepSetCoefficients(arkode_mem, coefficients);
+    auto tret = t0;
+    ARKodeEvolve(arkode_mem, tf, y, &tret, ARK_NORMAL);
+
+    solutions[run] = N_VGetArrayPointer(y)[0];
+    SplittingStepGetNumEvolves(arkode_mem, -1, &evolves[run]);
+
+    N_VDestroy(y);
+    for (int i = 0; i < sets * partitions; i++)
+    {
+      ARKodeFree(&partition_mem[i]);
+      SUNStepper_Destroy(&steppers[i]);
+    }
+    ARKodeFree(&arkode_mem);
+  }
+
+  /* The inner integrators are adaptive and each set of steppers keeps its own
+   * step size history, so the solutions only agree to the inner tolerance */
+  sunbooleantype fail = SUNRCompareTol(solutions[0], solutions[1], local_tol) ||
+                        evolves[0] != evolves[1];
+  if (fail)
+  {
+    std::cerr << "Sequential steppers solution with " << name
+              << " does not match: " << solutions[1] << " vs " << solutions[0]
+              << ", " << evolves[1] << " vs " << evolves[0] << " evolves\n";
+  }
+  else
+  {
+    std::cout << "Sequential steppers solution with " << name
+              << " matches with " << evolves[1] << " evolves\n";
+  }
+  std::cout << "\n";
+
+  return fail;
+}
+
 int main()
 {
   sundials::Context ctx;
@@ -525,6 +623,15 @@ int main()
   errors += test_custom_stepper(ctx, 6);
   errors += test_reinit(ctx);
 
+  auto parallel = SplittingStepCoefficients_Parallel(3);
+  errors += test_sequential_steppers(ctx, "Parallel", parallel);
+  SplittingStepCoefficients_Destroy(&parallel);
+
+  auto symmetric_parallel = SplittingStepCoefficients_SymmetricParallel(3);
+  errors += test_sequential_steppers(ctx, "SymmetricParallel",
+                                     symmetric_parallel);
+  SplittingStepCoefficients_Destroy(&symmetric_parallel);
+
   if (errors == 0) { std::cout << "Success\n"; }
   else { std::cout << errors << " Test Failures\n"; }
 
@@ -0,0 +1,280 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2025-2026, Lawrence Livermore National Security,
+ * University of Maryland Baltimore County, and the SUNDIALS contributors.
+ * Copyright (c) 2013-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * Copyright (c) 2002-2013, Lawrence Livermore National Security.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for the ERKStep low-storage tables. For each table, the forced
+ * oscillator
+ *
+ *   y0' = y1
+ *   y1' = -y0 - 0.1 y1^2 + cos(t)
+ *
+ * is solved with fixed and (when an embedding is available) adaptive steps
+ * using the low-storage table and the equivalent Butcher table obtained from
+ * ARKodeLowStorageTable_ToButcher. The two solutions and step counts must
+ * agree, the low-storage run must allocate fewer vectors, and the fixed
+ * step error must decrease at the order of the method.
+ * ---------------------------------------------------------------------------*/
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "arkode/arkode_erkstep.h"
+#include "nvector/nvector_serial.h"
+#include "sundials/sundials_math.h"
+
+#define NEQ  2
+#define ZERO SUN_RCONST(0.0)
+#define ONE  SUN_RCONST(1.0)
+#define TF   SUN_RCONST(2.0)
+
+/* Number of vectors cloned since the last reset */
+static long int nclones = 0;
+
+/* Clone operation that counts the vectors allocated by the integrator */
+static N_Vector CountingClone(N_Vector w)
+{
+  nclones++;
+  return N_VClone_Serial(w);
+}
+
+/* ODE right-hand side */
+static int f(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  sunrealtype* yd    = N_VGetArrayPointer(y);
+  sunrealtype* ydotd = N_VGetArrayPointer(ydot);
+
+  ydotd[0] = yd[1];
+  ydotd[1] = -yd[0] - SUN_RCONST(0.1) * yd[1] * yd[1] + cos(t);
+
+  return 0;
+}
+
+/* Integrate to TF with a low-storage table (L != NULL) or a Butcher table */
+static int solve(ARKodeLowStorageTable L, ARKodeButcherTable B, sunrealtype h,
+                 N_Vector y, long int* nst, long int* nvec, SUNContext sunctx)
+{
+  int retval;
+  sunrealtype tret   = ZERO;
+  void* arkode_mem   = NULL;
+  sunrealtype* ydata = N_VGetArrayPointer(y);
+
+  ydata[0] = ONE;
+  ydata[1] = ZERO;
+
+  /* count the vectors cloned from y by the integrator */
+  y->ops->nvclone = CountingClone;
+  nclones         = 0;
+
+  arkode_mem = ERKStepCreate(f, ZERO, y, sunctx);
+  if (!arkode_mem)
+  {
+    fprintf(stderr, "ERKStepCreate returned NULL\n");
+    return 1;
+  }
+
+  if (L) { retval = ERKStepSetLowStorageTable(arkode_mem, L); }
+  else { retval = ERKStepSetTable(arkode_mem, B); }
+  if (retval)
+  {
+    fprintf(stderr, "ERKStepSet(LowStorage)Table returned %i\n", retval);
+    return 1;
+  }
+
+  if (h > ZERO)
+  {
+    retval = ARKodeSetFixedStep(arkode_mem, h);
+    if (retval)
+    {
+      fprintf(stderr, "ARKodeSetFixedStep returned %i\n", retval);
+      return 1;
+    }
+  }
+  else
+  {
+    retval = ARKodeSStolerances(arkode_mem, SUN_RCONST(1.0e-6),
+                                SUN_RCONST(1.0e-10));
+    if (retval)
+    {
+      fprintf(stderr, "ARKodeSStolerances returned %i\n", retval);
+      return 1;
+    }
+  }
+
+  retval = ARKodeSetMaxNumSteps(arkode_mem, 100000);
+  if (retval)
+  {
+    fprintf(stderr, "ARKodeSetMaxNumSteps returned %i\n", retval);
+    return 1;
+  }
+
+  retval = ARKodeSetStopTime(arkode_mem, TF);
+  if (retval)
+  {
+    fprintf(stderr, "ARKodeSetStopTime returned %i\n", retval);
+    return 1;
+  }
+
+  retval = ARKodeEvolve(arkode_mem, TF, y, &tret, ARK_NORMAL);
+  if (retval < 0)
+  {
+    fprintf(stderr, "ARKodeEvolve returned %i\n", retval);
+    return 1;
+  }
+
+  retval = ARKodeGetNumSteps(arkode_mem, nst);
+  if (retval)
+  {
+    fprintf(stderr, "ARKodeGetNumSteps returned %i\n", retval);
+    return 1;
+  }
+
+  *nvec = nclones;
+
+  ARKodeFree(&arkode_mem);
+
+  return 0;
+}
+
+/* Compare the low-storage and Butcher forms of one table */
+static int run(ARKODE_LowStorageTableID id, SUNContext sunctx)
+{
+  int k, fails = 0;
+  long int nst_ls, nst_b, nvec_ls, nvec_b;
+  sunrealtype h, diff, err[2], rate;
+  sunrealtype tol = SUN_RCONST(1.0e-10);
+  ARKodeLowStorageTable L;
+  ARKodeButcherTable B;
+  N_Vector y, yref, ytmp;
+
+  L = ARKodeLowStorageTable_Load(id);
+  if (!L || ARKodeLowStorageTable_ToButcher(L, &B))
+  {
+    fprintf(stderr, "Could not load low-storage table %i\n", (int)id);
+    return 1;
+  }
+
+  y    = N_VNew_Serial(NEQ, sunctx);
+  yref = N_VClone(y);
+  ytmp = N_VClone(y);
+
+  /* reference solution */
+  if (solve(L, NULL, SUN_RCONST(1.0e-4), yref, &nst_ls, &nvec_ls, sunctx))
+  {
+    return 1;
+  }
+
+  /* fixed steps: compare with the Butcher form and check convergence */
+  for (k = 0; k < 2; k++)
+  {
+    h = (k == 0) ? SUN_RCONST(0.02) : SUN_RCONST(0.01);
+
+    if (solve(L, NULL, h, y, &nst_ls, &nvec_ls, sunctx)) { return 1; }
+    if (solve(NULL, B, h, ytmp, &nst_b, &nvec_b, sunctx)) { return 1; }
+
+    N_VLinearSum(ONE, y, -ONE, ytmp, ytmp);
+    diff = N_VMaxNorm(ytmp);
+    if (diff > tol || nst_ls != nst_b)
+    {
+      fprintf(stderr,
+              "table %i, h = %g: low-storage and Butcher forms differ, "
+              "diff = %g, steps = %li vs %li\n",
+              (int)id, (double)h, (double)diff, nst_ls, nst_b);
+      fails++;
+    }
+
+    if (nvec_ls >= nvec_b)
+    {
+      fprintf(stderr, "table %i: low-storage vectors = %li is not below %li\n",
+              (int)id, nvec_ls, nvec_b);
+      fails++;
+    }
+
+    N_VLinearSum(ONE, y, -ONE, yref, ytmp);
+    err[k] = N_VMaxNorm(ytmp);
+  }
+
+  rate = log(err[0] / err[1]) / log(SUN_RCONST(2.0));
+  printf("table %i: q = %i, p = %i, errors = %g %g, rate = %.2f\n", (int)id,
+         L->q, L->p, (double)err[0], (double)err[1], (double)rate);
+  if (rate < L->q - SUN_RCONST(0.3))
+  {
+    fprintf(stderr, "table %i: observed order %g is below %i\n", (int)id,
+            (double)rate, L->q);
+    fails++;
+  }
+
+  /* adaptive steps with the embedded error estimate */
+  if (L->p > 0)
+  {
+    if (solve(L, NULL, ZERO, y, &nst_ls, &nvec_ls, sunctx)) { return 1; }
+    if (solve(NULL, B, ZERO, ytmp, &nst_b, &nvec_b, sunctx)) { return 1; }
+
+    N_VLinearSum(ONE, y, -ONE, ytmp, ytmp);
+    diff = N_VMaxNorm(ytmp);
+    printf("table %i: adaptive steps = %li vs %li, diff = %g\n", (int)id,
+           nst_ls, nst_b, (double)diff);
+    if (diff > SUN_RCONST(1.0e-8) || nst_ls != nst_b)
+    {
+      fprintf(stderr, "table %i: adaptive runs differ\n", (int)id);
+      fails++;
+    }
+
+    N_VLinearSum(ONE, y, -ONE, yref, ytmp);
+    if (N_VMaxNorm(ytmp) > SUN_RCONST(1.0e-4))
+    {
+      fprintf(stderr, "table %i: adaptive error %g is too large\n", (int)id,
+              (double)N_VMaxNorm(ytmp));
+      fails++;
+    }
+  }
+
+  ARKodeLowStorageTable_Free(L);
+  ARKodeButcherTable_Free(B);
+  N_VDestroy(y);
+  N_VDestroy(yref);
+  N_VDestroy(ytmp);
+
+  return fails;
+}
+
+int main(int argc, char* argv[])
+{
+  int id, fails = 0;
+  SUNContext sunctx = NULL;
+
+  if (SUNContext_Create(SUN_COMM_NULL, &sunctx))
+  {
+    fprintf(stderr, "SUNContext_Create failed\n");
+    return 1;
+  }
+
+  for (id = ARKODE_MIN_LOWSTORAGE_NUM; id <= ARKODE_MAX_LOWSTORAGE_NUM; id++)
+  {
+    fails += run((ARKODE_LowStorageTableID)id, sunctx);
+  }
+
+  SUNContext_Free(&sunctx);
+
+  if (fails)
+  {
+    printf("FAIL\n");
+    return 1;
+  }
+
+  printf("SUCCESS\n");
+
+  return 0;
+}
+
+/*---- end of file ----*/
@@ -0,0 +1,232 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2025-2026, Lawrence Livermore National Security,
+ * University of Maryland Baltimore County, and the SUNDIALS contributors.
+ * Copyright (c) 2013-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * Copyright (c) 2002-2013, Lawrence Livermore National Security.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for ARKodeGetDkyBatch. Solves the decoupled linear system
+ * y_i' = -lambda_i y_i with ERKStep using Hermite and Lagrange interpolants of
+ * each degree and, after each step, compares the batched evaluation of the
+ * interpolant and its derivatives at several times in the last step against
+ * ARKodeGetDky.
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "arkode/arkode_erkstep.h"
+#include "nvector/nvector_serial.h"
+#include "sundials/sundials_math.h"
+
+#define NEQ    10
+#define NTIMES 7
+#define NSTEPS 20
+#define ZERO   SUN_RCONST(0.0)
+#define ONE    SUN_RCONST(1.0)
+#define TEN    SUN_RCONST(10.0)
+
+/* Decay rate of each component, from 1 to 1e2 */
+static sunrealtype lambda(sunindextype i)
+{
+  return SUNRpowerR(TEN, SUN_RCONST(2.0) * (sunrealtype)i / (NEQ - 1));
+}
+
+/* ODE right-hand side */
+static int f(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  sunrealtype* yd    = N_VGetArrayPointer(y);
+  sunrealtype* ydotd = N_VGetArrayPointer(ydot);
+  sunindextype i;
+
+  for (i = 0; i < NEQ; i++) { ydotd[i] = -lambda(i) * yd[i]; }
+
+  return 0;
+}
+
+/* Take steps and compare the batched and single output after each one */
+static int run(int itype, int degree, SUNContext sunctx)
+{
+  int retval, step, k, m;
+  int fails        = 0;
+  sunrealtype tret = ZERO;
+  sunrealtype hlast, err, maxerr = ZERO, scale;
+  sunrealtype times[NTIMES];
+  N_Vector y       = NULL;
+  N_Vector dky     = NULL;
+  N_Vector* dkys   = NULL;
+  void* arkode_mem = NULL;
+
+  y = N_VNew_Serial(NEQ, sunctx);
+  if (!y)
+  {
+    fprintf(stderr, "N_VNew_Serial returned NULL\n");
+    return 1;
+  }
+  N_VConst(ONE, y);
+
+  dky  = N_VClone(y);
+  dkys = N_VCloneVectorArray(NTIMES, y);
+  if (!dky || !dkys)
+  {
+    fprintf(stderr, "N_VClone returned NULL\n");
+    return 1;
+  }
+
+  arkode_mem = ERKStepCreate(f, ZERO, y, sunctx);
+  if (!arkode_mem)
+  {
+    fprintf(stderr, "ERKStepCreate returned NULL\n");
+    return 1;
+  }
+
+  retval = ARKodeSStolerances(arkode_mem, SUN_RCONST(1.0e-8),
+                              SUN_RCONST(1.0e-10));
+  if (retval)
+  {
+    fprintf(stderr, "ARKodeSStolerances returned %i\n", retval);
+    return 1;
+  }
+
+  retval = ARKodeSetInterpolantType(arkode_mem, itype);
+  if (retval)
+  {
+    fprintf(stderr, "ARKodeSetInterpolantType returned %i\n", retval);
+    return 1;
+  }
+
+  retval = ARKodeSetInterpolantDegree(arkode_mem, degree);
+  if (retval)
+  {
+    fprintf(stderr, "ARKodeSetInterpolantDegree returned %i\n", retval);
+    return 1;
+  }
+
+  retval = ARKodeSetStopTime(arkode_mem, ONE);
+  if (retval)
+  {
+    fprintf(stderr, "ARKodeSetStopTime returned %i\n", retval);
+    return 1;
+  }
+
+  for (step = 0; step < NSTEPS; step++)
+  {
+    retval = ARKodeEvolve(arkode_mem, ONE, y, &tret, ARK_ONE_STEP);
+    if (retval < 0)
+    {
+      fprintf(stderr, "ARKodeEvolve returned %i\n", retval);
+      return 1;
+    }
+
+    retval = ARKodeGetLastStep(arkode_mem, &hlast);
+    if (retval)
+    {
+      fprintf(stderr, "ARKodeGetLastStep returned %i\n", retval);
+      return 1;
+    }
+
+    /* output times spanning the last step, in arbitrary order */
+    for (m = 0; m < NTIMES; m++)
+    {
+      times[m] = tret - hlast * (sunrealtype)((3 * m) % NTIMES) / (NTIMES - 1);
+    }
+
+    for (k = 0; k <= 3; k++)
+    {
+      retval = ARKodeGetDkyBatch(arkode_mem, NTIMES, times, k, dkys);
+      if (retval)
+      {
+        fprintf(stderr, "ARKodeGetDkyBatch returned %i\n", retval);
+        return 1;
+      }
+
+      for (m = 0; m < NTIMES; m++)
+      {
+        retval = ARKodeGetDky(arkode_mem, times[m], k, dky);
+        if (retval)
+        {
+          fprintf(stderr, "ARKodeGetDky returned %i\n", retval);
+          return 1;
+        }
+
+        /* the interpolant weights for the k-th derivative scale as h^(-k) */
+        scale = SUNMAX(N_VMaxNorm(dky), SUNRpowerI(SUNRabs(hlast), -k));
+        N_VLinearSum(ONE, dkys[m], -ONE, dky, dky);
+        err    = N_VMaxNorm(dky) / scale;
+        maxerr = SUNMAX(maxerr, err);
+      }
+    }
+
+    if (tret >= ONE) { break; }
+  }
+
+  printf("%s degree %i: max relative difference = %g\n",
+         (itype == ARK_INTERP_HERMITE) ? "Hermite" : "Lagrange", degree,
+         (double)maxerr);
+
+  if (maxerr > SUN_RCONST(100.0) * SUN_UNIT_ROUNDOFF)
+  {
+    fprintf(stderr, "Batched output differs from ARKodeGetDky\n");
+    fails++;
+  }
+
+  /* Check that an output time outside of the last step is rejected */
+  times[NTIMES - 1] = tret + TEN * hlast;
+  retval            = ARKodeGetDkyBatch(arkode_mem, NTIMES, times, 0, dkys);
+  if (retval != ARK_BAD_T)
+  {
+    fprintf(stderr, "ARKodeGetDkyBatch returned %i, expected %i\n", retval,
+            ARK_BAD_T);
+    fails++;
+  }
+
+  ARKodeFree(&arkode_mem);
+  N_VDestroyVectorArray(dkys, NTIMES);
+  N_VDestroy(dky);
+  N_VDestroy(y);
+
+  return fails;
+}
+
+/* Main program */
+int main(int argc, char* argv[])
+{
+  int retval        = 0;
+  int fails         = 0;
+  int degree        = 0;
+  SUNContext sunctx = NULL;
+
+  retval = SUNContext_Create(SUN_COMM_NULL, &sunctx);
+  if (retval)
+  {
+    fprintf(stderr, "SUNContext_Create returned %i\n", retval);
+    return 1;
+  }
+
+  for (degree = 0; degree <= ARK_INTERP_MAX_DEGREE; degree++)
+  {
+    fails += run(ARK_INTERP_HERMITE, degree, sunctx);
+    fails += run(ARK_INTERP_LAGRANGE, degree, sunctx);
+  }
+
+  SUNContext_Free(&sunctx);
+
+  if (fails)
+  {
+    printf("FAIL\n");
+    return 1;
+  }
+
+  printf("SUCCESS\n");
+
+  return 0;
+}
+
+/*---- end of file ----*/
@@ -0,0 +1,342 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2025-2026, Lawrence Livermore National Security,
+ * University of Maryland Baltimore County, and the SUNDIALS contributors.
+ * Copyright (c) 2013-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * Copyright (c) 2002-2013, Lawrence Livermore National Security.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for the CVODE ensemble interface. An ensemble of Robertson
+ * chemical kinetics systems, where the rate constants of system s are scaled by
+ * 1 + s, is integrated with CVodeEnsemble and, one system at a time, with
+ * separate CVODE instances using the same options. Since the ensemble applies
+ * the CVODE step and error control to each system, the solutions must agree to
+ * within a small multiple of the tolerances. The test is repeated with an
+ * analytic Jacobian after reinitializing the ensemble, and with two threads.
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "cvode/cvode.h"
+#include "cvode/cvode_ensemble.h"
+#include "nvector/nvector_serial.h"
+#include "sundials/sundials_math.h"
+#include "sunlinsol/sunlinsol_dense.h"
+#include "sunmatrix/sunmatrix_blockdense.h"
+#include "sunmatrix/sunmatrix_dense.h"
+
+#if defined(SUNDIALS_EXTENDED_PRECISION)
+#define GSYM "Lg"
+#else
+#define GSYM "g"
+#endif
+
+#define ZERO SUN_RCONST(0.0)
+#define ONE  SUN_RCONST(1.0)
+
+#define NSYS 10 /* number of systems       */
+#define NEQ  3  /* size of each system     */
+#define NOUT 4  /* number of output times  */
+#define RTOL SUN_RCONST(1.0e-4)
+#define ATOL SUN_RCONST(1.0e-8)
+#define TEST_FACTOR SUN_RCONST(10.0)
+
+static sunrealtype rate(sunindextype sys) { return ONE + sys; }
+
+/* Right-hand side and Jacobian of one system */
+
+static void rhs_sys(sunrealtype s, const sunrealtype* y, sunrealtype* ydot)
+{
+  ydot[0] = s * (SUN_RCONST(-0.04) * y[0] + SUN_RCONST(1.0e4) * y[1] * y[2]);
+  ydot[2] = s * SUN_RCONST(3.0e7) * y[1] * y[1];
+  ydot[1] = -ydot[0] - ydot[2];
+}
+
+static void jac_sys(sunrealtype s, const sunrealtype* y, sunrealtype J[NEQ][NEQ])
+{
+  J[0][0] = s * SUN_RCONST(-0.04);
+  J[0][1] = s * SUN_RCONST(1.0e4) * y[2];
+  J[0][2] = s * SUN_RCONST(1.0e4) * y[1];
+
+  J[2][0] = ZERO;
+  J[2][1] = s * SUN_RCONST(6.0e7) * y[1];
+  J[2][2] = ZERO;
+
+  J[1][0] = -J[0][0] - J[2][0];
+  J[1][1] = -J[0][1] - J[2][1];
+  J[1][2] = -J[0][2] - J[2][2];
+}
+
+/* Batched right-hand side and Jacobian of the ensemble, where component i of
+   system s is entry i * NSYS + s */
+
+static int rhs(const sunrealtype* t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  sunrealtype* yd    = N_VGetArrayPointer(y);
+  sunrealtype* ydotd = N_VGetArrayPointer(ydot);
+  sunrealtype ys[NEQ], fs[NEQ];
+
+  for (sunindextype sys = 0; sys < NSYS; sys++)
+  {
+    for (int i = 0; i < NEQ; i++) { ys[i] = yd[i * NSYS + sys]; }
+    rhs_sys(rate(sys), ys, fs);
+    for (int i = 0; i < NEQ; i++) { ydotd[i * NSYS + sys] = fs[i]; }
+  }
+
+  return 0;
+}
+
+static int jac(const sunrealtype* t, N_Vector y, N_Vector fy, SUNMatrix J,
+               void* user_data, N_Vector tmp1, N_Vector tmp2, N_Vector tmp3)
+{
+  sunrealtype* yd = N_VGetArrayPointer(y);
+  sunrealtype ys[NEQ], Js[NEQ][NEQ];
+
+  for (sunindextype sys = 0; sys < NSYS; sys++)
+  {
+    for (int i = 0; i < NEQ; i++) { ys[i] = yd[i * NSYS + sys]; }
+    jac_sys(rate(sys), ys, Js);
+    for (int i = 0; i < NEQ; i++)
+    {
+      for (int j = 0; j < NEQ; j++) { SM_ELEMENT_BD(J, sys, i, j) = Js[i][j]; }
+    }
+  }
+
+  return 0;
+}
+
+/* Wrappers for solving one system with a separate CVODE instance */
+
+typedef struct
+{
+  sunindextype sys;
+} SysData;
+
+static int rhs_single(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  rhs_sys(rate(((SysData*)user_data)->sys), N_VGetArrayPointer(y),
+          N_VGetArrayPointer(ydot));
+  return 0;
+}
+
+static int jac_single(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix J,
+                      void* user_data, N_Vector tmp1, N_Vector tmp2,
+                      N_Vector tmp3)
+{
+  sunrealtype Js[NEQ][NEQ];
+
+  jac_sys(rate(((SysData*)user_data)->sys), N_VGetArrayPointer(y), Js);
+  for (int i = 0; i < NEQ; i++)
+  {
+    for (int j = 0; j < NEQ; j++) { SM_ELEMENT_D(J, i, j) = Js[i][j]; }
+  }
+
+  return 0;
+}
+
+static void set_initial_condition(N_Vector y)
+{
+  sunrealtype* yd = N_VGetArrayPointer(y);
+
+  for (sunindextype sys = 0; sys < NSYS; sys++)
+  {
+    yd[0 * NSYS + sys] = ONE;
+    yd[1 * NSYS + sys] = ZERO;
+    yd[2 * NSYS + sys] = ZERO;
+  }
+}
+
+/* Solve each system with a separate CVODE instance and store the solution at
+   each output time in yref (NOUT blocks of NSYS * NEQ interleaved values) */
+static int solve_reference(SUNContext sunctx, sunbooleantype usejac,
+                           sunrealtype* yref, long int* nst_total)
+{
+  sunindextype sys;
+  int iout, flag;
+
+  *nst_total = 0;
+
+  for (sys = 0; sys < NSYS; sys++)
+  {
+    SysData data       = {sys};
+    N_Vector y         = N_VNew_Serial(NEQ, sunctx);
+    SUNMatrix A        = SUNDenseMatrix(NEQ, NEQ, sunctx);
+    SUNLinearSolver LS = SUNLinSol_Dense(y, A, sunctx);
+    void* cvode_mem    = CVodeCreate(CV_BDF, sunctx);
+    sunrealtype tout   = SUN_RCONST(0.4);
+    sunrealtype tret;
+    long int nst;
+
+    if (!y || !A || !LS || !cvode_mem) { return 1; }
+
+    N_VGetArrayPointer(y)[0] = ONE;
+    N_VGetArrayPointer(y)[1] = ZERO;
+    N_VGetArrayPointer(y)[2] = ZERO;
+
+    if (CVodeInit(cvode_mem, rhs_single, ZERO, y)) { return 1; }
+    if (CVodeSetUserData(cvode_mem, &data)) { return 1; }
+    if (CVodeSStolerances(cvode_mem, RTOL, ATOL)) { return 1; }
+    if (CVodeSetLinearSolver(cvode_mem, LS, A)) { return 1; }
+    if (usejac && CVodeSetJacFn(cvode_mem, jac_single)) { return 1; }
+
+    for (iout = 0; iout < NOUT; iout++, tout *= SUN_RCONST(10.0))
+    {
+      flag = CVode(cvode_mem, tout, y, &tret, CV_NORMAL);
+      if (flag < 0) { return 1; }
+      for (int i = 0; i < NEQ; i++)
+      {
+        yref[iout * NSYS * NEQ + i * NSYS + sys] = N_VGetArrayPointer(y)[i];
+      }
+    }
+
+    if (CVodeGetNumSteps(cvode_mem, &nst)) { return 1; }
+    *nst_total += nst;
+
+    CVodeFree(&cvode_mem);
+    SUNLinSolFree(LS);
+    SUNMatDestroy(A);
+    N_VDestroy(y);
+  }
+
+  return 0;
+}
+
+/* Integrate the ensemble and compare against the reference solution */
+static int check_ensemble(void* ens_mem, N_Vector y, const sunrealtype* yref,
+                          long int nst_ref, const char* name)
+{
+  sunrealtype* yd  = N_VGetArrayPointer(y);
+  sunrealtype tout = SUN_RCONST(0.4);
+  sunrealtype err, tol;
+  int flags[NSYS];
+  long int nst;
+  int iout, flag, fails = 0;
+
+  for (iout = 0; iout < NOUT; iout++, tout *= SUN_RCONST(10.0))
+  {
+    flag = CVodeEnsemble(ens_mem, tout, y, flags);
+    if (flag != CV_SUCCESS)
+    {
+      fprintf(stderr, "FAIL: %s, CVodeEnsemble returned %i\n", name, flag);
+      return 1;
+    }
+
+    for (int i = 0; i < NSYS * NEQ; i++)
+    {
+      err = SUNRabs(yd[i] - yref[iout * NSYS * NEQ + i]);
+      tol = TEST_FACTOR * (RTOL * SUNRabs(yref[iout * NSYS * NEQ + i]) + ATOL);
+      if (err > tol)
+      {
+        fprintf(stderr,
+                "FAIL: %s, t = %" GSYM ", y[%i] = %" GSYM " != %" GSYM "\n",
+                name, tout, i, yd[i], yref[iout * NSYS * NEQ + i]);
+        fails++;
+        break;
+      }
+    }
+  }
+
+  /* The step and order selection is that of CVODE, so the step counts may
+     only differ due to roundoff */
+  flag = CVodeEnsembleGetNumSteps(ens_mem, &nst);
+  if (flag || (nst > nst_ref + nst_ref / 10) || (nst < nst_ref - nst_ref / 10))
+  {
+    fprintf(stderr, "FAIL: %s, nst = %ld, CVODE nst = %ld\n", name, nst,
+            nst_ref);
+    fails++;
+  }
+
+  if (!fails)
+  {
+    printf("PASS: %s (nst = %ld, CVODE nst = %ld)\n", name, nst, nst_ref);
+  }
+
+  return fails;
+}
+
+int main(int argc, char* argv[])
+{
+  SUNContext sunctx = NULL;
+  void* ens_mem     = NULL;
+  N_Vector y        = NULL;
+  sunrealtype* yref = NULL;
+  long int nst_ref;
+  int fails = 0;
+
+  if (SUNContext_Create(SUN_COMM_NULL, &sunctx))
+  {
+    fprintf(stderr, "SUNContext_Create failed\n");
+    return 1;
+  }
+
+  y    = N_VNew_Serial(NSYS * NEQ, sunctx);
+  yref = (sunrealtype*)malloc(NOUT * NSYS * NEQ * sizeof(sunrealtype));
+  if (!y || !yref)
+  {
+    fprintf(stderr, "Allocation failed\n");
+    return 1;
+  }
+
+  set_initial_condition(y);
+
+  ens_mem = CVodeEnsembleCreate(CV_BDF, NSYS, NEQ, sunctx);
+  if (!ens_mem)
+  {
+    fprintf(stderr, "CVodeEnsembleCreate returned NULL\n");
+    return 1;
+  }
+
+  if (CVodeEnsembleInit(ens_mem, rhs, ZERO, y) ||
+      CVodeEnsembleSStolerances(ens_mem, RTOL, ATOL) ||
+      CVodeEnsembleSetNumThreads(ens_mem, 1))
+  {
+    fprintf(stderr, "Ensemble setup failed\n");
+    return 1;
+  }
+
+  /* Difference quotient Jacobian */
+  if (solve_reference(sunctx, SUNFALSE, yref, &nst_ref)) { return 1; }
+  fails += check_ensemble(ens_mem, y, yref, nst_ref, "DQ Jacobian");
+
+  /* Reinitialize with an analytic Jacobian */
+  set_initial_condition(y);
+
+  if (CVodeEnsembleReInit(ens_mem, ZERO, y) ||
+      CVodeEnsembleSetJacFn(ens_mem, jac))
+  {
+    fprintf(stderr, "Ensemble reinitialization failed\n");
+    return 1;
+  }
+
+  if (solve_reference(sunctx, SUNTRUE, yref, &nst_ref)) { return 1; }
+  fails += check_ensemble(ens_mem, y, yref, nst_ref, "analytic Jacobian");
+
+  /* Repeat with two threads */
+  set_initial_condition(y);
+
+  if (CVodeEnsembleReInit(ens_mem, ZERO, y) ||
+      CVodeEnsembleSetNumThreads(ens_mem, 2))
+  {
+    fprintf(stderr, "Ensemble reinitialization failed\n");
+    return 1;
+  }
+
+  fails += check_ensemble(ens_mem, y, yref, nst_ref, "two threads");
+
+  CVodeEnsembleFree(&ens_mem);
+  N_VDestroy(y);
+  free(yref);
+  SUNContext_Free(&sunctx);
+
+  if (fails) { printf("FAIL: %d test(s) failed\n", fails); }
+  else { printf("SUCCESS\n"); }
+
+  return fails;
+}
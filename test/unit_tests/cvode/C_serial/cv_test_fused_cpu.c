@@ -0,0 +1,220 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2025-2026, Lawrence Livermore National Security,
+ * University of Maryland Baltimore County, and the SUNDIALS contributors.
+ * Copyright (c) 2013-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * Copyright (c) 2002-2013, Lawrence Livermore National Security.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for the CPU fused integrator kernels. A stiff system of decoupled
+ * nonlinear decay equations,
+ *
+ *   y_i' = -k_i y_i (1 + y_i),  y_i(0) = 1,  k_i = 10^(4 i / (N - 1)),
+ *
+ * is solved with and without CVodeSetUseIntegratorFusedKernels using scalar
+ * tolerances with a dense linear solver, vector tolerances and constraints
+ * with a dense linear solver, and scalar tolerances with CVDiag. The fused
+ * kernels perform the same arithmetic as the N_Vector operations they replace,
+ * so up to differences in floating point contraction the integrator statistics
+ * and final solutions should agree.
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "cvode/cvode.h"
+#include "cvode/cvode_diag.h"
+#include "nvector/nvector_serial.h"
+#include "sundials/sundials_math.h"
+#include "sunlinsol/sunlinsol_dense.h"
+#include "sunmatrix/sunmatrix_dense.h"
+
+#if defined(SUNDIALS_EXTENDED_PRECISION)
+#define GSYM "Lg"
+#else
+#define GSYM "g"
+#endif
+
+#define ZERO SUN_RCONST(0.0)
+#define ONE  SUN_RCONST(1.0)
+
+#define NEQ  50
+#define RTOL SUN_RCONST(1.0e-6)
+#define ATOL SUN_RCONST(1.0e-10)
+#define TOUT SUN_RCONST(1.0)
+
+static int ode_rhs(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  sunrealtype* yd    = N_VGetArrayPointer(y);
+  sunrealtype* ydotd = N_VGetArrayPointer(ydot);
+  sunindextype i;
+
+  for (i = 0; i < NEQ; i++)
+  {
+    const sunrealtype k = SUNRpowerR(SUN_RCONST(10.0),
+                                     SUN_RCONST(4.0) * i / (NEQ - 1));
+    ydotd[i]            = -k * yd[i] * (ONE + yd[i]);
+  }
+
+  return 0;
+}
+
+/* Solve the problem and return the final solution and step statistics */
+static int solve(SUNContext sunctx, int test, sunbooleantype usefused,
+                 N_Vector y, long int* nst, long int* nfe)
+{
+  void* cvode_mem    = NULL;
+  SUNMatrix A        = NULL;
+  SUNLinearSolver LS = NULL;
+  N_Vector abstol    = NULL;
+  N_Vector cons      = NULL;
+  sunrealtype tret;
+  int flag;
+
+  N_VConst(ONE, y);
+
+  cvode_mem = CVodeCreate(CV_BDF, sunctx);
+  if (!cvode_mem) { return 1; }
+
+  /* the vector type is unknown until CVodeInit is called */
+  flag = CVodeSetUseIntegratorFusedKernels(cvode_mem, usefused);
+  if (flag != CV_NO_MALLOC)
+  {
+    fprintf(stderr, "CVodeSetUseIntegratorFusedKernels returned %i\n", flag);
+    return 1;
+  }
+
+  flag = CVodeInit(cvode_mem, ode_rhs, ZERO, y);
+  if (flag) { return 1; }
+
+  flag = CVodeSetMaxNumSteps(cvode_mem, 10000);
+  if (flag) { return 1; }
+
+  if (test == 1)
+  {
+    abstol = N_VClone(y);
+    cons   = N_VClone(y);
+    N_VConst(ATOL, abstol);
+    N_VConst(ONE, cons);
+
+    flag = CVodeSVtolerances(cvode_mem, RTOL, abstol);
+    if (flag) { return 1; }
+
+    flag = CVodeSetConstraints(cvode_mem, cons);
+    if (flag) { return 1; }
+  }
+  else
+  {
+    flag = CVodeSStolerances(cvode_mem, RTOL, ATOL);
+    if (flag) { return 1; }
+  }
+
+  if (test == 2)
+  {
+    flag = CVDiag(cvode_mem);
+    if (flag) { return 1; }
+  }
+  else
+  {
+    A  = SUNDenseMatrix(NEQ, NEQ, sunctx);
+    LS = SUNLinSol_Dense(y, A, sunctx);
+    if (!A || !LS) { return 1; }
+
+    flag = CVodeSetLinearSolver(cvode_mem, LS, A);
+    if (flag) { return 1; }
+  }
+
+  flag = CVodeSetUseIntegratorFusedKernels(cvode_mem, usefused);
+  if (flag)
+  {
+    fprintf(stderr, "CVodeSetUseIntegratorFusedKernels returned %i\n", flag);
+    return 1;
+  }
+
+  flag = CVode(cvode_mem, TOUT, y, &tret, CV_NORMAL);
+  if (flag < 0)
+  {
+    fprintf(stderr, "CVode returned %i\n", flag);
+    return 1;
+  }
+
+  flag = CVodeGetNumSteps(cvode_mem, nst);
+  if (flag) { return 1; }
+
+  flag = CVodeGetNumRhsEvals(cvode_mem, nfe);
+  if (flag) { return 1; }
+
+  CVodeFree(&cvode_mem);
+  SUNLinSolFree(LS);
+  SUNMatDestroy(A);
+  if (abstol) { N_VDestroy(abstol); }
+  if (cons) { N_VDestroy(cons); }
+
+  return 0;
+}
+
+int main(int argc, char* argv[])
+{
+  const char* names[] = {"SS tolerances, dense",
+                         "SV tolerances and constraints, dense",
+                         "SS tolerances, diagonal"};
+  SUNContext sunctx   = NULL;
+  N_Vector y_ref      = NULL;
+  N_Vector y_fused    = NULL;
+  long int nst_ref, nfe_ref, nst_fused, nfe_fused;
+  sunrealtype err;
+  int test, fails = 0;
+
+  if (SUNContext_Create(SUN_COMM_NULL, &sunctx))
+  {
+    fprintf(stderr, "SUNContext_Create failed\n");
+    return 1;
+  }
+
+  y_ref   = N_VNew_Serial(NEQ, sunctx);
+  y_fused = N_VNew_Serial(NEQ, sunctx);
+  if (!y_ref || !y_fused)
+  {
+    fprintf(stderr, "N_VNew_Serial returned NULL\n");
+    return 1;
+  }
+
+  for (test = 0; test < 3; test++)
+  {
+    if (solve(sunctx, test, SUNFALSE, y_ref, &nst_ref, &nfe_ref) ||
+        solve(sunctx, test, SUNTRUE, y_fused, &nst_fused, &nfe_fused))
+    {
+      fprintf(stderr, "FAIL: %s, solve failed\n", names[test]);
+      fails++;
+      continue;
+    }
+
+    N_VLinearSum(ONE, y_ref, -ONE, y_fused, y_fused);
+    err = N_VMaxNorm(y_fused);
+
+    printf("%-38s nst = %5ld / %5ld, nfe = %5ld / %5ld, max diff = %" GSYM "\n",
+           names[test], nst_ref, nst_fused, nfe_ref, nfe_fused, err);
+
+    if (labs(nst_ref - nst_fused) > nst_ref / 20 ||
+        labs(nfe_ref - nfe_fused) > nfe_ref / 20 || err > RTOL)
+    {
+      fprintf(stderr, "FAIL: %s, fused results differ\n", names[test]);
+      fails++;
+    }
+  }
+
+  N_VDestroy(y_ref);
+  N_VDestroy(y_fused);
+  SUNContext_Free(&sunctx);
+
+  if (fails) { printf("FAIL: %d test(s) failed\n", fails); }
+  else { printf("SUCCESS\n"); }
+
+  return fails;
+}
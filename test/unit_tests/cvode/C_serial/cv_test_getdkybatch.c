@@ -0,0 +1,252 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2025-2026, Lawrence Livermore National Security,
+ * University of Maryland Baltimore County, and the SUNDIALS contributors.
+ * Copyright (c) 2013-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * Copyright (c) 2002-2013, Lawrence Livermore National Security.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for CVodeGetDkyBatch. Solves the decoupled linear system
+ * y_i' = -lambda_i y_i with Adams and BDF methods and, after each step,
+ * compares the batched evaluation of the interpolant and its derivatives at
+ * several times in the last step against CVodeGetDky.
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "cvode/cvode.h"
+#include "nvector/nvector_serial.h"
+#include "sundials/sundials_math.h"
+#include "sunlinsol/sunlinsol_dense.h"
+#include "sunmatrix/sunmatrix_dense.h"
+
+#define NEQ    10
+#define NTIMES 7
+#define NSTEPS 50
+#define ZERO   SUN_RCONST(0.0)
+#define ONE    SUN_RCONST(1.0)
+#define TEN    SUN_RCONST(10.0)
+
+/* Decay rate of each component, from 1 to 1e2 */
+static sunrealtype lambda(sunindextype i)
+{
+  return SUNRpowerR(TEN, SUN_RCONST(2.0) * (sunrealtype)i / (NEQ - 1));
+}
+
+/* ODE right-hand side */
+static int f(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  sunrealtype* yd    = N_VGetArrayPointer(y);
+  sunrealtype* ydotd = N_VGetArrayPointer(ydot);
+  sunindextype i;
+
+  for (i = 0; i < NEQ; i++) { ydotd[i] = -lambda(i) * yd[i]; }
+
+  return 0;
+}
+
+/* Take steps and compare the batched and single output after each one */
+static int run(int lmm, SUNContext sunctx)
+{
+  int retval, step, k, q, m;
+  int fails          = 0;
+  sunrealtype tret   = ZERO;
+  sunrealtype hu, tn, err, maxerr = ZERO, scale;
+  sunrealtype times[NTIMES];
+  N_Vector y         = NULL;
+  N_Vector dky       = NULL;
+  N_Vector* dkys     = NULL;
+  SUNMatrix A        = NULL;
+  SUNLinearSolver LS = NULL;
+  void* cvode_mem    = NULL;
+
+  y = N_VNew_Serial(NEQ, sunctx);
+  if (!y)
+  {
+    fprintf(stderr, "N_VNew_Serial returned NULL\n");
+    return 1;
+  }
+  N_VConst(ONE, y);
+
+  dky  = N_VClone(y);
+  dkys = N_VCloneVectorArray(NTIMES, y);
+  if (!dky || !dkys)
+  {
+    fprintf(stderr, "N_VClone returned NULL\n");
+    return 1;
+  }
+
+  cvode_mem = CVodeCreate(lmm, sunctx);
+  if (!cvode_mem)
+  {
+    fprintf(stderr, "CVodeCreate returned NULL\n");
+    return 1;
+  }
+
+  retval = CVodeInit(cvode_mem, f, ZERO, y);
+  if (retval)
+  {
+    fprintf(stderr, "CVodeInit returned %i\n", retval);
+    return 1;
+  }
+
+  retval = CVodeSStolerances(cvode_mem, SUN_RCONST(1.0e-8), SUN_RCONST(1.0e-10));
+  if (retval)
+  {
+    fprintf(stderr, "CVodeSStolerances returned %i\n", retval);
+    return 1;
+  }
+
+  A = SUNDenseMatrix(NEQ, NEQ, sunctx);
+  if (!A)
+  {
+    fprintf(stderr, "SUNDenseMatrix returned NULL\n");
+    return 1;
+  }
+
+  LS = SUNLinSol_Dense(y, A, sunctx);
+  if (!LS)
+  {
+    fprintf(stderr, "SUNLinSol_Dense returned NULL\n");
+    return 1;
+  }
+
+  retval = CVodeSetLinearSolver(cvode_mem, LS, A);
+  if (retval)
+  {
+    fprintf(stderr, "CVodeSetLinearSolver returned %i\n", retval);
+    return 1;
+  }
+
+  for (step = 0; step < NSTEPS; step++)
+  {
+    retval = CVode(cvode_mem, ONE, y, &tret, CV_ONE_STEP);
+    if (retval < 0)
+    {
+      fprintf(stderr, "CVode returned %i\n", retval);
+      return 1;
+    }
+
+    retval = CVodeGetLastStep(cvode_mem, &hu);
+    if (retval)
+    {
+      fprintf(stderr, "CVodeGetLastStep returned %i\n", retval);
+      return 1;
+    }
+
+    retval = CVodeGetLastOrder(cvode_mem, &q);
+    if (retval)
+    {
+      fprintf(stderr, "CVodeGetLastOrder returned %i\n", retval);
+      return 1;
+    }
+
+    /* output times spanning the last step, in arbitrary order */
+    tn = tret;
+    for (m = 0; m < NTIMES; m++)
+    {
+      times[m] = tn - hu * (sunrealtype)((3 * m) % NTIMES) / (NTIMES - 1);
+    }
+
+    for (k = 0; k <= q; k++)
+    {
+      retval = CVodeGetDkyBatch(cvode_mem, NTIMES, times, k, dkys);
+      if (retval)
+      {
+        fprintf(stderr, "CVodeGetDkyBatch returned %i\n", retval);
+        return 1;
+      }
+
+      for (m = 0; m < NTIMES; m++)
+      {
+        retval = CVodeGetDky(cvode_mem, times[m], k, dky);
+        if (retval)
+        {
+          fprintf(stderr, "CVodeGetDky returned %i\n", retval);
+          return 1;
+        }
+
+        scale = SUNMAX(N_VMaxNorm(dky), ONE);
+        N_VLinearSum(ONE, dkys[m], -ONE, dky, dky);
+        err    = N_VMaxNorm(dky) / scale;
+        maxerr = SUNMAX(maxerr, err);
+      }
+    }
+  }
+
+  printf("%s: max relative difference = %g\n",
+         (lmm == CV_BDF) ? "BDF" : "Adams", (double)maxerr);
+
+  if (maxerr > SUN_RCONST(100.0) * SUN_UNIT_ROUNDOFF)
+  {
+    fprintf(stderr, "Batched output differs from CVodeGetDky\n");
+    fails++;
+  }
+
+  /* Check that an output time outside of the last step is rejected */
+  times[NTIMES - 1] = tret + TEN * hu;
+  retval            = CVodeGetDkyBatch(cvode_mem, NTIMES, times, 0, dkys);
+  if (retval != CV_BAD_T)
+  {
+    fprintf(stderr, "CVodeGetDkyBatch returned %i, expected %i\n", retval,
+            CV_BAD_T);
+    fails++;
+  }
+
+  /* Check that an illegal derivative order is rejected */
+  retval = CVodeGetDkyBatch(cvode_mem, 1, times, q + 1, dkys);
+  if (retval != CV_BAD_K)
+  {
+    fprintf(stderr, "CVodeGetDkyBatch returned %i, expected %i\n", retval,
+            CV_BAD_K);
+    fails++;
+  }
+
+  CVodeFree(&cvode_mem);
+  SUNLinSolFree(LS);
+  SUNMatDestroy(A);
+  N_VDestroyVectorArray(dkys, NTIMES);
+  N_VDestroy(dky);
+  N_VDestroy(y);
+
+  return fails;
+}
+
+/* Main program */
+int main(int argc, char* argv[])
+{
+  int retval        = 0;
+  int fails         = 0;
+  SUNContext sunctx = NULL;
+
+  retval = SUNContext_Create(SUN_COMM_NULL, &sunctx);
+  if (retval)
+  {
+    fprintf(stderr, "SUNContext_Create returned %i\n", retval);
+    return 1;
+  }
+
+  fails += run(CV_ADAMS, sunctx);
+  fails += run(CV_BDF, sunctx);
+
+  SUNContext_Free(&sunctx);
+
+  if (fails)
+  {
+    printf("FAIL\n");
+    return 1;
+  }
+
+  printf("SUCCESS\n");
+
+  return 0;
+}
+
+/*---- end of file ----*/
@@ -0,0 +1,229 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2025-2026, Lawrence Livermore National Security,
+ * University of Maryland Baltimore County, and the SUNDIALS contributors.
+ * Copyright (c) 2013-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * Copyright (c) 2002-2013, Lawrence Livermore National Security.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for CVodeSetJacReuseOnReInit. Solves the decoupled linear system
+ * y_i' = -lambda_i y_i over several coupling intervals, calling CVodeReInit at
+ * the start of each, and checks the number of Jacobian evaluations with reuse
+ * disabled, enabled, and enabled with a time window that is too small.
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "cvode/cvode.h"
+#include "nvector/nvector_serial.h"
+#include "sundials/sundials_math.h"
+#include "sunlinsol/sunlinsol_dense.h"
+#include "sunmatrix/sunmatrix_dense.h"
+
+#define NEQ        10
+#define NINTERVALS 5
+#define ZERO       SUN_RCONST(0.0)
+#define ONE        SUN_RCONST(1.0)
+#define TEN        SUN_RCONST(10.0)
+#define DT         SUN_RCONST(0.02)
+
+/* Decay rate of each component, from 1 to 1e3 */
+static sunrealtype lambda(sunindextype i)
+{
+  return SUNRpowerR(TEN, SUN_RCONST(3.0) * (sunrealtype)i / (NEQ - 1));
+}
+
+/* ODE right-hand side */
+static int f(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  sunrealtype* yd    = N_VGetArrayPointer(y);
+  sunrealtype* ydotd = N_VGetArrayPointer(ydot);
+  sunindextype i;
+
+  for (i = 0; i < NEQ; i++) { ydotd[i] = -lambda(i) * yd[i]; }
+
+  return 0;
+}
+
+/* Integrate over the coupling intervals and check the number of Jacobian
+   evaluations after the first interval */
+static int run(void* cvode_mem, N_Vector y, const char* name,
+               sunbooleantype expect_reuse)
+{
+  int retval, k;
+  long int nje = 0, nje_total = 0;
+  sunrealtype t = ZERO, err, maxerr = ZERO;
+  sunrealtype* yd;
+  sunindextype i;
+
+  N_VConst(ONE, y);
+
+  for (k = 0; k < NINTERVALS; k++)
+  {
+    retval = CVodeReInit(cvode_mem, t, y);
+    if (retval)
+    {
+      fprintf(stderr, "CVodeReInit returned %i\n", retval);
+      return 1;
+    }
+
+    retval = CVode(cvode_mem, (k + 1) * DT, y, &t, CV_NORMAL);
+    if (retval)
+    {
+      fprintf(stderr, "CVode returned %i\n", retval);
+      return 1;
+    }
+
+    retval = CVodeGetNumJacEvals(cvode_mem, &nje);
+    if (retval)
+    {
+      fprintf(stderr, "CVodeGetNumJacEvals returned %i\n", retval);
+      return 1;
+    }
+
+    if (k > 0) { nje_total += nje; }
+  }
+
+  yd = N_VGetArrayPointer(y);
+  for (i = 0; i < NEQ; i++)
+  {
+    err    = SUNRabs(yd[i] - SUNRexp(-lambda(i) * t));
+    maxerr = SUNMAX(maxerr, err);
+  }
+
+  printf("%s: max error = %g, Jac evals after first interval = %ld\n", name,
+         (double)maxerr, nje_total);
+
+  if (maxerr > SUN_RCONST(1.0e-4))
+  {
+    fprintf(stderr, "Solution error too large\n");
+    return 1;
+  }
+
+  if ((expect_reuse && nje_total != 0) ||
+      (!expect_reuse && nje_total < NINTERVALS - 1))
+  {
+    fprintf(stderr, "Unexpected number of Jacobian evaluations\n");
+    return 1;
+  }
+
+  return 0;
+}
+
+/* Main program */
+int main(int argc, char* argv[])
+{
+  int retval         = 0;
+  int fails          = 0;
+  SUNContext sunctx  = NULL;
+  N_Vector y         = NULL;
+  SUNMatrix A        = NULL;
+  SUNLinearSolver LS = NULL;
+  void* cvode_mem    = NULL;
+
+  retval = SUNContext_Create(SUN_COMM_NULL, &sunctx);
+  if (retval)
+  {
+    fprintf(stderr, "SUNContext_Create returned %i\n", retval);
+    return 1;
+  }
+
+  y = N_VNew_Serial(NEQ, sunctx);
+  if (!y)
+  {
+    fprintf(stderr, "N_VNew_Serial returned NULL\n");
+    return 1;
+  }
+  N_VConst(ONE, y);
+
+  A = SUNDenseMatrix(NEQ, NEQ, sunctx);
+  if (!A)
+  {
+    fprintf(stderr, "SUNDenseMatrix returned NULL\n");
+    return 1;
+  }
+
+  LS = SUNLinSol_Dense(y, A, sunctx);
+  if (!LS)
+  {
+    fprintf(stderr, "SUNLinSol_Dense returned NULL\n");
+    return 1;
+  }
+
+  cvode_mem = CVodeCreate(CV_BDF, sunctx);
+  if (!cvode_mem)
+  {
+    fprintf(stderr, "CVodeCreate returned NULL\n");
+    return 1;
+  }
+
+  retval = CVodeInit(cvode_mem, f, ZERO, y);
+  if (retval)
+  {
+    fprintf(stderr, "CVodeInit returned %i\n", retval);
+    return 1;
+  }
+
+  retval = CVodeSStolerances(cvode_mem, SUN_RCONST(1.0e-6), SUN_RCONST(1.0e-8));
+  if (retval)
+  {
+    fprintf(stderr, "CVodeSStolerances returned %i\n", retval);
+    return 1;
+  }
+
+  retval = CVodeSetLinearSolver(cvode_mem, LS, A);
+  if (retval)
+  {
+    fprintf(stderr, "CVodeSetLinearSolver returned %i\n", retval);
+    return 1;
+  }
+
+  /* Default, the Jacobian is evaluated in the first step of every interval */
+  fails += run(cvode_mem, y, "no reuse", SUNFALSE);
+
+  /* Reuse the Jacobian from the previous interval */
+  retval = CVodeSetJacReuseOnReInit(cvode_mem, ONE, ZERO);
+  if (retval)
+  {
+    fprintf(stderr, "CVodeSetJacReuseOnReInit returned %i\n", retval);
+    return 1;
+  }
+
+  fails += run(cvode_mem, y, "reuse", SUNTRUE);
+
+  /* The Jacobian is too old to be reused */
+  retval = CVodeSetJacReuseOnReInit(cvode_mem, SUN_RCONST(1.0e-8), ZERO);
+  if (retval)
+  {
+    fprintf(stderr, "CVodeSetJacReuseOnReInit returned %i\n", retval);
+    return 1;
+  }
+
+  fails += run(cvode_mem, y, "reuse window too small", SUNFALSE);
+
+  /* Clean up */
+  CVodeFree(&cvode_mem);
+  SUNLinSolFree(LS);
+  SUNMatDestroy(A);
+  N_VDestroy(y);
+  SUNContext_Free(&sunctx);
+
+  if (fails)
+  {
+    printf("FAIL\n");
+    return 1;
+  }
+
+  printf("SUCCESS\n");
+
+  return 0;
+}
+
+/*---- end of file ----*/
@@ -0,0 +1,226 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2025-2026, Lawrence Livermore National Security,
+ * University of Maryland Baltimore County, and the SUNDIALS contributors.
+ * Copyright (c) 2013-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * Copyright (c) 2002-2013, Lawrence Livermore National Security.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for CVodeSetJacTimesDirDeriv. Solves the decoupled linear system
+ * y_i' = -lambda_i y_i with a matrix-free GMRES solver using the exact
+ * directional derivative and then the difference quotient default, and checks
+ * the solution and the number of difference quotient RHS evaluations.
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "cvode/cvode.h"
+#include "nvector/nvector_serial.h"
+#include "sundials/sundials_math.h"
+#include "sunlinsol/sunlinsol_spgmr.h"
+
+#define NEQ  20
+#define ZERO SUN_RCONST(0.0)
+#define ONE  SUN_RCONST(1.0)
+#define TEN  SUN_RCONST(10.0)
+
+/* Decay rate of each component, from 1 to 1e4 */
+static sunrealtype lambda(sunindextype i)
+{
+  return SUNRpowerR(TEN, SUN_RCONST(4.0) * (sunrealtype)i / (NEQ - 1));
+}
+
+/* ODE right-hand side */
+static int f(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  sunrealtype* yd    = N_VGetArrayPointer(y);
+  sunrealtype* ydotd = N_VGetArrayPointer(ydot);
+  sunindextype i;
+
+  for (i = 0; i < NEQ; i++) { ydotd[i] = -lambda(i) * yd[i]; }
+
+  return 0;
+}
+
+/* Directional derivative of the right-hand side */
+static int jtdir(sunrealtype t, N_Vector y, N_Vector v, N_Vector Jv,
+                 void* user_data)
+{
+  sunrealtype* vd  = N_VGetArrayPointer(v);
+  sunrealtype* Jvd = N_VGetArrayPointer(Jv);
+  sunindextype i;
+
+  for (i = 0; i < NEQ; i++) { Jvd[i] = -lambda(i) * vd[i]; }
+
+  return 0;
+}
+
+/* Integrate to t = 1 and check the solution and statistics */
+static int run(void* cvode_mem, N_Vector y, sunbooleantype exact)
+{
+  int retval;
+  long int nfeLS = 0, njtimes = 0;
+  sunrealtype t, err, maxerr = ZERO;
+  sunrealtype* yd;
+  sunindextype i;
+
+  N_VConst(ONE, y);
+  retval = CVodeReInit(cvode_mem, ZERO, y);
+  if (retval)
+  {
+    fprintf(stderr, "CVodeReInit returned %i\n", retval);
+    return 1;
+  }
+
+  retval = CVode(cvode_mem, ONE, y, &t, CV_NORMAL);
+  if (retval)
+  {
+    fprintf(stderr, "CVode returned %i\n", retval);
+    return 1;
+  }
+
+  yd = N_VGetArrayPointer(y);
+  for (i = 0; i < NEQ; i++)
+  {
+    err    = SUNRabs(yd[i] - SUNRexp(-lambda(i) * t));
+    maxerr = SUNMAX(maxerr, err);
+  }
+
+  retval = CVodeGetNumLinRhsEvals(cvode_mem, &nfeLS);
+  if (retval)
+  {
+    fprintf(stderr, "CVodeGetNumLinRhsEvals returned %i\n", retval);
+    return 1;
+  }
+
+  retval = CVodeGetNumJtimesEvals(cvode_mem, &njtimes);
+  if (retval)
+  {
+    fprintf(stderr, "CVodeGetNumJtimesEvals returned %i\n", retval);
+    return 1;
+  }
+
+  printf("%s: max error = %g, Jv evals = %ld, LS RHS evals = %ld\n",
+         exact ? "directional derivative" : "difference quotient",
+         (double)maxerr, njtimes, nfeLS);
+
+  if (maxerr > SUN_RCONST(1.0e-4))
+  {
+    fprintf(stderr, "Solution error too large\n");
+    return 1;
+  }
+
+  if (njtimes == 0 || (exact && nfeLS != 0) || (!exact && nfeLS != njtimes))
+  {
+    fprintf(stderr, "Unexpected Jacobian-vector product statistics\n");
+    return 1;
+  }
+
+  return 0;
+}
+
+/* Main program */
+int main(int argc, char* argv[])
+{
+  int retval         = 0;
+  int fails          = 0;
+  SUNContext sunctx  = NULL;
+  N_Vector y         = NULL;
+  SUNLinearSolver LS = NULL;
+  void* cvode_mem    = NULL;
+
+  retval = SUNContext_Create(SUN_COMM_NULL, &sunctx);
+  if (retval)
+  {
+    fprintf(stderr, "SUNContext_Create returned %i\n", retval);
+    return 1;
+  }
+
+  y = N_VNew_Serial(NEQ, sunctx);
+  if (!y)
+  {
+    fprintf(stderr, "N_VNew_Serial returned NULL\n");
+    return 1;
+  }
+  N_VConst(ONE, y);
+
+  LS = SUNLinSol_SPGMR(y, SUN_PREC_NONE, NEQ, sunctx);
+  if (!LS)
+  {
+    fprintf(stderr, "SUNLinSol_SPGMR returned NULL\n");
+    return 1;
+  }
+
+  cvode_mem = CVodeCreate(CV_BDF, sunctx);
+  if (!cvode_mem)
+  {
+    fprintf(stderr, "CVodeCreate returned NULL\n");
+    return 1;
+  }
+
+  retval = CVodeInit(cvode_mem, f, ZERO, y);
+  if (retval)
+  {
+    fprintf(stderr, "CVodeInit returned %i\n", retval);
+    return 1;
+  }
+
+  retval = CVodeSStolerances(cvode_mem, SUN_RCONST(1.0e-6), SUN_RCONST(1.0e-8));
+  if (retval)
+  {
+    fprintf(stderr, "CVodeSStolerances returned %i\n", retval);
+    return 1;
+  }
+
+  retval = CVodeSetLinearSolver(cvode_mem, LS, NULL);
+  if (retval)
+  {
+    fprintf(stderr, "CVodeSetLinearSolver returned %i\n", retval);
+    return 1;
+  }
+
+  /* Exact directional derivative */
+  retval = CVodeSetJacTimesDirDeriv(cvode_mem, jtdir);
+  if (retval)
+  {
+    fprintf(stderr, "CVodeSetJacTimesDirDeriv returned %i\n", retval);
+    return 1;
+  }
+
+  fails += run(cvode_mem, y, SUNTRUE);
+
+  /* Revert to the difference quotient */
+  retval = CVodeSetJacTimesDirDeriv(cvode_mem, NULL);
+  if (retval)
+  {
+    fprintf(stderr, "CVodeSetJacTimesDirDeriv returned %i\n", retval);
+    return 1;
+  }
+
+  fails += run(cvode_mem, y, SUNFALSE);
+
+  /* Clean up */
+  CVodeFree(&cvode_mem);
+  SUNLinSolFree(LS);
+  N_VDestroy(y);
+  SUNContext_Free(&sunctx);
+
+  if (fails)
+  {
+    printf("FAIL\n");
+    return 1;
+  }
+
+  printf("SUCCESS\n");
+
+  return 0;
+}
+
+/*---- end of file ----*/
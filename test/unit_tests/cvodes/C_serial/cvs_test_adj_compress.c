@@ -0,0 +1,365 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2025-2026, Lawrence Livermore National Security,
+ * University of Maryland Baltimore County, and the SUNDIALS contributors.
+ * Copyright (c) 2013-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * Copyright (c) 2002-2013, Lawrence Livermore National Security.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for the compressed adjoint interpolation data
+ * (CVodeSetAdjCompression). NC copies of the Robertson problem, with the
+ * first rate constant scaled by 1 + c / NC in copy c, are solved forward with
+ * sensitivities. The adjoint of the sum of y3(TF), forced by the first
+ * sensitivity so that the interpolated sensitivities are used, is solved
+ * backward with Hermite and polynomial interpolation. For each compression
+ * method the adjoint solution at t = 0 must agree with the uncompressed run
+ * to within the integration tolerances and the quantized methods must reduce
+ * the stored data.
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "cvodes/cvodes.h"
+#include "nvector/nvector_serial.h"
+#include "sunlinsol/sunlinsol_dense.h"
+#include "sunmatrix/sunmatrix_dense.h"
+
+#define NC    20
+#define NEQ   (3 * NC)
+#define NS    3
+#define STEPS 50
+#define ZERO  SUN_RCONST(0.0)
+#define ONE   SUN_RCONST(1.0)
+#define TF    SUN_RCONST(4.0)
+#define DTOL  SUN_RCONST(1.0e-4)
+
+typedef struct
+{
+  sunrealtype p[NS];
+} UserData;
+
+/* ODE right-hand side */
+static int f(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  sunrealtype* p = ((UserData*)user_data)->p;
+  sunrealtype *yd, *ydotd;
+  sunrealtype k1;
+  int c;
+
+  for (c = 0; c < NC; c++)
+  {
+    yd    = N_VGetArrayPointer(y) + 3 * c;
+    ydotd = N_VGetArrayPointer(ydot) + 3 * c;
+    k1    = p[0] * (ONE + (sunrealtype)c / NC);
+
+    ydotd[0] = -k1 * yd[0] + p[1] * yd[1] * yd[2];
+    ydotd[2] = p[2] * yd[1] * yd[1];
+    ydotd[1] = -ydotd[0] - ydotd[2];
+  }
+
+  return 0;
+}
+
+/* Adjoint right-hand side, -J^T yB - yS[0] */
+static int fBS(sunrealtype t, N_Vector y, N_Vector* yS, N_Vector yB,
+               N_Vector yBdot, void* user_dataB)
+{
+  sunrealtype* p = ((UserData*)user_dataB)->p;
+  sunrealtype *yd, *sd, *ld, *ldd;
+  sunrealtype k1, l21, l32;
+  int c;
+
+  for (c = 0; c < NC; c++)
+  {
+    yd  = N_VGetArrayPointer(y) + 3 * c;
+    sd  = N_VGetArrayPointer(yS[0]) + 3 * c;
+    ld  = N_VGetArrayPointer(yB) + 3 * c;
+    ldd = N_VGetArrayPointer(yBdot) + 3 * c;
+    k1  = p[0] * (ONE + (sunrealtype)c / NC);
+
+    l21 = ld[1] - ld[0];
+    l32 = ld[2] - ld[1];
+
+    ldd[0] = -k1 * l21 - sd[0];
+    ldd[1] = -p[1] * yd[2] * l21 - 2 * p[2] * yd[1] * l32 - sd[1];
+    ldd[2] = -p[1] * yd[1] * l21 - sd[2];
+  }
+
+  return 0;
+}
+
+/* Solve the forward and adjoint problems with the given interpolation and
+   compression and return the adjoint solution at t = 0 in yB */
+static int solve(int interp, SUNDataCompression ctype, sunrealtype ctol,
+                 N_Vector yB, sunrealtype* ratio, SUNContext sunctx)
+{
+  int c, is, ncheck, which, retval;
+  sunrealtype tret, decode_time;
+  sunrealtype pbar[NS];
+  UserData data;
+  void* cvode_mem     = NULL;
+  SUNMatrix A         = NULL;
+  SUNMatrix AB        = NULL;
+  SUNLinearSolver LS  = NULL;
+  SUNLinearSolver LSB = NULL;
+  N_Vector y          = NULL;
+  N_Vector* yS        = NULL;
+
+  data.p[0] = SUN_RCONST(0.04);
+  data.p[1] = SUN_RCONST(1.0e4);
+  data.p[2] = SUN_RCONST(3.0e7);
+  for (is = 0; is < NS; is++) { pbar[is] = data.p[is]; }
+
+  y  = N_VNew_Serial(NEQ, sunctx);
+  yS = N_VCloneVectorArray(NS, y);
+
+  N_VConst(ZERO, y);
+  for (c = 0; c < NC; c++) { N_VGetArrayPointer(y)[3 * c] = ONE; }
+  for (is = 0; is < NS; is++) { N_VConst(ZERO, yS[is]); }
+
+  cvode_mem = CVodeCreate(CV_BDF, sunctx);
+  if (!cvode_mem)
+  {
+    fprintf(stderr, "CVodeCreate returned NULL\n");
+    return 1;
+  }
+
+  retval = CVodeInit(cvode_mem, f, ZERO, y);
+  if (retval)
+  {
+    fprintf(stderr, "CVodeInit returned %i\n", retval);
+    return 1;
+  }
+
+  retval = CVodeSStolerances(cvode_mem, SUN_RCONST(1.0e-6),
+                             SUN_RCONST(1.0e-10));
+  if (retval)
+  {
+    fprintf(stderr, "CVodeSStolerances returned %i\n", retval);
+    return 1;
+  }
+
+  retval = CVodeSetUserData(cvode_mem, &data);
+  if (retval)
+  {
+    fprintf(stderr, "CVodeSetUserData returned %i\n", retval);
+    return 1;
+  }
+
+  A  = SUNDenseMatrix(NEQ, NEQ, sunctx);
+  LS = SUNLinSol_Dense(y, A, sunctx);
+
+  retval = CVodeSetLinearSolver(cvode_mem, LS, A);
+  if (retval)
+  {
+    fprintf(stderr, "CVodeSetLinearSolver returned %i\n", retval);
+    return 1;
+  }
+
+  retval = CVodeSensInit(cvode_mem, NS, CV_SIMULTANEOUS, NULL, yS);
+  if (retval)
+  {
+    fprintf(stderr, "CVodeSensInit returned %i\n", retval);
+    return 1;
+  }
+
+  retval = CVodeSensEEtolerances(cvode_mem);
+  if (retval)
+  {
+    fprintf(stderr, "CVodeSensEEtolerances returned %i\n", retval);
+    return 1;
+  }
+
+  retval = CVodeSetSensParams(cvode_mem, data.p, pbar, NULL);
+  if (retval)
+  {
+    fprintf(stderr, "CVodeSetSensParams returned %i\n", retval);
+    return 1;
+  }
+
+  retval = CVodeAdjInit(cvode_mem, STEPS, interp);
+  if (retval)
+  {
+    fprintf(stderr, "CVodeAdjInit returned %i\n", retval);
+    return 1;
+  }
+
+  retval = CVodeSetAdjCompression(cvode_mem, ctype, ctol);
+  if (retval)
+  {
+    fprintf(stderr, "CVodeSetAdjCompression returned %i\n", retval);
+    return 1;
+  }
+
+  retval = CVodeF(cvode_mem, TF, y, &tret, CV_NORMAL, &ncheck);
+  if (retval < 0)
+  {
+    fprintf(stderr, "CVodeF returned %i\n", retval);
+    return 1;
+  }
+
+  /* The compression cannot be changed once data is stored */
+  if (CVodeSetAdjCompression(cvode_mem, ctype, ctol) != CV_ILL_INPUT)
+  {
+    fprintf(stderr, "CVodeSetAdjCompression after CVodeF did not fail\n");
+    return 1;
+  }
+
+  retval = CVodeCreateB(cvode_mem, CV_BDF, &which);
+  if (retval)
+  {
+    fprintf(stderr, "CVodeCreateB returned %i\n", retval);
+    return 1;
+  }
+
+  N_VConst(ZERO, yB);
+  for (c = 0; c < NC; c++) { N_VGetArrayPointer(yB)[3 * c + 2] = ONE; }
+
+  retval = CVodeInitBS(cvode_mem, which, fBS, TF, yB);
+  if (retval)
+  {
+    fprintf(stderr, "CVodeInitBS returned %i\n", retval);
+    return 1;
+  }
+
+  retval = CVodeSStolerancesB(cvode_mem, which, SUN_RCONST(1.0e-6),
+                              SUN_RCONST(1.0e-8));
+  if (retval)
+  {
+    fprintf(stderr, "CVodeSStolerancesB returned %i\n", retval);
+    return 1;
+  }
+
+  retval = CVodeSetUserDataB(cvode_mem, which, &data);
+  if (retval)
+  {
+    fprintf(stderr, "CVodeSetUserDataB returned %i\n", retval);
+    return 1;
+  }
+
+  AB  = SUNDenseMatrix(NEQ, NEQ, sunctx);
+  LSB = SUNLinSol_Dense(yB, AB, sunctx);
+
+  retval = CVodeSetLinearSolverB(cvode_mem, which, LSB, AB);
+  if (retval)
+  {
+    fprintf(stderr, "CVodeSetLinearSolverB returned %i\n", retval);
+    return 1;
+  }
+
+  retval = CVodeB(cvode_mem, ZERO, CV_NORMAL);
+  if (retval < 0)
+  {
+    fprintf(stderr, "CVodeB returned %i\n", retval);
+    return 1;
+  }
+
+  retval = CVodeGetB(cvode_mem, which, &tret, yB);
+  if (retval)
+  {
+    fprintf(stderr, "CVodeGetB returned %i\n", retval);
+    return 1;
+  }
+
+  retval = CVodeGetAdjCompressionStats(cvode_mem, ratio, &decode_time);
+  if (retval)
+  {
+    fprintf(stderr, "CVodeGetAdjCompressionStats returned %i\n", retval);
+    return 1;
+  }
+
+  CVodeFree(&cvode_mem);
+  SUNLinSolFree(LS);
+  SUNLinSolFree(LSB);
+  SUNMatDestroy(A);
+  SUNMatDestroy(AB);
+  N_VDestroy(y);
+  N_VDestroyVectorArray(yS, NS);
+
+  return 0;
+}
+
+/* Compare the compressed runs with the uncompressed run */
+static int run(int interp, SUNContext sunctx)
+{
+  int k, fails = 0;
+  sunrealtype ratio, diff;
+  N_Vector yB_ref, yB;
+  const SUNDataCompression ctype[3] = {SUNDATACOMPRESSION_FLOAT,
+                                       SUNDATACOMPRESSION_QUANTIZE,
+                                       SUNDATACOMPRESSION_DELTA};
+  const char* name[3]               = {"float", "quantize", "delta"};
+
+  yB_ref = N_VNew_Serial(NEQ, sunctx);
+  yB     = N_VClone(yB_ref);
+
+  if (solve(interp, SUNDATACOMPRESSION_NONE, ZERO, yB_ref, &ratio, sunctx))
+  {
+    return 1;
+  }
+
+  if (ratio != ONE)
+  {
+    fprintf(stderr, "uncompressed ratio = %g\n", (double)ratio);
+    fails++;
+  }
+
+  for (k = 0; k < 3; k++)
+  {
+    if (solve(interp, ctype[k], ONE, yB, &ratio, sunctx)) { return 1; }
+
+    N_VLinearSum(ONE, yB_ref, -ONE, yB, yB);
+    diff = N_VMaxNorm(yB) / N_VMaxNorm(yB_ref);
+
+    printf("%s %s: ratio = %g, diff = %g\n",
+           interp == CV_HERMITE ? "hermite" : "polynomial", name[k],
+           (double)ratio, (double)diff);
+
+    if (diff > DTOL || ratio <= ONE)
+    {
+      fprintf(stderr, "%s: compressed run differs\n", name[k]);
+      fails++;
+    }
+  }
+
+  N_VDestroy(yB_ref);
+  N_VDestroy(yB);
+
+  return fails;
+}
+
+int main(int argc, char* argv[])
+{
+  int fails         = 0;
+  SUNContext sunctx = NULL;
+
+  if (SUNContext_Create(SUN_COMM_NULL, &sunctx))
+  {
+    fprintf(stderr, "SUNContext_Create failed\n");
+    return 1;
+  }
+
+  fails += run(CV_HERMITE, sunctx);
+  fails += run(CV_POLYNOMIAL, sunctx);
+
+  SUNContext_Free(&sunctx);
+
+  if (fails)
+  {
+    printf("FAIL\n");
+    return 1;
+  }
+
+  printf("SUCCESS\n");
+
+  return 0;
+}
+
+/*---- end of file ----*/
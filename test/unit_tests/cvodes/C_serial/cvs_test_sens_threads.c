@@ -0,0 +1,317 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2025-2026, Lawrence Livermore National Security,
+ * University of Maryland Baltimore County, and the SUNDIALS contributors.
+ * Copyright (c) 2013-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * Copyright (c) 2002-2013, Lawrence Livermore National Security.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for computing the sensitivity right-hand sides with multiple
+ * threads (CVodeSetSensNumThreads). The Robertson problem with sensitivities
+ * to its three rate constants is solved with the internal DQ sensitivity
+ * right-hand side (with per-thread parameters and user data) and with a user
+ * supplied fS1. For each, the solution, sensitivities, and evaluation counts
+ * obtained with one and with several threads must be identical.
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "cvodes/cvodes.h"
+#include "nvector/nvector_serial.h"
+#include "sunlinsol/sunlinsol_dense.h"
+#include "sunmatrix/sunmatrix_dense.h"
+
+#define NEQ  3
+#define NS   3
+#define NTHR 2
+#define ZERO SUN_RCONST(0.0)
+#define ONE  SUN_RCONST(1.0)
+#define TF   SUN_RCONST(40.0)
+
+typedef struct
+{
+  sunrealtype* p;
+} UserData;
+
+/* ODE right-hand side */
+static int f(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  sunrealtype* p     = ((UserData*)user_data)->p;
+  sunrealtype* yd    = N_VGetArrayPointer(y);
+  sunrealtype* ydotd = N_VGetArrayPointer(ydot);
+
+  ydotd[0] = -p[0] * yd[0] + p[1] * yd[1] * yd[2];
+  ydotd[2] = p[2] * yd[1] * yd[1];
+  ydotd[1] = -ydotd[0] - ydotd[2];
+
+  return 0;
+}
+
+/* Right-hand side of the iS-th sensitivity equation */
+static int fS1(int Ns, sunrealtype t, N_Vector y, N_Vector ydot, int iS,
+               N_Vector yS, N_Vector ySdot, void* user_data, N_Vector tmp1,
+               N_Vector tmp2)
+{
+  sunrealtype* p     = ((UserData*)user_data)->p;
+  sunrealtype* yd    = N_VGetArrayPointer(y);
+  sunrealtype* sd    = N_VGetArrayPointer(yS);
+  sunrealtype* sdotd = N_VGetArrayPointer(ySdot);
+  sunrealtype sd1, sd2, sd3;
+
+  sd1 = -p[0] * sd[0] + p[1] * yd[2] * sd[1] + p[1] * yd[1] * sd[2];
+  sd3 = 2 * p[2] * yd[1] * sd[1];
+  sd2 = -sd1 - sd3;
+
+  switch (iS)
+  {
+  case 0:
+    sd1 += -yd[0];
+    sd2 += yd[0];
+    break;
+  case 1:
+    sd1 += yd[1] * yd[2];
+    sd2 += -yd[1] * yd[2];
+    break;
+  case 2:
+    sd2 += -yd[1] * yd[1];
+    sd3 += yd[1] * yd[1];
+    break;
+  }
+
+  sdotd[0] = sd1;
+  sdotd[1] = sd2;
+  sdotd[2] = sd3;
+
+  return 0;
+}
+
+/* Integrate to TF with nthreads threads, using fS1 if use_fS1 is set */
+static int solve(int nthreads, int use_fS1, N_Vector y, N_Vector* yS,
+                 long int* nfSe, long int* nfeS, SUNContext sunctx)
+{
+  int t, is, retval;
+  sunrealtype tret;
+  sunrealtype p[NS] = {SUN_RCONST(0.04), SUN_RCONST(1.0e4), SUN_RCONST(3.0e7)};
+  sunrealtype pbar[NS];
+  sunrealtype p_thr[NTHR][NS];
+  sunrealtype* p_ptr[NTHR];
+  UserData data_thr[NTHR];
+  void* data_ptr[NTHR];
+  UserData data      = {p};
+  void* cvode_mem    = NULL;
+  SUNMatrix A        = NULL;
+  SUNLinearSolver LS = NULL;
+  sunrealtype* ydata = N_VGetArrayPointer(y);
+
+  for (is = 0; is < NS; is++) { pbar[is] = p[is]; }
+
+  for (t = 0; t < NTHR; t++)
+  {
+    for (is = 0; is < NS; is++) { p_thr[t][is] = p[is]; }
+    p_ptr[t]      = p_thr[t];
+    data_thr[t].p = p_thr[t];
+    data_ptr[t]   = &data_thr[t];
+  }
+
+  ydata[0] = ONE;
+  ydata[1] = ZERO;
+  ydata[2] = ZERO;
+  for (is = 0; is < NS; is++) { N_VConst(ZERO, yS[is]); }
+
+  cvode_mem = CVodeCreate(CV_BDF, sunctx);
+  if (!cvode_mem)
+  {
+    fprintf(stderr, "CVodeCreate returned NULL\n");
+    return 1;
+  }
+
+  retval = CVodeInit(cvode_mem, f, ZERO, y);
+  if (retval)
+  {
+    fprintf(stderr, "CVodeInit returned %i\n", retval);
+    return 1;
+  }
+
+  retval = CVodeSStolerances(cvode_mem, SUN_RCONST(1.0e-6),
+                             SUN_RCONST(1.0e-10));
+  if (retval)
+  {
+    fprintf(stderr, "CVodeSStolerances returned %i\n", retval);
+    return 1;
+  }
+
+  retval = CVodeSetUserData(cvode_mem, &data);
+  if (retval)
+  {
+    fprintf(stderr, "CVodeSetUserData returned %i\n", retval);
+    return 1;
+  }
+
+  A  = SUNDenseMatrix(NEQ, NEQ, sunctx);
+  LS = SUNLinSol_Dense(y, A, sunctx);
+
+  retval = CVodeSetLinearSolver(cvode_mem, LS, A);
+  if (retval)
+  {
+    fprintf(stderr, "CVodeSetLinearSolver returned %i\n", retval);
+    return 1;
+  }
+
+  if (use_fS1)
+  {
+    retval = CVodeSensInit1(cvode_mem, NS, CV_STAGGERED, fS1, yS);
+  }
+  else { retval = CVodeSensInit(cvode_mem, NS, CV_SIMULTANEOUS, NULL, yS); }
+  if (retval)
+  {
+    fprintf(stderr, "CVodeSensInit(1) returned %i\n", retval);
+    return 1;
+  }
+
+  retval = CVodeSensEEtolerances(cvode_mem);
+  if (retval)
+  {
+    fprintf(stderr, "CVodeSensEEtolerances returned %i\n", retval);
+    return 1;
+  }
+
+  retval = CVodeSetSensParams(cvode_mem, p, pbar, NULL);
+  if (retval)
+  {
+    fprintf(stderr, "CVodeSetSensParams returned %i\n", retval);
+    return 1;
+  }
+
+  retval = CVodeSetSensNumThreads(cvode_mem, nthreads);
+  if (retval)
+  {
+    fprintf(stderr, "CVodeSetSensNumThreads returned %i\n", retval);
+    return 1;
+  }
+
+  if (!use_fS1)
+  {
+    retval = CVodeSetSensThreadData(cvode_mem, data_ptr, p_ptr);
+    if (retval)
+    {
+      fprintf(stderr, "CVodeSetSensThreadData returned %i\n", retval);
+      return 1;
+    }
+  }
+
+  retval = CVode(cvode_mem, TF, y, &tret, CV_NORMAL);
+  if (retval < 0)
+  {
+    fprintf(stderr, "CVode returned %i\n", retval);
+    return 1;
+  }
+
+  retval = CVodeGetSens(cvode_mem, &tret, yS);
+  if (retval)
+  {
+    fprintf(stderr, "CVodeGetSens returned %i\n", retval);
+    return 1;
+  }
+
+  retval = CVodeGetSensNumRhsEvals(cvode_mem, nfSe);
+  if (retval)
+  {
+    fprintf(stderr, "CVodeGetSensNumRhsEvals returned %i\n", retval);
+    return 1;
+  }
+
+  retval = CVodeGetNumRhsEvalsSens(cvode_mem, nfeS);
+  if (retval)
+  {
+    fprintf(stderr, "CVodeGetNumRhsEvalsSens returned %i\n", retval);
+    return 1;
+  }
+
+  CVodeFree(&cvode_mem);
+  SUNLinSolFree(LS);
+  SUNMatDestroy(A);
+
+  return 0;
+}
+
+/* Compare the serial and threaded runs */
+static int run(int use_fS1, SUNContext sunctx)
+{
+  int is, fails = 0;
+  long int nfSe[2], nfeS[2];
+  sunrealtype diff;
+  N_Vector y[2], *yS[2];
+
+  y[0]  = N_VNew_Serial(NEQ, sunctx);
+  y[1]  = N_VClone(y[0]);
+  yS[0] = N_VCloneVectorArray(NS, y[0]);
+  yS[1] = N_VCloneVectorArray(NS, y[0]);
+
+  if (solve(1, use_fS1, y[0], yS[0], &nfSe[0], &nfeS[0], sunctx)) { return 1; }
+  if (solve(NTHR, use_fS1, y[1], yS[1], &nfSe[1], &nfeS[1], sunctx))
+  {
+    return 1;
+  }
+
+  N_VLinearSum(ONE, y[0], -ONE, y[1], y[1]);
+  diff = N_VMaxNorm(y[1]);
+  for (is = 0; is < NS; is++)
+  {
+    N_VLinearSum(ONE, yS[0][is], -ONE, yS[1][is], yS[1][is]);
+    diff = SUNMAX(diff, N_VMaxNorm(yS[1][is]));
+  }
+
+  printf("%s: nfSe = %li vs %li, nfeS = %li vs %li, diff = %g\n",
+         use_fS1 ? "fS1" : "DQ", nfSe[0], nfSe[1], nfeS[0], nfeS[1],
+         (double)diff);
+
+  if (diff != ZERO || nfSe[0] != nfSe[1] || nfeS[0] != nfeS[1])
+  {
+    fprintf(stderr, "%s: serial and threaded runs differ\n",
+            use_fS1 ? "fS1" : "DQ");
+    fails++;
+  }
+
+  N_VDestroy(y[0]);
+  N_VDestroy(y[1]);
+  N_VDestroyVectorArray(yS[0], NS);
+  N_VDestroyVectorArray(yS[1], NS);
+
+  return fails;
+}
+
+int main(int argc, char* argv[])
+{
+  int fails         = 0;
+  SUNContext sunctx = NULL;
+
+  if (SUNContext_Create(SUN_COMM_NULL, &sunctx))
+  {
+    fprintf(stderr, "SUNContext_Create failed\n");
+    return 1;
+  }
+
+  fails += run(0, sunctx);
+  fails += run(1, sunctx);
+
+  SUNContext_Free(&sunctx);
+
+  if (fails)
+  {
+    printf("FAIL\n");
+    return 1;
+  }
+
+  printf("SUCCESS\n");
+
+  return 0;
+}
+
+/*---- end of file ----*/
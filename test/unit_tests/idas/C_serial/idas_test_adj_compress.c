@@ -0,0 +1,409 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2025-2026, Lawrence Livermore National Security,
+ * University of Maryland Baltimore County, and the SUNDIALS contributors.
+ * Copyright (c) 2013-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * Copyright (c) 2002-2013, Lawrence Livermore National Security.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for the compressed adjoint interpolation data
+ * (IDAAdjSetCompression). NC copies of the Robertson DAE, with the first
+ * rate constant scaled by 1 + c / NC in copy c, are solved forward with
+ * sensitivities. The adjoint of the integral of the sum of y3, forced by the
+ * first sensitivity so that the interpolated sensitivities are used, is
+ * solved backward with Hermite and polynomial interpolation. For each
+ * compression method the adjoint solution at t = 0 must agree with the
+ * uncompressed run to within the integration tolerances and the quantized
+ * methods must reduce the stored data.
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "idas/idas.h"
+#include "nvector/nvector_serial.h"
+#include "sunlinsol/sunlinsol_dense.h"
+#include "sunmatrix/sunmatrix_dense.h"
+
+#define NC    20
+#define NEQ   (3 * NC)
+#define NS    3
+#define STEPS 50
+#define ZERO  SUN_RCONST(0.0)
+#define ONE   SUN_RCONST(1.0)
+#define TF    SUN_RCONST(4.0)
+#define DTOL  SUN_RCONST(1.0e-4)
+
+typedef struct
+{
+  sunrealtype p[NS];
+} UserData;
+
+/* DAE residual */
+static int res(sunrealtype t, N_Vector y, N_Vector yp, N_Vector rr,
+               void* user_data)
+{
+  sunrealtype* p = ((UserData*)user_data)->p;
+  sunrealtype *yd, *ypd, *rd;
+  sunrealtype k1;
+  int c;
+
+  for (c = 0; c < NC; c++)
+  {
+    yd  = N_VGetArrayPointer(y) + 3 * c;
+    ypd = N_VGetArrayPointer(yp) + 3 * c;
+    rd  = N_VGetArrayPointer(rr) + 3 * c;
+    k1  = p[0] * (ONE + (sunrealtype)c / NC);
+
+    rd[0] = -k1 * yd[0] + p[1] * yd[1] * yd[2] - ypd[0];
+    rd[1] = k1 * yd[0] - p[1] * yd[1] * yd[2] - p[2] * yd[1] * yd[1] - ypd[1];
+    rd[2] = yd[0] + yd[1] + yd[2] - ONE;
+  }
+
+  return 0;
+}
+
+/* Adjoint residual, forced by the first sensitivity */
+static int resBS(sunrealtype t, N_Vector y, N_Vector yp, N_Vector* yS,
+                 N_Vector* ypS, N_Vector yB, N_Vector ypB, N_Vector rrB,
+                 void* user_dataB)
+{
+  sunrealtype* p = ((UserData*)user_dataB)->p;
+  sunrealtype *yd, *sd, *ld, *lpd, *rd;
+  sunrealtype k1, l21;
+  int c;
+
+  for (c = 0; c < NC; c++)
+  {
+    yd  = N_VGetArrayPointer(y) + 3 * c;
+    sd  = N_VGetArrayPointer(yS[0]) + 3 * c;
+    ld  = N_VGetArrayPointer(yB) + 3 * c;
+    lpd = N_VGetArrayPointer(ypB) + 3 * c;
+    rd  = N_VGetArrayPointer(rrB) + 3 * c;
+    k1  = p[0] * (ONE + (sunrealtype)c / NC);
+
+    l21 = ld[1] - ld[0];
+
+    rd[0] = lpd[0] + k1 * l21 - ld[2] + sd[0];
+    rd[1] = lpd[1] - p[1] * yd[2] * l21 - 2 * p[2] * yd[1] * ld[1] - ld[2] +
+            sd[1];
+    rd[2] = -p[1] * yd[1] * l21 - ld[2] + ONE;
+  }
+
+  return 0;
+}
+
+/* Solve the forward and adjoint problems with the given interpolation and
+   compression and return the adjoint solution at t = 0 in yB */
+static int solve(int interp, SUNDataCompression ctype, sunrealtype ctol,
+                 N_Vector yB, sunrealtype* ratio, SUNContext sunctx)
+{
+  int c, is, ncheck, which, retval;
+  sunrealtype fac;
+  sunrealtype tret, decode_time;
+  sunrealtype pbar[NS];
+  UserData data;
+  void* ida_mem       = NULL;
+  SUNMatrix A         = NULL;
+  SUNMatrix AB        = NULL;
+  SUNLinearSolver LS  = NULL;
+  SUNLinearSolver LSB = NULL;
+  N_Vector y          = NULL;
+  N_Vector yp         = NULL;
+  N_Vector ypB        = NULL;
+  N_Vector* yS        = NULL;
+  N_Vector* ypS       = NULL;
+
+  data.p[0] = SUN_RCONST(0.04);
+  data.p[1] = SUN_RCONST(1.0e4);
+  data.p[2] = SUN_RCONST(3.0e7);
+  for (is = 0; is < NS; is++) { pbar[is] = data.p[is]; }
+
+  /* consistent initial conditions */
+  y   = N_VNew_Serial(NEQ, sunctx);
+  yp  = N_VClone(y);
+  ypB = N_VClone(y);
+  yS  = N_VCloneVectorArray(NS, y);
+  ypS = N_VCloneVectorArray(NS, y);
+
+  N_VConst(ZERO, y);
+  N_VConst(ZERO, yp);
+  for (is = 0; is < NS; is++)
+  {
+    N_VConst(ZERO, yS[is]);
+    N_VConst(ZERO, ypS[is]);
+  }
+
+  for (c = 0; c < NC; c++)
+  {
+    fac = ONE + (sunrealtype)c / NC;
+
+    N_VGetArrayPointer(y)[3 * c]          = ONE;
+    N_VGetArrayPointer(yp)[3 * c]         = -data.p[0] * fac;
+    N_VGetArrayPointer(yp)[3 * c + 1]     = data.p[0] * fac;
+    N_VGetArrayPointer(ypS[0])[3 * c]     = -fac;
+    N_VGetArrayPointer(ypS[0])[3 * c + 1] = fac;
+  }
+
+  ida_mem = IDACreate(sunctx);
+  if (!ida_mem)
+  {
+    fprintf(stderr, "IDACreate returned NULL\n");
+    return 1;
+  }
+
+  retval = IDAInit(ida_mem, res, ZERO, y, yp);
+  if (retval)
+  {
+    fprintf(stderr, "IDAInit returned %i\n", retval);
+    return 1;
+  }
+
+  retval = IDASStolerances(ida_mem, SUN_RCONST(1.0e-6), SUN_RCONST(1.0e-10));
+  if (retval)
+  {
+    fprintf(stderr, "IDASStolerances returned %i\n", retval);
+    return 1;
+  }
+
+  retval = IDASetUserData(ida_mem, &data);
+  if (retval)
+  {
+    fprintf(stderr, "IDASetUserData returned %i\n", retval);
+    return 1;
+  }
+
+  A  = SUNDenseMatrix(NEQ, NEQ, sunctx);
+  LS = SUNLinSol_Dense(y, A, sunctx);
+
+  retval = IDASetLinearSolver(ida_mem, LS, A);
+  if (retval)
+  {
+    fprintf(stderr, "IDASetLinearSolver returned %i\n", retval);
+    return 1;
+  }
+
+  retval = IDASensInit(ida_mem, NS, IDA_STAGGERED, NULL, yS, ypS);
+  if (retval)
+  {
+    fprintf(stderr, "IDASensInit returned %i\n", retval);
+    return 1;
+  }
+
+  retval = IDASensEEtolerances(ida_mem);
+  if (retval)
+  {
+    fprintf(stderr, "IDASensEEtolerances returned %i\n", retval);
+    return 1;
+  }
+
+  retval = IDASetSensParams(ida_mem, data.p, pbar, NULL);
+  if (retval)
+  {
+    fprintf(stderr, "IDASetSensParams returned %i\n", retval);
+    return 1;
+  }
+
+  retval = IDAAdjInit(ida_mem, STEPS, interp);
+  if (retval)
+  {
+    fprintf(stderr, "IDAAdjInit returned %i\n", retval);
+    return 1;
+  }
+
+  retval = IDAAdjSetCompression(ida_mem, ctype, ctol);
+  if (retval)
+  {
+    fprintf(stderr, "IDAAdjSetCompression returned %i\n", retval);
+    return 1;
+  }
+
+  retval = IDASolveF(ida_mem, TF, &tret, y, yp, IDA_NORMAL, &ncheck);
+  if (retval < 0)
+  {
+    fprintf(stderr, "IDASolveF returned %i\n", retval);
+    return 1;
+  }
+
+  /* The compression cannot be changed once data is stored */
+  if (IDAAdjSetCompression(ida_mem, ctype, ctol) != IDA_ILL_INPUT)
+  {
+    fprintf(stderr, "IDAAdjSetCompression after IDASolveF did not fail\n");
+    return 1;
+  }
+
+  retval = IDAGetSens(ida_mem, &tret, yS);
+  if (retval)
+  {
+    fprintf(stderr, "IDAGetSens returned %i\n", retval);
+    return 1;
+  }
+
+  retval = IDACreateB(ida_mem, &which);
+  if (retval)
+  {
+    fprintf(stderr, "IDACreateB returned %i\n", retval);
+    return 1;
+  }
+
+  /* consistent final conditions */
+  N_VConst(ZERO, yB);
+  N_VConst(ZERO, ypB);
+  for (c = 0; c < NC; c++)
+  {
+    N_VGetArrayPointer(yB)[3 * c + 2]  = ONE;
+    N_VGetArrayPointer(ypB)[3 * c]     = ONE - N_VGetArrayPointer(yS[0])[3 * c];
+    N_VGetArrayPointer(ypB)[3 * c + 1] = ONE -
+                                         N_VGetArrayPointer(yS[0])[3 * c + 1];
+  }
+
+  retval = IDAInitBS(ida_mem, which, resBS, TF, yB, ypB);
+  if (retval)
+  {
+    fprintf(stderr, "IDAInitBS returned %i\n", retval);
+    return 1;
+  }
+
+  retval = IDASStolerancesB(ida_mem, which, SUN_RCONST(1.0e-6),
+                            SUN_RCONST(1.0e-8));
+  if (retval)
+  {
+    fprintf(stderr, "IDASStolerancesB returned %i\n", retval);
+    return 1;
+  }
+
+  retval = IDASetUserDataB(ida_mem, which, &data);
+  if (retval)
+  {
+    fprintf(stderr, "IDASetUserDataB returned %i\n", retval);
+    return 1;
+  }
+
+  AB  = SUNDenseMatrix(NEQ, NEQ, sunctx);
+  LSB = SUNLinSol_Dense(yB, AB, sunctx);
+
+  retval = IDASetLinearSolverB(ida_mem, which, LSB, AB);
+  if (retval)
+  {
+    fprintf(stderr, "IDASetLinearSolverB returned %i\n", retval);
+    return 1;
+  }
+
+  retval = IDASolveB(ida_mem, ZERO, IDA_NORMAL);
+  if (retval < 0)
+  {
+    fprintf(stderr, "IDASolveB returned %i\n", retval);
+    return 1;
+  }
+
+  retval = IDAGetB(ida_mem, which, &tret, yB, ypB);
+  if (retval)
+  {
+    fprintf(stderr, "IDAGetB returned %i\n", retval);
+    return 1;
+  }
+
+  retval = IDAGetAdjCompressionStats(ida_mem, ratio, &decode_time);
+  if (retval)
+  {
+    fprintf(stderr, "IDAGetAdjCompressionStats returned %i\n", retval);
+    return 1;
+  }
+
+  IDAFree(&ida_mem);
+  SUNLinSolFree(LS);
+  SUNLinSolFree(LSB);
+  SUNMatDestroy(A);
+  SUNMatDestroy(AB);
+  N_VDestroy(y);
+  N_VDestroy(yp);
+  N_VDestroy(ypB);
+  N_VDestroyVectorArray(yS, NS);
+  N_VDestroyVectorArray(ypS, NS);
+
+  return 0;
+}
+
+/* Compare the compressed runs with the uncompressed run */
+static int run(int interp, SUNContext sunctx)
+{
+  int k, fails = 0;
+  sunrealtype ratio, diff;
+  N_Vector yB_ref, yB;
+  const SUNDataCompression ctype[3] = {SUNDATACOMPRESSION_FLOAT,
+                                       SUNDATACOMPRESSION_QUANTIZE,
+                                       SUNDATACOMPRESSION_DELTA};
+  const char* name[3]               = {"float", "quantize", "delta"};
+
+  yB_ref = N_VNew_Serial(NEQ, sunctx);
+  yB     = N_VClone(yB_ref);
+
+  if (solve(interp, SUNDATACOMPRESSION_NONE, ZERO, yB_ref, &ratio, sunctx))
+  {
+    return 1;
+  }
+
+  if (ratio != ONE)
+  {
+    fprintf(stderr, "uncompressed ratio = %g\n", (double)ratio);
+    fails++;
+  }
+
+  for (k = 0; k < 3; k++)
+  {
+    if (solve(interp, ctype[k], ONE, yB, &ratio, sunctx)) { return 1; }
+
+    N_VLinearSum(ONE, yB_ref, -ONE, yB, yB);
+    diff = N_VMaxNorm(yB) / N_VMaxNorm(yB_ref);
+
+    printf("%s %s: ratio = %g, diff = %g\n",
+           interp == IDA_HERMITE ? "hermite" : "polynomial", name[k],
+           (double)ratio, (double)diff);
+
+    if (diff > DTOL || ratio <= ONE)
+    {
+      fprintf(stderr, "%s: compressed run differs\n", name[k]);
+      fails++;
+    }
+  }
+
+  N_VDestroy(yB_ref);
+  N_VDestroy(yB);
+
+  return fails;
+}
+
+int main(int argc, char* argv[])
+{
+  int fails         = 0;
+  SUNContext sunctx = NULL;
+
+  if (SUNContext_Create(SUN_COMM_NULL, &sunctx))
+  {
+    fprintf(stderr, "SUNContext_Create failed\n");
+    return 1;
+  }
+
+  fails += run(IDA_HERMITE, sunctx);
+  fails += run(IDA_POLYNOMIAL, sunctx);
+
+  SUNContext_Free(&sunctx);
+
+  if (fails)
+  {
+    printf("FAIL\n");
+    return 1;
+  }
+
+  printf("SUCCESS\n");
+
+  return 0;
+}
+
+/*---- end of file ----*/
@@ -0,0 +1,268 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2025-2026, Lawrence Livermore National Security,
+ * University of Maryland Baltimore County, and the SUNDIALS contributors.
+ * Copyright (c) 2013-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * Copyright (c) 2002-2013, Lawrence Livermore National Security.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for computing the DQ sensitivity residuals with multiple threads
+ * (IDASetSensNumThreads). The Robertson DAE with sensitivities to its three
+ * rate constants is solved with one and with several threads using
+ * per-thread parameters and user data. The solution, sensitivities, and
+ * evaluation counts of the two runs must be identical.
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "idas/idas.h"
+#include "nvector/nvector_serial.h"
+#include "sunlinsol/sunlinsol_dense.h"
+#include "sunmatrix/sunmatrix_dense.h"
+
+#define NEQ  3
+#define NS   3
+#define NTHR 2
+#define ZERO SUN_RCONST(0.0)
+#define ONE  SUN_RCONST(1.0)
+#define TF   SUN_RCONST(40.0)
+
+typedef struct
+{
+  sunrealtype* p;
+} UserData;
+
+/* DAE residual */
+static int res(sunrealtype t, N_Vector y, N_Vector yp, N_Vector rr,
+               void* user_data)
+{
+  sunrealtype* p   = ((UserData*)user_data)->p;
+  sunrealtype* yd  = N_VGetArrayPointer(y);
+  sunrealtype* ypd = N_VGetArrayPointer(yp);
+  sunrealtype* rd  = N_VGetArrayPointer(rr);
+
+  rd[0] = -p[0] * yd[0] + p[1] * yd[1] * yd[2] - ypd[0];
+  rd[1] = p[0] * yd[0] - p[1] * yd[1] * yd[2] - p[2] * yd[1] * yd[1] - ypd[1];
+  rd[2] = yd[0] + yd[1] + yd[2] - ONE;
+
+  return 0;
+}
+
+/* Integrate to TF with nthreads threads */
+static int solve(int nthreads, N_Vector y, N_Vector* yS, long int* nrSe,
+                 long int* nreS, SUNContext sunctx)
+{
+  int t, is, retval;
+  sunrealtype tret;
+  sunrealtype p[NS] = {SUN_RCONST(0.04), SUN_RCONST(1.0e4), SUN_RCONST(3.0e7)};
+  sunrealtype pbar[NS];
+  sunrealtype p_thr[NTHR][NS];
+  sunrealtype* p_ptr[NTHR];
+  UserData data_thr[NTHR];
+  void* data_ptr[NTHR];
+  UserData data      = {p};
+  void* ida_mem      = NULL;
+  SUNMatrix A        = NULL;
+  SUNLinearSolver LS = NULL;
+  N_Vector yp        = NULL;
+  N_Vector* ypS      = NULL;
+  sunrealtype* ydata = N_VGetArrayPointer(y);
+
+  for (is = 0; is < NS; is++) { pbar[is] = p[is]; }
+
+  for (t = 0; t < NTHR; t++)
+  {
+    for (is = 0; is < NS; is++) { p_thr[t][is] = p[is]; }
+    p_ptr[t]      = p_thr[t];
+    data_thr[t].p = p_thr[t];
+    data_ptr[t]   = &data_thr[t];
+  }
+
+  /* consistent initial conditions */
+  yp  = N_VClone(y);
+  ypS = N_VCloneVectorArray(NS, y);
+
+  ydata[0] = ONE;
+  ydata[1] = ZERO;
+  ydata[2] = ZERO;
+
+  N_VConst(ZERO, yp);
+  N_VGetArrayPointer(yp)[0] = -p[0];
+  N_VGetArrayPointer(yp)[1] = p[0];
+
+  for (is = 0; is < NS; is++)
+  {
+    N_VConst(ZERO, yS[is]);
+    N_VConst(ZERO, ypS[is]);
+  }
+  N_VGetArrayPointer(ypS[0])[0] = -ONE;
+  N_VGetArrayPointer(ypS[0])[1] = ONE;
+
+  ida_mem = IDACreate(sunctx);
+  if (!ida_mem)
+  {
+    fprintf(stderr, "IDACreate returned NULL\n");
+    return 1;
+  }
+
+  retval = IDAInit(ida_mem, res, ZERO, y, yp);
+  if (retval)
+  {
+    fprintf(stderr, "IDAInit returned %i\n", retval);
+    return 1;
+  }
+
+  retval = IDASStolerances(ida_mem, SUN_RCONST(1.0e-6), SUN_RCONST(1.0e-10));
+  if (retval)
+  {
+    fprintf(stderr, "IDASStolerances returned %i\n", retval);
+    return 1;
+  }
+
+  retval = IDASetUserData(ida_mem, &data);
+  if (retval)
+  {
+    fprintf(stderr, "IDASetUserData returned %i\n", retval);
+    return 1;
+  }
+
+  A  = SUNDenseMatrix(NEQ, NEQ, sunctx);
+  LS = SUNLinSol_Dense(y, A, sunctx);
+
+  retval = IDASetLinearSolver(ida_mem, LS, A);
+  if (retval)
+  {
+    fprintf(stderr, "IDASetLinearSolver returned %i\n", retval);
+    return 1;
+  }
+
+  retval = IDASensInit(ida_mem, NS, IDA_SIMULTANEOUS, NULL, yS, ypS);
+  if (retval)
+  {
+    fprintf(stderr, "IDASensInit returned %i\n", retval);
+    return 1;
+  }
+
+  retval = IDASensEEtolerances(ida_mem);
+  if (retval)
+  {
+    fprintf(stderr, "IDASensEEtolerances returned %i\n", retval);
+    return 1;
+  }
+
+  retval = IDASetSensParams(ida_mem, p, pbar, NULL);
+  if (retval)
+  {
+    fprintf(stderr, "IDASetSensParams returned %i\n", retval);
+    return 1;
+  }
+
+  retval = IDASetSensNumThreads(ida_mem, nthreads);
+  if (retval)
+  {
+    fprintf(stderr, "IDASetSensNumThreads returned %i\n", retval);
+    return 1;
+  }
+
+  retval = IDASetSensThreadData(ida_mem, data_ptr, p_ptr);
+  if (retval)
+  {
+    fprintf(stderr, "IDASetSensThreadData returned %i\n", retval);
+    return 1;
+  }
+
+  retval = IDASolve(ida_mem, TF, &tret, y, yp, IDA_NORMAL);
+  if (retval < 0)
+  {
+    fprintf(stderr, "IDASolve returned %i\n", retval);
+    return 1;
+  }
+
+  retval = IDAGetSens(ida_mem, &tret, yS);
+  if (retval)
+  {
+    fprintf(stderr, "IDAGetSens returned %i\n", retval);
+    return 1;
+  }
+
+  retval = IDAGetSensNumResEvals(ida_mem, nrSe);
+  if (retval)
+  {
+    fprintf(stderr, "IDAGetSensNumResEvals returned %i\n", retval);
+    return 1;
+  }
+
+  retval = IDAGetNumResEvalsSens(ida_mem, nreS);
+  if (retval)
+  {
+    fprintf(stderr, "IDAGetNumResEvalsSens returned %i\n", retval);
+    return 1;
+  }
+
+  IDAFree(&ida_mem);
+  SUNLinSolFree(LS);
+  SUNMatDestroy(A);
+  N_VDestroy(yp);
+  N_VDestroyVectorArray(ypS, NS);
+
+  return 0;
+}
+
+int main(int argc, char* argv[])
+{
+  int is;
+  long int nrSe[2], nreS[2];
+  sunrealtype diff;
+  N_Vector y[2], *yS[2];
+  SUNContext sunctx = NULL;
+
+  if (SUNContext_Create(SUN_COMM_NULL, &sunctx))
+  {
+    fprintf(stderr, "SUNContext_Create failed\n");
+    return 1;
+  }
+
+  y[0]  = N_VNew_Serial(NEQ, sunctx);
+  y[1]  = N_VClone(y[0]);
+  yS[0] = N_VCloneVectorArray(NS, y[0]);
+  yS[1] = N_VCloneVectorArray(NS, y[0]);
+
+  if (solve(1, y[0], yS[0], &nrSe[0], &nreS[0], sunctx)) { return 1; }
+  if (solve(NTHR, y[1], yS[1], &nrSe[1], &nreS[1], sunctx)) { return 1; }
+
+  N_VLinearSum(ONE, y[0], -ONE, y[1], y[1]);
+  diff = N_VMaxNorm(y[1]);
+  for (is = 0; is < NS; is++)
+  {
+    N_VLinearSum(ONE, yS[0][is], -ONE, yS[1][is], yS[1][is]);
+    diff = SUNMAX(diff, N_VMaxNorm(yS[1][is]));
+  }
+
+  printf("nrSe = %li vs %li, nreS = %li vs %li, diff = %g\n", nrSe[0],
+         nrSe[1], nreS[0], nreS[1], (double)diff);
+
+  N_VDestroy(y[0]);
+  N_VDestroy(y[1]);
+  N_VDestroyVectorArray(yS[0], NS);
+  N_VDestroyVectorArray(yS[1], NS);
+  SUNContext_Free(&sunctx);
+
+  if (diff != ZERO || nrSe[0] != nrSe[1] || nreS[0] != nreS[1])
+  {
+    printf("FAIL\n");
+    return 1;
+  }
+
+  printf("SUCCESS\n");
+
+  return 0;
+}
+
+/*---- end of file ----*/
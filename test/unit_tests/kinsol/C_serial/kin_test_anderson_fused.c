@@ -0,0 +1,188 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2025-2026, Lawrence Livermore National Security,
+ * University of Maryland Baltimore County, and the SUNDIALS contributors.
+ * Copyright (c) 2013-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * Copyright (c) 2002-2013, Lawrence Livermore National Security.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for the fused delayed CGS2 QR update and the adaptive depth policy
+ * in Anderson acceleration. A slowly contracting fixed point problem,
+ *
+ *   g_i(x) = 0.45 (x_{i-1} + x_{i+1}) + 0.01 exp(-x_i) + 1 / (i + 1),
+ *
+ * is solved with each orthogonalization method. The fused method must converge
+ * in about as many iterations as the other methods, agree with their solutions,
+ * and use fewer global reductions than KIN_ORTH_DCGS2. With the adaptive depth
+ * policy, with ratios that make the depth shrink, every method must still
+ * converge and the depth must stay between 1 and m_aa.
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "kinsol/kinsol.h"
+#include "nvector/nvector_serial.h"
+#include "sundials/sundials_math.h"
+
+#if defined(SUNDIALS_EXTENDED_PRECISION)
+#define GSYM "Lg"
+#else
+#define GSYM "g"
+#endif
+
+#define NEQ    100
+#define MAA    5
+#define MAXIT  400
+#define FTOL   SUN_RCONST(1.0e-10)
+#define NORTH  5
+#define SHRINK SUN_RCONST(0.8)
+#define GROW   SUN_RCONST(0.5)
+#define ZERO   SUN_RCONST(0.0)
+#define ONE    SUN_RCONST(1.0)
+
+static int gfun(N_Vector x, N_Vector g, void* user_data)
+{
+  sunrealtype* xd = N_VGetArrayPointer(x);
+  sunrealtype* gd = N_VGetArrayPointer(g);
+
+  for (sunindextype i = 0; i < NEQ; i++)
+  {
+    sunrealtype left  = (i > 0) ? xd[i - 1] : ZERO;
+    sunrealtype right = (i < NEQ - 1) ? xd[i + 1] : ZERO;
+    gd[i] = SUN_RCONST(0.45) * (left + right) +
+            SUN_RCONST(0.01) * SUNRexp(-xd[i]) + ONE / (i + 1);
+  }
+
+  return 0;
+}
+
+typedef struct
+{
+  long int nni, nred, nflops, depth;
+} Stats;
+
+static int solve(SUNContext sunctx, int orth, sunbooleantype adapt, N_Vector x,
+                 Stats* stats)
+{
+  N_Vector scale = N_VClone(x);
+  void* kmem     = KINCreate(sunctx);
+  int flag;
+
+  if (!scale || !kmem) { return 1; }
+
+  N_VConst(ZERO, x);
+  N_VConst(ONE, scale);
+
+  if (KINSetMAA(kmem, MAA)) { return 1; }
+  if (KINSetOrthAA(kmem, orth)) { return 1; }
+  if (KINInit(kmem, gfun, x)) { return 1; }
+  if (KINSetFuncNormTol(kmem, FTOL)) { return 1; }
+  if (KINSetNumMaxIters(kmem, MAXIT)) { return 1; }
+  if (KINSetAdaptiveDepthAA(kmem, adapt, SHRINK, GROW)) { return 1; }
+
+  flag = KINSol(kmem, x, KIN_FP, scale, scale);
+  if (flag < 0)
+  {
+    fprintf(stderr, "KINSol returned %i\n", flag);
+    return 1;
+  }
+
+  if (KINGetNumNonlinSolvIters(kmem, &stats->nni) ||
+      KINGetNumReductionsAA(kmem, &stats->nred) ||
+      KINGetNumFlopsAA(kmem, &stats->nflops) ||
+      KINGetCurrentDepthAA(kmem, &stats->depth))
+  {
+    return 1;
+  }
+
+  KINFree(&kmem);
+  N_VDestroy(scale);
+
+  return 0;
+}
+
+int main(int argc, char* argv[])
+{
+  SUNContext sunctx = NULL;
+  N_Vector x[NORTH];
+  Stats stats[NORTH];
+  sunrealtype diff;
+  int orth, fails = 0;
+
+  if (SUNContext_Create(SUN_COMM_NULL, &sunctx))
+  {
+    fprintf(stderr, "SUNContext_Create failed\n");
+    return 1;
+  }
+
+  for (int adapt = 0; adapt < 2; adapt++)
+  {
+    for (orth = 0; orth < NORTH; orth++)
+    {
+      x[orth] = N_VNew_Serial(NEQ, sunctx);
+      if (!x[orth] || solve(sunctx, orth, adapt, x[orth], &stats[orth]))
+      {
+        fprintf(stderr, "FAIL: orth = %i, adapt = %i, solve failed\n", orth,
+                adapt);
+        return 1;
+      }
+
+      printf("orth = %i, adapt = %i: nni = %4ld, reductions = %5ld, flops = "
+             "%6ld, depth = %ld\n",
+             orth, adapt, stats[orth].nni, stats[orth].nred,
+             stats[orth].nflops, stats[orth].depth);
+
+      if (stats[orth].depth < 1 || stats[orth].depth > MAA)
+      {
+        fprintf(stderr, "FAIL: orth = %i, adapt = %i, depth = %ld\n", orth,
+                adapt, stats[orth].depth);
+        fails++;
+      }
+    }
+
+    /* The fused update must match the other methods */
+    for (orth = 0; orth < NORTH - 1; orth++)
+    {
+      N_VLinearSum(ONE, x[orth], -ONE, x[KIN_ORTH_DCGS2_FUSED], x[orth]);
+      diff = N_VMaxNorm(x[orth]);
+      if (diff > SUN_RCONST(1.0e3) * FTOL)
+      {
+        fprintf(stderr,
+                "FAIL: orth = %i, adapt = %i, solutions differ by %" GSYM "\n",
+                orth, adapt, diff);
+        fails++;
+      }
+      if (!adapt &&
+          labs(stats[orth].nni - stats[KIN_ORTH_DCGS2_FUSED].nni) > 3)
+      {
+        fprintf(stderr, "FAIL: orth = %i, iterations differ by more than 3\n",
+                orth);
+        fails++;
+      }
+    }
+
+    if (stats[KIN_ORTH_DCGS2_FUSED].nred >= stats[KIN_ORTH_DCGS2].nred)
+    {
+      fprintf(stderr,
+              "FAIL: adapt = %i, fused update does not save reductions\n",
+              adapt);
+      fails++;
+    }
+
+    for (orth = 0; orth < NORTH; orth++) { N_VDestroy(x[orth]); }
+  }
+
+  SUNContext_Free(&sunctx);
+
+  if (fails) { printf("FAIL: %d test(s) failed\n", fails); }
+  else { printf("SUCCESS\n"); }
+
+  return fails;
+}
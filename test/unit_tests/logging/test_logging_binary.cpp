@@ -0,0 +1,121 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2025-2026, Lawrence Livermore National Security,
+ * University of Maryland Baltimore County, and the SUNDIALS contributors.
+ * Copyright (c) 2013-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * Copyright (c) 2002-2013, Lawrence Livermore National Security.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Write the same messages to a text log file and a binary log file. The
+ * test_logging_binary.py script decodes the binary file and compares the
+ * result to the text file.
+ * ---------------------------------------------------------------------------*/
+
+#include <cstdio>
+#include <iostream>
+
+#include "sundials/sundials_logger.h"
+#include "sundials/sundials_types.h"
+
+static int log_messages(SUNLogger logger)
+{
+  const sunrealtype pi = SUN_RCONST(3.141592653589793);
+  char buffer[64];
+  int flag;
+
+  // Typical integrator output with key-value pairs
+  for (long int step = 1; step <= 20000; step++)
+  {
+    sunrealtype t = step * pi / 100;
+    flag = SUNLogger_QueueMsg(logger, SUN_LOGLEVEL_INFO, "log_messages",
+                              "begin-step-attempt",
+                              "step = %li, tn = " SUN_FORMAT_G
+                              ", h = " SUN_FORMAT_G ", q = %d",
+                              step, t, pi / step, (int)(step % 5));
+    if (flag) { return flag; }
+
+    flag = SUNLogger_QueueMsg(logger, SUN_LOGLEVEL_DEBUG, "log_messages",
+                              "end-step-attempt",
+                              "status = %s, dsm = " SUN_FORMAT_E,
+                              (step % 7) ? "success" : "failed", t / 7);
+    if (flag) { return flag; }
+
+    if (step == 10000)
+    {
+      flag = SUNLogger_Flush(logger, SUN_LOGLEVEL_ALL);
+      if (flag) { return flag; }
+    }
+  }
+
+  // Other conversions, flags, and widths
+  flag = SUNLogger_QueueMsg(logger, SUN_LOGLEVEL_INFO, "log_messages",
+                            "conversions",
+                            "%c%c %5d|%-5d|%+d|%05d|%*d|%.*f|%x|%#o|%X|%zu|"
+                            "%lld|%lu|%10.3e|%g|%%|%s",
+                            'o', 'k', 42, 42, 42, 42, 6, 7, 3, 2.0 / 3, 255u,
+                            8u, 0xABCDu, (size_t)12345, -123456789012LL,
+                            4000000000UL, -1.5e-300, 1e100, "text");
+  if (flag) { return flag; }
+
+  // A message without arguments
+  flag = SUNLogger_QueueMsg(logger, SUN_LOGLEVEL_INFO, "log_messages",
+                            "no-args", "nothing to format");
+  if (flag) { return flag; }
+
+  // A message split across multiple lines
+  flag = SUNLogger_QueueMsg(logger, SUN_LOGLEVEL_DEBUG, "log_messages",
+                            "multiline", "y(:) =\n%g\n%g", 1.0, 2.0);
+  if (flag) { return flag; }
+
+  // The same format buffer reused with different contents
+  for (int i = 0; i < 3; i++)
+  {
+    std::snprintf(buffer, sizeof(buffer), "i = %d, value = %%d", i);
+    flag = SUNLogger_QueueMsg(logger, SUN_LOGLEVEL_INFO, "log_messages",
+                              "reused-buffer", buffer, 10 * i);
+    if (flag) { return flag; }
+  }
+
+  return 0;
+}
+
+int main(int argc, char* argv[])
+{
+  const char* text_file   = (argc > 1) ? argv[1] : "test_logging_binary.txt";
+  const char* binary_file = (argc > 2) ? argv[2] : "test_logging_binary.bin";
+
+  std::cout << "Start binary logging test" << std::endl;
+
+  SUNLogger text_logger = nullptr;
+  int flag              = SUNLogger_Create(SUN_COMM_NULL, 0, &text_logger);
+  if (!flag) { flag = SUNLogger_SetInfoFilename(text_logger, text_file); }
+  if (!flag) { flag = SUNLogger_SetDebugFilename(text_logger, text_file); }
+  if (!flag) { flag = log_messages(text_logger); }
+  if (!flag) { flag = SUNLogger_Destroy(&text_logger); }
+  if (flag)
+  {
+    std::cerr << ">>> FAILURE: text logging returned " << flag << std::endl;
+    return 1;
+  }
+
+  SUNLogger binary_logger = nullptr;
+  flag = SUNLogger_Create(SUN_COMM_NULL, 0, &binary_logger);
+  if (!flag) { flag = SUNLogger_SetBinaryFilename(binary_logger, binary_file); }
+  if (!flag) { flag = log_messages(binary_logger); }
+  if (!flag) { flag = SUNLogger_Destroy(&binary_logger); }
+  if (flag)
+  {
+    std::cerr << ">>> FAILURE: binary logging returned " << flag << std::endl;
+    return 1;
+  }
+
+  std::cout << "End binary logging test" << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,66 @@
+#!/usr/bin/env python3
+# -----------------------------------------------------------------------------
+# SUNDIALS Copyright Start
+# Copyright (c) 2025-2026, Lawrence Livermore National Security,
+# University of Maryland Baltimore County, and the SUNDIALS contributors.
+# Copyright (c) 2013-2025, Lawrence Livermore National Security
+# and Southern Methodist University.
+# Copyright (c) 2002-2013, Lawrence Livermore National Security.
+# All rights reserved.
+#
+# See the top-level LICENSE and NOTICE files for details.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+# SUNDIALS Copyright End
+# -----------------------------------------------------------------------------
+# Decode the binary log file written by test_logging_binary and compare it to
+# the text log file with the same messages
+# -----------------------------------------------------------------------------
+
+
+def main():
+
+    import argparse
+    import sys
+
+    parser = argparse.ArgumentParser(description="Check a decoded binary log file")
+
+    parser.add_argument("tools", type=str, help="Path to the SUNDIALS tools directory")
+    parser.add_argument("textfile", type=str, help="Text log file")
+    parser.add_argument("binaryfile", type=str, help="Binary log file")
+
+    args = parser.parse_args()
+
+    sys.path.insert(0, args.tools)
+    from suntools import logs as sunlog
+
+    with open(args.textfile, "r") as textfile:
+        expected = textfile.read().splitlines()
+
+    decoded = sunlog.binary_log_to_lines(args.binaryfile)
+
+    if len(decoded) != len(expected):
+        print(f">>> FAILURE: decoded {len(decoded)} lines, expected {len(expected)}")
+        return 1
+
+    for line_number, (d, e) in enumerate(zip(decoded, expected)):
+        if d != e:
+            print(f">>> FAILURE: line {line_number + 1} differs")
+            print(f"decoded:  {d}")
+            print(f"expected: {e}")
+            return 1
+
+    # The parsed step attempts should also match
+    if sunlog.log_file_to_list(args.binaryfile) != sunlog.log_file_to_list(args.textfile):
+        print(">>> FAILURE: parsed log files differ")
+        return 1
+
+    print(f"SUCCESS: decoded {len(decoded)} lines")
+    return 0
+
+
+# run the main routine
+if __name__ == "__main__":
+    import sys
+
+    sys.exit(main())
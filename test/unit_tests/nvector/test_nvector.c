@@ -3722,10 +3722,11 @@ int Test_N_VConstVectorArray(N_Vector X, sunindextype local_length, int myid)
  * --------------------------------------------------------------------*/
 int Test_N_VWrmsNormVectorArray(N_Vector X, sunindextype local_length, int myid)
 {
-  int fails = 0, failure = 0, ierr = 0;
+  int fails = 0, failure = 0, ierr = 0, i;
   double start_time, stop_time, maxt;
+  sunindextype half;
 
-  sunrealtype nrm[3];
+  sunrealtype nrm[3], ref[3];
   N_Vector* Z;
   N_Vector* W;
 
@@ -3816,6 +3817,54 @@ int Test_N_VWrmsNormVectorArray(N_Vector X, sunindextype local_length, int myid)
   maxt = max_time(X, stop_time - start_time);
   PRINT_TIME("N_VWrmsNormVectorArray", maxt);
 
+  /*
+   * Case 1c: nrm[i] = ||Z[i]|| with values that differ within and across
+   * processes, compared against N_VWrmsNorm of each vector
+   */
+
+  /* fill vector data */
+  half = local_length / 2;
+  for (i = 0; i < 3; i++)
+  {
+    N_VConst(ONE / (i + 2), W[i]);
+    N_VConst((i + 1) * HALF, Z[i]);
+    set_element_range(Z[i], half, local_length - 1, NEG_ONE * (myid + i + 1));
+    ref[i] = N_VWrmsNorm(Z[i], W[i]);
+  }
+
+  nrm[0] = NEG_ONE;
+  nrm[1] = NEG_ONE;
+  nrm[2] = NEG_ONE;
+
+  start_time = get_time();
+  ierr       = N_VWrmsNormVectorArray(3, Z, W, nrm);
+  sync_device(X);
+  stop_time = get_time();
+
+  if (ierr == 0)
+  {
+    failure = 0;
+    for (i = 0; i < 3; i++)
+    {
+      failure += (nrm[i] < ZERO) ? 1 : SUNRCompare(nrm[i], ref[i]);
+    }
+  }
+  else { failure = 1; }
+
+  if (failure)
+  {
+    printf(">>> FAILED test -- N_VWrmsNormVectorArray Case 1c, Proc %d \n", myid);
+    fails++;
+  }
+  else if (myid == 0)
+  {
+    printf("PASSED test -- N_VWrmsNormVectorArray Case 1c \n");
+  }
+
+  /* find max time across all processes */
+  maxt = max_time(X, stop_time - start_time);
+  PRINT_TIME("N_VWrmsNormVectorArray", maxt);
+
   /* Free vectors */
   N_VDestroyVectorArray(Z, 3);
   N_VDestroyVectorArray(W, 3);
@@ -3829,12 +3878,12 @@ int Test_N_VWrmsNormVectorArray(N_Vector X, sunindextype local_length, int myid)
 int Test_N_VWrmsNormMaskVectorArray(N_Vector X, sunindextype local_length,
                                     int myid)
 {
-  int fails = 0, failure = 0, ierr = 0;
+  int fails = 0, failure = 0, ierr = 0, i;
   double start_time, stop_time, maxt;
-  sunindextype global_length;
+  sunindextype global_length, half;
 
   sunrealtype fac;
-  sunrealtype nrm[3];
+  sunrealtype nrm[3], ref[3];
   N_Vector* Z;
   N_Vector* W;
 
@@ -3941,6 +3990,60 @@ int Test_N_VWrmsNormMaskVectorArray(N_Vector X, sunindextype local_length,
   maxt = max_time(X, stop_time - start_time);
   PRINT_TIME("N_VWrmsNormVectorArray", maxt);
 
+  /*
+   * Case 3: nrm[i] = ||Z[i]|| with values that differ within and across
+   * processes, compared against N_VWrmsNormMask of each vector
+   */
+
+  /* fill vector data */
+  half = local_length / 2;
+  for (i = 0; i < 3; i++)
+  {
+    N_VConst(ONE / (i + 2), W[i]);
+    N_VConst((i + 1) * HALF, Z[i]);
+    set_element_range(Z[i], half, local_length - 1, NEG_ONE * (myid + i + 1));
+  }
+
+  /* use the first half of the elements on each process */
+  N_VConst(ONE, X);
+  set_element_range(X, half, local_length - 1, ZERO);
+
+  for (i = 0; i < 3; i++) { ref[i] = N_VWrmsNormMask(Z[i], W[i], X); }
+
+  nrm[0] = NEG_ONE;
+  nrm[1] = NEG_ONE;
+  nrm[2] = NEG_ONE;
+
+  start_time = get_time();
+  ierr       = N_VWrmsNormMaskVectorArray(3, Z, W, X, nrm);
+  sync_device(X);
+  stop_time = get_time();
+
+  if (ierr == 0)
+  {
+    failure = 0;
+    for (i = 0; i < 3; i++)
+    {
+      failure += (nrm[i] < ZERO) ? 1 : SUNRCompare(nrm[i], ref[i]);
+    }
+  }
+  else { failure = 1; }
+
+  if (failure)
+  {
+    printf(">>> FAILED test -- N_VWrmsNormMaskVectorArray Case 3, Proc %d \n",
+           myid);
+    fails++;
+  }
+  else if (myid == 0)
+  {
+    printf("PASSED test -- N_VWrmsNormMaskVectorArray Case 3 \n");
+  }
+
+  /* find max time across all processes */
+  maxt = max_time(X, stop_time - start_time);
+  PRINT_TIME("N_VWrmsNormVectorArray", maxt);
+
   /* Free vectors */
   N_VDestroyVectorArray(Z, 3);
   N_VDestroyVectorArray(W, 3);
@@ -5810,6 +5913,47 @@ int Test_N_VDotProdMultiAllReduce(N_Vector X, sunindextype local_length, int myi
   maxt = max_time(X, stop_time - start_time);
   PRINT_TIME("N_VDotProdMultiAllReduce", maxt);
 
+  /*
+   * Case 3: d[i] = z . V[i], split-phase global reduction
+   */
+
+  ierr = N_VDotProdMultiLocal(3, X, V, dotprods);
+
+  /* perform the global reduction, overlapped with a vector operation */
+  start_time = get_time();
+  if (ierr == 0) { ierr = N_VDotProdMultiAllReduceBegin(3, X, dotprods); }
+  if (ierr == 0)
+  {
+    N_VConst(ZERO, V[0]);
+    ierr = N_VDotProdMultiAllReduceEnd(3, X, dotprods);
+  }
+  sync_device(X);
+  stop_time = get_time();
+
+  /* dotprod[i] should equal -1, +1, and 2 times the global vector length */
+  if (ierr == 0)
+  {
+    failure = SUNRCompare(dotprods[0], (sunrealtype)-1 * global_length);
+    failure += SUNRCompare(dotprods[1], (sunrealtype)global_length);
+    failure += SUNRCompare(dotprods[2], (sunrealtype)2 * global_length);
+  }
+  else { failure = 1; }
+
+  if (failure)
+  {
+    printf(">>> FAILED test -- N_VDotProdMultiAllReduce Case 3, Proc %d \n",
+           myid);
+    fails++;
+  }
+  else if (myid == 0)
+  {
+    printf("PASSED test -- N_VDotProdMultiAllReduce Case 3 \n");
+  }
+
+  /* find max time across all processes */
+  maxt = max_time(X, stop_time - start_time);
+  PRINT_TIME("N_VDotProdMultiAllReduceBegin/End", maxt);
+
   /* Free vectors */
   N_VDestroyVectorArray(V, 3);
 
@@ -46,6 +46,37 @@ static int sleep(SUNProfiler prof, int sec, double* chrono)
   return 0;
 }
 
+static int sleep_handle(SUNProfiler prof, int outer, int inner, int msec,
+                        double* chrono)
+{
+  SUNProfiler_BeginHandle(prof, outer);
+
+  auto begin = std::chrono::steady_clock::now();
+
+  SUNProfiler_BeginHandle(prof, inner);
+  std::this_thread::sleep_for(std::chrono::milliseconds(msec));
+  SUNProfiler_EndHandle(prof, inner);
+
+  auto end = std::chrono::steady_clock::now();
+
+  SUNProfiler_EndHandle(prof, outer);
+
+  auto elapsed =
+    std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count();
+  *chrono = std::chrono::duration<double>(elapsed).count() * 1e-9;
+
+  return 0;
+}
+
+#if !defined(SUNDIALS_CALIPER_ENABLED)
+static void sleep_marked(SUNProfiler prof, int msec)
+{
+  SUNDIALS_MARK_BEGIN(prof, "marked");
+  std::this_thread::sleep_for(std::chrono::milliseconds(msec));
+  SUNDIALS_MARK_END(prof, "marked");
+}
+#endif
+
 static int print_timings(SUNProfiler prof)
 {
   // Output timing in default (table) format
@@ -226,6 +257,153 @@ int main()
 
   std::fclose(fout);
 
+  // ------
+  // Test 4
+  // ------
+
+  std::cout << "\nTest 4: timer handles and call tree, sleep 2 x 250ms\n";
+
+  flag = SUNProfiler_Reset(prof);
+  if (flag)
+  {
+    std::cerr << ">>> FAILURE: "
+              << "SUNProfiler_Reset returned " << flag << "\n";
+    return 1;
+  }
+
+  flag = SUNProfiler_SetHierarchical(prof, SUNTRUE);
+  if (flag)
+  {
+    std::cerr << ">>> FAILURE: "
+              << "SUNProfiler_SetHierarchical returned " << flag << "\n";
+    return 1;
+  }
+
+  int outer = -1, inner = -1, sleep_timer = -1;
+  flag = SUNProfiler_GetTimer(prof, "outer", &outer);
+  if (!flag) { flag = SUNProfiler_GetTimer(prof, "sleep", &inner); }
+  if (!flag) { flag = SUNProfiler_GetTimer(prof, "sleep", &sleep_timer); }
+  if (flag || outer < 0 || inner < 0 || inner == outer || inner != sleep_timer)
+  {
+    std::cerr << ">>> FAILURE: "
+              << "SUNProfiler_GetTimer returned " << flag << " with handles "
+              << outer << ", " << inner << ", " << sleep_timer << "\n";
+    return 1;
+  }
+
+  double total = 0;
+  for (int i = 0; i < 2; i++)
+  {
+    sleep_handle(prof, outer, inner, 250, &chrono);
+    total += chrono;
+  }
+
+  flag = print_timings(prof);
+  if (flag)
+  {
+    std::cerr << ">>> FAILURE: "
+              << "print_timings returned " << flag << "\n";
+    return 1;
+  }
+
+  // The handle and the name refer to the same timer
+  flag = SUNProfiler_GetElapsedTime(prof, "sleep", &time);
+  if (flag)
+  {
+    std::cerr << ">>> FAILURE: "
+              << "SUNProfiler_GetElapsedTime returned " << flag << "\n";
+    return 1;
+  }
+
+  if (SUNRCompareTol(time, total, 1e-2))
+  {
+    std::cerr << ">>> FAILURE: "
+              << "time recorded was " << time << "s, but expected " << total
+              << "s +/- " << 1e-2 << "\n";
+    return 1;
+  }
+
+  // Handles that were never returned by SUNProfiler_GetTimer are rejected
+  if (!SUNProfiler_BeginHandle(prof, -1) || !SUNProfiler_EndHandle(prof, 1 << 20))
+  {
+    std::cerr << ">>> FAILURE: "
+              << "SUNProfiler_BeginHandle/EndHandle accepted an invalid "
+                 "handle\n";
+    return 1;
+  }
+
+  // ------
+  // Test 5
+  // ------
+
+#if !defined(SUNDIALS_CALIPER_ENABLED)
+  std::cout << "\nTest 5: marking a region with several profilers\n";
+
+  // The handle cached by the macros for one profiler must not be used with
+  // another, including a new profiler allocated after another one is freed
+  SUNProfiler prof2 = nullptr;
+  flag = SUNProfiler_Create(SUN_COMM_NULL, "SUNProfiler Test 2", &prof2);
+  if (flag)
+  {
+    std::cerr << ">>> FAILURE: "
+              << "SUNProfiler_Create returned " << flag << "\n";
+    return 1;
+  }
+
+  sleep_marked(prof, 10);
+  sleep_marked(prof2, 10);
+  sleep_marked(prof, 10);
+
+  double time2 = 0;
+  flag         = SUNProfiler_GetElapsedTime(prof, "marked", &time);
+  if (!flag) { flag = SUNProfiler_GetElapsedTime(prof2, "marked", &time2); }
+  if (flag || time < 0.02 || time2 < 0.01 || time2 >= 0.02)
+  {
+    std::cerr << ">>> FAILURE: "
+              << "marked times were " << time << "s and " << time2
+              << "s, but expected at least 0.02s and 0.01s\n";
+    return 1;
+  }
+
+  int marked = -1;
+  flag       = SUNProfiler_GetTimer(prof, "marked", &marked);
+  if (!flag) { flag = SUNProfiler_Free(&prof2); }
+  if (!flag)
+  {
+    flag = SUNProfiler_Create(SUN_COMM_NULL, "SUNProfiler Test 3", &prof2);
+  }
+  if (flag)
+  {
+    std::cerr << ">>> FAILURE: "
+              << "recreating the second profiler returned " << flag << "\n";
+    return 1;
+  }
+
+  // Shift the timer indices of the new profiler
+  flag = SUNProfiler_Begin(prof2, "other");
+  if (!flag) { flag = SUNProfiler_End(prof2, "other"); }
+
+  sleep_marked(prof2, 10);
+
+  time2 = 0;
+  if (!flag) { flag = SUNProfiler_GetElapsedTime(prof2, "marked", &time2); }
+  if (flag || time2 < 0.01 || !SUNProfiler_BeginHandle(prof2, marked))
+  {
+    std::cerr << ">>> FAILURE: "
+              << "marking a region with a new profiler returned " << flag
+              << " with time " << time2 << "s\n";
+    return 1;
+  }
+
+  flag = SUNProfiler_Free(&prof2);
+  if (flag)
+  {
+    std::cerr << ">>> FAILURE: "
+              << "SUNProfiler_Free returned " << flag << "\n";
+    return 1;
+  }
+#endif
+
   // --------
   // Clean up
   // --------
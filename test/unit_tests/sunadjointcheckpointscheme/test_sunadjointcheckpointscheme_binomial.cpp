@@ -0,0 +1,264 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2025-2026, Lawrence Livermore National Security,
+ * University of Maryland Baltimore County, and the SUNDIALS contributors.
+ * Copyright (c) 2013-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * Copyright (c) 2002-2013, Lawrence Livermore National Security.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------*/
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <nvector/nvector_serial.h>
+#include <sunadjointcheckpointscheme/sunadjointcheckpointscheme_binomial.h>
+#include <sundials/sundials_adjointcheckpointscheme.h>
+#include <sundials/sundials_core.h>
+#include <sunmemory/sunmemory_system.h>
+
+// Fake multistage method that follows the checkpointing pattern of ARKODE:
+// stage 0 of a step is the state at the start of the step and the last stage
+// is the state at the end of the step. The state at the start of step k is k.
+class FakeMultistageMethod
+{
+public:
+  FakeMultistageMethod(SUNContext sunctx, SUNAdjointCheckpointScheme check_scheme,
+                       int num_stages)
+    : cs(check_scheme), stages(num_stages)
+  {
+    state  = N_VNew_Serial(10, sunctx);
+    loaded = N_VClone(state);
+  }
+
+  ~FakeMultistageMethod()
+  {
+    N_VDestroy(state);
+    N_VDestroy(loaded);
+  }
+
+  static sunrealtype value(int step, int stage, int stages)
+  {
+    return step + static_cast<sunrealtype>(stage) / stages;
+  }
+
+  void forward(int first, int last)
+  {
+    for (int step = first; step <= last; ++step)
+    {
+      for (int stage = 0; stage <= stages; ++stage)
+      {
+        sunrealtype t = value(step, stage, stages);
+        sunbooleantype do_save;
+        ASSERT_EQ(SUNAdjointCheckpointScheme_NeedsSaving(cs, step, stage, t,
+                                                         &do_save),
+                  SUN_SUCCESS);
+        if (do_save)
+        {
+          N_VConst(t, state);
+          ASSERT_EQ(SUNAdjointCheckpointScheme_InsertVector(cs, step, stage, t,
+                                                            state),
+                    SUN_SUCCESS);
+        }
+      }
+    }
+  }
+
+  // Reverse the steps, recomputing from the last checkpoint when a stage is
+  // missing, and return the number of recomputed steps
+  long adjoint(int num_steps)
+  {
+    long nrecompute = 0;
+    sunrealtype t   = SUN_RCONST(0.0);
+
+    for (int step = num_steps - 1; step >= 0; --step)
+    {
+      for (int stage = stages - 1; stage >= 0; --stage)
+      {
+        SUNErrCode err = SUNAdjointCheckpointScheme_LoadVector(cs, step, stage,
+                                                               SUNFALSE,
+                                                               &loaded, &t);
+        if (err == SUN_ERR_CHECKPOINT_NOT_FOUND)
+        {
+          int start = step;
+          for (; start >= 0; --start)
+          {
+            err = SUNAdjointCheckpointScheme_LoadVector(cs, start, stages,
+                                                        SUNTRUE, &loaded, &t);
+            if (err == SUN_SUCCESS) { break; }
+          }
+          EXPECT_EQ(err, SUN_SUCCESS);
+          EXPECT_EQ(t, value(start + 1, 0, stages));
+
+          SUNAdjointCheckpointScheme_EnableDense(cs, SUNTRUE);
+          forward(start + 1, step);
+          SUNAdjointCheckpointScheme_EnableDense(cs, SUNFALSE);
+          nrecompute += step - start;
+
+          err = SUNAdjointCheckpointScheme_LoadVector(cs, step, stage, SUNFALSE,
+                                                      &loaded, &t);
+        }
+        EXPECT_EQ(err, SUN_SUCCESS);
+        EXPECT_EQ(t, value(step, stage, stages));
+        EXPECT_EQ(N_VMaxNorm(loaded), value(step, stage, stages));
+      }
+
+      // Throw away the step solution
+      EXPECT_EQ(SUNAdjointCheckpointScheme_LoadVector(cs, step, 0, SUNFALSE,
+                                                      &loaded, &t),
+                SUN_SUCCESS);
+    }
+
+    return nrecompute;
+  }
+
+private:
+  SUNAdjointCheckpointScheme cs;
+  int stages;
+  N_Vector state;
+  N_Vector loaded;
+};
+
+class SUNAdjointCheckpointSchemeBinomial : public testing::Test
+{
+protected:
+  SUNAdjointCheckpointSchemeBinomial()
+  {
+    SUNContext_Create(SUN_COMM_NULL, &sunctx);
+    mem_helper = SUNMemoryHelper_Sys(sunctx);
+  }
+
+  ~SUNAdjointCheckpointSchemeBinomial()
+  {
+    SUNMemoryHelper_Destroy(mem_helper);
+    SUNContext_Free(&sunctx);
+  }
+
+  SUNContext sunctx;
+  SUNMemoryHelper mem_helper;
+};
+
+TEST_F(SUNAdjointCheckpointSchemeBinomial, PredictNumRecomputeWorks)
+{
+  suncountertype nrecompute = 0;
+
+  EXPECT_EQ(SUNAdjointCheckpointScheme_PredictNumRecompute_Binomial(1, 1,
+                                                                    &nrecompute),
+            SUN_SUCCESS);
+  EXPECT_EQ(nrecompute, 0);
+
+  // One checkpoint plus the first step: reversing the other 99 steps with two
+  // snapshots recomputes 832 steps
+  SUNAdjointCheckpointScheme_PredictNumRecompute_Binomial(100, 1, &nrecompute);
+  EXPECT_EQ(nrecompute, 832);
+
+  SUNAdjointCheckpointScheme_PredictNumRecompute_Binomial(100, 3, &nrecompute);
+  EXPECT_EQ(nrecompute, 369);
+
+  SUNAdjointCheckpointScheme_PredictNumRecompute_Binomial(1000, 10, &nrecompute);
+  EXPECT_EQ(nrecompute, 3541);
+
+  // With a checkpoint for every step, each step other than the first and last
+  // is recomputed once
+  SUNAdjointCheckpointScheme_PredictNumRecompute_Binomial(50, 50, &nrecompute);
+  EXPECT_EQ(nrecompute, 48);
+
+  EXPECT_EQ(SUNAdjointCheckpointScheme_PredictNumRecompute_Binomial(50, 0,
+                                                                    &nrecompute),
+            SUN_ERR_ARG_OUTOFRANGE);
+}
+
+TEST_F(SUNAdjointCheckpointSchemeBinomial, ExactEstimateIsOptimal)
+{
+  const int stages = 4;
+
+  for (int max_checks : {1, 2, 3, 8})
+  {
+    for (int num_steps : {1, 2, 10, 57, 100})
+    {
+      SUNAdjointCheckpointScheme cs = nullptr;
+      ASSERT_EQ(SUNAdjointCheckpointScheme_Create_Binomial(SUNDATAIOMODE_INMEM,
+                                                           mem_helper,
+                                                           max_checks, num_steps,
+                                                           sunctx, &cs),
+                SUN_SUCCESS);
+
+      FakeMultistageMethod method(sunctx, cs, stages);
+      method.forward(0, num_steps - 1);
+      long nrecompute = method.adjoint(num_steps);
+
+      suncountertype expected = 0, counted = 0, max_used = 0;
+      SUNAdjointCheckpointScheme_PredictNumRecompute_Binomial(num_steps,
+                                                              max_checks,
+                                                              &expected);
+      SUNAdjointCheckpointScheme_GetNumRecompute_Binomial(cs, &counted);
+      SUNAdjointCheckpointScheme_GetMaxNumCheckpoints_Binomial(cs, &max_used);
+
+      EXPECT_EQ(nrecompute, expected)
+        << "num_steps = " << num_steps << ", max_checks = " << max_checks;
+      EXPECT_EQ(counted, expected);
+      EXPECT_LE(max_used, max_checks);
+
+      SUNAdjointCheckpointScheme_Destroy(&cs);
+    }
+  }
+}
+
+TEST_F(SUNAdjointCheckpointSchemeBinomial, WrongEstimateWorks)
+{
+  const int stages     = 3;
+  const int num_steps  = 80;
+  const int max_checks = 4;
+
+  for (int estimate : {1, 20, 79, 81, 200})
+  {
+    SUNAdjointCheckpointScheme cs = nullptr;
+    ASSERT_EQ(SUNAdjointCheckpointScheme_Create_Binomial(SUNDATAIOMODE_INMEM,
+                                                         mem_helper, max_checks,
+                                                         estimate, sunctx, &cs),
+              SUN_SUCCESS);
+
+    FakeMultistageMethod method(sunctx, cs, stages);
+    method.forward(0, num_steps - 1);
+    long nrecompute = method.adjoint(num_steps);
+
+    // Without checkpoints every step is recomputed from the first one
+    EXPECT_LT(nrecompute, (num_steps - 1) * (num_steps - 2) / 2);
+
+    suncountertype max_used = 0;
+    SUNAdjointCheckpointScheme_GetMaxNumCheckpoints_Binomial(cs, &max_used);
+    EXPECT_LE(max_used, max_checks);
+
+    SUNAdjointCheckpointScheme_Destroy(&cs);
+  }
+}
+
+TEST_F(SUNAdjointCheckpointSchemeBinomial, RepeatedAdjointWorks)
+{
+  const int stages     = 2;
+  const int num_steps  = 30;
+  const int max_checks = 3;
+
+  SUNAdjointCheckpointScheme cs = nullptr;
+  SUNAdjointCheckpointScheme_Create_Binomial(SUNDATAIOMODE_INMEM, mem_helper,
+                                             max_checks, num_steps, sunctx, &cs);
+
+  FakeMultistageMethod method(sunctx, cs, stages);
+  method.forward(0, num_steps - 1);
+  long first_pass = method.adjoint(num_steps);
+
+  // The first step is kept, so the adjoint can be computed again
+  long second_pass = method.adjoint(num_steps);
+  EXPECT_GE(second_pass, first_pass);
+
+  // A new forward integration starts over
+  method.forward(0, num_steps - 1);
+  EXPECT_EQ(method.adjoint(num_steps), first_pass);
+
+  SUNAdjointCheckpointScheme_Destroy(&cs);
+}
@@ -341,3 +341,55 @@ TEST_F(SUNAdjointCheckpointSchemeFixed, CanStillInsertAfterDeleting)
   err = SUNAdjointCheckpointScheme_Destroy(&cs);
   EXPECT_EQ(err, SUN_SUCCESS);
 }
+
+#if defined(SUNDIALS_HAVE_MMAP)
+
+TEST_F(SUNAdjointCheckpointSchemeFixed, MmapTwoStepsTwoStagesWithDeleteWorks)
+{
+  SUNErrCode err;
+  SUNAdjointCheckpointScheme cs     = NULL;
+  suncountertype interval           = 1;
+  suncountertype estimate           = 100;
+  sunbooleantype keep_after_loading = SUNFALSE;
+
+  err = SUNAdjointCheckpointScheme_Create_Fixed(SUNDATAIOMODE_MMAP, mem_helper,
+                                                interval, estimate,
+                                                keep_after_loading, sunctx, &cs);
+  EXPECT_EQ(err, SUN_SUCCESS);
+
+  // Keep at most one state in memory, the rest goes to the file
+  err = SUNAdjointCheckpointScheme_SetMmapOptions_Fixed(cs, NULL,
+                                                        11 * sizeof(sunrealtype));
+  EXPECT_EQ(err, SUN_SUCCESS);
+
+  fake_mutlistage_method(sunctx, cs, 2, 2, true);
+
+  err = SUNAdjointCheckpointScheme_Destroy(&cs);
+  EXPECT_EQ(err, SUN_SUCCESS);
+}
+
+TEST_F(SUNAdjointCheckpointSchemeFixed, MmapManyStepsWithKeepWorks)
+{
+  SUNErrCode err;
+  SUNAdjointCheckpointScheme cs     = NULL;
+  suncountertype interval           = 1;
+  suncountertype estimate           = 100;
+  sunbooleantype keep_after_loading = SUNTRUE;
+
+  err = SUNAdjointCheckpointScheme_Create_Fixed(SUNDATAIOMODE_MMAP, mem_helper,
+                                                interval, estimate,
+                                                keep_after_loading, sunctx, &cs);
+  EXPECT_EQ(err, SUN_SUCCESS);
+
+  // A zero budget spills every state to the file
+  err = SUNAdjointCheckpointScheme_SetMmapOptions_Fixed(cs, NULL, 0);
+  EXPECT_EQ(err, SUN_SUCCESS);
+
+  // Use an exactly representable step so the times match after many steps
+  fake_mutlistage_method(sunctx, cs, 20, 3, true, SUN_RCONST(0.125));
+
+  err = SUNAdjointCheckpointScheme_Destroy(&cs);
+  EXPECT_EQ(err, SUN_SUCCESS);
+}
+
+#endif
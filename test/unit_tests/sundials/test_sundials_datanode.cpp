@@ -21,6 +21,7 @@
 #include "sundials_datanode.h"
 
 #include "sundatanode/sundatanode_inmem.h"
+#include "sundatanode/sundatanode_mmap.h"
 #include "sundials/sundials_memory.h"
 #include "sundials/sundials_nvector.h"
 #include "sundials/sundials_types.h"
@@ -480,3 +481,71 @@ TEST_F(SUNDataNodeTest, SetAndGetDataNvectorWhenLeaf)
   N_VDestroy(v);
   N_VDestroy(vec_we_got);
 }
+
+#if defined(SUNDIALS_HAVE_MMAP)
+
+TEST_F(SUNDataNodeTest, MmapLeavesRespectBudget)
+{
+  SUNErrCode err;
+  SUNDataArena_Mmap arena;
+  const int num_leaves = 8;
+  SUNDataNode root_node;
+  N_Vector v          = N_VNew_Serial(100, sunctx);
+  N_Vector vec_we_got = N_VClone(v);
+
+  const size_t leaf_bytes = 101 * sizeof(sunrealtype);
+
+  err = SUNDataArena_Create_Mmap(NULL, 3 * leaf_bytes, sunctx, &arena);
+  ASSERT_EQ(err, SUN_SUCCESS);
+
+  err = SUNDataNode_CreateList(SUNDATAIOMODE_MMAP, num_leaves, sunctx,
+                               &root_node);
+  EXPECT_EQ(err, SUN_SUCCESS);
+
+  for (int i = 0; i < num_leaves; i++)
+  {
+    SUNDataNode leaf;
+    err = SUNDataNode_CreateLeaf_Mmap(arena, mem_helper, sunctx, &leaf);
+    EXPECT_EQ(err, SUN_SUCCESS);
+    N_VConst(static_cast<sunrealtype>(i), v);
+    err = SUNDataNode_SetDataNvector(leaf, v, static_cast<sunrealtype>(i));
+    EXPECT_EQ(err, SUN_SUCCESS);
+    err = SUNDataNode_AddChild(root_node, leaf);
+    EXPECT_EQ(err, SUN_SUCCESS);
+    EXPECT_LE(arena->resident_bytes, 3 * leaf_bytes);
+  }
+
+  EXPECT_EQ(arena->bytes_spilled, (num_leaves - 3) * leaf_bytes);
+
+  // Remove the leaves in reverse order, the file shrinks as we go
+  for (int i = num_leaves - 1; i >= 0; i--)
+  {
+    SUNDataNode leaf;
+    err = SUNDataNode_RemoveChild(root_node, i, &leaf);
+    EXPECT_EQ(err, SUN_SUCCESS);
+
+    sunrealtype tout = SUN_RCONST(-1.0);
+    err              = SUNDataNode_GetDataNvector(leaf, vec_we_got, &tout);
+    EXPECT_EQ(err, SUN_SUCCESS);
+    EXPECT_EQ(tout, static_cast<sunrealtype>(i));
+    EXPECT_EQ(N_VGetArrayPointer(vec_we_got)[99], static_cast<sunrealtype>(i));
+
+    err = SUNDataNode_Destroy(&leaf);
+    EXPECT_EQ(err, SUN_SUCCESS);
+  }
+
+  EXPECT_EQ(arena->resident_bytes, 0);
+  EXPECT_EQ(arena->num_segments, 1);
+  EXPECT_EQ(arena->seg_used[0], 0);
+
+  err = SUNDataNode_Destroy(&root_node);
+  EXPECT_EQ(err, SUN_SUCCESS);
+
+  err = SUNDataArena_Destroy_Mmap(&arena);
+  EXPECT_EQ(err, SUN_SUCCESS);
+
+  N_VDestroy(v);
+  N_VDestroy(vec_we_got);
+}
+
+#endif
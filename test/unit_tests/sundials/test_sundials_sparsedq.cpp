@@ -0,0 +1,180 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2025-2026, Lawrence Livermore National Security,
+ * University of Maryland Baltimore County, and the SUNDIALS contributors.
+ * Copyright (c) 2013-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * Copyright (c) 2002-2013, Lawrence Livermore National Security.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------*/
+
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <sundials/sundials_core.hpp>
+#include <sunmatrix/sunmatrix_dense.h>
+#include <sunmatrix/sunmatrix_sparse.h>
+
+#include "sundials_sparsedq_impl.h"
+
+// Tridiagonal matrix with a dense last column
+static void FillPattern(SUNMatrix D, sunindextype N)
+{
+  SUNMatZero(D);
+  for (sunindextype i = 0; i < N; i++)
+  {
+    for (sunindextype j = 0; j < N; j++)
+    {
+      if (i - j <= 1 && j - i <= 1)
+      {
+        SM_ELEMENT_D(D, i, j) = static_cast<sunrealtype>(1 + i + 2 * j);
+      }
+    }
+    SM_ELEMENT_D(D, i, N - 1) = static_cast<sunrealtype>(3 + i);
+  }
+}
+
+class SUNSparseDQTest : public testing::TestWithParam<int>
+{
+protected:
+  sundials::Context sunctx;
+  sunindextype N = 12;
+  SUNMatrix D    = nullptr;
+  SUNMatrix S    = nullptr;
+
+  void SetUp() override
+  {
+    D = SUNDenseMatrix(N, N, sunctx);
+    FillPattern(D, N);
+    S = SUNSparseFromDenseMatrix(D, SUN_RCONST(0.0), GetParam());
+  }
+
+  void TearDown() override
+  {
+    SUNMatDestroy(S);
+    SUNMatDestroy(D);
+  }
+};
+
+TEST_P(SUNSparseDQTest, ColoringIsStructurallyOrthogonal)
+{
+  SUNSparseDQ sdq = nullptr;
+  ASSERT_EQ(SUNSparseDQ_Create(S, &sdq), SUN_SUCCESS);
+
+  // three colors for the tridiagonal part and one for the dense column
+  EXPECT_EQ(sdq->NNZ, SUNSparseMatrix_NNZ(S));
+  EXPECT_EQ(sdq->colorptrs[sdq->ncolors], N);
+  EXPECT_EQ(sdq->ncolors, 4);
+
+  // each column appears once and columns of one color share no rows
+  std::vector<int> seen(N, 0);
+  for (sunindextype c = 0; c < sdq->ncolors; c++)
+  {
+    std::vector<int> rows(N, 0);
+    for (sunindextype k = sdq->colorptrs[c]; k < sdq->colorptrs[c + 1]; k++)
+    {
+      sunindextype j = sdq->colorcols[k];
+      seen[j]++;
+      for (sunindextype p = sdq->colptrs[j]; p < sdq->colptrs[j + 1]; p++)
+      {
+        EXPECT_EQ(rows[sdq->rowvals[p]]++, 0);
+      }
+    }
+  }
+  for (sunindextype j = 0; j < N; j++) { EXPECT_EQ(seen[j], 1); }
+
+  EXPECT_TRUE(SUNSparseDQ_SamePattern(sdq, S));
+
+  SUNSparseDQ_Destroy(&sdq);
+  EXPECT_EQ(sdq, nullptr);
+}
+
+TEST_P(SUNSparseDQTest, ScatterRecoversLinearJacobian)
+{
+  SUNSparseDQ sdq = nullptr;
+  ASSERT_EQ(SUNSparseDQ_Create(S, &sdq), SUN_SUCCESS);
+
+  // start from an empty matrix that is too small to hold the pattern
+  SUNMatrix J = SUNSparseMatrix(N, N, 1, GetParam(), sunctx);
+  ASSERT_EQ(SUNSparseDQ_LoadPattern(sdq, J), SUN_ERR_ARG_DIMSMISMATCH);
+  ASSERT_EQ(SUNSparseMatrix_Reallocate(J, sdq->NNZ), SUN_SUCCESS);
+  ASSERT_EQ(SUNSparseDQ_LoadPattern(sdq, J), SUN_SUCCESS);
+
+  // f(y) = D y, so one evaluation per color recovers D exactly
+  std::vector<sunrealtype> y(N, SUN_RCONST(1.0)), fy(N), ft(N);
+  auto f = [&](const std::vector<sunrealtype>& x, std::vector<sunrealtype>& out)
+  {
+    for (sunindextype i = 0; i < N; i++)
+    {
+      out[i] = SUN_RCONST(0.0);
+      for (sunindextype j = 0; j < N; j++)
+      {
+        out[i] += SM_ELEMENT_D(D, i, j) * x[j];
+      }
+    }
+  };
+  f(y, fy);
+
+  const sunrealtype inc = SUN_RCONST(0.5);
+  for (sunindextype c = 0; c < sdq->ncolors; c++)
+  {
+    std::vector<sunrealtype> yt(y);
+    for (sunindextype k = sdq->colorptrs[c]; k < sdq->colorptrs[c + 1]; k++)
+    {
+      yt[sdq->colorcols[k]] += inc;
+    }
+    f(yt, ft);
+    for (sunindextype k = sdq->colorptrs[c]; k < sdq->colorptrs[c + 1]; k++)
+    {
+      SUNSparseDQ_ScatterColumn(sdq, J, sdq->colorcols[k], 1 / inc, ft.data(),
+                                fy.data());
+    }
+  }
+
+  SUNMatrix Jd = SUNDenseMatrix(N, N, sunctx);
+  SUNMatZero(Jd);
+  for (sunindextype a = 0; a < N; a++)
+  {
+    for (sunindextype p = SM_INDEXPTRS_S(J)[a]; p < SM_INDEXPTRS_S(J)[a + 1]; p++)
+    {
+      sunindextype b = SM_INDEXVALS_S(J)[p];
+      if (GetParam() == SUN_CSC_MAT) { SM_ELEMENT_D(Jd, b, a) = SM_DATA_S(J)[p]; }
+      else { SM_ELEMENT_D(Jd, a, b) = SM_DATA_S(J)[p]; }
+    }
+  }
+
+  for (sunindextype i = 0; i < N; i++)
+  {
+    for (sunindextype j = 0; j < N; j++)
+    {
+      EXPECT_DOUBLE_EQ(SM_ELEMENT_D(Jd, i, j), SM_ELEMENT_D(D, i, j));
+    }
+  }
+
+  SUNMatDestroy(Jd);
+  SUNMatDestroy(J);
+  SUNSparseDQ_Destroy(&sdq);
+}
+
+TEST_P(SUNSparseDQTest, PatternChangeIsDetected)
+{
+  SUNSparseDQ sdq = nullptr;
+  ASSERT_EQ(SUNSparseDQ_Create(S, &sdq), SUN_SUCCESS);
+
+  SM_ELEMENT_D(D, 0, N / 2) = SUN_RCONST(7.0);
+  SUNMatrix S2 = SUNSparseFromDenseMatrix(D, SUN_RCONST(0.0), GetParam());
+  EXPECT_FALSE(SUNSparseDQ_SamePattern(sdq, S2));
+
+  SUNMatDestroy(S2);
+  SUNSparseDQ_Destroy(&sdq);
+}
+
+INSTANTIATE_TEST_SUITE_P(SparseTypes, SUNSparseDQTest,
+                         testing::Values(SUN_CSC_MAT, SUN_CSR_MAT));
@@ -49,6 +49,7 @@ int main(int argc, char* argv[])
   int print_timing;
   sunindextype j, k, kstart, kend;
   sunrealtype *colj, *xdata;
+  long int nsolves, nrefine, nfallbacks;
   SUNContext sunctx;
 
   if (SUNContext_Create(SUN_COMM_NULL, &sunctx))
@@ -180,6 +181,50 @@ int main(int argc, char* argv[])
   fails += Test_SUNLinSolLastFlag(LS, 0);
   fails += Test_SUNLinSolSpace(LS, 0);
 
+  /* Repeat the setup and solve in mixed precision with the original matrix,
+     which the mixed precision setup must leave unchanged for the refinement */
+  SUNMatCopy(B, A);
+  fails += SUNLinSol_BandSetMixedPrecision(LS, SUNTRUE, 0, ZERO);
+  fails += Test_SUNLinSolSetup(LS, A, 0);
+  fails += Test_SUNLinSolSolve(LS, A, x, b, 1000 * SUN_UNIT_ROUNDOFF, SUNTRUE,
+                               0);
+  fails += Test_SUNLinSolSpace(LS, 0);
+
+  fails += SUNLinSol_BandGetRefinementStats(LS, &nsolves, &nrefine,
+                                            &nfallbacks);
+  if (nsolves != 1 || nrefine < 1 || nfallbacks != 0)
+  {
+    printf(">>> FAILED test -- SUNLinSol_BandGetRefinementStats \n");
+    printf("    nsolves = %ld, nrefine = %ld, nfallbacks = %ld \n",
+           nsolves, nrefine, nfallbacks);
+    fails++;
+  }
+  else { printf("    PASSED test -- SUNLinSol_BandGetRefinementStats \n"); }
+
+#if defined(SUNDIALS_DOUBLE_PRECISION) || defined(SUNDIALS_EXTENDED_PRECISION)
+  /* Solve again with a right-hand side below the normal float range, which
+     must be scaled for the float solves to converge without a fallback. The
+     solution, scaled back, must match x to working precision. */
+  N_Vector z = N_VClone(x);
+  N_VScale(SUN_RCONST(1.0e-40), b, b);
+  N_VConst(ZERO, z);
+  fails += SUNLinSolSolve(LS, A, z, b, 1000 * SUN_UNIT_ROUNDOFF);
+  N_VScale(SUN_RCONST(1.0e40), z, z);
+
+  fails += SUNLinSol_BandGetRefinementStats(LS, &nsolves, &nrefine,
+                                            &nfallbacks);
+  if (check_vector(x, z, 10000 * SUN_UNIT_ROUNDOFF) || nsolves != 2 ||
+      nfallbacks != 0)
+  {
+    printf(">>> FAILED test -- SUNLinSol_Band mixed precision small rhs \n");
+    printf("    nsolves = %ld, nrefine = %ld, nfallbacks = %ld \n",
+           nsolves, nrefine, nfallbacks);
+    fails++;
+  }
+  else { printf("    PASSED test -- SUNLinSol_Band mixed precision small rhs \n"); }
+  N_VDestroy(z);
+#endif
+
   /* Print result */
   if (fails)
   {
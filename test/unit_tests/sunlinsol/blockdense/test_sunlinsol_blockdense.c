@@ -0,0 +1,226 @@
+/*
+ * -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2025-2026, Lawrence Livermore National Security,
+ * University of Maryland Baltimore County, and the SUNDIALS contributors.
+ * Copyright (c) 2013-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * Copyright (c) 2002-2013, Lawrence Livermore National Security.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * This is the testing routine to check the SUNLinSol BlockDense
+ * module implementation.
+ * -----------------------------------------------------------------
+ */
+
+#include <nvector/nvector_serial.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sundials/sundials_math.h>
+#include <sundials/sundials_types.h>
+#include <sunlinsol/sunlinsol_blockdense.h>
+#include <sunmatrix/sunmatrix_blockdense.h>
+
+#include "test_sunlinsol.h"
+
+#if defined(SUNDIALS_EXTENDED_PRECISION)
+#define GSYM "Lg"
+#else
+#define GSYM "g"
+#endif
+
+/* ----------------------------------------------------------------------
+ * SUNLinSol_BlockDense Testing Routine
+ * --------------------------------------------------------------------*/
+int main(int argc, char* argv[])
+{
+  int fails = 0;         /* counter for test failures  */
+  sunindextype N;        /* block size                 */
+  sunindextype nblocks;  /* number of blocks           */
+  SUNLinearSolver LS;    /* solver object              */
+  SUNMatrix A, B;        /* test matrices              */
+  N_Vector x, y, b;      /* test vectors               */
+  int print_timing;
+  int print_on_fail;
+  sunindextype i, j, k;
+  sunrealtype* xdata;
+  SUNContext sunctx;
+
+  if (SUNContext_Create(SUN_COMM_NULL, &sunctx))
+  {
+    printf("ERROR: SUNContext_Create failed\n");
+    return (-1);
+  }
+
+  /* check input and set matrix dimensions */
+  if (argc < 4)
+  {
+    printf("ERROR: THREE (3) Inputs required: block size, number of blocks, "
+           "print timing \n");
+    return (-1);
+  }
+
+  N = (sunindextype)atol(argv[1]);
+  if (N <= 0)
+  {
+    printf("ERROR: block size must be a positive integer \n");
+    return (-1);
+  }
+
+  nblocks = (sunindextype)atol(argv[2]);
+  if (nblocks <= 0)
+  {
+    printf("ERROR: number of blocks must be a positive integer \n");
+    return (-1);
+  }
+
+  print_timing = atoi(argv[3]);
+  SetTiming(print_timing);
+
+  print_on_fail = 0;
+  if (argc == 5) { print_on_fail = atoi(argv[4]); }
+
+  printf("\nBlock dense linear solver test: %ld blocks of size %ld\n\n",
+         (long int)nblocks, (long int)N);
+
+  /* Create matrices and vectors */
+  A = SUNMatrix_BlockDense(nblocks, N, N, sunctx);
+  B = SUNMatrix_BlockDense(nblocks, N, N, sunctx);
+  x = N_VNew_Serial(N * nblocks, sunctx);
+  y = N_VNew_Serial(N * nblocks, sunctx);
+  b = N_VNew_Serial(N * nblocks, sunctx);
+
+  /* Fill each block with uniform random data in [0,1/N] and add a scaled
+     anti-identity to ensure the solver needs to do row-swapping. The scaling
+     differs between blocks so that each block pivots differently. */
+  for (k = 0; k < nblocks; k++)
+  {
+    for (j = 0; j < N; j++)
+    {
+      for (i = 0; i < N; i++)
+      {
+        SM_ELEMENT_BD(A, k, i, j) = (sunrealtype)rand() / (sunrealtype)RAND_MAX /
+                                    N;
+      }
+      SM_ELEMENT_BD(A, k, N - 1 - j, j) += ONE + (sunrealtype)(k % 3);
+    }
+  }
+
+  /* Fill x vector with uniform random data in [0,1] */
+  xdata = N_VGetArrayPointer(x);
+  for (j = 0; j < N * nblocks; j++)
+  {
+    xdata[j] = (sunrealtype)rand() / (sunrealtype)RAND_MAX;
+  }
+
+  /* copy A and x into B and y to print in case of solver failure */
+  SUNMatCopy(A, B);
+  N_VScale(ONE, x, y);
+
+  /* create right-hand side vector for linear solve */
+  fails = SUNMatMatvec(A, x, b);
+  if (fails)
+  {
+    printf("FAIL: SUNLinSol SUNMatMatvec failure\n");
+
+    /* Free matrices and vectors */
+    SUNMatDestroy(A);
+    SUNMatDestroy(B);
+    N_VDestroy(x);
+    N_VDestroy(y);
+    N_VDestroy(b);
+
+    return (1);
+  }
+
+  /* Create block dense linear solver */
+  LS = SUNLinSol_BlockDense(x, A, sunctx);
+
+  /* Run Tests */
+  fails += Test_SUNLinSolInitialize(LS, 0);
+  fails += Test_SUNLinSolSetup(LS, A, 0);
+  fails += Test_SUNLinSolSolve(LS, A, x, b, 100 * SUN_UNIT_ROUNDOFF, SUNTRUE, 0);
+
+  fails += Test_SUNLinSolGetType(LS, SUNLINEARSOLVER_DIRECT, 0);
+  fails += Test_SUNLinSolGetID(LS, SUNLINEARSOLVER_BLOCKDENSE, 0);
+  fails += Test_SUNLinSolLastFlag(LS, 0);
+
+  /* A singular last block must be reported as a factorization failure */
+  SUNMatCopy(B, A);
+  for (j = 0; j < N; j++) { SM_ELEMENT_BD(A, nblocks - 1, j, 0) = ZERO; }
+  if (SUNLinSolSetup(LS, A) != SUNLS_LUFACT_FAIL || SUNLinSolLastFlag(LS) != 1)
+  {
+    printf(">>> FAILED test -- SUNLinSolSetup singular block check \n");
+    fails++;
+  }
+  else { printf("    PASSED test -- SUNLinSolSetup singular block check \n"); }
+
+  /* Print result */
+  if (fails)
+  {
+    printf("FAIL: SUNLinSol module failed %i tests \n \n", fails);
+    if (print_on_fail)
+    {
+      printf("\nA (original) =\n");
+      SUNMatrix_BlockDense_Print(B, stdout);
+      printf("\nA (factored) =\n");
+      SUNMatrix_BlockDense_Print(A, stdout);
+      printf("\nx (original) =\n");
+      N_VPrint_Serial(y);
+      printf("\nx (computed) =\n");
+      N_VPrint_Serial(x);
+    }
+  }
+  else { printf("SUCCESS: SUNLinSol module passed all tests \n \n"); }
+
+  /* Free solver, matrix and vectors */
+  SUNLinSolFree(LS);
+  SUNMatDestroy(A);
+  SUNMatDestroy(B);
+  N_VDestroy(x);
+  N_VDestroy(y);
+  N_VDestroy(b);
+  SUNContext_Free(&sunctx);
+
+  return (fails);
+}
+
+/* ----------------------------------------------------------------------
+ * Implementation-specific 'check' routines
+ * --------------------------------------------------------------------*/
+int check_vector(N_Vector X, N_Vector Y, sunrealtype tol)
+{
+  int failure = 0;
+  sunindextype i, local_length;
+  sunrealtype *Xdata, *Ydata, maxerr;
+
+  Xdata        = N_VGetArrayPointer(X);
+  Ydata        = N_VGetArrayPointer(Y);
+  local_length = N_VGetLength_Serial(X);
+
+  /* check vector data */
+  for (i = 0; i < local_length; i++)
+  {
+    failure += SUNRCompareTol(Xdata[i], Ydata[i], tol);
+  }
+
+  if (failure > ZERO)
+  {
+    maxerr = ZERO;
+    for (i = 0; i < local_length; i++)
+    {
+      maxerr = SUNMAX(SUNRabs(Xdata[i] - Ydata[i]), maxerr);
+    }
+    printf("check err failure: maxerr = %" GSYM " (tol = %" GSYM ")\n", maxerr,
+           tol);
+    return (1);
+  }
+  else { return (0); }
+}
+
+void sync_device(void) {}
@@ -50,6 +50,7 @@ int main(int argc, char* argv[])
   int print_on_fail;
   sunindextype j, k;
   sunrealtype *colj, *xdata, *colIj;
+  long int nsolves, nrefine, nfallbacks;
   SUNContext sunctx;
 
   if (SUNContext_Create(SUN_COMM_NULL, &sunctx))
@@ -161,6 +162,59 @@ int main(int argc, char* argv[])
   fails += Test_SUNLinSolLastFlag(LS, 0);
   fails += Test_SUNLinSolSpace(LS, 0);
 
+  /* Repeat the setup and solve in mixed precision with the original matrix,
+     which the mixed precision setup must leave unchanged for the refinement */
+  SUNMatCopy(B, A);
+  fails += SUNLinSol_DenseSetMixedPrecision(LS, SUNTRUE, 0, ZERO);
+  fails += Test_SUNLinSolSetup(LS, A, 0);
+  fails += Test_SUNLinSolSolve(LS, A, x, b, 1000 * SUN_UNIT_ROUNDOFF, SUNTRUE,
+                               0);
+  fails += Test_SUNLinSolSpace(LS, 0);
+
+  fails += SUNLinSol_DenseGetRefinementStats(LS, &nsolves, &nrefine,
+                                             &nfallbacks);
+  if (nsolves != 1 || nrefine < 1 || nfallbacks != 0)
+  {
+    printf(">>> FAILED test -- SUNLinSol_DenseGetRefinementStats \n");
+    printf("    nsolves = %ld, nrefine = %ld, nfallbacks = %ld \n",
+           nsolves, nrefine, nfallbacks);
+    fails++;
+  }
+  else { printf("    PASSED test -- SUNLinSol_DenseGetRefinementStats \n"); }
+
+#if defined(SUNDIALS_DOUBLE_PRECISION) || defined(SUNDIALS_EXTENDED_PRECISION)
+  /* Solve again with a right-hand side below the normal float range, which
+     must be scaled for the float solves to converge without a fallback. The
+     solution, scaled back, must match x to working precision. */
+  N_Vector z = N_VClone(x);
+  N_VScale(SUN_RCONST(1.0e-40), b, b);
+  N_VConst(ZERO, z);
+  fails += SUNLinSolSolve(LS, A, z, b, 1000 * SUN_UNIT_ROUNDOFF);
+  N_VScale(SUN_RCONST(1.0e40), z, z);
+
+  fails += SUNLinSol_DenseGetRefinementStats(LS, &nsolves, &nrefine,
+                                             &nfallbacks);
+  if (check_vector(x, z, 10000 * SUN_UNIT_ROUNDOFF) || nsolves != 2 ||
+      nfallbacks != 0)
+  {
+    printf(">>> FAILED test -- SUNLinSol_Dense mixed precision small rhs \n");
+    printf("    nsolves = %ld, nrefine = %ld, nfallbacks = %ld \n",
+           nsolves, nrefine, nfallbacks);
+    fails++;
+  }
+  else { printf("    PASSED test -- SUNLinSol_Dense mixed precision small rhs \n"); }
+  N_VDestroy(z);
+#endif
+
+  /* Repeat the setup and solve in working precision with several threads,
+     which must not change the factorization beyond roundoff */
+  SUNMatCopy(B, A);
+  fails += SUNMatMatvec(A, x, b);
+  fails += SUNLinSol_DenseSetMixedPrecision(LS, SUNFALSE, 0, ZERO);
+  fails += SUNLinSol_DenseSetNumThreads(LS, 4);
+  fails += Test_SUNLinSolSetup(LS, A, 0);
+  fails += Test_SUNLinSolSolve(LS, A, x, b, 100 * SUN_UNIT_ROUNDOFF, SUNTRUE, 0);
+
   /* Print result */
   if (fails)
   {
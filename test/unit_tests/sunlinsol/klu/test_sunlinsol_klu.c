@@ -39,7 +39,7 @@ int main(int argc, char* argv[])
   int fails = 0;      /* counter for test failures  */
   sunindextype N;     /* matrix columns, rows       */
   SUNLinearSolver LS; /* linear solver object       */
-  SUNMatrix A, B;     /* test matrices              */
+  SUNMatrix A, B, C;  /* test matrices              */
   N_Vector x, y, b;   /* test vectors               */
   sunrealtype *matdata, *xdata;
   int mattype, print_timing;
@@ -47,6 +47,8 @@ int main(int argc, char* argv[])
   sun_klu_symbolic* symbolic;
   sun_klu_numeric* numeric;
   sun_klu_common* common;
+  long int nanalyze, nfactor, nrefactor, nsolve;
+  double t_analyze, t_factor, t_refactor, t_solve;
   SUNContext sunctx;
 
   if (SUNContext_Create(SUN_COMM_NULL, &sunctx))
@@ -164,6 +166,85 @@ int main(int argc, char* argv[])
   }
   else { printf("    PASSED test -- SUNLinSol_KLUGetCommon \n"); }
 
+  /* Refactor, then reinitialize with the same sparsity pattern, which must
+     reuse the symbolic analysis */
+  fails += Test_SUNLinSolSetup(LS, A, 0);
+  fails += Test_SUNLinSolSolve(LS, A, x, b, 1000 * SUN_UNIT_ROUNDOFF, SUNTRUE, 0);
+  if (SUNLinSol_KLUReInit(LS, A, SUNSparseMatrix_NNZ(A), SUNKLU_REINIT_PARTIAL))
+  {
+    printf("FAIL: SUNLinSol_KLUReInit failure\n");
+    fails += 1;
+  }
+  fails += Test_SUNLinSolSetup(LS, A, 0);
+  fails += Test_SUNLinSolSolve(LS, A, x, b, 1000 * SUN_UNIT_ROUNDOFF, SUNTRUE, 0);
+
+  if (SUNLinSol_KLUGetStats(LS, &nanalyze, &nfactor, &nrefactor, &nsolve) ||
+      nanalyze != 1 || nfactor < 2 || nrefactor != 1 || nsolve != 3)
+  {
+    printf("FAIL: SUNLinSol_KLUGetStats failure\n");
+    fails += 1;
+  }
+  else { printf("    PASSED test -- SUNLinSol_KLUGetStats \n"); }
+
+  /* Reinitialize with a copy of the matrix, whose index arrays are stored
+     separately but hold the same pattern, which must also reuse the symbolic
+     analysis */
+  C = SUNMatClone(A);
+  if (SUNMatCopy(A, C))
+  {
+    printf("FAIL: SUNLinSol SUNMatCopy failure\n");
+    return (1);
+  }
+  if (SUNLinSol_KLUReInit(LS, C, SUNSparseMatrix_NNZ(C), SUNKLU_REINIT_PARTIAL))
+  {
+    printf("FAIL: SUNLinSol_KLUReInit failure\n");
+    fails += 1;
+  }
+  fails += Test_SUNLinSolSetup(LS, C, 0);
+  fails += Test_SUNLinSolSolve(LS, C, x, b, 1000 * SUN_UNIT_ROUNDOFF, SUNTRUE, 0);
+
+  if (SUNLinSol_KLUGetStats(LS, &nanalyze, NULL, NULL, NULL) || nanalyze != 1)
+  {
+    printf("FAIL: SUNLinSol_KLUReInit same pattern failure\n");
+    fails += 1;
+  }
+  else { printf("    PASSED test -- SUNLinSol_KLUReInit same pattern \n"); }
+  SUNMatDestroy(C);
+
+  /* Reinitialize with the identity, which must redo the symbolic analysis if
+     its pattern differs from that of A (i.e., A has off-diagonal entries) */
+  C = SUNSparseMatrix(N, N, N, mattype, sunctx);
+  for (i = 0; i < N; i++)
+  {
+    SUNSparseMatrix_IndexPointers(C)[i] = i;
+    SUNSparseMatrix_IndexValues(C)[i]   = i;
+    SUNSparseMatrix_Data(C)[i]          = ONE;
+  }
+  SUNSparseMatrix_IndexPointers(C)[N] = N;
+  if (SUNLinSol_KLUReInit(LS, C, SUNSparseMatrix_NNZ(C), SUNKLU_REINIT_PARTIAL))
+  {
+    printf("FAIL: SUNLinSol_KLUReInit failure\n");
+    fails += 1;
+  }
+  fails += Test_SUNLinSolSetup(LS, C, 0);
+
+  if (SUNLinSol_KLUGetStats(LS, &nanalyze, NULL, NULL, NULL) ||
+      nanalyze != ((SUNSparseMatrix_IndexPointers(A)[N] > N) ? 2 : 1))
+  {
+    printf("FAIL: SUNLinSol_KLUReInit new pattern failure\n");
+    fails += 1;
+  }
+  else { printf("    PASSED test -- SUNLinSol_KLUReInit new pattern \n"); }
+  SUNMatDestroy(C);
+
+  if (SUNLinSol_KLUGetTimes(LS, &t_analyze, &t_factor, &t_refactor, &t_solve) ||
+      t_analyze < 0.0 || t_factor < 0.0 || t_refactor < 0.0 || t_solve < 0.0)
+  {
+    printf("FAIL: SUNLinSol_KLUGetTimes failure\n");
+    fails += 1;
+  }
+  else { printf("    PASSED test -- SUNLinSol_KLUGetTimes \n"); }
+
   /* Print result */
   if (fails)
   {
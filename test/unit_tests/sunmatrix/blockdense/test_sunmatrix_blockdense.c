@@ -0,0 +1,311 @@
+/*
+ * -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2025-2026, Lawrence Livermore National Security,
+ * University of Maryland Baltimore County, and the SUNDIALS contributors.
+ * Copyright (c) 2013-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * Copyright (c) 2002-2013, Lawrence Livermore National Security.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * This is the testing routine to check the SUNMatrix BlockDense
+ * module implementation.
+ * -----------------------------------------------------------------
+ */
+
+#include <nvector/nvector_serial.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sundials/sundials_math.h>
+#include <sundials/sundials_types.h>
+#include <sunmatrix/sunmatrix_blockdense.h>
+
+#include "test_sunmatrix.h"
+
+#if defined(SUNDIALS_EXTENDED_PRECISION)
+#define GSYM "Lg"
+#else
+#define GSYM "g"
+#endif
+
+/* ----------------------------------------------------------------------
+ * Main SUNMatrix Testing Routine
+ * --------------------------------------------------------------------*/
+int main(int argc, char* argv[])
+{
+  int fails = 0;                 /* counter for test failures  */
+  sunindextype matrows, matcols; /* block dimensions           */
+  sunindextype nblocks;          /* number of blocks in matrix */
+  N_Vector x, y;                 /* test vectors               */
+  sunrealtype *xdata, *ydata;    /* pointers to vector data    */
+  SUNMatrix A, AT, I;            /* test matrices              */
+  int print_timing, square;
+  sunindextype i, j, k, m, n;
+  SUNContext sunctx;
+
+  if (SUNContext_Create(SUN_COMM_NULL, &sunctx))
+  {
+    printf("ERROR: SUNContext_Create failed\n");
+    return (-1);
+  }
+
+  /* check input and set vector length */
+  if (argc < 5)
+  {
+    printf("ERROR: FOUR (4) Input required: block rows, block cols, number "
+           "of matrix blocks, print timing \n");
+    return (-1);
+  }
+
+  matrows = (sunindextype)atol(argv[1]);
+  if (matrows <= 0)
+  {
+    printf("ERROR: number of rows must be a positive integer \n");
+    return (-1);
+  }
+
+  matcols = (sunindextype)atol(argv[2]);
+  if (matcols <= 0)
+  {
+    printf("ERROR: number of cols must be a positive integer \n");
+    return (-1);
+  }
+
+  nblocks = (sunindextype)atol(argv[3]);
+  if (nblocks <= 0)
+  {
+    printf("ERROR: number of blocks must be a positive integer \n");
+    return (-1);
+  }
+
+  print_timing = atoi(argv[4]);
+  SetTiming(print_timing);
+
+  square = (matrows == matcols) ? 1 : 0;
+  printf("\nBlock dense matrix test: %ld blocks of size %ld by %ld\n\n",
+         (long int)nblocks, (long int)matrows, (long int)matcols);
+
+  /* Initialize vectors and matrices to NULL */
+  x = NULL;
+  y = NULL;
+  A = NULL;
+  I = NULL;
+
+  /* Create vectors and matrices */
+  x  = N_VNew_Serial(matcols * nblocks, sunctx);
+  y  = N_VNew_Serial(matrows * nblocks, sunctx);
+  A  = SUNMatrix_BlockDense(nblocks, matrows, matcols, sunctx);
+  AT = SUNMatrix_BlockDense(nblocks, matcols, matrows, sunctx);
+  I  = NULL;
+  if (square) { I = SUNMatClone(A); }
+
+  /* Fill matrices and vectors, every block holds the same entries */
+  for (k = 0; k < nblocks; k++)
+  {
+    for (j = 0; j < matcols; j++)
+    {
+      for (i = 0; i < matrows; i++)
+      {
+        SM_ELEMENT_BD(A, k, i, j)  = (j + 1) * (i + j);
+        SM_ELEMENT_BD(AT, k, j, i) = (j + 1) * (i + j);
+      }
+    }
+    if (square)
+    {
+      for (i = 0; i < matrows; i++) { SM_ELEMENT_BD(I, k, i, i) = ONE; }
+    }
+  }
+
+  xdata = N_VGetArrayPointer(x);
+  for (k = 0; k < nblocks; k++)
+  {
+    for (i = 0; i < matcols; i++) { xdata[matcols * k + i] = ONE / (i + 1); }
+  }
+
+  ydata = N_VGetArrayPointer(y);
+  for (k = 0; k < nblocks; k++)
+  {
+    for (i = 0; i < matrows; i++)
+    {
+      m                      = i;
+      n                      = m + matcols - 1;
+      ydata[matrows * k + i] = HALF * (n + 1 - m) * (n + m);
+    }
+  }
+
+  /* SUNMatrix Tests */
+  fails += Test_SUNMatGetID(A, SUNMATRIX_BLOCKDENSE, 0);
+  fails += Test_SUNMatClone(A, 0);
+  fails += Test_SUNMatCopy(A, 0);
+  fails += Test_SUNMatZero(A, 0);
+  if (square)
+  {
+    fails += Test_SUNMatScaleAdd(A, I, 0);
+    fails += Test_SUNMatScaleAddI(A, I, 0);
+  }
+  fails += Test_SUNMatMatvec(A, x, y, 0);
+  fails += Test_SUNMatHermitianTransposeVec(A, AT, x, y, 0);
+
+  /* Print result */
+  if (fails)
+  {
+    printf("FAIL: SUNMatrix module failed %i tests \n \n", fails);
+    printf("\nA =\n");
+    SUNMatrix_BlockDense_Print(A, stdout);
+    if (square)
+    {
+      printf("\nI =\n");
+      SUNMatrix_BlockDense_Print(I, stdout);
+    }
+    printf("\nx =\n");
+    N_VPrint_Serial(x);
+    printf("\ny =\n");
+    N_VPrint_Serial(y);
+  }
+  else { printf("SUCCESS: SUNMatrix module passed all tests \n \n"); }
+
+  /* Free vectors and matrices */
+  N_VDestroy(x);
+  N_VDestroy(y);
+  SUNMatDestroy(A);
+  SUNMatDestroy(AT);
+  if (square) { SUNMatDestroy(I); }
+  SUNContext_Free(&sunctx);
+
+  return (fails);
+}
+
+/* ----------------------------------------------------------------------
+ * Check matrix (only the active blocks, padding blocks are not used)
+ * --------------------------------------------------------------------*/
+int check_matrix(SUNMatrix A, SUNMatrix B, sunrealtype tol)
+{
+  int failure = 0;
+  sunindextype i, j, k;
+
+  /* check dimensions */
+  if (SUNMatrix_BlockDense_NumBlocks(A) != SUNMatrix_BlockDense_NumBlocks(B) ||
+      SUNMatrix_BlockDense_BlockRows(A) != SUNMatrix_BlockDense_BlockRows(B) ||
+      SUNMatrix_BlockDense_BlockColumns(A) != SUNMatrix_BlockDense_BlockColumns(B))
+  {
+    printf(">>> ERROR: check_matrix: Different matrix dimensions \n");
+    return (1);
+  }
+
+  /* compare data */
+  for (k = 0; k < SUNMatrix_BlockDense_NumBlocks(A); k++)
+  {
+    for (j = 0; j < SUNMatrix_BlockDense_BlockColumns(A); j++)
+    {
+      for (i = 0; i < SUNMatrix_BlockDense_BlockRows(A); i++)
+      {
+        failure += SUNRCompareTol(SM_ELEMENT_BD(A, k, i, j),
+                                  SM_ELEMENT_BD(B, k, i, j), tol);
+      }
+    }
+  }
+
+  if (failure > ZERO) { return (1); }
+  else { return (0); }
+}
+
+int check_matrix_entry(SUNMatrix A, sunrealtype val, sunrealtype tol)
+{
+  int failure = 0;
+  sunindextype i, j, k;
+  sunrealtype Aval;
+
+  /* compare data */
+  for (k = 0; k < SUNMatrix_BlockDense_NumBlocks(A); k++)
+  {
+    for (j = 0; j < SUNMatrix_BlockDense_BlockColumns(A); j++)
+    {
+      for (i = 0; i < SUNMatrix_BlockDense_BlockRows(A); i++)
+      {
+        Aval = SM_ELEMENT_BD(A, k, i, j);
+        if (SUNRCompareTol(Aval, val, tol) != 0)
+        {
+          printf("  A[%ld](%ld,%ld) = %" GSYM " != %" GSYM " (err = %" GSYM
+                 ")\n",
+                 (long int)k, (long int)i, (long int)j, Aval, val,
+                 SUNRabs(Aval - val));
+          failure++;
+        }
+      }
+    }
+  }
+
+  if (failure > ZERO) { return (1); }
+  else { return (0); }
+}
+
+int check_vector(N_Vector x, N_Vector y, sunrealtype tol)
+{
+  int failure = 0;
+  sunrealtype *xdata, *ydata;
+  sunindextype xldata, yldata;
+  sunindextype i;
+
+  /* get vector data */
+  xdata = N_VGetArrayPointer(x);
+  ydata = N_VGetArrayPointer(y);
+
+  /* check data lengths */
+  xldata = N_VGetLength(x);
+  yldata = N_VGetLength(y);
+
+  if (xldata != yldata)
+  {
+    printf(">>> ERROR: check_vector: Different data array lengths \n");
+    return (1);
+  }
+
+  /* check vector data */
+  for (i = 0; i < xldata; i++)
+  {
+    failure += SUNRCompareTol(xdata[i], ydata[i], tol);
+  }
+
+  if (failure > ZERO)
+  {
+    printf("Check_vector failures:\n");
+    for (i = 0; i < xldata; i++)
+    {
+      if (SUNRCompareTol(xdata[i], ydata[i], tol) != 0)
+      {
+        printf("  xdata[%ld] = %" GSYM " != %" GSYM " (err = %" GSYM ")\n",
+               (long int)i, xdata[i], ydata[i], SUNRabs(xdata[i] - ydata[i]));
+      }
+    }
+  }
+
+  if (failure > ZERO) { return (1); }
+  else { return (0); }
+}
+
+sunbooleantype has_data(SUNMatrix A)
+{
+  sunrealtype* Adata = SUNMatrix_BlockDense_Data(A);
+  if (Adata == NULL) { return SUNFALSE; }
+  else { return SUNTRUE; }
+}
+
+sunbooleantype is_square(SUNMatrix A)
+{
+  if (SUNMatrix_BlockDense_Rows(A) == SUNMatrix_BlockDense_Columns(A))
+  {
+    return SUNTRUE;
+  }
+  else { return SUNFALSE; }
+}
+
+void sync_device(SUNMatrix A)
+{
+  /* not running on GPU, just return */
+  return;
+}
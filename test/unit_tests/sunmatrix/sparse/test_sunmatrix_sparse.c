@@ -35,6 +35,10 @@
 int Test_SUNMatScaleAdd2(SUNMatrix A, SUNMatrix B, N_Vector x, N_Vector y,
                          N_Vector z);
 int Test_SUNMatScaleAddI2(SUNMatrix A, N_Vector x, N_Vector y);
+int Test_SUNSparseMatrixLockPattern(SUNMatrix A, SUNMatrix B, N_Vector x,
+                                    N_Vector y, N_Vector z);
+int Test_SUNSparseMatrixMatvecLocked(SUNMatrix A, N_Vector x, N_Vector y);
+void reverse_entries(SUNMatrix A);
 int Test_SUNSparseMatrixToCSC(SUNMatrix A);
 int Test_SUNSparseMatrixToCSR(SUNMatrix A);
 
@@ -472,7 +476,9 @@ int main(int argc, char* argv[])
     fails += Test_SUNMatScaleAddI(A, I, 0);
     fails += Test_SUNMatScaleAddI2(A, x, y);
   }
+  fails += Test_SUNSparseMatrixLockPattern(A, B, x, y, z);
   fails += Test_SUNMatMatvec(A, x, y, 0);
+  fails += Test_SUNSparseMatrixMatvecLocked(A, x, y);
   fails += Test_SUNMatHermitianTransposeVec(A, AT, x, y, 0);
   fails += Test_SUNMatSpace(A, 0);
   if (mattype == SUN_CSR_MAT) { fails += Test_SUNSparseMatrixToCSC(A); }
@@ -913,6 +919,186 @@ int Test_SUNMatScaleAddI2(SUNMatrix A, N_Vector x, N_Vector y)
   return (0);
 }
 
+/* ----------------------------------------------------------------------
+ * Pattern-locked ScaleAdd and ScaleAddI tests for sparse matrices:
+ *    y should already equal A*x
+ *    z should already equal B*x
+ *    the ScaleAddI checks are only done if A is square
+ * --------------------------------------------------------------------*/
+int Test_SUNSparseMatrixLockPattern(SUNMatrix A, SUNMatrix B, N_Vector x,
+                                    N_Vector y, N_Vector z)
+{
+  int failure = 0;
+  SUNMatrix C, D;
+  N_Vector u, v;
+  sunrealtype tol = 100 * SUN_UNIT_ROUNDOFF;
+
+  C = SUNMatClone(A);
+  u = N_VClone(y);
+  v = N_VClone(y);
+
+  /* the first call computes C = A + B and stores the positions of B in C,
+     the second call reuses them to compute C = A + 2B */
+  failure += SUNMatCopy(A, C);
+  failure += SUNSparseMatrix_LockPattern(C, SUNTRUE);
+  failure += SUNMatScaleAdd(ONE, C, B);
+  failure += SUNMatScaleAdd(ONE, C, B);
+  if (failure || SM_CONTENT_S(C)->addidx == NULL)
+  {
+    printf(">>> FAILED test -- SUNSparseMatrix_LockPattern ScaleAdd setup \n");
+    failure = 1;
+  }
+  else
+  {
+    SUNMatMatvec(C, x, u);             /* u = Cx = Ax+2Bx */
+    N_VLinearSum(ONE, y, TWO, z, v);   /* v = y+2z */
+    failure = check_vector(u, v, tol); /* u ?= v */
+    if (failure)
+    {
+      printf(">>> FAILED test -- SUNSparseMatrix_LockPattern ScaleAdd \n");
+    }
+    else
+    { printf("    PASSED test -- SUNSparseMatrix_LockPattern ScaleAdd \n"); }
+  }
+
+  /* a different B with the same number of nonzeros whose entries are stored
+     in a different order must not reuse the stored positions: C = A + 3B */
+  if (!failure)
+  {
+    D = SUNMatClone(B);
+    failure += SUNMatCopy(B, D);
+    reverse_entries(D);
+    failure += SUNMatScaleAdd(ONE, C, D);
+    if (failure)
+    {
+      printf(
+        ">>> FAILED test -- SUNSparseMatrix_LockPattern ScaleAdd new B setup \n");
+      failure = 1;
+    }
+    else
+    {
+      SUNMatMatvec(C, x, u);             /* u = Cx = Ax+3Bx */
+      N_VLinearSum(ONE, y, SUN_RCONST(3.0), z, v); /* v = y+3z */
+      failure = check_vector(u, v, tol); /* u ?= v */
+      if (failure)
+      {
+        printf(">>> FAILED test -- SUNSparseMatrix_LockPattern ScaleAdd new B \n");
+      }
+      else
+      {
+        printf("    PASSED test -- SUNSparseMatrix_LockPattern ScaleAdd new B \n");
+      }
+    }
+    SUNMatDestroy(D);
+  }
+
+  /* the first call computes D = A + I and stores the diagonal positions in D,
+     the second call reuses them to compute D = A + 2I */
+  if (!failure && is_square(A))
+  {
+    D = SUNMatClone(A);
+    failure += SUNMatCopy(A, D);
+    failure += SUNSparseMatrix_LockPattern(D, SUNTRUE);
+    failure += SUNMatScaleAddI(ONE, D);
+    failure += SUNMatScaleAddI(ONE, D);
+    if (failure || SM_CONTENT_S(D)->diagidx == NULL)
+    {
+      printf(">>> FAILED test -- SUNSparseMatrix_LockPattern ScaleAddI setup \n");
+      failure = 1;
+    }
+    else
+    {
+      SUNMatMatvec(D, x, u);             /* u = Dx = Ax+2x */
+      N_VLinearSum(ONE, y, TWO, x, v);   /* v = y+2x */
+      failure = check_vector(u, v, tol); /* u ?= v */
+      if (failure)
+      {
+        printf(">>> FAILED test -- SUNSparseMatrix_LockPattern ScaleAddI \n");
+      }
+      else
+      {
+        printf("    PASSED test -- SUNSparseMatrix_LockPattern ScaleAddI \n");
+      }
+    }
+
+    /* moving the diagonal entries within the pattern must not reuse the
+       stored positions: D = A + 3I */
+    if (!failure)
+    {
+      reverse_entries(D);
+      failure += SUNMatScaleAddI(ONE, D);
+      SUNMatMatvec(D, x, u);                       /* u = Dx = Ax+3x */
+      N_VLinearSum(ONE, y, SUN_RCONST(3.0), x, v); /* v = y+3x */
+      failure += check_vector(u, v, tol);          /* u ?= v */
+      if (failure)
+      {
+        printf(
+          ">>> FAILED test -- SUNSparseMatrix_LockPattern ScaleAddI moved \n");
+      }
+      else
+      {
+        printf(
+          "    PASSED test -- SUNSparseMatrix_LockPattern ScaleAddI moved \n");
+      }
+    }
+
+    /* unlocking frees the stored positions */
+    SUNSparseMatrix_LockPattern(D, SUNFALSE);
+    if (!failure && SM_CONTENT_S(D)->diagidx != NULL)
+    {
+      printf(">>> FAILED test -- SUNSparseMatrix_LockPattern unlock \n");
+      failure = 1;
+    }
+    SUNMatDestroy(D);
+  }
+
+  SUNMatDestroy(C);
+  N_VDestroy(u);
+  N_VDestroy(v);
+  return (failure ? 1 : 0);
+}
+
+/* ----------------------------------------------------------------------
+ * Matrix-vector product tests for sparse matrices with a locked pattern,
+ * using the default storage and the SELL-C-sigma slices:
+ *    y should already equal A*x
+ * --------------------------------------------------------------------*/
+int Test_SUNSparseMatrixMatvecLocked(SUNMatrix A, N_Vector x, N_Vector y)
+{
+  int failure = 0, format;
+  SUNMatrix C;
+  N_Vector u;
+  sunrealtype tol = 100 * SUN_UNIT_ROUNDOFF;
+
+  C = SUNMatClone(A);
+  u = N_VClone(y);
+
+  failure += SUNMatCopy(A, C);
+  failure += SUNSparseMatrix_LockPattern(C, SUNTRUE);
+
+  for (format = SUN_SPARSE_MATVEC_DEFAULT;
+       !failure && format <= SUN_SPARSE_MATVEC_SELL; format++)
+  {
+    /* the second product reuses the storage built by the first one */
+    failure += SUNSparseMatrix_SetMatvecFormat(C, format);
+    failure += SUNMatMatvec(C, x, u);
+    failure += SUNMatMatvec(C, x, u);
+    if (!failure) { failure = check_vector(u, y, tol); }
+    if (failure)
+    {
+      printf(">>> FAILED test -- SUNSparseMatrix_SetMatvecFormat %d \n", format);
+    }
+    else
+    {
+      printf("    PASSED test -- SUNSparseMatrix_SetMatvecFormat %d \n", format);
+    }
+  }
+
+  SUNMatDestroy(C);
+  N_VDestroy(u);
+  return (failure ? 1 : 0);
+}
+
 int Test_SUNSparseMatrixToCSR(SUNMatrix A)
 {
   int failure;
@@ -996,6 +1182,30 @@ int Test_SUNSparseMatrixToCSC(SUNMatrix A)
 /* ----------------------------------------------------------------------
  * Check matrix
  * --------------------------------------------------------------------*/
+/* Reverse the order of the entries in each column (row) of a sparse matrix,
+   which keeps the matrix and the number of nonzeros but moves the entries */
+void reverse_entries(SUNMatrix A)
+{
+  sunindextype j, lo, hi, itmp;
+  sunrealtype rtmp;
+  sunindextype* Ap = SM_INDEXPTRS_S(A);
+  sunindextype* Ai = SM_INDEXVALS_S(A);
+  sunrealtype* Ax  = SM_DATA_S(A);
+
+  for (j = 0; j < SM_NP_S(A); j++)
+  {
+    for (lo = Ap[j], hi = Ap[j + 1] - 1; lo < hi; lo++, hi--)
+    {
+      itmp   = Ai[lo];
+      Ai[lo] = Ai[hi];
+      Ai[hi] = itmp;
+      rtmp   = Ax[lo];
+      Ax[lo] = Ax[hi];
+      Ax[hi] = rtmp;
+    }
+  }
+}
+
 int check_matrix(SUNMatrix A, SUNMatrix B, sunrealtype tol)
 {
   int failure = 0;
@@ -0,0 +1,230 @@
+/*------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2025-2026, Lawrence Livermore National Security,
+ * University of Maryland Baltimore County, and the SUNDIALS contributors.
+ * Copyright (c) 2013-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * Copyright (c) 2002-2013, Lawrence Livermore National Security.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ *-----------------------------------------------------------------*/
+
+#include <algorithm>
+#include <iostream>
+#include <sundials/sundials_core.hpp>
+#include <sunmemory/sunmemory_system.h>
+#include <vector>
+
+struct PoolStats
+{
+  unsigned long num_allocations, num_deallocations, num_hits, num_misses;
+  size_t bytes_allocated, bytes_high_watermark, bytes_reserved, bytes_cached;
+};
+
+static int get_stats(SUNMemoryHelper helper, PoolStats& s)
+{
+  int retval = SUNMemoryHelper_GetAllocStats(helper, SUNMEMTYPE_HOST,
+                                             &s.num_allocations,
+                                             &s.num_deallocations,
+                                             &s.bytes_allocated,
+                                             &s.bytes_high_watermark);
+  if (retval) { return retval; }
+  return SUNMemoryHelper_GetPoolStats_SysPool(helper, &s.num_hits,
+                                              &s.num_misses, &s.bytes_reserved,
+                                              &s.bytes_cached);
+}
+
+static void print_stats(const PoolStats& s)
+{
+  std::cout << "\tnum_allocations = " << s.num_allocations
+            << " num_deallocations = " << s.num_deallocations
+            << " bytes_allocated = " << s.bytes_allocated
+            << " bytes_high_watermark = " << s.bytes_high_watermark << "\n"
+            << "\tnum_hits = " << s.num_hits
+            << " num_misses = " << s.num_misses
+            << " bytes_reserved = " << s.bytes_reserved
+            << " bytes_cached = " << s.bytes_cached << "\n";
+}
+
+static int check(bool passed, const char* what)
+{
+  if (!passed) { std::cout << "    " << what << " FAILED\n"; }
+  return passed ? 0 : 1;
+}
+
+static int test_reuse(SUNMemoryHelper helper)
+{
+  int fails = 0;
+  PoolStats s;
+
+  std::cout << "  Reuse of cached blocks... \n";
+
+  // A block is reused by a later request in the same size class
+  SUNMemory mem1 = nullptr;
+  SUNMemory mem2 = nullptr;
+  if (SUNMemoryHelper_Alloc(helper, &mem1, 100, SUNMEMTYPE_HOST, nullptr))
+  {
+    return 1;
+  }
+  void* ptr1 = mem1->ptr;
+  static_cast<char*>(ptr1)[99] = 1;
+  SUNMemoryHelper_Dealloc(helper, mem1, nullptr);
+
+  if (SUNMemoryHelper_Alloc(helper, &mem2, 110, SUNMEMTYPE_HOST, nullptr))
+  {
+    return 1;
+  }
+  fails += check(mem2->ptr == ptr1, "same class reuse");
+  fails += check(mem2->bytes == 110, "requested size");
+  SUNMemoryHelper_Dealloc(helper, mem2, nullptr);
+
+  get_stats(helper, s);
+  print_stats(s);
+  fails += check(s.num_allocations == 2 && s.num_deallocations == 2,
+                 "allocation counts");
+  fails += check(s.num_hits == 1 && s.num_misses == 1, "hit/miss counts");
+  fails += check(s.bytes_allocated == 0 && s.bytes_high_watermark == 110,
+                 "bytes allocated");
+  fails += check(s.bytes_reserved == 112 && s.bytes_cached == 112,
+                 "bytes reserved");
+
+  // Many same-sized buffers are satisfied from the pool after the first round
+  const int nbuf = 16;
+  const size_t sizes[3] = {8 * sizeof(sunrealtype), 1000 * sizeof(sunrealtype),
+                           (size_t{1} << 20) + 1};
+  std::vector<SUNMemory> mems(nbuf * 3, nullptr);
+  for (int round = 0; round < 3; round++)
+  {
+    for (int i = 0; i < nbuf * 3; i++)
+    {
+      if (SUNMemoryHelper_Alloc(helper, &mems[i], sizes[i % 3],
+                                SUNMEMTYPE_HOST, nullptr))
+      {
+        return 1;
+      }
+      // touch the whole requested region
+      std::fill_n(static_cast<char*>(mems[i]->ptr), sizes[i % 3], char(i));
+    }
+    for (int i = 0; i < nbuf * 3; i++)
+    {
+      if (static_cast<char*>(mems[i]->ptr)[sizes[i % 3] - 1] != char(i))
+      {
+        fails += check(false, "data integrity");
+      }
+      SUNMemoryHelper_Dealloc(helper, mems[i], nullptr);
+    }
+  }
+
+  get_stats(helper, s);
+  print_stats(s);
+  fails += check(s.num_misses == 1 + nbuf * 3, "misses after warm up");
+  fails += check(s.num_hits == 1 + 2 * nbuf * 3, "hits after warm up");
+  fails += check(s.bytes_allocated == 0, "bytes allocated");
+  fails += check(s.bytes_reserved == s.bytes_cached, "nothing in use");
+
+  if (fails) { std::cout << "  Reuse of cached blocks... FAILED\n"; }
+  else { std::cout << "  Reuse of cached blocks... PASSED\n"; }
+
+  return fails;
+}
+
+static int test_trim(SUNMemoryHelper helper)
+{
+  int fails = 0;
+  PoolStats s;
+
+  std::cout << "  SUNMemoryHelper_SetMaxCachedBytes_SysPool... \n";
+
+  get_stats(helper, s);
+  const size_t limit = s.bytes_cached / 2;
+
+  if (SUNMemoryHelper_SetMaxCachedBytes_SysPool(helper, limit)) { return 1; }
+  get_stats(helper, s);
+  print_stats(s);
+  fails += check(s.bytes_cached <= limit, "cache trimmed to limit");
+  fails += check(s.bytes_reserved == s.bytes_cached, "reserved bytes");
+
+  // Deallocated blocks beyond the limit are released
+  std::vector<SUNMemory> mems(64, nullptr);
+  for (auto& mem : mems)
+  {
+    if (SUNMemoryHelper_Alloc(helper, &mem, 4096, SUNMEMTYPE_HOST, nullptr))
+    {
+      return 1;
+    }
+  }
+  for (auto& mem : mems) { SUNMemoryHelper_Dealloc(helper, mem, nullptr); }
+  get_stats(helper, s);
+  print_stats(s);
+  fails += check(s.bytes_cached <= limit, "cache limit on dealloc");
+
+  if (fails)
+  {
+    std::cout << "  SUNMemoryHelper_SetMaxCachedBytes_SysPool... FAILED\n";
+  }
+  else
+  {
+    std::cout << "  SUNMemoryHelper_SetMaxCachedBytes_SysPool... PASSED\n";
+  }
+
+  std::cout << "  SUNMemoryHelper_Trim_SysPool... \n";
+
+  SUNMemory mem = nullptr;
+  SUNMemoryHelper_Alloc(helper, &mem, 200, SUNMEMTYPE_HOST, nullptr);
+  if (SUNMemoryHelper_Trim_SysPool(helper)) { return 1; }
+  get_stats(helper, s);
+  print_stats(s);
+  int trim_fails = check(s.bytes_cached == 0, "empty cache");
+  trim_fails += check(s.bytes_reserved == 224, "in use block kept");
+  SUNMemoryHelper_Dealloc(helper, mem, nullptr);
+
+  if (trim_fails) { std::cout << "  SUNMemoryHelper_Trim_SysPool... FAILED\n"; }
+  else { std::cout << "  SUNMemoryHelper_Trim_SysPool... PASSED\n"; }
+
+  return fails + trim_fails;
+}
+
+int main(int argc, char* argv[])
+{
+  int fails = 0;
+  sundials::Context sunctx;
+
+  std::cout << "Testing the SUNMemoryHelper_SysPool module... \n";
+
+  std::cout << "  SUNMemoryHelper_SysPool... \n";
+  SUNMemoryHelper helper = SUNMemoryHelper_SysPool(sunctx);
+  if (!helper)
+  {
+    std::cout << "  SUNMemoryHelper_SysPool... FAILED\n";
+    return -1;
+  }
+  std::cout << "  SUNMemoryHelper_SysPool... PASSED\n";
+
+  fails += test_reuse(helper);
+
+  std::cout << "  SUNMemoryHelper_Clone... \n";
+  SUNMemoryHelper helper2 = SUNMemoryHelper_Clone(helper);
+  if (!helper2 || test_reuse(helper2))
+  {
+    std::cout << "  SUNMemoryHelper_Clone... FAILED\n";
+    fails++;
+  }
+  else { std::cout << "  SUNMemoryHelper_Clone... PASSED\n"; }
+
+  fails += test_trim(helper);
+
+  // Destroy releases any cached blocks
+  std::cout << "  SUNMemoryHelper_Destroy... \n";
+  if (SUNMemoryHelper_Destroy(helper) || SUNMemoryHelper_Destroy(helper2))
+  {
+    std::cout << "  SUNMemoryHelper_Destroy... FAILED\n";
+    return -1;
+  }
+  std::cout << "  SUNMemoryHelper_Destroy... PASSED\n";
+
+  return fails;
+}
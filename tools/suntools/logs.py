@@ -20,8 +20,22 @@
 # -----------------------------------------------------------------------------
 
 import re
+import struct
 from collections import ChainMap
 
+# Binary log files written by SUNLogger_SetBinaryFilename begin with this magic
+# string followed by a 32-bit value used to detect the byte order
+_BINARY_LOG_MAGIC = b"SUNLOGB1"
+_BINARY_LOG_BYTE_ORDER = 0x01020304
+_BINARY_LOG_STRING_RECORD = 1
+_BINARY_LOG_MSG_RECORD = 2
+_BINARY_LOG_LEVELS = {1: "ERROR", 2: "WARNING", 3: "INFO", 4: "DEBUG"}
+
+# A printf conversion specification
+_FORMAT_SPEC = re.compile(
+    r"%([-+ #0']*)(\*|\d+)?(?:\.(\*|\d*))?(hh|h|ll|l|j|z|t|L)?([diouxXcaAeEfFgGspn%])"
+)
+
 
 def _convert_to_num(s):
     """Try to convert a string to an int or float
@@ -39,6 +53,126 @@ def _convert_to_num(s):
             return s
 
 
+def _read_binary_log_arg(data, offset, endian, conversion):
+    """Read a message argument from a binary log file.
+
+    :param bytes data: The contents of the binary log file.
+    :param int offset: The offset of the argument in data.
+    :param str endian: The struct module byte order character.
+    :param str conversion: The printf conversion character for the argument or
+                           ``*`` for a width or precision.
+    :returns: The argument value and the offset of the next argument.
+    """
+    if conversion in "*dic":
+        return struct.unpack_from(endian + "q", data, offset)[0], offset + 8
+    if conversion in "aAeEfFgG":
+        return struct.unpack_from(endian + "d", data, offset)[0], offset + 8
+    if conversion == "s":
+        (length,) = struct.unpack_from(endian + "I", data, offset)
+        offset += 4
+        value = data[offset : offset + length].decode("utf-8", errors="replace")
+        return value, offset + length
+    # unsigned integers and pointers
+    return struct.unpack_from(endian + "Q", data, offset)[0], offset + 8
+
+
+def _format_binary_log_msg(fmt, data, offset, endian):
+    """Format a message from a binary log file using its printf format string.
+
+    :param str fmt: The printf format string for the message.
+    :param bytes data: The contents of the binary log file.
+    :param int offset: The offset of the message arguments in data.
+    :param str endian: The struct module byte order character.
+    :returns: The formatted message and the offset of the next record.
+    """
+    text = []
+    position = 0
+    for match in _FORMAT_SPEC.finditer(fmt):
+        text.append(fmt[position : match.start()])
+        position = match.end()
+
+        flags, width, precision, _, conversion = match.groups()
+        if conversion == "%":
+            text.append("%")
+            continue
+
+        # Python does not support the thousands grouping flag or length modifiers
+        spec = "%" + flags.replace("'", "")
+        if width == "*":
+            width, offset = _read_binary_log_arg(data, offset, endian, "*")
+        if width is not None:
+            spec += str(width)
+        if precision == "*":
+            precision, offset = _read_binary_log_arg(data, offset, endian, "*")
+        if precision is not None:
+            spec += "." + str(precision)
+
+        value, offset = _read_binary_log_arg(data, offset, endian, conversion)
+        if conversion == "p":
+            text.append(hex(value))
+        elif conversion == "n":
+            continue
+        elif conversion in "aA":
+            text.append(float(value).hex())
+        elif conversion == "o" and "#" in flags:
+            # The Python alternate form uses a 0o prefix rather than 0
+            text.append((spec.replace("#", "") + "s") % ("0%o" % value if value else "0"))
+        else:
+            text.append((spec + conversion) % value)
+
+    text.append(fmt[position:])
+    return "".join(text), offset
+
+
+def binary_log_to_lines(filename):
+    """Decode a binary log file into the lines of the equivalent text log file.
+
+    :param str filename: The name of the binary log file written by a
+                         ``SUNLogger`` with binary output enabled.
+    :returns: A list of log file lines (without line endings).
+    """
+    with open(filename, "rb") as logfile:
+        data = logfile.read()
+
+    if data[: len(_BINARY_LOG_MAGIC)] != _BINARY_LOG_MAGIC:
+        raise ValueError(f"{filename} is not a SUNDIALS binary log file")
+    offset = len(_BINARY_LOG_MAGIC)
+
+    if struct.unpack_from("<I", data, offset)[0] == _BINARY_LOG_BYTE_ORDER:
+        endian = "<"
+    else:
+        endian = ">"
+    offset += 4
+
+    strings = {}
+    messages = []
+    while offset < len(data):
+        record_type = data[offset]
+        offset += 1
+        if record_type == _BINARY_LOG_STRING_RECORD:
+            string_id, length = struct.unpack_from(endian + "II", data, offset)
+            offset += 8
+            strings[string_id] = data[offset : offset + length].decode("utf-8", errors="replace")
+            offset += length
+        elif record_type == _BINARY_LOG_MSG_RECORD:
+            level, rank, scope, label, fmt, _ = struct.unpack_from(endian + "BiIIId", data, offset)
+            offset += 25
+            text, offset = _format_binary_log_msg(strings[fmt], data, offset, endian)
+            messages.append(
+                f"[{_BINARY_LOG_LEVELS[level]}][rank {rank}][{strings[scope]}][{strings[label]}] {text}"
+            )
+        else:
+            raise ValueError(f"unknown record type {record_type} in {filename}")
+
+    return "\n".join(messages).splitlines()
+
+
+def _is_binary_log(filename):
+    """Check if a file is a binary log file."""
+    with open(filename, "rb") as logfile:
+        return logfile.read(len(_BINARY_LOG_MAGIC)) == _BINARY_LOG_MAGIC
+
+
 def _parse_logfile_payload(payload, line_number, all_lines, array_indicator="(:)"):
     """Parse the payload of a log file line into a dictionary.
 
@@ -178,6 +312,9 @@ def log_file_to_list(filename):
     .. code-block:: none
 
        [ {step : 1, tn : 0.0, h : 0.01, ...}, {step : 2, tn : 0.01, h : 0.10, ...}, ...]
+
+    Binary log files (see ``SUNLogger_SetBinaryFilename``) are decoded with
+    :py:func:`binary_log_to_lines` before parsing.
     """
     with open(filename, "r") as logfile:
 
@@ -191,7 +328,10 @@ def log_file_to_list(filename):
         partition = 0
 
         # Read the log file
-        all_lines = logfile.readlines()
+        if _is_binary_log(filename):
+            all_lines = binary_log_to_lines(filename)
+        else:
+            all_lines = logfile.readlines()
 
         # Create instance of helper class for building attempt dictionary
         s = StepData()